@@ -2,7 +2,9 @@
 #include <ATen/Utils.h>
 #include <ATen/core/MT19937RNGEngine.h>
 #include <c10/util/MathConstants.h>
+#include <c10/util/env.h>
 #include <algorithm>
+#include <limits>
 
 namespace at {
 
@@ -58,6 +60,74 @@ const Generator& getDefaultCPUGenerator() {
   return default_gen_cpu;
 }
 
+// Note [Per-thread CPU generator sub-states]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every random op that runs without an explicit generator locks the one
+// default generator for its device, so a multi-threaded pipeline calling
+// random_ / dropout from many threads serializes on that mutex. With
+// TORCH_CPU_RNG_THREAD_STREAMS set, getCPUGeneratorForThread() instead
+// hands each calling thread its own CPUGeneratorImpl whose seed is
+// derived from the default generator's seed and a per-thread stream
+// index, so concurrent ops lock disjoint mutexes.
+//
+// Seeding and state-dump keep merged semantics through the default
+// generator: torch.manual_seed / set_rng_state mutate it and bump its
+// derivation epoch, and each thread re-derives its sub-state the next
+// time it asks for a generator. get_rng_state still dumps the default
+// generator only -- sub-states are derived values, not independent state.
+// Runs are reproducible after a manual_seed provided work is assigned to
+// threads the same way (each thread's stream index is fixed at its first
+// random op). When the env var is unset, this returns the default
+// generator itself and behavior is bit-for-bit unchanged.
+bool useThreadLocalCPUGenerators() {
+  static bool enabled =
+      c10::utils::check_env("TORCH_CPU_RNG_THREAD_STREAMS") == true;
+  return enabled;
+}
+
+// splitmix64: decorrelates consecutive stream indices so sub-state seeds
+// don't share low-bit structure. The CPU engine is MT19937, not a
+// counter-based Philox, so independent streams are obtained by seed
+// derivation rather than counter splitting.
+uint64_t deriveSubStateSeed(uint64_t seed, uint64_t stream) {
+  uint64_t z = seed + (stream + 1) * 0x9e3779b97f4a7c15ull;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+const Generator& getCPUGeneratorForThread() {
+  if (!useThreadLocalCPUGenerators()) {
+    return getDefaultCPUGenerator();
+  }
+  static std::atomic<uint64_t> next_stream_index{0};
+  struct ThreadSubState {
+    Generator gen;
+    uint64_t stream_index = 0;
+    uint64_t epoch = std::numeric_limits<uint64_t>::max();
+  };
+  thread_local ThreadSubState sub_state;
+  const auto& root = getDefaultCPUGenerator();
+  auto* root_impl = check_generator<CPUGeneratorImpl>(root);
+  if (!sub_state.gen.defined()) {
+    sub_state.stream_index =
+        next_stream_index.fetch_add(1, std::memory_order_relaxed);
+    sub_state.gen = createCPUGenerator();
+  }
+  if (sub_state.epoch != root_impl->derivation_epoch()) {
+    // Cold path: the default generator was (re)seeded since this thread
+    // last derived. Read seed and epoch under the root's lock so a
+    // concurrent manual_seed can't give us the seed of one epoch and the
+    // epoch counter of another.
+    std::lock_guard<std::mutex> lock(root_impl->mutex_);
+    const auto epoch = root_impl->derivation_epoch();
+    sub_state.gen.set_current_seed(
+        deriveSubStateSeed(root_impl->current_seed(), sub_state.stream_index));
+    sub_state.epoch = epoch;
+  }
+  return sub_state.gen;
+}
+
 /**
  * Utility to create a CPUGeneratorImpl. Returns a shared_ptr
  */
@@ -92,6 +162,7 @@ void CPUGeneratorImpl::set_current_seed(uint64_t seed) {
   next_float_normal_sample_.reset();
   next_double_normal_sample_.reset();
   engine_ = mt19937(seed);
+  derivation_epoch_.fetch_add(1, std::memory_order_release);
 }
 
 /**
@@ -196,6 +267,7 @@ void CPUGeneratorImpl::set_state(const c10::TensorImpl& new_state) {
   this->engine_ = engine;
   this->next_float_normal_sample_ = float_normal_sample;
   this->next_double_normal_sample_ = double_normal_sample;
+  derivation_epoch_.fetch_add(1, std::memory_order_release);
 }
 
 /**
@@ -312,6 +384,16 @@ at::mt19937 CPUGeneratorImpl::engine() {
  */
 void CPUGeneratorImpl::set_engine(at::mt19937 engine) {
   engine_ = engine;
+  derivation_epoch_.fetch_add(1, std::memory_order_release);
+}
+
+/**
+ * Gets the reseed epoch of the CPUGeneratorImpl.
+ *
+ * See Note [Per-thread CPU generator sub-states]
+ */
+uint64_t CPUGeneratorImpl::derivation_epoch() const {
+  return derivation_epoch_.load(std::memory_order_acquire);
 }
 
 /**
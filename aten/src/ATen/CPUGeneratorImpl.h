@@ -5,6 +5,8 @@
 #include <c10/core/GeneratorImpl.h>
 #include <c10/util/Optional.h>
 
+#include <atomic>
+
 namespace at {
 
 struct TORCH_API CPUGeneratorImpl : public c10::GeneratorImpl {
@@ -28,12 +30,17 @@ struct TORCH_API CPUGeneratorImpl : public c10::GeneratorImpl {
   void set_next_double_normal_sample(c10::optional<double> randn);
   at::mt19937 engine();
   void set_engine(at::mt19937 engine);
+  // Bumped whenever the generator is reseeded (set_current_seed, set_state,
+  // set_engine); lets derived per-thread sub-states detect that they must
+  // re-derive. See Note [Per-thread CPU generator sub-states].
+  uint64_t derivation_epoch() const;
 
  private:
   CPUGeneratorImpl* clone_impl() const override;
   at::mt19937 engine_;
   c10::optional<float> next_float_normal_sample_;
   c10::optional<double> next_double_normal_sample_;
+  std::atomic<uint64_t> derivation_epoch_{0};
 };
 
 namespace detail {
@@ -42,6 +49,14 @@ TORCH_API const Generator& getDefaultCPUGenerator();
 TORCH_API Generator
 createCPUGenerator(uint64_t seed_val = default_rng_seed_val);
 
+// The generator a native random op should sample from when the user did
+// not pass one. By default this is getDefaultCPUGenerator(); with
+// TORCH_CPU_RNG_THREAD_STREAMS set it is a per-thread sub-state derived
+// from the default generator, so concurrent random ops on different
+// threads don't contend on one mutex.
+// See Note [Per-thread CPU generator sub-states].
+TORCH_API const Generator& getCPUGeneratorForThread();
+
 } // namespace detail
 
 } // namespace at
@@ -248,14 +248,86 @@ DLManagedTensor* toDLPack(const Tensor& src) {
   return &(atDLMTensor->tensor);
 }
 
+namespace {
+
+// Note [Pooled DLPack import]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Importing through at::from_blob costs two extra heap allocations per
+// tensor: the std::function wrapping the capsule deleter and the
+// InefficientStdFunctionContext that carries it inside the DataPtr.
+// Pipelines that cross the framework boundary for every batch pay this on
+// every import. The default import below instead hands the DataPtr a
+// fixed-size context node recycled through a thread-local free list, so a
+// steady-state import only allocates the StorageImpl/TensorImpl pair
+// (whose deallocation is owned by intrusive_ptr refcounting and cannot be
+// pooled from here). A node released on another thread goes to that
+// thread's free list, the same policy caching allocators use for
+// cross-thread frees.
+struct DLPackImportContext {
+  const DLManagedTensor* managed_tensor = nullptr;
+  DLPackImportContext* next = nullptr;
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local DLPackImportContext* import_context_free_list = nullptr;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local size_t import_context_free_count = 0;
+constexpr size_t kMaxPooledImportContexts = 256;
+
+DLPackImportContext* acquireImportContext(const DLManagedTensor* src) {
+  DLPackImportContext* node = import_context_free_list;
+  if (node != nullptr) {
+    import_context_free_list = node->next;
+    --import_context_free_count;
+  } else {
+    node = new DLPackImportContext();
+  }
+  node->managed_tensor = src;
+  node->next = nullptr;
+  return node;
+}
+
+void deleteImportContext(void* ctx) {
+  auto* node = static_cast<DLPackImportContext*>(ctx);
+  const auto* src = node->managed_tensor;
+  if (src != nullptr && src->deleter) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    src->deleter(const_cast<DLManagedTensor*>(src));
+  }
+  if (import_context_free_count < kMaxPooledImportContexts) {
+    node->next = import_context_free_list;
+    import_context_free_list = node;
+    ++import_context_free_count;
+  } else {
+    delete node;
+  }
+}
+
+} // namespace
+
 Tensor fromDLPack(const DLManagedTensor* src) {
-  auto deleter = [src](void* self) {
-    if (src->deleter) {
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-      src->deleter(const_cast<DLManagedTensor*>(src));
-    }
-  };
-  return fromDLPack(src, std::move(deleter));
+  Device device = getATenDevice(src->dl_tensor.device);
+  ScalarType stype = toScalarType(src->dl_tensor.dtype);
+  auto maker = at::for_blob(
+      src->dl_tensor.data,
+      IntArrayRef(src->dl_tensor.shape, src->dl_tensor.ndim));
+  maker.context(acquireImportContext(src), &deleteImportContext)
+      .options(at::device(device).dtype(stype))
+      .target_device(device);
+  if (src->dl_tensor.strides) {
+    maker.strides(IntArrayRef(src->dl_tensor.strides, src->dl_tensor.ndim));
+  }
+  return maker.make_tensor();
+}
+
+std::vector<Tensor> fromDLPackBatched(
+    c10::ArrayRef<const DLManagedTensor*> srcs) {
+  std::vector<Tensor> out;
+  out.reserve(srcs.size());
+  for (const auto* src : srcs) {
+    out.push_back(fromDLPack(src));
+  }
+  return out;
 }
 
 Tensor fromDLPack(
@@ -15,6 +15,10 @@ TORCH_API DLManagedTensor* toDLPack(const Tensor& src);
 TORCH_API Tensor fromDLPack(const DLManagedTensor* src);
 TORCH_API Tensor
 fromDLPack(const DLManagedTensor* src, std::function<void(void*)> deleter);
+// Imports several capsules at once through the pooled path; see
+// Note [Pooled DLPack import] in DLConvertor.cpp.
+TORCH_API std::vector<Tensor> fromDLPackBatched(
+    c10::ArrayRef<const DLManagedTensor*> srcs);
 TORCH_API DLDataType getDLDataType(const Tensor& t);
 TORCH_API DLDevice getDLContext(const Tensor& tensor, const int64_t& device_id);
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <ATen/Parallel.h>
+#include <c10/core/LatencyBudgetThreadPool.h>
+#include <c10/core/WorkStealingThreadPool.h>
 #include <c10/core/thread_pool.h>
 
 namespace at {
@@ -11,6 +13,27 @@ class TORCH_API PTThreadPool : public c10::ThreadPool {
       : c10::ThreadPool(pool_size, numa_node_id, []() {
           c10::setThreadName("PTThreadPool");
           at::init_num_threads();
+          at::internal::apply_thread_affinity();
+        }) {}
+};
+
+class TORCH_API PTWorkStealingThreadPool : public c10::WorkStealingThreadPool {
+ public:
+  explicit PTWorkStealingThreadPool(int pool_size, int numa_node_id = -1)
+      : c10::WorkStealingThreadPool(pool_size, numa_node_id, []() {
+          c10::setThreadName("PTThreadPool");
+          at::init_num_threads();
+          at::internal::apply_thread_affinity();
+        }) {}
+};
+
+class TORCH_API PTLatencyBudgetThreadPool : public c10::LatencyBudgetThreadPool {
+ public:
+  explicit PTLatencyBudgetThreadPool(int pool_size, int numa_node_id = -1)
+      : c10::LatencyBudgetThreadPool(pool_size, numa_node_id, []() {
+          c10::setThreadName("PTThreadPool");
+          at::init_num_threads();
+          at::internal::apply_thread_affinity();
         }) {}
 };
 
@@ -3,6 +3,7 @@
 #include <c10/macros/Macros.h>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace at {
 
@@ -26,8 +27,18 @@ TORCH_API int get_thread_num();
 // Checks whether the code runs in parallel region
 TORCH_API bool in_parallel_region();
 
+// Pins the calling thread and the intra-op worker threads to the given set
+// of logical cpu ids (as understood by sched_setaffinity). The mask is also
+// remembered so that pool threads spawned later apply it during their
+// initialization. Only effective on Linux; emits a warning elsewhere.
+TORCH_API void set_thread_affinity(const std::vector<int>& cpus);
+
 namespace internal {
 
+// Applies the affinity mask registered with set_thread_affinity() (if any)
+// to the calling thread; called during thread pool worker initialization.
+TORCH_API void apply_thread_affinity();
+
 // Initialise num_threads lazily at first parallel call
 inline void lazy_init_num_threads() {
   thread_local bool init = false;
@@ -4,9 +4,18 @@
 #include <ATen/PTThreadPool.h>
 #include <ATen/Version.h>
 
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <thread>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #if AT_MKL_ENABLED()
 #include <mkl.h>
 #endif
@@ -40,8 +49,102 @@ size_t get_env_num_threads(const char* var_name, size_t def_value = 0) {
   return def_value;
 }
 
+// Affinity mask registered via set_thread_affinity(); read by pool threads
+// during their initialization. Accessed with the atomic shared_ptr
+// overloads so registration doesn't race with a pool spinning up
+// concurrently.
+std::shared_ptr<std::vector<int>> thread_affinity_cpus_;
+
+void bind_current_thread(const std::vector<int>& cpus) {
+#if defined(__linux__)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : cpus) {
+    CPU_SET(cpu, &cpu_set);
+  }
+  if (sched_setaffinity(0, sizeof(cpu_set_t), &cpu_set) != 0) {
+    TORCH_WARN_ONCE(
+        "set_thread_affinity: sched_setaffinity failed: ", strerror(errno));
+  }
+#else
+  (void)cpus;
+  TORCH_WARN_ONCE("set_thread_affinity is only supported on Linux; ignoring");
+#endif
+}
+
 } // namespace
 
+namespace internal {
+
+void apply_thread_affinity() {
+  auto cpus = std::atomic_load_explicit(
+      &thread_affinity_cpus_, std::memory_order_acquire);
+  if (cpus) {
+    bind_current_thread(*cpus);
+  }
+}
+
+} // namespace internal
+
+void set_thread_affinity(const std::vector<int>& cpus) {
+  TORCH_CHECK(
+      !cpus.empty(), "set_thread_affinity: expected a non-empty cpu set");
+#if defined(__linux__)
+  for (const auto cpu : cpus) {
+    TORCH_CHECK(
+        cpu >= 0 && cpu < CPU_SETSIZE,
+        "set_thread_affinity: invalid cpu id ",
+        cpu);
+  }
+#endif
+  std::atomic_store_explicit(
+      &thread_affinity_cpus_,
+      std::make_shared<std::vector<int>>(cpus),
+      std::memory_order_release);
+
+  // Pin the calling (master) thread first: parallel_for runs chunk 0
+  // inline, and the mask is inherited by any threads spawned afterwards,
+  // including lazily-created pool workers.
+  internal::apply_thread_affinity();
+
+#if AT_PARALLEL_OPENMP && defined(_OPENMP)
+  // OpenMP keeps its worker team alive between regions (see
+  // init_num_threads), so pin the current team in place.
+  #pragma omp parallel
+  { internal::apply_thread_affinity(); }
+#elif AT_PARALLEL_NATIVE && !defined(C10_MOBILE)
+  // The intra-op pool may already be running; broadcast one pinning task
+  // per worker. Each task holds its worker hostage until the whole team
+  // has checked in, so the tasks land on distinct threads instead of one
+  // worker draining the queue.
+  const int num_workers = get_num_threads() - 1;
+  if (num_workers > 0 && !in_parallel_region()) {
+    struct BarrierState {
+      std::mutex mutex;
+      std::condition_variable cv;
+      int arrived = 0;
+    };
+    auto state = std::make_shared<BarrierState>();
+    for (int i = 0; i < num_workers; ++i) {
+      intraop_launch([state, num_workers]() {
+        internal::apply_thread_affinity();
+        std::unique_lock<std::mutex> lock(state->mutex);
+        ++state->arrived;
+        state->cv.notify_all();
+        state->cv.wait(
+            lock, [&]() { return state->arrived >= num_workers; });
+      });
+    }
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&]() { return state->arrived >= num_workers; });
+  }
+#elif AT_PARALLEL_NATIVE_TBB
+  // TBB schedules tasks with no thread-identity guarantee, so a barrier
+  // broadcast could deadlock; rely on worker threads inheriting the
+  // calling thread's mask instead.
+#endif
+}
+
 std::string get_parallel_info() {
   std::ostringstream ss;
 
@@ -12,6 +12,9 @@
 #endif // C10_MOBILE
 
 #include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
 #include <utility>
 
 #ifdef _OPENMP
@@ -107,6 +110,29 @@ void _run_with_pool(const std::function<void(int, size_t)>& fn, size_t range) {
 #endif // C10_MOBILE
 }
 
+// Cost-model hook consulted on every parallel region; see the comment on
+// set_grain_size_hook() in ParallelNative.h.  Accessed with the atomic
+// shared_ptr overloads so installing a hook doesn't race with regions
+// already in flight.
+std::shared_ptr<std::function<int64_t(int64_t, int64_t)>> grain_size_hook_;
+
+int64_t _apply_grain_size_hook(int64_t grain_size, int64_t range) {
+  auto hook = std::atomic_load_explicit(
+      &grain_size_hook_, std::memory_order_acquire);
+  if (C10_UNLIKELY(hook != nullptr)) {
+    int64_t adjusted = (*hook)(grain_size, range);
+    if (adjusted > 0) {
+      return adjusted;
+    }
+  }
+  return grain_size;
+}
+
+// Number of times the master thread polls for completion before parking on
+// the condition variable.  Tiny parallel regions routinely finish within
+// this window, saving a futex sleep/wake round trip per region.
+constexpr int kMasterSpinIterations = 4000;
+
 // RAII guard helps to support in_parallel_region() and get_thread_num() API.
 struct ParallelRegionGuard {
   ParallelRegionGuard(int task_id) {
@@ -146,15 +172,27 @@ void invoke_parallel(
 
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   size_t num_tasks, chunk_size;
-  std::tie(num_tasks, chunk_size) =
-      internal::calc_num_tasks_and_chunk_size(begin, end, grain_size);
+  std::tie(num_tasks, chunk_size) = internal::calc_num_tasks_and_chunk_size(
+      begin, end, _apply_grain_size_hook(grain_size, end - begin));
+
+  // A single task doesn't amortize touching the pool at all: run it inline
+  // on the current thread without any synchronization state.  Exceptions
+  // propagate to the caller directly.
+  if (num_tasks == 1) {
+    ParallelRegionGuard guard(0);
+    f(begin, end);
+    return;
+  }
 
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
   struct {
     std::atomic_flag err_flag = ATOMIC_FLAG_INIT;
     std::exception_ptr eptr;
     std::mutex mutex;
-    volatile size_t remaining;
+    std::atomic_size_t remaining;
+    // Guarded by mutex; lets workers skip notifying (and the futex wake
+    // that entails) while the master thread is still spinning.
+    bool master_parked = false;
     std::condition_variable cv;
   } state;
 
@@ -172,9 +210,11 @@ void invoke_parallel(
         }
       }
     }
-    {
-      std::unique_lock<std::mutex> lk(state.mutex);
-      if (--state.remaining == 0) {
+    if (state.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      // Taking the mutex orders this notification after the master's
+      // decision to park, so the wakeup cannot be lost.
+      std::lock_guard<std::mutex> lk(state.mutex);
+      if (state.master_parked) {
         state.cv.notify_one();
       }
     }
@@ -182,12 +222,22 @@ void invoke_parallel(
   state.remaining = num_tasks;
   _run_with_pool(std::move(task), num_tasks);
 
-  // Wait for all tasks to finish.
-  {
-    std::unique_lock<std::mutex> lk(state.mutex);
-    if (state.remaining != 0) {
-      state.cv.wait(lk);
+  // Wait for all tasks to finish.  The master already ran its own chunk
+  // above, so the other tasks are usually almost done: spin briefly
+  // before falling back to sleeping on the condition variable.
+  bool done = state.remaining.load(std::memory_order_acquire) == 0;
+  for (int spin = 0; !done && spin < kMasterSpinIterations; ++spin) {
+    if ((spin & 63) == 63) {
+      std::this_thread::yield();
     }
+    done = state.remaining.load(std::memory_order_acquire) == 0;
+  }
+  if (!done) {
+    std::unique_lock<std::mutex> lk(state.mutex);
+    state.master_parked = true;
+    state.cv.wait(lk, [&]() {
+      return state.remaining.load(std::memory_order_acquire) == 0;
+    });
   }
   if (state.eptr) {
     std::rethrow_exception(state.eptr);
@@ -196,6 +246,20 @@ void invoke_parallel(
 
 } // namespace internal
 
+void set_grain_size_hook(std::function<int64_t(int64_t, int64_t)> hook) {
+  std::atomic_store_explicit(
+      &grain_size_hook_,
+      hook ? std::make_shared<std::function<int64_t(int64_t, int64_t)>>(
+                 std::move(hook))
+           : std::shared_ptr<std::function<int64_t(int64_t, int64_t)>>(),
+      std::memory_order_release);
+}
+
+bool has_grain_size_hook() {
+  return std::atomic_load_explicit(
+             &grain_size_hook_, std::memory_order_acquire) != nullptr;
+}
+
 void init_num_threads() {
 #ifdef _OPENMP
   omp_set_num_threads(1);
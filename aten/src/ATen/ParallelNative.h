@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <exception>
+#include <functional>
 
 #include <c10/util/Exception.h>
 
@@ -19,4 +20,18 @@ TORCH_API void invoke_parallel(
 
 } // namespace internal
 
+// Installs a cost-model hook that is consulted on every parallel region.
+// It is called with the grain size hard-coded in the kernel and the size
+// of the range, and returns the grain size to actually use for chunking;
+// returning a non-positive value keeps the kernel's grain size.  This
+// allows grain sizes to be calibrated at runtime per microarchitecture
+// instead of being baked into each kernel.  Note that the hook only sees
+// regions the calling kernel decided to parallelize: ranges at or below
+// the kernel's own grain size run inline and never reach the hook.
+// Pass nullptr to remove the hook.  Only supported by the native
+// parallel backend.
+TORCH_API void set_grain_size_hook(
+    std::function<int64_t(int64_t grain_size, int64_t range)> hook);
+TORCH_API bool has_grain_size_hook();
+
 } // namespace at
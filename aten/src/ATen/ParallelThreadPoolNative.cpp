@@ -3,6 +3,7 @@
 #include <ATen/Parallel.h>
 #include <ATen/PTThreadPool.h>
 #include <ATen/ThreadLocalState.h>
+#include <c10/util/env.h>
 
 #include <atomic>
 
@@ -40,6 +41,12 @@ std::shared_ptr<TaskThreadPoolBase> create_c10_threadpool(
   TORCH_CHECK(device_id == 0);
   // Create new thread pool
   TORCH_CHECK(create_new);
+  if (c10::utils::check_env("TORCH_LATENCY_BUDGET_INTEROP") == true) {
+    return std::make_shared<PTLatencyBudgetThreadPool>(pool_size);
+  }
+  if (c10::utils::check_env("TORCH_WORK_STEALING_INTEROP") == true) {
+    return std::make_shared<PTWorkStealingThreadPool>(pool_size);
+  }
   return std::make_shared<PTThreadPool>(pool_size);
 }
 
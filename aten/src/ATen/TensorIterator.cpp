@@ -21,12 +21,16 @@
 #include <ATen/ops/empty_strided.h>
 #endif
 
+#include <c10/util/env.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 #include <c10/util/SmallBuffer.h>
 
 #include <array>
 #include <algorithm>
 #include <cmath>
+#include <mutex>
+#include <unordered_map>
 
 namespace at {
 
@@ -572,19 +576,19 @@ void TensorIteratorBase::allocate_or_resize_outputs() {
         // can just return contiguous output
         // it is faster because it avoids allocating 0 size tensor and
         // resizing and restriding it
-        set_output_raw_strided(i, tensor_shape, {}, original_options(op), names_);
+        set_output_recorded(i, tensor_shape, {}, original_options(op), names_);
       } else {
         auto tensor_stride = invert_perm(op.stride_bytes);
         for (const auto dim : c10::irange(ndim())) {
           tensor_stride[dim] /= element_size;
         }
-        set_output_raw_strided(i, tensor_shape, tensor_stride, original_options(op), names_);
+        set_output_recorded(i, tensor_shape, tensor_stride, original_options(op), names_);
       }
       op.current_dtype = op.target_dtype;
     } else if (op.tensor_base().defined()) {
       // Even if we don't resize, we still need to tell set_output about
       // the output, so that we properly set guard and propagate names
-      set_output_raw_strided(i, op.tensor_base().sizes(), {}, original_options(op), names_);
+      set_output_recorded(i, op.tensor_base().sizes(), {}, original_options(op), names_);
     }
   }
 }
@@ -745,7 +749,34 @@ void TensorIteratorBase::for_each(loop2d_t loop, int64_t grain_size) {
   int64_t numel = this->numel();
   if (numel == 0) {
     return;
-  } else if (numel < grain_size || at::get_num_threads() == 1) {
+  }
+
+  // Fast path for iterators that build() coalesced down to a single
+  // dimension (in particular every all-contiguous eager op): fetch the base
+  // pointers and padded strides once and hand each parallel_for chunk
+  // straight to the loop, instead of rebuilding the stride buffer and
+  // walking the 2d DimCounter machinery in serial_for_each per chunk.
+  if (ndim() <= 1) {
+    const auto ntensors = this->ntensors();
+    c10::SmallBuffer<char*, 4> ptrs(ntensors);
+    c10::SmallBuffer<int64_t, 8> strides(ntensors * 2);
+    get_base_ptrs(ptrs.data(), operands_);
+    get_strides(strides.data(), operands_, ndim());
+    if (numel < grain_size || at::get_num_threads() == 1) {
+      loop(ptrs.data(), strides.data(), numel, 1);
+      return;
+    }
+    at::parallel_for(0, numel, grain_size, [&](int64_t begin, int64_t end) {
+      c10::SmallBuffer<char*, 4> chunk_ptrs(ntensors);
+      for (const auto arg : c10::irange(ntensors)) {
+        chunk_ptrs[arg] = ptrs[arg] + begin * strides[arg];
+      }
+      loop(chunk_ptrs.data(), strides.data(), end - begin, 1);
+    });
+    return;
+  }
+
+  if (numel < grain_size || at::get_num_threads() == 1) {
     return serial_for_each(loop, {0, numel});
   } else {
     at::parallel_for(0, numel, grain_size, [&](int64_t begin, int64_t end) {
@@ -1340,7 +1371,7 @@ bool TensorIteratorBase::fast_set_up(const TensorIteratorConfig& config) {
           if (!op.tensor_base().defined()) {
             TORCH_INTERNAL_ASSERT(op.is_type_defined(), "no type for operand", i);
           }
-          set_output_raw_strided(i, shape_, {}, original_options(op).memory_format(MemoryFormat::Contiguous), names_);
+          set_output_recorded(i, shape_, {}, original_options(op).memory_format(MemoryFormat::Contiguous), names_);
         }
         break;
       }
@@ -1351,7 +1382,7 @@ bool TensorIteratorBase::fast_set_up(const TensorIteratorConfig& config) {
           if (!op.tensor_base().defined()) {
             TORCH_INTERNAL_ASSERT(op.is_type_defined(), "no type for operand", i);
           }
-          set_output_raw_strided(i, shape_, {}, original_options(op).memory_format(MemoryFormat::ChannelsLast), names_);
+          set_output_recorded(i, shape_, {}, original_options(op).memory_format(MemoryFormat::ChannelsLast), names_);
         }
         break;
       }
@@ -1368,7 +1399,7 @@ bool TensorIteratorBase::fast_set_up(const TensorIteratorConfig& config) {
           if (!op.tensor_base().defined()) {
             TORCH_INTERNAL_ASSERT(op.is_type_defined(), "no type for operand", i);
           }
-          set_output_raw_strided(i, shape_, tensor_base(i_defined).strides(), original_options(op), names_);
+          set_output_recorded(i, shape_, tensor_base(i_defined).strides(), original_options(op), names_);
         }
         break;
       }
@@ -1459,6 +1490,249 @@ FastSetupType TensorIteratorBase::compute_fast_setup_type(const TensorIteratorCo
   return FastSetupType::NONE;
 }
 
+namespace {
+
+// Note [TensorIterator build cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Eager ops pay for a full build() on every call: type promotion,
+// broadcasting, stride reordering and dimension coalescing.  Training
+// loops call the same ops with the same shapes, dtypes and layouts
+// millions of times, so when TORCH_TENSORITERATOR_CACHE=1 we memoize the
+// result of build() in a process-wide table keyed by the configuration
+// flags plus every operand's dtype, device, wrapped-number status, sizes
+// and strides.
+//
+// A hit restores the computed metadata (shape_, perm_, per-operand
+// stride_bytes and dtypes) and replays the set_output calls recorded by
+// the original build, so subclasses (notably structured kernels) observe
+// the same sequence of output allocations as a full build.  Memory
+// overlap checking still runs on every call because it depends on the
+// actual data pointers, which are not part of the key.
+//
+// Builds are not cached when:
+//  - any operand is a meta tensor or the common device has no storage
+//    (XLA/Lazy/...): build() exits early for those and there is little
+//    to reuse;
+//  - any operand has named dimensions: name propagation is not replayed;
+//  - compute_types() installed a temporary via exchange_tensor (the
+//    dtype "switcheroo" described in Marker [Output original_tensor is
+//    set]): a replay would have to re-allocate the temporaries;
+//  - an operand is not strided (sparse, nested, ...), as its metadata
+//    cannot be captured by sizes and strides alone.
+//
+// The table is bounded: shapes seen by a real workload plateau quickly,
+// and if a pathological workload exceeds the bound we drop the whole
+// table and start over rather than track recency.
+
+struct BuildCacheOperand {
+  StrideVector stride_bytes;
+  ScalarType target_dtype = ScalarType::Undefined;
+  ScalarType current_dtype = ScalarType::Undefined;
+  c10::optional<Device> device;
+  bool will_resize = false;
+};
+
+struct BuildCacheEntry {
+  DimVector shape;
+  DimVector perm;
+  SmallVector<BuildCacheOperand, 4> operands;
+  internal::OutputAllocRecords output_allocs;
+  Device common_device = kCPU;
+  ScalarType common_dtype = ScalarType::Undefined;
+  bool has_coalesced_dimensions = false;
+  bool all_ops_same_shape = false;
+  bool all_ops_are_scalars = false;
+};
+
+struct BuildCacheKeyHash {
+  size_t operator()(const std::vector<int64_t>& key) const {
+    size_t seed = key.size();
+    for (const auto v : key) {
+      seed = c10::hash_combine(seed, std::hash<int64_t>()(v));
+    }
+    return seed;
+  }
+};
+
+constexpr size_t kBuildCacheMaxEntries = 4096;
+
+std::mutex build_cache_mutex;
+std::unordered_map<std::vector<int64_t>, BuildCacheEntry, BuildCacheKeyHash>
+    build_cache;
+
+bool build_cache_enabled() {
+  static const bool enabled =
+      c10::utils::check_env("TORCH_TENSORITERATOR_CACHE") == true;
+  return enabled;
+}
+
+int64_t pack_device(Device device) {
+  return (static_cast<int64_t>(device.type()) << 8) |
+      (static_cast<int64_t>(device.index()) & 0xff);
+}
+
+} // namespace
+
+c10::optional<std::vector<int64_t>> TensorIteratorBase::compute_build_cache_key(
+    const TensorIteratorConfig& config) {
+  std::vector<int64_t> key;
+  key.reserve(8 + config.tensors_.size() * 12);
+  uint64_t flags = 0;
+  auto add_flag = [&](bool b) { flags = (flags << 1) | (b ? 1 : 0); };
+  add_flag(config.check_mem_overlap_);
+  add_flag(config.allow_cpu_scalars_);
+  add_flag(config.is_reduction_);
+  add_flag(config.resize_outputs_);
+  add_flag(config.check_all_same_dtype_);
+  add_flag(config.check_all_same_device_);
+  add_flag(config.enforce_safe_casting_to_output_);
+  add_flag(config.enforce_linear_iteration_);
+  add_flag(config.promote_inputs_to_common_dtype_);
+  add_flag(config.promote_integer_inputs_to_float_);
+  add_flag(config.cast_common_dtype_to_outputs_);
+  add_flag(config.static_shape_.has_value());
+  add_flag(config.static_dtype_.has_value());
+  add_flag(config.static_device_.has_value());
+  key.push_back(static_cast<int64_t>(flags));
+  key.push_back(config.num_outputs_);
+  key.push_back(config.num_inputs_);
+  if (config.static_shape_.has_value()) {
+    key.push_back(static_cast<int64_t>(config.static_shape_->size()));
+    key.insert(
+        key.end(), config.static_shape_->begin(), config.static_shape_->end());
+  }
+  if (config.static_dtype_.has_value()) {
+    key.push_back(static_cast<int64_t>(*config.static_dtype_));
+  }
+  if (config.static_device_.has_value()) {
+    key.push_back(pack_device(*config.static_device_));
+  }
+  for (const auto& tensor : config.tensors_) {
+    if (!tensor->defined()) {
+      key.push_back(-1);
+      continue;
+    }
+    const TensorBase& t = *tensor;
+    if (t.layout() != kStrided || t.is_nested() || t.has_names() ||
+        t.is_conj() || t.is_neg()) {
+      return c10::nullopt;
+    }
+    key.push_back(static_cast<int64_t>(t.scalar_type()));
+    key.push_back(pack_device(t.device()));
+    key.push_back(t.unsafeGetTensorImpl()->is_wrapped_number() ? 1 : 0);
+    key.push_back(t.dim());
+    key.insert(key.end(), t.sizes().begin(), t.sizes().end());
+    key.insert(key.end(), t.strides().begin(), t.strides().end());
+  }
+  return key;
+}
+
+bool TensorIteratorBase::try_build_from_cache(
+    TensorIteratorConfig& config,
+    const std::vector<int64_t>& key) {
+  BuildCacheEntry entry;
+  {
+    std::lock_guard<std::mutex> lock(build_cache_mutex);
+    auto it = build_cache.find(key);
+    if (it == build_cache.end()) {
+      return false;
+    }
+    entry = it->second;
+  }
+  populate_operands(config);
+  mark_outputs();
+  // Overlap depends on the actual data pointers, so it cannot be skipped.
+  compute_mem_overlaps(config);
+
+  shape_ = entry.shape;
+  perm_ = entry.perm;
+  has_coalesced_dimensions_ = entry.has_coalesced_dimensions;
+  all_ops_same_shape_ = entry.all_ops_same_shape;
+  all_ops_are_scalars_ = entry.all_ops_are_scalars;
+  common_dtype_ = entry.common_dtype;
+  common_device_ = entry.common_device;
+  TORCH_INTERNAL_ASSERT(entry.operands.size() == operands_.size());
+  for (const auto i : c10::irange(operands_.size())) {
+    auto& op = operands_[i];
+    const auto& snap = entry.operands[i];
+    op.target_dtype = snap.target_dtype;
+    op.current_dtype = snap.current_dtype;
+    op.device = snap.device;
+    op.will_resize = snap.will_resize;
+  }
+  // Replay the output allocations exactly as the original build issued
+  // them; this is where undefined outputs get materialized and where
+  // structured kernel subclasses are told about their outputs.
+  for (const auto& record : entry.output_allocs) {
+    set_output_raw_strided(
+        record.output_idx, record.sizes, record.strides, record.options, names_);
+  }
+  for (const auto i : c10::irange(operands_.size())) {
+    operands_[i].stride_bytes = entry.operands[i].stride_bytes;
+  }
+  for (auto& op : operands_) {
+    TORCH_INTERNAL_ASSERT(op.tensor_base().defined());
+    op.data = op.tensor_base().data_ptr();
+  }
+  int64_t ndim_offsets = (ndim() ? ndim() : 1);
+  view_offsets_ = DimVector(ndim_offsets, 0);
+  return true;
+}
+
+void TensorIteratorBase::save_build_to_cache(
+    std::vector<int64_t> key,
+    const internal::OutputAllocRecords& output_allocs) const {
+  if (!names_.empty()) {
+    return;
+  }
+  for (const auto& op : operands_) {
+    // Builds that installed temporaries cannot be replayed; see
+    // Note [TensorIterator build cache].
+    if (op.original_tensor_base().defined()) {
+      return;
+    }
+  }
+  BuildCacheEntry entry;
+  entry.shape = shape_;
+  entry.perm = perm_;
+  entry.operands.reserve(operands_.size());
+  for (const auto& op : operands_) {
+    entry.operands.push_back(BuildCacheOperand{
+        op.stride_bytes,
+        op.target_dtype,
+        op.current_dtype,
+        op.device,
+        op.will_resize});
+  }
+  entry.output_allocs = output_allocs;
+  entry.common_device = common_device_;
+  entry.common_dtype = common_dtype_;
+  entry.has_coalesced_dimensions = has_coalesced_dimensions_;
+  entry.all_ops_same_shape = all_ops_same_shape_;
+  entry.all_ops_are_scalars = all_ops_are_scalars_;
+  std::lock_guard<std::mutex> lock(build_cache_mutex);
+  if (build_cache.size() >= kBuildCacheMaxEntries) {
+    build_cache.clear();
+  }
+  build_cache.emplace(std::move(key), std::move(entry));
+}
+
+void TensorIteratorBase::set_output_recorded(
+    int64_t output_idx,
+    IntArrayRef sizes,
+    IntArrayRef strides,
+    TensorOptions options,
+    DimnameList names) {
+  if (output_alloc_records_ != nullptr) {
+    output_alloc_records_->push_back(internal::OutputAllocRecord{
+        output_idx,
+        DimVector(sizes.begin(), sizes.end()),
+        DimVector(strides.begin(), strides.end()),
+        options});
+  }
+  set_output_raw_strided(output_idx, sizes, strides, options, names);
+}
+
 TensorIteratorBase::TensorIteratorBase() = default;
 
 void TensorIteratorBase::build(TensorIteratorConfig& config) {
@@ -1466,6 +1740,19 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   is_reduction_ = config.is_reduction_;
   enforce_linear_iteration_ = config.enforce_linear_iteration_;
 
+  // See Note [TensorIterator build cache]
+  c10::optional<std::vector<int64_t>> cache_key;
+  internal::OutputAllocRecords output_allocs;
+  if (build_cache_enabled()) {
+    cache_key = compute_build_cache_key(config);
+    if (cache_key.has_value()) {
+      if (try_build_from_cache(config, *cache_key)) {
+        return;
+      }
+      output_alloc_records_ = &output_allocs;
+    }
+  }
+
   // fill in operands_ based on configuration
   populate_operands(config);
   // set is_output and is_read_write flags on appropriate tensors
@@ -1493,7 +1780,10 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
     if (!is_meta_) coalesce_dimensions();
   }
 
-  if (is_meta_) return;
+  if (is_meta_) {
+    output_alloc_records_ = nullptr;
+    return;
+  }
 
   auto has_storage = true;
   for (auto& op : operands_) {
@@ -1511,7 +1801,10 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
       common_device_.type() == DeviceType::IPU  ||
       common_device_.type() == DeviceType::Lazy ||
       common_device_.type() == DeviceType::ORT  ||
-      common_device_.type() == DeviceType::HPU) return;
+      common_device_.type() == DeviceType::HPU) {
+    output_alloc_records_ = nullptr;
+    return;
+  }
 
   for (auto& op : operands_) {
     TORCH_INTERNAL_ASSERT(op.tensor_base().defined());
@@ -1524,6 +1817,11 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // a valid value for the offset
   int64_t ndim_offsets = (ndim() ? ndim() : 1);
   view_offsets_ = DimVector(ndim_offsets, 0);
+
+  if (output_alloc_records_ != nullptr) {
+    output_alloc_records_ = nullptr;
+    save_build_to_cache(std::move(*cache_key), output_allocs);
+  }
 }
 
 // This is the structured kernels' implementation of set_output.  It is
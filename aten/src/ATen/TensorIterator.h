@@ -13,6 +13,7 @@
 
 #include <array>
 #include <bitset>
+#include <vector>
 
 C10_CLANG_DIAGNOSTIC_PUSH()
 #if C10_CLANG_HAS_WARNING("-Wshorten-64-to-32")
@@ -231,6 +232,20 @@ enum class FastSetupType : uint8_t {
 class TensorIteratorConfig;
 struct TensorIterator;
 
+namespace internal {
+// See Note [TensorIterator build cache] in TensorIterator.cpp.  One record
+// per set_output call made during a cacheable build(); a cache hit replays
+// these calls so that subclasses (notably structured kernels) observe the
+// same sequence of output allocations as a full build.
+struct OutputAllocRecord {
+  int64_t output_idx;
+  DimVector sizes;
+  DimVector strides;
+  TensorOptions options;
+};
+using OutputAllocRecords = SmallVector<OutputAllocRecord, 2>;
+} // namespace internal
+
 struct TORCH_API TensorIteratorBase : public impl::MetaBase {
   using DimMask = std::bitset<64>;
   using PtrVector = SmallVector<char*, 4>;
@@ -588,6 +603,26 @@ struct TORCH_API TensorIteratorBase : public impl::MetaBase {
   void propagate_names_to_outputs();
   void coalesce_dimensions();
 
+  // Machinery for Note [TensorIterator build cache] in TensorIterator.cpp.
+  // compute_build_cache_key returns nullopt when the configuration cannot
+  // be keyed (and hence must not be cached).
+  static c10::optional<std::vector<int64_t>> compute_build_cache_key(
+      const TensorIteratorConfig&);
+  bool try_build_from_cache(
+      TensorIteratorConfig&,
+      const std::vector<int64_t>& key);
+  void save_build_to_cache(
+      std::vector<int64_t> key,
+      const internal::OutputAllocRecords& output_allocs) const;
+  // All set_output calls made by build() go through here so that a
+  // cacheable build can record them for later replay.
+  void set_output_recorded(
+      int64_t output_idx,
+      IntArrayRef sizes,
+      IntArrayRef strides,
+      TensorOptions options,
+      DimnameList names);
+
  protected:
   /// Records the "computation" shape of the output tensor. The computation
   /// shape is different from the regular shape in a few ways:
@@ -684,6 +719,13 @@ struct TORCH_API TensorIteratorBase : public impl::MetaBase {
 
   /// Set by populate_operands(), says if we're handling meta tensors
   bool is_meta_ = false;
+
+  /// When non-null, a cacheable build() is in progress and
+  /// set_output_recorded() appends the arguments of each set_output call
+  /// here so the build cache can replay them on a hit.  Only ever non-null
+  /// for the duration of build().  See Note [TensorIterator build cache]
+  /// in TensorIterator.cpp.
+  internal::OutputAllocRecords* output_alloc_records_ = nullptr;
 };
 
 struct TORCH_API TensorIterator final : public TensorIteratorBase {
@@ -1,7 +1,30 @@
 #include <ATen/core/Dict.h>
+#include <ATen/core/container_freelist.h>
 
 namespace c10 {
 namespace detail {
+
+namespace {
+// DictImpl is final, so every allocation is exactly sizeof(DictImpl).
+using DictImplFreeList = ContainerFreeList<sizeof(DictImpl), 256>;
+DictImplFreeList& dict_impl_free_list() {
+  static thread_local DictImplFreeList free_list;
+  return free_list;
+}
+} // namespace
+
+void* DictImpl::operator new(size_t size) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(size == sizeof(DictImpl));
+  return dict_impl_free_list().allocate();
+}
+
+void DictImpl::operator delete(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  dict_impl_free_list().deallocate(ptr);
+}
+
 bool operator==(const DictImpl& lhs, const DictImpl& rhs) {
   bool isEqualFastChecks =
       *lhs.elementTypes.keyType == *rhs.elementTypes.keyType &&
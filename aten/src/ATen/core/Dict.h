@@ -53,6 +53,11 @@ struct DictImpl final : public c10::intrusive_ptr_target {
 
   intrusive_ptr<DictImpl> copy() const;
   friend TORCH_API bool operator==(const DictImpl& lhs, const DictImpl& rhs);
+
+  // Allocated through a per-thread freelist; see
+  // [Note: IValue container freelist] in container_freelist.h.
+  static TORCH_API void* operator new(size_t size);
+  static TORCH_API void operator delete(void* ptr);
 };
 
 }
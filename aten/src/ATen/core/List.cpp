@@ -1,7 +1,30 @@
 #include <ATen/core/List.h>
+#include <ATen/core/container_freelist.h>
 
 namespace c10 {
 namespace detail {
+
+namespace {
+// ListImpl is final, so every allocation is exactly sizeof(ListImpl).
+using ListImplFreeList = ContainerFreeList<sizeof(ListImpl), 256>;
+ListImplFreeList& list_impl_free_list() {
+  static thread_local ListImplFreeList free_list;
+  return free_list;
+}
+} // namespace
+
+void* ListImpl::operator new(size_t size) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(size == sizeof(ListImpl));
+  return list_impl_free_list().allocate();
+}
+
+void ListImpl::operator delete(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  list_impl_free_list().deallocate(ptr);
+}
+
 bool operator==(const ListImpl& lhs, const ListImpl& rhs) {
   return *lhs.elementType == *rhs.elementType &&
       lhs.list.size() == rhs.list.size() &&
@@ -36,6 +36,11 @@ struct ListImpl final : public c10::intrusive_ptr_target {
     return make_intrusive<ListImpl>(list, elementType);
   }
   friend TORCH_API bool operator==(const ListImpl& lhs, const ListImpl& rhs);
+
+  // Allocated through a per-thread freelist; see
+  // [Note: IValue container freelist] in container_freelist.h.
+  static TORCH_API void* operator new(size_t size);
+  static TORCH_API void operator delete(void* ptr);
 };
 }
 
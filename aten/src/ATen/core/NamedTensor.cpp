@@ -142,6 +142,10 @@ DimnameList get_names(const TensorImpl* impl) {
 }
 
 bool has_names(const TensorImpl* impl) {
+  // See Note [Names-in-use process latch]
+  if (C10_LIKELY(!c10::impl::were_names_ever_used())) {
+    return false;
+  }
   return impl->has_named_tensor_meta() && NamesMode::is_enabled();
 }
 
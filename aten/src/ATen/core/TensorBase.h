@@ -535,6 +535,11 @@ class TORCH_API TensorBase {
 
   /// Returns if a `Tensor` has any dimension names
   bool has_names() const {
+    // If no tensor in the process has ever been named, skip even the
+    // per-tensor metadata loads; see Note [Names-in-use process latch].
+    if (C10_LIKELY(!c10::impl::were_names_ever_used())) {
+      return false;
+    }
     // If a user is using unnamed tensors, then we can short-circuit right here.
     // Otherwise, impl::has_names attempts to retrieve names.
     if (!impl_->has_named_tensor_meta()) {
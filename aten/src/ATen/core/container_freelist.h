@@ -0,0 +1,68 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace c10 {
+namespace detail {
+
+// [Note: IValue container freelist]
+// ListImpl/DictImpl nodes are allocated and freed once per interpreter
+// instruction in hot scripted-model loops (op argument packing, size
+// lists), so their class-level operator new/delete route through a
+// per-thread freelist of fixed-size blocks instead of the global
+// allocator. True inline (SSO-style) storage is not possible for these
+// containers: a List/Dict IValue has reference semantics, so the payload
+// must live in a stable heap location shared by all copies of the handle.
+//
+// The freelist is bounded so a burst of live containers does not pin
+// memory forever. Blocks cached at thread exit are intentionally leaked;
+// they are plain malloc blocks and reclaiming them during thread teardown
+// could race with static destructors. Blocks may be freed on a different
+// thread than the one that allocated them; they simply join that thread's
+// freelist.
+template <size_t kBlockSize, size_t kMaxCached>
+class ContainerFreeList final {
+ public:
+  void* allocate() {
+    if (head_ != nullptr) {
+      FreeBlock* result = head_;
+      head_ = head_->next;
+      --cached_;
+      return result;
+    }
+    void* memory = std::malloc(kBlockSize);
+    if (C10_UNLIKELY(memory == nullptr)) {
+      throw std::bad_alloc();
+    }
+    return memory;
+  }
+
+  void deallocate(void* ptr) {
+    if (cached_ == kMaxCached) {
+      std::free(ptr);
+      return;
+    }
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    block->next = head_;
+    head_ = block;
+    ++cached_;
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+  static_assert(
+      kBlockSize >= sizeof(FreeBlock),
+      "ContainerFreeList blocks must be able to hold a freelist pointer");
+
+  FreeBlock* head_ = nullptr;
+  size_t cached_ = 0;
+};
+
+} // namespace detail
+} // namespace c10
@@ -1,5 +1,10 @@
 #include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/core/static_operator_name_table.h>
+#include <c10/util/ConstexprCrc.h>
+#include <c10/util/env.h>
+#include <array>
 #include <chrono>
+#include <cstring>
 #include <list>
 #include <sstream>
 #include <utility>
@@ -52,6 +57,8 @@ Dispatcher::Dispatcher()
 , operatorLookupTable_()
 , backendFallbackKernels_()
 , listeners_(std::make_unique<detail::RegistrationListenerList>())
+, deferDispatchTableUpdates_(
+      c10::utils::check_env("TORCH_DISPATCHER_DEFER_TABLE_UPDATES") == true)
 , mutex_()
 , cond_var_()
 {}
@@ -63,7 +70,95 @@ C10_EXPORT Dispatcher& Dispatcher::realSingleton() {
   return _singleton;
 }
 
+// Note [Static operator lookup]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every operator defined in native_functions.yaml is known at codegen time,
+// so torchgen emits an open-addressed hash table over their names
+// (ATen/core/static_operator_name_table.h, keyed by the same crc64 as
+// c10/util/ConstexprCrc.h). findOp hashes the queried OperatorName, probes
+// that table, and on a confirmed match reads the handle from a fixed slot
+// that registration published, making name resolution for static ops
+// constant-time and lock-free. The slot is guarded by a seqlock (odd
+// version = writer active) because registration/deregistration, which hold
+// mutex_, still race with readers. Names that miss the static table --
+// custom ops, torchbind classes -- fall through to the LeftRight map, which
+// also remains the source of truth for enumeration.
+namespace {
+
+struct StaticOperatorSlot {
+  // Even = consistent, odd = writer active. Readers that observe a version
+  // change re-probe via the slow path.
+  std::atomic<uint64_t> version{0};
+  c10::optional<OperatorHandle> handle;
+};
+
+std::array<StaticOperatorSlot, at::detail::kStaticOperatorCount>&
+staticOperatorSlots() {
+  // Leaked: operator libraries deregister during static shutdown and must
+  // still find live slots.
+  static auto* slots =
+      new std::array<StaticOperatorSlot, at::detail::kStaticOperatorCount>();
+  return *slots;
+}
+
+c10::optional<uint32_t> staticOperatorIndex(const OperatorName& name) {
+  using at::detail::kStaticOperatorEmptySlot;
+  using at::detail::kStaticOperatorMaxProbe;
+  using at::detail::kStaticOperatorTableSize;
+  uint64_t h = c10::util::detail::crc64impl(0, name.name.data(), name.name.size());
+  h = c10::util::detail::crc64impl(h, ".", 1);
+  h = c10::util::detail::crc64impl(
+      h, name.overload_name.data(), name.overload_name.size());
+  for (uint32_t probe = 0; probe <= kStaticOperatorMaxProbe; ++probe) {
+    const auto& slot = at::detail::static_operator_hash_table
+        [(h + probe) % kStaticOperatorTableSize];
+    if (slot.index == kStaticOperatorEmptySlot) {
+      return c10::nullopt;
+    }
+    if (slot.hash != h) {
+      continue;
+    }
+    // crc64 collisions are unlikely but a dynamically registered name must
+    // never alias a static slot, so confirm against the stored name.
+    const char* key = at::detail::static_operator_names[slot.index];
+    const auto name_size = name.name.size();
+    if (strncmp(key, name.name.c_str(), name_size) == 0 &&
+        key[name_size] == '.' &&
+        strcmp(key + name_size + 1, name.overload_name.c_str()) == 0) {
+      return slot.index;
+    }
+  }
+  return c10::nullopt;
+}
+
+// Must be called with Dispatcher::mutex_ held so writers never interleave.
+void publishStaticOperatorHandle(
+    uint32_t index,
+    c10::optional<OperatorHandle> handle) {
+  auto& slot = staticOperatorSlots()[index];
+  slot.version.fetch_add(1, std::memory_order_release);
+  slot.handle = std::move(handle);
+  slot.version.fetch_add(1, std::memory_order_release);
+}
+
+} // namespace
+
 c10::optional<OperatorHandle> Dispatcher::findOp(const OperatorName& overload_name) {
+  // See Note [Static operator lookup]
+  if (const auto index = staticOperatorIndex(overload_name)) {
+    auto& slot = staticOperatorSlots()[*index];
+    const auto version = slot.version.load(std::memory_order_acquire);
+    if (version != 0 && (version & 1) == 0) {
+      // The copied payload is a pointer pair; a torn copy is discarded by
+      // the version re-check below before anyone looks at it.
+      auto handle = slot.handle;
+      if (slot.version.load(std::memory_order_acquire) == version &&
+          handle.has_value()) {
+        return handle;
+      }
+    }
+    // Registration in flight or never happened; the map below decides.
+  }
   return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) -> c10::optional<OperatorHandle> {
     auto found = operatorLookupTable.find(overload_name);
     if (found == operatorLookupTable.end()) {
@@ -156,10 +251,16 @@ OperatorHandle Dispatcher::findOrRegisterName_(const OperatorName& op_name) {
   }
 
   operators_.emplace_back(OperatorName(op_name));
+  operators_.back().dispatch_cache_index =
+      nextDispatchCacheIndex_.fetch_add(1, std::memory_order_relaxed);
   OperatorHandle handle(--operators_.end());
   operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
     operatorLookupTable.emplace(op_name, handle);
   });
+  if (const auto index = staticOperatorIndex(op_name)) {
+    // See Note [Static operator lookup]
+    publishStaticOperatorHandle(*index, handle);
+  }
 
   return handle;
 }
@@ -214,6 +315,7 @@ RegistrationHandleRAII Dispatcher::registerDef(FunctionSchema schema, std::strin
   ++op.operatorDef_->def_count;
   ++op.operatorDef_->def_and_impl_count;
 
+  invalidateDispatchCache_();
   cond_var_.notify_all();
 
   return RegistrationHandleRAII([this, op, op_name] {
@@ -242,6 +344,7 @@ void Dispatcher::deregisterDef_(const OperatorHandle& op, const OperatorName& op
   }
 
   cleanup(op, op_name);
+  invalidateDispatchCache_();
 }
 
 RegistrationHandleRAII Dispatcher::registerImpl(
@@ -267,6 +370,7 @@ RegistrationHandleRAII Dispatcher::registerImpl(
 
   ++op.operatorDef_->def_and_impl_count;
 
+  invalidateDispatchCache_();
   cond_var_.notify_all();
 
   return RegistrationHandleRAII([this, op, op_name, dispatch_key, handle] {
@@ -285,6 +389,7 @@ void Dispatcher::deregisterImpl_(const OperatorHandle& op, const OperatorName& o
   --op.operatorDef_->def_and_impl_count;
 
   cleanup(op, op_name);
+  invalidateDispatchCache_();
 }
 
 RegistrationHandleRAII Dispatcher::registerName(OperatorName op_name) {
@@ -304,6 +409,7 @@ void Dispatcher::deregisterName_(
   TORCH_INTERNAL_ASSERT(op.operatorDef_->def_and_impl_count > 0);
   --op.operatorDef_->def_and_impl_count;
   cleanup(op, op_name);
+  invalidateDispatchCache_();
 }
 
 // Test if the operator entry is completely dead, and if so remove it completely
@@ -315,6 +421,10 @@ void Dispatcher::cleanup(const OperatorHandle& op, const OperatorName& op_name)
     operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
       operatorLookupTable.erase(op_name);
     });
+    if (const auto index = staticOperatorIndex(op_name)) {
+      // See Note [Static operator lookup]
+      publishStaticOperatorHandle(*index, c10::nullopt);
+    }
   }
 }
 
@@ -332,10 +442,14 @@ RegistrationHandleRAII Dispatcher::registerFallback(DispatchKey dispatchKey, Ker
   // cannot be unboxed
   backendFallbackKernels_[idx] = impl::AnnotatedKernel(std::move(kernel), nullptr, std::move(debug));
 
-  for (auto& op : operators_) {
-    op.op.updateFallback(*this, dispatchKey);
+  if (!deferDispatchTableUpdates_) {
+    for (auto& op : operators_) {
+      op.op.updateFallback(*this, dispatchKey);
+    }
   }
 
+  invalidateDispatchCache_();
+
   return RegistrationHandleRAII([this, dispatchKey] {
     deregisterFallback_(dispatchKey);
   });
@@ -347,9 +461,27 @@ void Dispatcher::deregisterFallback_(DispatchKey dispatchKey) {
   auto idx = getDispatchTableIndexForDispatchKey(dispatchKey);
   backendFallbackKernels_[idx] = {};
 
+  if (!deferDispatchTableUpdates_) {
+    for (auto& op : operators_) {
+      op.op.updateFallback(*this, dispatchKey);
+    }
+  }
+
+  invalidateDispatchCache_();
+}
+
+void Dispatcher::flushDeferredDispatchTableUpdates() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!deferDispatchTableUpdates_) {
+    return;
+  }
+  // Leave deferred mode first so that libraries loaded after the flush go
+  // back to updating tables eagerly.
+  deferDispatchTableUpdates_ = false;
   for (auto& op : operators_) {
-    op.op.updateFallback(*this, dispatchKey);
+    op.op.recomputeDispatchTable(*this);
   }
+  invalidateDispatchCache_();
 }
 
 
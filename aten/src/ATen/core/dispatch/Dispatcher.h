@@ -17,6 +17,9 @@
 #include <ATen/core/grad_mode.h>
 #include <ATen/core/enum_tag.h>
 
+#include <atomic>
+#include <vector>
+
 namespace c10 {
 
 TORCH_API bool show_dispatch_trace();
@@ -81,6 +84,10 @@ private:
     // working operator handle in this case
     size_t def_count = 0;
     size_t def_and_impl_count = 0;
+
+    // Dense index into the per-thread dispatch cache; assigned once in
+    // findOrRegisterName_ and never reused.  See Note [Dispatch Cache]
+    size_t dispatch_cache_index = 0;
   };
   friend class OperatorHandle;
   template<class> friend class TypedOperatorHandle;
@@ -232,6 +239,27 @@ public:
    */
   RegistrationHandleRAII registerLibrary(std::string ns, std::string debug);
 
+  // Note [Deferred dispatch table updates]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Process startup runs thousands of kernel registrations, each of which
+  // eagerly recomputes dispatch table entries that the very next
+  // registration for the same operator overwrites again. With
+  // TORCH_DISPATCHER_DEFER_TABLE_UPDATES=1 the dispatcher skips the
+  // per-registration table updates and instead recomputes every
+  // operator's table once, in a single pass, when
+  // flushDeferredDispatchTableUpdates() is called; the Python extension
+  // does so at module init, after every statically linked library has
+  // registered. Operators must not be called before the flush, and C++
+  // embedders that set the knob have to flush themselves. The flush also
+  // permanently leaves deferred mode, so libraries loaded later (custom
+  // op extensions) take the eager path again. Snapshotting the resolved
+  // tables across processes is not an option: they hold function
+  // pointers that are only valid within one process image.
+  bool deferringDispatchTableUpdates() const {
+    return deferDispatchTableUpdates_;
+  }
+  void flushDeferredDispatchTableUpdates();
+
   // ------------------------------------------------------------------------
   //
   // Listeners on registrations
@@ -299,6 +327,13 @@ private:
   void cleanup(const OperatorHandle& op, const OperatorName& op_name);
   void checkSchemaCompatibility(const OperatorHandle& op, const FunctionSchema& schema, const std::string& debug);
 
+  // Invalidates every thread's dispatch cache.  Must be called after any
+  // mutation of a dispatch table (def/impl/fallback registration or
+  // deregistration).  See Note [Dispatch Cache]
+  void invalidateDispatchCache_() {
+    dispatchCacheGeneration_.fetch_add(1, std::memory_order_release);
+  }
+
   std::list<OperatorDef> operators_;
 #if !defined(C10_MOBILE)
   LeftRight<ska::flat_hash_map<OperatorName, OperatorHandle>> operatorLookupTable_;
@@ -312,6 +347,10 @@ private:
 
   std::unique_ptr<detail::RegistrationListenerList> listeners_;
 
+  // See Note [Deferred dispatch table updates]. Only flipped while
+  // holding mutex_; registrations read it under the same lock.
+  bool deferDispatchTableUpdates_;
+
   // This mutex protects concurrent access to the dispatcher
   std::mutex mutex_;
 
@@ -328,6 +367,15 @@ private:
   // variable.  This is mostly just to help give better diagnostics if
   // something goes horribly wrong
   std::condition_variable cond_var_;
+
+  // Bumped on every dispatch table mutation; per-thread dispatch cache
+  // entries tagged with an older generation are treated as misses.
+  // Starts at 1 so that a zero-initialized cache entry can never hit.
+  // See Note [Dispatch Cache]
+  std::atomic<uint64_t> dispatchCacheGeneration_{1};
+
+  // Next value of OperatorDef::dispatch_cache_index.
+  std::atomic<size_t> nextDispatchCacheIndex_{0};
 };
 
 /**
@@ -501,6 +549,48 @@ private:
 namespace detail {
 template <class... Args> inline void unused_arg_(const Args&...) {}
 
+// Note [Dispatch Cache]
+// ~~~~~~~~~~~~~~~~~~~~~
+// Dispatcher::call already computes the DispatchKeySet for every unboxed
+// call (it has to; kernels receive it), but the subsequent table lookup,
+// fallthrough handling and validity check are pure overhead when the same
+// operator keeps dispatching on the same key set, which is the steady
+// state of eager inference loops.  We therefore keep a per-thread,
+// per-operator monomorphic cache of (key set repr, kernel pointer):
+// if the current key set matches the cached one, we call the cached
+// kernel directly, turning dispatch into one compare plus an indirect
+// call.
+//
+// Invalidation is deliberately coarse: the Dispatcher bumps a global
+// generation counter on every table mutation (def/impl/fallback
+// registration or deregistration), and cache entries tagged with an older
+// generation miss.  Registrations are rare after startup, so invalidating
+// every entry of every thread costs nothing in steady state and keeps the
+// hot path free of per-operator bookkeeping.  Cached pointers reference
+// OperatorEntry's dispatchTable_, which lives in a std::list node and is
+// therefore stable for the lifetime of the operator; the generation check
+// guarantees a stale pointer is never dereferenced after deregistration.
+//
+// This is not used on mobile: the cache costs a per-thread vector and
+// extra code at every call site, and interpreter-driven mobile workloads
+// do not have the batch-1 eager dispatch profile this targets.
+struct DispatchCacheEntry {
+  uint64_t key_repr = 0;
+  uint64_t generation = 0;
+  const KernelFunction* kernel = nullptr;
+};
+
+inline DispatchCacheEntry& dispatch_cache_slot(size_t index) {
+  // NB: inlining duplicates this thread_local across DSOs, so a thread
+  // may end up with one cache per DSO.  Each copy is an independent,
+  // independently-correct cache, so the duplication is benign.
+  static thread_local std::vector<DispatchCacheEntry> cache;
+  if (C10_UNLIKELY(index >= cache.size())) {
+    cache.resize(index + 1);
+  }
+  return cache[index];
+}
+
 // CaptureKernelCall is intended to capture return values from Dispatcher
 // unboxed kernel calls. A record function may request to get outputs from the
 // kernel calls. For boxed kernels, it's straightforward, the returned values
@@ -629,7 +719,24 @@ C10_ALWAYS_INLINE_UNLESS_MOBILE Return Dispatcher::call(const TypedOperatorHandl
       std::cerr << "[call] op=[" << op.operator_name() << "], key=[" << toString(dispatchKeySet.highestPriorityTypeId()) << "]" << std::endl;
   }
 #endif
+#if !defined(C10_MOBILE)
+  // See Note [Dispatch Cache]
+  auto& cacheSlot = detail::dispatch_cache_slot(op.operatorDef_->dispatch_cache_index);
+  const auto cacheGeneration = dispatchCacheGeneration_.load(std::memory_order_acquire);
+  const KernelFunction* kernelPtr;
+  if (C10_LIKELY(cacheSlot.key_repr == dispatchKeySet.raw_repr()
+      && cacheSlot.generation == cacheGeneration)) {
+    kernelPtr = cacheSlot.kernel;
+  } else {
+    kernelPtr = &op.operatorDef_->op.lookup(dispatchKeySet);
+    cacheSlot.key_repr = dispatchKeySet.raw_repr();
+    cacheSlot.generation = cacheGeneration;
+    cacheSlot.kernel = kernelPtr;
+  }
+  const KernelFunction& kernel = *kernelPtr;
+#else
   const KernelFunction& kernel = op.operatorDef_->op.lookup(dispatchKeySet);
+#endif
 #ifndef PYTORCH_DISABLE_PER_OP_PROFILING
   auto step_callbacks = at::getStepCallbacksUnlessEmpty(at::RecordScope::FUNCTION);
   if (C10_UNLIKELY(step_callbacks.has_value() && op.operatorDef_->op.isObserved())) {
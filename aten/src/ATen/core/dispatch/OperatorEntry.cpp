@@ -31,7 +31,9 @@ OperatorEntry::OperatorEntry(OperatorName&& operator_name)
 {
   // Pick up any backend fallbacks that were registered prior to this
   // OperatorEntry being created
-  updateDispatchTableFull_(c10::Dispatcher::singleton());
+  if (!c10::Dispatcher::singleton().deferringDispatchTableUpdates()) {
+    updateDispatchTableFull_(c10::Dispatcher::singleton());
+  }
 }
 
 namespace {
@@ -171,7 +173,10 @@ OperatorEntry::AnnotatedKernelContainerIterator OperatorEntry::registerKernel(
   AnnotatedKernelContainerIterator inserted = k.begin();
   // update the dispatch table, i.e. re-establish the invariant
   // that the dispatch table points to the newest kernel
-  if (dispatch_key.has_value()) {
+  if (dispatcher.deferringDispatchTableUpdates()) {
+    // Recomputed in one pass at flush time; see
+    // Note [Deferred dispatch table updates]
+  } else if (dispatch_key.has_value()) {
     updateDispatchTable_(dispatcher, *dispatch_key);
   } else {
     updateDispatchTableFull_(dispatcher);
@@ -198,13 +203,19 @@ void OperatorEntry::deregisterKernel_(
     // the invariant says we don't want empty lists but instead remove the list from the map
     kernels_.erase(found);
   }
-  updateDispatchTable_(dispatcher, dk);
+  if (!dispatcher.deferringDispatchTableUpdates()) {
+    updateDispatchTable_(dispatcher, dk);
+  }
 }
 
 void OperatorEntry::updateFallback(const c10::Dispatcher& dispatcher, DispatchKey dispatch_key) {
   updateDispatchTable_(dispatcher, dispatch_key);
 }
 
+void OperatorEntry::recomputeDispatchTable(const c10::Dispatcher& dispatcher) {
+  updateDispatchTableFull_(dispatcher);
+}
+
 const KernelFunction& OperatorEntry::computeDispatchTableEntry(const c10::Dispatcher& dispatcher, DispatchKey dispatch_key) const {
   return computeDispatchTableEntryWithDebug(dispatcher, dispatch_key).first.kernel;
 }
@@ -149,6 +149,12 @@ public:
     DispatchKey dispatch_key
   );
 
+  // Recomputes the full dispatch table. Used by the one-pass flush when
+  // per-registration updates were deferred during startup; see
+  // Note [Deferred dispatch table updates] in Dispatcher.h.
+  // Precondition: Dispatcher::mutex_ is held
+  void recomputeDispatchTable(const Dispatcher& dispatcher);
+
   // Precondition: Dispatcher::mutex_ is held
   void updateSchemaAliasAnalysis(AliasAnalysisKind a) {
     TORCH_INTERNAL_ASSERT(schema_.has_value());
@@ -138,6 +138,7 @@ namespace c10 {
   _(prim, ConstantChunk)             \
   _(prim, MMTreeReduce)              \
   _(prim, MMBatchSide)               \
+  _(prim, MemoizedSubgraph)          \
   _(prim, list)                      \
   _(prim, dict)                      \
   _(prim, min)                       \
@@ -56,7 +56,31 @@ inline BFloat16 reduce_all(const Op& vec_fun, const BFloat16* data, int64_t size
   bVec acc_bvec = bVec::loadu(data);
   fVec acc_fvec0, acc_fvec1;
   std::tie(acc_fvec0, acc_fvec1) = convert_bfloat16_float(acc_bvec);
-  for (; d < size - (size % bVec::size()); d += bVec::size()) {
+  // Unroll over two bf16 vectors with a second pair of fp32 accumulators so
+  // the widen + accumulate of consecutive vectors form independent dependency
+  // chains; with a single accumulator pair the conversion latency serializes
+  // the reduction and bf16 falls well short of fp32 bandwidth.
+  if (size - d >= 2 * bVec::size()) {
+    bVec accb_bvec = bVec::loadu(data + d);
+    fVec acc_fvec2, acc_fvec3;
+    std::tie(acc_fvec2, acc_fvec3) = convert_bfloat16_float(accb_bvec);
+    d += bVec::size();
+    for (; d + 2 * bVec::size() <= size; d += 2 * bVec::size()) {
+      bVec data_bvec = bVec::loadu(data + d);
+      fVec data_fvec0, data_fvec1;
+      std::tie(data_fvec0, data_fvec1) = convert_bfloat16_float(data_bvec);
+      bVec datab_bvec = bVec::loadu(data + d + bVec::size());
+      fVec data_fvec2, data_fvec3;
+      std::tie(data_fvec2, data_fvec3) = convert_bfloat16_float(datab_bvec);
+      acc_fvec0 = vec_fun(acc_fvec0, data_fvec0);
+      acc_fvec1 = vec_fun(acc_fvec1, data_fvec1);
+      acc_fvec2 = vec_fun(acc_fvec2, data_fvec2);
+      acc_fvec3 = vec_fun(acc_fvec3, data_fvec3);
+    }
+    acc_fvec0 = vec_fun(acc_fvec0, acc_fvec2);
+    acc_fvec1 = vec_fun(acc_fvec1, acc_fvec3);
+  }
+  for (; d + bVec::size() <= size; d += bVec::size()) {
     bVec data_bvec = bVec::loadu(data + d);
     fVec data_fvec0, data_fvec1;
     std::tie(data_fvec0, data_fvec1) = convert_bfloat16_float(data_bvec);
@@ -163,7 +187,34 @@ inline BFloat16 map_reduce_all(
   std::tie(acc_fvec0, acc_fvec1) = convert_bfloat16_float(acc_bvec);
   acc_fvec0 = map_fun(acc_fvec0);
   acc_fvec1 = map_fun(acc_fvec1);
-  for (; d < size - (size % bVec::size()); d += bVec::size()) {
+  // Second accumulator pair; see the comment in reduce_all above.
+  if (size - d >= 2 * bVec::size()) {
+    bVec accb_bvec = bVec::loadu(data + d);
+    fVec acc_fvec2, acc_fvec3;
+    std::tie(acc_fvec2, acc_fvec3) = convert_bfloat16_float(accb_bvec);
+    acc_fvec2 = map_fun(acc_fvec2);
+    acc_fvec3 = map_fun(acc_fvec3);
+    d += bVec::size();
+    for (; d + 2 * bVec::size() <= size; d += 2 * bVec::size()) {
+      bVec data_bvec = bVec::loadu(data + d);
+      fVec data_fvec0, data_fvec1;
+      std::tie(data_fvec0, data_fvec1) = convert_bfloat16_float(data_bvec);
+      bVec datab_bvec = bVec::loadu(data + d + bVec::size());
+      fVec data_fvec2, data_fvec3;
+      std::tie(data_fvec2, data_fvec3) = convert_bfloat16_float(datab_bvec);
+      data_fvec0 = map_fun(data_fvec0);
+      data_fvec1 = map_fun(data_fvec1);
+      data_fvec2 = map_fun(data_fvec2);
+      data_fvec3 = map_fun(data_fvec3);
+      acc_fvec0 = red_fun(acc_fvec0, data_fvec0);
+      acc_fvec1 = red_fun(acc_fvec1, data_fvec1);
+      acc_fvec2 = red_fun(acc_fvec2, data_fvec2);
+      acc_fvec3 = red_fun(acc_fvec3, data_fvec3);
+    }
+    acc_fvec0 = red_fun(acc_fvec0, acc_fvec2);
+    acc_fvec1 = red_fun(acc_fvec1, acc_fvec3);
+  }
+  for (; d + bVec::size() <= size; d += bVec::size()) {
     bVec data_bvec = bVec::loadu(data + d);
     fVec data_fvec0, data_fvec1;
     std::tie(data_fvec0, data_fvec1) = convert_bfloat16_float(data_bvec);
@@ -738,6 +738,50 @@ inline void convert(const double* src, BFloat16* dst, int64_t n) {
   }
 }
 
+template <>
+inline void convert(const BFloat16* src, float* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + Vectorized<BFloat16>::size() <= n; i += Vectorized<BFloat16>::size()) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    __m256 o1, o2;
+    cvtbf16_fp32(a, o1, o2);
+    _mm256_storeu_ps(&dst[i], o1);
+    _mm256_storeu_ps(&dst[i + 8], o2);
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<float>(src[i]);
+  }
+}
+
+#ifdef __F16C__
+// Every AVX2 CPU also has F16C; the AVX2 kernel flags in cmake/Codegen.cmake
+// enable it so half conversions do not fall back to the scalar loop.
+template <>
+inline void convert(const c10::Half* src, float* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + 8 <= n; i += 8) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+    _mm256_storeu_ps(&dst[i], _mm256_cvtph_ps(a));
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<float>(src[i]);
+  }
+}
+
+template <>
+inline void convert(const float* src, c10::Half* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + 8 <= n; i += 8) {
+    __m128i a = _mm256_cvtps_ph(
+        _mm256_loadu_ps(&src[i]), (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i]), a);
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<c10::Half>(src[i]);
+  }
+}
+#endif // __F16C__
+
 template <>
 Vectorized<BFloat16> inline fmadd(const Vectorized<BFloat16>& a,
     const Vectorized<BFloat16>& b, const Vectorized<BFloat16>& c) {
@@ -97,6 +97,10 @@ public:
       std::memcpy(ptr, tmp_values, count * sizeof(float));
     }
   }
+  // ptr must be 32 byte aligned
+  void store_nt(void* ptr) const {
+    _mm256_stream_ps(reinterpret_cast<float*>(ptr), values);
+  }
   const float& operator[](int idx) const  = delete;
   float& operator[](int idx) = delete;
   int zero_mask() const {
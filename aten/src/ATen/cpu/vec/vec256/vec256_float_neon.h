@@ -30,7 +30,10 @@ inline namespace CPU_CAPABILITY {
 //    https://github.com/android/ndk/issues/1248
 //    https://bugs.llvm.org/show_bug.cgi?id=45824
 // Most likely we will do aarch32 support with inline asm.
-#if defined(__aarch64__)
+// When the build targets 256-bit fixed-length SVE, Vectorized<float> comes
+// from vec256_float_sve.h instead.
+#if defined(__aarch64__) && \
+    !(defined(__ARM_FEATURE_SVE_BITS) && __ARM_FEATURE_SVE_BITS == 256)
 
 #ifdef __BIG_ENDIAN__
 #error "Big endian is not supported."
@@ -0,0 +1,461 @@
+#pragma once
+
+// DO NOT DEFINE STATIC DATA IN THIS HEADER!
+// See Note [Do not compile initializers with AVX]
+
+#include <ATen/cpu/vec/intrinsics.h>
+#include <ATen/cpu/vec/vec_base.h>
+#include <c10/util/irange.h>
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE_BITS) && \
+    __ARM_FEATURE_SVE_BITS == 256
+#include <arm_sve.h>
+#endif
+
+namespace at {
+namespace vec {
+// See Note [CPU_CAPABILITY namespace]
+inline namespace CPU_CAPABILITY {
+
+// 256-bit fixed-length SVE implementation of Vectorized<float>, used in
+// place of the float32x4x2 NEON pair on SVE machines (e.g. Graviton3)
+// when the build targets -msve-vector-bits=256 (see USE_SVE256). SVE
+// types are sizeless by default and cannot be class members, so we pin
+// them to the vector length with arm_sve_vector_bits; this is a
+// compile-time commitment to VL=256, which the option name makes
+// explicit. Predication replaces the masked-load/store scalar fallbacks
+// the NEON version needs for tails.
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE_BITS) && \
+    __ARM_FEATURE_SVE_BITS == 256
+
+#ifdef __BIG_ENDIAN__
+#error "Big endian is not supported."
+#endif
+
+typedef svfloat32_t vls_float32_t __attribute__((arm_sve_vector_bits(256)));
+
+template <> class Vectorized<float> {
+private:
+  vls_float32_t values;
+
+  // All-lanes-active predicate; every unpredicated-style op below uses it.
+  static svbool_t ptrue() {
+    return svptrue_b32();
+  }
+  // Expands a predicate to the all-ones/all-zeros float lanes the
+  // Vectorized comparison contract requires.
+  static vls_float32_t from_pred(svbool_t pg) {
+    return svreinterpret_f32_u32(
+        svsel_u32(pg, svdup_n_u32(0xFFFFFFFF), svdup_n_u32(0)));
+  }
+  // Lanes of *this whose bit pattern is non-zero, as a predicate; inverse
+  // of from_pred, used to consume blendv-style masks.
+  svbool_t to_pred() const {
+    return svcmpne_n_u32(ptrue(), svreinterpret_u32_f32(values), 0);
+  }
+public:
+  using value_type = float;
+  using size_type = int;
+  static constexpr size_type size() {
+    return 8;
+  }
+  Vectorized() {}
+  Vectorized(svfloat32_t v) : values(v) {}
+  Vectorized(float val) : values(svdup_n_f32(val)) {}
+  Vectorized(float val0, float val1, float val2, float val3,
+         float val4, float val5, float val6, float val7) {
+    __at_align__ float tmp[size()] = {val0, val1, val2, val3,
+                                      val4, val5, val6, val7};
+    values = svld1_f32(ptrue(), tmp);
+  }
+  operator svfloat32_t() const {
+    return values;
+  }
+  template <int64_t mask>
+  static Vectorized<float> blend(const Vectorized<float>& a, const Vectorized<float>& b) {
+    // Lane i takes b if bit i of the immediate is set; materialize the
+    // immediate as a per-lane bit test instead of unrolled lane moves.
+    svuint32_t shifted =
+        svlsr_u32_x(ptrue(), svdup_n_u32(static_cast<uint32_t>(mask)),
+                    svindex_u32(0, 1));
+    svbool_t pg =
+        svcmpne_n_u32(ptrue(), svand_n_u32_x(ptrue(), shifted, 1), 0);
+    return svsel_f32(pg, b, a);
+  }
+  static Vectorized<float> blendv(const Vectorized<float>& a, const Vectorized<float>& b,
+                              const Vectorized<float>& mask) {
+    // NB: Like the NEON version, this requires each mask lane to be all
+    // zeros or all ones; any non-zero pattern selects b.
+    return svsel_f32(mask.to_pred(), b, a);
+  }
+  template<typename step_t>
+  static Vectorized<float> arange(float base = 0.f, step_t step = static_cast<step_t>(1)) {
+    const Vectorized<float> base_vec(base);
+    const Vectorized<float> step_vec(step);
+    const Vectorized<float> step_sizes(
+        svcvt_f32_s32_x(ptrue(), svindex_s32(0, 1)));
+    return fmadd(step_sizes, step_vec, base_vec);
+  }
+  static Vectorized<float> set(const Vectorized<float>& a, const Vectorized<float>& b,
+                           int64_t count = size()) {
+    return svsel_f32(svwhilelt_b32_s64(0, count), b, a);
+  }
+  static Vectorized<float> loadu(const void* ptr, int64_t count = size()) {
+    // Inactive lanes of a predicated load read as zero, matching the
+    // zero-filled temporary the NEON tail path builds.
+    return svld1_f32(
+        svwhilelt_b32_s64(0, count),
+        reinterpret_cast<const float*>(ptr));
+  }
+  void store(void* ptr, int64_t count = size()) const {
+    svst1_f32(
+        svwhilelt_b32_s64(0, count),
+        reinterpret_cast<float*>(ptr),
+        values);
+  }
+  float operator[](int idx) const {
+    __at_align__ float tmp[size()];
+    store(tmp);
+    return tmp[idx];
+  }
+  float operator[](int idx) {
+    __at_align__ float tmp[size()];
+    store(tmp);
+    return tmp[idx];
+  }
+  int zero_mask() const {
+    svbool_t zero = svcmpeq_n_f32(ptrue(), values, 0.f);
+    svint32_t bits = svsel_s32(
+        zero,
+        svlsl_s32_x(ptrue(), svdup_n_s32(1), svindex_u32(0, 1)),
+        svdup_n_s32(0));
+    return svaddv_s32(ptrue(), bits);
+  }
+  Vectorized<float> isnan() const {
+    return from_pred(svcmpne_f32(ptrue(), values, values));
+  }
+  Vectorized<float> map(float (*const f)(float)) const {
+    __at_align__ float tmp[size()];
+    store(tmp);
+    for (const auto i : c10::irange(size())) {
+      tmp[i] = f(tmp[i]);
+    }
+    return loadu(tmp);
+  }
+  Vectorized<float> map2(
+      const Vectorized<float>& other,
+      float (*const f)(float, float)) const {
+    __at_align__ float tmp[size()];
+    __at_align__ float tmp_other[size()];
+    store(tmp);
+    other.store(tmp_other);
+    for (const auto i : c10::irange(size())) {
+      tmp[i] = f(tmp[i], tmp_other[i]);
+    }
+    return loadu(tmp);
+  }
+  Vectorized<float> abs() const {
+    return svabs_f32_x(ptrue(), values);
+  }
+  Vectorized<float> angle() const {
+    auto zero = Vectorized<float>(0);
+    auto pi = Vectorized<float>(c10::pi<float>);
+    auto tmp = blendv(zero, pi, *this < zero);
+    return blendv(tmp, *this, isnan());
+  }
+  Vectorized<float> real() const {
+    return *this;
+  }
+  Vectorized<float> imag() const {
+    return Vectorized<float>(0.f);
+  }
+  Vectorized<float> conj() const {
+    return *this;
+  }
+  // Transcendentals go through the scalar map like the non-Sleef NEON
+  // build; Sleef's SVE variants can be wired up once the bundled Sleef
+  // is built with them.
+  Vectorized<float> acos() const {
+    return map(std::acos);
+  }
+  Vectorized<float> asin() const {
+    return map(std::asin);
+  }
+  Vectorized<float> atan() const {
+    return map(std::atan);
+  }
+  Vectorized<float> atan2(const Vectorized<float> &exp) const {
+    return map2(exp, std::atan2);
+  }
+  Vectorized<float> copysign(const Vectorized<float> &sign) const {
+    // Copy the sign bit over with a bitwise select.
+    svuint32_t sign_bit = svdup_n_u32(0x80000000);
+    return svreinterpret_f32_u32(svorr_u32_x(
+        ptrue(),
+        svbic_u32_x(ptrue(), svreinterpret_u32_f32(values), sign_bit),
+        svand_u32_x(
+            ptrue(), svreinterpret_u32_f32(sign.values), sign_bit)));
+  }
+  Vectorized<float> erf() const {
+    return map(std::erf);
+  }
+  Vectorized<float> erfc() const {
+    return map(std::erfc);
+  }
+  Vectorized<float> erfinv() const {
+    return map(calc_erfinv);
+  }
+  Vectorized<float> exp() const {
+    return map(std::exp);
+  }
+  Vectorized<float> exp2() const {
+    return map(std::exp2);
+  }
+  Vectorized<float> expm1() const {
+    return map(std::expm1);
+  }
+  Vectorized<float> fmod(const Vectorized<float>& q) const {
+    return map2(q, std::fmod);
+  }
+  Vectorized<float> hypot(const Vectorized<float> &b) const {
+    return map2(b, std::hypot);
+  }
+  Vectorized<float> i0() const {
+    return map(calc_i0);
+  }
+  Vectorized<float> i0e() const {
+    return map(calc_i0e);
+  }
+  Vectorized<float> igamma(const Vectorized<float> &x) const {
+    return map2(x, calc_igamma);
+  }
+  Vectorized<float> igammac(const Vectorized<float> &x) const {
+    return map2(x, calc_igammac);
+  }
+  Vectorized<float> log() const {
+    return map(std::log);
+  }
+  Vectorized<float> log10() const {
+    return map(std::log10);
+  }
+  Vectorized<float> log1p() const {
+    return map(std::log1p);
+  }
+  Vectorized<float> log2() const {
+    return map(std::log2);
+  }
+  Vectorized<float> nextafter(const Vectorized<float> &b) const {
+    return map2(b, std::nextafter);
+  }
+  Vectorized<float> frac() const;
+  Vectorized<float> sin() const {
+    return map(std::sin);
+  }
+  Vectorized<float> sinh() const {
+    return map(std::sinh);
+  }
+  Vectorized<float> cos() const {
+    return map(std::cos);
+  }
+  Vectorized<float> cosh() const {
+    return map(std::cosh);
+  }
+  Vectorized<float> ceil() const {
+    return svrintp_f32_x(ptrue(), values);
+  }
+  Vectorized<float> floor() const {
+    return svrintm_f32_x(ptrue(), values);
+  }
+  Vectorized<float> neg() const {
+    return svneg_f32_x(ptrue(), values);
+  }
+  Vectorized<float> round() const {
+    // FRINTN rounds midway numbers to the nearest even integer, which is
+    // the rounding the NEON version takes the scalar path to get.
+    return svrintn_f32_x(ptrue(), values);
+  }
+  Vectorized<float> tan() const {
+    return map(std::tan);
+  }
+  Vectorized<float> tanh() const {
+    return map(std::tanh);
+  }
+  Vectorized<float> trunc() const {
+    return svrintz_f32_x(ptrue(), values);
+  }
+  Vectorized<float> lgamma() const {
+    return map(std::lgamma);
+  }
+  Vectorized<float> sqrt() const {
+    return svsqrt_f32_x(ptrue(), values);
+  }
+  Vectorized<float> reciprocal() const {
+    return svdivr_n_f32_x(ptrue(), values, 1.0f);
+  }
+  Vectorized<float> rsqrt() const {
+    return this->sqrt().reciprocal();
+  }
+  Vectorized<float> pow(const Vectorized<float> &exp) const {
+    return map2(exp, std::pow);
+  }
+  Vectorized<float> operator==(const Vectorized<float>& other) const {
+    return from_pred(svcmpeq_f32(ptrue(), values, other.values));
+  }
+  Vectorized<float> operator!=(const Vectorized<float>& other) const {
+    return from_pred(svcmpne_f32(ptrue(), values, other.values));
+  }
+  Vectorized<float> operator<(const Vectorized<float>& other) const {
+    return from_pred(svcmplt_f32(ptrue(), values, other.values));
+  }
+  Vectorized<float> operator<=(const Vectorized<float>& other) const {
+    return from_pred(svcmple_f32(ptrue(), values, other.values));
+  }
+  Vectorized<float> operator>(const Vectorized<float>& other) const {
+    return from_pred(svcmpgt_f32(ptrue(), values, other.values));
+  }
+  Vectorized<float> operator>=(const Vectorized<float>& other) const {
+    return from_pred(svcmpge_f32(ptrue(), values, other.values));
+  }
+
+  Vectorized<float> eq(const Vectorized<float>& other) const;
+  Vectorized<float> ne(const Vectorized<float>& other) const;
+  Vectorized<float> gt(const Vectorized<float>& other) const;
+  Vectorized<float> ge(const Vectorized<float>& other) const;
+  Vectorized<float> lt(const Vectorized<float>& other) const;
+  Vectorized<float> le(const Vectorized<float>& other) const;
+};
+
+template <>
+Vectorized<float> inline operator+(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svadd_f32_x(svptrue_b32(), a, b);
+}
+
+template <>
+Vectorized<float> inline operator-(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svsub_f32_x(svptrue_b32(), a, b);
+}
+
+template <>
+Vectorized<float> inline operator*(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svmul_f32_x(svptrue_b32(), a, b);
+}
+
+template <>
+Vectorized<float> inline operator/(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svdiv_f32_x(svptrue_b32(), a, b);
+}
+
+// frac. Implement this here so we can use subtraction
+inline Vectorized<float> Vectorized<float>::frac() const {
+  return *this - this->trunc();
+}
+
+// Implements the IEEE 754 201X `maximum` operation, which propagates NaN if
+// either input is a NaN. (FMAX, unlike FMAXNM, propagates NaN.)
+template <>
+Vectorized<float> inline maximum(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svmax_f32_x(svptrue_b32(), a, b);
+}
+
+// Implements the IEEE 754 201X `minimum` operation, which propagates NaN if
+// either input is a NaN.
+template <>
+Vectorized<float> inline minimum(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svmin_f32_x(svptrue_b32(), a, b);
+}
+
+template <>
+Vectorized<float> inline clamp(const Vectorized<float>& a, const Vectorized<float>& min, const Vectorized<float>& max) {
+  return minimum(max, maximum(min, a));
+}
+
+template <>
+Vectorized<float> inline clamp_max(const Vectorized<float>& a, const Vectorized<float>& max) {
+  return minimum(max, a);
+}
+
+template <>
+Vectorized<float> inline clamp_min(const Vectorized<float>& a, const Vectorized<float>& min) {
+  return maximum(min, a);
+}
+
+template <>
+Vectorized<float> inline operator&(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svreinterpret_f32_u32(svand_u32_x(
+      svptrue_b32(),
+      svreinterpret_u32_f32(a),
+      svreinterpret_u32_f32(b)));
+}
+
+template <>
+Vectorized<float> inline operator|(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svreinterpret_f32_u32(svorr_u32_x(
+      svptrue_b32(),
+      svreinterpret_u32_f32(a),
+      svreinterpret_u32_f32(b)));
+}
+
+template <>
+Vectorized<float> inline operator^(const Vectorized<float>& a, const Vectorized<float>& b) {
+  return svreinterpret_f32_u32(sveor_u32_x(
+      svptrue_b32(),
+      svreinterpret_u32_f32(a),
+      svreinterpret_u32_f32(b)));
+}
+
+inline Vectorized<float> Vectorized<float>::eq(const Vectorized<float>& other) const {
+  return (*this == other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::ne(const Vectorized<float>& other) const {
+  return (*this != other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::gt(const Vectorized<float>& other) const {
+  return (*this > other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::ge(const Vectorized<float>& other) const {
+  return (*this >= other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::lt(const Vectorized<float>& other) const {
+  return (*this < other) & Vectorized<float>(1.0f);
+}
+
+inline Vectorized<float> Vectorized<float>::le(const Vectorized<float>& other) const {
+  return (*this <= other) & Vectorized<float>(1.0f);
+}
+
+template <>
+inline void convert(const float* src, int32_t* dst, int64_t n) {
+  // Predicated tail instead of a scalar epilogue.
+  for (int64_t i = 0; i < n; i += Vectorized<float>::size()) {
+    svbool_t pg = svwhilelt_b32_s64(i, n);
+    svst1_s32(pg, dst + i,
+              svcvt_s32_f32_x(pg, svld1_f32(pg, src + i)));
+  }
+}
+
+template <>
+inline void convert(const int32_t* src, float* dst, int64_t n) {
+  for (int64_t i = 0; i < n; i += Vectorized<float>::size()) {
+    svbool_t pg = svwhilelt_b32_s64(i, n);
+    svst1_f32(pg, dst + i,
+              svcvt_f32_s32_x(pg, svld1_s32(pg, src + i)));
+  }
+}
+
+template <>
+Vectorized<float> inline fmadd(const Vectorized<float>& a, const Vectorized<float>& b, const Vectorized<float>& c) {
+  return svmad_f32_x(svptrue_b32(), a, b, c);
+}
+
+template <>
+Vectorized<float> inline fmsub(const Vectorized<float>& a, const Vectorized<float>& b, const Vectorized<float>& c) {
+  return svnmsb_f32_x(svptrue_b32(), a, b, c);
+}
+
+#endif /* 256-bit fixed-length SVE */
+
+}}}
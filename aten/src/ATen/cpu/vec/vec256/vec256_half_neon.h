@@ -0,0 +1,596 @@
+#pragma once
+
+// DO NOT DEFINE STATIC DATA IN THIS HEADER!
+// See Note [Do not compile initializers with AVX]
+
+#include <ATen/cpu/vec/intrinsics.h>
+#include <ATen/cpu/vec/vec_base.h>
+#include <c10/util/Half.h>
+#include <c10/util/irange.h>
+
+namespace at {
+namespace vec {
+// See Note [CPU_CAPABILITY namespace]
+inline namespace CPU_CAPABILITY {
+
+// Native fp16 arithmetic requires FEAT_FP16 (armv8.2-a+fp16); without it
+// Vectorized<c10::Half> falls back to the element-wise vec_base.h
+// implementation, which converts through float per element.  Like
+// vec256_float_neon.h, only aarch64 is supported.
+#if defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+#ifdef __BIG_ENDIAN__
+#error "Big endian is not supported."
+#endif
+
+template <> class Vectorized<c10::Half> {
+private:
+  float16x8x2_t values;
+public:
+  using value_type = c10::Half;
+  using size_type = int;
+  static constexpr size_type size() {
+    return 16;
+  }
+  Vectorized() {}
+  Vectorized(float16x8x2_t v) : values(v) {}
+  Vectorized(c10::Half val)
+      : values{
+            vreinterpretq_f16_u16(vdupq_n_u16(val.x)),
+            vreinterpretq_f16_u16(vdupq_n_u16(val.x))} {}
+  Vectorized(c10::Half val0, c10::Half val1, c10::Half val2, c10::Half val3,
+         c10::Half val4, c10::Half val5, c10::Half val6, c10::Half val7,
+         c10::Half val8, c10::Half val9, c10::Half val10, c10::Half val11,
+         c10::Half val12, c10::Half val13, c10::Half val14, c10::Half val15) {
+    __at_align__ c10::Half tmp[size()] = {
+        val0, val1, val2, val3, val4, val5, val6, val7,
+        val8, val9, val10, val11, val12, val13, val14, val15};
+    values = vld1q_f16_x2(reinterpret_cast<const float16_t*>(tmp));
+  }
+  Vectorized(float16x8_t val0, float16x8_t val1) : values{val0, val1} {}
+  operator float16x8x2_t() const {
+    return values;
+  }
+  template <int64_t mask>
+  static Vectorized<c10::Half> blend(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+    // With 16 lanes the per-lane vsetq_lane approach of
+    // vec256_float_neon.h gets unwieldy; build the lane masks from the
+    // immediate and bit-select instead.
+    const uint16x8_t mask_low = {
+      (mask & 0x0001) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0002) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0004) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0008) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0010) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0020) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0040) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0080) ? (uint16_t)0xFFFF : (uint16_t)0};
+    const uint16x8_t mask_high = {
+      (mask & 0x0100) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0200) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0400) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x0800) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x1000) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x2000) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x4000) ? (uint16_t)0xFFFF : (uint16_t)0,
+      (mask & 0x8000) ? (uint16_t)0xFFFF : (uint16_t)0};
+    Vectorized<c10::Half> vec;
+    vec.values.val[0] = vbslq_f16(mask_low, b.values.val[0], a.values.val[0]);
+    vec.values.val[1] = vbslq_f16(mask_high, b.values.val[1], a.values.val[1]);
+    return vec;
+  }
+  static Vectorized<c10::Half> blendv(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b,
+                              const Vectorized<c10::Half>& mask) {
+    // NB: This requires that each value, i.e., each uint16 value,
+    // of the mask either all be zeros or all be 1s.
+    Vectorized<c10::Half> vec;
+    vec.values.val[0] = vbslq_f16(
+        vreinterpretq_u16_f16(mask.values.val[0]),
+        b.values.val[0],
+        a.values.val[0]);
+    vec.values.val[1] = vbslq_f16(
+        vreinterpretq_u16_f16(mask.values.val[1]),
+        b.values.val[1],
+        a.values.val[1]);
+    return vec;
+  }
+  template<typename step_t>
+  static Vectorized<c10::Half> arange(c10::Half base = 0.f, step_t step = static_cast<step_t>(1)) {
+    __at_align__ c10::Half tmp[size()];
+    for (const auto i : c10::irange(size())) {
+      tmp[i] = static_cast<float>(base) + i * static_cast<float>(step);
+    }
+    return loadu(tmp);
+  }
+  static Vectorized<c10::Half> set(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b,
+                           int64_t count = size()) {
+    if (count == 0) {
+      return a;
+    } else if (count >= size()) {
+      return b;
+    }
+    __at_align__ uint16_t mask_arr[size()];
+    for (const auto i : c10::irange(size())) {
+      mask_arr[i] = i < count ? 0xFFFF : 0;
+    }
+    const uint16x8x2_t mask = vld1q_u16_x2(mask_arr);
+    Vectorized<c10::Half> vec;
+    vec.values.val[0] = vbslq_f16(mask.val[0], b.values.val[0], a.values.val[0]);
+    vec.values.val[1] = vbslq_f16(mask.val[1], b.values.val[1], a.values.val[1]);
+    return vec;
+  }
+  static Vectorized<c10::Half> loadu(const void* ptr, int64_t count = size()) {
+    if (count == size()) {
+      return vld1q_f16_x2(reinterpret_cast<const float16_t*>(ptr));
+    }
+    else if (count == (size() >> 1)) {
+      Vectorized<c10::Half> res;
+      res.values.val[0] = vld1q_f16(reinterpret_cast<const float16_t*>(ptr));
+      res.values.val[1] = vreinterpretq_f16_u16(vdupq_n_u16(0));
+      return res;
+    }
+    else {
+      __at_align__ c10::Half tmp_values[size()];
+      for (const auto i : c10::irange(size())) {
+        tmp_values[i] = c10::Half(0.f);
+      }
+      std::memcpy(
+          tmp_values,
+          reinterpret_cast<const c10::Half*>(ptr),
+          count * sizeof(c10::Half));
+      return vld1q_f16_x2(reinterpret_cast<const float16_t*>(tmp_values));
+    }
+  }
+  void store(void* ptr, int64_t count = size()) const {
+    if (count == size()) {
+      vst1q_f16_x2(reinterpret_cast<float16_t*>(ptr), values);
+    }
+    else if (count == (size() >> 1)) {
+      vst1q_f16(reinterpret_cast<float16_t*>(ptr), values.val[0]);
+    }
+    else {
+      __at_align__ c10::Half tmp_values[size()];
+      vst1q_f16_x2(reinterpret_cast<float16_t*>(tmp_values), values);
+      std::memcpy(ptr, tmp_values, count * sizeof(c10::Half));
+    }
+  }
+  inline const float16x8_t& get_low() const {
+    return values.val[0];
+  }
+  inline float16x8_t& get_low() {
+    return values.val[0];
+  }
+  inline const float16x8_t& get_high() const {
+    return values.val[1];
+  }
+  inline float16x8_t& get_high() {
+    return values.val[1];
+  }
+  c10::Half operator[](int idx) const {
+    __at_align__ c10::Half tmp[size()];
+    store(tmp);
+    return tmp[idx];
+  }
+  c10::Half operator[](int idx) {
+    __at_align__ c10::Half tmp[size()];
+    store(tmp);
+    return tmp[idx];
+  }
+  int zero_mask() const {
+    __at_align__ c10::Half tmp[size()];
+    store(tmp);
+    int mask = 0;
+    for (int i = 0; i < size(); ++ i) {
+      if (static_cast<float>(tmp[i]) == 0.f) {
+        mask |= (1 << i);
+      }
+    }
+    return mask;
+  }
+  Vectorized<c10::Half> isnan() const {
+    __at_align__ c10::Half tmp[size()];
+    __at_align__ c10::Half res[size()];
+    store(tmp);
+    for (const auto i : c10::irange(size())) {
+      if (_isnan(static_cast<float>(tmp[i]))) {
+        std::memset(static_cast<void*>(&res[i]), 0xFF, sizeof(c10::Half));
+      } else {
+        std::memset(static_cast<void*>(&res[i]), 0, sizeof(c10::Half));
+      }
+    }
+    return loadu(res);
+  };
+  // Transcendentals go through float: scalar Half math on CPU computes in
+  // float, and doing the same here keeps the precision of these ops
+  // unchanged.
+  Vectorized<c10::Half> map(float (*const f)(float)) const {
+    __at_align__ c10::Half tmp[size()];
+    store(tmp);
+    for (const auto i : c10::irange(size())) {
+      tmp[i] = f(tmp[i]);
+    }
+    return loadu(tmp);
+  }
+  Vectorized<c10::Half> map2(
+      const Vectorized<c10::Half>& other,
+      float (*const f)(float, float)) const {
+    __at_align__ c10::Half tmp[size()];
+    __at_align__ c10::Half tmp_other[size()];
+    store(tmp);
+    other.store(tmp_other);
+    for (const auto i : c10::irange(size())) {
+      tmp[i] = f(tmp[i], tmp_other[i]);
+    }
+    return loadu(tmp);
+  }
+  Vectorized<c10::Half> abs() const {
+    return Vectorized<c10::Half>(
+        vabsq_f16(values.val[0]), vabsq_f16(values.val[1]));
+  }
+  Vectorized<c10::Half> angle() const {
+    auto zero = Vectorized<c10::Half>(0);
+    auto pi = Vectorized<c10::Half>(c10::pi<float>);
+    auto tmp = blendv(zero, pi, *this < zero);
+    return blendv(tmp, *this, isnan());
+  }
+  Vectorized<c10::Half> real() const {
+    return *this;
+  }
+  Vectorized<c10::Half> imag() const {
+    return Vectorized<c10::Half>(0);
+  }
+  Vectorized<c10::Half> conj() const {
+    return *this;
+  }
+  Vectorized<c10::Half> acos() const {
+    return map(std::acos);
+  }
+  Vectorized<c10::Half> asin() const {
+    return map(std::asin);
+  }
+  Vectorized<c10::Half> atan() const {
+    return map(std::atan);
+  }
+  Vectorized<c10::Half> atan2(const Vectorized<c10::Half> &exp) const {
+    return map2(exp, std::atan2);
+  }
+  Vectorized<c10::Half> copysign(const Vectorized<c10::Half> &sign) const {
+    return map2(sign, std::copysign);
+  }
+  Vectorized<c10::Half> erf() const {
+    return map(std::erf);
+  }
+  Vectorized<c10::Half> erfc() const {
+    return map(std::erfc);
+  }
+  Vectorized<c10::Half> erfinv() const {
+    return map(calc_erfinv);
+  }
+  Vectorized<c10::Half> exp() const {
+    return map(std::exp);
+  }
+  Vectorized<c10::Half> exp2() const {
+    return map(std::exp2);
+  }
+  Vectorized<c10::Half> expm1() const {
+    return map(std::expm1);
+  }
+  Vectorized<c10::Half> fmod(const Vectorized<c10::Half>& q) const {
+    return map2(q, std::fmod);
+  }
+  Vectorized<c10::Half> hypot(const Vectorized<c10::Half> &b) const {
+    return map2(b, std::hypot);
+  }
+  Vectorized<c10::Half> i0() const {
+    return map(calc_i0);
+  }
+  Vectorized<c10::Half> i0e() const {
+    return map(calc_i0e);
+  }
+  Vectorized<c10::Half> igamma(const Vectorized<c10::Half> &x) const {
+    return map2(x, calc_igamma);
+  }
+  Vectorized<c10::Half> igammac(const Vectorized<c10::Half> &x) const {
+    return map2(x, calc_igammac);
+  }
+  Vectorized<c10::Half> log() const {
+    return map(std::log);
+  }
+  Vectorized<c10::Half> log10() const {
+    return map(std::log10);
+  }
+  Vectorized<c10::Half> log1p() const {
+    return map(std::log1p);
+  }
+  Vectorized<c10::Half> log2() const {
+    return map(std::log2);
+  }
+  Vectorized<c10::Half> nextafter(const Vectorized<c10::Half> &b) const {
+    return map2(b, std::nextafter);
+  }
+  Vectorized<c10::Half> frac() const;
+  Vectorized<c10::Half> sin() const {
+    return map(std::sin);
+  }
+  Vectorized<c10::Half> sinh() const {
+    return map(std::sinh);
+  }
+  Vectorized<c10::Half> cos() const {
+    return map(std::cos);
+  }
+  Vectorized<c10::Half> cosh() const {
+    return map(std::cosh);
+  }
+  Vectorized<c10::Half> ceil() const {
+    return map(at::native::ceil_impl);
+  }
+  Vectorized<c10::Half> floor() const {
+    return map(at::native::floor_impl);
+  }
+  Vectorized<c10::Half> neg() const {
+    return Vectorized<c10::Half>(
+        vnegq_f16(values.val[0]),
+        vnegq_f16(values.val[1]));
+  }
+  Vectorized<c10::Half> round() const {
+    // We do not use std::round because we would like to round midway numbers to the nearest even integer.
+    return map(at::native::round_impl);
+  }
+  Vectorized<c10::Half> tan() const {
+    return map(std::tan);
+  }
+  Vectorized<c10::Half> tanh() const {
+    return map(std::tanh);
+  }
+  Vectorized<c10::Half> trunc() const {
+    float16x8_t r0 = vrndq_f16(values.val[0]);
+    float16x8_t r1 = vrndq_f16(values.val[1]);
+    return Vectorized<c10::Half>(r0, r1);
+  }
+  Vectorized<c10::Half> lgamma() const {
+    return map(std::lgamma);
+  }
+  Vectorized<c10::Half> sqrt() const {
+    return Vectorized<c10::Half>(
+        vsqrtq_f16(values.val[0]),
+        vsqrtq_f16(values.val[1]));
+  }
+  Vectorized<c10::Half> reciprocal() const {
+    auto ones = vreinterpretq_f16_u16(vdupq_n_u16(0x3C00));  // 1.0 in fp16
+    auto r0 = vdivq_f16(ones, values.val[0]);
+    auto r1 = vdivq_f16(ones, values.val[1]);
+    return Vectorized<c10::Half>(r0, r1);
+  }
+  Vectorized<c10::Half> rsqrt() const {
+    return this->sqrt().reciprocal();
+  }
+  Vectorized<c10::Half> pow(const Vectorized<c10::Half> &exp) const {
+    return map2(exp, std::pow);
+  }
+  Vectorized<c10::Half> operator==(const Vectorized<c10::Half>& other) const {
+    float16x8_t r0 =
+      vreinterpretq_f16_u16(vceqq_f16(values.val[0], other.values.val[0]));
+    float16x8_t r1 =
+      vreinterpretq_f16_u16(vceqq_f16(values.val[1], other.values.val[1]));
+    return Vectorized<c10::Half>(r0, r1);
+  }
+
+  Vectorized<c10::Half> operator!=(const Vectorized<c10::Half>& other) const {
+    float16x8_t r0 = vreinterpretq_f16_u16(
+        vmvnq_u16(vceqq_f16(values.val[0], other.values.val[0])));
+    float16x8_t r1 = vreinterpretq_f16_u16(
+        vmvnq_u16(vceqq_f16(values.val[1], other.values.val[1])));
+    return Vectorized<c10::Half>(r0, r1);
+  }
+
+  Vectorized<c10::Half> operator<(const Vectorized<c10::Half>& other) const {
+    float16x8_t r0 =
+      vreinterpretq_f16_u16(vcltq_f16(values.val[0], other.values.val[0]));
+    float16x8_t r1 =
+      vreinterpretq_f16_u16(vcltq_f16(values.val[1], other.values.val[1]));
+    return Vectorized<c10::Half>(r0, r1);
+  }
+
+  Vectorized<c10::Half> operator<=(const Vectorized<c10::Half>& other) const {
+    float16x8_t r0 =
+      vreinterpretq_f16_u16(vcleq_f16(values.val[0], other.values.val[0]));
+    float16x8_t r1 =
+      vreinterpretq_f16_u16(vcleq_f16(values.val[1], other.values.val[1]));
+    return Vectorized<c10::Half>(r0, r1);
+  }
+
+  Vectorized<c10::Half> operator>(const Vectorized<c10::Half>& other) const {
+    float16x8_t r0 =
+      vreinterpretq_f16_u16(vcgtq_f16(values.val[0], other.values.val[0]));
+    float16x8_t r1 =
+      vreinterpretq_f16_u16(vcgtq_f16(values.val[1], other.values.val[1]));
+    return Vectorized<c10::Half>(r0, r1);
+  }
+
+  Vectorized<c10::Half> operator>=(const Vectorized<c10::Half>& other) const {
+    float16x8_t r0 =
+      vreinterpretq_f16_u16(vcgeq_f16(values.val[0], other.values.val[0]));
+    float16x8_t r1 =
+      vreinterpretq_f16_u16(vcgeq_f16(values.val[1], other.values.val[1]));
+    return Vectorized<c10::Half>(r0, r1);
+  }
+
+  Vectorized<c10::Half> eq(const Vectorized<c10::Half>& other) const;
+  Vectorized<c10::Half> ne(const Vectorized<c10::Half>& other) const;
+  Vectorized<c10::Half> gt(const Vectorized<c10::Half>& other) const;
+  Vectorized<c10::Half> ge(const Vectorized<c10::Half>& other) const;
+  Vectorized<c10::Half> lt(const Vectorized<c10::Half>& other) const;
+  Vectorized<c10::Half> le(const Vectorized<c10::Half>& other) const;
+};
+
+template <>
+Vectorized<c10::Half> inline operator+(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+  float16x8_t r0 = vaddq_f16(a.get_low(), b.get_low());
+  float16x8_t r1 = vaddq_f16(a.get_high(), b.get_high());
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+template <>
+Vectorized<c10::Half> inline operator-(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+  float16x8_t r0 = vsubq_f16(a.get_low(), b.get_low());
+  float16x8_t r1 = vsubq_f16(a.get_high(), b.get_high());
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+template <>
+Vectorized<c10::Half> inline operator*(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+  float16x8_t r0 = vmulq_f16(a.get_low(), b.get_low());
+  float16x8_t r1 = vmulq_f16(a.get_high(), b.get_high());
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+template <>
+Vectorized<c10::Half> inline operator/(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+  float16x8_t r0 = vdivq_f16(a.get_low(), b.get_low());
+  float16x8_t r1 = vdivq_f16(a.get_high(), b.get_high());
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+// frac. Implement this here so we can use subtraction
+inline Vectorized<c10::Half> Vectorized<c10::Half>::frac() const {
+  return *this - this->trunc();
+}
+
+// Implements the IEEE 754 201X `maximum` operation, which propagates NaN if
+// either input is a NaN.
+template <>
+Vectorized<c10::Half> inline maximum(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+  float16x8_t r0 = vmaxq_f16(a.get_low(), b.get_low());
+  float16x8_t r1 = vmaxq_f16(a.get_high(), b.get_high());
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+// Implements the IEEE 754 201X `minimum` operation, which propagates NaN if
+// either input is a NaN.
+template <>
+Vectorized<c10::Half> inline minimum(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+  float16x8_t r0 = vminq_f16(a.get_low(), b.get_low());
+  float16x8_t r1 = vminq_f16(a.get_high(), b.get_high());
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+template <>
+Vectorized<c10::Half> inline clamp(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& min, const Vectorized<c10::Half>& max) {
+  return minimum(max, maximum(min, a));
+}
+
+template <>
+Vectorized<c10::Half> inline clamp_max(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& max) {
+  return minimum(max, a);
+}
+
+template <>
+Vectorized<c10::Half> inline clamp_min(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& min) {
+  return maximum(min, a);
+}
+
+template <>
+Vectorized<c10::Half> inline operator&(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+  float16x8_t r0 = vreinterpretq_f16_u16(vandq_u16(
+      vreinterpretq_u16_f16(a.get_low()),
+      vreinterpretq_u16_f16(b.get_low())));
+  float16x8_t r1 = vreinterpretq_f16_u16(vandq_u16(
+      vreinterpretq_u16_f16(a.get_high()),
+      vreinterpretq_u16_f16(b.get_high())));
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+template <>
+Vectorized<c10::Half> inline operator|(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+  float16x8_t r0 = vreinterpretq_f16_u16(vorrq_u16(
+      vreinterpretq_u16_f16(a.get_low()),
+      vreinterpretq_u16_f16(b.get_low())));
+  float16x8_t r1 = vreinterpretq_f16_u16(vorrq_u16(
+      vreinterpretq_u16_f16(a.get_high()),
+      vreinterpretq_u16_f16(b.get_high())));
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+template <>
+Vectorized<c10::Half> inline operator^(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b) {
+  float16x8_t r0 = vreinterpretq_f16_u16(veorq_u16(
+      vreinterpretq_u16_f16(a.get_low()),
+      vreinterpretq_u16_f16(b.get_low())));
+  float16x8_t r1 = vreinterpretq_f16_u16(veorq_u16(
+      vreinterpretq_u16_f16(a.get_high()),
+      vreinterpretq_u16_f16(b.get_high())));
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+inline Vectorized<c10::Half> Vectorized<c10::Half>::eq(const Vectorized<c10::Half>& other) const {
+  return (*this == other) & Vectorized<c10::Half>(1.0f);
+}
+
+inline Vectorized<c10::Half> Vectorized<c10::Half>::ne(const Vectorized<c10::Half>& other) const {
+  return (*this != other) & Vectorized<c10::Half>(1.0f);
+}
+
+inline Vectorized<c10::Half> Vectorized<c10::Half>::gt(const Vectorized<c10::Half>& other) const {
+  return (*this > other) & Vectorized<c10::Half>(1.0f);
+}
+
+inline Vectorized<c10::Half> Vectorized<c10::Half>::ge(const Vectorized<c10::Half>& other) const {
+  return (*this >= other) & Vectorized<c10::Half>(1.0f);
+}
+
+inline Vectorized<c10::Half> Vectorized<c10::Half>::lt(const Vectorized<c10::Half>& other) const {
+  return (*this < other) & Vectorized<c10::Half>(1.0f);
+}
+
+inline Vectorized<c10::Half> Vectorized<c10::Half>::le(const Vectorized<c10::Half>& other) const {
+  return (*this <= other) & Vectorized<c10::Half>(1.0f);
+}
+
+template <>
+inline void convert(const c10::Half* src, float* dst, int64_t n) {
+  int64_t i = 0;
+#pragma unroll
+  for (; i <= (n - 8); i += 8) {
+    float16x8_t h = vld1q_f16(reinterpret_cast<const float16_t*>(src + i));
+    vst1q_f32(dst + i, vcvt_f32_f16(vget_low_f16(h)));
+    vst1q_f32(dst + i + 4, vcvt_f32_f16(vget_high_f16(h)));
+  }
+#pragma unroll
+  for (; i < n; i++) {
+    dst[i] = static_cast<float>(src[i]);
+  }
+}
+
+template <>
+inline void convert(const float* src, c10::Half* dst, int64_t n) {
+  int64_t i = 0;
+#pragma unroll
+  for (; i <= (n - 8); i += 8) {
+    float16x8_t h = vcombine_f16(
+        vcvt_f16_f32(vld1q_f32(src + i)),
+        vcvt_f16_f32(vld1q_f32(src + i + 4)));
+    vst1q_f16(reinterpret_cast<float16_t*>(dst + i), h);
+  }
+#pragma unroll
+  for (; i < n; i++) {
+    dst[i] = static_cast<c10::Half>(src[i]);
+  }
+}
+
+template <>
+Vectorized<c10::Half> inline fmadd(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b, const Vectorized<c10::Half>& c) {
+  float16x8_t r0 = vfmaq_f16(c.get_low(), a.get_low(), b.get_low());
+  float16x8_t r1 = vfmaq_f16(c.get_high(), a.get_high(), b.get_high());
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+template <>
+Vectorized<c10::Half> inline fmsub(const Vectorized<c10::Half>& a, const Vectorized<c10::Half>& b, const Vectorized<c10::Half>& c) {
+  float16x8_t r0 = vfmsq_f16(c.get_low(), a.get_low(), b.get_low());
+  float16x8_t r1 = vfmsq_f16(c.get_high(), a.get_high(), b.get_high());
+  return Vectorized<c10::Half>(r0, r1);
+}
+
+#endif /* defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) */
+
+}}}
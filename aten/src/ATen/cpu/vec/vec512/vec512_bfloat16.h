@@ -30,6 +30,12 @@ static inline void cvtbf16_fp32(const __m512i& a, __m512& o1, __m512& o2) {
 }
 
 static inline __m512i cvtfp32_bf16(const __m512& a, const __m512& b) {
+#if defined(__AVX512BF16__)
+  // The native convert has the same round-to-nearest-even and quiet-NaN
+  // behavior as the emulation below.  Note the argument order: the intrinsic
+  // places the convert of its *second* operand in the lower 256 bits.
+  return (__m512i)_mm512_cvtne2ps_pbh(b, a);
+#else
   __m512i lo = _mm512_castps_si512(a);
   __m512i hi = _mm512_castps_si512(b);
   __m512i nan = _mm512_set1_epi32(0xffff);
@@ -56,6 +62,7 @@ static inline __m512i cvtfp32_bf16(const __m512& a, const __m512& b) {
   t_lo = _mm512_packus_epi32(t_lo, t_hi); // t_hi[4-7] t_lo[4-7] t_hi[0-4] t_lo[0-4]
   __m512i idx = _mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0);
   return _mm512_permutexvar_epi64(idx, t_lo);
+#endif
 }
 
 static inline __m512i merge_compare_result(const __m512& a, const __m512& b) {
@@ -840,6 +847,46 @@ inline void convert(const double* src, BFloat16* dst, int64_t n) {
   }
 }
 
+template <>
+inline void convert(const BFloat16* src, float* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + Vectorized<BFloat16>::size() <= n; i += Vectorized<BFloat16>::size()) {
+    __m512i a = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(&src[i]));
+    __m512 o1, o2;
+    cvtbf16_fp32(a, o1, o2);
+    _mm512_storeu_ps(&dst[i], o1);
+    _mm512_storeu_ps(&dst[i + 16], o2);
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<float>(src[i]);
+  }
+}
+
+template <>
+inline void convert(const c10::Half* src, float* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + 16 <= n; i += 16) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    _mm512_storeu_ps(&dst[i], _mm512_cvtph_ps(a));
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<float>(src[i]);
+  }
+}
+
+template <>
+inline void convert(const float* src, c10::Half* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + 16 <= n; i += 16) {
+    __m256i a = _mm512_cvtps_ph(
+        _mm512_loadu_ps(&src[i]), (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[i]), a);
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<c10::Half>(src[i]);
+  }
+}
+
 template <>
 Vectorized<BFloat16> inline fmadd(const Vectorized<BFloat16>& a,
     const Vectorized<BFloat16>& b, const Vectorized<BFloat16>& c) {
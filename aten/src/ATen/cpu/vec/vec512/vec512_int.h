@@ -357,6 +357,27 @@ inline void convert(const int32_t *src, double *dst, int64_t n) {
   }
 }
 
+template <>
+inline void convert(const int64_t *src, float *dst, int64_t n) {
+  int64_t i;
+  // int64_t has twice the size of float; AVX512DQ (part of our AVX512
+  // baseline, see cmake/Codegen.cmake) narrows in a single instruction.
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (i = 0; i <= (n - Vectorized<int64_t>::size()); i += Vectorized<int64_t>::size()) {
+    auto input_vec = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(src + i));
+    auto output_vec = _mm512_cvtepi64_ps(input_vec);
+    _mm256_storeu_ps(reinterpret_cast<float*>(dst + i), output_vec);
+  }
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (; i < n; i++) {
+    dst[i] = static_cast<float>(src[i]);
+  }
+}
+
 template <>
 class Vectorized<int16_t> : public Vectorizedi {
 private:
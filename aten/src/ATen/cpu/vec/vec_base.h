@@ -219,6 +219,14 @@ public:
   void store(void* ptr, int count = size()) const {
     std::memcpy(ptr, values, count * sizeof(T));
   }
+  // Non-temporal (streaming) store of a full vector. ptr must be aligned to
+  // the vector width. Specializations with a streaming instruction bypass the
+  // cache; the generic case is an ordinary store. Callers must issue
+  // streaming_store_fence() once after a run of store_nt calls, before the
+  // stored data may be read by another thread.
+  void store_nt(void* ptr) const {
+    store(ptr);
+  }
   int zero_mask() const {
     // returns an integer mask where all zero elements are translated to 1-bit and others are translated to 0-bit
     int mask = 0;
@@ -1005,6 +1013,15 @@ interleave2(const Vectorized<T>& a, const Vectorized<T>& b) {
                         Vectorized<T>::loadu(static_cast<void*>(buffer2)));
 }
 
+// Orders non-temporal stores against later stores. Must be called once after
+// a run of Vectorized::store_nt calls; a no-op on targets whose store_nt is
+// an ordinary store.
+inline void streaming_store_fence() {
+#if defined(CPU_CAPABILITY_AVX2) || defined(CPU_CAPABILITY_AVX512)
+  _mm_sfence();
+#endif
+}
+
 template <typename src_T, typename dst_T>
 inline void convert(const src_T *src, dst_T *dst, int64_t n) {
 #ifndef _MSC_VER
@@ -0,0 +1,206 @@
+#include <ATen/cuda/BatchedTransfer.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CachingHostAllocator.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAStream.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace at {
+namespace cuda {
+
+namespace {
+
+// One entry per staged tensor: where its bytes start in the device
+// scratch buffer and where they need to end up.
+struct CopyDesc {
+  size_t src_offset;
+  char* dst;
+  size_t nbytes;
+};
+
+// Each staging buffer is shipped as one H2D memcpy; 32 MiB is large
+// enough to saturate the link while keeping pinned-memory pressure (and
+// the latency before the first scatter can start) bounded.
+constexpr size_t kStagingBytes = 32 * 1024 * 1024;
+
+// Tensors at or above this size get a direct cudaMemcpyAsync: one memcpy
+// per megabyte-sized tensor already runs near link speed, and staging
+// them would just double the host memory traffic.
+constexpr size_t kDirectCopyThreshold = 4 * 1024 * 1024;
+
+// Staging offsets are rounded up to this so that the scatter kernel can
+// use 16-byte loads from the scratch buffer.
+constexpr size_t kStagingAlignment = 16;
+
+__global__ void scatter_copy_kernel(
+    const CopyDesc* descs,
+    int64_t num_descs,
+    const char* scratch) {
+  for (int64_t i = blockIdx.x; i < num_descs; i += gridDim.x) {
+    const CopyDesc d = descs[i];
+    const char* src = scratch + d.src_offset;
+    char* dst = d.dst;
+    // src is 16-byte aligned by construction; dst usually is too, but a
+    // storage_offset can break that, so check before vectorizing.
+    if ((reinterpret_cast<uintptr_t>(dst) & (kStagingAlignment - 1)) == 0) {
+      const size_t num_vecs = d.nbytes / sizeof(uint4);
+      const uint4* src_vec = reinterpret_cast<const uint4*>(src);
+      uint4* dst_vec = reinterpret_cast<uint4*>(dst);
+      for (size_t j = threadIdx.x; j < num_vecs; j += blockDim.x) {
+        dst_vec[j] = src_vec[j];
+      }
+      for (size_t j = num_vecs * sizeof(uint4) + threadIdx.x; j < d.nbytes;
+           j += blockDim.x) {
+        dst[j] = src[j];
+      }
+    } else {
+      for (size_t j = threadIdx.x; j < d.nbytes; j += blockDim.x) {
+        dst[j] = src[j];
+      }
+    }
+  }
+}
+
+size_t align_up(size_t n, size_t alignment) {
+  return (n + alignment - 1) & ~(alignment - 1);
+}
+
+// Packs srcs[first..) into one pinned staging buffer, issues the H2D
+// memcpy and the scatter kernel, and returns the index one past the last
+// tensor staged.
+size_t stage_and_scatter(
+    at::TensorList dsts,
+    at::TensorList srcs,
+    size_t first,
+    c10::cuda::CUDAStream stream) {
+  // Greedily pack tensors until the staging buffer is full.
+  std::vector<CopyDesc> descs;
+  std::vector<const void*> staged_srcs;
+  size_t payload_bytes = 0;
+  size_t last = first;
+  while (last < srcs.size()) {
+    const size_t nbytes = srcs[last].nbytes();
+    if (nbytes == 0) {
+      ++last;
+      continue;
+    }
+    if (nbytes >= kDirectCopyThreshold) {
+      if (last == first) {
+        // Direct copy; the driver's own staging handles pageable memory.
+        C10_CUDA_CHECK(cudaMemcpyAsync(
+            dsts[last].data_ptr(),
+            srcs[last].data_ptr(),
+            nbytes,
+            cudaMemcpyHostToDevice,
+            stream));
+        return last + 1;
+      }
+      break;
+    }
+    const size_t offset = align_up(payload_bytes, kStagingAlignment);
+    if (offset + nbytes > kStagingBytes && !descs.empty()) {
+      break;
+    }
+    descs.push_back(CopyDesc{
+        offset, static_cast<char*>(dsts[last].data_ptr()), nbytes});
+    staged_srcs.push_back(srcs[last].data_ptr());
+    payload_bytes = offset + nbytes;
+    ++last;
+  }
+  if (descs.empty()) {
+    return last;
+  }
+
+  // The descriptor table rides along at the tail of the staging buffer so
+  // payload and descriptors cross the link in a single memcpy.
+  const size_t desc_offset = align_up(payload_bytes, kStagingAlignment);
+  const size_t desc_bytes = descs.size() * sizeof(CopyDesc);
+  const size_t total_bytes = desc_offset + desc_bytes;
+
+  at::DataPtr staging = HostAlloc(total_bytes);
+  auto* host = static_cast<char*>(staging.get());
+  for (const auto i : c10::irange(descs.size())) {
+    std::memcpy(host + descs[i].src_offset, staged_srcs[i], descs[i].nbytes);
+  }
+  std::memcpy(host + desc_offset, descs.data(), desc_bytes);
+
+  at::DataPtr scratch =
+      c10::cuda::CUDACachingAllocator::get()->allocate(total_bytes);
+  auto* device = static_cast<char*>(scratch.get());
+  C10_CUDA_CHECK(cudaMemcpyAsync(
+      device, host, total_bytes, cudaMemcpyHostToDevice, stream));
+  // Keep the pinned buffer out of the allocator's free list until the
+  // memcpy has actually read it.
+  CachingHostAllocator_recordEvent(staging.get(), staging.get_context(), stream);
+
+  const int64_t num_descs = static_cast<int64_t>(descs.size());
+  const int num_blocks =
+      static_cast<int>(std::min<int64_t>(num_descs, 4096));
+  scatter_copy_kernel<<<num_blocks, 256, 0, stream>>>(
+      reinterpret_cast<const CopyDesc*>(device + desc_offset),
+      num_descs,
+      device);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+  // scratch is freed here; the caching allocator's stream-ordered reuse
+  // keeps it alive for the kernel enqueued above.
+  return last;
+}
+
+} // namespace
+
+void batched_h2d_copy(
+    at::TensorList dsts,
+    at::TensorList srcs,
+    bool non_blocking) {
+  TORCH_CHECK(
+      dsts.size() == srcs.size(),
+      "batched_h2d_copy: expected matching destination and source counts, got ",
+      dsts.size(), " and ", srcs.size());
+  if (dsts.empty()) {
+    return;
+  }
+
+  const auto device = dsts[0].device();
+  TORCH_CHECK(
+      device.is_cuda(), "batched_h2d_copy: destinations must be CUDA tensors");
+  for (const auto i : c10::irange(dsts.size())) {
+    TORCH_CHECK(
+        dsts[i].device() == device,
+        "batched_h2d_copy: all destinations must be on the same device, got ",
+        dsts[i].device(), " and ", device);
+    TORCH_CHECK(
+        srcs[i].device().is_cpu(),
+        "batched_h2d_copy: sources must be CPU tensors");
+    TORCH_CHECK(
+        dsts[i].is_contiguous() && srcs[i].is_contiguous(),
+        "batched_h2d_copy: tensors must be contiguous (pair ", i, ")");
+    TORCH_CHECK(
+        dsts[i].sizes() == srcs[i].sizes() &&
+            dsts[i].scalar_type() == srcs[i].scalar_type(),
+        "batched_h2d_copy: destination/source mismatch at pair ", i, ": ",
+        dsts[i].sizes(), "/", dsts[i].scalar_type(), " vs ",
+        srcs[i].sizes(), "/", srcs[i].scalar_type());
+  }
+
+  c10::cuda::CUDAGuard device_guard(device);
+  auto stream = c10::cuda::getCurrentCUDAStream();
+
+  size_t next = 0;
+  while (next < srcs.size()) {
+    next = stage_and_scatter(dsts, srcs, next, stream);
+  }
+
+  if (!non_blocking) {
+    stream.synchronize();
+  }
+}
+
+} // namespace cuda
+} // namespace at
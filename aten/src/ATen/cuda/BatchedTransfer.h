@@ -0,0 +1,30 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+
+namespace at {
+namespace cuda {
+
+// Copies many small CPU tensors to CUDA with a single H2D transfer.
+//
+// Each (dsts[i], srcs[i]) pair must have the same sizes and dtype, srcs[i]
+// must be a contiguous CPU tensor and dsts[i] a contiguous tensor on a
+// single CUDA device.  Instead of issuing one cudaMemcpyAsync per pair
+// (which caps effective bandwidth at a fraction of link speed for
+// kilobyte-sized tensors), the sources are packed into large pinned
+// staging buffers from the caching host allocator, shipped across PCIe in
+// one memcpy per buffer, and scattered to their destinations by a single
+// device kernel.  Tensors too large to benefit from staging are copied
+// directly.
+//
+// All device work is enqueued on the current stream.  With
+// non_blocking=false the current stream is synchronized before returning;
+// otherwise the copies follow the usual stream-ordering rules and the
+// pinned staging memory is recycled via CachingHostAllocator_recordEvent.
+TORCH_CUDA_CU_API void batched_h2d_copy(
+    at::TensorList dsts,
+    at::TensorList srcs,
+    bool non_blocking = true);
+
+} // namespace cuda
+} // namespace at
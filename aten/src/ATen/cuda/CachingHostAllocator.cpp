@@ -5,12 +5,14 @@
 #include <ATen/cuda/detail/CUDAHooks.h>
 #include <ATen/detail/CUDAHooksInterface.h>
 
+#include <c10/util/llvmMathExtras.h>
+
 #include <cuda_runtime_api.h>
 #include <stdint.h>
+#include <array>
 #include <deque>
 #include <memory>
 #include <mutex>
-#include <set>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -19,11 +21,6 @@ namespace at {
 namespace cuda {
 namespace {
 
-struct BlockSize {
-  size_t size_{0};
-  void* ptr_{nullptr};
-};
-
 struct Block {
   size_t size_{0};
   void* ptr_{nullptr};
@@ -87,37 +84,12 @@ class EventPool {
   std::vector<PerDevicePool> pools_;
 };
 
-// Used for heterogenous lookup support in the free list.
-struct BlockComparator {
-  using is_transparent = void;
-  bool operator()(const Block* a, const Block* b) const {
-    if (a->size_ != b->size_) {
-      return a->size_ < b->size_;
-    }
-    return (uintptr_t)a->ptr_ < (uintptr_t)b->ptr_;
-  }
-
-  // Transparent overloads
-  bool operator()(const Block* a, BlockSize b) const {
-    if (a->size_ != b.size_) {
-      return a->size_ < b.size_;
-    }
-    return (uintptr_t)a->ptr_ < (uintptr_t)b.ptr_;
-  }
-  bool operator()(BlockSize a, const Block* b) const {
-    if (a.size_ != b->size_) {
-      return a.size_ < b->size_;
-    }
-    return (uintptr_t)a.ptr_ < (uintptr_t)b->ptr_;
-  }
-};
-
 /**
  * Note [CUDAHostAllocator design]
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
- * We have three key data structures - the free list which stores blocks that
- * are not currently used, the block list which stores all blocks that have been
- * allocated, and the event queue which stores CUDA events and their
+ * We have three key data structures - the free lists which store blocks that
+ * are not currently used, the block list which stores all blocks that have
+ * been allocated, and the event queue which stores CUDA events and their
  * corresponding blocks.
  *
  * Each of these are protected by a separate mutex. The key design principles
@@ -125,6 +97,13 @@ struct BlockComparator {
  * never do any possible expensive operations (such as CUDA runtime API calls)
  * while holding the lock.
  *
+ * Because all allocations are rounded up to the next power of two, the free
+ * list is sharded into one list (with its own mutex) per size class. A thread
+ * pinning a batch therefore only contends with threads allocating the same
+ * size class, rather than with every other producer/consumer thread, which is
+ * what made the previous single free-list mutex collapse with many DataLoader
+ * workers plus copy threads pinning concurrently.
+ *
  * There are three public methods: allocate, free, and record_event. In the
  * allocate path, we first check to see if we can service our request from this
  * free list, and otherwise we create a new block with cudaHostAlloc. In the
@@ -132,9 +111,12 @@ struct BlockComparator {
  * possible insert our block back into the free list. In allocate, we first
  * eagerly query events until we find one that is not ready, and insert the
  * corresponding block onto the free list if all the events recorded for a
- * block are ready. In the record_event path, we simply insert the given
- * stream into the set of streams tracked by the specified block. This set of
- * streams is then consumed in the free path.
+ * block are ready. Event queries are batched: the pending-event queue is
+ * swapped out wholesale under its lock and processed outside of it, so the
+ * queue mutex is taken once per allocation rather than once per event. In the
+ * record_event path, we simply insert the given stream into the set of
+ * streams tracked by the specified block. This set of streams is then
+ * consumed in the free path.
  *
  * Some of the invariants here are less strict than they could be - for example,
  * we do not enforce that free(Block* block) => block->event_count == 0. This is
@@ -150,14 +132,17 @@ class CUDAHostAllocator {
 
     process_events();
 
-    // First, try to allocate from the free list
+    // Round up the allocation to the nearest power of two to improve reuse.
+    const size_t round_size = c10::llvm::PowerOf2Ceil(size);
+
+    // First, try to allocate from the free list for this size class.
     {
-      std::lock_guard<std::mutex> g(free_list_mutex_);
-      auto it = free_list_.lower_bound(BlockSize{size, nullptr});
-      if (it != free_list_.end()) {
-        auto block = *it;
+      auto& shard = free_list_[size_index(round_size)];
+      std::lock_guard<std::mutex> g(shard.mutex_);
+      if (!shard.list_.empty()) {
+        auto* block = shard.list_.back();
+        shard.list_.pop_back();
         block->allocated_ = true;
-        free_list_.erase(it);
         return {block->ptr_, reinterpret_cast<void*>(block)};
       }
     }
@@ -174,12 +159,10 @@ class CUDAHostAllocator {
           at::Device(at::DeviceType::CUDA, *primary_ctx_device_index));
     }
 
-    // Round up the allocation to the nearest power of two to improve reuse.
     void* ptr = nullptr;
-    C10_CUDA_CHECK(cudaHostAlloc(
-        &ptr, c10::llvm::PowerOf2Ceil(size), cudaHostAllocDefault));
+    C10_CUDA_CHECK(cudaHostAlloc(&ptr, round_size, cudaHostAllocDefault));
     auto block = new Block();
-    block->size_ = c10::llvm::PowerOf2Ceil(size);
+    block->size_ = round_size;
     block->ptr_ = ptr;
     block->allocated_ = true;
 
@@ -220,8 +203,9 @@ class CUDAHostAllocator {
     }
 
     if (!events) {
-      std::lock_guard<std::mutex> g(free_list_mutex_);
-      free_list_.insert(block);
+      auto& shard = free_list_[size_index(block->size_)];
+      std::lock_guard<std::mutex> g(shard.mutex_);
+      shard.list_.push_back(block);
     } else {
       std::lock_guard<std::mutex> g(cuda_events_mutex_);
       for (auto&& event : *events) {
@@ -267,16 +251,18 @@ class CUDAHostAllocator {
     // Release cached events from the event pool.
     event_pool_.empty_cache();
 
-    // Remove all elements from the free list, remove them from the blocks
-    // list, and free the associated pinned memory allocation. This requires
-    // concurrently holding both the free list mutex and the blocks mutex, and
-    // is the only function that concurrently holds multiple mutexes.
-    std::lock(free_list_mutex_, blocks_mutex_);
-    std::lock_guard<std::mutex> gf(free_list_mutex_, std::adopt_lock);
-    std::lock_guard<std::mutex> gb(blocks_mutex_, std::adopt_lock);
-
-    std::vector<Block*> blocks_to_remove(free_list_.begin(), free_list_.end());
-    free_list_.clear();
+    // Remove all elements from the free lists, remove them from the blocks
+    // list, and free the associated pinned memory allocation. Draining a
+    // shard first makes its blocks unreachable from allocate(), so the
+    // blocks-list cleanup below doesn't need to hold the shard mutex.
+    std::vector<Block*> blocks_to_remove;
+    for (auto& shard : free_list_) {
+      std::lock_guard<std::mutex> g(shard.mutex_);
+      blocks_to_remove.insert(
+          blocks_to_remove.end(), shard.list_.begin(), shard.list_.end());
+      shard.list_.clear();
+    }
+    std::lock_guard<std::mutex> gb(blocks_mutex_);
     for (auto* block : blocks_to_remove) {
       blocks_.erase(block);
       ptr_to_block_.erase(block->ptr_);
@@ -287,46 +273,40 @@ class CUDAHostAllocator {
 
  private:
   void process_events() {
-    while (true) {
-      // Avoid calling cudaEventDestroy while holding a mutex, so move
-      // intermediate events out of the lock into this object.
-      c10::optional<std::pair<EventPool::Event, Block*>> processed;
+    // Swap out the entire pending-event queue under one lock acquisition;
+    // the (potentially expensive) cudaEventQuery calls then run without
+    // holding any allocator mutex, and concurrent allocating threads don't
+    // serialize on per-event queue locking.
+    std::deque<std::pair<EventPool::Event, Block*>> pending;
+    {
+      std::lock_guard<std::mutex> g(cuda_events_mutex_);
+      std::swap(pending, cuda_events_);
+    }
 
-      {
+    while (!pending.empty()) {
+      auto processed = std::move(pending.back());
+      pending.pop_back();
+
+      // now, see if we can handle this element
+      auto& event = processed.first;
+      cudaError_t err = cudaEventQuery(*event);
+      if (err == cudaErrorNotReady) {
+        cudaGetLastError();
+        // Events are processed oldest-first; if this one isn't ready, the
+        // younger ones recorded behind it on the same streams won't be
+        // either, so requeue everything still pending and stop.
+        pending.push_back(std::move(processed));
         std::lock_guard<std::mutex> g(cuda_events_mutex_);
-        if (!cuda_events_.empty()) {
-          processed = std::move(cuda_events_.back());
-          cuda_events_.pop_back();
+        for (auto& remaining : pending) {
+          cuda_events_.push_back(std::move(remaining));
         }
-      }
-
-      if (!processed) {
         return;
-      }
-
-      // otherwise, query the event
-      {
-        // now, see if we can handle this element
-        auto& event = processed->first;
-        cudaError_t err = cudaEventQuery(*event);
-        if (err == cudaErrorNotReady) {
-          cudaGetLastError();
-          // push the event onto the back of the queue if it's not
-          // ready. TODO: do we need some debouncing logic to avoid allocating
-          // threads repeatedly spinning on an event?
-          {
-            std::lock_guard<std::mutex> g(cuda_events_mutex_);
-            cuda_events_.push_back(std::move(*processed));
-          }
-          return;
-        } else if (err != cudaSuccess) {
-          C10_CUDA_CHECK(err);
-        }
+      } else if (err != cudaSuccess) {
+        C10_CUDA_CHECK(err);
       }
 
       // Process the events.
-      TORCH_INTERNAL_ASSERT(processed);
-      auto* block = processed->second;
+      auto* block = processed.second;
       bool available = false;
       {
         std::lock_guard<std::mutex> g(block->mutex_);
@@ -338,23 +318,34 @@ class CUDAHostAllocator {
       }
 
       if (available) {
-        std::lock_guard<std::mutex> g(free_list_mutex_);
-        free_list_.insert(block);
+        auto& shard = free_list_[size_index(block->size_)];
+        std::lock_guard<std::mutex> g(shard.mutex_);
+        shard.list_.push_back(block);
       }
     }
   }
 
+  // All allocations are power-of-two sized, so the free list shard for a
+  // block is simply the log2 of its size.
+  static size_t size_index(size_t size) {
+    return c10::llvm::Log2_64_Ceil(size);
+  }
+
+  // One free list (and mutex) per power-of-two size class.
+  static constexpr size_t kNumSizeClasses = 64;
+
+  struct alignas(64) FreeList {
+    std::mutex mutex_;
+    std::vector<Block*> list_;
+  };
+
   EventPool event_pool_;
 
   alignas(64) std::mutex blocks_mutex_;
   std::unordered_set<Block*> blocks_;
   std::unordered_map<void*, Block*> ptr_to_block_;
-  // Note: sharding this mutex seems to be profitable in heavily multi-threaded
-  // scenarios.
-  alignas(64) std::mutex free_list_mutex_;
-  // Note: an alternative datastructure can yield significant wins here in
-  // microbenchmarks.
-  std::set<Block*, BlockComparator> free_list_;
+
+  std::array<FreeList, kNumSizeClasses> free_list_;
 
   alignas(64) std::mutex cuda_events_mutex_;
   std::deque<std::pair<EventPool::Event, Block*>> cuda_events_;
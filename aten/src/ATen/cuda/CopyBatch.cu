@@ -0,0 +1,204 @@
+#include <ATen/cuda/CopyBatch.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAEvent.h>
+#include <ATen/cuda/PeerToPeerAccess.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAStream.h>
+#include <c10/util/irange.h>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace at {
+namespace cuda {
+
+namespace {
+
+struct PendingCopy {
+  // Hold tensor refs so the storages survive until the flush.
+  at::Tensor dst;
+  at::Tensor src;
+  char* dst_ptr;
+  const char* src_ptr;
+  size_t nbytes;
+};
+
+struct CopyBatchState {
+  int depth = 0;
+  std::vector<PendingCopy> pending;
+};
+
+CopyBatchState& copy_batch_state() {
+  static thread_local CopyBatchState state;
+  return state;
+}
+
+// The chunk table is passed by kernel argument, so one launch covers up
+// to kMaxChunksPerLaunch staged copies with no descriptor upload.
+constexpr int kMaxChunksPerLaunch = 64;
+
+struct CopyChunk {
+  const char* src;
+  char* dst;
+  size_t nbytes;
+};
+
+struct CopyChunkArgs {
+  CopyChunk chunks[kMaxChunksPerLaunch];
+  int num_chunks;
+};
+
+__global__ void copy_batch_kernel(CopyChunkArgs args) {
+  for (int i = blockIdx.x; i < args.num_chunks; i += gridDim.x) {
+    const CopyChunk chunk = args.chunks[i];
+    const char* src = chunk.src;
+    char* dst = chunk.dst;
+    // Use 16-byte accesses when both ends allow it; a storage_offset can
+    // break alignment, so check rather than assume.
+    if (((reinterpret_cast<uintptr_t>(src) |
+          reinterpret_cast<uintptr_t>(dst)) & (sizeof(uint4) - 1)) == 0) {
+      const size_t num_vecs = chunk.nbytes / sizeof(uint4);
+      const uint4* src_vec = reinterpret_cast<const uint4*>(src);
+      uint4* dst_vec = reinterpret_cast<uint4*>(dst);
+      for (size_t j = threadIdx.x; j < num_vecs; j += blockDim.x) {
+        dst_vec[j] = src_vec[j];
+      }
+      for (size_t j = num_vecs * sizeof(uint4) + threadIdx.x; j < chunk.nbytes;
+           j += blockDim.x) {
+        dst[j] = src[j];
+      }
+    } else {
+      for (size_t j = threadIdx.x; j < chunk.nbytes; j += blockDim.x) {
+        dst[j] = src[j];
+      }
+    }
+  }
+}
+
+// Issues one direction's staged copies on the source device's current
+// stream, with the same two-way event barrier copy_device_to_device uses
+// for a single cross-device copy -- but paid once per direction.
+void flush_direction(
+    const std::vector<const PendingCopy*>& group,
+    DeviceIndex src_index,
+    DeviceIndex dst_index) {
+  c10::cuda::CUDAGuard device_guard(src_index);
+  auto copy_stream = c10::cuda::getCurrentCUDAStream(src_index);
+
+  // src waits on dst barrier so nothing is still using the dst memory.
+  CUDAEvent dst_ready;
+  device_guard.set_index(dst_index);
+  dst_ready.record(c10::cuda::getCurrentCUDAStream(dst_index));
+  device_guard.set_index(src_index);
+  dst_ready.block(copy_stream);
+
+  const bool p2p_enabled = at::cuda::get_p2p_access(src_index, dst_index);
+#ifdef USE_ROCM
+  const bool needs_pool_specific_peer_access = false;
+#else
+  const bool needs_pool_specific_peer_access =
+      c10::cuda::CUDACachingAllocator::get()->needsPoolSpecificPeerAccess();
+#endif
+
+  if (p2p_enabled) {
+    // One fused launch per kMaxChunksPerLaunch copies; the kernel writes
+    // the peer device's memory directly.
+    size_t next = 0;
+    while (next < group.size()) {
+      CopyChunkArgs args;
+      args.num_chunks = 0;
+      for (; args.num_chunks < kMaxChunksPerLaunch && next < group.size();
+           ++next) {
+        const PendingCopy* copy = group[next];
+        args.chunks[args.num_chunks++] =
+            CopyChunk{copy->src_ptr, copy->dst_ptr, copy->nbytes};
+      }
+      copy_batch_kernel<<<args.num_chunks, 256, 0, copy_stream>>>(args);
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+    }
+  } else {
+    // No peer access: fall back to back-to-back async memcpys, which still
+    // amortizes the event barriers across the whole direction.
+    for (const PendingCopy* copy : group) {
+      if (needs_pool_specific_peer_access) {
+        // See the note about cudaMallocAsynced memory in
+        // native/cuda/Copy.cu's copy_device_to_device.
+        C10_CUDA_CHECK(cudaMemcpyPeerAsync(
+            copy->dst_ptr, dst_index,
+            copy->src_ptr, src_index,
+            copy->nbytes, copy_stream));
+      } else {
+        C10_CUDA_CHECK(cudaMemcpyAsync(
+            copy->dst_ptr, copy->src_ptr, copy->nbytes,
+            cudaMemcpyDeviceToDevice, copy_stream));
+      }
+    }
+  }
+
+  // dst waits on src barrier before anyone consumes the copied memory.
+  CUDAEvent src_ready;
+  src_ready.record(copy_stream);
+  device_guard.set_index(dst_index);
+  src_ready.block(c10::cuda::getCurrentCUDAStream(dst_index));
+}
+
+} // namespace
+
+CopyBatchGuard::CopyBatchGuard() {
+  ++copy_batch_state().depth;
+}
+
+CopyBatchGuard::~CopyBatchGuard() noexcept(false) {
+  auto& state = copy_batch_state();
+  if (--state.depth == 0 && !state.pending.empty()) {
+    detail::copy_batch_flush();
+  }
+}
+
+namespace detail {
+
+bool copy_batch_active() {
+  return copy_batch_state().depth > 0;
+}
+
+void copy_batch_enqueue(
+    const at::Tensor& dst,
+    const at::Tensor& src,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t nbytes) {
+  copy_batch_state().pending.push_back(PendingCopy{
+      dst,
+      src,
+      static_cast<char*>(dst_ptr),
+      static_cast<const char*>(src_ptr),
+      nbytes});
+}
+
+void copy_batch_flush() {
+  auto& state = copy_batch_state();
+  auto pending = std::move(state.pending);
+  state.pending.clear();
+
+  // Group by direction, preserving issue order within each group.
+  std::map<std::pair<DeviceIndex, DeviceIndex>, std::vector<const PendingCopy*>>
+      directions;
+  for (const PendingCopy& copy : pending) {
+    directions[std::make_pair(
+                   copy.src.device().index(), copy.dst.device().index())]
+        .push_back(&copy);
+  }
+  for (const auto& direction : directions) {
+    flush_direction(
+        direction.second, direction.first.first, direction.first.second);
+  }
+  C10_CUDA_CHECK(cudaGetLastError());
+}
+
+} // namespace detail
+} // namespace cuda
+} // namespace at
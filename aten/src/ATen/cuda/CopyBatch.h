@@ -0,0 +1,51 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+
+namespace at {
+namespace cuda {
+
+// Coalesces small cross-GPU copies issued inside a scope into batched
+// transfers.
+//
+// While a CopyBatchGuard is alive on the current thread, eligible
+// device-to-device copies made through Tensor::copy_ / Tensor::to
+// (non-blocking, contiguous, between distinct CUDA devices, with no
+// dtype/conj/neg conversion) are staged instead of issued. When the
+// outermost guard exits, the staged copies are grouped by (source device,
+// destination device) direction; each group pays one CUDA event barrier
+// pair instead of one per copy, and is issued as a handful of fused
+// kernel launches when peer access is available (back-to-back async
+// memcpys otherwise). Ineligible copies are performed eagerly as usual.
+//
+// Deferral changes when the copies are enqueued, so inside the scope the
+// usual stream-ordering guarantees do not hold: sources must not be
+// mutated and destinations must not be read until the guard is destroyed.
+struct TORCH_CUDA_CU_API CopyBatchGuard {
+  CopyBatchGuard();
+  ~CopyBatchGuard() noexcept(false);
+  CopyBatchGuard(const CopyBatchGuard&) = delete;
+  CopyBatchGuard& operator=(const CopyBatchGuard&) = delete;
+};
+
+namespace detail {
+
+// True when a CopyBatchGuard is alive on this thread.
+TORCH_CUDA_CU_API bool copy_batch_active();
+
+// Stages one eligible copy. The tensors keep the storages alive until the
+// flush; the pointers are captured here because the caller's
+// TensorIterator has already resolved storage offsets.
+TORCH_CUDA_CU_API void copy_batch_enqueue(
+    const at::Tensor& dst,
+    const at::Tensor& src,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t nbytes);
+
+// Issues all staged copies; called by the outermost guard's destructor.
+TORCH_CUDA_CU_API void copy_batch_flush();
+
+} // namespace detail
+} // namespace cuda
+} // namespace at
@@ -15,6 +15,11 @@
 
 #include <c10/core/ScalarType.h>
 #include <c10/util/MaybeOwned.h>
+#include <c10/util/hash.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <mkl_spblas.h>
 
@@ -145,6 +150,87 @@ class MklSparseCsrDescriptor
   c10::MaybeOwned<Tensor> values_;
 };
 
+// Note [MKL sparse descriptor reuse]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// mkl_sparse_optimize lets MKL's inspector tune the matrix layout for repeated
+// multiplication, but the tuning only pays off if the handle outlives a single
+// call; workloads like GNN inference multiply by the same adjacency matrix
+// thousands of times. Descriptors are therefore cached keyed on the
+// indices/values data pointers plus their version counters, so in-place
+// updates (which bump the version) or reallocated storage naturally miss.
+// Each cached entry retains the source tensor to keep the buffers the MKL
+// handle points into alive. The cache is bounded and simply cleared when full.
+struct CsrDescriptorCacheKey {
+  const void* crow_indices_ptr;
+  const void* values_ptr;
+  uint64_t crow_indices_version;
+  uint64_t values_version;
+
+  bool operator==(const CsrDescriptorCacheKey& other) const {
+    return crow_indices_ptr == other.crow_indices_ptr &&
+        values_ptr == other.values_ptr &&
+        crow_indices_version == other.crow_indices_version &&
+        values_version == other.values_version;
+  }
+};
+
+struct CsrDescriptorCacheKeyHash {
+  size_t operator()(const CsrDescriptorCacheKey& key) const {
+    auto hash = std::hash<const void*>()(key.crow_indices_ptr);
+    hash = c10::hash_combine(hash, std::hash<const void*>()(key.values_ptr));
+    hash = c10::hash_combine(hash, std::hash<uint64_t>()(key.crow_indices_version));
+    hash = c10::hash_combine(hash, std::hash<uint64_t>()(key.values_version));
+    return hash;
+  }
+};
+
+template <typename scalar_t>
+std::shared_ptr<MklSparseCsrDescriptor<scalar_t>> get_cached_csr_descriptor(
+    const Tensor& input) {
+  struct CacheEntry {
+    std::shared_ptr<MklSparseCsrDescriptor<scalar_t>> descriptor;
+    Tensor source;
+  };
+  constexpr size_t kMaxCachedDescriptors = 64;
+  static std::mutex mutex;
+  static std::unordered_map<
+      CsrDescriptorCacheKey,
+      CacheEntry,
+      CsrDescriptorCacheKeyHash>
+      cache;
+
+  auto crow_indices = input.crow_indices();
+  auto values = input.values();
+  CsrDescriptorCacheKey key{
+      crow_indices.data_ptr(),
+      values.data_ptr(),
+      crow_indices.unsafeGetTensorImpl()->version_counter().current_version(),
+      values.unsafeGetTensorImpl()->version_counter().current_version()};
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    return it->second.descriptor;
+  }
+  if (cache.size() >= kMaxCachedDescriptors) {
+    cache.clear();
+  }
+  auto descriptor = std::make_shared<MklSparseCsrDescriptor<scalar_t>>(input);
+  // run the inspector once so reuses get the tuned handle; hints are not
+  // supported for every matrix configuration, and that's fine
+  matrix_descr descr;
+  descr.type = SPARSE_MATRIX_TYPE_GENERAL;
+  sparse_status_t status = mkl_sparse_set_mv_hint(
+      descriptor->descriptor(), SPARSE_OPERATION_NON_TRANSPOSE, descr, 1000);
+  if (status == SPARSE_STATUS_SUCCESS) {
+    status = mkl_sparse_optimize(descriptor->descriptor());
+  }
+  TORCH_INTERNAL_ASSERT(
+      status == SPARSE_STATUS_SUCCESS || status == SPARSE_STATUS_NOT_SUPPORTED);
+  cache.emplace(key, CacheEntry{descriptor, input});
+  return descriptor;
+}
+
 } // namespace sparse
 } // namespace mkl
 } // namespace at
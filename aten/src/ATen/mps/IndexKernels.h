@@ -296,6 +296,150 @@ kernel void index_put_accumulate_native_dtypes<atomic_int, int>(
     constant uint    & num_dimensions [[buffer(8)]],
     constant packed_uint3 * strides   [[buffer(9)]],
     uint thread_index [[thread_position_in_grid]]);
+
+// The dim-wise kernels below operate on contiguous tensors and bypass
+// MPSGraph construction entirely; see the dispatch*DimKernel() helpers in
+// native/mps/operations/Indexing.mm and ScatterGather.mm.
+
+template<typename T, typename IdxT>
+kernel void index_select_dim(
+    constant T        * input        [[buffer(0)]],
+    device   T        * output       [[buffer(1)]],
+    constant IdxT     * indices      [[buffer(2)]],
+    constant uint32_t & dim_size     [[buffer(3)]],
+    constant uint32_t & inner_size   [[buffer(4)]],
+    constant uint32_t & num_indices  [[buffer(5)]],
+    uint thread_index [[thread_position_in_grid]]) {
+    const uint32_t inner = thread_index % inner_size;
+    const uint32_t sel   = (thread_index / inner_size) % num_indices;
+    const uint32_t outer = thread_index / (inner_size * num_indices);
+    IdxT index = indices[sel];
+    if (index < 0) {
+        index += dim_size;
+    }
+    output[thread_index] = input[(outer * dim_size + (uint32_t)index) * inner_size + inner];
+}
+
+#define REGISTER_INDEX_SELECT_DIM_OP(DTYPE_SIZE, DTYPE, IDX_SIZE, IDX_DTYPE)  \
+template                                                                      \
+[[host_name("index_select_dim_" #DTYPE_SIZE "_" #IDX_SIZE)]]                  \
+kernel void index_select_dim<DTYPE, IDX_DTYPE>(                               \
+    constant DTYPE     * input        [[buffer(0)]],                          \
+    device   DTYPE     * output       [[buffer(1)]],                          \
+    constant IDX_DTYPE * indices      [[buffer(2)]],                          \
+    constant uint32_t  & dim_size     [[buffer(3)]],                          \
+    constant uint32_t  & inner_size   [[buffer(4)]],                          \
+    constant uint32_t  & num_indices  [[buffer(5)]],                          \
+    uint thread_index [[thread_position_in_grid]]);
+
+#define REGISTER_INDEX_SELECT_DIM_ALL_DTYPES(IDX_SIZE, IDX_DTYPE)       \
+    REGISTER_INDEX_SELECT_DIM_OP(8bit,  char,  IDX_SIZE, IDX_DTYPE);    \
+    REGISTER_INDEX_SELECT_DIM_OP(16bit, short, IDX_SIZE, IDX_DTYPE);    \
+    REGISTER_INDEX_SELECT_DIM_OP(32bit, int,   IDX_SIZE, IDX_DTYPE);    \
+    REGISTER_INDEX_SELECT_DIM_OP(64bit, long,  IDX_SIZE, IDX_DTYPE);
+
+REGISTER_INDEX_SELECT_DIM_ALL_DTYPES(idx32, int);
+REGISTER_INDEX_SELECT_DIM_ALL_DTYPES(idx64, long);
+
+template<typename T>
+kernel void gather_dim(
+    constant T        * input         [[buffer(0)]],
+    device   T        * output        [[buffer(1)]],
+    constant long     * indices       [[buffer(2)]],
+    constant uint32_t * iter_sizes    [[buffer(3)]],
+    constant uint32_t * input_strides [[buffer(4)]],
+    constant uint32_t & num_dims      [[buffer(5)]],
+    constant uint32_t & dim           [[buffer(6)]],
+    constant uint32_t & dim_size      [[buffer(7)]],
+    uint thread_index [[thread_position_in_grid]]) {
+    long index = indices[thread_index];
+    if (index < 0) {
+        index += dim_size;
+    }
+    uint32_t idx = thread_index;
+    uint32_t input_offset = 0;
+    for (uint32_t i = num_dims; i > 0; i--) {
+        const uint32_t d = i - 1;
+        const uint32_t coord = idx % iter_sizes[d];
+        idx /= iter_sizes[d];
+        input_offset += (d == dim ? (uint32_t)index : coord) * input_strides[d];
+    }
+    output[thread_index] = input[input_offset];
+}
+
+template<typename T>
+kernel void scatter_dim(
+    constant T        * src            [[buffer(0)]],
+    device   T        * output         [[buffer(1)]],
+    constant long     * indices        [[buffer(2)]],
+    constant uint32_t * iter_sizes     [[buffer(3)]],
+    constant uint32_t * output_strides [[buffer(4)]],
+    constant uint32_t & num_dims       [[buffer(5)]],
+    constant uint32_t & dim            [[buffer(6)]],
+    constant uint32_t & dim_size       [[buffer(7)]],
+    uint thread_index [[thread_position_in_grid]]) {
+    long index = indices[thread_index];
+    if (index < 0) {
+        index += dim_size;
+    }
+    uint32_t idx = thread_index;
+    uint32_t output_offset = 0;
+    for (uint32_t i = num_dims; i > 0; i--) {
+        const uint32_t d = i - 1;
+        const uint32_t coord = idx % iter_sizes[d];
+        idx /= iter_sizes[d];
+        output_offset += (d == dim ? (uint32_t)index : coord) * output_strides[d];
+    }
+    output[output_offset] = src[thread_index];
+}
+
+#define REGISTER_GATHER_SCATTER_DIM_OP(DTYPE_SIZE, DTYPE, OP_TYPE)  \
+template                                                            \
+[[host_name(#OP_TYPE "_dim_" #DTYPE_SIZE)]]                         \
+kernel void OP_TYPE ## _dim<DTYPE>(                                 \
+    constant DTYPE    * src            [[buffer(0)]],               \
+    device   DTYPE    * output         [[buffer(1)]],               \
+    constant long     * indices        [[buffer(2)]],               \
+    constant uint32_t * iter_sizes     [[buffer(3)]],               \
+    constant uint32_t * strides        [[buffer(4)]],               \
+    constant uint32_t & num_dims       [[buffer(5)]],               \
+    constant uint32_t & dim            [[buffer(6)]],               \
+    constant uint32_t & dim_size       [[buffer(7)]],               \
+    uint thread_index [[thread_position_in_grid]]);
+
+#define REGISTER_GATHER_SCATTER_DIM_ALL_DTYPES(OP_TYPE)        \
+    REGISTER_GATHER_SCATTER_DIM_OP(8bit,  char,  OP_TYPE);     \
+    REGISTER_GATHER_SCATTER_DIM_OP(16bit, short, OP_TYPE);     \
+    REGISTER_GATHER_SCATTER_DIM_OP(32bit, int,   OP_TYPE);     \
+    REGISTER_GATHER_SCATTER_DIM_OP(64bit, long,  OP_TYPE);
+
+REGISTER_GATHER_SCATTER_DIM_ALL_DTYPES(gather);
+REGISTER_GATHER_SCATTER_DIM_ALL_DTYPES(scatter);
+
+template<typename T>
+kernel void masked_fill_scalar(
+    device   T    * input  [[buffer(0)]],
+    constant bool * mask   [[buffer(1)]],
+    constant T    & value  [[buffer(2)]],
+    uint thread_index [[thread_position_in_grid]]) {
+    if (mask[thread_index]) {
+        input[thread_index] = value;
+    }
+}
+
+#define REGISTER_MASKED_FILL_OP(DTYPE_SIZE, DTYPE)       \
+template                                                 \
+[[host_name("masked_fill_scalar_" #DTYPE_SIZE)]]         \
+kernel void masked_fill_scalar<DTYPE>(                   \
+    device   DTYPE * input  [[buffer(0)]],               \
+    constant bool  * mask   [[buffer(1)]],               \
+    constant DTYPE & value  [[buffer(2)]],               \
+    uint thread_index [[thread_position_in_grid]]);
+
+REGISTER_MASKED_FILL_OP(8bit,  char);
+REGISTER_MASKED_FILL_OP(16bit, short);
+REGISTER_MASKED_FILL_OP(32bit, int);
+REGISTER_MASKED_FILL_OP(64bit, long);
 )INDEX_METAL";
 
 static const char *SCATTER_OPS_TEMPLATE = R"METAL_SCATTER(
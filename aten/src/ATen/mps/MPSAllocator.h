@@ -4,9 +4,12 @@
 
 #include <ATen/mps/MPSAllocatorInterface.h>
 #include <ATen/mps/MPSStream.h>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <mutex>
 #include <set>
+#include <thread>
 #include <mach/vm_page_size.h>
 #include <c10/util/flat_hash_map.h>
 
@@ -62,6 +65,9 @@ struct BufferBlock
   // counter to candidate least recently used buffers for garbage collection
   uint32_t gc_count;
   uint32_t use_count;
+  // when the buffer was last returned to its pool; used by the background
+  // ager to find buffers that have gone cold (see m_buffer_idle_timeout)
+  std::chrono::steady_clock::time_point last_free_time;
   // counter to assign unique ids to buffer blocks
   static uint64_t buffer_counter;
 
@@ -247,6 +253,7 @@ public:
     init_allocator();
   }
   ~MPSHeapAllocatorImpl() {
+    stop_ager_thread();
     // make sure completion handlers are finished before destruction
     m_stream->synchronize(SyncType::COMMIT_AND_WAIT);
   }
@@ -343,6 +350,19 @@ private:
   uint32_t m_debug_verbosity;
   // default MPS stream
   MPSStream* m_stream;
+  // how long (in seconds) a cached buffer may sit idle in its pool before the
+  // background ager releases it along with any heap it empties. Zero disables
+  // the ager. Use "PYTORCH_MPS_BUFFER_IDLE_TIMEOUT" env-var to set this.
+  double m_buffer_idle_timeout;
+  // background thread that periodically releases cold cached buffers; only
+  // started when m_buffer_idle_timeout > 0 (see Note [MPS allocator ager])
+  std::thread m_ager_thread;
+  std::mutex m_ager_mutex;
+  std::condition_variable m_ager_cv;
+  bool m_ager_stop = false;
+  // tracks crossings of the low watermark so pressure callbacks fire once
+  // per crossing instead of on every allocation under pressure
+  bool m_memory_pressure_notified = false;
 
   void init_allocator();
   HeapBlock* get_free_heap(AllocParams& params);
@@ -358,6 +378,16 @@ private:
   bool release_cached_buffers();
   // free unused cached blocks to reclaim GPU memory if memory pressure is high
   void garbage_collect_cached_buffers(AllocParams& params);
+  // releases cached buffers that have been idle in their pools longer than
+  // m_buffer_idle_timeout (along with heaps they empty)
+  void trim_idle_buffers();
+  void ager_thread_loop();
+  void stop_ager_thread();
+  // fires registered IMpsMemoryPressureCallback's; always returns true so it
+  // can participate in the alloc fallback chain like trigger_memory_callbacks
+  bool trigger_pressure_callbacks(IMpsMemoryPressureCallback::PressureLevel level, size_t limit) const;
+  // fires LOW_WATERMARK callbacks on the transition into memory pressure
+  void update_memory_pressure_state(bool has_pressure);
 
   BufferPool& get_pool(size_t Size, uint32_t usage) {
     if (usage & UsageFlags::SCALAR) {
@@ -4,12 +4,14 @@
 #include <c10/core/Allocator.h>
 #include <c10/core/Storage.h>
 #include <ATen/CPUFunctions.h>
+#include <algorithm>
 #include <iostream>
 
 namespace at {
 namespace mps {
 
 C10_DEFINE_REGISTRY(MPSAllocatorCallbacksRegistry, IMpsAllocatorCallback);
+C10_DEFINE_REGISTRY(MPSMemoryPressureCallbacksRegistry, IMpsMemoryPressureCallback);
 
 namespace HeapAllocator {
 
@@ -31,6 +33,93 @@ void MPSHeapAllocatorImpl::init_allocator() {
   static const char *low_watermark_ratio_str = getenv("PYTORCH_MPS_LOW_WATERMARK_RATIO");
   const double low_watermark_ratio = low_watermark_ratio_str ? strtod(low_watermark_ratio_str, nullptr) : default_low_watermark_ratio;
   setLowWatermarkRatio(low_watermark_ratio);
+
+  // Note [MPS allocator ager]
+  // Freed buffers stay cached in the pools until an explicit emptyCache(),
+  // which on memory-constrained systems keeps the process footprint at its
+  // historical peak and invites jetsam in mixed CPU/GPU workloads. When a
+  // positive idle timeout is configured, a background thread periodically
+  // releases buffers that have sat unused in their pools longer than the
+  // timeout, along with any heaps they empty. Only buffers the GPU is done
+  // with (retainCount <= 1) are released, so the ager never has to
+  // synchronize the stream.
+  static const char *idle_timeout_str = getenv("PYTORCH_MPS_BUFFER_IDLE_TIMEOUT");
+  m_buffer_idle_timeout = idle_timeout_str ? strtod(idle_timeout_str, nullptr) : 0.0;
+  TORCH_CHECK(m_buffer_idle_timeout >= 0.0, "invalid PYTORCH_MPS_BUFFER_IDLE_TIMEOUT ", m_buffer_idle_timeout);
+  if (m_buffer_idle_timeout > 0.0) {
+    if (m_debug_verbosity & DebugVerbosity::PROFILING) {
+      std::cerr << "Releasing cached buffers after " << m_buffer_idle_timeout << " seconds idle\n";
+    }
+    m_ager_thread = std::thread([this] { ager_thread_loop(); });
+  }
+}
+
+void MPSHeapAllocatorImpl::ager_thread_loop() {
+  // wake at half the timeout so a buffer is released at most 1.5x the
+  // configured idle time after it went cold
+  const auto interval = std::chrono::duration<double>(std::max(m_buffer_idle_timeout / 2.0, 1.0));
+  std::unique_lock<std::mutex> lock(m_ager_mutex);
+  while (!m_ager_cv.wait_for(lock, interval, [this] { return m_ager_stop; })) {
+    lock.unlock();
+    trim_idle_buffers();
+    lock.lock();
+  }
+}
+
+void MPSHeapAllocatorImpl::stop_ager_thread() {
+  if (m_ager_thread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(m_ager_mutex);
+      m_ager_stop = true;
+    }
+    m_ager_cv.notify_one();
+    m_ager_thread.join();
+  }
+}
+
+void MPSHeapAllocatorImpl::trim_idle_buffers() {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+  const auto now = std::chrono::steady_clock::now();
+  size_t trimmed_size = 0;
+  unsigned int trimmed_count = 0;
+  for (BufferPool* pool : {&m_large_pool_private, &m_large_pool_shared,
+                           &m_small_pool_private, &m_small_pool_shared, &m_scalar_pool}) {
+    auto it = pool->buffers.begin();
+    while (it != pool->buffers.end()) {
+      BufferBlock* buffer_block = *it;
+      ++it;
+      const std::chrono::duration<double> idle = now - buffer_block->last_free_time;
+      if (idle.count() >= m_buffer_idle_timeout && buffer_block->retainCount() <= 1) {
+        trimmed_size += buffer_block->size;
+        trimmed_count++;
+        release_buffer(buffer_block, true);
+      }
+    }
+  }
+  if (trimmed_count && (m_debug_verbosity & DebugVerbosity::RELEASES)) {
+    std::cerr << "Ager released " << trimmed_count
+              << " idle buffers (total size: " << format_size(trimmed_size)
+              << ", current allocated: " << format_size(current_allocated_size()) << ")\n";
+  }
+}
+
+bool MPSHeapAllocatorImpl::trigger_pressure_callbacks(IMpsMemoryPressureCallback::PressureLevel level, size_t limit) const {
+  for (const auto& name : MPSMemoryPressureCallbacksRegistry()->Keys()) {
+    MPSMemoryPressureCallbacksRegistry()->Create(name)->onMemoryPressure(level, current_allocated_size(), limit);
+  }
+  return true;
+}
+
+void MPSHeapAllocatorImpl::update_memory_pressure_state(bool has_pressure) {
+  if (!has_pressure) {
+    m_memory_pressure_notified = false;
+  } else if (!m_memory_pressure_notified) {
+    // notify once per crossing of the low watermark, not on every
+    // allocation made while under pressure
+    m_memory_pressure_notified = true;
+    trigger_pressure_callbacks(IMpsMemoryPressureCallback::PressureLevel::LOW_WATERMARK, m_low_watermark_limit);
+  }
 }
 
 void MPSHeapAllocatorImpl::setHighWatermarkRatio(double ratio) {
@@ -199,6 +288,7 @@ BufferBlock* MPSHeapAllocatorImpl::alloc_buffer_block(size_t size, uint32_t usag
   // low watermark limit has been reached
   params.has_memory_pressure = !(pool.usage & UsageFlags::SMALL) && getLowWatermarkValue() <= 0;
   params.has_unified_memory = m_device.hasUnifiedMemory;
+  update_memory_pressure_state(params.has_memory_pressure);
 
   // first, try to get a block from the existing pool.
   bool block_found = get_free_buffer(params);
@@ -214,6 +304,10 @@ BufferBlock* MPSHeapAllocatorImpl::alloc_buffer_block(size_t size, uint32_t usag
         // Callbacks might release more memory (eg. by forcing a GC in the host language) thus
         // we can retry getting a free buffer in the pool, before trying to alloc again.
         (trigger_memory_callbacks(nullptr, IMpsAllocatorCallback::EventType::ALLOCATION_FAILED) && get_free_buffer(params)) ||
+        // Let high-watermark listeners shed their caches (e.g. cached graphs)
+        // and retry, before we start tearing down our own pools.
+        (trigger_pressure_callbacks(IMpsMemoryPressureCallback::PressureLevel::HIGH_WATERMARK, m_max_total_allowed_size) &&
+         alloc_buffer(params)) ||
         // Free enough available cached blocks to satisfy alloc and retry alloc.
         (release_available_cached_buffers(params) && alloc_buffer(params)) ||
         // Free all cached buffers and retry alloc.
@@ -256,6 +350,7 @@ void MPSHeapAllocatorImpl::free_buffer(BufferBlock* buffer_block) {
   pool.available_size += buffer_block->size;
   buffer_block->shape.clear(); // reset shape
   buffer_block->in_use = false;
+  buffer_block->last_free_time = std::chrono::steady_clock::now();
   TORCH_INTERNAL_ASSERT_DEBUG_ONLY(m_current_allocated_memory >= buffer_block->size);
   m_current_allocated_memory -= buffer_block->size;
 }
@@ -52,6 +52,25 @@ C10_DECLARE_REGISTRY(MPSAllocatorCallbacksRegistry, IMpsAllocatorCallback);
 #define REGISTER_MPS_ALLOCATOR_CALLBACK(name, ...) \
   C10_REGISTER_CLASS(MPSAllocatorCallbacksRegistry, name, __VA_ARGS__);
 
+// Notified when the allocator's memory usage crosses its watermarks, so
+// frameworks holding their own caches (e.g., cached graphs or CPU-side
+// mirrors) can shed them before the OS terminates the process.
+class IMpsMemoryPressureCallback {
+ public:
+  enum class PressureLevel {
+    LOW_WATERMARK,  // total allocations crossed the low (soft) watermark
+    HIGH_WATERMARK, // an allocation is about to exceed the high (hard) limit
+  };
+  virtual ~IMpsMemoryPressureCallback() = default;
+  // total_allocated is the device-reported allocated size at the time of
+  // the notification; limit is the watermark that was crossed.
+  virtual void onMemoryPressure(PressureLevel level, size_t total_allocated, size_t limit) = 0;
+};
+
+C10_DECLARE_REGISTRY(MPSMemoryPressureCallbacksRegistry, IMpsMemoryPressureCallback);
+#define REGISTER_MPS_MEMORY_PRESSURE_CALLBACK(name, ...) \
+  C10_REGISTER_CLASS(MPSMemoryPressureCallbacksRegistry, name, __VA_ARGS__);
+
 IMPSAllocator* getIMPSAllocator(bool sharedAllocator = false);
 
 }} // namespace at::mps
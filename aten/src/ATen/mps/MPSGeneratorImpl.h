@@ -36,6 +36,11 @@ struct TORCH_API MPSGeneratorImpl : public c10::GeneratorImpl {
   void set_state(const c10::TensorImpl& new_state) override;
   c10::intrusive_ptr<c10::TensorImpl> get_state() const override;
   void update_philox_counters();
+  // Reserves a disjoint Philox counter range of `increment` 4-element blocks
+  // for one launch and returns the (seed, start offset) pair for it, like
+  // CUDAGeneratorImpl::philox_engine_inputs. The caller must hold mutex_.
+  // See Note [MPS batched Philox offsets] in MPSGeneratorImpl.mm.
+  std::pair<uint64_t, uint64_t> philox_engine_inputs(uint64_t increment);
 
   void set_engine(at::Philox4_32 engine) { engine_ = engine; };
   at::Philox4_32 engine() { return engine_; };
@@ -45,6 +50,7 @@ struct TORCH_API MPSGeneratorImpl : public c10::GeneratorImpl {
 private:
   mps::detail::rng_data_pod data_;
   at::Philox4_32 engine_;
+  uint64_t philox_offset_ = 0;
 
   MPSGeneratorImpl* clone_impl() const override;
 };
@@ -29,6 +29,7 @@ MPSGeneratorImpl::MPSGeneratorImpl(uint64_t seed_in)
 void MPSGeneratorImpl::set_current_seed(uint64_t seed) {
   data_.seed = seed;
   data_.state.fill(1);
+  philox_offset_ = 0;
   // the two last state values are the Philox keys
   // TODO: make "key" in PhiloxRNGEngine.h public so we don't duplicate code here
   data_.state[5] = static_cast<uint32_t>(seed);
@@ -55,6 +56,25 @@ void MPSGeneratorImpl::update_philox_counters() {
   }
 }
 
+// Note [MPS batched Philox offsets]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// update_philox_counters() pumps the Philox engine four times on the CPU for
+// every distribution launch and feeds the outputs to the graph as the counter
+// start, which serializes back-to-back random ops on the generator. Instead,
+// a launch can reserve a whole counter range up front: the counter space is
+// 2^128 blocks, so handing each launch a disjoint [offset, offset + increment)
+// window (the same scheme as CUDAGeneratorImpl::philox_cuda_state) only costs
+// a 64-bit addition under the generator lock, and the GPU advances the counter
+// within the window on its own.
+std::pair<uint64_t, uint64_t> MPSGeneratorImpl::philox_engine_inputs(uint64_t increment) {
+  // round up to a multiple of 4 so reserved ranges stay block-aligned
+  increment = ((increment + 3) / 4) * 4;
+  TORCH_INTERNAL_ASSERT(this->philox_offset_ % 4 == 0);
+  uint64_t offset = this->philox_offset_;
+  this->philox_offset_ += increment;
+  return std::make_pair(data_.seed, offset);
+}
+
 c10::intrusive_ptr<c10::TensorImpl> MPSGeneratorImpl::get_state() const {
   static const size_t states_size = mps::detail::PHILOX_STATE_N * sizeof(uint32_t);
   static const size_t seed_size = sizeof(uint64_t);
@@ -94,6 +114,7 @@ std::shared_ptr<MPSGeneratorImpl> MPSGeneratorImpl::clone() const {
 MPSGeneratorImpl* MPSGeneratorImpl::clone_impl() const {
   auto gen = new MPSGeneratorImpl();
   gen->set_current_seed(this->data_.seed);
+  gen->philox_offset_ = this->philox_offset_;
   return gen;
 }
 
@@ -309,6 +309,18 @@ public:
     return (m_signpost_types != SignpostTypes::SIGNPOST_NONE);
   }
 
+  // graph-cache counters reported by MPSGraphCache; dumped along with the
+  // operation stats before the process terminates (see LogOptions)
+  void recordGraphCacheHit() {
+    ++m_graph_cache_hits;
+  }
+  void recordGraphCacheMiss() {
+    ++m_graph_cache_misses;
+  }
+  void recordGraphCacheEvictions(uint64_t count) {
+    m_graph_cache_evictions += count;
+  }
+
  private:
   // indicates what type of signpost types are enabled and traced by MPS profiler.
   uint32_t m_signpost_types = 0;
@@ -318,6 +330,10 @@ public:
   uint64_t m_graph_counter = 0;
   uint64_t m_cpu_fb_counter = 0;
   uint64_t m_copy_counter = 0;
+  // atomics since MPSGraphCache reports these from its own serial queue
+  std::atomic<uint64_t> m_graph_cache_hits{0};
+  std::atomic<uint64_t> m_graph_cache_misses{0};
+  std::atomic<uint64_t> m_graph_cache_evictions{0};
   // technically, it's possible to trace both events and intervals at the same time
   // so we use separate os_log categories for them
   os_log_t m_os_log_events;
@@ -347,6 +347,9 @@ void MPSProfiler::addProfilerCompletedHandler(BaseInfo& info, SyncType syncType)
 }
 
 void MPSProfiler::logOperationsProfilingStats(std::FILE* f) const {
+  fmt::print(f, "\nMPS graph cache: {} hits, {} misses, {} evictions\n",
+             m_graph_cache_hits.load(), m_graph_cache_misses.load(),
+             m_graph_cache_evictions.load());
   if (m_op_info_list.empty()) {
     // this is not an error, but to let the user know that the
     // LogOptions::KERNEL_STATS that they passed to EV is not yielding anything.
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <utility>
 
@@ -101,6 +102,15 @@ private:
   bool _enableCommitAndContinue = true;
   // accumulated sizes of resources encoded on command buffer
   size_t _commandBufferResourceSize = 0;
+  // see Note [MPS adaptive commit batching] in MPSStream.mm
+  bool _enableAdaptiveBatching = false;
+  // number of ops encoded on the active command buffer
+  uint32_t _commandBufferOpCount = 0;
+  // op-count budget after which COMMIT_ADAPTIVE commits; tuned from GPU idle
+  // gaps in a completion handler, hence atomic
+  std::atomic<uint32_t> _commitOpBudget;
+  // GPU-timeline end time of the previously completed command buffer
+  std::atomic<double> _lastGPUEndTime;
 
   // use synchronize() to access any of these commit functions outside MPSStream
   void commit();
@@ -109,6 +119,7 @@ private:
   void flush();
 
   void updateCommandBufferResourceSize(NSArray<MPSGraphTensorData*> *feeds);
+  void scheduleBatchTuningHandler();
 };
 
 /**
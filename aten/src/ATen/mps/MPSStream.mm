@@ -4,6 +4,9 @@
 #include <ATen/mps/MPSProfiler.h>
 #include <ATen/mps/MPSAllocatorInterface.h>
 
+#include <algorithm>
+#include <cstdlib>
+
 @interface MPSGraphExecutionDescriptor ()
 @property (readwrite, atomic) BOOL enableCommitAndContinue;
 @end
@@ -15,6 +18,27 @@ namespace mps {
 // of resources encoded on the command buffer exceeds that.
 static const size_t kCmdBufAdaptiveCommitThreshold = MB(64);
 
+// Note [MPS adaptive commit batching]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// COMMIT_ADAPTIVE already defers commits until the resources encoded on the
+// command buffer exceed the byte threshold above (or the allocator signals
+// memory pressure). For workloads dominated by many tiny graph launches the
+// byte threshold is rarely reached, so hundreds of ops pile up on one buffer
+// while the GPU sits idle waiting for the eventual commit. When
+// PYTORCH_MPS_ADAPTIVE_COMMIT=1, the stream additionally commits after a
+// tuned number of encoded ops. The budget is tuned from the gap between
+// consecutive command buffers on the GPU timeline (GPUStartTime/GPUEndTime,
+// sampled in a completion handler): an idle gap that is large relative to
+// the buffer's busy time means the GPU starved while we were encoding, so
+// the budget is halved to commit sooner; back-to-back buffers with a full
+// batch mean per-commit overhead can be amortized further, so it is doubled.
+static const uint32_t kInitialCommitOpBudget = 16;
+static const uint32_t kMinCommitOpBudget = 4;
+static const uint32_t kMaxCommitOpBudget = 256;
+// idle/busy ratios beyond/below which the op budget shrinks/grows
+static const double kMaxIdleGapRatio = 0.25;
+static const double kMinIdleGapRatio = 0.05;
+
 //-----------------------------------------------------------------
 //  MPSStream
 //-----------------------------------------------------------------
@@ -30,6 +54,12 @@ MPSStream::MPSStream(Stream stream) : _stream(stream) {
     _enableCommitAndContinue = false;
   }
   _executionDescriptor.enableCommitAndContinue = _enableCommitAndContinue;
+
+  // see Note [MPS adaptive commit batching]
+  const char* adaptive_env = std::getenv("PYTORCH_MPS_ADAPTIVE_COMMIT");
+  _enableAdaptiveBatching = adaptive_env && adaptive_env[0] == '1';
+  _commitOpBudget.store(kInitialCommitOpBudget, std::memory_order_relaxed);
+  _lastGPUEndTime.store(0.0, std::memory_order_relaxed);
 }
 
 MPSStream::~MPSStream() {
@@ -70,10 +100,14 @@ void MPSStream::synchronize(SyncType syncType) {
       commit();
       break;
     case SyncType::COMMIT_ADAPTIVE:
+      _commandBufferOpCount++;
       // the adaptive commit only commits if we hit the low watermark memory threshold,
-      // or when the sizes attached to the active command buffer exceeds the threshold
+      // when the sizes attached to the active command buffer exceeds the threshold, or
+      // when adaptive batching is enabled and the tuned op budget is exhausted
       if (getIMPSAllocator()->getLowWatermarkValue() <= 0 ||
-          _commandBufferResourceSize > kCmdBufAdaptiveCommitThreshold) {
+          _commandBufferResourceSize > kCmdBufAdaptiveCommitThreshold ||
+          (_enableAdaptiveBatching &&
+           _commandBufferOpCount >= _commitOpBudget.load(std::memory_order_relaxed))) {
         commit();
       }
       break;
@@ -89,13 +123,17 @@ void MPSStream::synchronize(SyncType syncType) {
 }
 
 void MPSStream::commit() {
+  if (_enableAdaptiveBatching) {
+    scheduleBatchTuningHandler();
+  }
   if (_enableCommitAndContinue) {
     [commandBuffer() commitAndContinue];
   } else {
     flush();
   }
-  // reset the accumulated resource sizes for command buffer
+  // reset the accumulated resource sizes and op count for command buffer
   _commandBufferResourceSize = 0;
+  _commandBufferOpCount = 0;
 }
 
 void MPSStream::commitAndWait() {
@@ -112,8 +150,9 @@ void MPSStream::commitAndWait() {
     [_commandBuffer waitUntilCompleted];
     [_commandBuffer release];
     _commandBuffer = nil;
-    // reset the accumulated resource sizes for command buffer
+    // reset the accumulated resource sizes and op count for command buffer
     _commandBufferResourceSize = 0;
+    _commandBufferOpCount = 0;
   }
 }
 
@@ -136,6 +175,39 @@ void MPSStream::commitAdaptive(const TensorList& tensors, void* profilerHandle)
   }
 }
 
+void MPSStream::scheduleBatchTuningHandler() {
+  if (!_commandBuffer || _commandBufferOpCount == 0) {
+    return;
+  }
+  const uint32_t batchedOps = _commandBufferOpCount;
+  // MPSStream is a process-lifetime singleton, so capturing `this` is safe.
+  [commandBuffer() addCompletedHandler:^(id<MTLCommandBuffer> buffer) {
+    // GPU times are zero if the buffer never ran (e.g., on an error); leave
+    // the budget alone in that case.
+    const double gpuStart = [buffer GPUStartTime];
+    const double gpuEnd = [buffer GPUEndTime];
+    if (gpuStart == 0.0 || gpuEnd <= gpuStart) {
+      return;
+    }
+    const double prevEnd = _lastGPUEndTime.exchange(gpuEnd, std::memory_order_acq_rel);
+    if (prevEnd <= 0.0) {
+      return;
+    }
+    const double busyTime = gpuEnd - gpuStart;
+    const double idleGap = gpuStart - prevEnd;
+    uint32_t budget = _commitOpBudget.load(std::memory_order_relaxed);
+    if (idleGap > busyTime * kMaxIdleGapRatio) {
+      // the GPU starved while this batch was being encoded; commit sooner
+      budget = std::max(budget / 2, kMinCommitOpBudget);
+    } else if (idleGap >= 0.0 && idleGap < busyTime * kMinIdleGapRatio && batchedOps >= budget) {
+      // back-to-back execution with a full batch; amortize the per-commit
+      // overhead over more ops
+      budget = std::min(budget * 2, kMaxCommitOpBudget);
+    }
+    _commitOpBudget.store(budget, std::memory_order_relaxed);
+  }];
+}
+
 void MPSStream::endKernelCoalescing() {
   if (_commandEncoder) {
     [_commandEncoder endEncoding];
@@ -19,6 +19,43 @@
 namespace at { namespace native {
 
 namespace {
+
+/*
+  Unblocked in-place Cholesky factorization for tiny matrices, where the
+  LAPACK call overhead dominates the actual flops. Matrices are batched
+  column major; the upper variant runs the lower algorithm on transposed
+  indices. Mirrors the POTRF convention: a positive `info` is the index
+  (1-based) of the first non-positive-definite leading minor.
+*/
+template <typename scalar_t>
+void cholesky_micro_kernel(scalar_t* a, int64_t n, bool upper, int* info) {
+  *info = 0;
+  const auto idx = [n, upper](int64_t i, int64_t j) {
+    return upper ? j + i * n : i + j * n;
+  };
+  for (const auto j : c10::irange(n)) {
+    scalar_t d = a[idx(j, j)];
+    for (const auto k : c10::irange(j)) {
+      d -= a[idx(j, k)] * a[idx(j, k)];
+    }
+    if (!(d > scalar_t(0))) {
+      *info = j + 1;
+      return;
+    }
+    const scalar_t inv_l_jj = scalar_t(1) / std::sqrt(d);
+    a[idx(j, j)] = std::sqrt(d);
+    for (const auto i : c10::irange(j + 1, n)) {
+      scalar_t s = a[idx(i, j)];
+      for (const auto k : c10::irange(j)) {
+        s -= a[idx(i, k)] * a[idx(j, k)];
+      }
+      a[idx(i, j)] = s * inv_l_jj;
+    }
+  }
+}
+
+constexpr int64_t kCholeskyMicroKernelMaxDim = 8;
+
 /*
   Computes the Cholesky decomposition of matrices stored in `input`.
   This is an in-place routine and the content of 'input' is overwritten with the result.
@@ -48,11 +85,28 @@ void apply_cholesky(const Tensor& input, const Tensor& info, bool upper) {
   auto n = input.size(-2);
   auto lda = std::max<int64_t>(1, n);
 
-  for (const auto i : c10::irange(batch_size)) {
-    scalar_t* input_working_ptr = &input_data[i * input_matrix_stride];
-    int* info_working_ptr = &info_data[i];
-    lapackCholesky<scalar_t>(uplo, n, input_working_ptr, lda, info_working_ptr);
-  }
+  // POTRF takes no workspace, so the batch loop can run in parallel with no
+  // per-thread state. The grain size heuristic matches batched LU below.
+  const auto loop = [&](int64_t start, int64_t end) {
+    for (const auto i : c10::irange(start, end)) {
+      scalar_t* input_working_ptr = &input_data[i * input_matrix_stride];
+      int* info_working_ptr = &info_data[i];
+      // The microkernel only handles the real case; complex POTRF conjugates.
+      if constexpr (!c10::is_complex<scalar_t>::value) {
+        if (n <= kCholeskyMicroKernelMaxDim) {
+          cholesky_micro_kernel<scalar_t>(input_working_ptr, n, upper, info_working_ptr);
+          continue;
+        }
+      }
+      lapackCholesky<scalar_t>(uplo, n, input_working_ptr, lda, info_working_ptr);
+    }
+  };
+  // avoid overflow
+  float matrix_rank = float(n);
+  int64_t chunk_size_per_thread = int64_t(
+      std::min(1.0, 3200.0 / (matrix_rank * matrix_rank * matrix_rank)));
+  int64_t grain_size = chunk_size_per_thread * at::get_num_threads();
+  at::parallel_for(0, batch_size, grain_size, loop);
 #endif
 }
 
@@ -4,8 +4,12 @@
 #include <ATen/Parallel.h>
 #include <ATen/native/BucketizationUtils.h>
 #include <ATen/native/Resize.h>
+#include <c10/util/Optional.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+#include <vector>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
@@ -83,6 +87,99 @@ int64_t cus_upper_bound(int64_t start, int64_t end, const input_t val, const inp
   return start;
 }
 
+// Exponential (galloping) searches for when the result is known to lie at or
+// after 'lo': doubling probes find a window around the result in O(log gap)
+// steps and the customized binary search finishes inside it. Only valid
+// without a sorter, where boundary storage order is search order.
+template<typename input_t>
+int64_t gallop_lower_bound(int64_t lo, int64_t end, const input_t val, const input_t* bd) {
+  int64_t bound = 1;
+  while (lo + bound < end && !(bd[lo + bound] >= val)) {
+    bound <<= 1;
+  }
+  const int64_t search_lo = bound == 1 ? lo : std::min(lo + (bound >> 1) + 1, end);
+  return cus_lower_bound(search_lo, std::min(lo + bound, end), val, bd, nullptr);
+}
+
+template<typename input_t>
+int64_t gallop_upper_bound(int64_t lo, int64_t end, const input_t val, const input_t* bd) {
+  int64_t bound = 1;
+  while (lo + bound < end && !(bd[lo + bound] > val)) {
+    bound <<= 1;
+  }
+  const int64_t search_lo = bound == 1 ? lo : std::min(lo + (bound >> 1) + 1, end);
+  return cus_upper_bound(search_lo, std::min(lo + bound, end), val, bd, nullptr);
+}
+
+// Flattened Eytzinger (BFS) copy of a 1d boundary tensor. A binary search over
+// the sorted array hops across the whole tensor and eats a cache miss per
+// probe once the boundaries outgrow L1; in BFS order the first levels of the
+// implicit tree share a handful of cache lines, so the hot prefix of every
+// probe stays resident. Built once per call and shared read-only by all
+// worker threads; the O(m) build is amortized by the n >> m probes after it.
+template <typename input_t>
+class EytzingerBoundaryIndex {
+ public:
+  EytzingerBoundaryIndex(const input_t* bd, int64_t n)
+      : n_(n), keys_(n + 1), ranks_(n + 1) {
+    int64_t next_rank = 0;
+    fill(bd, /*k=*/1, next_rank);
+  }
+
+  // Comparators mirror cus_lower_bound/cus_upper_bound so 'nan', 'inf' etc.
+  // land at the end of the boundaries just like the linear layout path.
+  int64_t lower_bound(const input_t val) const {
+    int64_t res = n_;
+    int64_t k = 1;
+    while (k <= n_) {
+      if (!(keys_[k] >= val)) {
+        k = 2 * k + 1;
+      }
+      else {
+        res = ranks_[k];
+        k = 2 * k;
+      }
+    }
+    return res;
+  }
+
+  int64_t upper_bound(const input_t val) const {
+    int64_t res = n_;
+    int64_t k = 1;
+    while (k <= n_) {
+      if (!(keys_[k] > val)) {
+        k = 2 * k + 1;
+      }
+      else {
+        res = ranks_[k];
+        k = 2 * k;
+      }
+    }
+    return res;
+  }
+
+ private:
+  // In-order traversal of the implicit tree visits nodes in sorted order.
+  void fill(const input_t* bd, int64_t k, int64_t& next_rank) {
+    if (k > n_) {
+      return;
+    }
+    fill(bd, 2 * k, next_rank);
+    keys_[k] = bd[next_rank];
+    ranks_[k] = next_rank;
+    ++next_rank;
+    fill(bd, 2 * k + 1, next_rank);
+  }
+
+  int64_t n_;
+  std::vector<input_t> keys_;
+  std::vector<int64_t> ranks_;
+};
+
+// below this many boundaries a plain binary search stays in L1 anyway and the
+// Eytzinger copy isn't worth building
+constexpr int64_t EYTZINGER_MIN_BOUNDARIES = 4096;
+
 template<typename input_t, typename output_t>
 void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tensor& boundaries, const bool& right, const Tensor& sorter) {
   int64_t numel_in = input.numel();
@@ -97,15 +194,53 @@ void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tens
   output_t *data_out = result.data_ptr<output_t>();
 
   bool is_1d_boundaries = boundaries.dim() == 1;
+
+  // One flattened boundary index per call, when the probes will dominate the
+  // O(m) build (large static boundaries, many more values than boundaries).
+  c10::optional<EytzingerBoundaryIndex<input_t>> boundary_index;
+  if (is_1d_boundaries && !data_st && idim_bd >= EYTZINGER_MIN_BOUNDARIES &&
+      numel_in >= idim_bd) {
+    boundary_index.emplace(data_bd, idim_bd);
+  }
+
   at::parallel_for(0, numel_in, SEARCHSORTED_GRAIN_SIZE, [&](int64_t start, int64_t end) {
+    // Carry the previous hit as a hint: searchsorted is monotone in its
+    // values, so as long as the values in this chunk arrive (locally) sorted
+    // a galloping search from the last result replaces the full binary
+    // search and the chunk degenerates into an O(n + m) merge walk. The
+    // comparison against prev_val is false for 'nan', which safely falls
+    // back to the full search.
+    int64_t prev_row = -1;
+    int64_t prev_pos = 0;
+    input_t prev_val = input_t(0);
     for (const auto i : c10::irange(start, end)) {
       // If boundaries tensor is 1d, we always search the entire boundary tensor
       int64_t start_bd = is_1d_boundaries ? 0 : i / idim_in * idim_bd;
       int64_t end_bd = start_bd + idim_bd;
+      const input_t val = data_in[i];
+
+      int64_t pos;
+      if (!data_st && prev_row == start_bd && val >= prev_val) {
+        pos = !right ?
+          gallop_lower_bound(prev_pos, end_bd, val, data_bd) - start_bd :
+          gallop_upper_bound(prev_pos, end_bd, val, data_bd) - start_bd;
+      }
+      else if (boundary_index.has_value()) {
+        pos = !right ?
+          boundary_index->lower_bound(val) :
+          boundary_index->upper_bound(val);
+      }
+      else {
+        pos = !right ?
+          cus_lower_bound(start_bd, end_bd, val, data_bd, data_st) - start_bd :
+          cus_upper_bound(start_bd, end_bd, val, data_bd, data_st) - start_bd;
+      }
 
-      int64_t pos = !right ?
-        cus_lower_bound(start_bd, end_bd, data_in[i], data_bd, data_st) - start_bd :
-        cus_upper_bound(start_bd, end_bd, data_in[i], data_bd, data_st) - start_bd;
+      if (!data_st) {
+        prev_row = start_bd;
+        prev_pos = start_bd + pos;
+        prev_val = val;
+      }
 
       // type conversion might happen here
       data_out[i] = pos;
@@ -93,6 +93,7 @@ enum class ConvBackend {
   CudaDepthwise3d,
   Cudnn,
   CudnnTranspose,
+  DepthwiseDirect2d,
   Empty,
   Miopen,
   MiopenDepthwise,
@@ -108,6 +109,7 @@ enum class ConvBackend {
   SlowDilated3d,
   SlowTranspose2d,
   SlowTranspose3d,
+  Winograd3x3,
   Winograd3x3Depthwise,
   Xnnpack2d,
   Mps,
@@ -7,6 +7,7 @@
 #include <ATen/native/ConvUtils.h>
 #include <ATen/native/Pool.h>
 #include <ATen/native/cpu/DepthwiseConvKernel.h>
+#include <ATen/native/cpu/WinogradConvKernel.h>
 #include <ATen/native/utils/ParamUtils.h>
 #include <ATen/native/xnnpack/Engine.h>
 #include <c10/util/accumulate.h>
@@ -379,6 +380,56 @@ struct ConvParams {
 #endif
   }
 
+  bool use_cpu_depthwise_direct(const at::Tensor& input, const at::Tensor& weight, const c10::optional<at::Tensor>& bias) const {
+    // The direct kernel vectorizes across the dense channel dimension, so it
+    // only pays off in channels-last layout. Larger kernels are better served
+    // by the im2col+gemm path's blocked matmuls.
+    constexpr int64_t kMaxKernel = 7;
+    return (input.ndimension() == 4) &&
+           (at::symint::size<T>(input, 1) == groups) &&
+           (weight.ndimension() == 4) &&
+           (at::symint::size<T>(weight, 0) == groups) &&
+           (at::symint::size<T>(weight, 1) == 1) &&
+           (at::symint::size<T>(weight, 2) <= kMaxKernel) &&
+           (at::symint::size<T>(weight, 3) <= kMaxKernel) &&
+           (input.device().is_cpu()) &&
+           (input.scalar_type() == at::kFloat ||
+            input.scalar_type() == at::kBFloat16) &&
+           input.is_contiguous(at::MemoryFormat::ChannelsLast) &&
+           (weight.device().is_cpu()) &&
+           (weight.scalar_type() == input.scalar_type()) &&
+           weight.is_contiguous() &&
+           (!bias.has_value() ||
+            (bias->is_contiguous() && bias->scalar_type() == input.scalar_type())) &&
+           !is_stride_nonpos() &&
+           !transposed;
+  }
+
+  bool use_cpu_winograd3x3(const at::Tensor& input, const at::Tensor& weight, const c10::optional<at::Tensor>& bias) const {
+    // Below this many channels on either side the transform overhead eats
+    // the 2.25x multiplication savings over im2col+gemm.
+    constexpr int64_t kMinChannels = 16;
+    // Currently only single-group 3x3 stride-1 convolutions on tensors of
+    // float are supported, and only for inference.
+    return (input.ndimension() == 4) &&
+           (weight.ndimension() == 4) &&
+           (at::symint::size<T>(weight, 2) == 3) &&
+           (at::symint::size<T>(weight, 3) == 3) &&
+           (at::symint::size<T>(input, 1) >= kMinChannels) &&
+           (at::symint::size<T>(weight, 0) >= kMinChannels) &&
+           (groups == 1) &&
+           (input.device().is_cpu()) &&
+           (input.scalar_type() == at::kFloat) &&
+           input.is_contiguous() &&
+           (weight.device().is_cpu()) &&
+           (weight.scalar_type() == at::kFloat) &&
+           weight.is_contiguous() &&
+           (!bias.has_value() || bias->is_contiguous()) &&
+           !is_strided() &&
+           !is_dilated() &&
+           !transposed;
+  }
+
   bool needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const {
     constexpr int64_t int_max = std::numeric_limits<int>::max();
     auto numel_input = at::symint::numel<T>(input);
@@ -599,6 +650,8 @@ DEFINE_DISPATCH(cudnn_convolution_backward_stub);
 DEFINE_DISPATCH(cudnn_convolution_transpose_backward_stub);
 DEFINE_DISPATCH(slow_conv_transpose3d_backward_stub);
 DEFINE_DISPATCH(convolution_depthwise3x3_winograd_stub);
+DEFINE_DISPATCH(convolution_depthwise2d_direct_stub);
+DEFINE_DISPATCH(convolution_winograd3x3_stub);
 DEFINE_DISPATCH(miopen_convolution_backward_stub);
 DEFINE_DISPATCH(miopen_convolution_transpose_backward_stub);
 DEFINE_DISPATCH(miopen_depthwise_convolution_backward_stub);
@@ -1234,6 +1287,12 @@ ConvBackend _select_conv_backend(
   // 3x3 depthwith convolutions implementation is inference only
   } else if (!need_backward && params.use_cpu_depthwise3x3_winograd(input, weight, bias)) {
     return ConvBackend::Winograd3x3Depthwise;
+  // Direct NHWC depthwise convolutions are likewise inference only
+  } else if (!need_backward && params.use_cpu_depthwise_direct(input, weight, bias)) {
+    return ConvBackend::DepthwiseDirect2d;
+  // Winograd 3x3 convolutions are likewise inference only
+  } else if (!need_backward && params.use_cpu_winograd3x3(input, weight, bias)) {
+    return ConvBackend::Winograd3x3;
   } else if (
       !params.transposed && (input.ndimension() == 5) &&
       (input.device().is_cpu()) &&
@@ -1427,6 +1486,9 @@ static inline at::MemoryFormat determine_backend_memory_format(
         backend_memory_format = at::MemoryFormat::ChannelsLast;
       }
       break;
+    case ConvBackend::DepthwiseDirect2d:
+      backend_memory_format = at::MemoryFormat::ChannelsLast;
+      break;
     default:
       backend_memory_format = at::MemoryFormat::Contiguous;
   }
@@ -1607,10 +1669,19 @@ at::Tensor _convolution(
     case ConvBackend::Slow3d:
       output = at::slow_conv3d(input, weight, kernel_size, bias, params.stride, params.padding);
       break;
+    case ConvBackend::Winograd3x3:
+      output = convolution_winograd3x3_stub(
+          input.device().type(), input, weight, bias, params.padding);
+      break;
     case ConvBackend::Winograd3x3Depthwise:
       output = convolution_depthwise3x3_winograd_stub(
           input.device().type(), input, weight, bias, params.stride, params.padding, params.groups);
       break;
+    case ConvBackend::DepthwiseDirect2d:
+      output = convolution_depthwise2d_direct_stub(
+          input.device().type(), input, weight, bias, params.stride, params.padding,
+          params.dilation, params.groups);
+      break;
     case ConvBackend::Xnnpack2d:
       output = xnnpack::convolution2d(
           input, weight, bias, params.padding, params.stride, params.dilation, params.groups);
@@ -2225,9 +2296,15 @@ std::tuple<Tensor, Tensor, Tensor> convolution_backward(
       break;
     }
     // Backward is not supported for these backends.
+    case ConvBackend::Winograd3x3:
+      TORCH_CHECK(false, "Backward is not supported for winograd 3x3");
+      break;
     case ConvBackend::Winograd3x3Depthwise:
       TORCH_CHECK(false, "Backward is not supported for depthwise 3x3 winograd");
       break;
+    case ConvBackend::DepthwiseDirect2d:
+      TORCH_CHECK(false, "Backward is not supported for direct depthwise convolution");
+      break;
     case ConvBackend::Xnnpack2d:
       TORCH_CHECK(false, "Backward is not supported for xnnpack");
       break;
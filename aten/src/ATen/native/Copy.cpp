@@ -14,15 +14,17 @@
 #include <ATen/metal/Context.h>
 #include <ATen/NamedTensorUtils.h>
 #include <ATen/Parallel.h>
+#include <ATen/native/cpu/utils.h>
 #include <c10/util/irange.h>
 
+#include <atomic>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
 #include <ATen/ops/_copy_from.h>
 #include <ATen/ops/copy_native.h>
-#include <ATen/ops/empty.h>
 #include <ATen/ops/expand_copy.h>
 #endif
 
@@ -35,19 +37,40 @@ namespace {
 
 using namespace at;
 
+// A copy can take the blocked transpose path when `self` is contiguous and
+// `src` is `self` with its two innermost dimensions swapped, with any number
+// of contiguous batch dimensions in front. Besides plain 2-D transposes this
+// covers permutations such as NHWC -> NCHW, where each image is a (H*W, C)
+// matrix transpose.
 bool copy_transpose_valid(const Tensor& self, const Tensor& src) {
   const int MIN_SZ = 60 * 60;
-  return self.is_contiguous() && src.numel() != 0 && src.dim() == 2 &&
-      src.stride(0) == 1 && src.stride(1) == src.size(0) &&
-      self.scalar_type() == src.scalar_type() &&
-      self.sizes().equals(src.sizes()) &&
-      self.is_neg() == src.is_neg() &&
-      self.is_conj() == src.is_conj() &&
-      self.numel() >= MIN_SZ;
+  if (!(self.is_contiguous() && src.numel() != 0 && src.dim() >= 2 &&
+        src.stride(src.dim() - 2) == 1 &&
+        src.stride(src.dim() - 1) == src.size(src.dim() - 2) &&
+        self.scalar_type() == src.scalar_type() &&
+        self.sizes().equals(src.sizes()) &&
+        self.is_neg() == src.is_neg() &&
+        self.is_conj() == src.is_conj() &&
+        self.numel() >= MIN_SZ)) {
+    return false;
+  }
+  // Batch dimensions must be laid out contiguously over the matrix blocks so
+  // that each block is a self-contained transpose.
+  int64_t expected_stride = src.size(src.dim() - 2) * src.size(src.dim() - 1);
+  for (int64_t i = src.dim() - 3; i >= 0; i--) {
+    if (src.stride(i) != expected_stride) {
+      return false;
+    }
+    expected_stride *= src.size(i);
+  }
+  return true;
 }
 
-// special case copy where tensor is contiguous and src is a transposed matrix
-// This can be generalized to most copies, but it's trickier
+// special case copy where tensor is contiguous and src is a (possibly
+// batched) transposed matrix. Each matrix is processed in cache-sized tiles;
+// tiles are distributed across threads and transposed straight from src into
+// self via utils::transpose, which lowers to an in-register SIMD transpose
+// where fbgemm is available.
 void copy_same_type_transpose_(Tensor& self, const Tensor& src) {
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   int64_t BLOCK_SZ;
@@ -58,49 +81,38 @@ void copy_same_type_transpose_(Tensor& self, const Tensor& src) {
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
     BLOCK_SZ = 60;
   }
-  Tensor buf = empty({BLOCK_SZ, BLOCK_SZ}, self.options());
 
   // The code below is implemented with the assumption that sizes are equal
   TORCH_INTERNAL_ASSERT_DEBUG_ONLY(self.sizes().equals(src.sizes()));
 
+  int64_t NR = src.size(src.dim() - 2);
+  int64_t NC = src.size(src.dim() - 1);
+  int64_t NB = src.numel() / (NR * NC);
+  int64_t tiles_r = divup(NR, BLOCK_SZ);
+  int64_t tiles_c = divup(NC, BLOCK_SZ);
+  int64_t num_tiles = NB * tiles_r * tiles_c;
+
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(kHalf, kBool, kBFloat16, kComplexHalf, self.scalar_type(), "copy_", [&] {
-    scalar_t* sp = src.data_ptr<scalar_t>();
+    const scalar_t* sp = src.data_ptr<scalar_t>();
     scalar_t* rp = self.data_ptr<scalar_t>();
-    scalar_t* bp = buf.data_ptr<scalar_t>();
-
-    int64_t NR = src.size(0);
-    int64_t NC = src.size(1);
-    for (int64_t R = 0; R < NR; R += BLOCK_SZ) {
-      for (int64_t C = 0; C < NC; C += BLOCK_SZ) {
-        scalar_t* spo = sp + R + C * NR;
-        scalar_t* rpo = rp + C + R * NC;
-
-        int nr = std::min(NR - R, BLOCK_SZ);
-        int nc = std::min(NC - C, BLOCK_SZ);
-
-        // 1. copy columns from src to buf
-        for (const auto c : c10::irange(nc)) {
-          memcpy(bp + c * BLOCK_SZ, spo + c * NR, nr * sizeof(scalar_t));
-        }
 
-        // 2. transpose buf in place
-        int rc_max = std::max(nr, nc);
-        int rc_min = std::min(nr, nc);
-        for (const auto r : c10::irange(rc_max)) {
-          int end = std::min(r, rc_min);
-          for (const auto c : c10::irange(end)) {
-            scalar_t tmp = bp[r + BLOCK_SZ * c];
-            bp[r + BLOCK_SZ * c] = bp[r * BLOCK_SZ + c];
-            bp[r * BLOCK_SZ + c] = tmp;
-          }
-        }
-
-        // 3. copy rows from buf to dst
-        for (const auto r : c10::irange(nr)) {
-          memcpy(rpo + r * NC, bp + r * BLOCK_SZ, nc * sizeof(scalar_t));
-        }
+    at::parallel_for(0, num_tiles, 1, [&](int64_t begin, int64_t end) {
+      for (const auto tile : c10::irange(begin, end)) {
+        int64_t b = tile / (tiles_r * tiles_c);
+        int64_t t = tile % (tiles_r * tiles_c);
+        int64_t R = (t / tiles_c) * BLOCK_SZ;
+        int64_t C = (t % tiles_c) * BLOCK_SZ;
+        const scalar_t* spo = sp + b * NR * NC + R + C * NR;
+        scalar_t* rpo = rp + b * NR * NC + C + R * NC;
+
+        int64_t nr = std::min(NR - R, BLOCK_SZ);
+        int64_t nc = std::min(NC - C, BLOCK_SZ);
+
+        // The src tile is an nc x nr row-major matrix with leading dimension
+        // NR; writing its transpose produces nr rows of self.
+        at::native::utils::transpose<scalar_t>(nc, nr, spo, NR, rpo, NC);
       }
-    }
+    });
   });
 }
 
@@ -116,6 +128,25 @@ bool is_supported_device(Device device) {
 namespace at {
 namespace native {
 
+// -1: automatic (threshold-based), 0: disabled, 1: forced on
+static std::atomic<int> copy_stream_stores_override{-1};
+
+void copy_stream_stores(c10::optional<bool> enabled) {
+  copy_stream_stores_override.store(
+      enabled.has_value() ? (*enabled ? 1 : 0) : -1);
+}
+
+c10::optional<bool> copy_stream_stores() {
+  switch (copy_stream_stores_override.load()) {
+    case 0:
+      return false;
+    case 1:
+      return true;
+    default:
+      return c10::nullopt;
+  }
+}
+
 static Tensor & copy_impl(Tensor & self, const Tensor & src, bool non_blocking) {
   // TODO: this should be handled during dispatch, but that's missing...
   TORCH_CHECK(self.defined(), "self is undefined");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ATen/native/DispatchStub.h>
+#include <c10/util/Optional.h>
 
 namespace at {
 
@@ -16,5 +17,14 @@ DECLARE_DISPATCH(copy_fn, copy_stub);
 
 TORCH_API void copy_ignoring_overlaps(const TensorBase &dst, const TensorBase &src);
 
+// Escape hatch for the non-temporal (streaming) store path used by CPU
+// tensor.copy_() on large contiguous same-dtype copies. By default the path
+// engages past a cache-sized threshold so bulk copies do not evict the LLC;
+// pass true to force it on for every eligible copy, false to disable it, or
+// nullopt to restore the automatic behavior. Only takes effect on targets
+// with streaming stores (x86 AVX2/AVX512).
+TORCH_API void copy_stream_stores(c10::optional<bool> enabled);
+TORCH_API c10::optional<bool> copy_stream_stores();
+
 } // namespace native
 } // namespace at
@@ -74,6 +74,16 @@ CPUCapability get_cpu_capability() {
   return capability;
 }
 
+bool cpu_has_avx512_bf16() {
+#if !defined(__powerpc__) && !defined(__s390x__)
+  static const bool has_avx512_bf16 =
+      cpuinfo_initialize() && cpuinfo_has_x86_avx512bf16();
+  return has_avx512_bf16;
+#else
+  return false;
+#endif
+}
+
 void* DispatchStubImpl::get_call_ptr(
   DeviceType device_type
   , void *DEFAULT
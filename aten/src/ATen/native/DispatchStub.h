@@ -59,6 +59,14 @@ enum class CPUCapability {
 
 CPUCapability get_cpu_capability();
 
+// Runtime check for the AVX512-BF16 extension (vdpbf16ps and the native
+// bf16 converts, available since Cooper Lake / Sapphire Rapids).  This is
+// deliberately not a full CPUCapability tier: recompiling every cpu kernel
+// yet another time for a single extension is not worth the build cost, so
+// the few kernels with a bf16 fast path compile it behind a target
+// attribute and gate it on this check instead.
+TORCH_API bool cpu_has_avx512_bf16();
+
 template <typename FnPtr, typename T>
 struct DispatchStub;
 
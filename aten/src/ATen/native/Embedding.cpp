@@ -12,6 +12,7 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_embedding_backward_accumulate_native.h>
 #include <ATen/ops/_sparse_coo_tensor_unsafe.h>
 #include <ATen/ops/embedding_backward_native.h>
 #include <ATen/ops/embedding_dense_backward.h>
@@ -178,6 +179,77 @@ Tensor embedding_dense_backward_cpu(
   return grad_weight;
 }
 
+// Note [Embedding gradient accumulation]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The sparse embedding backward produces an uncoalesced COO tensor that every
+// optimizer step has to coalesce and scatter back into the weight. Workloads
+// that take many steps against a persistent table (e.g. recommender models)
+// are better served by keeping one dense accumulator per table and scattering
+// each backward's rows into it directly. _embedding_backward_accumulate_ is
+// that scatter: the same bucketed accumulation loop as
+// embedding_dense_backward_cpu, but writing into a caller-owned accumulator,
+// so no gradient tensor is built, coalesced, or re-scattered per step. The
+// accumulator may be fp32 while grad_output is a reduced-precision type; the
+// optimizer consumes (and zeroes) the accumulator in place.
+Tensor & embedding_backward_accumulate_cpu_(
+    Tensor & accumulator, const Tensor & grad_, const Tensor & indices,
+    int64_t padding_idx) {
+
+  auto acc_arg = TensorArg(accumulator, "accumulator", 1);
+  auto indices_arg = TensorArg(indices, "indices", 3);
+  checkDim("_embedding_backward_accumulate_", acc_arg, 2);
+  checkScalarTypes("_embedding_backward_accumulate_", indices_arg, {kLong, kInt});
+  TORCH_CHECK(accumulator.is_contiguous(),
+      "_embedding_backward_accumulate_: accumulator must be contiguous");
+  TORCH_CHECK(grad_.size(-1) == accumulator.size(1),
+      "_embedding_backward_accumulate_: grad_output has embedding dim ", grad_.size(-1),
+      " but accumulator has embedding dim ", accumulator.size(1));
+
+  int64_t num_weights = accumulator.size(0);
+  auto indices_contig = indices.contiguous();
+  int64_t numel = indices.numel();
+  auto grad = grad_.contiguous().view({numel, grad_.size(-1)});
+  if (grad.scalar_type() != accumulator.scalar_type()) {
+    grad = grad.to(accumulator.scalar_type());
+  }
+
+  auto add_iter = TensorIteratorConfig()
+    .add_output(accumulator)
+    .add_input(accumulator)
+    .add_input(grad)
+    .resize_outputs(false)
+    .declare_static_shape(grad.sizes(), /*squash_dims=*/0)
+    .build();
+
+  const auto acc_data = reinterpret_cast<char*>(accumulator.data_ptr());
+  const auto gO_data = reinterpret_cast<char*>(grad.data_ptr());
+  const auto acc_stride = accumulator.strides()[0] * accumulator.element_size();
+  const auto gO_stride = grad.strides()[0] * grad.element_size();
+
+  AT_DISPATCH_INDEX_TYPES(indices.scalar_type(), "_embedding_backward_accumulate_cpu", [&] () {
+    auto indices_data = indices_contig.data_ptr<index_t>();
+
+    auto parallel_section = [&](index_t start, index_t end) {
+      TensorIterator iter(add_iter);
+      for (const auto i : c10::irange(numel)) {
+        index_t k = indices_data[i];
+        if (k != padding_idx && k >= start && k < end) {
+          // accumulator[k].add_(grad[i]);
+          iter.unsafe_replace_operand(0, acc_data + k * acc_stride);
+          iter.unsafe_replace_operand(1, acc_data + k * acc_stride);
+          iter.unsafe_replace_operand(2, gO_data + i * gO_stride);
+          add_stub(kCPU, iter, 1.0);
+        }
+      }
+    };
+
+    at::parallel_for(0, num_weights, 1000, parallel_section);
+
+  });
+
+  return accumulator;
+}
+
 Tensor & embedding_renorm_cpu_(
     Tensor & self, const Tensor & indices, double max_norm, double norm_type) {
   auto self_arg = TensorArg(self, "self", 1);
@@ -110,6 +110,58 @@ bool is_fast_path(const Tensor& src, const c10::optional<Tensor>& scale, Tensor&
          is_fast_path_index_select(src, output, padding_idx);
 }
 
+// Software prefetch distance (in indices) for the strided lookup loops
+// below. The rows visited are effectively random, so while row i is being
+// accumulated the row for index i + distance is requested, overlapping the
+// DRAM latency of the walk. FBGEMM's generated kernels use the same
+// distance on the fast path.
+constexpr int64_t kPrefetchDistance = 16;
+
+template <typename data_t>
+inline void prefetch_row(const data_t* row, int64_t row_bytes) {
+  constexpr int64_t kCacheLineBytes = 64;
+  constexpr int64_t kMaxPrefetchBytes = 8 * kCacheLineBytes;
+  const char* ptr = reinterpret_cast<const char*>(row);
+  const char* end = ptr + std::min(row_bytes, kMaxPrefetchBytes);
+  for (; ptr < end; ptr += kCacheLineBytes) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr, /*rw=*/0, /*locality=*/1);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(ptr, _MM_HINT_T1);
+#endif
+  }
+}
+
+/* Partitions the [0, numel) index positions of the strided lookup loops
+ * across threads. add_indices (offset2bag) is non-decreasing, so a bag is a
+ * contiguous run of equal values; chunk boundaries are realigned to bag
+ * boundaries so each bag's output row is accumulated by exactly one thread
+ * and no synchronization on the output is needed. The partial bag at the
+ * front of a chunk belongs to the previous chunk, which extends over it.
+ */
+template <typename index_t, typename func_t>
+void parallel_for_bags(
+    int64_t numel,
+    int64_t ddim,
+    const index_t* add_indices_data,
+    const func_t& f) {
+  int64_t grain_size = std::max(
+      int64_t(1), at::internal::GRAIN_SIZE / std::max(int64_t(1), ddim));
+  at::parallel_for(0, numel, grain_size, [&](int64_t start, int64_t end) {
+    while (start > 0 && start < numel &&
+           add_indices_data[start] == add_indices_data[start - 1]) {
+      start++;
+    }
+    while (end > 0 && end < numel &&
+           add_indices_data[end] == add_indices_data[end - 1]) {
+      end++;
+    }
+    if (start < end) {
+      f(start, end);
+    }
+  });
+}
+
 // This function combines index_select (using select_indices as the index) and
 // index_add (using add_indices as the index), without creating an intermediary
 // tensor to hold the selected embeddings
@@ -329,50 +381,63 @@ index_select_add(
     auto output_stride1 = output.strides()[1];
     auto numel = add_indices.numel();
 
-    Tensor src_fp32 = at::empty({ddim}, src.options().dtype(at::kFloat));
-    auto* src_data_fp32 = src_fp32.data_ptr<float>();
-
     // Initialize the intermediate output buffer to be 0.
     Tensor output_fp32 =
         at::zeros({output.size(0), ddim}, output.options().dtype(at::kFloat));
     auto* output_data_fp32 = output_fp32.data_ptr<float>();
 
-    for (const auto i : c10::irange(numel)) {
-      // We can skip indices equal to padding_idx so they are not included in
-      // the reduction
-      auto idx = select_indices_data[i];
-      TORCH_CHECK(
-          idx >= 0 && idx < vocab_size,
-          "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-          idx);
-      if (idx != padding_idx) {
-        // Copy src_data + src_stride0 * idx to src_data_fp32
-        for (const auto d : c10::irange(ddim)) {
-          src_data_fp32[d] = static_cast<float>(
-              (src_data + src_stride0 * idx)[d * src_stride1]);
+    parallel_for_bags(numel, ddim, add_indices_data, [&](int64_t start, int64_t end) {
+      // Per-thread fp32 scratch row for widening the 16 bit source
+      Tensor src_fp32 = at::empty({ddim}, src.options().dtype(at::kFloat));
+      auto* src_data_fp32 = src_fp32.data_ptr<float>();
+
+      for (const auto i : c10::irange(start, end)) {
+        // We can skip indices equal to padding_idx so they are not included in
+        // the reduction
+        auto idx = select_indices_data[i];
+        TORCH_CHECK(
+            idx >= 0 && idx < vocab_size,
+            "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
+            idx);
+        if (i + kPrefetchDistance < end) {
+          auto prefetch_idx = select_indices_data[i + kPrefetchDistance];
+          if (prefetch_idx >= 0 && prefetch_idx < vocab_size) {
+            prefetch_row(
+                src_data + src_stride0 * prefetch_idx,
+                ddim * src_stride1 * static_cast<int64_t>(sizeof(data_t)));
+          }
+        }
+        if (idx != padding_idx) {
+          // Copy src_data + src_stride0 * idx to src_data_fp32
+          for (const auto d : c10::irange(ddim)) {
+            src_data_fp32[d] = static_cast<float>(
+                (src_data + src_stride0 * idx)[d * src_stride1]);
+          }
+          at::native::cpublas::axpy<float>(
+              ddim,
+              1,
+              src_data_fp32,
+              1,
+              output_data_fp32 + ddim * add_indices_data[i],
+              1);
+
+        } else if (bag_size.defined()) {
+          // Decrement bag_size to reflect that the index is padded
+          // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
+          bag_size_data[add_indices_data[i]]--;
         }
-        at::native::cpublas::axpy<float>(
-            ddim,
-            1,
-            src_data_fp32,
-            1,
-            output_data_fp32 + ddim * add_indices_data[i],
-            1);
-
-      } else if (bag_size.defined()) {
-        // Decrement bag_size to reflect that the index is padded
-        // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
-        bag_size_data[add_indices_data[i]]--;
       }
-    }
-    for (const auto i : c10::irange(output.size(0))) {
-      // Convert FP32 intermediate buffer result back to 16 bit for output
-      // dtype
-      for (const auto d : c10::irange(ddim)) {
-        (output_data + output_stride0 * i)[d * output_stride1] =
-            static_cast<data_t>((output_data_fp32 + ddim * i)[d]);
+    });
+    at::parallel_for(0, output.size(0), 1, [&](int64_t start, int64_t end) {
+      for (const auto i : c10::irange(start, end)) {
+        // Convert FP32 intermediate buffer result back to 16 bit for output
+        // dtype
+        for (const auto d : c10::irange(ddim)) {
+          (output_data + output_stride0 * i)[d * output_stride1] =
+              static_cast<data_t>((output_data_fp32 + ddim * i)[d]);
+        }
       }
-    }
+    });
   }
 }
 template<typename data_t, typename index_t>
@@ -475,28 +540,38 @@ index_select_add(const Tensor &select_indices,
     auto output_stride0 = output.strides()[0];
     auto output_stride1 = output.strides()[1];
     auto numel = add_indices.numel();
-    for (const auto i : c10::irange(numel)) {
-      // We can skip indices equal to padding_idx so they are not included in
-      // the reduction
-      auto idx = select_indices_data[i];
-      TORCH_CHECK(
-          idx >= 0 && idx < vocab_size,
-          "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-          idx);
-      if (idx != padding_idx) {
-        at::native::cpublas::axpy<float>(
-            ddim,
-            1,
-            src_data + src_stride0 * idx,
-            src_stride1,
-            output_data + output_stride0 * add_indices_data[i],
-            output_stride1);
-      } else if (bag_size.defined()) {
-        // Decrement bag_size to reflect that the index is padded
-        // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
-        bag_size_data[add_indices_data[i]]--;
+    parallel_for_bags(numel, ddim, add_indices_data, [&](int64_t start, int64_t end) {
+      for (const auto i : c10::irange(start, end)) {
+        // We can skip indices equal to padding_idx so they are not included in
+        // the reduction
+        auto idx = select_indices_data[i];
+        TORCH_CHECK(
+            idx >= 0 && idx < vocab_size,
+            "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
+            idx);
+        if (i + kPrefetchDistance < end) {
+          auto prefetch_idx = select_indices_data[i + kPrefetchDistance];
+          if (prefetch_idx >= 0 && prefetch_idx < vocab_size) {
+            prefetch_row(
+                src_data + src_stride0 * prefetch_idx,
+                ddim * src_stride1 * sizeof(float));
+          }
+        }
+        if (idx != padding_idx) {
+          at::native::cpublas::axpy<float>(
+              ddim,
+              1,
+              src_data + src_stride0 * idx,
+              src_stride1,
+              output_data + output_stride0 * add_indices_data[i],
+              output_stride1);
+        } else if (bag_size.defined()) {
+          // Decrement bag_size to reflect that the index is padded
+          // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
+          bag_size_data[add_indices_data[i]]--;
+        }
       }
-    }
+    });
   }
 }
 
@@ -723,36 +798,48 @@ index_select_scale_add(
         at::zeros({output.size(0), ddim}, output.options().dtype(at::kFloat));
     auto* output_data_fp32 = output_fp32.data_ptr<float>();
 
-    for (const auto i : c10::irange(numel)) {
-      // We can skip indices equal to padding_idx so they are not included in
-      // the reduction
-      auto idx = select_indices_data[i];
-      TORCH_CHECK(
-          idx >= 0 && idx < vocab_size,
-          "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-          idx);
-      if (idx != padding_idx) {
-        auto* src_base = src_data + src_stride0 * idx;
-        auto* output_base_fp32 = output_data_fp32 + ddim * add_indices_data[i];
-        auto scale = scale_data[i * scale_stride];
-        for (const auto j : c10::irange(ddim)) {
-          output_base_fp32[j] += static_cast<float>(src_base[j * src_stride1]) *
-              static_cast<float>(scale);
+    parallel_for_bags(numel, ddim, add_indices_data, [&](int64_t start, int64_t end) {
+      for (const auto i : c10::irange(start, end)) {
+        // We can skip indices equal to padding_idx so they are not included in
+        // the reduction
+        auto idx = select_indices_data[i];
+        TORCH_CHECK(
+            idx >= 0 && idx < vocab_size,
+            "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
+            idx);
+        if (i + kPrefetchDistance < end) {
+          auto prefetch_idx = select_indices_data[i + kPrefetchDistance];
+          if (prefetch_idx >= 0 && prefetch_idx < vocab_size) {
+            prefetch_row(
+                src_data + src_stride0 * prefetch_idx,
+                ddim * src_stride1 * static_cast<int64_t>(sizeof(data_t)));
+          }
+        }
+        if (idx != padding_idx) {
+          auto* src_base = src_data + src_stride0 * idx;
+          auto* output_base_fp32 = output_data_fp32 + ddim * add_indices_data[i];
+          auto scale = scale_data[i * scale_stride];
+          for (const auto j : c10::irange(ddim)) {
+            output_base_fp32[j] += static_cast<float>(src_base[j * src_stride1]) *
+                static_cast<float>(scale);
+          }
+        } else if (bag_size.defined()) {
+          // Decrement bag_size to reflect that the index is padded
+          // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
+          bag_size_data[add_indices_data[i]]--;
         }
-      } else if (bag_size.defined()) {
-        // Decrement bag_size to reflect that the index is padded
-        // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
-        bag_size_data[add_indices_data[i]]--;
       }
-    }
-    for (const auto i : c10::irange(output.size(0))) {
-      // Convert FP32 intermediate buffer result back to 16 bit for output
-      // dtype
-      for (const auto d : c10::irange(ddim)) {
-        (output_data + output_stride0 * i)[d * output_stride1] =
-            static_cast<data_t>((output_data_fp32 + ddim * i)[d]);
+    });
+    at::parallel_for(0, output.size(0), 1, [&](int64_t start, int64_t end) {
+      for (const auto i : c10::irange(start, end)) {
+        // Convert FP32 intermediate buffer result back to 16 bit for output
+        // dtype
+        for (const auto d : c10::irange(ddim)) {
+          (output_data + output_stride0 * i)[d * output_stride1] =
+              static_cast<data_t>((output_data_fp32 + ddim * i)[d]);
+        }
       }
-    }
+    });
   }
 }
 template<typename data_t, typename index_t>
@@ -857,28 +944,37 @@ index_select_scale_add(const Tensor &select_indices,
     auto scale_stride = scale.strides()[0];
     auto numel = add_indices.numel();
 
-
-    for (const auto i : c10::irange(numel)) {
-      // We can skip indices equal to padding_idx so they are not included in
-      // the reduction
-      auto idx = select_indices_data[i];
-      TORCH_CHECK(
-          idx >= 0 && idx < vocab_size,
-          "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-          idx);
-      if (idx != padding_idx) {
-        auto* src_base = src_data + src_stride0 * idx;
-        auto* output_base = output_data + output_stride0 * add_indices_data[i];
-        auto scale = scale_data[i * scale_stride];
-        for (const auto j : c10::irange(ddim)) {
-          output_base[j * output_stride1] += src_base[j * src_stride1] * scale;
+    parallel_for_bags(numel, ddim, add_indices_data, [&](int64_t start, int64_t end) {
+      for (const auto i : c10::irange(start, end)) {
+        // We can skip indices equal to padding_idx so they are not included in
+        // the reduction
+        auto idx = select_indices_data[i];
+        TORCH_CHECK(
+            idx >= 0 && idx < vocab_size,
+            "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
+            idx);
+        if (i + kPrefetchDistance < end) {
+          auto prefetch_idx = select_indices_data[i + kPrefetchDistance];
+          if (prefetch_idx >= 0 && prefetch_idx < vocab_size) {
+            prefetch_row(
+                src_data + src_stride0 * prefetch_idx,
+                ddim * src_stride1 * sizeof(float));
+          }
+        }
+        if (idx != padding_idx) {
+          auto* src_base = src_data + src_stride0 * idx;
+          auto* output_base = output_data + output_stride0 * add_indices_data[i];
+          auto scale = scale_data[i * scale_stride];
+          for (const auto j : c10::irange(ddim)) {
+            output_base[j * output_stride1] += src_base[j * src_stride1] * scale;
+          }
+        } else if (bag_size.defined()) {
+          // Decrement bag_size to reflect that the index is padded
+          // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
+          bag_size_data[add_indices_data[i]]--;
         }
-      } else if (bag_size.defined()) {
-        // Decrement bag_size to reflect that the index is padded
-        // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
-        bag_size_data[add_indices_data[i]]--;
       }
-    }
+    });
   }
 }
 
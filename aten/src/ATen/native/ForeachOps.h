@@ -0,0 +1,28 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/native/DispatchStub.h>
+#include <c10/core/Scalar.h>
+
+namespace at { namespace native {
+
+// Which arithmetic op a flattened foreach CPU kernel applies. A single enum
+// (instead of one stub per op) lets one chunked multi-tensor pass serve all
+// four ops.
+enum class ForeachArithmeticOp : uint8_t { ADD, SUB, MUL, DIV };
+
+// results[i] = op(inputs[i], scalar). For the in-place variants `results`
+// aliases `inputs`. All tensors must satisfy check_fast_path_restrictions
+// plus be of a CPU-vectorizable floating dtype; callers are responsible for
+// falling back to the per-tensor loop otherwise.
+using foreach_binary_scalar_fn =
+    void (*)(TensorList, TensorList, const Scalar&, ForeachArithmeticOp);
+// results[i] = op(inputs1[i], alpha * inputs2[i]); alpha is only consumed by
+// ADD and SUB.
+using foreach_binary_list_fn =
+    void (*)(TensorList, TensorList, TensorList, const Scalar&, ForeachArithmeticOp);
+
+DECLARE_DISPATCH(foreach_binary_scalar_fn, foreach_binary_scalar_stub);
+DECLARE_DISPATCH(foreach_binary_list_fn, foreach_binary_list_stub);
+
+}} // namespace at::native
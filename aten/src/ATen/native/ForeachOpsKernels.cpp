@@ -1,6 +1,7 @@
 #include <vector>
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <ATen/core/Tensor.h>
+#include <ATen/native/ForeachOps.h>
 #include <ATen/native/ForeachUtils.h>
 #include <c10/util/irange.h>
 
@@ -51,6 +52,7 @@
 #include <ATen/ops/_foreach_clamp_min_native.h>
 #include <ATen/ops/_foreach_clamp_max_native.h>
 #include <ATen/ops/_foreach_pow_native.h>
+#include <ATen/ops/empty_like.h>
 #include <ATen/ops/linalg_vector_norm.h>
 #include <ATen/ops/maximum.h>
 #include <ATen/ops/minimum.h>
@@ -60,6 +62,33 @@
 
 namespace at { namespace native {
 
+DEFINE_DISPATCH(foreach_binary_scalar_stub);
+DEFINE_DISPATCH(foreach_binary_list_stub);
+
+namespace {
+
+// The vectorized multi-tensor kernels in cpu/ForeachOpsKernel.cpp only
+// handle dense floating-point CPU tensors; everything else takes the
+// per-tensor loops below. Note that the slow kernels also serve as the
+// fallback for other backends' fast paths, hence the explicit device check.
+bool foreach_cpu_kernel_tensors_ok(TensorList tensors) {
+  if (!tensors[0].is_cpu()) {
+    return false;
+  }
+  const auto st = tensors[0].scalar_type();
+  return st == kFloat || st == kDouble || st == kBFloat16;
+}
+
+// The fast path skips the per-tensor dispatches that would otherwise bump
+// the version counters, so bump them here like cuda/ForeachFunctors.cuh does.
+void increment_version(TensorList tensors) {
+  for (const auto& t : tensors) {
+    t.unsafeGetTensorImpl()->bump_version();
+  }
+}
+
+} // namespace
+
 #define FOREACH_BINARY_OP_SCALAR(OP)                                                                      \
 void foreach_tensor_##OP##_scalar_kernel_slow_(TensorList tensors, const Scalar& scalar) {                       \
   check_foreach_api_restrictions(tensors);                                                                \
@@ -81,6 +110,41 @@ std::vector<Tensor> foreach_tensor_##OP##_scalar_kernel_slow(TensorList tensors,
   return result;                                                                                          \
 }
 
+// Same as FOREACH_BINARY_OP_SCALAR, but routes eligible inputs through the
+// vectorized multi-tensor kernel instead of dispatching one op per tensor.
+#define FOREACH_BINARY_OP_SCALAR_VEC(OP, OP_ENUM, DIV_OP)                                                 \
+void foreach_tensor_##OP##_scalar_kernel_slow_(TensorList tensors, const Scalar& scalar) {                \
+  check_foreach_api_restrictions(tensors);                                                                \
+                                                                                                          \
+  if (foreach_cpu_kernel_tensors_ok(tensors) && can_use_fast_route({tensors}, {scalar}, DIV_OP)) {        \
+    foreach_binary_scalar_stub(kCPU, tensors, tensors, scalar, ForeachArithmeticOp::OP_ENUM);             \
+    increment_version(tensors);                                                                           \
+    return;                                                                                               \
+  }                                                                                                       \
+  for (auto& t: tensors) {                                                                                \
+    t.OP##_(scalar);                                                                                      \
+  }                                                                                                       \
+}                                                                                                         \
+                                                                                                          \
+std::vector<Tensor> foreach_tensor_##OP##_scalar_kernel_slow(TensorList tensors, const Scalar& scalar) {  \
+  check_foreach_api_restrictions(tensors);                                                                \
+                                                                                                          \
+  std::vector<Tensor> result;                                                                             \
+  result.reserve(tensors.size());                                                                         \
+  if (foreach_cpu_kernel_tensors_ok(tensors) && can_use_fast_route({tensors}, {scalar}, DIV_OP)) {        \
+    for (const auto& t: tensors) {                                                                        \
+      result.emplace_back(at::empty_like(t));                                                             \
+    }                                                                                                     \
+    foreach_binary_scalar_stub(kCPU, result, tensors, scalar, ForeachArithmeticOp::OP_ENUM);              \
+    return result;                                                                                        \
+  }                                                                                                       \
+  for (const auto& t: tensors) {                                                                          \
+    result.emplace_back(t.OP(scalar));                                                                    \
+  }                                                                                                       \
+                                                                                                          \
+  return result;                                                                                          \
+}
+
 #define FOREACH_BINARY_OP_SCALARLIST(OP)                                                                                \
 void foreach_tensor_##OP##_scalarlist_kernel_slow_(TensorList tensors, at::ArrayRef<Scalar> scalars) {                  \
   check_foreach_api_restrictions(tensors, scalars);                                                                     \
@@ -122,6 +186,40 @@ void foreach_tensor_##OP##_list_kernel_slow_(TensorList tensors1, TensorList ten
   }                                                                                                       \
 }
 
+// Vectorized counterpart of FOREACH_BINARY_OP_LIST; alpha is fixed to 1.
+#define FOREACH_BINARY_OP_LIST_VEC(OP, OP_ENUM, DIV_OP)                                                   \
+std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1, TensorList tensors2) {    \
+  check_foreach_api_restrictions(tensors1, tensors2);                                                     \
+                                                                                                          \
+  std::vector<Tensor> result;                                                                             \
+  result.reserve(tensors1.size());                                                                        \
+  if (foreach_cpu_kernel_tensors_ok(tensors1) && can_use_fast_route(tensors1, tensors2, DIV_OP)) {        \
+    for (const auto& t: tensors1) {                                                                       \
+      result.emplace_back(at::empty_like(t));                                                             \
+    }                                                                                                     \
+    foreach_binary_list_stub(kCPU, result, tensors1, tensors2, 1, ForeachArithmeticOp::OP_ENUM);          \
+    return result;                                                                                        \
+  }                                                                                                       \
+  for (const auto i : c10::irange(tensors1.size())) {                                                     \
+    result.emplace_back(tensors1[i].OP(tensors2[i]));                                                     \
+  }                                                                                                       \
+                                                                                                          \
+  return result;                                                                                          \
+}                                                                                                         \
+                                                                                                          \
+void foreach_tensor_##OP##_list_kernel_slow_(TensorList tensors1, TensorList tensors2) {                  \
+  check_foreach_api_restrictions(tensors1, tensors2);                                                     \
+                                                                                                          \
+  if (foreach_cpu_kernel_tensors_ok(tensors1) && can_use_fast_route(tensors1, tensors2, DIV_OP)) {        \
+    foreach_binary_list_stub(kCPU, tensors1, tensors1, tensors2, 1, ForeachArithmeticOp::OP_ENUM);        \
+    increment_version(tensors1);                                                                          \
+    return;                                                                                               \
+  }                                                                                                       \
+  for (const auto i : c10::irange(tensors1.size())) {                                                     \
+    tensors1[i].OP##_(tensors2[i]);                                                                       \
+  }                                                                                                       \
+}
+
 #define FOREACH_BINARY_OP_LIST_ALPHA(OP)                                                                                \
 std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1, TensorList tensors2, const Scalar& alpha) {    \
   check_foreach_api_restrictions(tensors1, tensors2);                                                                   \
@@ -143,6 +241,40 @@ void foreach_tensor_##OP##_list_kernel_slow_(TensorList tensors1, TensorList ten
   }                                                                                                                     \
 }
 
+// Vectorized counterpart of FOREACH_BINARY_OP_LIST_ALPHA.
+#define FOREACH_BINARY_OP_LIST_ALPHA_VEC(OP, OP_ENUM)                                                                          \
+std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1, TensorList tensors2, const Scalar& alpha) {    \
+  check_foreach_api_restrictions(tensors1, tensors2);                                                                          \
+                                                                                                                               \
+  std::vector<Tensor> result;                                                                                                  \
+  result.reserve(tensors1.size());                                                                                             \
+  if (foreach_cpu_kernel_tensors_ok(tensors1) && can_use_fast_route({tensors1, tensors2}, {alpha})) {                          \
+    for (const auto& t: tensors1) {                                                                                            \
+      result.emplace_back(at::empty_like(t));                                                                                  \
+    }                                                                                                                          \
+    foreach_binary_list_stub(kCPU, result, tensors1, tensors2, alpha, ForeachArithmeticOp::OP_ENUM);                           \
+    return result;                                                                                                             \
+  }                                                                                                                            \
+  for (const auto i : c10::irange(tensors1.size())) {                                                                          \
+    result.emplace_back(tensors1[i].OP(tensors2[i], alpha));                                                                   \
+  }                                                                                                                            \
+                                                                                                                               \
+  return result;                                                                                                               \
+}                                                                                                                              \
+                                                                                                                               \
+void foreach_tensor_##OP##_list_kernel_slow_(TensorList tensors1, TensorList tensors2, const Scalar& alpha) {                  \
+  check_foreach_api_restrictions(tensors1, tensors2);                                                                          \
+                                                                                                                               \
+  if (foreach_cpu_kernel_tensors_ok(tensors1) && can_use_fast_route({tensors1, tensors2}, {alpha})) {                          \
+    foreach_binary_list_stub(kCPU, tensors1, tensors1, tensors2, alpha, ForeachArithmeticOp::OP_ENUM);                         \
+    increment_version(tensors1);                                                                                               \
+    return;                                                                                                                    \
+  }                                                                                                                            \
+  for (const auto i : c10::irange(tensors1.size())) {                                                                          \
+    tensors1[i].OP##_(tensors2[i], alpha);                                                                                     \
+  }                                                                                                                            \
+}
+
 #define FOREACH_UNARY_OP(OP)                                               \
 std::vector<Tensor> foreach_tensor_##OP##_slow(TensorList tensors) {       \
   check_foreach_api_restrictions(tensors);                                 \
@@ -227,14 +359,14 @@ void foreach_tensor_##OP##_scalarlist_slow_(TensorList input, TensorList tensors
         input, tensors1, tensors2, scalars);                               \
   }
 
-FOREACH_BINARY_OP_LIST_ALPHA(add);
-FOREACH_BINARY_OP_LIST_ALPHA(sub);
+FOREACH_BINARY_OP_LIST_ALPHA_VEC(add, ADD);
+FOREACH_BINARY_OP_LIST_ALPHA_VEC(sub, SUB);
 FOREACH_BINARY_OP_LIST_ALPHA(lerp);
 
-FOREACH_BINARY_OP_SCALAR(add);
-FOREACH_BINARY_OP_SCALAR(sub);
-FOREACH_BINARY_OP_SCALAR(mul);
-FOREACH_BINARY_OP_SCALAR(div);
+FOREACH_BINARY_OP_SCALAR_VEC(add, ADD, /*div_op*/ false);
+FOREACH_BINARY_OP_SCALAR_VEC(sub, SUB, /*div_op*/ false);
+FOREACH_BINARY_OP_SCALAR_VEC(mul, MUL, /*div_op*/ false);
+FOREACH_BINARY_OP_SCALAR_VEC(div, DIV, /*div_op*/ true);
 FOREACH_BINARY_OP_SCALAR(clamp_min);
 FOREACH_BINARY_OP_SCALAR(clamp_max);
 FOREACH_BINARY_OP_SCALAR(pow);
@@ -247,8 +379,8 @@ FOREACH_BINARY_OP_SCALARLIST(clamp_min);
 FOREACH_BINARY_OP_SCALARLIST(clamp_max);
 FOREACH_BINARY_OP_SCALARLIST(pow);
 
-FOREACH_BINARY_OP_LIST(mul);
-FOREACH_BINARY_OP_LIST(div);
+FOREACH_BINARY_OP_LIST_VEC(mul, MUL, /*div_op*/ false);
+FOREACH_BINARY_OP_LIST_VEC(div, DIV, /*div_op*/ true);
 FOREACH_BINARY_OP_LIST(clamp_min);
 FOREACH_BINARY_OP_LIST(clamp_max);
 FOREACH_BINARY_OP_LIST(pow);
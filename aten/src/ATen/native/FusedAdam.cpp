@@ -0,0 +1,118 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/native/FusedAdam.h>
+#include <ATen/native/ForeachUtils.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_adam_native.h>
+#include <ATen/ops/_fused_adamw_native.h>
+#endif
+
+namespace at { namespace native {
+
+DEFINE_DISPATCH(fused_adam_stub);
+
+namespace {
+
+void fused_adam_cpu_impl(
+    at::TensorList params,
+    at::TensorList grads,
+    at::TensorList exp_avgs,
+    at::TensorList exp_avg_sqs,
+    at::TensorList max_exp_avg_sqs,
+    at::TensorList state_steps,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const c10::optional<at::Tensor>& grad_scale,
+    const c10::optional<at::Tensor>& found_inf,
+    const ADAM_MODE adam_mode) {
+  if (amsgrad) {
+    TORCH_CHECK(
+        check_fast_path_restrictions({params, grads, exp_avgs, exp_avg_sqs, max_exp_avg_sqs}),
+        "params, grads, exp_avgs, exp_avg_sqs, and max_exp_avg_sqs must have same dtype, device, and layout");
+  } else {
+    TORCH_CHECK(
+        check_fast_path_restrictions({params, grads, exp_avgs, exp_avg_sqs}),
+        "params, grads, exp_avgs, and exp_avg_sqs must have same dtype, device, and layout");
+  }
+  TORCH_CHECK(
+      !grad_scale.has_value() && !found_inf.has_value(),
+      "grad_scale and found_inf are not supported by the fused CPU kernels");
+  for (const auto i : c10::irange(params.size())) {
+    TORCH_CHECK(
+        state_steps[i].is_cpu() && state_steps[i].scalar_type() == kFloat,
+        "state_steps must be float CPU tensors");
+    fused_adam_stub(
+        kCPU,
+        params[i],
+        grads[i],
+        exp_avgs[i],
+        exp_avg_sqs[i],
+        amsgrad ? max_exp_avg_sqs[i] : Tensor(),
+        state_steps[i],
+        lr,
+        beta1,
+        beta2,
+        weight_decay,
+        eps,
+        amsgrad,
+        maximize,
+        adam_mode);
+  }
+}
+
+} // namespace
+
+void _fused_adam_kernel_cpu_(
+    at::TensorList params,
+    at::TensorList grads,
+    at::TensorList exp_avgs,
+    at::TensorList exp_avg_sqs,
+    at::TensorList max_exp_avg_sqs,
+    at::TensorList state_steps,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const c10::optional<at::Tensor>& grad_scale,
+    const c10::optional<at::Tensor>& found_inf) {
+  fused_adam_cpu_impl(
+      params, grads, exp_avgs, exp_avg_sqs, max_exp_avg_sqs, state_steps,
+      lr, beta1, beta2, weight_decay, eps, amsgrad, maximize,
+      grad_scale, found_inf, ADAM_MODE::ORIGINAL);
+}
+
+void _fused_adamw_kernel_cpu_(
+    at::TensorList params,
+    at::TensorList grads,
+    at::TensorList exp_avgs,
+    at::TensorList exp_avg_sqs,
+    at::TensorList max_exp_avg_sqs,
+    at::TensorList state_steps,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const c10::optional<at::Tensor>& grad_scale,
+    const c10::optional<at::Tensor>& found_inf) {
+  fused_adam_cpu_impl(
+      params, grads, exp_avgs, exp_avg_sqs, max_exp_avg_sqs, state_steps,
+      lr, beta1, beta2, weight_decay, eps, amsgrad, maximize,
+      grad_scale, found_inf, ADAM_MODE::ADAMW);
+}
+
+}} // namespace at::native
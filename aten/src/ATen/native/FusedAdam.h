@@ -0,0 +1,34 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at { namespace native {
+
+enum class ADAM_MODE: uint8_t {
+  ORIGINAL = 0,
+  ADAMW = 1
+};
+
+// Single-tensor fused Adam/AdamW step. `max_exp_avg_sq` may be undefined
+// when `amsgrad` is false, and `state_step` is a scalar float tensor holding
+// the (already incremented) step count.
+using fused_adam_fn = void (*)(
+    const at::Tensor& param,
+    const at::Tensor& grad,
+    const at::Tensor& exp_avg,
+    const at::Tensor& exp_avg_sq,
+    const at::Tensor& max_exp_avg_sq,
+    const at::Tensor& state_step,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const ADAM_MODE adam_mode);
+
+DECLARE_DISPATCH(fused_adam_fn, fused_adam_stub);
+
+}} // namespace at::native
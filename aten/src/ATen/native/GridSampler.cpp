@@ -936,8 +936,10 @@ Tensor grid_sampler_2d_cpu(const Tensor& input, const Tensor& grid,
 
   auto in_size = input.sizes();
   auto grid_size = grid.sizes();
+  // Preserve channels-last so the kernel can take its channels-last path
   auto output = at::empty(
-      {in_size[0], in_size[1], grid_size[1], grid_size[2]}, input.options());
+      {in_size[0], in_size[1], grid_size[1], grid_size[2]},
+      input.options().memory_format(input.suggest_memory_format()));
   grid_sampler_2d_cpu_kernel(
       kCPU, output, input, grid, interpolation_mode, padding_mode, align_corners);
   return output;
@@ -1613,7 +1613,9 @@ void baddbmm_with_gemm_(const Tensor &result, const Tensor &mat1, const Tensor &
 // This tries to apply some optimizations to bmm/baddbmm:
 // - When the operand size is small, computation are parallelized over the batch
 //   dimension using OMP and naive matrix multiplication is applied.
-// - When the operand size is larger than the threshold, if compiled with MKL, MKL's batch gemm is used.
+// - When the operand size is larger than the threshold and the layout allows it,
+//   cpublas::gemm_batched_with_stride is used (MKL's batch gemm when available,
+//   otherwise an internal batch-parallel fallback).
 // - Otherwise, we use a series of matrix multiplications.
 // The threshold of 400 for the first has not been thoroughly benchmarked yet and may have room for further
 // optimization, it likely depends on the characteristics of the CPU, MKL will be different from non-MKL etc.,
@@ -1667,13 +1669,18 @@ static inline void bmm_out_or_baddbmm_(const Tensor& self_or_result_, const Tens
           baddbmm_cpu_kernel<scalar_t, false>(self_or_result, batch1, batch2, beta, alpha);
         });
     }
-  } else if (at::hasMKL() && ((
+  } else if ((self_or_result.scalar_type() == kFloat ||
+            self_or_result.scalar_type() == kDouble ||
+            at::native::is_complex(self_or_result) ||
+            (at::hasMKL() &&
             self_or_result.scalar_type() != kBFloat16 &&
-            at::native::is_floating_point(self_or_result)) ||
-            at::native::is_complex(self_or_result))
+            at::native::is_floating_point(self_or_result)))
             && batch_items_contiguous_or_transposed(batch1)
             && batch_items_contiguous_or_transposed(batch2)
             && self_or_result.is_contiguous()) {
+    // Without MKL, gemm_batched_with_stride falls back internally to a
+    // batch-parallel loop of single gemms, which still beats dispatching
+    // addmm per batch entry below.
     baddbmm_with_gemm_(self_or_result, batch1, batch2, beta, alpha);
   } else { // split along batch dimension
 #ifdef C10_MOBILE
@@ -3,7 +3,9 @@
 
 #include <ATen/core/Tensor.h>
 #include <ATen/core/List.h>
+#include <ATen/core/grad_mode.h>
 #include <ATen/Context.h>
+#include <ATen/Parallel.h>
 #include <ATen/TensorOperators.h>
 #include <ATen/native/quantized/PackedParams.h>
 #include <ATen/native/quantized/cpu/fbgemm_utils.h>
@@ -13,6 +15,10 @@
 #include <torch/library.h>
 #include <ATen/Config.h>
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
@@ -1083,6 +1089,187 @@ apply_layer_stack(const Layer<io_type, hidden_type, weight_type>& layer, const i
   return {layer_input, final_hiddens};
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Note [Wavefront LSTM stack on CPU]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// In a stacked unidirectional LSTM, layer l at timestep t depends only on
+// layer l at timestep t - 1 and layer l - 1 at timestep t. apply_layer_stack
+// nevertheless runs the layers strictly one after another, so while layer 0
+// is at timestep t the rest of the stack sits idle, even though layer 1
+// could already be at timestep t - 1, layer 2 at t - 2, and so on. The
+// per-timestep recurrent GEMMs are too small to fill a socket on their own,
+// so for multi-layer inference each layer runs as its own inter-op task and
+// the layers are pipelined: every layer streams its per-timestep outputs to
+// its successor through a single-producer single-consumer channel. Layer 0
+// still computes its input-side GEMM over all timesteps in one matmul,
+// exactly as FullLayer does; deeper layers compute it per timestep since
+// their inputs only materialize step by step, but those GEMMs now overlap
+// across layers.
+
+// Single-producer single-consumer stream of per-timestep tensors between two
+// adjacent layers of the wavefront. Slots are filled in timestep order.
+struct WavefrontChannel {
+  explicit WavefrontChannel(int64_t num_steps) : steps_(num_steps) {}
+
+  void push(int64_t idx, Tensor value) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      steps_[idx] = std::move(value);
+      ready_ = idx + 1;
+    }
+    cv_.notify_one();
+  }
+
+  Tensor pop(int64_t idx) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return aborted_ || ready_ > idx; });
+    TORCH_CHECK(!aborted_, "wavefront LSTM: producer layer failed");
+    return std::move(steps_[idx]);
+  }
+
+  void abort() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      aborted_ = true;
+    }
+    cv_.notify_all();
+  }
+
+ private:
+  std::vector<Tensor> steps_;
+  int64_t ready_ = 0;
+  bool aborted_ = false;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+bool use_wavefront_lstm(
+    const Tensor& input,
+    int64_t num_layers,
+    bool train,
+    bool bidirectional) {
+  // Bidirectional stacks consume the whole sequence of both directions at
+  // every layer boundary, which leaves no wavefront to exploit. Training is
+  // excluded so the pipeline never interacts with dropout or autograd.
+  return input.device().is_cpu() && !bidirectional && !train &&
+      !at::GradMode::is_enabled() && num_layers > 1 && input.size(0) > 1 &&
+      at::get_num_interop_threads() > 1;
+}
+
+template <typename cell_params>
+std::tuple<Tensor, Tensor, Tensor> wavefront_lstm(
+    const Tensor& input,
+    const std::vector<cell_params>& params,
+    const Tensor& hx,
+    const Tensor& cx,
+    int64_t num_layers) {
+  using hidden_type = typename LSTMCell<cell_params>::hidden_type;
+  const int64_t num_steps = input.size(0);
+
+  auto layer_hx = hx.unbind(0);
+  auto layer_cx = cx.unbind(0);
+
+  std::vector<std::shared_ptr<WavefrontChannel>> channels;
+  channels.reserve(num_layers - 1);
+  for (const auto l : c10::irange(num_layers - 1)) {
+    (void)l;
+    channels.emplace_back(std::make_shared<WavefrontChannel>(num_steps));
+  }
+
+  std::vector<hidden_type> final_hiddens(num_layers);
+  std::vector<Tensor> step_outputs(num_steps);
+
+  // Joined below before final_hiddens is read; holds the first exception
+  // raised by a worker layer.
+  struct {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int64_t pending;
+    std::exception_ptr error;
+  } sync;
+  sync.pending = num_layers - 1;
+
+  LSTMCell<cell_params> cell;
+  auto run_layer = [&](int64_t l) {
+    // Inter-op threads come up with grad mode enabled; mirror the caller.
+    at::NoGradGuard no_grad;
+    auto hidden = std::make_tuple(layer_hx[l], layer_cx[l]);
+    const auto& layer_params = params[l];
+    const bool last = l == num_layers - 1;
+    if (l == 0) {
+      auto step_inputs = layer_params.linear_ih(input).unbind(0);
+      for (const auto t : c10::irange(num_steps)) {
+        hidden = cell(step_inputs[t], hidden, layer_params, true);
+        channels[0]->push(t, hidden_as_output(hidden));
+      }
+    } else {
+      for (const auto t : c10::irange(num_steps)) {
+        auto step_input = channels[l - 1]->pop(t);
+        hidden = cell(step_input, hidden, layer_params);
+        if (last) {
+          step_outputs[t] = hidden_as_output(hidden);
+        } else {
+          channels[l]->push(t, hidden_as_output(hidden));
+        }
+      }
+    }
+    final_hiddens[l] = std::move(hidden);
+  };
+
+  for (const auto l : c10::irange(num_layers - 1)) {
+    at::launch([&, l] {
+      try {
+        run_layer(l);
+      } catch (...) {
+        {
+          std::lock_guard<std::mutex> lock(sync.mutex);
+          if (!sync.error) {
+            sync.error = std::current_exception();
+          }
+        }
+        // Unblock this layer's consumer; the abort propagates down the
+        // stack as each consumer rethrows in turn.
+        channels[l]->abort();
+      }
+      {
+        std::lock_guard<std::mutex> lock(sync.mutex);
+        --sync.pending;
+      }
+      sync.cv.notify_one();
+    });
+  }
+
+  // The last layer runs on the calling thread. If a producer aborted, the
+  // exception is reported after the remaining workers have drained, since
+  // they reference this frame.
+  std::exception_ptr last_layer_error;
+  try {
+    run_layer(num_layers - 1);
+  } catch (...) {
+    last_layer_error = std::current_exception();
+  }
+  {
+    std::unique_lock<std::mutex> lock(sync.mutex);
+    sync.cv.wait(lock, [&] { return sync.pending == 0; });
+  }
+  if (sync.error) {
+    std::rethrow_exception(sync.error);
+  }
+  if (last_layer_error) {
+    std::rethrow_exception(last_layer_error);
+  }
+
+  std::vector<Tensor> hy, cy;
+  hy.reserve(num_layers);
+  cy.reserve(num_layers);
+  for (auto& hidden : final_hiddens) {
+    hy.push_back(std::move(std::get<0>(hidden)));
+    cy.push_back(std::move(std::get<1>(hidden)));
+  }
+  return std::make_tuple(
+      at::stack(step_outputs, 0), at::stack(hy, 0), at::stack(cy, 0));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // HELPERS SIMPLIFYING DISPATCH TO FUNCTIONS ABOVE
 ////////////////////////////////////////////////////////////////////////////////
@@ -1463,6 +1650,14 @@ std::tuple<Tensor, Tensor, Tensor> lstm(
   check_attributes(_input, _params, hx);
   auto input = batch_first ? _input.transpose(0, 1) : _input;
   auto params = gather_params(_params, has_biases, has_projections);
+  if (use_wavefront_lstm(input, num_layers, train, bidirectional)) {
+    // See Note [Wavefront LSTM stack on CPU]
+    auto results = wavefront_lstm(input, params, hx[0], hx[1], num_layers);
+    if (batch_first) {
+      std::get<0>(results) = std::get<0>(results).transpose(0, 1);
+    }
+    return results;
+  }
   auto results = _lstm_impl<FullLayer, FullBidirectionalLayer>(
       input, params, hx[0], hx[1], num_layers, dropout_p, train, bidirectional);
   if (batch_first) {
@@ -88,19 +88,67 @@ const Tensor& _resize_output_(const Tensor& self, IntArrayRef shape, c10::Device
 void resize_bytes_cpu(StorageImpl* storage, size_t size_bytes) {
   TORCH_CHECK(storage->resizable(), "Trying to resize storage that is not resizable");
 
+  // Capacity-reserved storages (see reserve_bytes_cpu) resize within
+  // capacity without touching the buffer; ordinary storages keep their
+  // historical reallocate-and-copy behavior.
+  if (storage->is_capacity_reserved() &&
+      size_bytes <= storage->capacity_bytes()) {
+    storage->set_nbytes(size_bytes);
+    return;
+  }
+
+  // Once capacity has been reserved, grow geometrically so a sequence of
+  // incremental resize_ calls stays amortized O(1). Reservation is sticky:
+  // a reserved storage stays reserved across reallocations.
+  const bool reserved = storage->is_capacity_reserved();
+  size_t alloc_bytes = size_bytes;
+  if (reserved) {
+    alloc_bytes = std::max(size_bytes, storage->capacity_bytes() * 2);
+  }
+
   at::DataPtr new_data;
-  if (size_bytes != 0) {
-    new_data = storage->allocator()->allocate(size_bytes);
+  if (alloc_bytes != 0) {
+    new_data = storage->allocator()->allocate(alloc_bytes);
   }
   at::DataPtr old_data = storage->set_data_ptr(std::move(new_data));
   const auto old_capacity = storage->nbytes();
   storage->set_nbytes(size_bytes);
+  storage->set_capacity_bytes(reserved ? alloc_bytes : 0);
   const auto copy_capacity = std::min(size_bytes, old_capacity);
   if (old_data != nullptr && copy_capacity > 0) {
     memcpy(storage->data(), old_data.get(), copy_capacity);
   }
 }
 
+void reserve_bytes_cpu(StorageImpl* storage, size_t size_bytes) {
+  TORCH_CHECK(
+      storage->resizable(),
+      "Trying to reserve capacity on storage that is not resizable");
+
+  if (size_bytes > storage->capacity_bytes()) {
+    at::DataPtr new_data = storage->allocator()->allocate(size_bytes);
+    at::DataPtr old_data = storage->set_data_ptr(std::move(new_data));
+    const auto old_size = storage->nbytes();
+    if (old_data != nullptr && old_size > 0) {
+      memcpy(storage->data(), old_data.get(), old_size);
+    }
+  }
+  // Record the capacity even when no reallocation happened so that future
+  // growth uses the geometric policy in resize_bytes_cpu.
+  storage->set_capacity_bytes(std::max(size_bytes, storage->capacity_bytes()));
+}
+
+const Tensor& reserve_(const Tensor& self, int64_t numel) {
+  TORCH_CHECK(
+      self.is_cpu(), "reserve_ is currently only supported for CPU tensors");
+  TORCH_CHECK(numel >= 0, "reserve_: numel must be non-negative, got ", numel);
+  const size_t size_bytes =
+      (static_cast<size_t>(self.storage_offset()) + static_cast<size_t>(numel)) *
+      self.dtype().itemsize();
+  reserve_bytes_cpu(self.storage().unsafeGetStorageImpl(), size_bytes);
+  return self;
+}
+
 // Call the sparse implementation in SparseTensor.cpp directly.
 // A dynamic dispatch here is NOT necessary, so I didn't put
 // this function in native_functions.yaml
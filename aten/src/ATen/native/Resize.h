@@ -35,6 +35,17 @@ TORCH_API bool resize_output_check_symint(const Tensor& output, SymIntArrayRef s
 
 TORCH_API void resize_bytes_cpu(StorageImpl* storage, size_t size_bytes);
 
+// Grows the buffer behind `storage` to at least `size_bytes` (preserving
+// its contents) and marks the storage as capacity-reserved: subsequent
+// resize_ calls within capacity become metadata-only, and growth past
+// capacity reallocates geometrically. This is what makes append-style
+// resize_ patterns amortized O(1) instead of quadratic.
+TORCH_API void reserve_bytes_cpu(StorageImpl* storage, size_t size_bytes);
+
+// Tensor-level convenience for reserve_bytes_cpu: reserves capacity for
+// `numel` elements of self's dtype past self's storage offset.
+TORCH_API const Tensor& reserve_(const Tensor& self, int64_t numel);
+
 static inline void maybe_resize_storage_cpu(TensorImpl* self, size_t new_size_bytes) {
   // It does not make sense to try to resize a storage
   // to hold 0 elements, and this can break
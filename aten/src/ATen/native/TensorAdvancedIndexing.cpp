@@ -134,6 +134,7 @@
 #include <c10/util/Unroll.h>
 
 #include <algorithm>
+#include <cstring>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -1860,7 +1861,9 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   std::tie(_mask, _self) = expand_outplace(mask, self);
 
   auto shape = _self->sizes();
-  int64_t numel = _mask->sum().item().toLong();
+  // Count through the same optimized path as count_nonzero/nonzero (parallel,
+  // word-at-a-time for boolean masks) rather than a widening sum.
+  int64_t numel = at::count_nonzero(*_mask, IntArrayRef{}).item().toLong();
   at::native::resize_output(result, {numel});
   if (numel == 0) {
     return result;
@@ -2053,6 +2056,40 @@ int64_t count_nonzero_impl(TensorIteratorBase& iter, Range range) {
     constexpr int ilp_factor = 4;
     const char* ptr = data[0];
     const auto stride = strides[0];
+
+    if constexpr (sizeof(scalar_t) == 1) {
+      if (stride == 1) {
+        // One-byte dtypes with unit stride (the common boolean mask case)
+        // are counted a word at a time: every byte is reduced to 1 if
+        // nonzero, the bits are summed as packed byte counters, and the
+        // counters are spilled every 31 words so the final horizontal byte
+        // sum stays below 256.
+        int64_t count = 0;
+        int64_t i = 0;
+        while (n - i >= 8) {
+          const int64_t rounds = std::min<int64_t>((n - i) / 8, 31);
+          uint64_t acc = 0;
+          for (const auto r C10_UNUSED : c10::irange(rounds)) {
+            uint64_t word;
+            std::memcpy(&word, ptr, sizeof(word));
+            ptr += sizeof(word);
+            word |= word >> 4;
+            word |= word >> 2;
+            word |= word >> 1;
+            acc += word & 0x0101010101010101ull;
+          }
+          count += (acc * 0x0101010101010101ull) >> 56;
+          i += rounds * 8;
+        }
+        for (; i < n; ++i) {
+          count += (*ptr != 0);
+          ++ptr;
+        }
+        num_nonzero += count;
+        return;
+      }
+    }
+
     int64_t nonzero[ilp_factor] = {0};
 
     int64_t i = 0;
@@ -35,7 +35,20 @@ void TensorIteratorBase::parallel_reduce(loop2d_t loop) {
 }
 
 static bool use_two_pass_reduction(TensorIteratorBase& iter) {
-  return iter.output(0).numel() == 1;
+  const auto& out = iter.output(0);
+  if (out.numel() == 1) {
+    return true;
+  }
+  // With fewer output elements than threads, splitting a non-reduced dim
+  // cannot occupy the machine (a (4, N) sum over dim 1 would use 4 cores),
+  // so long reductions also take the two-pass path: each thread reduces a
+  // slice of the flat range into its own copy of the output and the copies
+  // are combined by the final reduction. The buffer setup assumes the
+  // output operand keeps one (size-1) dim per reduced dim, which is how
+  // reduction iterators are built; anything else falls through.
+  return out.dim() == iter.input(0).dim() &&
+      out.numel() < at::get_num_threads() &&
+      iter.numel() >= out.numel() * at::internal::GRAIN_SIZE;
 }
 
 static void two_pass_reduction(TensorIteratorBase& iter, loop2d_t loop) {
@@ -136,7 +149,14 @@ void TensorIteratorBase::foreach_reduced_elt(loop_subiter_t loop, bool paralleli
     loop(*this);
   }
   else if (numel() < at::internal::GRAIN_SIZE || at::get_num_threads() == 1 ||
-      at::in_parallel_region() || !parallelize) {
+      at::in_parallel_region() || !parallelize ||
+      // With fewer reduced elements than threads, splitting over the
+      // non-reduced dims leaves cores idle. Visiting the elements serially
+      // keeps each `loop` call outside a parallel region, so the callers
+      // that split long reductions internally (e.g. binary_kernel_reduce)
+      // can parallelize within each one instead.
+      (output(0).numel() < at::get_num_threads() &&
+       numel() >= output(0).numel() * at::internal::GRAIN_SIZE)) {
     auto reduce_dims = num_reduce_dims();
 
     auto non_reduced_shape = shape.slice(reduce_dims, shape.size() - reduce_dims);
@@ -10,6 +10,7 @@
 #include <ATen/InferSize.h>
 #include <ATen/MemoryOverlap.h>
 #include <ATen/NamedTensorUtils.h>
+#include <ATen/Parallel.h>
 #include <ATen/SparseCsrTensorUtils.h>
 #include <ATen/SparseTensorUtils.h>
 #include <ATen/TensorOperators.h>
@@ -59,6 +60,7 @@
 #include <ATen/ops/_sparse_csr_tensor_unsafe.h>
 #include <ATen/ops/_sparse_csr_tensor_unsafe_native.h>
 #include <ATen/ops/_stack_native.h>
+#include <ATen/ops/_stack_parallel_native.h>
 #include <ATen/ops/_unsafe_view.h>
 #include <ATen/ops/_unsafe_view_native.h>
 #include <ATen/ops/_values_copy_native.h>
@@ -349,6 +351,7 @@ TORCH_PRECOMPUTE_META_FUNC(cat)(const ITensorListRef& tensors, int64_t dim) {
 namespace native {
 
 DEFINE_DISPATCH(cat_serial_stub);
+DEFINE_DISPATCH(cat_parallel_stub);
 DEFINE_DISPATCH(stack_serial_stub);
 
 Tensor _reshape_from_tensor(const Tensor& self, const Tensor& shape_tensor) {
@@ -563,12 +566,17 @@ TORCH_IMPL_FUNC(cat_out_cpu)
 
   auto materialized = tensors.materialize();
 
-  // fast path for single thread when both inputs and result are contiguous and not empty
+  // fast paths when both inputs and result are contiguous and not empty:
+  // serial for small outputs, parallel otherwise
   bool use_serial_kernel = result.numel() < at::internal::GRAIN_SIZE || at::get_num_threads() == 1;
   ScalarType dtype = materialized[valid].get().scalar_type();
   bool serial_dtype = (dtype == ScalarType::Double || dtype == ScalarType::Float || dtype == ScalarType::BFloat16);
-  if (use_serial_kernel && all_contiguous && all_same_dtype && serial_dtype) {
-    cat_serial_stub(kCPU, result, materialized, dim);
+  if (all_contiguous && all_same_dtype && serial_dtype) {
+    if (use_serial_kernel) {
+      cat_serial_stub(kCPU, result, materialized, dim);
+    } else {
+      cat_parallel_stub(kCPU, result, materialized, dim);
+    }
     return;
   }
 
@@ -2688,6 +2696,96 @@ Tensor& _stack_out(TensorList tensors, int64_t dim, Tensor& result) {
   return at::cat_out(result, tensors, dim);
 }
 
+// _stack_parallel collates a batch by copying every example into a
+// preallocated result across the intra-op pool, one flat memcpy per
+// example. Anything that does not permit that (non-CPU, mixed dtypes or
+// shapes, non-contiguous inputs, stacking along an inner dim) falls back
+// to the regular stack path.
+static bool can_use_parallel_stack(TensorList tensors, int64_t dim) {
+  if (dim != 0) {
+    return false;
+  }
+  const Tensor& first = tensors[0];
+  for (const Tensor& t : tensors) {
+    if (t.layout() != at::kStrided || !t.device().is_cpu() ||
+        t.dtype() != first.dtype() || t.sizes() != first.sizes() ||
+        !t.is_contiguous() || t.is_conj() || t.is_neg()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void parallel_stack_impl(const Tensor& result, TensorList tensors) {
+  const int64_t bytes_per_example =
+      tensors[0].numel() * tensors[0].element_size();
+  if (bytes_per_example == 0) {
+    return;
+  }
+  // Gather the source pointers up front so the parallel region does not
+  // touch any refcounts.
+  std::vector<const char*> sources(tensors.size());
+  for (const auto i : c10::irange(tensors.size())) {
+    sources[i] = static_cast<const char*>(tensors[i].data_ptr());
+  }
+  char* result_data = static_cast<char*>(result.data_ptr());
+  at::parallel_for(
+      0, static_cast<int64_t>(tensors.size()), 1,
+      [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          memcpy(
+              result_data + i * bytes_per_example,
+              sources[i],
+              bytes_per_example);
+        }
+      });
+}
+
+Tensor& _stack_parallel_out_cpu(
+    TensorList tensors,
+    int64_t dim,
+    bool pin_memory,
+    Tensor& result) {
+  TORCH_CHECK(!tensors.empty(),
+           "_stack_parallel expects a non-empty TensorList");
+  // pin_memory only affects the allocation the functional variant makes;
+  // with an explicit out it must already be pinned by the caller.
+  TORCH_CHECK(
+      !pin_memory || result.is_pinned(),
+      "_stack_parallel: pin_memory requires a pinned out tensor");
+  dim = maybe_wrap_dim(dim, tensors[0].dim() + 1);
+  if (!can_use_parallel_stack(tensors, dim) ||
+      result.dtype() != tensors[0].dtype() || !result.device().is_cpu()) {
+    return at::native::_stack_out_cpu(tensors, dim, result);
+  }
+  auto result_sizes = tensors[0].sizes().vec();
+  result_sizes.insert(
+      result_sizes.begin(), static_cast<int64_t>(tensors.size()));
+  at::native::resize_output(result, result_sizes);
+  if (!result.is_contiguous()) {
+    return at::native::_stack_out_cpu(tensors, dim, result);
+  }
+  parallel_stack_impl(result, tensors);
+  return result;
+}
+
+Tensor _stack_parallel_cpu(TensorList tensors, int64_t dim, bool pin_memory) {
+  TORCH_CHECK(!tensors.empty(),
+           "_stack_parallel expects a non-empty TensorList");
+  dim = maybe_wrap_dim(dim, tensors[0].dim() + 1);
+  if (!can_use_parallel_stack(tensors, dim)) {
+    auto result = at::native::stack(tensors, dim);
+    return pin_memory ? result.pin_memory() : result;
+  }
+  auto result_sizes = tensors[0].sizes().vec();
+  result_sizes.insert(
+      result_sizes.begin(), static_cast<int64_t>(tensors.size()));
+  auto result = at::empty(
+      result_sizes, tensors[0].options().pinned_memory(pin_memory));
+  parallel_stack_impl(result, tensors);
+  return result;
+}
+
 // TODO(msubkhankulov): refactor to use _stack_out
 Tensor& stack_out(TensorList tensors, int64_t dim, Tensor& result) {
   TORCH_CHECK(!tensors.empty(),
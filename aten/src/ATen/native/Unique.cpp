@@ -3,6 +3,7 @@
 
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <c10/util/irange.h>
 #include <c10/util/Load.h>
 
@@ -26,6 +27,7 @@
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace std {
 template <>
@@ -48,12 +50,35 @@ namespace native{
 
 namespace {
 
+// Below this many elements the per-thread tables and the merge cost more
+// than a single serial hash pass.
+constexpr int64_t MIN_NUMEL_FOR_PARALLEL_UNIQUE = 1 << 16;
+
 // Extract the unique elements from [begin, end) into a new Tensor
 template <typename scalar_t>
 Tensor unique_elements(const scalar_t* begin, const scalar_t* end,
                        bool sorted, const TensorOptions &options) {
-  // Create unordered set of elements
-  auto set = std::unordered_set<scalar_t>(begin, end);
+  const int64_t numel = end - begin;
+  const auto num_threads = at::get_num_threads();
+  std::unordered_set<scalar_t> set;
+  if (numel >= MIN_NUMEL_FOR_PARALLEL_UNIQUE && num_threads > 1) {
+    // Each thread hashes its own chunk into a private table and the tables
+    // are merged afterwards. The merge costs O(num_threads * cardinality),
+    // which is negligible next to the O(numel) insert phase for typical
+    // deduplication workloads.
+    std::vector<std::unordered_set<scalar_t>> thread_sets(num_threads);
+    at::parallel_for(0, numel, at::internal::GRAIN_SIZE,
+        [&](int64_t chunk_begin, int64_t chunk_end) {
+      auto& local_set = thread_sets[at::get_thread_num()];
+      local_set.insert(begin + chunk_begin, begin + chunk_end);
+    });
+    set = std::move(thread_sets[0]);
+    for (const auto t : c10::irange(size_t{1}, thread_sets.size())) {
+      set.insert(thread_sets[t].begin(), thread_sets[t].end());
+    }
+  } else {
+    set = std::unordered_set<scalar_t>(begin, end);
+  }
 
   // Write the output tensor
   Tensor output = at::empty({static_cast<int64_t>(set.size())}, options);
@@ -111,32 +136,70 @@ std::tuple<Tensor, Tensor, Tensor> unique_cpu_template(
   const scalar_t *output_data = output.data_ptr<scalar_t>();
 
   if (return_inverse || return_counts) {
+    const int64_t noutput = output.numel();
     inverse_indices.resize_(input.sizes());
     int64_t* inverse_indices_data = inverse_indices.data_ptr<int64_t>();
     std::unordered_map<scalar_t, int64_t> inverse_map;
-    inverse_map.reserve(output.numel());
-    for (const auto i : c10::irange(output.numel())) {
+    inverse_map.reserve(noutput);
+    for (const auto i : c10::irange(noutput)) {
       inverse_map[output_data[i]] = i;
     }
-    for (const auto i : c10::irange(numel)) {
-      const auto val = c10::load(&input_data[i]);
-      inverse_indices_data[i] = inverse_map[val];
-    }
     if (return_counts) {
-      std::unordered_map<scalar_t, int64_t> counts_map;
-      counts_map.reserve(output.numel());
-      for (const auto i : c10::irange(output.numel())) {
-        counts_map[output_data[i]] = 0;
+      counts.resize_(output.sizes());
+      counts.fill_(0);
+    }
+    int64_t* counts_data = return_counts ? counts.data_ptr<int64_t>() : nullptr;
+
+    const auto num_threads = at::get_num_threads();
+    // The per-thread count buffers only pay off while they fit comfortably
+    // in memory; with extreme cardinalities stay on the serial loop.
+    const bool run_parallel =
+        numel >= MIN_NUMEL_FOR_PARALLEL_UNIQUE && num_threads > 1 &&
+        (!return_counts || noutput <= (int64_t{1} << 20));
+    if (run_parallel) {
+      std::vector<std::vector<int64_t>> thread_counts(
+          return_counts ? num_threads : 0);
+      at::parallel_for(0, numel, at::internal::GRAIN_SIZE,
+          [&](int64_t chunk_begin, int64_t chunk_end) {
+        int64_t* local_counts = nullptr;
+        if (return_counts) {
+          auto& buffer = thread_counts[at::get_thread_num()];
+          if (buffer.empty()) {
+            buffer.resize(noutput, 0);
+          }
+          local_counts = buffer.data();
+        }
+        for (const auto i : c10::irange(chunk_begin, chunk_end)) {
+          const auto val = c10::load(&input_data[i]);
+          // The map is only read here, so concurrent lookups are safe. NaNs
+          // never compare equal to themselves and miss the map; map them to
+          // index 0 like the serial operator[] lookup does.
+          const auto it = inverse_map.find(val);
+          const int64_t idx = (it != inverse_map.end()) ? it->second : 0;
+          inverse_indices_data[i] = idx;
+          if (local_counts) {
+            local_counts[idx] += 1;
+          }
+        }
+      });
+      if (return_counts) {
+        for (const auto& buffer : thread_counts) {
+          if (buffer.empty()) {
+            continue;
+          }
+          for (const auto j : c10::irange(noutput)) {
+            counts_data[j] += buffer[j];
+          }
+        }
       }
+    } else {
       for (const auto i : c10::irange(numel)) {
         const auto val = c10::load(&input_data[i]);
-        counts_map[val] += 1;
-      }
-      counts.resize_(output.sizes());
-      counts.fill_(0);
-      int64_t *counts_data = counts.data_ptr<int64_t>();
-      for (const auto i : c10::irange(output.numel())) {
-        counts_data[i] = counts_map[output_data[i]];
+        const int64_t idx = inverse_map[val];
+        inverse_indices_data[i] = idx;
+        if (return_counts) {
+          counts_data[idx] += 1;
+        }
       }
     }
   }
@@ -1,9 +1,25 @@
 #define TORCH_ASSERT_NO_OPERATORS
 #include <ATen/Dispatch.h>
+#include <ATen/cpu/vec/vec.h>
 #include <ATen/native/CPUBlas.h>
 #include <c10/util/irange.h>
 #include <c10/util/Unroll.h>
 
+#include <algorithm>
+#include <vector>
+
+// The bf16 dot kernel below is compiled with a target attribute rather than
+// requiring -mavx512bf16 globally, so it only needs a compiler that accepts
+// the attribute (gcc 10+, clang 9+); whether it actually runs is decided at
+// runtime by cpu_has_avx512_bf16().
+#if (defined(CPU_CAPABILITY_AVX2) || defined(CPU_CAPABILITY_AVX512)) && \
+    !defined(_MSC_VER) &&                                               \
+    ((defined(__clang__) && __clang_major__ >= 9) ||                    \
+     (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 10))
+#define HAS_AVX512_BF16_DOT_KERNEL 1
+#include <ATen/cpu/vec/intrinsics.h>
+#endif
+
 namespace at::native {
 namespace cpublas {
 namespace {
@@ -110,6 +126,86 @@ void gemm_transa_(
   }
 }
 
+#if defined(HAS_AVX512_BF16_DOT_KERNEL)
+__attribute__((target("avx512bf16,avx512f")))
+float dot_bf16_avx512(const c10::BFloat16* a, const c10::BFloat16* b, int64_t k) {
+  // vdpbf16ps multiplies 32 bf16 pairs directly into 16 fp32 accumulators,
+  // so the dot product never materializes widened fp32 operands.  Two
+  // accumulators hide the instruction's latency.
+  __m512 sum0 = _mm512_setzero_ps();
+  __m512 sum1 = _mm512_setzero_ps();
+  int64_t l = 0;
+  for (; l + 64 <= k; l += 64) {
+    sum0 = _mm512_dpbf16_ps(
+        sum0,
+        (__m512bh)_mm512_loadu_si512(a + l),
+        (__m512bh)_mm512_loadu_si512(b + l));
+    sum1 = _mm512_dpbf16_ps(
+        sum1,
+        (__m512bh)_mm512_loadu_si512(a + l + 32),
+        (__m512bh)_mm512_loadu_si512(b + l + 32));
+  }
+  for (; l + 32 <= k; l += 32) {
+    sum0 = _mm512_dpbf16_ps(
+        sum0,
+        (__m512bh)_mm512_loadu_si512(a + l),
+        (__m512bh)_mm512_loadu_si512(b + l));
+  }
+  float dot = _mm512_reduce_add_ps(_mm512_add_ps(sum0, sum1));
+  for (; l < k; ++l) {
+    dot += static_cast<float>(a[l]) * static_cast<float>(b[l]);
+  }
+  return dot;
+}
+
+// a.T @ b keeps the reduction dimension contiguous in both operands, which
+// is exactly the layout vdpbf16ps wants; the other transpose combinations
+// stay on the generic widening path.
+template <>
+void gemm_transa_(
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    const c10::BFloat16 *a, int64_t lda,
+    const c10::BFloat16 *b, int64_t ldb,
+    float beta,
+    c10::BFloat16 *c, int64_t ldc) {
+  // c = alpha * (a.T @ b) + beta * c
+  if (cpu_has_avx512_bf16()) {
+    const c10::BFloat16 *a_ = a;
+    for (const auto i : c10::irange(m)) {
+      const c10::BFloat16 *b_ = b;
+      for (const auto j : c10::irange(n)) {
+        const float dot = dot_bf16_avx512(a_, b_, k);
+        b_ += ldb;
+        if (beta == 0.f) {
+          c[j*ldc+i] = alpha*dot;
+        } else {
+          c[j*ldc+i] = beta*c[j*ldc+i]+alpha*dot;
+        }
+      }
+      a_ += lda;
+    }
+    return;
+  }
+  const c10::BFloat16 *a_ = a;
+  for (const auto i : c10::irange(m)) {
+    const c10::BFloat16 *b_ = b;
+    for (const auto j : c10::irange(n)) {
+      const auto dot = sum(k, [&](int64_t l) -> float {
+        return static_cast<float>(a_[l]) * static_cast<float>(b_[l]);
+      });
+      b_ += ldb;
+      if (beta == 0.f) {
+        c[j*ldc+i] = alpha*dot;
+      } else {
+        c[j*ldc+i] = beta*c[j*ldc+i]+alpha*dot;
+      }
+    }
+    a_ += lda;
+  }
+}
+#endif // HAS_AVX512_BF16_DOT_KERNEL
+
 template <typename scalar_t, typename opmath_t>
 void gemm_transb_(
     int64_t m, int64_t n, int64_t k,
@@ -164,6 +260,137 @@ void gemm_transab_(
   }
 }
 
+// Cache blocking parameters for the packed fallback kernel below. The packed
+// panels (block_m x block_k of a plus block_k x block_n of b, both widened to
+// opmath_t) stay within a typical L2 share.
+constexpr int64_t kGemmBlockM = 128;
+constexpr int64_t kGemmBlockN = 240;
+constexpr int64_t kGemmBlockK = 256;
+
+template <typename scalar_t>
+constexpr bool is_blocked_gemm_dtype =
+    std::is_same<scalar_t, float>::value ||
+    std::is_same<scalar_t, c10::Half>::value ||
+    std::is_same<scalar_t, c10::BFloat16>::value;
+
+// Packing only pays off once there is enough arithmetic to amortize it; tiny
+// problems stay on the simple loops.
+inline bool use_blocked_gemm(int64_t m, int64_t n, int64_t k) {
+  return m >= 8 && n >= 8 && k >= 8 && m * n * k >= 32 * 32 * 32;
+}
+
+// Packed, register tiled fallback kernel. op(a) is packed into row strips and
+// op(b) into column strips, both widened to opmath_t, so the inner loop runs
+// fused multiply-adds over contiguous panels regardless of the transpose
+// flags, and bf16/fp16 operands widen once during packing instead of once per
+// multiply. The micro tile keeps a (2 vectors) x 4 block of fp32 accumulators
+// in registers. This file is compiled once per CPU capability, so the
+// AVX2/AVX512/NEON variant is chosen by the regular dispatch stub machinery.
+template <typename scalar_t, typename opmath_t>
+void gemm_blocked_(
+    TransposeType transa, TransposeType transb,
+    int64_t m, int64_t n, int64_t k,
+    opmath_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    opmath_t beta,
+    scalar_t *c, int64_t ldc) {
+  using Vec = vec::Vectorized<opmath_t>;
+  constexpr int64_t kMicroRows = 2 * Vec::size();
+  constexpr int64_t kMicroCols = 4;
+
+  // c = beta * c, applied once up front; the blocks below only accumulate
+  scale_(m, n, beta, c, ldc);
+
+  const bool ta = transa == TransposeType::Transpose;
+  const bool tb = transb == TransposeType::Transpose;
+
+  std::vector<opmath_t> pa((kGemmBlockM + kMicroRows) * kGemmBlockK);
+  std::vector<opmath_t> pb((kGemmBlockN + kMicroCols) * kGemmBlockK);
+
+  for (int64_t jc = 0; jc < n; jc += kGemmBlockN) {
+    const int64_t nc = std::min(kGemmBlockN, n - jc);
+    const int64_t n_strips = (nc + kMicroCols - 1) / kMicroCols;
+    for (int64_t pc = 0; pc < k; pc += kGemmBlockK) {
+      const int64_t kc = std::min(kGemmBlockK, k - pc);
+
+      // Pack op(b)[pc:pc+kc, jc:jc+nc], zero filling the ragged last strip
+      for (const auto t : c10::irange(n_strips)) {
+        opmath_t* pb_strip = pb.data() + t * kc * kMicroCols;
+        for (const auto l : c10::irange(kc)) {
+          for (const auto jj : c10::irange(kMicroCols)) {
+            const int64_t j = t * kMicroCols + jj;
+            pb_strip[l * kMicroCols + jj] = j < nc
+                ? static_cast<opmath_t>(
+                      tb ? b[(jc + j) + (pc + l) * ldb]
+                         : b[(pc + l) + (jc + j) * ldb])
+                : opmath_t(0);
+          }
+        }
+      }
+
+      for (int64_t ic = 0; ic < m; ic += kGemmBlockM) {
+        const int64_t mc = std::min(kGemmBlockM, m - ic);
+        const int64_t m_strips = (mc + kMicroRows - 1) / kMicroRows;
+
+        // Pack op(a)[ic:ic+mc, pc:pc+kc] the same way
+        for (const auto s : c10::irange(m_strips)) {
+          opmath_t* pa_strip = pa.data() + s * kc * kMicroRows;
+          for (const auto l : c10::irange(kc)) {
+            for (const auto r : c10::irange(kMicroRows)) {
+              const int64_t i = s * kMicroRows + r;
+              pa_strip[l * kMicroRows + r] = i < mc
+                  ? static_cast<opmath_t>(
+                        ta ? a[(pc + l) + (ic + i) * lda]
+                           : a[(ic + i) + (pc + l) * lda])
+                  : opmath_t(0);
+            }
+          }
+        }
+
+        for (const auto t : c10::irange(n_strips)) {
+          for (const auto s : c10::irange(m_strips)) {
+            const opmath_t* pa_ptr = pa.data() + s * kc * kMicroRows;
+            const opmath_t* pb_ptr = pb.data() + t * kc * kMicroCols;
+
+            Vec acc[2 * kMicroCols];
+            for (auto& v : acc) {
+              v = Vec(opmath_t(0));
+            }
+            for (const auto l C10_UNUSED : c10::irange(kc)) {
+              const Vec a0 = Vec::loadu(pa_ptr);
+              const Vec a1 = Vec::loadu(pa_ptr + Vec::size());
+              c10::ForcedUnroll<kMicroCols>{}([&](int jj) {
+                const Vec bv(pb_ptr[jj]);
+                acc[jj] = vec::fmadd(a0, bv, acc[jj]);
+                acc[kMicroCols + jj] = vec::fmadd(a1, bv, acc[kMicroCols + jj]);
+              });
+              pa_ptr += kMicroRows;
+              pb_ptr += kMicroCols;
+            }
+
+            // Accumulate alpha * tile into c, clipped to the valid region
+            const int64_t rows = std::min(kMicroRows, mc - s * kMicroRows);
+            const int64_t cols = std::min(kMicroCols, nc - t * kMicroCols);
+            // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+            opmath_t tile[kMicroRows];
+            for (const auto jj : c10::irange(cols)) {
+              acc[jj].store(tile);
+              acc[kMicroCols + jj].store(tile + Vec::size());
+              scalar_t* c_ptr =
+                  c + (jc + t * kMicroCols + jj) * ldc + ic + s * kMicroRows;
+              for (const auto r : c10::irange(rows)) {
+                c_ptr[r] = static_cast<scalar_t>(
+                    static_cast<opmath_t>(c_ptr[r]) + alpha * tile[r]);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 template <typename scalar_t, typename opmath_t>
 void gemm_core_(
     TransposeType transa, TransposeType transb,
@@ -173,6 +400,17 @@ void gemm_core_(
     const scalar_t *b, int64_t ldb,
     opmath_t beta,
     scalar_t *c, int64_t ldc) {
+  if constexpr (is_blocked_gemm_dtype<scalar_t>) {
+    // ConjTranspose stays on the generic paths below
+    if ((transa == TransposeType::NoTranspose ||
+         transa == TransposeType::Transpose) &&
+        (transb == TransposeType::NoTranspose ||
+         transb == TransposeType::Transpose) &&
+        use_blocked_gemm(m, n, k)) {
+      return gemm_blocked_(
+          transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+  }
   if(transa == TransposeType::NoTranspose && transb == TransposeType::NoTranspose) {
     return gemm_notrans_(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
   } else if(transa == TransposeType::Transpose && transb != TransposeType::Transpose) {
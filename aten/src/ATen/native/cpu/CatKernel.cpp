@@ -2,11 +2,14 @@
 #include <ATen/core/Tensor.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/cpu/CatKernel.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+
 namespace at::native {
 
 namespace {
@@ -20,6 +23,22 @@ struct InputMeta {
     , inner_size(t.sizes()[dim] * inner) {}
 };
 
+template <typename scalar_t>
+void copy_chunk(scalar_t* result_ptr, const scalar_t* input_ptr, int64_t size) {
+  using Vec = vec::Vectorized<scalar_t>;
+  int64_t d = 0;
+  for (; d < size - (size % Vec::size()); d += Vec::size()) {
+    Vec in_vec = Vec::loadu(input_ptr + d);
+    in_vec.store(result_ptr + d);
+  }
+  #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
+  # pragma unroll
+  #endif
+  for (; d < size; d++) {
+    result_ptr[d] = input_ptr[d];
+  }
+}
+
 template <typename scalar_t>
 void cat_serial_kernel_impl(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
   TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
@@ -33,36 +52,90 @@ void cat_serial_kernel_impl(const Tensor& result, const MaterializedITensorListR
     inputs.emplace_back(tensor, dim, result.strides()[dim]);
   }
 
-  using Vec = vec::Vectorized<scalar_t>;
   scalar_t* result_ptr = result_data;
   for (const auto i : c10::irange(outer)) {
     for (const auto j : c10::irange(ninputs)) {
       int64_t local_inner = inputs[j].inner_size;
       scalar_t* input_ptr = (scalar_t*)(inputs[j].data_ptr) + i * local_inner;
-      int64_t d = 0;
-      for (; d < local_inner - (local_inner % Vec::size()); d += Vec::size()) {
-        Vec in_vec = Vec::loadu(input_ptr + d);
-        in_vec.store(result_ptr + d);
-      }
-      #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
-      # pragma unroll
-      #endif
-      for (; d < local_inner; d++) {
-        result_ptr[d] = input_ptr[d];
-      }
+      copy_chunk(result_ptr, input_ptr, local_inner);
       result_ptr += local_inner;
     }
   }
 }
 
+/* Parallel variant for large concatenations. The output is contiguous, so it
+ * is treated as one flat array of elements and partitioned evenly across
+ * threads; each thread maps its [begin, end) range back onto the (outer row,
+ * input segment) structure and copies the overlapping pieces. Partitioning by
+ * elements rather than by input keeps all cores busy even when the inputs are
+ * few and large (e.g. a dim-0 cat of a handful of multi-GB shards).
+ */
+template <typename scalar_t>
+void cat_parallel_kernel_impl(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+      dim >= 0 && dim < result.dim(), "dim out of range in cat_parallel_kernel_impl");
+  int64_t result_inner = result.sizes()[dim] * result.strides()[dim];
+  scalar_t* result_data = result.data_ptr<scalar_t>();
+  int64_t ninputs = static_cast<int64_t>(tensors.size());
+  std::vector<InputMeta> inputs;
+  inputs.reserve(ninputs);
+  for (const Tensor& tensor : tensors) {
+    inputs.emplace_back(tensor, dim, result.strides()[dim]);
+  }
+
+  // Offset of each input's segment within one outer row of the output.
+  std::vector<int64_t> input_offsets(ninputs + 1, 0);
+  for (const auto j : c10::irange(ninputs)) {
+    input_offsets[j + 1] = input_offsets[j] + inputs[j].inner_size;
+  }
+
+  at::parallel_for(0, result.numel(), internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    int64_t i = begin / result_inner;
+    int64_t r = begin % result_inner;
+    // Last segment whose offset is <= r; empty segments sharing the same
+    // offset are skipped by taking the upper bound.
+    int64_t j = (std::upper_bound(input_offsets.begin() + 1, input_offsets.end(), r)
+            - input_offsets.begin()) - 1;
+
+    int64_t pos = begin;
+    while (pos < end) {
+      const int64_t seg_off = r - input_offsets[j];
+      const int64_t len = std::min(inputs[j].inner_size - seg_off, end - pos);
+      const scalar_t* input_ptr = (const scalar_t*)(inputs[j].data_ptr)
+          + i * inputs[j].inner_size + seg_off;
+      copy_chunk(result_data + pos, input_ptr, len);
+      pos += len;
+      r += len;
+      while (j < ninputs && r == input_offsets[j + 1]) {
+        j++;
+      }
+      if (j == ninputs) {
+        i++;
+        r = 0;
+        j = 0;
+        while (j < ninputs && inputs[j].inner_size == 0) {
+          j++;
+        }
+      }
+    }
+  });
+}
+
 void cat_serial_kernel(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
   AT_DISPATCH_FLOATING_TYPES_AND(ScalarType::BFloat16, result.scalar_type(), "cat_serial_kernel", [&]() {
     cat_serial_kernel_impl<scalar_t>(result, tensors, dim);
   });
 }
 
+void cat_parallel_kernel(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
+  AT_DISPATCH_FLOATING_TYPES_AND(ScalarType::BFloat16, result.scalar_type(), "cat_parallel_kernel", [&]() {
+    cat_parallel_kernel_impl<scalar_t>(result, tensors, dim);
+  });
+}
+
 } // anonymous namespace
 
 REGISTER_DISPATCH(cat_serial_stub, &cat_serial_kernel);
+REGISTER_DISPATCH(cat_parallel_stub, &cat_parallel_kernel);
 
 } // at::native
@@ -164,6 +164,55 @@ void float_bfloat16_copy_kernel(TensorIteratorBase &iter, bool requires_neg) {
   }
 }
 
+#if defined(CPU_CAPABILITY_AVX2) || defined(CPU_CAPABILITY_AVX512)
+// Same-dtype contiguous copies at least this large use non-temporal stores
+// so a bulk copy does not evict the last-level cache. Roughly LLC-sized;
+// below this the lines are likely wanted in cache anyway.
+constexpr int64_t kStreamingCopyMinBytes = 32LL * 1024 * 1024;
+
+void streaming_copy_contiguous(char* dst, const char* src, int64_t nbytes) {
+  using Vec = Vectorized<float>;
+  constexpr int64_t kVecBytes = Vec::size() * sizeof(float);
+  at::parallel_for(0, nbytes, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    char* dst_ptr = dst + begin;
+    const char* src_ptr = src + begin;
+    int64_t remaining = end - begin;
+
+    // Streaming stores require an aligned destination; copy the unaligned
+    // head (and below, the tail) with plain stores. The copy is raw bytes,
+    // so any dtype can be moved through float vectors.
+    const int64_t head = std::min(
+        remaining,
+        static_cast<int64_t>(
+            (kVecBytes - reinterpret_cast<uintptr_t>(dst_ptr) % kVecBytes) % kVecBytes));
+    std::memcpy(dst_ptr, src_ptr, head);
+    dst_ptr += head;
+    src_ptr += head;
+    remaining -= head;
+
+    for (; remaining >= kVecBytes; remaining -= kVecBytes) {
+      Vec::loadu(src_ptr).store_nt(dst_ptr);
+      dst_ptr += kVecBytes;
+      src_ptr += kVecBytes;
+    }
+    std::memcpy(dst_ptr, src_ptr, remaining);
+    vec::streaming_store_fence();
+  });
+}
+
+bool streaming_copy_eligible(TensorIteratorBase& iter) {
+  const auto enabled = copy_stream_stores();
+  if (enabled.has_value() && !*enabled) {
+    return false;
+  }
+  if (iter.dtype(0) != iter.dtype(1) || !iter.is_contiguous() || iter.numel() == 0) {
+    return false;
+  }
+  const int64_t nbytes = iter.numel() * iter.element_size(0);
+  return enabled.value_or(false) || nbytes >= kStreamingCopyMinBytes;
+}
+#endif
+
 void direct_copy_kernel(TensorIteratorBase &iter) {
   // TODO: we don't actually need separate instantiations per dtype;
   // we only need a separate instantiation per dtype size. This would
@@ -173,6 +222,15 @@ void direct_copy_kernel(TensorIteratorBase &iter) {
   // single jump table here; might be worth just writing out the
   // dispatch statement by hand instead of using AT_DISPATCH
   ScalarType dtype = iter.dtype(0);
+#if defined(CPU_CAPABILITY_AVX2) || defined(CPU_CAPABILITY_AVX512)
+  if (streaming_copy_eligible(iter)) {
+    streaming_copy_contiguous(
+        reinterpret_cast<char*>(iter.data_ptr(0)),
+        reinterpret_cast<const char*>(iter.data_ptr(1)),
+        iter.numel() * iter.element_size(0));
+    return;
+  }
+#endif
   if (isQIntType(dtype)) {
     AT_DISPATCH_QINT_TYPES(dtype, "copy_kernel", [&] {
       cpu_kernel_vec(
@@ -2,8 +2,12 @@
 #include <ATen/native/cpu/DepthwiseConvKernel.h>
 #include <ATen/core/Tensor.h>
 #include <ATen/Parallel.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
@@ -308,8 +312,256 @@ Tensor _convolution_depthwise3x3_winograd(
   return output;
 }
 
+/*
+ * Direct NHWC depthwise convolution.
+ *
+ * The Winograd kernel above only covers 3x3 stride-1/2 float NCHW on NEON;
+ * everything else (5x5, dilation, bfloat16, channels-last) used to fall back
+ * to the generic im2col+gemm path, which materializes a KxK-times-larger
+ * input copy for a kernel that touches each input pixel only KxK times. In
+ * NHWC the channel dimension is innermost and dense, so a direct kernel
+ * vectorizes trivially across channels: every (output pixel, tap) pair is a
+ * contiguous fmadd over C lanes, no data rearrangement at all. bfloat16
+ * accumulates in fp32 and rounds once on the final store.
+ *
+ * Weights arrive as contiguous (C, 1, KH, KW); we repack them once into a
+ * per-tap channel-major (KH*KW, C) fp32 buffer so the inner loop loads both
+ * operands with unit stride.
+ */
+
+// Computes one NHWC output pixel: out_px[c] = bias[c] + sum over the
+// in-bounds taps of in[ih, iw, c] * wt[tap, c], vectorized across c with
+// four accumulators in flight.
+inline void depthwise2d_direct_pixel(
+    float* out_px,
+    const float* in_n,
+    const float* wt,
+    const float* bias,
+    int64_t C,
+    int64_t IW,
+    int64_t KW,
+    int64_t kh0, int64_t kh1,
+    int64_t kw0, int64_t kw1,
+    int64_t ih_origin, int64_t iw_origin,
+    int64_t dil_h, int64_t dil_w) {
+  using Vec = vec::Vectorized<float>;
+  int64_t c = 0;
+  for (; c + 4 * Vec::size() <= C; c += 4 * Vec::size()) {
+    Vec acc0 = Vec::loadu(bias + c);
+    Vec acc1 = Vec::loadu(bias + c + Vec::size());
+    Vec acc2 = Vec::loadu(bias + c + 2 * Vec::size());
+    Vec acc3 = Vec::loadu(bias + c + 3 * Vec::size());
+    for (const auto kh : c10::irange(kh0, kh1)) {
+      for (const auto kw : c10::irange(kw0, kw1)) {
+        const float* in_px =
+            in_n + ((ih_origin + kh * dil_h) * IW + iw_origin + kw * dil_w) * C + c;
+        const float* w_px = wt + (kh * KW + kw) * C + c;
+        acc0 = vec::fmadd(Vec::loadu(in_px), Vec::loadu(w_px), acc0);
+        acc1 = vec::fmadd(
+            Vec::loadu(in_px + Vec::size()), Vec::loadu(w_px + Vec::size()), acc1);
+        acc2 = vec::fmadd(
+            Vec::loadu(in_px + 2 * Vec::size()), Vec::loadu(w_px + 2 * Vec::size()), acc2);
+        acc3 = vec::fmadd(
+            Vec::loadu(in_px + 3 * Vec::size()), Vec::loadu(w_px + 3 * Vec::size()), acc3);
+      }
+    }
+    acc0.store(out_px + c);
+    acc1.store(out_px + c + Vec::size());
+    acc2.store(out_px + c + 2 * Vec::size());
+    acc3.store(out_px + c + 3 * Vec::size());
+  }
+  for (; c + Vec::size() <= C; c += Vec::size()) {
+    Vec acc = Vec::loadu(bias + c);
+    for (const auto kh : c10::irange(kh0, kh1)) {
+      for (const auto kw : c10::irange(kw0, kw1)) {
+        const float* in_px =
+            in_n + ((ih_origin + kh * dil_h) * IW + iw_origin + kw * dil_w) * C + c;
+        acc = vec::fmadd(Vec::loadu(in_px), Vec::loadu(wt + (kh * KW + kw) * C + c), acc);
+      }
+    }
+    acc.store(out_px + c);
+  }
+  for (; c < C; ++c) {
+    float acc = bias[c];
+    for (const auto kh : c10::irange(kh0, kh1)) {
+      for (const auto kw : c10::irange(kw0, kw1)) {
+        acc += in_n[((ih_origin + kh * dil_h) * IW + iw_origin + kw * dil_w) * C + c] *
+            wt[(kh * KW + kw) * C + c];
+      }
+    }
+    out_px[c] = acc;
+  }
+}
+
+// bfloat16 variant: loads convert to a pair of fp32 vectors, accumulation
+// stays in fp32 and rounds to bfloat16 once on the final store.
+inline void depthwise2d_direct_pixel(
+    c10::BFloat16* out_px,
+    const c10::BFloat16* in_n,
+    const float* wt,
+    const float* bias,
+    int64_t C,
+    int64_t IW,
+    int64_t KW,
+    int64_t kh0, int64_t kh1,
+    int64_t kw0, int64_t kw1,
+    int64_t ih_origin, int64_t iw_origin,
+    int64_t dil_h, int64_t dil_w) {
+  using bVec = vec::Vectorized<c10::BFloat16>;
+  using fVec = vec::Vectorized<float>;
+  int64_t c = 0;
+  for (; c + bVec::size() <= C; c += bVec::size()) {
+    fVec acc0 = fVec::loadu(bias + c);
+    fVec acc1 = fVec::loadu(bias + c + fVec::size());
+    for (const auto kh : c10::irange(kh0, kh1)) {
+      for (const auto kw : c10::irange(kw0, kw1)) {
+        bVec in_bvec = bVec::loadu(
+            in_n + ((ih_origin + kh * dil_h) * IW + iw_origin + kw * dil_w) * C + c);
+        fVec in_fvec0, in_fvec1;
+        std::tie(in_fvec0, in_fvec1) = convert_bfloat16_float(in_bvec);
+        const float* w_px = wt + (kh * KW + kw) * C + c;
+        acc0 = vec::fmadd(in_fvec0, fVec::loadu(w_px), acc0);
+        acc1 = vec::fmadd(in_fvec1, fVec::loadu(w_px + fVec::size()), acc1);
+      }
+    }
+    convert_float_bfloat16(acc0, acc1).store(out_px + c);
+  }
+  for (; c < C; ++c) {
+    float acc = bias[c];
+    for (const auto kh : c10::irange(kh0, kh1)) {
+      for (const auto kw : c10::irange(kw0, kw1)) {
+        acc += static_cast<float>(
+                   in_n[((ih_origin + kh * dil_h) * IW + iw_origin + kw * dil_w) * C + c]) *
+            wt[(kh * KW + kw) * C + c];
+      }
+    }
+    out_px[c] = acc;
+  }
+}
+
+template <typename scalar_t>
+void depthwise2d_direct_impl(
+    const Tensor& input,
+    const Tensor& kernel,
+    const Tensor& bias_potentially_undefined,
+    Tensor& output,
+    const IntArrayRef stride,
+    const IntArrayRef padding,
+    const IntArrayRef dilation) {
+  const int64_t N = input.size(0);
+  const int64_t C = input.size(1);
+  const int64_t IH = input.size(2);
+  const int64_t IW = input.size(3);
+  const int64_t KH = kernel.size(2);
+  const int64_t KW = kernel.size(3);
+  const int64_t OH = output.size(2);
+  const int64_t OW = output.size(3);
+  const int64_t stride_h = stride[0];
+  const int64_t stride_w = stride[1];
+  const int64_t pad_h = padding[0];
+  const int64_t pad_w = padding[1];
+  const int64_t dil_h = dilation[0];
+  const int64_t dil_w = dilation[1];
+
+  // Repack the (C, 1, KH, KW) weights into channel-major fp32 taps, with the
+  // fp32 bias appended, so the inner loop is unit-stride on both operands.
+  Tensor packed = at::empty({(KH * KW + 1) * C}, input.options().dtype(at::kFloat));
+  float* wt = packed.data_ptr<float>();
+  float* bias_f = wt + KH * KW * C;
+  const scalar_t* k_data = kernel.data_ptr<scalar_t>();
+  for (const auto c : c10::irange(C)) {
+    for (const auto kh : c10::irange(KH)) {
+      for (const auto kw : c10::irange(KW)) {
+        wt[(kh * KW + kw) * C + c] =
+            static_cast<float>(k_data[(c * KH + kh) * KW + kw]);
+      }
+    }
+  }
+  if (bias_potentially_undefined.defined()) {
+    const scalar_t* b_data = bias_potentially_undefined.data_ptr<scalar_t>();
+    for (const auto c : c10::irange(C)) {
+      bias_f[c] = static_cast<float>(b_data[c]);
+    }
+  } else {
+    std::fill(bias_f, bias_f + C, 0.f);
+  }
+
+  // [t0, t1) is the range of kernel taps whose input coordinate
+  // origin + t * dil lands inside [0, size).
+  const auto tap_range = [](int64_t origin, int64_t size, int64_t k,
+                            int64_t dil, int64_t& t0, int64_t& t1) {
+    t0 = origin >= 0 ? 0 : (-origin + dil - 1) / dil;
+    t1 = origin >= size ? 0 : std::min(k, (size - origin + dil - 1) / dil);
+    t1 = std::max(t0, t1);
+  };
+
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+  scalar_t* output_data = output.data_ptr<scalar_t>();
+
+  // Channels are innermost in NHWC, so rows are the natural parallel grain;
+  // every (n, oh) chunk touches a disjoint output slice.
+  at::parallel_for(0, N * OH, 0, [&](int64_t start, int64_t end) {
+    for (const auto idx : c10::irange(start, end)) {
+      const int64_t n = idx / OH;
+      const int64_t oh = idx % OH;
+      const scalar_t* in_n = input_data + n * IH * IW * C;
+      scalar_t* out_row = output_data + (n * OH + oh) * OW * C;
+      const int64_t ih_origin = oh * stride_h - pad_h;
+      int64_t kh0, kh1;
+      tap_range(ih_origin, IH, KH, dil_h, kh0, kh1);
+      for (const auto ow : c10::irange(OW)) {
+        const int64_t iw_origin = ow * stride_w - pad_w;
+        int64_t kw0, kw1;
+        tap_range(iw_origin, IW, KW, dil_w, kw0, kw1);
+        depthwise2d_direct_pixel(
+            out_row + ow * C, in_n, wt, bias_f, C, IW, KW,
+            kh0, kh1, kw0, kw1, ih_origin, iw_origin, dil_h, dil_w);
+      }
+    }
+  });
+}
+
+Tensor _convolution_depthwise2d_direct(
+    const Tensor & input,
+    const Tensor & kernel,
+    const Tensor & bias_potentially_undefined,
+    const IntArrayRef stride,
+    const IntArrayRef padding,
+    const IntArrayRef dilation,
+    const int64_t groups)
+{
+  const IntArrayRef input_sizes = input.sizes();
+  const IntArrayRef kernel_sizes = kernel.sizes();
+  TORCH_INTERNAL_ASSERT(input_sizes[1] == groups && kernel_sizes[0] == groups);
+
+  const auto calc_output_dimension = [](
+    const int64_t input, const int64_t kernel, const int64_t stride, const int64_t padding, const int64_t dilation) {
+    return 1 + (input - dilation * (kernel - 1) - 1 + 2 * padding) / stride;
+  };
+
+  Tensor output = at::empty(
+    {
+      input_sizes[0],
+      kernel_sizes[0],
+      calc_output_dimension(input_sizes[2], kernel_sizes[2], stride[0], padding[0], dilation[0]),
+      calc_output_dimension(input_sizes[3], kernel_sizes[3], stride[1], padding[1], dilation[1]),
+    },
+    input.options().memory_format(at::MemoryFormat::ChannelsLast));
+
+  if (input.scalar_type() == at::kBFloat16) {
+    depthwise2d_direct_impl<c10::BFloat16>(
+        input, kernel, bias_potentially_undefined, output, stride, padding, dilation);
+  } else {
+    depthwise2d_direct_impl<float>(
+        input, kernel, bias_potentially_undefined, output, stride, padding, dilation);
+  }
+
+  return output;
+}
+
 }  // namespace
 
 REGISTER_DISPATCH(convolution_depthwise3x3_winograd_stub, &_convolution_depthwise3x3_winograd);
+REGISTER_DISPATCH(convolution_depthwise2d_direct_stub, &_convolution_depthwise2d_direct);
 
 }  // namespace at::native
@@ -4,7 +4,9 @@
 #include <c10/util/ArrayRef.h>
 
 /*
-  Depthwise 3x3 Winograd convolution operator
+  Depthwise convolution operators:
+   - 3x3 Winograd (NCHW, float, NEON only)
+   - direct NHWC (arbitrary small kernels, stride/dilation, float/bfloat16)
 */
 
 namespace at {
@@ -17,5 +19,10 @@ using convolution_depthwise3x3_winograd_fn =
 
 DECLARE_DISPATCH(convolution_depthwise3x3_winograd_fn, convolution_depthwise3x3_winograd_stub);
 
+using convolution_depthwise2d_direct_fn =
+    Tensor (*)(const Tensor &, const Tensor &, const Tensor &, IntArrayRef, IntArrayRef, IntArrayRef, int64_t);
+
+DECLARE_DISPATCH(convolution_depthwise2d_direct_fn, convolution_depthwise2d_direct_stub);
+
 }  // namespace native
 }  // namespace at
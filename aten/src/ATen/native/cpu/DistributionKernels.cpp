@@ -27,18 +27,18 @@ namespace at::native {
 namespace {
 
 static void cauchy_kernel(TensorIteratorBase& iter, double median, double sigma, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::cauchy_kernel(iter, median, sigma, generator);
 }
 
 void bernoulli_tensor_kernel(const TensorBase &self, const TensorBase &p_, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::bernoulli_kernel(self, p_, generator);
 }
 
 #if !AT_MKL_ENABLED()
 void bernoulli_scalar_kernel_default(const TensorBase &self, double p, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::bernoulli_kernel(self, p, generator);
 }
 
@@ -47,7 +47,7 @@ void bernoulli_scalar_kernel(const TensorBase &self, double p, c10::optional<Gen
 }
 #else
 void bernoulli_scalar_kernel(const TensorBase &self, double p, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   int64_t seed;
   {
     // See Note [Acquire lock when using random generators]
@@ -99,7 +99,7 @@ void bernoulli_scalar_kernel(const TensorBase &self, double p, c10::optional<Gen
 #endif
 
 static void exponential_kernel_default(TensorIteratorBase& iter, double lambda, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::exponential_kernel(iter, lambda, generator);
 }
 
@@ -113,7 +113,7 @@ void exponential_kernel(TensorIteratorBase &iter, double lambda, c10::optional<G
 
   Tensor self = iter.tensor(0);
   if (lambda > 0 && !std::isinf(lambda) && !std::isnan(lambda)) {
-    CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+    CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
     int64_t seed;
     {
       // See Note [Acquire lock when using random generators]
@@ -182,32 +182,32 @@ void exponential_kernel(TensorIteratorBase &iter, double lambda, c10::optional<G
 #endif
 
 static void geometric_kernel(TensorIteratorBase& iter, double p, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::geometric_kernel(iter, p, generator);
 }
 
 static void log_normal_kernel(TensorIteratorBase& iter, double mean, double std, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::log_normal_kernel(iter, mean, std, generator);
 }
 
 void uniform_kernel(TensorIteratorBase& iter, double from, double to, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::uniform_kernel(iter, from, to, generator);
 }
 
 void normal_kernel(const TensorBase &self, double mean, double std, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::normal_kernel(self, mean, std, generator);
 }
 
 static void random_from_to_kernel(TensorIteratorBase& iter, uint64_t range, int64_t base, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::random_from_to_kernel(iter, range, base, generator);
 }
 
 static void random_kernel(TensorIteratorBase& iter, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::random_kernel(iter, generator);
 }
 
@@ -215,7 +215,7 @@ static void random_kernel(TensorIteratorBase& iter, c10::optional<Generator> gen
 // from(inclusive) = std::numeric_limits<int64_t>::lowest()
 // to(exclusive) = None (= std::numeric_limits<int64_t>::max() + 1)
 static void random_full_64_bits_range_kernel(TensorIteratorBase& iter, c10::optional<Generator> gen) {
-  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getCPUGeneratorForThread());
   templates::cpu::random_full_64_bits_range_kernel(iter, generator);
 }
 
@@ -0,0 +1,220 @@
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/ceil_div.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/native/CPUBlas.h>
+#include <ATen/native/DispatchStub.h>
+#include <ATen/native/cpu/utils.h>
+#include <ATen/native/transformers/attention.h>
+#include <c10/util/irange.h>
+
+#include <cmath>
+#include <limits>
+
+namespace at { namespace native {
+
+namespace {
+
+/*
+ * Flash-attention style forward kernel (Dao et al., "FlashAttention: Fast
+ * and Memory-Efficient Exact Attention with IO-Awareness"): the attention
+ * scores are computed one [qSplitSize, kvSplitSize] block at a time and
+ * folded into a running online softmax, so only O(block) scratch is needed
+ * instead of materializing the full [q_len, kv_len] score matrix.
+ *
+ * Inputs are dense contiguous [batch, num_heads, seq_len, head_dim]; the
+ * caller is responsible for rejecting masks, dropout and non-float dtypes
+ * (see use_flash_attention_cpp in sdp_utils_cpp.h).
+ */
+template <typename scalar_t>
+void cpu_flash_attention(
+    const Tensor& output,
+    const Tensor& logsumexp,
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    bool is_causal) {
+  using Vec = vec::Vectorized<scalar_t>;
+  // Block sizes: one query block against one key/value block, sized so that
+  // the score block plus the key/value panels stay L2 resident.
+  constexpr int64_t qSplitSize = 32;
+  constexpr int64_t kvSplitSize = 512;
+
+  const int64_t batchSize = query.size(0);
+  const int64_t numHead = query.size(1);
+  const int64_t qSize = query.size(2);
+  const int64_t headSize = query.size(3);
+  const int64_t kvSize = key.size(2);
+
+  const auto scaling_factor =
+      static_cast<scalar_t>(1.0 / std::sqrt(static_cast<double>(headSize)));
+  constexpr scalar_t kNegInf = -std::numeric_limits<scalar_t>::infinity();
+
+  const scalar_t* q_data = query.data_ptr<scalar_t>();
+  const scalar_t* k_data = key.data_ptr<scalar_t>();
+  const scalar_t* v_data = value.data_ptr<scalar_t>();
+  scalar_t* out_data = output.data_ptr<scalar_t>();
+  scalar_t* lse_data = logsumexp.data_ptr<scalar_t>();
+
+  const int64_t qSlice = ceil_div(qSize, qSplitSize);
+
+  // Per-thread scratch: score block, running max/sum and output accumulator.
+  const int64_t bufStride =
+      qSplitSize * kvSplitSize + 2 * qSplitSize + qSplitSize * headSize;
+  Tensor buf = at::empty({at::get_num_threads(), bufStride}, query.options());
+  scalar_t* buf_data = buf.data_ptr<scalar_t>();
+
+  at::parallel_for(0, batchSize * numHead * qSlice, 1, [&](int64_t begin, int64_t end) {
+    int64_t i = 0, j = 0, l = 0;
+    data_index_init(begin, i, batchSize, j, numHead, l, qSlice);
+
+    scalar_t* qk = buf_data + at::get_thread_num() * bufStride;
+    scalar_t* qk_max = qk + qSplitSize * kvSplitSize;
+    scalar_t* qk_sum = qk_max + qSplitSize;
+    scalar_t* dst = qk_sum + qSplitSize;
+
+    for (C10_UNUSED const auto z : c10::irange(begin, end)) {
+      const int64_t qStart = l * qSplitSize;
+      const int64_t qBlockSize = std::min(qSplitSize, qSize - qStart);
+      const scalar_t* q_ptr =
+          q_data + ((i * numHead + j) * qSize + qStart) * headSize;
+
+      std::fill_n(qk_max, qBlockSize, kNegInf);
+      std::fill_n(qk_sum, qBlockSize, scalar_t(0));
+      std::fill_n(dst, qBlockSize * headSize, scalar_t(0));
+
+      // With a causal mask, keys past the last query of the block never
+      // contribute; skip their blocks entirely.
+      const int64_t kvEnd =
+          is_causal ? std::min(kvSize, qStart + qBlockSize) : kvSize;
+      for (int64_t kvStart = 0; kvStart < kvEnd; kvStart += kvSplitSize) {
+        const int64_t kvBlockSize = std::min(kvSplitSize, kvEnd - kvStart);
+        const scalar_t* k_ptr =
+            k_data + ((i * numHead + j) * kvSize + kvStart) * headSize;
+        const scalar_t* v_ptr =
+            v_data + ((i * numHead + j) * kvSize + kvStart) * headSize;
+
+        // qk = scale * q_block @ k_block^T. Note gemm expects fortran
+        // order, so all 3 matrices are transposed. Swapping argument order
+        // cancels this, since C == AB <=> T(C) == T(B)T(A)
+        cpublas::gemm(
+            TransposeType::Transpose,
+            TransposeType::NoTranspose,
+            kvBlockSize, qBlockSize, headSize,
+            scaling_factor,
+            k_ptr, headSize,
+            q_ptr, headSize,
+            scalar_t(0),
+            qk, kvBlockSize);
+
+        // Mask out keys past each query position in blocks that straddle
+        // the diagonal.
+        if (is_causal && kvStart + kvBlockSize > qStart) {
+          for (const auto row : c10::irange(qBlockSize)) {
+            const int64_t allowed = qStart + row - kvStart + 1;
+            scalar_t* qk_row = qk + row * kvBlockSize;
+            for (int64_t col = std::max<int64_t>(allowed, 0); col < kvBlockSize; col++) {
+              qk_row[col] = kNegInf;
+            }
+          }
+        }
+
+        // Online softmax update: renormalize the running sum and output
+        // accumulator to the new row max, then fold this block in.
+        for (const auto row : c10::irange(qBlockSize)) {
+          scalar_t* qk_row = qk + row * kvBlockSize;
+          const scalar_t row_max = vec::reduce_all<scalar_t>(
+              [](Vec& x, Vec& y) { return vec::maximum(x, y); },
+              qk_row, kvBlockSize);
+          const scalar_t new_max = std::max(qk_max[row], row_max);
+
+          // qk_row <- exp(qk_row - new_max), accumulating the row sum.
+          const Vec max_vec(new_max);
+          Vec sum_vec(scalar_t(0));
+          int64_t d = 0;
+          for (; d <= kvBlockSize - Vec::size(); d += Vec::size()) {
+            Vec x = (Vec::loadu(qk_row + d) - max_vec).exp();
+            x.store(qk_row + d);
+            sum_vec += x;
+          }
+          scalar_t sum = vec::vec_reduce_all<scalar_t>(
+              [](Vec& x, Vec& y) { return x + y; }, sum_vec, Vec::size());
+          for (; d < kvBlockSize; d++) {
+            const scalar_t x = std::exp(qk_row[d] - new_max);
+            qk_row[d] = x;
+            sum += x;
+          }
+
+          const scalar_t factor =
+              qk_max[row] == kNegInf ? scalar_t(0) : std::exp(qk_max[row] - new_max);
+          qk_sum[row] = qk_sum[row] * factor + sum;
+          qk_max[row] = new_max;
+          if (factor != scalar_t(1)) {
+            scalar_t* dst_row = dst + row * headSize;
+            const Vec factor_vec(factor);
+            int64_t e = 0;
+            for (; e <= headSize - Vec::size(); e += Vec::size()) {
+              (Vec::loadu(dst_row + e) * factor_vec).store(dst_row + e);
+            }
+            for (; e < headSize; e++) {
+              dst_row[e] *= factor;
+            }
+          }
+        }
+
+        // dst += qk @ v_block, with the same fortran order argument swap.
+        cpublas::gemm(
+            TransposeType::NoTranspose,
+            TransposeType::NoTranspose,
+            headSize, qBlockSize, kvBlockSize,
+            scalar_t(1),
+            v_ptr, headSize,
+            qk, kvBlockSize,
+            scalar_t(1),
+            dst, headSize);
+      }
+
+      scalar_t* out_ptr =
+          out_data + ((i * numHead + j) * qSize + qStart) * headSize;
+      scalar_t* lse_ptr = lse_data + (i * numHead + j) * qSize + qStart;
+      for (const auto row : c10::irange(qBlockSize)) {
+        const scalar_t* dst_row = dst + row * headSize;
+        scalar_t* out_row = out_ptr + row * headSize;
+        const Vec inv_sum_vec(scalar_t(1) / qk_sum[row]);
+        int64_t e = 0;
+        for (; e <= headSize - Vec::size(); e += Vec::size()) {
+          (Vec::loadu(dst_row + e) * inv_sum_vec).store(out_row + e);
+        }
+        for (; e < headSize; e++) {
+          out_row[e] = dst_row[e] / qk_sum[row];
+        }
+        lse_ptr[row] = qk_max[row] + std::log(qk_sum[row]);
+      }
+
+      data_index_step(i, batchSize, j, numHead, l, qSlice);
+    }
+  });
+}
+
+void flash_attention_kernel_impl(
+    const Tensor& output,
+    const Tensor& logsumexp,
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    double dropout_p,
+    bool is_causal) {
+  TORCH_INTERNAL_ASSERT(dropout_p == 0.0);
+  AT_DISPATCH_FLOATING_TYPES(query.scalar_type(), "flash_attention", [&] {
+    cpu_flash_attention<scalar_t>(
+        output, logsumexp, query, key, value, is_causal);
+  });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(flash_attention_kernel, &flash_attention_kernel_impl);
+
+}} // namespace at::native
@@ -0,0 +1,160 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/ForeachOps.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
+#include <c10/util/irange.h>
+
+namespace at { namespace native {
+
+namespace {
+
+// CPU analogue of the CUDA multi_tensor_apply chunking: every tensor is cut
+// into fixed-size chunks and parallel_for runs over the flattened chunk list,
+// so many small tensors still spread across threads and huge tensors still
+// get split. One chunk roughly matches at::internal::GRAIN_SIZE worth of
+// work.
+constexpr int64_t kChunkSize = 32768;
+
+template <typename scalar_t>
+struct Chunk {
+  scalar_t* out;
+  const scalar_t* in1;
+  const scalar_t* in2;
+  int64_t size;
+};
+
+// The fast-path restrictions guarantee that corresponding tensors share
+// sizes, strides and dtype and are non-overlapping and dense, so their
+// storages can be walked as flat arrays.
+template <typename scalar_t>
+std::vector<Chunk<scalar_t>> build_chunks(
+    TensorList results,
+    TensorList inputs1,
+    TensorList inputs2) {
+  std::vector<Chunk<scalar_t>> chunks;
+  for (const auto i : c10::irange(results.size())) {
+    const int64_t numel = results[i].numel();
+    auto* out = results[i].data_ptr<scalar_t>();
+    const auto* in1 = inputs1[i].data_ptr<scalar_t>();
+    const auto* in2 = inputs2.empty() ? nullptr : inputs2[i].data_ptr<scalar_t>();
+    for (int64_t offset = 0; offset < numel; offset += kChunkSize) {
+      const int64_t size = std::min(kChunkSize, numel - offset);
+      chunks.push_back(
+          {out + offset, in1 + offset, in2 ? in2 + offset : nullptr, size});
+    }
+  }
+  return chunks;
+}
+
+template <typename scalar_t, typename Op>
+void foreach_scalar_loop(
+    const std::vector<Chunk<scalar_t>>& chunks,
+    scalar_t b,
+    Op op) {
+  using Vec = vec::Vectorized<scalar_t>;
+  const Vec vb(b);
+  at::parallel_for(0, chunks.size(), 1, [&](int64_t begin, int64_t end) {
+    for (const auto c : c10::irange(begin, end)) {
+      const auto& chunk = chunks[c];
+      int64_t d = 0;
+      for (; d + Vec::size() <= chunk.size; d += Vec::size()) {
+        op(Vec::loadu(chunk.in1 + d), vb).store(chunk.out + d);
+      }
+      for (; d < chunk.size; d++) {
+        chunk.out[d] = op(chunk.in1[d], b);
+      }
+    }
+  });
+}
+
+template <typename scalar_t, typename Op>
+void foreach_list_loop(
+    const std::vector<Chunk<scalar_t>>& chunks,
+    scalar_t alpha,
+    Op op) {
+  using Vec = vec::Vectorized<scalar_t>;
+  const Vec valpha(alpha);
+  at::parallel_for(0, chunks.size(), 1, [&](int64_t begin, int64_t end) {
+    for (const auto c : c10::irange(begin, end)) {
+      const auto& chunk = chunks[c];
+      int64_t d = 0;
+      for (; d + Vec::size() <= chunk.size; d += Vec::size()) {
+        op(Vec::loadu(chunk.in1 + d), Vec::loadu(chunk.in2 + d), valpha)
+            .store(chunk.out + d);
+      }
+      for (; d < chunk.size; d++) {
+        chunk.out[d] = op(chunk.in1[d], chunk.in2[d], alpha);
+      }
+    }
+  });
+}
+
+void foreach_binary_scalar_kernel(
+    TensorList results,
+    TensorList inputs,
+    const Scalar& scalar,
+    ForeachArithmeticOp op) {
+  AT_DISPATCH_FLOATING_TYPES_AND(
+      kBFloat16, results[0].scalar_type(), "foreach_binary_scalar_cpu", [&]() {
+        const auto chunks = build_chunks<scalar_t>(results, inputs, {});
+        const auto b = scalar.to<scalar_t>();
+        switch (op) {
+          case ForeachArithmeticOp::ADD:
+            foreach_scalar_loop<scalar_t>(
+                chunks, b, [](auto a, auto c) { return a + c; });
+            break;
+          case ForeachArithmeticOp::SUB:
+            foreach_scalar_loop<scalar_t>(
+                chunks, b, [](auto a, auto c) { return a - c; });
+            break;
+          case ForeachArithmeticOp::MUL:
+            foreach_scalar_loop<scalar_t>(
+                chunks, b, [](auto a, auto c) { return a * c; });
+            break;
+          case ForeachArithmeticOp::DIV:
+            foreach_scalar_loop<scalar_t>(
+                chunks, b, [](auto a, auto c) { return a / c; });
+            break;
+        }
+      });
+}
+
+void foreach_binary_list_kernel(
+    TensorList results,
+    TensorList inputs1,
+    TensorList inputs2,
+    const Scalar& alpha,
+    ForeachArithmeticOp op) {
+  AT_DISPATCH_FLOATING_TYPES_AND(
+      kBFloat16, results[0].scalar_type(), "foreach_binary_list_cpu", [&]() {
+        const auto chunks = build_chunks<scalar_t>(results, inputs1, inputs2);
+        const auto a = alpha.to<scalar_t>();
+        switch (op) {
+          case ForeachArithmeticOp::ADD:
+            foreach_list_loop<scalar_t>(
+                chunks, a, [](auto x, auto y, auto al) { return x + y * al; });
+            break;
+          case ForeachArithmeticOp::SUB:
+            foreach_list_loop<scalar_t>(
+                chunks, a, [](auto x, auto y, auto al) { return x - y * al; });
+            break;
+          case ForeachArithmeticOp::MUL:
+            foreach_list_loop<scalar_t>(
+                chunks, a, [](auto x, auto y, auto) { return x * y; });
+            break;
+          case ForeachArithmeticOp::DIV:
+            foreach_list_loop<scalar_t>(
+                chunks, a, [](auto x, auto y, auto) { return x / y; });
+            break;
+        }
+      });
+}
+
+} // namespace
+
+REGISTER_DISPATCH(foreach_binary_scalar_stub, &foreach_binary_scalar_kernel);
+REGISTER_DISPATCH(foreach_binary_list_stub, &foreach_binary_list_kernel);
+
+}} // namespace at::native
@@ -0,0 +1,146 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/FusedAdam.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
+#include <c10/util/irange.h>
+
+#include <cmath>
+
+namespace at { namespace native {
+
+namespace {
+
+// Single pass over one parameter, performing the whole Adam/AdamW update
+// (including weight decay and the AMSGrad max) with SIMD bodies. The math
+// matches cuda/fused_adam_utils.cuh except that it is carried out in the
+// parameter dtype, like the unfused CPU path does.
+template <typename scalar_t>
+void adam_math_kernel(
+    scalar_t* param,
+    const scalar_t* grad,
+    scalar_t* exp_avg,
+    scalar_t* exp_avg_sq,
+    scalar_t* max_exp_avg_sq,
+    const int64_t size,
+    const double lr,
+    const double beta1_,
+    const double beta2_,
+    const double weight_decay,
+    const double eps_,
+    const bool amsgrad,
+    const bool maximize,
+    const float step,
+    const ADAM_MODE adam_mode) {
+  using Vec = vec::Vectorized<scalar_t>;
+  const scalar_t beta1 = static_cast<scalar_t>(beta1_);
+  const scalar_t beta2 = static_cast<scalar_t>(beta2_);
+  const scalar_t eps = static_cast<scalar_t>(eps_);
+  const scalar_t bias_correction1 = 1 - std::pow(beta1, step);
+  const scalar_t bias_correction2_sqrt = std::sqrt(scalar_t(1) - std::pow(beta2, step));
+  const scalar_t step_size = static_cast<scalar_t>(lr) / bias_correction1;
+  // Both weight decay modes fold into one multiplier/addend pair.
+  const scalar_t grad_decay = adam_mode == ADAM_MODE::ORIGINAL
+      ? static_cast<scalar_t>(weight_decay) : scalar_t(0);
+  const scalar_t param_scale = adam_mode == ADAM_MODE::ADAMW
+      ? static_cast<scalar_t>(1 - lr * weight_decay) : scalar_t(1);
+
+  at::parallel_for(0, size, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    int64_t d = begin;
+    for (; d + Vec::size() <= end; d += Vec::size()) {
+      Vec p = Vec::loadu(param + d);
+      Vec g = Vec::loadu(grad + d);
+      if (maximize) {
+        g = g.neg();
+      }
+      if (weight_decay != 0) {
+        if (adam_mode == ADAM_MODE::ORIGINAL) {
+          g = g + p * Vec(grad_decay);
+        } else {
+          p = p * Vec(param_scale);
+        }
+      }
+      Vec m = Vec::loadu(exp_avg + d) * Vec(beta1) + g * Vec(1 - beta1);
+      Vec v = Vec::loadu(exp_avg_sq + d) * Vec(beta2) + g * g * Vec(1 - beta2);
+      Vec denom;
+      if (amsgrad) {
+        Vec vm = vec::maximum(Vec::loadu(max_exp_avg_sq + d), v);
+        vm.store(max_exp_avg_sq + d);
+        denom = vm.sqrt() / Vec(bias_correction2_sqrt) + Vec(eps);
+      } else {
+        denom = v.sqrt() / Vec(bias_correction2_sqrt) + Vec(eps);
+      }
+      p = p - m / denom * Vec(step_size);
+      p.store(param + d);
+      m.store(exp_avg + d);
+      v.store(exp_avg_sq + d);
+    }
+    for (; d < end; d++) {
+      scalar_t p = param[d];
+      scalar_t g = maximize ? -grad[d] : grad[d];
+      if (weight_decay != 0) {
+        if (adam_mode == ADAM_MODE::ORIGINAL) {
+          g += p * grad_decay;
+        } else {
+          p *= param_scale;
+        }
+      }
+      const scalar_t m = beta1 * exp_avg[d] + (1 - beta1) * g;
+      const scalar_t v = beta2 * exp_avg_sq[d] + (1 - beta2) * g * g;
+      scalar_t denom;
+      if (amsgrad) {
+        const scalar_t vm = std::max(max_exp_avg_sq[d], v);
+        max_exp_avg_sq[d] = vm;
+        denom = std::sqrt(vm) / bias_correction2_sqrt + eps;
+      } else {
+        denom = std::sqrt(v) / bias_correction2_sqrt + eps;
+      }
+      param[d] = p - step_size * m / denom;
+      exp_avg[d] = m;
+      exp_avg_sq[d] = v;
+    }
+  });
+}
+
+void fused_adam_kernel(
+    const at::Tensor& param,
+    const at::Tensor& grad,
+    const at::Tensor& exp_avg,
+    const at::Tensor& exp_avg_sq,
+    const at::Tensor& max_exp_avg_sq,
+    const at::Tensor& state_step,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const ADAM_MODE adam_mode) {
+  const float step = state_step.data_ptr<float>()[0];
+  AT_DISPATCH_FLOATING_TYPES(param.scalar_type(), "fused_adam_cpu", [&]() {
+    adam_math_kernel<scalar_t>(
+        param.data_ptr<scalar_t>(),
+        grad.data_ptr<scalar_t>(),
+        exp_avg.data_ptr<scalar_t>(),
+        exp_avg_sq.data_ptr<scalar_t>(),
+        amsgrad ? max_exp_avg_sq.data_ptr<scalar_t>() : nullptr,
+        param.numel(),
+        lr,
+        beta1,
+        beta2,
+        weight_decay,
+        eps,
+        amsgrad,
+        maximize,
+        step,
+        adam_mode);
+  });
+}
+
+} // namespace
+
+REGISTER_DISPATCH(fused_adam_stub, &fused_adam_kernel);
+
+}} // namespace at::native
@@ -1143,6 +1143,106 @@ static inline void grid_sample_2d_grid_slice_iterator(
   }
 }
 
+// ~~~~~~~~~~~~~~~~~~~ Channels-last Grid Sample Kernel ~~~~~~~~~~~~~~~~~~~~~~
+// For channels-last input the C values of one spatial location are
+// contiguous, so instead of vectorizing along W and gathering each corner
+// value with strided per-channel loads (what the NCHW kernels above do),
+// each output pixel computes its coordinates with scalar math and the
+// interpolation itself runs vectorized across C with contiguous loads.
+// Bicubic stays on the generic path: its 16 taps would need the same
+// treatment for little gain over the gather-based kernel.
+
+template <typename scalar_t>
+void grid_sampler_2d_channels_last_impl(
+    const TensorBase &output, const TensorBase &input, const TensorBase &grid,
+    GridSamplerInterpolation interp, GridSamplerPadding padding, bool align_corners) {
+  using Vec = Vectorized<scalar_t>;
+  auto N = input.size(0);
+  auto C = input.size(1);
+  auto inp_H = input.size(2);
+  auto inp_W = input.size(3);
+  auto out_H = grid.size(1);
+  auto out_W = grid.size(2);
+
+  const scalar_t* inp_data = input.data_ptr<scalar_t>();
+  scalar_t* out_data = output.data_ptr<scalar_t>();
+  const auto grid_acc = grid.accessor<scalar_t, 4>();
+
+  const int64_t inp_sN = inp_H * inp_W * C;
+  const int64_t out_sN = out_H * out_W * C;
+
+  // ~4 corner rows of C values touched per output pixel
+  int64_t grain_size = std::max(
+      int64_t(1), at::internal::GRAIN_SIZE / std::max(int64_t(1), 4 * C));
+  at::parallel_for(0, N * out_H * out_W, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto index : c10::irange(begin, end)) {
+      const int64_t w = index % out_W;
+      const int64_t h = (index / out_W) % out_H;
+      const int64_t n = index / (out_H * out_W);
+
+      const scalar_t x = grid_acc[n][h][w][0];
+      const scalar_t y = grid_acc[n][h][w][1];
+      const scalar_t ix = grid_sampler_compute_source_index(x, inp_W, padding, align_corners);
+      const scalar_t iy = grid_sampler_compute_source_index(y, inp_H, padding, align_corners);
+
+      const scalar_t* inp_ptr_N = inp_data + n * inp_sN;
+      scalar_t* out_ptr = out_data + n * out_sN + (h * out_W + w) * C;
+
+      if (interp == GridSamplerInterpolation::Bilinear) {
+        const int64_t ix_nw = static_cast<int64_t>(std::floor(ix));
+        const int64_t iy_nw = static_cast<int64_t>(std::floor(iy));
+        const int64_t ix_se = ix_nw + 1;
+        const int64_t iy_se = iy_nw + 1;
+
+        const scalar_t nw = (ix_se - ix) * (iy_se - iy);
+        const scalar_t ne = (ix - ix_nw) * (iy_se - iy);
+        const scalar_t sw = (ix_se - ix) * (iy - iy_nw);
+        const scalar_t se = (ix - ix_nw) * (iy - iy_nw);
+
+        const bool nw_in = within_bounds_2d(iy_nw, ix_nw, inp_H, inp_W);
+        const bool ne_in = within_bounds_2d(iy_nw, ix_se, inp_H, inp_W);
+        const bool sw_in = within_bounds_2d(iy_se, ix_nw, inp_H, inp_W);
+        const bool se_in = within_bounds_2d(iy_se, ix_se, inp_H, inp_W);
+
+        const scalar_t* nw_ptr = inp_ptr_N + (iy_nw * inp_W + ix_nw) * C;
+        const scalar_t* ne_ptr = nw_ptr + C;
+        const scalar_t* sw_ptr = nw_ptr + inp_W * C;
+        const scalar_t* se_ptr = sw_ptr + C;
+
+        for (int64_t c = 0; c < C; c += Vec::size()) {
+          const int64_t len = std::min(static_cast<int64_t>(Vec::size()), C - c);
+          Vec acc(scalar_t(0));
+          if (nw_in) {
+            acc += Vec::loadu(nw_ptr + c, len) * Vec(nw);
+          }
+          if (ne_in) {
+            acc += Vec::loadu(ne_ptr + c, len) * Vec(ne);
+          }
+          if (sw_in) {
+            acc += Vec::loadu(sw_ptr + c, len) * Vec(sw);
+          }
+          if (se_in) {
+            acc += Vec::loadu(se_ptr + c, len) * Vec(se);
+          }
+          acc.store(out_ptr + c, len);
+        }
+      } else {  // Nearest
+        const int64_t ix_nearest = static_cast<int64_t>(std::nearbyint(ix));
+        const int64_t iy_nearest = static_cast<int64_t>(std::nearbyint(iy));
+        if (within_bounds_2d(iy_nearest, ix_nearest, inp_H, inp_W)) {
+          const scalar_t* src = inp_ptr_N + (iy_nearest * inp_W + ix_nearest) * C;
+          for (int64_t c = 0; c < C; c += Vec::size()) {
+            const int64_t len = std::min(static_cast<int64_t>(Vec::size()), C - c);
+            Vec::loadu(src + c, len).store(out_ptr + c, len);
+          }
+        } else {
+          std::memset(out_ptr, 0, C * sizeof(scalar_t));
+        }
+      }
+    }
+  });
+}
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~ Grid Sample Kernels ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Use the structs & functions defined above to calculate grid sample forward
 // and backward.
@@ -1158,6 +1258,20 @@ void grid_sampler_2d_cpu_kernel_impl(
   auto grain_size = spatial_size == 0 ? (N + 1)
                                       : at::divup(at::internal::GRAIN_SIZE, spatial_size * 4 /* 2d * 2 tensors*/);
 
+  if (input.is_contiguous(at::MemoryFormat::ChannelsLast) &&
+      output.is_contiguous(at::MemoryFormat::ChannelsLast) &&
+      static_cast<GridSamplerInterpolation>(interpolation_mode) !=
+          GridSamplerInterpolation::Bicubic) {
+    AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "grid_sampler_2d_cpu_channels_last", [&] {
+      grid_sampler_2d_channels_last_impl<scalar_t>(
+          output, input, grid,
+          static_cast<GridSamplerInterpolation>(interpolation_mode),
+          static_cast<GridSamplerPadding>(padding_mode),
+          align_corners);
+    });
+    return;
+  }
+
 #define HANDLE_CASE(interp, padding, align_corners)                            \
   case padding: {                                                              \
     ApplyGridSample<scalar_t, 2, interp, padding, align_corners>               \
@@ -1,8 +1,10 @@
 #define TORCH_ASSERT_NO_OPERATORS
 #include <ATen/native/IndexKernel.h>
 
+#include <array>
 #include <cmath>
 #include <iostream>
+#include <limits>
 
 #include <ATen/Context.h>
 #include <ATen/Dispatch.h>
@@ -13,6 +15,7 @@
 #include <ATen/native/cpu/Loops.h>
 #include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
 #include <c10/core/Scalar.h>
 
 namespace at::native {
@@ -20,12 +23,116 @@ namespace {
 
 using namespace vec;
 
+// Variant of cpu_index_kernel (see IndexKernelUtils.h) that uses hardware
+// gathers through at::vec for the common single-index case.  A 1-d strip
+// is eligible when it reads one contiguous int64 index tensor and the
+// indexed dimension is the innermost, contiguous dimension of the source:
+// then the gathered offsets are plain element indices and the whole strip
+// is a vec::gather per Vec::size() elements (with a mask_gather for the
+// tail).  vec256/vec512 lower these to _mm256_i32gather_ps /
+// _mm512_i32gather_ps (and the i64 variants for double), which is what
+// makes gather-bound workloads like index_select run at memory bandwidth.
+// Strips that don't qualify fall back to the same scalar loop as
+// cpu_index_kernel.
+template <typename scalar_t>
+void cpu_index_kernel_vec(TensorIteratorBase& iter, IntArrayRef index_size, IntArrayRef index_stride) {
+  using Vec = Vectorized<scalar_t>;
+  using index_t = int_same_size_t<scalar_t>;
+  using iVec = Vectorized<index_t>;
+
+  int ntensor = iter.ntensors();
+  // see the comment in cpu_index_kernel for the grain size
+  const int index_parallel_grain_size = 3000;
+  auto loop = [&](char** data, const int64_t* strides, int64_t n) {
+    const bool can_gather = ntensor == 3 &&
+        strides[0] == sizeof(scalar_t) && strides[1] == 0 &&
+        strides[2] == sizeof(int64_t) &&
+        index_stride[0] == static_cast<int64_t>(sizeof(scalar_t)) &&
+        index_size[0] <=
+            static_cast<int64_t>(std::numeric_limits<index_t>::max());
+    if (can_gather) {
+      const int64_t size0 = index_size[0];
+      auto* dst_data = reinterpret_cast<scalar_t*>(data[0]);
+      const auto* src_data = reinterpret_cast<const scalar_t*>(data[1]);
+      const auto* index_data = reinterpret_cast<const int64_t*>(data[2]);
+      constexpr int64_t kVecSize = Vec::size();
+      alignas(64) index_t offsets[kVecSize];
+      int64_t i = 0;
+      for (; i + kVecSize <= n; i += kVecSize) {
+        for (const auto k : c10::irange(kVecSize)) {
+          int64_t value = index_data[i + k];
+          TORCH_CHECK_INDEX(value >= -size0 && value < size0,
+                            "index ", value, " is out of bounds for dimension 0 with size ", size0);
+          if (value < 0) {
+            value += size0;
+          }
+          offsets[k] = static_cast<index_t>(value);
+        }
+        auto vindex = iVec::loadu(offsets);
+        gather<sizeof(scalar_t)>(src_data, vindex).store(dst_data + i);
+      }
+      if (i < n) {
+        // Masked tail: inactive lanes gather nothing and are not stored.
+        const int64_t rem = n - i;
+        alignas(64) index_t mask_arr[kVecSize];
+        for (const auto k : c10::irange(kVecSize)) {
+          if (k < rem) {
+            int64_t value = index_data[i + k];
+            TORCH_CHECK_INDEX(value >= -size0 && value < size0,
+                              "index ", value, " is out of bounds for dimension 0 with size ", size0);
+            if (value < 0) {
+              value += size0;
+            }
+            offsets[k] = static_cast<index_t>(value);
+            mask_arr[k] = static_cast<index_t>(-1);
+          } else {
+            offsets[k] = 0;
+            mask_arr[k] = 0;
+          }
+        }
+        auto vindex = iVec::loadu(offsets);
+        // The mask only needs the right bit pattern; loading the int mask
+        // as scalar_t preserves it.
+        auto mask = Vec::loadu(mask_arr);
+        auto out = mask_gather<sizeof(scalar_t)>(
+            Vec(scalar_t(0)), src_data, vindex, mask);
+        out.store(dst_data + i, rem);
+      }
+      return;
+    }
+    // scalar fallback, same as cpu_index_kernel
+    auto indexer = Indexer(ntensor - 2, &data[2], &strides[2], index_size, index_stride);
+    char* dst = data[0];
+    char* src = data[1];
+    if (is_constant_index(ntensor, strides)) {
+      int64_t offset = indexer.get(0);
+      for (const auto elem : c10::irange(n)) {
+        *(scalar_t*)(dst + strides[0] * elem) =
+            *(scalar_t*)(src + strides[1] * elem + offset);
+      }
+    } else {
+      for (const auto elem : c10::irange(n)) {
+        int64_t offset = indexer.get(elem);
+        *(scalar_t*)(dst + strides[0] * elem) =
+            *(scalar_t*)(src + strides[1] * elem + offset);
+      }
+    }
+  };
+  iter.for_each(loop, index_parallel_grain_size);
+}
+
 void index_kernel(TensorIteratorBase& iter, IntArrayRef index_size, IntArrayRef index_stride) {
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(kComplexHalf, kHalf, kBool, kBFloat16,
     iter.dtype(), "index_cpu", [&] {
-    cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
-      *(scalar_t*)dst = *(scalar_t*)(src + offset);
-    });
+    // Hardware gathers only exist for single precision and double; other
+    // dtypes go through the generic element-wise kernel.
+    if constexpr (std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>) {
+      cpu_index_kernel_vec<scalar_t>(iter, index_size, index_stride);
+    } else {
+      cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
+        *(scalar_t*)dst = *(scalar_t*)(src + offset);
+      });
+    }
   });
 }
 
@@ -379,14 +486,98 @@ void masked_scatter_kernel(TensorIterator& iter, const TensorBase& source) {
       });
 }
 
+// Whether masked_compress_strip below has a vectorized implementation for
+// this build's capability; without one the scalar strip loops are used
+// directly so the extra counting pass is not paid for nothing.
+#if defined(CPU_CAPABILITY_AVX512) || defined(CPU_CAPABILITY_AVX2)
+constexpr bool kHasMaskedCompress = true;
+#else
+constexpr bool kHasMaskedCompress = false;
+#endif
+
+/* Stream compaction of one contiguous strip: copies src[i] for every
+ * nonzero mask byte into consecutive dst slots and returns the number
+ * of elements kept. dst_size is the exact number of nonzero mask bytes in
+ * the strip; the vector paths may store a full vector at the write cursor,
+ * which is only safe while the cursor stays dst_size - lanes from the end,
+ * so the last few survivors always go through the scalar tail. AVX-512
+ * uses compress-store directly (which never overstores); AVX2 compacts
+ * 4-byte elements with a 256-entry permutation lookup table indexed by the
+ * movemask of the mask bytes.
+ */
+template <typename scalar_t>
+int64_t masked_compress_strip(
+    scalar_t* dst, int64_t dst_size, const scalar_t* src, const bool* mask, int64_t n) {
+  int64_t kept = 0;
+  int64_t i = 0;
+#if defined(CPU_CAPABILITY_AVX512)
+  if constexpr (sizeof(scalar_t) == 4) {
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= n; i += 16) {
+      const __m128i mask_bytes = _mm_loadu_si128((const __m128i*)(mask + i));
+      const __mmask16 m = _mm_cmpneq_epi8_mask(mask_bytes, zero);
+      const __m512i values = _mm512_loadu_si512((const void*)(src + i));
+      _mm512_mask_compressstoreu_epi32((void*)(dst + kept), m, values);
+      kept += c10::llvm::countPopulation((uint32_t)m);
+    }
+  }
+#elif defined(CPU_CAPABILITY_AVX2)
+  if constexpr (sizeof(scalar_t) == 4) {
+    static const auto compress_lut = []() {
+      std::array<int32_t, 256 * 8> table{};
+      for (const auto m : c10::irange(256)) {
+        int k = 0;
+        for (const auto bit : c10::irange(8)) {
+          if (m & (1 << bit)) {
+            table[m * 8 + k++] = bit;
+          }
+        }
+      }
+      return table;
+    }();
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= n && kept + 8 <= dst_size; i += 8) {
+      const __m128i mask_bytes = _mm_loadl_epi64((const __m128i*)(mask + i));
+      const int m =
+          _mm_movemask_epi8(_mm_cmpeq_epi8(mask_bytes, zero)) ^ 0xff;
+      const __m256i idx =
+          _mm256_loadu_si256((const __m256i*)(compress_lut.data() + m * 8));
+      const __m256i values = _mm256_loadu_si256((const __m256i*)(src + i));
+      _mm256_storeu_si256(
+          (__m256i*)(dst + kept), _mm256_permutevar8x32_epi32(values, idx));
+      kept += c10::llvm::countPopulation((uint32_t)m);
+    }
+  }
+#endif
+  (void)dst_size;
+  for (; i < n; i++) {
+    if (mask[i]) {
+      dst[kept++] = src[i];
+    }
+  }
+  return kept;
+}
+
 template <typename scalar_t, typename mask_t, typename func_t>
-void cpu_masked_select_serial_kernel(TensorIterator& iter, const func_t& f) {
+void cpu_masked_select_serial_kernel(TensorIterator& iter, int64_t result_stride, const func_t& f) {
   auto is_mask_bool = std::is_same<mask_t, bool>::value;
   int64_t offset = 0;
   auto loop = [&](char** data, const int64_t* strides, int64_t n) {
     char* dst = data[0];
     char* src = data[1];
     char* mask = data[2];
+    if (kHasMaskedCompress && sizeof(scalar_t) == 4 &&
+        is_mask_bool && result_stride == 1 &&
+        strides[1] == sizeof(scalar_t) && strides[2] == sizeof(bool)) {
+      const bool* mask_ptr = (const bool*)mask;
+      int64_t strip_kept = 0;
+      for (const auto i : c10::irange(n)) {
+        strip_kept += mask_ptr[i] ? 1 : 0;
+      }
+      offset += masked_compress_strip(
+          (scalar_t*)dst + offset, strip_kept, (const scalar_t*)src, mask_ptr, n);
+      return;
+    }
     for (const auto i : c10::irange(n)) {
       mask_t mask_value = *(mask_t*)(mask + strides[2] * i);
       if (!is_mask_bool) {
@@ -407,11 +598,11 @@ void masked_select_serial_kernel(TensorIterator& iter, int64_t result_stride) {
     iter.dtype(), "masked_select", [&] {
       auto mask_dtype = iter.input_dtype(1);
       if (mask_dtype == ScalarType::Bool) {
-        cpu_masked_select_serial_kernel<scalar_t, bool>(iter, [result_stride](char* dst, char* src, int64_t offset) {
+        cpu_masked_select_serial_kernel<scalar_t, bool>(iter, result_stride, [result_stride](char* dst, char* src, int64_t offset) {
           *(scalar_t*)(dst + offset*result_stride) = *(scalar_t*)src;
         });
       } else {
-        cpu_masked_select_serial_kernel<scalar_t, unsigned char>(iter, [result_stride](char* dst, char* src, int64_t offset) {
+        cpu_masked_select_serial_kernel<scalar_t, unsigned char>(iter, result_stride, [result_stride](char* dst, char* src, int64_t offset) {
           *(scalar_t*)(dst + offset*result_stride) = *(scalar_t*)src;
         });
       }
@@ -419,13 +610,29 @@ void masked_select_serial_kernel(TensorIterator& iter, int64_t result_stride) {
 }
 
 template <typename scalar_t, typename mask_t, typename func_t>
-void cpu_masked_select_kernel(TensorIterator& iter, const func_t& f) {
+void cpu_masked_select_kernel(TensorIterator& iter, int64_t result_stride, const func_t& f) {
   auto is_mask_bool = std::is_same<mask_t, bool>::value;
   auto loop = [&](char** data, const int64_t* strides, int64_t n) {
     char* dst = data[0];
     char* src = data[1];
     char* mask = data[2];
     char* mask_prefix_sum = data[3];
+    if (kHasMaskedCompress && sizeof(scalar_t) == 4 &&
+        is_mask_bool && result_stride == 1 && n > 0 &&
+        strides[1] == sizeof(scalar_t) && strides[2] == sizeof(bool) &&
+        strides[3] == sizeof(int64_t)) {
+      const bool* mask_ptr = (const bool*)mask;
+      // the inclusive prefix sum pins this strip's slice of the output;
+      // its length also bounds the compress stores within the slice so
+      // adjacent strips running on other threads are never touched
+      const int64_t out_begin =
+          *(int64_t*)mask_prefix_sum - (mask_ptr[0] ? 1 : 0);
+      const int64_t out_end = ((int64_t*)mask_prefix_sum)[n - 1];
+      masked_compress_strip(
+          (scalar_t*)dst + out_begin, out_end - out_begin,
+          (const scalar_t*)src, mask_ptr, n);
+      return;
+    }
     for (const auto i : c10::irange(n)) {
       mask_t mask_value = *(mask_t*)(mask + strides[2] * i);
       if (!is_mask_bool) {
@@ -446,11 +653,11 @@ void masked_select_kernel(TensorIterator& iter, int64_t result_stride) {
     iter.dtype(), "masked_select", [&] {
       auto mask_dtype = iter.input_dtype(1);
       if (mask_dtype == ScalarType::Bool) {
-        cpu_masked_select_kernel<scalar_t, bool>(iter, [result_stride](char* dst, char* src, int64_t offset) {
+        cpu_masked_select_kernel<scalar_t, bool>(iter, result_stride, [result_stride](char* dst, char* src, int64_t offset) {
           *(scalar_t*)(dst + offset*result_stride) = *(scalar_t*)src;
         });
       } else {
-        cpu_masked_select_kernel<scalar_t, unsigned char>(iter, [result_stride](char* dst, char* src, int64_t offset) {
+        cpu_masked_select_kernel<scalar_t, unsigned char>(iter, result_stride, [result_stride](char* dst, char* src, int64_t offset) {
           *(scalar_t*)(dst + offset*result_stride) = *(scalar_t*)src;
         });
       }
@@ -58,11 +58,13 @@ dereference(char* C10_RESTRICT data[], const int64_t* strides, int64_t i) {
   return dereference_impl<traits>(data, strides, i, Indices{});
 }
 
-template <typename traits, std::size_t... INDEX>
+// The position of the scalar input `S` is a compile time constant so that the
+// per argument select between the broadcast scalar and a vector load folds
+// away entirely in the hot loop.
+template <typename traits, size_t S, std::size_t... INDEX>
 typename traits::ArgsTuple
 dereference_vec_impl(char* C10_RESTRICT data[],
                      const typename traits::result_type& opt_scalar,
-                     size_t S,
                      int64_t i,
                      std::index_sequence<INDEX...>) {
   using Vec = typename traits::result_type;
@@ -73,11 +75,11 @@ dereference_vec_impl(char* C10_RESTRICT data[],
       Vec::loadu(data[INDEX] + i * sizeof(scalar_t))...);
 }
 
-template <typename traits>
+template <typename traits, size_t S>
 typename traits::ArgsTuple
-dereference_vec(char* C10_RESTRICT data[], const typename traits::result_type& opt_scalar, size_t S, int64_t i) {
+dereference_vec(char* C10_RESTRICT data[], const typename traits::result_type& opt_scalar, int64_t i) {
   using Indices = std::make_index_sequence<traits::arity>;
-  return dereference_vec_impl<traits>(data, opt_scalar, S, i, Indices{});
+  return dereference_vec_impl<traits, S>(data, opt_scalar, i, Indices{});
 }
 
 template <typename func_t,
@@ -192,11 +194,13 @@ multiple_outputs_loop(char* C10_RESTRICT data[], const int64_t* strides_, int64_
 
 // Explicitly vectorized loop implementation. All inputs and outputs must be
 // the same type and contiguous with one exception: a single input may be
-// a scalar (stride 0). It's position is indicated by the argument `S`. If `S`
-// is 0, then there are no scalar inputs.
-template <typename func_t, typename vec_func_t>
+// a scalar (stride 0). Its position is indicated by the template argument `S`.
+// If `S` is 0, then there are no scalar inputs. `S` is a compile time constant
+// so that every broadcast position gets its own specialized inner loop running
+// as a pure SIMD stream, with no stride bookkeeping in the hot path.
+template <size_t S, typename func_t, typename vec_func_t>
 static inline void
-vectorized_loop(char** C10_RESTRICT data_, int64_t n, int64_t S, func_t&& op, vec_func_t&& vop) {
+vectorized_loop(char** C10_RESTRICT data_, int64_t n, func_t&& op, vec_func_t&& vop) {
   using traits = function_traits<vec_func_t>;
   using scalar_t = typename function_traits<func_t>::result_type;
   using Vec = Vectorized<scalar_t>;
@@ -210,8 +214,8 @@ vectorized_loop(char** C10_RESTRICT data_, int64_t n, int64_t S, func_t&& op, ve
   Vec opt_scalar = Vec(S > 0 ? *(scalar_t*)data[S] : scalar_t(0));
   int64_t i = 0;
   for (; i <= n - 2 * Vec::size(); i += 2 * Vec::size()) {
-    auto args1 = dereference_vec<traits>(&data[1], opt_scalar, S, i);
-    auto args2 = dereference_vec<traits>(&data[1], opt_scalar, S, i + Vec::size());
+    auto args1 = dereference_vec<traits, S>(&data[1], opt_scalar, i);
+    auto args2 = dereference_vec<traits, S>(&data[1], opt_scalar, i + Vec::size());
     auto out1 = c10::guts::apply(std::forward<vec_func_t>(vop), std::move(args1));
     auto out2 = c10::guts::apply(std::forward<vec_func_t>(vop), std::move(args2));
     out1.store(data[0] + i * sizeof(scalar_t));
@@ -227,12 +231,15 @@ vectorized_loop(char** C10_RESTRICT data_, int64_t n, int64_t S, func_t&& op, ve
 }
 
 
+// Invokes `cb` with the position of the single stride 0 ("scalar") input as a
+// std::integral_constant, or with 0 if no argument qualifies, so the callback
+// can instantiate a loop specialized for that broadcast position.
 template <typename traits, typename cb_t>
 static inline void unroll_contiguous_scalar_checks(
     const int64_t* /*strides*/,
     std::index_sequence<>,
     cb_t&& cb) {
-  cb(0);
+  cb(std::integral_constant<size_t, 0>{});
 }
 
 template <typename traits, typename cb_t, size_t INDEX0, size_t ...INDEX>
@@ -241,7 +248,7 @@ static inline void unroll_contiguous_scalar_checks(
     std::index_sequence<INDEX0, INDEX...>,
     cb_t&& cb) {
   if (is_contiguous_scalar<traits, INDEX0 + 1>(strides)) {
-    cb(INDEX0 + 1);
+    cb(std::integral_constant<size_t, INDEX0 + 1>{});
   } else {
     unroll_contiguous_scalar_checks<traits>(strides, std::index_sequence<INDEX...>{}, std::forward<cb_t>(cb));
   }
@@ -265,22 +272,41 @@ struct VectorizedLoop2d {
     }
   }
 
+  // True when advancing a row lands exactly where the previous row ended for
+  // every operand, i.e. the whole 2d block is one contiguous stream.
+  static bool rows_are_adjacent(
+      const int64_t* strides, const int64_t* outer_strides, int64_t size0) {
+    for (const auto arg : c10::irange(ntensors)) {
+      if (outer_strides[arg] != strides[arg] * size0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   void operator()(char** base, const int64_t *strides, int64_t size0, int64_t size1) {
     data_t data;
     std::copy_n(base, ntensors, data.data());
     const int64_t *outer_strides = &strides[ntensors];
 
     if (is_contiguous<traits>(strides)) {
+      if (rows_are_adjacent(strides, outer_strides, size0)) {
+        // Sweep adjacent rows in a single inner loop instead of paying the
+        // per row setup and tail handling size1 times.
+        vectorized_loop<0>(data.data(), size0 * size1, op, vop);
+        return;
+      }
       for (const auto i C10_UNUSED : c10::irange(size1)) {
-        vectorized_loop(data.data(), size0, 0, op, vop);
+        vectorized_loop<0>(data.data(), size0, op, vop);
         advance(data, outer_strides);
       }
     } else {
       using Indices = std::make_index_sequence<traits::arity>;
-      unroll_contiguous_scalar_checks<traits>(strides, Indices{}, [&](size_t idx) {
-        if (idx) {
+      unroll_contiguous_scalar_checks<traits>(strides, Indices{}, [&](auto idx) {
+        constexpr size_t S = decltype(idx)::value;
+        if constexpr (S > 0) {
           for (const auto i C10_UNUSED : c10::irange(size1)) {
-            vectorized_loop(data.data(), size0, idx, op, vop);
+            vectorized_loop<S>(data.data(), size0, op, vop);
             advance(data, outer_strides);
           }
         } else {
@@ -1,7 +1,9 @@
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <ATen/core/Tensor.h>
 
+#include <ATen/AccumulateType.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/core/DistributionsHelper.h>
 #include <ATen/native/Copy.h>
 #include <ATen/native/TensorIterator.h>
@@ -9,6 +11,9 @@
 #include <ATen/native/cpu/Loops.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+#include <vector>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
@@ -18,6 +23,134 @@
 namespace at::native {
 namespace {
 
+// With this many samples (or more) per distribution, the O(n_categories) cost
+// of building a Walker alias table is amortized away and each draw becomes
+// O(1) instead of an O(log n_categories) binary search over the CDF.
+constexpr int64_t ALIAS_METHOD_MIN_SAMPLES = 512;
+
+template <typename scalar_t>
+void multinomial_with_replacement_alias_apply(
+    Tensor& result,
+    const Tensor& self,
+    const int64_t n_sample,
+    c10::optional<Generator> generator) {
+  auto gen = get_generator_or_default<CPUGeneratorImpl>(
+      generator, detail::getCPUGeneratorForThread());
+  // See Note [Acquire lock when using random generators]
+  std::lock_guard<std::mutex> lock(gen->mutex_);
+
+  using accscalar_t = at::acc_type<scalar_t, /*is_cuda=*/false>;
+
+  int64_t n_categories = self.size(-1);
+  int64_t n_dist = self.dim() > 1 ? self.size(-2) : 1;
+
+  const scalar_t* const self_ptr = self.data_ptr<scalar_t>();
+  int64_t* const result_ptr = result.data_ptr<int64_t>();
+
+  auto self_stride_0 = self.dim() > 1 ? self.stride(-2) : 0;
+  auto self_stride_1 = self.stride(-1);
+
+  auto result_dist_stride_0 = result.dim() > 1 ? result.stride(-2) : 0;
+  auto result_dist_stride_1 = result.stride(-1);
+
+  /* Walker alias structure: bucket j keeps its own index with probability
+  accept[j] and defers to alias[j] otherwise */
+  std::vector<accscalar_t> probs(n_categories);
+  std::vector<accscalar_t> accept(n_categories);
+  std::vector<int64_t> alias(n_categories);
+  std::vector<int64_t> small, large;
+  small.reserve(n_categories);
+  large.reserve(n_categories);
+  std::vector<double> uniform_samples(n_sample);
+
+  for (const auto i : c10::irange(n_dist)) {
+    /* Validate the distribution and accumulate its sum, mirroring the checks
+    done by the CDF based path */
+    accscalar_t sum = 0;
+    for (const auto j : c10::irange(n_categories)) {
+      accscalar_t val = static_cast<accscalar_t>(
+          self_ptr[i * self_stride_0 + j * self_stride_1]);
+      TORCH_CHECK(
+          val >= 0,
+          "invalid multinomial distribution (encountering probability entry < 0)");
+      TORCH_CHECK(
+          std::isfinite(static_cast<double>(val)),
+          "invalid multinomial distribution (encountering probability entry = infinity or NaN)");
+      sum += val;
+      probs[j] = val;
+    }
+
+    TORCH_CHECK(
+        sum > 0,
+        "invalid multinomial distribution (sum of probabilities <= 0)");
+
+    /* Scale so that the average bucket mass is exactly 1 */
+    for (const auto j : c10::irange(n_categories)) {
+      probs[j] = probs[j] * n_categories / sum;
+    }
+
+    /* Vose's construction: pair each underfull bucket with an overfull donor */
+    small.clear();
+    large.clear();
+    for (const auto j : c10::irange(n_categories)) {
+      if (probs[j] < 1) {
+        small.push_back(j);
+      } else {
+        large.push_back(j);
+      }
+    }
+    while (!small.empty() && !large.empty()) {
+      int64_t s = small.back();
+      small.pop_back();
+      int64_t l = large.back();
+      large.pop_back();
+      accept[s] = probs[s];
+      alias[s] = l;
+      probs[l] = probs[l] + probs[s] - 1;
+      if (probs[l] < 1) {
+        small.push_back(l);
+      } else {
+        large.push_back(l);
+      }
+    }
+    /* Leftover buckets on either stack have mass 1 up to rounding */
+    for (int64_t s : small) {
+      accept[s] = 1;
+      alias[s] = s;
+    }
+    for (int64_t l : large) {
+      accept[l] = 1;
+      alias[l] = l;
+    }
+
+    /* The generator is stateful, so draw all uniforms serially while holding
+    its lock; the O(1) table lookups then parallelize freely */
+    for (const auto j : c10::irange(n_sample)) {
+      at::uniform_real_distribution<double> uniform(0, 1);
+      uniform_samples[j] = uniform(gen);
+    }
+
+    const accscalar_t* const accept_ptr = accept.data();
+    const int64_t* const alias_ptr = alias.data();
+    const double* const uniform_ptr = uniform_samples.data();
+    at::parallel_for(
+        0, n_sample, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+          for (const auto j : c10::irange(begin, end)) {
+            /* One uniform drives both decisions: the integer part picks the
+            bucket, the fractional part is the accept/alias coin flip */
+            double u = uniform_ptr[j] * n_categories;
+            int64_t bucket = std::min(static_cast<int64_t>(u), n_categories - 1);
+            double frac = u - bucket;
+            int64_t sample_idx = frac < static_cast<double>(accept_ptr[bucket])
+                ? bucket
+                : alias_ptr[bucket];
+            result_ptr[i * result_dist_stride_0 + j * result_dist_stride_1] =
+                sample_idx;
+          }
+        });
+  }
+}
+
 template <typename scalar_t>
 void multinomial_with_replacement_apply(
     Tensor& result,
@@ -25,7 +158,7 @@ void multinomial_with_replacement_apply(
     const int64_t n_sample,
     c10::optional<Generator> generator) {
   auto gen = get_generator_or_default<CPUGeneratorImpl>(
-      generator, detail::getDefaultCPUGenerator());
+      generator, detail::getCPUGeneratorForThread());
   // See Note [Acquire lock when using random generators]
   std::lock_guard<std::mutex> lock(gen->mutex_);
 
@@ -128,7 +261,7 @@ void multinomial_with_replacement_apply<BFloat16>(
     const int64_t n_sample,
     c10::optional<Generator> generator) {
   auto gen = get_generator_or_default<CPUGeneratorImpl>(
-      generator, detail::getDefaultCPUGenerator());
+      generator, detail::getCPUGeneratorForThread());
   // See Note [Acquire lock when using random generators]
   std::lock_guard<std::mutex> lock(gen->mutex_);
 
@@ -231,8 +364,14 @@ static void multinomial_with_replacement_kernel_impl(
     c10::optional<Generator> gen) {
   AT_DISPATCH_FLOATING_TYPES_AND2(
       kHalf, kBFloat16, self.scalar_type(), "multinomial", [&] {
-        multinomial_with_replacement_apply<scalar_t>(
-            result, self, n_sample, gen);
+        if (n_sample >= ALIAS_METHOD_MIN_SAMPLES &&
+            n_sample >= self.size(-1)) {
+          multinomial_with_replacement_alias_apply<scalar_t>(
+              result, self, n_sample, gen);
+        } else {
+          multinomial_with_replacement_apply<scalar_t>(
+              result, self, n_sample, gen);
+        }
       });
 }
 } // namespace
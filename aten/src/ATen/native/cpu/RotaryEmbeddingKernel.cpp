@@ -0,0 +1,105 @@
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/DispatchStub.h>
+#include <ATen/native/TensorIterator.h>
+#include <ATen/native/transformers/attention.h>
+#include <c10/util/irange.h>
+
+namespace at { namespace native {
+
+namespace {
+
+/*
+ * Rotary position embedding over one row of D elements, where pairs
+ * (2j, 2j + 1) hold the real and imaginary lanes of position j:
+ *
+ *   out[2j]     = x[2j] * cos[j] - x[2j + 1] * sin[j]
+ *   out[2j + 1] = x[2j] * sin[j] + x[2j + 1] * cos[j]
+ *
+ * The vector loop loads two input vectors at a time, de-interleaves them
+ * into the even and odd lanes, rotates those against a straight run of
+ * cos/sin, and interleaves the result back. Each pair is read before it is
+ * written, so `out` may alias `x` (the in-place variant relies on this).
+ */
+template <typename scalar_t>
+inline void rotary_embedding_row(
+    scalar_t* out,
+    const scalar_t* x,
+    const scalar_t* cos_row,
+    const scalar_t* sin_row,
+    int64_t half) {
+  using Vec = vec::Vectorized<scalar_t>;
+  int64_t j = 0;
+  for (; j + Vec::size() <= half; j += Vec::size()) {
+    Vec a = Vec::loadu(x + 2 * j);
+    Vec b = Vec::loadu(x + 2 * j + Vec::size());
+    Vec even, odd;
+    std::tie(even, odd) = vec::deinterleave2(a, b);
+    Vec c = Vec::loadu(cos_row + j);
+    Vec s = Vec::loadu(sin_row + j);
+    Vec out_even = even * c - odd * s;
+    Vec out_odd = even * s + odd * c;
+    std::tie(a, b) = vec::interleave2(out_even, out_odd);
+    a.store(out + 2 * j);
+    b.store(out + 2 * j + Vec::size());
+  }
+  for (; j < half; j++) {
+    scalar_t x0 = x[2 * j];
+    scalar_t x1 = x[2 * j + 1];
+    out[2 * j] = x0 * cos_row[j] - x1 * sin_row[j];
+    out[2 * j + 1] = x0 * sin_row[j] + x1 * cos_row[j];
+  }
+}
+
+template <typename scalar_t>
+void cpu_rotary_embedding(
+    const Tensor& output,
+    const Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin) {
+  const int64_t dim = self.size(-1);
+  const int64_t seq_len = self.size(-2);
+  const int64_t half = dim / 2;
+  const int64_t rows = self.numel() / dim;
+
+  const scalar_t* x_data = self.data_ptr<scalar_t>();
+  const scalar_t* cos_data = cos.data_ptr<scalar_t>();
+  const scalar_t* sin_data = sin.data_ptr<scalar_t>();
+  scalar_t* out_data = output.data_ptr<scalar_t>();
+
+  const int64_t grain_size =
+      std::max((int64_t)1, at::internal::GRAIN_SIZE / dim);
+  at::parallel_for(0, rows, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto row : c10::irange(begin, end)) {
+      // rows enumerate the leading dims with the sequence dim innermost
+      const int64_t pos = row % seq_len;
+      rotary_embedding_row(
+          out_data + row * dim,
+          x_data + row * dim,
+          cos_data + pos * half,
+          sin_data + pos * half,
+          half);
+    }
+  });
+}
+
+void rotary_embedding_kernel_impl(
+    const Tensor& output,
+    const Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      self.scalar_type(),
+      "rotary_embedding",
+      [&] { cpu_rotary_embedding<scalar_t>(output, self, cos, sin); });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(rotary_embedding_kernel, &rotary_embedding_kernel_impl);
+
+}} // at::native
@@ -9,6 +9,8 @@
 #include <ATen/native/cpu/utils.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+
 namespace at::native {
 
 namespace {
@@ -47,8 +49,13 @@ void sampled_addmm_sparse_csr_kernel_impl(
   auto col_acc = col.accessor<index_t, 2>();
 
   // usually, collapse B and M is a better option,
-  // but for most commonly used case (mat1 and mat2 is 2d tensor), B = 1,
-  // balance partition M by using parallel_sparse_csr.
+  // but for most commonly used case (mat1 and mat2 is 2d tensor), B = 1.
+  //
+  // Each nonzero only touches its own values entry, so partition the nnz
+  // range evenly across threads rather than handing out whole rows: on
+  // power-law inputs where a few rows hold most of the nnz, row-granular
+  // splits leave most cores idle. The owning row of a chunk's first entry
+  // is recovered with a binary search on crow, then tracked incrementally.
   using Vec = vec::Vectorized<scalar_t>;
   for (const auto b : c10::irange(B)) {
     auto crow_slice = crow_acc[b];
@@ -57,22 +64,23 @@ void sampled_addmm_sparse_csr_kernel_impl(
     scalar_t* mat1_ptr = mat1_data + b * M * K;
     scalar_t* mat2_ptr = mat2_data + b * N * K;
 
-    utils::parallel_sparse_csr(crow_slice, M, nnz, [&](int64_t begin, int64_t end) {
-      for (const auto m : c10::irange(begin, end)) {
-        int64_t row_start = crow_slice[m];
-        int64_t row_end = crow_slice[m + 1];
-        for (const auto e : c10::irange(row_start, row_end)) {
-          int64_t n = col_slice[e];
-          scalar_t val = values_slice[e];
-          scalar_t dot = vec::map2_reduce_all<scalar_t>(
-              [](Vec x, Vec y) { return x * y; },
-              [](Vec x, Vec y) { return x + y; },
-              mat1_ptr + m * K,
-              mat2_ptr + n * K,
-              K);
-          val = alpha_ * dot + beta_ * val;
-          values_slice[e] = val;
+    at::parallel_for(0, nnz, 1, [&](int64_t begin, int64_t end) {
+      const index_t* crow_ptr = crow_slice.data();
+      int64_t m = std::upper_bound(crow_ptr, crow_ptr + M + 1, index_t(begin)) - crow_ptr - 1;
+      for (const auto e : c10::irange(begin, end)) {
+        while (crow_slice[m + 1] <= e) {
+          m++;
         }
+        int64_t n = col_slice[e];
+        scalar_t val = values_slice[e];
+        scalar_t dot = vec::map2_reduce_all<scalar_t>(
+            [](Vec x, Vec y) { return x * y; },
+            [](Vec x, Vec y) { return x + y; },
+            mat1_ptr + m * K,
+            mat2_ptr + n * K,
+            K);
+        val = alpha_ * dot + beta_ * val;
+        values_slice[e] = val;
       }
     });
   }
@@ -252,12 +252,68 @@ struct cpu_scatter_gather_base_kernel {
 
     int64_t grain_size = std::max((int64_t) 1, at::internal::GRAIN_SIZE / index_dim_size);
 
+    // scatter with fewer rows than threads (e.g. 1-D scatter_add with a long
+    // index) otherwise runs the whole dim loop on one core: row-level
+    // parallelism is all iter.for_each can offer. Privatizing the output
+    // instead stays deterministic — each thread walks the full index list in
+    // order but only applies the updates landing in its slice of `self`
+    // along dim, so every output location is written by exactly one thread
+    // in the original serial order. The price is re-reading the index list
+    // once per thread, which is why this is gated on long indices.
+    const bool use_privatized_scatter = is_scatter_like &&
+        iter.numel() < at::get_num_threads() &&
+        index_dim_size >= at::internal::GRAIN_SIZE &&
+        self_dim_size > 1 &&
+        at::get_num_threads() > 1;
+
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(
       ScalarType::Bool, ScalarType::Half, ScalarType::BFloat16, iter.dtype(),
       "scatter_gather_tensor_cpu", [&] {
         constexpr auto SELF_ITER_STRIDE_IDX = 0;
         constexpr auto INDEX_ITER_STRIDE_IDX = 2;
         constexpr auto SRC_ITER_STRIDE_IDX = 1;
+
+        if (use_privatized_scatter) {
+          auto loop = [&](char** data, const int64_t* strides, int64_t n) {
+            auto* self_data_bytes = data[SELF_ITER_STRIDE_IDX];
+            auto* index_data_bytes = data[INDEX_ITER_STRIDE_IDX];
+            auto* src_data_bytes = data[SRC_ITER_STRIDE_IDX];
+            // cap the chunk count near the thread count so the redundant
+            // index scans do not multiply beyond the core count
+            int64_t partition_grain = std::max(
+                (int64_t) 1, self_dim_size / at::get_num_threads());
+            for (const auto nelem C10_UNUSED : c10::irange(n)) {
+              auto* self_data = (scalar_t*)self_data_bytes;
+              auto* index_data = (int64_t*)index_data_bytes;
+              auto* src_data = (scalar_t*)src_data_bytes;
+              at::parallel_for(0, self_dim_size, partition_grain,
+                  [&](int64_t partition_begin, int64_t partition_end) {
+                for (const auto i : c10::irange(index_dim_size)) {
+                  int64_t idx_dim = index_data[i * index_dim_stride];
+                  // we are not putting idx_dim in the error message because it disables
+                  // loop optimization in clang-7
+                  TORCH_CHECK(idx_dim >= 0 && idx_dim < index_upper_bound,
+                              "index ", index_data[i * index_dim_stride],
+                              " is out of bounds for dimension ", dim,
+                              " with size ", index_upper_bound);
+                  if (idx_dim >= partition_begin && idx_dim < partition_end) {
+                    kernel_func(
+                      self_data + idx_dim * self_dim_stride,
+                      src_data + i * src_dim_stride);
+                  }
+                }
+              });
+
+              self_data_bytes += strides[SELF_ITER_STRIDE_IDX];
+              index_data_bytes += strides[INDEX_ITER_STRIDE_IDX];
+              src_data_bytes += strides[SRC_ITER_STRIDE_IDX];
+            }
+          };
+          // serial over rows; the parallelism lives inside each row
+          iter.serial_for_each(loop, {0, iter.numel()});
+          return;
+        }
+
         auto loop = [&](char** data, const int64_t* strides, int64_t n) {
           auto* self_data_bytes = data[SELF_ITER_STRIDE_IDX];
           auto* index_data_bytes = data[INDEX_ITER_STRIDE_IDX];
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <numeric>
 
 #include <ATen/Dispatch.h>
@@ -116,22 +117,58 @@ inline void _vec_softmax_lastdim(
     for (const auto i : c10::irange(begin, end)) {
       scalar_t* input_data = input_data_base + i * dim_size;
       scalar_t* output_data = output_data_base + i * dim_size;
-      scalar_t max_input = vec::reduce_all<scalar_t>(
-          [](Vec& x, Vec& y) { return vec::maximum(x, y); },
-          input_data,
-          dim_size);
-      vec::map(
-          [max_input](Vec x) { return (x - Vec(max_input)).exp(); },
-          output_data,
-          input_data,
-          dim_size);
-      scalar_t tmp_sum = vec::reduce_all<scalar_t>(
-          [](Vec x, Vec y) { return x + y; }, output_data, dim_size);
+      // Online normalizer calculation (Milakov and Gimelshein, 2018): a
+      // single read of the row maintains the running max together with the
+      // sum of exponentials rescaled to it, so softmax sweeps the row twice
+      // (reduce + write) instead of four times (max, exp, sum, divide).
+      // Rows that dominate decode workloads are memory bound, so trading
+      // the extra exp per element for two fewer sweeps is a win.
+      scalar_t max_input;
+      scalar_t tmp_sum;
+      int64_t d = dim_size - (dim_size % Vec::size());
+      if (d > 0) {
+        Vec max_vec = Vec::loadu(input_data);
+        // exp(x0 - x0) per lane
+        Vec sum_vec = Vec(scalar_t(1));
+        for (int64_t j = Vec::size(); j < d; j += Vec::size()) {
+          Vec x_vec = Vec::loadu(input_data + j);
+          Vec new_max_vec = vec::maximum(max_vec, x_vec);
+          sum_vec = sum_vec * (max_vec - new_max_vec).exp() +
+              (x_vec - new_max_vec).exp();
+          max_vec = new_max_vec;
+        }
+        // combine the per-lane running maxes/sums
+        __at_align__ scalar_t max_arr[Vec::size()];
+        __at_align__ scalar_t sum_arr[Vec::size()];
+        max_vec.store(max_arr);
+        sum_vec.store(sum_arr);
+        max_input = max_arr[0];
+        for (const auto j : c10::irange(1, Vec::size())) {
+          max_input = std::max(max_input, max_arr[j]);
+        }
+        tmp_sum = scalar_t(0);
+        for (const auto j : c10::irange(Vec::size())) {
+          tmp_sum += sum_arr[j] * std::exp(max_arr[j] - max_input);
+        }
+      } else {
+        max_input = -std::numeric_limits<scalar_t>::infinity();
+        tmp_sum = scalar_t(0);
+      }
+      for (int64_t j = d; j < dim_size; ++j) {
+        const scalar_t x = input_data[j];
+        if (x > max_input) {
+          tmp_sum *= std::exp(max_input - x);
+          max_input = x;
+        }
+        tmp_sum += std::exp(x - max_input);
+      }
       tmp_sum = 1 / tmp_sum;
       vec::map(
-          [tmp_sum](Vec x) { return x * Vec(tmp_sum); },
-          output_data,
+          [tmp_sum, max_input](Vec x) {
+            return (x - Vec(max_input)).exp() * Vec(tmp_sum);
+          },
           output_data,
+          input_data,
           dim_size);
     }
   });
@@ -11,6 +11,9 @@
 #include <c10/core/WrapDimMinimal.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace at::native {
 
 namespace {
@@ -65,6 +68,110 @@ void _dim_apply(
   );
 }
 
+// Minimum number of elements along the sorted dimension before sort_kernel
+// prefers the radix sort path; below this the comparison sorts win because
+// radix needs scratch buffers and a fixed number of counting passes.
+constexpr int64_t RADIX_SORT_MIN_SIZE = 256;
+
+/* Maps a value to an unsigned key whose unsigned ascending order matches the
+ * order imposed by KeyValueCompAsc below, including its NaN handling (every
+ * NaN, regardless of sign, sorts after all numbers).
+ *
+ * Integral types use the usual sign-bit flip. Half and BFloat16 are
+ * sign-magnitude, so negative values have their bits complemented and
+ * positive values get the sign bit set; NaNs collapse onto the maximal key,
+ * which is harmless because the original values are permuted separately.
+ */
+template <typename scalar_t>
+auto radix_sort_key(scalar_t v) {
+  if constexpr (std::is_integral<scalar_t>::value) {
+    using unsigned_t = std::make_unsigned_t<scalar_t>;
+    auto bits = static_cast<unsigned_t>(v);
+    if (std::is_signed<scalar_t>::value) {
+      bits ^= unsigned_t(1) << (8 * sizeof(scalar_t) - 1);
+    }
+    return bits;
+  } else {
+    if (_isnan<scalar_t>(v)) {
+      return static_cast<uint16_t>(0xffff);
+    }
+    const uint16_t bits = v.x;
+    return static_cast<uint16_t>(
+        (bits & 0x8000) ? ~bits : (bits | 0x8000));
+  }
+}
+
+/* Stable LSD radix sort over (key, index) pairs, one byte per pass, applied
+ * to a single line along the sorted dimension. Descending order is obtained
+ * by complementing the keys, which also keeps NaNs first as the comparators
+ * require. Passes in which every element shares the same byte are skipped,
+ * so e.g. int64 ID tensors with small ranges only pay for the low bytes.
+ *
+ * Stability makes this a valid implementation for both the stable and the
+ * unstable variants of torch.sort. Parallelism across lines is provided by
+ * _dim_apply, so each call runs single-threaded.
+ */
+template <typename scalar_t, typename value_accessor_t, typename indices_accessor_t>
+void radix_sort_with_indices(
+    value_accessor_t values_accessor,
+    indices_accessor_t indices_accessor,
+    int64_t n,
+    bool descending) {
+  using key_t = decltype(radix_sort_key(std::declval<scalar_t>()));
+  constexpr int n_passes = sizeof(key_t);
+
+  std::vector<key_t> keys(n), keys_tmp(n);
+  std::vector<int64_t> perm(n), perm_tmp(n);
+  std::vector<scalar_t> values_in(n);
+  std::vector<int64_t> indices_in(n);
+
+  for (const auto i : c10::irange(n)) {
+    values_in[i] = values_accessor[i];
+    indices_in[i] = indices_accessor[i];
+    const key_t key = radix_sort_key<scalar_t>(values_in[i]);
+    keys[i] = descending ? static_cast<key_t>(~key) : key;
+    perm[i] = i;
+  }
+
+  key_t* keys_in_p = keys.data();
+  key_t* keys_out_p = keys_tmp.data();
+  int64_t* perm_in_p = perm.data();
+  int64_t* perm_out_p = perm_tmp.data();
+
+  for (const auto pass : c10::irange(n_passes)) {
+    const int shift = 8 * pass;
+    int64_t counts[256] = {};
+    for (const auto i : c10::irange(n)) {
+      counts[(keys_in_p[i] >> shift) & 0xff]++;
+    }
+    if (counts[(keys_in_p[0] >> shift) & 0xff] == n) {
+      continue;
+    }
+
+    int64_t offset = 0;
+    for (const auto bucket : c10::irange(256)) {
+      const int64_t count = counts[bucket];
+      counts[bucket] = offset;
+      offset += count;
+    }
+
+    for (const auto i : c10::irange(n)) {
+      const auto bucket = (keys_in_p[i] >> shift) & 0xff;
+      keys_out_p[counts[bucket]] = keys_in_p[i];
+      perm_out_p[counts[bucket]] = perm_in_p[i];
+      counts[bucket]++;
+    }
+
+    std::swap(keys_in_p, keys_out_p);
+    std::swap(perm_in_p, perm_out_p);
+  }
+
+  for (const auto i : c10::irange(n)) {
+    values_accessor[i] = values_in[perm_in_p[i]];
+    indices_accessor[i] = indices_in[perm_in_p[i]];
+  }
+}
+
 template <typename scalar_t>
 struct KeyValueCompAsc {
   template <typename LHS, typename RHS>
@@ -113,6 +220,18 @@ static void sort_kernel(
         decltype(values_accessor), decltype(indices_accessor)
       >(values_accessor, indices_accessor);
 
+      constexpr bool is_radix_sort_dtype =
+          (std::is_integral<scalar_t>::value && !std::is_same<scalar_t, bool>::value)
+          || std::is_same<scalar_t, c10::Half>::value
+          || std::is_same<scalar_t, c10::BFloat16>::value;
+      if constexpr (is_radix_sort_dtype) {
+        if (dim_size >= RADIX_SORT_MIN_SIZE) {
+          radix_sort_with_indices<scalar_t>(
+              values_accessor, indices_accessor, dim_size, descending);
+          return;
+        }
+      }
+
       if (descending) {
         if (stable) {
           std::stable_sort(composite_accessor, composite_accessor + dim_size,
@@ -137,6 +256,90 @@ static void sort_kernel(
   );
 }
 
+// Minimum row length before topk_kernel considers splitting a single row
+// across threads; shorter rows are cheaper to scan serially than to merge.
+constexpr int64_t INTRA_ROW_TOPK_MIN_SIZE = internal::GRAIN_SIZE;
+
+/* Intra-row parallel topk for the few-rows/long-row case that the row-level
+ * parallelism in topk_impl_loop cannot use (e.g. topk over a single large
+ * vector). Each thread scans a contiguous slice of the row while maintaining
+ * a k-element binary heap whose root is its current worst candidate; the
+ * per-thread survivors (at most num_threads * k elements) are then merged and
+ * the final k selected serially. NaN ordering matches topk_impl_loop.
+ */
+template <typename scalar_t, typename accscalar_t>
+void topk_intra_row_loop(
+    const int64_t mode_values_stride,
+    const int64_t mode_indices_stride,
+    const int64_t tmp_values_stride,
+    const int64_t k,
+    const int64_t dim_size,
+    const bool largest,
+    char** data, const int64_t* strides, const int64_t n) {
+  using elem_t = std::pair<accscalar_t, int64_t>;
+  // true iff x belongs before y in the output
+  const auto better = [largest](const elem_t& x, const elem_t& y) -> bool {
+    if (largest) {
+      return (_isnan<accscalar_t>(x.first) && !_isnan<accscalar_t>(y.first))
+          || (x.first > y.first);
+    }
+    return (!_isnan<accscalar_t>(x.first) && _isnan<accscalar_t>(y.first))
+        || (x.first < y.first);
+  };
+  // heap comparator placing the worst kept candidate at the root
+  const auto heap_comp = [&better](const elem_t& x, const elem_t& y) -> bool {
+    return better(y, x);
+  };
+
+  for (const auto i : c10::irange(n)) {
+    TensorAccessor<scalar_t, 1> mode_values(
+        reinterpret_cast<scalar_t*>(data[0] + i * strides[0]),
+        &k, &mode_values_stride);
+    TensorAccessor<int64_t, 1> mode_indices(
+        reinterpret_cast<int64_t*>(data[1] + i * strides[1]),
+        &k, &mode_indices_stride);
+    TensorAccessor<scalar_t, 1> tmp_values(
+        reinterpret_cast<scalar_t*>(data[2] + i * strides[2]),
+        &dim_size, &tmp_values_stride);
+
+    const int num_threads = at::get_num_threads();
+    std::vector<std::vector<elem_t>> thread_heaps(num_threads);
+    at::parallel_for(0, dim_size, internal::GRAIN_SIZE,
+        [&](int64_t begin, int64_t end) {
+      auto& heap = thread_heaps[at::get_thread_num()];
+      heap.reserve(k);
+      for (const auto j : c10::irange(begin, end)) {
+        const elem_t candidate{
+            static_cast<accscalar_t>(tmp_values[j]), j};
+        if (static_cast<int64_t>(heap.size()) < k) {
+          heap.push_back(candidate);
+          std::push_heap(heap.begin(), heap.end(), heap_comp);
+        } else if (better(candidate, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), heap_comp);
+          heap.back() = candidate;
+          std::push_heap(heap.begin(), heap.end(), heap_comp);
+        }
+      }
+    });
+
+    std::vector<elem_t> merged;
+    merged.reserve(static_cast<size_t>(num_threads) * k);
+    for (const auto& heap : thread_heaps) {
+      merged.insert(merged.end(), heap.begin(), heap.end());
+    }
+    // dim_size >= k is checked by the caller, so merged holds at least k
+    // candidates. Always sort the survivors: k is small on this path and the
+    // merged order is meaningless, so the unsorted variant gains nothing
+    // from skipping it.
+    std::partial_sort(merged.begin(), merged.begin() + k, merged.end(), better);
+
+    for (const auto j : c10::irange(k)) {
+      mode_values[j] = merged[j].first;
+      mode_indices[j] = merged[j].second;
+    }
+  }
+}
+
 static void topk_kernel(
     const TensorBase &values,
     const TensorBase &indices,
@@ -159,7 +362,32 @@ static void topk_kernel(
   auto mode_indices_stride = indices.strides()[dim];
   auto tmp_values_stride = self.strides()[dim];
 
+  // With fewer rows than threads the row-level parallelism below leaves
+  // cores idle, so long rows with a small k are split across threads
+  // instead. k <= dim_size is guaranteed, so k > 0 also covers dim_size > 0.
+  const bool use_intra_row_parallel =
+      k > 0 && k * 64 <= sizes[dim] &&
+      sizes[dim] >= INTRA_ROW_TOPK_MIN_SIZE &&
+      iter.numel() < at::get_num_threads();
+
   AT_DISPATCH_ALL_TYPES_AND(ScalarType::BFloat16, self.scalar_type(), "topk_cpu", [&] {
+    if (use_intra_row_parallel) {
+      auto loop = [&](char** data, const int64_t* strides, int64_t n) {
+        if (self.scalar_type() == ScalarType::BFloat16) {
+          return topk_intra_row_loop<scalar_t, float>(
+              mode_values_stride, mode_indices_stride, tmp_values_stride,
+              k, sizes[dim], largest, data, strides, n);
+        } else {
+          return topk_intra_row_loop<scalar_t, scalar_t>(
+              mode_values_stride, mode_indices_stride, tmp_values_stride,
+              k, sizes[dim], largest, data, strides, n);
+        }
+      };
+      // serial over rows; the parallelism lives inside each row
+      iter.serial_for_each(loop, {0, iter.numel()});
+      return;
+    }
+
     auto loop = [&](char** data, const int64_t* strides, int64_t n) {
       if (self.scalar_type() == ScalarType::BFloat16) {
         return topk_impl_loop<scalar_t, float>(
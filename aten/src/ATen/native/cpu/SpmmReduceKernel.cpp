@@ -21,6 +21,87 @@ namespace at { namespace native {
 
 namespace {
 
+// Accumulates one CSR row into the column slice [k_begin, k_end) of out_ptr.
+// Different column slices are disjoint, so a heavy row can be reduced by
+// several threads at once without any cross-thread combine step.
+template <typename scalar_t, typename index_t, ReductionType reduce>
+inline void spmm_reduce_row_slice(
+    scalar_t* out_ptr,
+    const scalar_t* other_data,
+    const TensorAccessor<index_t, 1>& col_data,
+    const TensorAccessor<scalar_t, 1>& val_data,
+    int64_t row_start,
+    int64_t row_end,
+    int64_t K,
+    int64_t k_begin,
+    int64_t k_end) {
+  using Vec = vec::Vectorized<scalar_t>;
+  constexpr int64_t kVecSize = Vec::size();
+  constexpr int64_t kVLEN = kVecSize * 4;
+  constexpr int64_t CHUNK_SIZE = 16;
+  int64_t c;
+
+  // step 1: reinit the output row for reduce type 'amax' and 'amin'
+  int64_t count = row_end - row_start;
+  if (count != 0) {
+    init<scalar_t, reduce>(out_ptr + k_begin, k_end - k_begin, /*include_self*/false);
+  }
+
+  const int64_t len = k_end - k_begin;
+  const int64_t kv_end = k_begin + (len / kVLEN) * kVLEN;
+  const int64_t ks_end = k_begin + (len / kVecSize) * kVecSize;
+
+  // step 2: reduce, do blocking on rowwise to reduce write memory bandwidth
+  for (int64_t e0 = row_start; e0 < row_end; e0 += CHUNK_SIZE) {
+    int64_t e1 = std::min(e0 + CHUNK_SIZE, row_end);
+
+    int64_t k = k_begin;
+    for (; k < kv_end; k += kVLEN) {
+      Vec out_vec0 = Vec::loadu(out_ptr + k);
+      Vec out_vec1 = Vec::loadu(out_ptr + k + kVecSize);
+      Vec out_vec2 = Vec::loadu(out_ptr + k + kVecSize * 2);
+      Vec out_vec3 = Vec::loadu(out_ptr + k + kVecSize * 3);
+      for (const auto e : c10::irange(e0, e1)) {
+        c = col_data[e];
+        scalar_t val = val_data[e];
+        const scalar_t* other_ptr = other_data + c * K + k;
+
+        out_vec0 = update<Vec, reduce>(out_vec0, Vec::loadu(other_ptr) * Vec(val));
+        out_vec1 = update<Vec, reduce>(out_vec1, Vec::loadu(other_ptr + kVecSize) * Vec(val));
+        out_vec2 = update<Vec, reduce>(out_vec2, Vec::loadu(other_ptr + kVecSize * 2) * Vec(val));
+        out_vec3 = update<Vec, reduce>(out_vec3, Vec::loadu(other_ptr + kVecSize * 3) * Vec(val));
+      }
+      out_vec0.store(out_ptr + k);
+      out_vec1.store(out_ptr + k + kVecSize);
+      out_vec2.store(out_ptr + k + kVecSize * 2);
+      out_vec3.store(out_ptr + k + kVecSize * 3);
+    }
+    for (; k < ks_end; k += kVecSize) {
+      Vec out_vec = Vec::loadu(out_ptr + k);
+      for (const auto e : c10::irange(e0, e1)) {
+        c = col_data[e];
+        scalar_t val = val_data[e];
+        const scalar_t* other_ptr = other_data + c * K;
+        out_vec = update<Vec, reduce>(out_vec, Vec::loadu(other_ptr + k) * Vec(val));
+      }
+      out_vec.store(out_ptr + k);
+    }
+    for (; k < k_end; k++) {
+      scalar_t out_val = out_ptr[k];
+      for (const auto e : c10::irange(e0, e1)) {
+        c = col_data[e];
+        scalar_t val = val_data[e];
+        const scalar_t* other_ptr = other_data + c * K;
+        out_val = update<scalar_t, reduce>(out_val, other_ptr[k] * val);
+      }
+      out_ptr[k] = out_val;
+    }
+  }
+
+  // step 3: finalize
+  write<scalar_t, reduce>(out_ptr + k_begin, count, len);
+}
+
 template <typename scalar_t, typename index_t, ReductionType reduce>
 void spmm_reduce_kernel_impl(
     const Tensor& out,
@@ -46,76 +127,47 @@ void spmm_reduce_kernel_impl(
   int64_t M = crow_indices.numel() - 1;
   int64_t K = other.size(-1);
 
+  // parallel_sparse_csr balances nnz across threads but hands out whole rows,
+  // so on power-law inputs a handful of heavy rows still pins the kernel to a
+  // few cores. When a single row exceeds a fair thread share, split the output
+  // columns across threads instead: every thread walks all the rows but only
+  // reduces its own column slice, which balances perfectly at the price of
+  // re-reading the index/value arrays per thread. Only worth it when each
+  // slice is still wide enough to vectorize.
+  int num_threads = at::get_num_threads();
+  int64_t max_row_nnz = 0;
+  for (const auto m : c10::irange(M)) {
+    max_row_nnz = std::max(max_row_nnz, (int64_t)(csr_data[m + 1] - csr_data[m]));
+  }
   using Vec = vec::Vectorized<scalar_t>;
-  utils::parallel_sparse_csr(csr_data, M, nnz, [&](int64_t begin, int64_t end) {
-    int64_t row_start, row_end, c;
-    for (const auto m : c10::irange(begin, end)) {
-      row_start = csr_data[m];
-      row_end = csr_data[m + 1];
-
-      scalar_t* out_ptr = out_data + m * K;
-
-      constexpr int64_t kVecSize = Vec::size();
-      constexpr int64_t kVLEN = kVecSize * 4;
-      constexpr int64_t CHUNK_SIZE = 16;
-
-      // step 1: reinit the output row for reduce type 'amax' and 'amin'
-      int64_t count = row_end - row_start;
-      if (count != 0) {
-        init<scalar_t, reduce>(out_ptr, K, /*include_self*/false);
+  const bool column_split = num_threads > 1 &&
+      max_row_nnz > divup(nnz, (int64_t)num_threads) &&
+      K / num_threads >= Vec::size();
+
+  if (column_split) {
+    int64_t k_block = divup(K, (int64_t)num_threads);
+    at::parallel_for(0, num_threads, 1, [&](int64_t cbegin, int64_t cend) {
+      int tid = at::get_thread_num();
+      int64_t k_begin = std::min(tid * k_block, K);
+      int64_t k_end = std::min(k_begin + k_block, K);
+      if (k_begin == k_end) {
+        return;
       }
-
-      // step 2: reduce, do blocking on rowwise to reduce write memory bandwidth
-      for (int64_t e0 = row_start; e0 < row_end; e0 += CHUNK_SIZE) {
-        int64_t e1 = std::min(e0 + CHUNK_SIZE, row_end);
-
-        int64_t k = 0;
-        for (; k < K - (K % kVLEN); k += kVLEN) {
-          Vec out_vec0 = Vec::loadu(out_ptr + k);
-          Vec out_vec1 = Vec::loadu(out_ptr + k + kVecSize);
-          Vec out_vec2 = Vec::loadu(out_ptr + k + kVecSize * 2);
-          Vec out_vec3 = Vec::loadu(out_ptr + k + kVecSize * 3);
-          for (const auto e : c10::irange(e0, e1)) {
-            c = col_data[e];
-            scalar_t val = val_data[e];
-            scalar_t* other_ptr = other_data + c * K + k;
-
-            out_vec0 = update<Vec, reduce>(out_vec0, Vec::loadu(other_ptr) * Vec(val));
-            out_vec1 = update<Vec, reduce>(out_vec1, Vec::loadu(other_ptr + kVecSize) * Vec(val));
-            out_vec2 = update<Vec, reduce>(out_vec2, Vec::loadu(other_ptr + kVecSize * 2) * Vec(val));
-            out_vec3 = update<Vec, reduce>(out_vec3, Vec::loadu(other_ptr + kVecSize * 3) * Vec(val));
-          }
-          out_vec0.store(out_ptr + k);
-          out_vec1.store(out_ptr + k + kVecSize);
-          out_vec2.store(out_ptr + k + kVecSize * 2);
-          out_vec3.store(out_ptr + k + kVecSize * 3);
-        }
-        for (; k < K - (K % kVecSize); k += kVecSize) {
-          Vec out_vec = Vec::loadu(out_ptr + k);
-          for (const auto e : c10::irange(e0, e1)) {
-            c = col_data[e];
-            scalar_t val = val_data[e];
-            scalar_t* other_ptr = other_data + c * K;
-            out_vec = update<Vec, reduce>(out_vec, Vec::loadu(other_ptr + k) * Vec(val));
-          }
-          out_vec.store(out_ptr + k);
-        }
-        for (; k < K; k++) {
-          scalar_t out_val = out_ptr[k];
-          for (const auto e : c10::irange(e0, e1)) {
-            c = col_data[e];
-            scalar_t val = val_data[e];
-            scalar_t* other_ptr = other_data + c * K;
-            out_val = update<scalar_t, reduce>(out_val, other_ptr[k] * val);
-          }
-          out_ptr[k] = out_val;
-        }
+      for (const auto m : c10::irange(M)) {
+        spmm_reduce_row_slice<scalar_t, index_t, reduce>(
+            out_data + m * K, other_data, col_data, val_data,
+            csr_data[m], csr_data[m + 1], K, k_begin, k_end);
       }
-
-      // step 3: finalize
-      write<scalar_t, reduce>(out_ptr, count, K);
-    }
-  });
+    });
+  } else {
+    utils::parallel_sparse_csr(csr_data, M, nnz, [&](int64_t begin, int64_t end) {
+      for (const auto m : c10::irange(begin, end)) {
+        spmm_reduce_row_slice<scalar_t, index_t, reduce>(
+            out_data + m * K, other_data, col_data, val_data,
+            csr_data[m], csr_data[m + 1], K, 0, K);
+      }
+    });
+  }
 }
 
 // update both val and arg, used for `amin` and `amax`
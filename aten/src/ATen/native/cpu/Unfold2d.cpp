@@ -25,10 +25,9 @@ static inline void cadd(
                   reinterpret_cast<char*>(const_cast<scalar_t*>(x)),
                   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
                   reinterpret_cast<char*>(const_cast<scalar_t*>(y))};
-  vectorized_loop(
+  vectorized_loop</*S=*/0>(
       ptrs,
       n,
-      -1,
       [](scalar_t x, scalar_t y) -> scalar_t { return x + y; },
       [](Vec x, Vec y) -> Vec { return x + y; });
 }
@@ -39,9 +39,6 @@ static __m128i inline mm_cvtepu8_epi32(const uint32_t* C10_RESTRICT ptr) {
   return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)ptr));
 }
 
-// TODO: We may want to hard-code an unrolled version for the case where
-// num_channels=3 to hint the compiler to vectorize this (looks at original
-// PIL-SIMD's code).
 at::Tensor unpack_rgb(const at::Tensor& packed_tensor) {
   // Convert a "packed" tensor (typically RGBRGBRGB if channels_last) into
   // RGBARGBARGBA format where A is hard-coded to 255. Each pixel is encoded
@@ -59,7 +56,29 @@ at::Tensor unpack_rgb(const at::Tensor& packed_tensor) {
   auto stride_i = packed_tensor.stride(2);
   auto stride_j = packed_tensor.stride(0);
 
-  for (const auto i : c10::irange(num_pixels)) {
+  int64_t i = 0;
+  if (num_channels == 3 && stride_i == 3 && stride_j == 1) {
+    // Channels_last RGB: expand RGBRGB... into RGB0RGB0... four pixels at a
+    // time with a byte shuffle. The load reads 16 bytes (5 and a third
+    // pixels), so stop early enough that it stays within the packed buffer
+    // and let the scalar loop finish the tail.
+    const __m128i shuffle = _mm_set_epi8(
+        -1, 11, 10, 9, -1, 8, 7, 6, -1, 5, 4, 3, -1, 2, 1, 0);
+    for (; i + 6 <= num_pixels; i += 4) {
+      __m128i pixels = _mm_loadu_si128((const __m128i*)(packed + 3 * i));
+      _mm_storeu_si128(
+          (__m128i*)(unpacked + 4 * i), _mm_shuffle_epi8(pixels, shuffle));
+    }
+  } else if (num_channels == 1 && stride_i == 1) {
+    // Grayscale: zero-extend each byte into the first channel of an RGBA
+    // pixel, eight pixels at a time.
+    for (; i + 8 <= num_pixels; i += 8) {
+      __m128i pixels = _mm_loadl_epi64((const __m128i*)(packed + i));
+      _mm256_storeu_si256(
+          (__m256i*)(unpacked + 4 * i), _mm256_cvtepu8_epi32(pixels));
+    }
+  }
+  for (; i < num_pixels; i++) {
     for (const auto j : c10::irange(rgba_size)) {
       unpacked[rgba_size * i + j] = (j < num_channels) ? packed[stride_i * i + stride_j * j] : 0;
     }
@@ -80,7 +99,32 @@ void pack_rgb(
   auto packed_increment = packed_tensor.stride(2);
   auto packed_stride = packed_tensor.stride(0);
 
-  for (const auto i C10_UNUSED : c10::irange(num_pixels)) {
+  int64_t i = 0;
+  if (num_channels == 3 && packed_increment == 3 && packed_stride == 1) {
+    // Channels_last RGB: drop the alpha byte of four RGBA pixels with a
+    // shuffle. The 16 byte store spills 4 bytes past the 12 packed ones
+    // (overwritten by the next iteration), so stop early enough that the
+    // last store stays in bounds and let the scalar loop finish the tail.
+    const __m128i shuffle = _mm_set_epi8(
+        -1, -1, -1, -1, 14, 13, 12, 10, 9, 8, 6, 5, 4, 2, 1, 0);
+    for (; i + 6 <= num_pixels; i += 4) {
+      __m128i pixels = _mm_loadu_si128((const __m128i*)(unpacked + 4 * i));
+      _mm_storeu_si128(
+          (__m128i*)(packed + 3 * i), _mm_shuffle_epi8(pixels, shuffle));
+    }
+  } else if (num_channels == 1 && packed_increment == 1) {
+    // Grayscale: gather the first byte of four RGBA pixels.
+    const __m128i shuffle = _mm_set_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 12, 8, 4, 0);
+    for (; i + 4 <= num_pixels; i += 4) {
+      __m128i pixels = _mm_loadu_si128((const __m128i*)(unpacked + 4 * i));
+      *(int32_t*)(packed + i) =
+          _mm_cvtsi128_si32(_mm_shuffle_epi8(pixels, shuffle));
+    }
+  }
+  unpacked += rgba_size * i;
+  packed += packed_increment * i;
+  for (; i < num_pixels; i++) {
     for (const auto j : c10::irange(num_channels)) {
       packed[j * packed_stride] = unpacked[j];
     }
@@ -0,0 +1,230 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/cpu/WinogradConvKernel.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/CPUBlas.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/constant_pad_nd.h>
+#include <ATen/ops/empty.h>
+#endif
+
+namespace at::native {
+namespace {
+
+/*
+ * Winograd F(2x2, 3x3) convolution (Lavin & Gray, "Fast Algorithms for
+ * Convolutional Neural Networks"):
+ *
+ *   Y = A^T [ (G g G^T) . (B^T d B) ] A
+ *
+ * where g is a 3x3 filter, d is a 4x4 input tile producing a 2x2 output
+ * tile, and . is an elementwise product. Summing the elementwise products
+ * over input channels turns each of the 16 transform components into an
+ * independent [out_channels, in_channels] x [in_channels, tiles] GEMM, so
+ * the 2.25x multiplication savings over im2col comes at full GEMM
+ * efficiency. The 4x4 transforms below have the matrix products written
+ * out as additions.
+ */
+
+// u = G g G^T for every filter, scattered so that component i forms the
+// row-major [out_channels, in_channels] matrix at out + i * filters.
+void transform_weights(
+    float* out,
+    const float* weight,  // [out_channels, in_channels, 3, 3]
+    int64_t out_channels,
+    int64_t in_channels) {
+  const int64_t filters = out_channels * in_channels;
+  at::parallel_for(0, filters, 64, [&](int64_t begin, int64_t end) {
+    for (const auto f : c10::irange(begin, end)) {
+      const float* g = weight + f * 9;
+      float t[4][3];
+      for (const auto j : c10::irange(3)) {
+        t[0][j] = g[j];
+        t[1][j] = 0.5f * (g[j] + g[3 + j] + g[6 + j]);
+        t[2][j] = 0.5f * (g[j] - g[3 + j] + g[6 + j]);
+        t[3][j] = g[6 + j];
+      }
+      for (const auto i : c10::irange(4)) {
+        const float* r = t[i];
+        out[(i * 4 + 0) * filters + f] = r[0];
+        out[(i * 4 + 1) * filters + f] = 0.5f * (r[0] + r[1] + r[2]);
+        out[(i * 4 + 2) * filters + f] = 0.5f * (r[0] - r[1] + r[2]);
+        out[(i * 4 + 3) * filters + f] = r[2];
+      }
+    }
+  });
+}
+
+// v = B^T d B for every 4x4 tile of one image, scattered so that component
+// i forms the row-major [in_channels, tiles] matrix at out + i * in_channels
+// * tiles. Adjacent tiles overlap by two columns, so the loads are strided
+// and the transform stays scalar; it is a small fraction of the GEMM work.
+void transform_input(
+    float* out,
+    const float* input,  // [in_channels, 2 * tiles_h + 2, padded_w]
+    int64_t in_channels,
+    int64_t tiles_h,
+    int64_t tiles_w,
+    int64_t padded_w) {
+  const int64_t tiles = tiles_h * tiles_w;
+  at::parallel_for(0, in_channels * tiles_h, 4, [&](int64_t begin, int64_t end) {
+    for (const auto idx : c10::irange(begin, end)) {
+      const int64_t c = idx / tiles_h;
+      const int64_t th = idx % tiles_h;
+      const float* row0 =
+          input + (c * (2 * tiles_h + 2) + 2 * th) * padded_w;
+      for (const auto tw : c10::irange(tiles_w)) {
+        const float* d0 = row0 + 2 * tw;
+        const float* d1 = d0 + padded_w;
+        const float* d2 = d1 + padded_w;
+        const float* d3 = d2 + padded_w;
+        float t[4][4];
+        for (const auto j : c10::irange(4)) {
+          t[0][j] = d0[j] - d2[j];
+          t[1][j] = d1[j] + d2[j];
+          t[2][j] = d2[j] - d1[j];
+          t[3][j] = d1[j] - d3[j];
+        }
+        const int64_t p = c * tiles + th * tiles_w + tw;
+        for (const auto i : c10::irange(4)) {
+          const float* r = t[i];
+          out[(i * 4 + 0) * in_channels * tiles + p] = r[0] - r[2];
+          out[(i * 4 + 1) * in_channels * tiles + p] = r[1] + r[2];
+          out[(i * 4 + 2) * in_channels * tiles + p] = r[2] - r[1];
+          out[(i * 4 + 3) * in_channels * tiles + p] = r[1] - r[3];
+        }
+      }
+    }
+  });
+}
+
+// y = A^T m A + bias for every tile of one image. Odd output sizes are
+// handled by dropping the out-of-range half of the last tile row/column.
+void transform_output(
+    float* out,       // [out_channels, out_h, out_w]
+    const float* m,   // [16, out_channels, tiles]
+    const float* bias,  // [out_channels] or nullptr
+    int64_t out_channels,
+    int64_t out_h,
+    int64_t out_w,
+    int64_t tiles_h,
+    int64_t tiles_w) {
+  const int64_t tiles = tiles_h * tiles_w;
+  at::parallel_for(0, out_channels * tiles_h, 4, [&](int64_t begin, int64_t end) {
+    for (const auto idx : c10::irange(begin, end)) {
+      const int64_t k = idx / tiles_h;
+      const int64_t th = idx % tiles_h;
+      const float b = bias != nullptr ? bias[k] : 0.0f;
+      for (const auto tw : c10::irange(tiles_w)) {
+        const int64_t p = k * tiles + th * tiles_w + tw;
+        float w[16];
+        for (const auto i : c10::irange(16)) {
+          w[i] = m[i * out_channels * tiles + p];
+        }
+        float t[2][4];
+        for (const auto j : c10::irange(4)) {
+          t[0][j] = w[j] + w[4 + j] + w[8 + j];
+          t[1][j] = w[4 + j] - w[8 + j] - w[12 + j];
+        }
+        const int64_t h = 2 * th;
+        const int64_t col = 2 * tw;
+        for (const auto i : c10::irange(2)) {
+          if (h + i >= out_h) {
+            break;
+          }
+          const float* r = t[i];
+          float* row = out + (k * out_h + h + i) * out_w + col;
+          row[0] = r[0] + r[1] + r[2] + b;
+          if (col + 1 < out_w) {
+            row[1] = r[1] - r[2] - r[3] + b;
+          }
+        }
+      }
+    }
+  });
+}
+
+Tensor _convolution_winograd3x3(
+    const Tensor& input,
+    const Tensor& weight,
+    const Tensor& bias,
+    const IntArrayRef padding) {
+  const int64_t batch = input.size(0);
+  const int64_t in_channels = input.size(1);
+  const int64_t in_h = input.size(2);
+  const int64_t in_w = input.size(3);
+  const int64_t out_channels = weight.size(0);
+  const int64_t out_h = in_h + 2 * padding[0] - 2;
+  const int64_t out_w = in_w + 2 * padding[1] - 2;
+  const int64_t tiles_h = (out_h + 1) / 2;
+  const int64_t tiles_w = (out_w + 1) / 2;
+  const int64_t tiles = tiles_h * tiles_w;
+  const int64_t padded_h = 2 * tiles_h + 2;
+  const int64_t padded_w = 2 * tiles_w + 2;
+
+  // Pad up front so every 4x4 tile reads in bounds. The extra bottom/right
+  // rows beyond the convolution padding feed only the out-of-range half of
+  // the last tile, which the output transform discards.
+  const Tensor padded = at::constant_pad_nd(
+      input,
+      {padding[1],
+       padded_w - in_w - padding[1],
+       padding[0],
+       padded_h - in_h - padding[0]});
+
+  auto output = at::empty({batch, out_channels, out_h, out_w}, input.options());
+
+  Tensor u = at::empty({16, out_channels, in_channels}, input.options());
+  Tensor v = at::empty({16, in_channels, tiles}, input.options());
+  Tensor m = at::empty({16, out_channels, tiles}, input.options());
+
+  transform_weights(
+      u.data_ptr<float>(), weight.data_ptr<float>(), out_channels, in_channels);
+
+  const float* bias_ptr = bias.defined() ? bias.data_ptr<float>() : nullptr;
+
+  for (const auto n : c10::irange(batch)) {
+    transform_input(
+        v.data_ptr<float>(),
+        padded.data_ptr<float>() + n * in_channels * padded_h * padded_w,
+        in_channels,
+        tiles_h,
+        tiles_w,
+        padded_w);
+    // M_i = U_i V_i for each of the 16 components. Note gemm expects
+    // fortran order, so all 3 matrices are transposed. Swapping argument
+    // order cancels this, since C == AB <=> T(C) == T(B)T(A)
+    for (const auto i : c10::irange(16)) {
+      at::native::cpublas::gemm(
+          TransposeType::NoTranspose,
+          TransposeType::NoTranspose,
+          tiles, out_channels, in_channels,
+          1.0f,
+          v.data_ptr<float>() + i * in_channels * tiles, tiles,
+          u.data_ptr<float>() + i * out_channels * in_channels, in_channels,
+          0.0f,
+          m.data_ptr<float>() + i * out_channels * tiles, tiles);
+    }
+    transform_output(
+        output.data_ptr<float>() + n * out_channels * out_h * out_w,
+        m.data_ptr<float>(),
+        bias_ptr,
+        out_channels,
+        out_h,
+        out_w,
+        tiles_h,
+        tiles_w);
+  }
+
+  return output;
+}
+
+}  // namespace
+
+REGISTER_DISPATCH(convolution_winograd3x3_stub, &_convolution_winograd3x3);
+
+}  // namespace at::native
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <ATen/native/DispatchStub.h>
+#include <c10/util/ArrayRef.h>
+
+/*
+  Winograd F(2x2, 3x3) convolution operator
+*/
+
+namespace at {
+class Tensor;
+
+namespace native {
+
+using convolution_winograd3x3_fn =
+    Tensor (*)(const Tensor &, const Tensor &, const Tensor &, IntArrayRef);
+
+DECLARE_DISPATCH(convolution_winograd3x3_fn, convolution_winograd3x3_stub);
+
+}  // namespace native
+}  // namespace at
@@ -56,12 +56,30 @@ void LayerNormKernelImplInternal(
       rstd_val = T(1) / std::sqrt(rstd_val + eps);
       const T scale = rstd_val;
       const T bias = -rstd_val * mean_val;
-      if (gamma_null || beta_null) {
-        for (const auto j : c10::irange(N)) {
-          const T gamma_v = gamma_null ? T(1) : gamma_data[j];
-          const T beta_v = beta_null ? T(0) : beta_data[j];
-          Y_ptr[j] = (X_ptr[j] * scale + bias) * gamma_v + beta_v;
-        }
+      if (gamma_null && beta_null) {
+        vec::map<T>(
+            [scale, bias](Vec x) { return x * Vec(scale) + Vec(bias); },
+            Y_ptr,
+            X_ptr,
+            N);
+      } else if (gamma_null) {
+        vec::map2<T>(
+            [scale, bias](Vec x, Vec beta) {
+              return x * Vec(scale) + Vec(bias) + beta;
+            },
+            Y_ptr,
+            X_ptr,
+            beta_data,
+            N);
+      } else if (beta_null) {
+        vec::map2<T>(
+            [scale, bias](Vec x, Vec gamma) {
+              return (x * Vec(scale) + Vec(bias)) * gamma;
+            },
+            Y_ptr,
+            X_ptr,
+            gamma_data,
+            N);
       } else {
         vec::map3<T>(
             [scale, bias](Vec x, Vec gamma, Vec beta) {
@@ -117,7 +135,21 @@ void layer_norm_kernel_mixed_type(
       rstd_val = float(1) / std::sqrt(rstd_val + eps);
       const float scale = rstd_val;
       const float bias = -rstd_val * mean_val;
-      if (gamma_null || beta_null) {
+      if (gamma_null && beta_null) {
+        int64_t d = 0;
+        for (; d < N - (N % bVec::size()); d += bVec::size()) {
+          bVec x_bvec = bVec::loadu(X_ptr + d);
+          fVec x_fvec0, x_fvec1;
+          std::tie(x_fvec0, x_fvec1) = convert_bfloat16_float(x_bvec);
+          fVec y_fvec0 = x_fvec0 * fVec(scale) + fVec(bias);
+          fVec y_fvec1 = x_fvec1 * fVec(scale) + fVec(bias);
+          bVec y_bvec = convert_float_bfloat16(y_fvec0, y_fvec1);
+          y_bvec.store(Y_ptr + d);
+        }
+        for (; d < N; d++) {
+          Y_ptr[d] = X_ptr[d] * scale + bias;
+        }
+      } else if (gamma_null || beta_null) {
         for (const auto j : c10::irange(N)) {
           const param_t gamma_v = gamma_null ? param_t(1) : gamma_data[j];
           const param_t beta_v = beta_null ? param_t(0) : beta_data[j];
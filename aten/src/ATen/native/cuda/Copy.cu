@@ -3,6 +3,7 @@
 #include <ATen/Context.h>
 #include <ATen/Dispatch.h>
 #include <ATen/cuda/CachingHostAllocator.h>
+#include <ATen/cuda/CopyBatch.h>
 #include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAEvent.h>
 #include <ATen/cuda/PeerToPeerAccess.h>
@@ -181,6 +182,22 @@ static void copy_kernel_cuda(TensorIterator& iter, bool non_blocking) {
   Device dst_device = iter.device(0);
   Device src_device = iter.device(1);
 
+  // Inside a CopyBatchGuard scope, eligible cross-GPU copies are staged
+  // and issued in per-direction batches when the scope closes; see
+  // ATen/cuda/CopyBatch.h for the contract.
+  if (at::cuda::detail::copy_batch_active() && non_blocking &&
+      dst_device.is_cuda() && src_device.is_cuda() &&
+      dst_device != src_device && iter.numel() > 0 &&
+      iter.dtype(0) == iter.dtype(1) && iter.is_contiguous() &&
+      iter.tensor(0).is_conj() == iter.tensor(1).is_conj() &&
+      iter.tensor(0).is_neg() == iter.tensor(1).is_neg()) {
+    at::cuda::detail::copy_batch_enqueue(
+        iter.tensor(0), iter.tensor(1),
+        iter.data_ptr(0), iter.data_ptr(1),
+        iter.numel() * iter.element_size(0));
+    return;
+  }
+
   // Enable p2p access between devices. (No-op if it involves the CPU)
   bool p2p_enabled = maybe_enable_p2p_access(dst_device, src_device);
 
@@ -1,5 +1,7 @@
 #pragma once
 #include <ATen/core/Tensor.h>
+// for ADAM_MODE, shared with the CPU kernels
+#include <ATen/native/FusedAdam.h>
 #include <ATen/native/cuda/MultiTensorApply.cuh>
 #include <ATen/native/cuda/ForeachFunctors.cuh>
 #include <ATen/native/cuda/Pow.cuh>
@@ -7,11 +9,6 @@
 
 namespace at { namespace native {
 
-enum class ADAM_MODE: uint8_t {
-  ORIGINAL = 0,
-  ADAMW = 1
-};
-
 namespace {
 
 constexpr uint8_t kParamIdx = 0;
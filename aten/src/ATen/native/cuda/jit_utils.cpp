@@ -32,6 +32,8 @@
   #define W_OK    2
   #define F_OK    0
 #else
+  #include <fcntl.h> // open
+  #include <sys/file.h> // flock
   #include <sys/types.h>
   #include <sys/stat.h> // mkdir
   #include <unistd.h>
@@ -1466,6 +1468,29 @@ c10::optional<std::string> get_cache_dir() {
   return cache_dir;
 }
 
+// Attempts to load a previously compiled kernel from file_path into
+// compiled_kernel_, returning true on success.
+// NOTE: this does not warn on a read failure because the file might simply
+//   not exist yet
+bool read_cached_kernel(
+    const std::string& file_path,
+    const std::string& name,
+    NvrtcFunction& compiled_kernel_) {
+  std::ifstream readin{file_path, std::ios::in | std::ifstream::binary};
+  if (readin.fail()) {
+    readin.close();
+    return false;
+  }
+  // TODO: try passing the "mapped" file directly to cuModuleLoadCall instead of using an intermediate buffer
+  const auto& nvrtc = at::globalContext().getNVRTC();
+  std::vector<char> buffer(std::istreambuf_iterator<char>(readin), {});
+  AT_CUDA_DRIVER_CHECK(nvrtc.cuModuleLoadData(&(compiled_kernel_.module), buffer.data()));
+  AT_CUDA_DRIVER_CHECK(
+    nvrtc.cuModuleGetFunction(&(compiled_kernel_.function), compiled_kernel_.module, name.c_str()));
+  readin.close();
+  return true;
+}
+
 // Compiles the kernel, or acquires if from the cache if caching
 NvrtcFunction jit_pwise_function(
     const std::string& code,
@@ -1486,6 +1511,20 @@ NvrtcFunction jit_pwise_function(
   static const c10::optional<std::string> cache_dir = get_cache_dir();
 
   std::string file_path;
+#ifndef _WIN32
+  // Holds the advisory inter-process lock (if taken) until this function
+  // returns or throws, so a failed compilation cannot leave other
+  // processes blocked.
+  struct FileLock {
+    int fd = -1;
+    ~FileLock() {
+      if (fd >= 0) {
+        flock(fd, LOCK_UN);
+        close(fd);
+      }
+    }
+  } cache_lock;
+#endif
   if (cache_dir.has_value()) {
     // Attemps to read from the cache.
     // Cubin name is <kernel name>_arch<major>.<minor>_nvrtc<major>.<minor>_<ptx or sass>_<program length>_<string hash>
@@ -1507,21 +1546,28 @@ NvrtcFunction jit_pwise_function(
     ss << "_" << hash_code;
     file_path = ss.str();
 
-    std::ifstream readin{file_path, std::ios::in | std::ifstream::binary};
-    if (readin.fail()) {
-      // NOTE: this does not warn because the file might not exist
-      // TODO: consider if this should explicilty check for the file's existence or not to throw
-      //   an informative warning
-      readin.close();
-    } else {
-      // TODO: try passing the "mapped" file directly to cuModuleLoadCall instead of using an intermediate buffer
-      std::vector<char> buffer(std::istreambuf_iterator<char>(readin), {});
-      AT_CUDA_DRIVER_CHECK(nvrtc.cuModuleLoadData(&(compiled_kernel_.module), buffer.data()));
-      AT_CUDA_DRIVER_CHECK(
-        nvrtc.cuModuleGetFunction(&(compiled_kernel_.function), compiled_kernel_.module, name.c_str()));
-      readin.close();
+    if (read_cached_kernel(file_path, name, compiled_kernel_)) {
       return compiled_kernel_;
     }
+
+#ifndef _WIN32
+    // Cache miss. Many processes sharing the cache (e.g. the workers of a
+    // data-parallel fleet starting together) will all miss here for the same
+    // kernel, so compilation is serialized across processes with an advisory
+    // lock on a sidecar file: only the first holder invokes nvrtc, while the
+    // others block in flock and then find the cubin on the re-check below.
+    // Lock acquisition failures just fall through to compiling, as before.
+    const std::string lock_file_path = file_path + ".lock";
+    cache_lock.fd = open(lock_file_path.c_str(), O_CREAT | O_RDWR, 0666);
+    if (cache_lock.fd >= 0) {
+      if (flock(cache_lock.fd, LOCK_EX) != 0) {
+        close(cache_lock.fd);
+        cache_lock.fd = -1;
+      } else if (read_cached_kernel(file_path, name, compiled_kernel_)) {
+        return compiled_kernel_;
+      }
+    }
+#endif
   }
 
   // Just-in-time compiles the program
@@ -17,9 +17,11 @@
 #include <limits>
 #include <vector>
 #include <ATen/Config.h>
+#include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAGraphsUtils.cuh>
 #include <ATen/cuda/Exceptions.h>
 #include <ATen/native/cudnn/ConvShared.h>
+#include <c10/util/CallOnce.h>
 
 #include <ATen/cudnn/Types.h>
 #include <ATen/cudnn/Utils.h>
@@ -28,6 +30,13 @@
 #include <ATen/TensorUtils.h>
 #include <c10/util/irange.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
 #include <functional>
 #include <iterator>
 #include <sstream>
@@ -104,6 +113,15 @@ std::ostream& operator<<(std::ostream & out, const ConvolutionArgs& args) {
 //
 // ---------------------------------------------------------------------
 
+// Lazily loads the persistent benchmark cache, if one is configured.
+// See Note [Persistent cudnn benchmark cache]
+void maybe_load_persistent_benchmark_cache();
+// Re-reads the persistent cache file if another process has updated it;
+// returns true if new entries may have been merged in.
+bool refresh_persistent_benchmark_cache();
+// Merges our entries into the persistent cache file for other processes.
+void publish_persistent_benchmark_cache();
+
 // TODO: Use something less heavy duty than a big honking mutex
 template <typename T>
 struct BenchmarkCache {
@@ -111,6 +129,21 @@ struct BenchmarkCache {
   std::unordered_map<ConvolutionParams, T, ParamsHash<ConvolutionParams>, ParamsEqual<ConvolutionParams>> map;
 
   bool find(const ConvolutionParams& params, T* results) {
+    maybe_load_persistent_benchmark_cache();
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      auto it = map.find(params);
+      if (it != map.end()) {
+        *results = it->second;
+        return true;
+      }
+    }
+    // Miss: another process on this host may have benchmarked this shape
+    // since we last read the shared file, so check before paying for a
+    // cudnnFind search ourselves.
+    if (!refresh_persistent_benchmark_cache()) {
+      return false;
+    }
     std::lock_guard<std::mutex> guard(mutex);
     auto it = map.find(params);
     if (it == map.end()) {
@@ -120,9 +153,14 @@ struct BenchmarkCache {
     return true;
   }
 
-  void insert(const ConvolutionParams& params, const T& results) {
-    std::lock_guard<std::mutex> guard(mutex);
-    map[params] = results;
+  void insert(const ConvolutionParams& params, const T& results, bool publish = false) {
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      map[params] = results;
+    }
+    if (publish) {
+      publish_persistent_benchmark_cache();
+    }
   }
 };
 
@@ -130,6 +168,256 @@ BenchmarkCache<cudnnConvolutionFwdAlgoPerf_t> fwd_algos;
 BenchmarkCache<cudnnConvolutionBwdDataAlgoPerf_t> bwd_data_algos;
 BenchmarkCache<cudnnConvolutionBwdFilterAlgoPerf_t> bwd_filter_algos;
 
+// Note [Persistent cudnn benchmark cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With torch.backends.cudnn.benchmark the first convolution of every
+// (shape, dtype, layout) combination runs an exhaustive cudnnFind search.
+// Hosts that cycle through many models pay that warm-up on every process
+// start. Setting TORCH_CUDNN_CONV_BENCHMARK_CACHE_PATH to a writable
+// directory makes the three algorithm caches above persistent: they are
+// loaded from a per-GPU-architecture file on first use and written back at
+// process exit (to a temp file that is then renamed, so concurrent
+// processes at worst lose entries, never corrupt the file).
+//
+// Both ConvolutionParams and the cudnn perf structs are PODs, so entries
+// are stored raw. The file header records the cudnn and driver versions
+// plus the struct sizes, and the whole file is discarded on any mismatch.
+// Cached entries embed device indices, which are only meaningful when every
+// process sees the same GPU topology - true for the homogeneous fleets this
+// is intended for; at worst a mismatched index is a cache miss.
+//
+// The file also doubles as a live, host-wide cache for processes running
+// concurrently. Each completed cudnnFind search is published back to the
+// file right away (merged with whatever other processes wrote in the
+// meantime), and a cache miss re-reads the file when its mtime has moved,
+// throttled to at most one stat() per second so the miss path stays cheap.
+// With N identical inference processes per host, only the first one to see
+// a shape pays for the exhaustive search. Reads vastly outnumber the
+// rewrites (one per new shape benchmarked), and merging is last-writer-wins
+// per entry, which is fine: all processes benchmark on the same hardware.
+
+constexpr uint32_t kBenchmarkCacheMagic = 0x7fcac4e1;
+constexpr uint32_t kBenchmarkCacheFormatVersion = 1;
+
+struct BenchmarkCacheFileHeader {
+  uint32_t magic;
+  uint32_t format_version;
+  uint64_t cudnn_version;
+  int32_t driver_version;
+  uint32_t params_size;
+  uint32_t fwd_perf_size;
+  uint32_t bwd_data_perf_size;
+  uint32_t bwd_filter_perf_size;
+};
+
+// Both are set once under the call_once in
+// maybe_load_persistent_benchmark_cache and read again at process exit,
+// when querying the CUDA runtime may no longer be safe.
+std::string persistent_cache_path;
+BenchmarkCacheFileHeader persistent_cache_header;
+
+// mtime of the file contents we last read or wrote, plus the last time the
+// miss path checked for updates; both serve the cross-process refresh.
+std::atomic<int64_t> persistent_cache_mtime{0};
+std::atomic<int64_t> last_refresh_check_ms{0};
+constexpr int64_t kRefreshThrottleMs = 1000;
+
+int64_t benchmark_cache_file_mtime(const std::string& path) {
+  struct stat st {};
+  if (stat(path.c_str(), &st) != 0) {
+    return 0;
+  }
+  return static_cast<int64_t>(st.st_mtime);
+}
+
+std::string benchmark_cache_file_path() {
+  const char* dir = std::getenv("TORCH_CUDNN_CONV_BENCHMARK_CACHE_PATH");
+  if (dir == nullptr || *dir == '\0') {
+    return std::string();
+  }
+  cudaDeviceProp* prop = at::cuda::getCurrentDeviceProperties();
+  std::ostringstream ss;
+  ss << dir << "/cudnn_conv_benchmark_sm" << prop->major << prop->minor
+     << ".bin";
+  return ss.str();
+}
+
+BenchmarkCacheFileHeader make_benchmark_cache_header() {
+  BenchmarkCacheFileHeader header{};
+  header.magic = kBenchmarkCacheMagic;
+  header.format_version = kBenchmarkCacheFormatVersion;
+  header.cudnn_version = cudnnGetVersion();
+  if (cudaDriverGetVersion(&header.driver_version) != cudaSuccess) {
+    cudaGetLastError(); // clear CUDA error
+    header.driver_version = 0;
+  }
+  header.params_size = sizeof(ConvolutionParams);
+  header.fwd_perf_size = sizeof(cudnnConvolutionFwdAlgoPerf_t);
+  header.bwd_data_perf_size = sizeof(cudnnConvolutionBwdDataAlgoPerf_t);
+  header.bwd_filter_perf_size = sizeof(cudnnConvolutionBwdFilterAlgoPerf_t);
+  return header;
+}
+
+template <typename perf_t>
+void serialize_benchmark_cache(std::ostream& out, BenchmarkCache<perf_t>& cache) {
+  std::lock_guard<std::mutex> guard(cache.mutex);
+  const uint64_t count = cache.map.size();
+  out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+  for (const auto& entry : cache.map) {
+    out.write(reinterpret_cast<const char*>(&entry.first), sizeof(ConvolutionParams));
+    out.write(reinterpret_cast<const char*>(&entry.second), sizeof(perf_t));
+  }
+}
+
+template <typename perf_t>
+bool deserialize_benchmark_cache(std::istream& in, BenchmarkCache<perf_t>& cache) {
+  uint64_t count = 0;
+  if (!in.read(reinterpret_cast<char*>(&count), sizeof(count))) {
+    return false;
+  }
+  std::lock_guard<std::mutex> guard(cache.mutex);
+  for (C10_UNUSED const auto i : c10::irange(count)) {
+    ConvolutionParams params;
+    perf_t perf;
+    if (!in.read(reinterpret_cast<char*>(&params), sizeof(params)) ||
+        !in.read(reinterpret_cast<char*>(&perf), sizeof(perf))) {
+      return false;
+    }
+    cache.map.emplace(params, perf);
+  }
+  return true;
+}
+
+void save_persistent_benchmark_cache() {
+  if (persistent_cache_path.empty()) {
+    return;
+  }
+  // Unique-ish temp name so concurrent writers do not clobber each other
+  // mid-write; the rename below is atomic on POSIX.
+  const std::string tmp_path = persistent_cache_path + ".tmp" +
+      std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+  {
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+      return;
+    }
+    out.write(
+        reinterpret_cast<const char*>(&persistent_cache_header),
+        sizeof(persistent_cache_header));
+    serialize_benchmark_cache(out, fwd_algos);
+    serialize_benchmark_cache(out, bwd_data_algos);
+    serialize_benchmark_cache(out, bwd_filter_algos);
+    if (!out) {
+      out.close();
+      std::remove(tmp_path.c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), persistent_cache_path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+  }
+}
+
+void load_persistent_benchmark_cache() {
+  auto path = benchmark_cache_file_path();
+  if (path.empty()) {
+    return;
+  }
+  persistent_cache_path = std::move(path);
+  persistent_cache_header = make_benchmark_cache_header();
+  std::atexit(save_persistent_benchmark_cache);
+  std::ifstream in(persistent_cache_path, std::ios::binary);
+  if (!in) {
+    // First run on this host; the file is created at exit.
+    return;
+  }
+  BenchmarkCacheFileHeader header;
+  if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      std::memcmp(&header, &persistent_cache_header, sizeof(header)) != 0) {
+    // Stale (different cudnn/driver/struct layout) or corrupt; start over.
+    return;
+  }
+  persistent_cache_mtime.store(
+      benchmark_cache_file_mtime(persistent_cache_path),
+      std::memory_order_relaxed);
+  if (!(deserialize_benchmark_cache(in, fwd_algos) &&
+        deserialize_benchmark_cache(in, bwd_data_algos) &&
+        deserialize_benchmark_cache(in, bwd_filter_algos))) {
+    // Truncated file; drop everything rather than run with a partial view.
+    std::lock_guard<std::mutex> g1(fwd_algos.mutex);
+    std::lock_guard<std::mutex> g2(bwd_data_algos.mutex);
+    std::lock_guard<std::mutex> g3(bwd_filter_algos.mutex);
+    fwd_algos.map.clear();
+    bwd_data_algos.map.clear();
+    bwd_filter_algos.map.clear();
+  }
+}
+
+void maybe_load_persistent_benchmark_cache() {
+  static c10::once_flag once;
+  c10::call_once(once, load_persistent_benchmark_cache);
+}
+
+bool refresh_persistent_benchmark_cache() {
+  if (persistent_cache_path.empty()) {
+    return false;
+  }
+  const int64_t now_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+  int64_t last = last_refresh_check_ms.load(std::memory_order_relaxed);
+  if (now_ms - last < kRefreshThrottleMs ||
+      !last_refresh_check_ms.compare_exchange_strong(last, now_ms)) {
+    return false;
+  }
+  const int64_t mtime = benchmark_cache_file_mtime(persistent_cache_path);
+  if (mtime == 0 ||
+      mtime == persistent_cache_mtime.exchange(mtime, std::memory_order_relaxed)) {
+    return false;
+  }
+  // The rename-based writes mean the stream below always sees a complete,
+  // consistent file, even if another process replaces it while we read.
+  std::ifstream in(persistent_cache_path, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  BenchmarkCacheFileHeader header;
+  if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      std::memcmp(&header, &persistent_cache_header, sizeof(header)) != 0) {
+    return false;
+  }
+  // deserialize emplaces, so entries we already hold win over file entries.
+  return deserialize_benchmark_cache(in, fwd_algos) &&
+      deserialize_benchmark_cache(in, bwd_data_algos) &&
+      deserialize_benchmark_cache(in, bwd_filter_algos);
+}
+
+void publish_persistent_benchmark_cache() {
+  maybe_load_persistent_benchmark_cache();
+  if (persistent_cache_path.empty()) {
+    return;
+  }
+  static std::mutex publish_mutex;
+  std::lock_guard<std::mutex> guard(publish_mutex);
+  // Fold in entries other processes published since our last read, so that
+  // rewriting the file does not drop them.
+  {
+    std::ifstream in(persistent_cache_path, std::ios::binary);
+    BenchmarkCacheFileHeader header;
+    if (in && in.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+        std::memcmp(&header, &persistent_cache_header, sizeof(header)) == 0 &&
+        deserialize_benchmark_cache(in, fwd_algos) &&
+        deserialize_benchmark_cache(in, bwd_data_algos)) {
+      deserialize_benchmark_cache(in, bwd_filter_algos);
+    }
+  }
+  save_persistent_benchmark_cache();
+  persistent_cache_mtime.store(
+      benchmark_cache_file_mtime(persistent_cache_path),
+      std::memory_order_relaxed);
+}
+
 // TODO: Stop manually allocating CUDA memory; allocate an ATen byte
 // tensor instead.
 struct Workspace {
@@ -521,7 +809,9 @@ public:
     for (auto &algoPerf : perfResults) {
       try {
         f(algoPerf);
-        cache.insert(args.params, algoPerf);
+        // Benchmark results are worth sharing with other processes on the
+        // host; heuristic picks are cheap enough to redo locally.
+        cache.insert(args.params, algoPerf, /*publish=*/benchmark);
         return;
       } catch (c10::OutOfMemoryError &e) {
         cudaGetLastError(); // clear CUDA error
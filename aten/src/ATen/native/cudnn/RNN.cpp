@@ -4,6 +4,7 @@
 #include <ATen/cuda/CUDAConfig.h>
 #include <ATen/cuda/CUDAEvent.h>
 #include <ATen/cuda/CUDAGraphsUtils.cuh>
+#include <c10/cuda/CUDACachingAllocator.h>
 #include <ATen/cuda/Exceptions.h>
 #include <ATen/MatrixRef.h>
 #include <ATen/native/RNN.h>
@@ -84,6 +85,27 @@ Tensor _cudnn_init_dropout_state(double dropout, bool train, int64_t dropout_see
 namespace at { namespace native {
 
 namespace {
+  // Scratch for a single cudnn call on the current stream. Borrows the
+  // per-stream reserved workspace so repeated RNN calls don't cycle large
+  // transient allocations through the caching allocator; falls back to a
+  // regular allocation during graph capture, when the reserved pool can't
+  // grow.
+  struct RNNWorkspace {
+    void* ptr;
+    size_t size;
+    Tensor buffer; // only set when capture forces the fallback
+  };
+
+  RNNWorkspace get_rnn_workspace(size_t size, const TensorOptions& options) {
+    if (at::cuda::currentStreamCaptureStatus() == at::cuda::CaptureStatus::None) {
+      void* ptr = c10::cuda::CUDACachingAllocator::getReservedWorkspace(
+          size, at::cuda::getCurrentCUDAStream());
+      return {ptr, size, Tensor()};
+    }
+    Tensor buffer = at::empty(size, options.dtype(kByte));
+    return {buffer.data_ptr(), size, std::move(buffer)};
+  }
+
   // DropoutDescriptor
 
   struct DropoutDescriptorParams {
@@ -1057,7 +1079,7 @@ std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> _cudnn_rnn(
         x_descs_arr.data(),
         &workspace_size
         ));
-  Tensor workspace = at::empty(workspace_size, input.options().dtype(kByte));
+  auto workspace = get_rnn_workspace(workspace_size, input.options());
   Tensor reserve;
   // NB: Previously, the test was for fn.requires_grad, but we don't have
   // this information.  Use 'train' as a proxy.
@@ -1082,7 +1104,7 @@ std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> _cudnn_rnn(
           y_descs_arr.data(), y.data_ptr(),
           descs.hy_desc.desc(), hy.data_ptr(),
           descs.cy_desc.desc(), cy.defined() ? cy.data_ptr() : nullptr,
-          workspace.data_ptr(), workspace.size(0),
+          workspace.ptr, workspace.size,
           reserve.data_ptr(), reserve.size(0)
           ));
   } else { // inference
@@ -1098,7 +1120,7 @@ std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> _cudnn_rnn(
           y_descs_arr.data(), y.data_ptr(),
           descs.hy_desc.desc(), hy.data_ptr(),
           descs.cy_desc.desc(), cy.defined() ? cy.data_ptr() : nullptr,
-          workspace.data_ptr(), workspace.size(0)
+          workspace.ptr, workspace.size
           ));
 
   }
@@ -1205,7 +1227,7 @@ std::tuple<Tensor, Tensor, Tensor> _cudnn_rnn_backward_input(
         &workspace_size
         ));
   // TODO: put this in the correct device???
-  Tensor workspace = at::empty(workspace_size, input.options().dtype(kByte));
+  auto workspace = get_rnn_workspace(workspace_size, input.options());
   AT_CUDNN_CHECK(cudnnRNNBackwardData(
         handle,
         descs.rnn_desc.desc(),
@@ -1220,7 +1242,7 @@ std::tuple<Tensor, Tensor, Tensor> _cudnn_rnn_backward_input(
         x_descs_arr.data(), dx.data_ptr(),
         descs.hx_desc.desc(), dhx.data_ptr(),
         descs.cx_desc.desc(), cx.defined() ? dcx.data_ptr() : nullptr,
-        workspace.data_ptr(), workspace.size(0),
+        workspace.ptr, workspace.size,
         fn_reserve.data_ptr(), fn_reserve.size(0)
         ));
 
@@ -1307,7 +1329,7 @@ std::vector<Tensor> _cudnn_rnn_backward_weight(
         x_descs_arr.data(),
         &workspace_size
         ));
-  Tensor workspace = at::empty(workspace_size, input.options().dtype(kByte));
+  auto workspace = get_rnn_workspace(workspace_size, input.options());
   AT_CUDNN_CHECK(cudnnRNNBackwardWeights(
         handle,
         descs.rnn_desc.desc(),
@@ -1315,7 +1337,7 @@ std::vector<Tensor> _cudnn_rnn_backward_weight(
         x_descs_arr.data(), x.data_ptr(),
         descs.hx_desc.desc(), hx.data_ptr(),
         y_descs_arr.data(), y.data_ptr(),
-        workspace.data_ptr(), workspace.size(0),
+        workspace.ptr, workspace.size,
         w_desc.desc(), dw.data_ptr(),
         fn_reserve.data_ptr(), fn_reserve.size(0)
         ));
@@ -10,14 +10,20 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_dropout_add_layer_norm_backward_native.h>
+#include <ATen/ops/_dropout_add_layer_norm_native.h>
+#include <ATen/ops/addcmul.h>
 #include <ATen/ops/empty.h>
 #include <ATen/ops/empty_like.h>
 #include <ATen/ops/empty_like_native.h>
 #include <ATen/ops/layer_norm_native.h>
 #include <ATen/ops/native_batch_norm.h>
+#include <ATen/ops/native_dropout_backward.h>
 #include <ATen/ops/native_layer_norm.h>
+#include <ATen/ops/native_layer_norm_backward.h>
 #include <ATen/ops/native_layer_norm_backward_native.h>
 #include <ATen/ops/native_layer_norm_native.h>
+#include <ATen/ops/ones_like.h>
 #include <ATen/ops/zeros_like_native.h>
 #endif
 
@@ -181,6 +187,125 @@ std::tuple<Tensor, Tensor, Tensor> layer_norm_backward_cpu(
   return std::make_tuple(std::move(dX), std::move(dgamma), std::move(dbeta));
 }
 
+// Fused dropout + residual add + layer norm for transformer blocks. The
+// dropout output is never materialized: the mask-scale-multiply and the
+// residual add run as a single pass (one read of input/residual, one write
+// of add_out), and add_out feeds the vectorized layer norm kernel directly.
+// add_out has to be returned anyway since the backward needs the layer norm
+// input, so relative to the unfused sequence this saves the dropout
+// intermediate plus a full activation read/write per block.
+std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> dropout_add_layer_norm_cpu(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    bool train,
+    double eps) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned = at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned = at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  TORCH_CHECK(
+      p >= 0 && p < 1,
+      "_dropout_add_layer_norm: dropout probability has to be in [0, 1), but got ",
+      p);
+  TORCH_CHECK(
+      input.sizes().equals(residual.sizes()),
+      "_dropout_add_layer_norm: expected input and residual to have the same shape, but got ",
+      input.sizes(), " and ", residual.sizes());
+
+  bool mixed_type = is_mixed_type(input, weight, bias);
+  if (mixed_type) {
+    check_mixed_data_type(input, weight, bias);
+  }
+
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+
+  Tensor mask;
+  Tensor add_out;
+  if (train && p > 0) {
+    mask = at::empty_like(input, input.options().dtype(kBool));
+    mask.bernoulli_(1 - p);
+    add_out = at::addcmul(residual, input, mask, 1.0 / (1.0 - p));
+  } else {
+    mask = at::ones_like(input, input.options().dtype(kBool));
+    add_out = input.add(residual);
+  }
+
+  auto X = add_out.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+  auto beta = bias.expect_contiguous();
+
+  Tensor Y = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      at::MemoryFormat::Contiguous);
+  const auto dtype = param_scalar_type(input, mixed_type);
+  Tensor mean = at::empty({M}, X->options().dtype(dtype));
+  Tensor rstd = at::empty({M}, X->options().dtype(dtype));
+
+  layer_norm_with_mean_rstd_out(Y, mean, rstd, *X, normalized_shape, *gamma, *beta, eps, M, N);
+  return std::make_tuple(
+      std::move(Y),
+      std::move(mask),
+      std::move(add_out),
+      std::move(mean),
+      std::move(rstd));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor> dropout_add_layer_norm_backward(
+    const Tensor& grad_out,
+    const Tensor& add_out,
+    const Tensor& mask,
+    const Tensor& mean,
+    const Tensor& rstd,
+    IntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    bool train,
+    std::array<bool, 4> output_mask) {
+  // The gradient of add_out is shared by the residual branch and (through
+  // the dropout mask) the input branch, so run the layer norm backward once.
+  const bool needs_add_grad = output_mask[0] || output_mask[1];
+  auto ln_grads = at::native_layer_norm_backward(
+      grad_out,
+      add_out,
+      normalized_shape,
+      mean,
+      rstd,
+      weight_opt,
+      bias_opt,
+      {needs_add_grad, output_mask[2], output_mask[3]});
+  Tensor d_add = std::get<0>(ln_grads);
+  Tensor d_input;
+  Tensor d_residual;
+  if (output_mask[1]) {
+    d_residual = d_add;
+  }
+  if (output_mask[0]) {
+    if (train && p > 0) {
+      d_input = at::native_dropout_backward(d_add, mask, 1.0 / (1.0 - p));
+    } else {
+      d_input = d_add;
+    }
+  }
+  return std::make_tuple(
+      std::move(d_input),
+      std::move(d_residual),
+      std::move(std::get<1>(ln_grads)),
+      std::move(std::get<2>(ln_grads)));
+}
+
 Tensor layer_norm_symint(
     const Tensor& input,
     c10::SymIntArrayRef normalized_shape, const c10::optional<Tensor>& weight_opt /* optional */, const c10::optional<Tensor>& bias_opt /* optional */,
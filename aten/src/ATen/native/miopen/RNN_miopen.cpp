@@ -7,6 +7,9 @@
 #include <ATen/TensorUtils.h>
 
 #include <ATen/cuda/CUDAConfig.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAGraphsC10Utils.h>
+#include <c10/cuda/CUDAStream.h>
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 
@@ -516,9 +519,19 @@ std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> miopen_rnn(
     auto x_descs_arr = descs.get_x_descs();
     auto y_descs_arr = descs.get_y_descs();
 
-    //Allocate workspace size.
+    //Allocate workspace size. Outside of graph capture the per-stream
+    //reserved workspace is borrowed instead of allocating per call; the
+    //buffer is only used within this miopen call.
     MIOPEN_CHECK(miopenGetRNNWorkspaceSize(handle, descs.rnn_desc.desc(), fn.tensors.seq_length, x_descs_arr.data(), &workspace_size));
-    auto workspace = at::empty(workspace_size, input.options().dtype(kByte));
+    void* workspace_ptr = nullptr;
+    Tensor workspace;
+    if (c10::cuda::currentStreamCaptureStatusMayInitCtx() == c10::cuda::CaptureStatus::None) {
+        workspace_ptr = c10::cuda::CUDACachingAllocator::getReservedWorkspace(
+            workspace_size, c10::cuda::getCurrentCUDAStream());
+    } else {
+        workspace = at::empty(workspace_size, input.options().dtype(kByte));
+        workspace_ptr = workspace.data_ptr();
+    }
 
     //Train or inference.
     Tensor reserve;
@@ -534,7 +547,7 @@ std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> miopen_rnn(
                 y_descs_arr.data(), y.data_ptr(),
                 descs.hy_desc.desc(), hy.data_ptr(),
                 descs.cy_desc.desc(), cy.defined() ? cy.data_ptr() : nullptr,
-                workspace.data_ptr(), workspace_size, reserve.data_ptr(), reserver_size ));
+                workspace_ptr, workspace_size, reserve.data_ptr(), reserver_size ));
     } else { //Inference.
         reserve = at::empty({0}, input.options().dtype(kByte));
         MIOPEN_CHECK(miopenRNNForwardInference(handle, descs.rnn_desc.desc(), fn.tensors.seq_length,
@@ -545,7 +558,7 @@ std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> miopen_rnn(
                 y_descs_arr.data(), y.data_ptr(),
                 descs.hy_desc.desc(), hy.data_ptr(),
                 descs.cy_desc.desc(), cy.defined() ? cy.data_ptr() : nullptr,
-                workspace.data_ptr(), workspace_size));
+                workspace_ptr, workspace_size));
     }
 
     if (batch_first && !is_input_packed) {
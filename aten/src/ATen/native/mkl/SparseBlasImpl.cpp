@@ -206,12 +206,14 @@ void addmm_dense_result(
         auto beta_ = beta.to<scalar_t>();
         auto alpha_ = alpha.to<scalar_t>();
 
+        // reuse the optimized handle across calls with the same sparse matrix,
+        // see Note [MKL sparse descriptor reuse]
         auto mkl_sparse_mat =
-            at::mkl::sparse::MklSparseCsrDescriptor<scalar_t>(A);
+            at::mkl::sparse::get_cached_csr_descriptor<scalar_t>(A);
         at::mkl::sparse::mm<scalar_t>(
             SPARSE_OPERATION_NON_TRANSPOSE,
             alpha_,
-            mkl_sparse_mat.descriptor(),
+            mkl_sparse_mat->descriptor(),
             descrA,
             order,
             B_->data_ptr<scalar_t>(),
@@ -523,13 +525,15 @@ void addmv_out_sparse_csr(
         auto beta_ = beta.to<scalar_t>();
         auto alpha_ = alpha.to<scalar_t>();
 
+        // reuse the optimized handle across calls with the same sparse matrix,
+        // see Note [MKL sparse descriptor reuse]
         auto mkl_sparse_mat =
-            at::mkl::sparse::MklSparseCsrDescriptor<scalar_t>(mat);
+            at::mkl::sparse::get_cached_csr_descriptor<scalar_t>(mat);
 
         at::mkl::sparse::mv<scalar_t>(
             opA,
             alpha_,
-            mkl_sparse_mat.descriptor(),
+            mkl_sparse_mat->descriptor(),
             descrA,
             vec_->data_ptr<scalar_t>(),
             beta_,
@@ -5,6 +5,7 @@
 #include <ATen/native/mkldnn/ConvPrepack.h>
 #include <ATen/native/mkldnn/MKLDNNCommon.h>
 #include <ATen/native/mkldnn/OpContext.h>
+#include <ATen/native/mkldnn/Utils.h>
 #include <ATen/native/utils/Factory.h>
 #include <ATen/native/utils/ParamUtils.h>
 #include <c10/util/irange.h>
@@ -17,6 +18,56 @@ namespace mkldnn {
 namespace internal {
 namespace convolution {
 
+// Compile the epilogue chain into a single oneDNN attr at prepack time:
+// an optional binary post op consuming a second runtime input (see
+// conv_run_binary), followed by an optional eltwise op. The descriptor of
+// the binary operand can be fixed here because the prepacked context is
+// specialized on input_size, so the conv output shape is already known.
+static ideep::attr_t compileFusionAttr(
+    const Tensor& weight,
+    const std::vector<int64_t>& stride,
+    const std::vector<int64_t>& padding,
+    const std::vector<int64_t>& dilation,
+    const std::vector<int64_t>& input_size,
+    const std::string& attr,
+    torch::List<c10::optional<at::Scalar>> scalars,
+    const c10::optional<std::string>& algorithm,
+    const c10::optional<std::string>& binary_attr) {
+  c10::optional<c10::string_view> algorithm_value;
+  if (algorithm.has_value()) {
+    algorithm_value = algorithm.value();
+  }
+  if (binary_attr.has_value() && binary_attr.value() != "none") {
+    auto it_binary = fusion_binary_alg_map().find(binary_attr.value());
+    TORCH_CHECK(
+        it_binary != fusion_binary_alg_map().end(),
+        "Binary fusion behavior undefined.");
+    auto output_sizes = conv_output_size(
+        input_size, weight.sizes().vec(), padding, stride, dilation);
+    auto other_desc = ideep::tensor::desc(
+        output_sizes, get_mkldnn_dtype(weight.scalar_type()), ideep::tag::nhwc);
+
+    ideep::post_ops po;
+    po.append_binary(it_binary->second, other_desc);
+    if (attr != "none") {
+      auto it_unary = fusion_unary_alg_map().find(attr);
+      TORCH_CHECK(
+          it_unary != fusion_unary_alg_map().end(),
+          "Unary fusion behavior after a binary op undefined.");
+      po.append_eltwise(1.0, it_unary->second, 0.f, 0.f);
+    }
+    ideep::attr_t op_attr;
+    op_attr.set_post_ops(po);
+    return op_attr;
+  }
+  if (attr != "none") {
+    auto it = fusion_unary_attr_map().find(attr);
+    TORCH_CHECK(it != fusion_unary_attr_map().end(), "Fusion behavior undefined.");
+    return it->second(std::move(scalars), algorithm_value);
+  }
+  return ideep::attr_t();
+}
+
 c10::intrusive_ptr<mkldnn::ConvOpContext> createConvPrePackOpContext(
     Tensor weight,
     c10::optional<Tensor> bias,
@@ -25,10 +76,20 @@ c10::intrusive_ptr<mkldnn::ConvOpContext> createConvPrePackOpContext(
     std::vector<int64_t> dilation,
     int64_t groups,
     std::vector<int64_t> input_size,
-    std::string attr) {
-  auto it = fusion_attr_map.find(attr);
-  TORCH_CHECK(it != fusion_attr_map.end(), "Fusion behavior undefined.");
-  ideep::attr_t op_attr = it->second;
+    std::string attr,
+    c10::List<c10::optional<at::Scalar>> scalars,
+    c10::optional<std::string> algorithm,
+    c10::optional<std::string> binary_attr) {
+  ideep::attr_t op_attr = compileFusionAttr(
+      weight,
+      stride,
+      padding,
+      dilation,
+      input_size,
+      attr,
+      scalars,
+      algorithm,
+      binary_attr);
 
   return mkldnn::MkldnnConvOpContext::create_context(
       std::move(weight),
@@ -38,6 +99,10 @@ c10::intrusive_ptr<mkldnn::ConvOpContext> createConvPrePackOpContext(
       std::move(dilation),
       groups,
       std::move(input_size),
+      std::move(attr),
+      std::move(scalars),
+      std::move(algorithm),
+      std::move(binary_attr),
       op_attr);
 }
 
@@ -274,12 +339,80 @@ void run(ContextConv& context, const Tensor& input, void* output) {
   }
 }
 
+Tensor run_binary(
+    ContextConv& context,
+    const Tensor& input,
+    const Tensor& other) {
+  std::vector<int64_t> output_sizes = get_output_sizes(context, input);
+  TORCH_CHECK(
+      output_sizes == other.sizes().vec(),
+      "Binary fusion's inputs should have same shape");
+
+  // The binary operand's descriptor was compiled with an nhwc tag, so this
+  // path only runs in channels last (the rewrite pass only prepacks
+  // channels last convolutions).
+  auto memory_format = at::MemoryFormat::ChannelsLast;
+  auto input_ = input.contiguous(memory_format);
+  auto other_ = other.contiguous(memory_format);
+  auto output = at::empty(
+      output_sizes, input_.options().memory_format(memory_format));
+
+  c10::impl::ExcludeDispatchKeyGuard edkg(c10::autograd_dispatch_keyset);
+  const ideep::tensor x = itensor_from_tensor(input_);
+  const ideep::tensor z = itensor_from_tensor(other_);
+  ideep::tensor y = itensor_from_tensor(output);
+
+  IntArrayRef padding = context.padding_;
+  IntArrayRef stride = context.stride_;
+  IntArrayRef dilation = context.dilation_;
+
+  if (context.at_bias_.has_value()) {
+    const ideep::tensor b = itensor_from_tensor(context.at_bias_.value());
+    ideep::convolution_forward::compute_binary(
+        x,
+        z,
+        context.weight_packed_,
+        b,
+        output_sizes,
+        y,
+        {stride.begin(), stride.end()},
+        {dilation.begin(), dilation.end()},
+        {padding.begin(), padding.end()},
+        {padding.begin(), padding.end()},
+        context.groups_,
+        /* is_channels_last */ true,
+        context.attr_);
+  } else {
+    ideep::convolution_forward::compute_binary(
+        x,
+        z,
+        context.weight_packed_,
+        output_sizes,
+        y,
+        {stride.begin(), stride.end()},
+        {dilation.begin(), dilation.end()},
+        {padding.begin(), padding.end()},
+        {padding.begin(), padding.end()},
+        context.groups_,
+        /* is_channels_last */ true,
+        context.attr_);
+  }
+  return output;
+}
+
 Tensor conv_run(
     const Tensor& input,
     const c10::intrusive_ptr<mkldnn::ConvOpContext>& op_context) {
   return op_context->run(input);
 }
 
+Tensor conv_run_binary(
+    const Tensor& input,
+    const Tensor& other,
+    const c10::intrusive_ptr<mkldnn::ConvOpContext>& op_context) {
+  return op_context->run_binary(input, other);
+}
+
 } // namespace convolution
 } // namespace internal
 } // namespace mkldnn
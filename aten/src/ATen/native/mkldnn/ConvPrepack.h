@@ -20,12 +20,20 @@ c10::intrusive_ptr<mkldnn::ConvOpContext> createConvPrePackOpContext(
     std::vector<int64_t> dilation,
     int64_t groups,
     std::vector<int64_t> input_size,
-    std::string attr);
+    std::string attr,
+    c10::List<c10::optional<at::Scalar>> scalars,
+    c10::optional<std::string> algorithm,
+    c10::optional<std::string> binary_attr);
 
 Tensor conv_run(
     const Tensor& input,
     const c10::intrusive_ptr<mkldnn::ConvOpContext>& op_context);
 
+Tensor conv_run_binary(
+    const Tensor& input,
+    const Tensor& other,
+    const c10::intrusive_ptr<mkldnn::ConvOpContext>& op_context);
+
 ContextConv create(
     const Tensor& weight,
     const c10::optional<Tensor>& bias,
@@ -40,6 +48,8 @@ Tensor run(ContextConv& context, const Tensor& input);
 
 void run(ContextConv& context, const Tensor& input, void* output);
 
+Tensor run_binary(ContextConv& context, const Tensor& input, const Tensor& other);
+
 } // namespace convolution
 } // namespace internal
 } // namespace mkldnn
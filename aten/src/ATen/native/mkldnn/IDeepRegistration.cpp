@@ -4,18 +4,140 @@
 
 #if AT_MKLDNN_ENABLED()
 
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 // needs to be included only once in library.
 #include <ideep_pin_singletons.hpp>
 
 using namespace ideep;
 
+namespace {
+
+// oneDNN primitives run with user-managed scratchpads: ideep sizes the
+// scratchpad for every primitive and allocates it through the engine
+// allocator registered below, which means one system allocation per op
+// call. Multi-model servers see real malloc churn from this, so instead of
+// handing each request to the system allocator, keep a bounded pool of
+// power-of-two blocks and recycle them. Frees can arrive from a different
+// thread than the matching allocation (oneDNN may release buffers from its
+// own pool threads), so the pool is a single mutex-guarded arena rather
+// than thread-local free lists.
+class ScratchpadArena {
+ public:
+  static ScratchpadArena& getInstance() {
+    static ScratchpadArena arena;
+    return arena;
+  }
+
+  void* allocate(size_t size) {
+    const size_t rounded = round_size(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = free_blocks_.find(rounded);
+      if (it != free_blocks_.end() && !it->second.empty()) {
+        void* ptr = it->second.back();
+        it->second.pop_back();
+        cached_bytes_ -= rounded;
+        live_blocks_.emplace(ptr, rounded);
+        return ptr;
+      }
+    }
+    void* ptr = c10::GetAllocator(c10::DeviceType::CPU)->raw_allocate(rounded);
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_blocks_.emplace(ptr, rounded);
+    return ptr;
+  }
+
+  void deallocate(void* ptr) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = live_blocks_.find(ptr);
+      if (it != live_blocks_.end()) {
+        const size_t rounded = it->second;
+        live_blocks_.erase(it);
+        if (cached_bytes_ + rounded <= capacity_) {
+          free_blocks_[rounded].push_back(ptr);
+          cached_bytes_ += rounded;
+          return;
+        }
+      }
+    }
+    c10::GetAllocator(c10::DeviceType::CPU)->raw_deallocate(ptr);
+  }
+
+  void clear() {
+    trim_to(/*limit=*/0);
+  }
+
+  void set_capacity(size_t bytes) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      capacity_ = bytes;
+    }
+    trim_to(bytes);
+  }
+
+  size_t capacity() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+  }
+
+ private:
+  static size_t round_size(size_t size) {
+    constexpr size_t kMinBlockSize = 4096;
+    if (size > (std::numeric_limits<size_t>::max() >> 1)) {
+      return size;
+    }
+    size_t rounded = kMinBlockSize;
+    while (rounded < size) {
+      rounded *= 2;
+    }
+    return rounded;
+  }
+
+  void trim_to(size_t limit) {
+    std::vector<void*> to_free;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto& bucket : free_blocks_) {
+        while (cached_bytes_ > limit && !bucket.second.empty()) {
+          to_free.push_back(bucket.second.back());
+          bucket.second.pop_back();
+          cached_bytes_ -= bucket.first;
+        }
+        if (cached_bytes_ <= limit) {
+          break;
+        }
+      }
+    }
+    for (void* ptr : to_free) {
+      c10::GetAllocator(c10::DeviceType::CPU)->raw_deallocate(ptr);
+    }
+  }
+
+  // 64MB of pooled blocks covers the scratchpads of typical CNN/transformer
+  // primitives while staying negligible next to the weights of one model.
+  static constexpr size_t kDefaultCapacity = static_cast<size_t>(64) << 20;
+
+  std::mutex mutex_;
+  std::unordered_map<size_t, std::vector<void*>> free_blocks_;
+  std::unordered_map<void*, size_t> live_blocks_;
+  size_t cached_bytes_{0};
+  size_t capacity_{kDefaultCapacity};
+};
+
+} // anonymous namespace
+
 RegisterEngineAllocator cpu_alloc(
   engine::cpu_engine(),
   [](size_t size) {
-    return c10::GetAllocator(c10::DeviceType::CPU)->raw_allocate(size);
+    return ScratchpadArena::getInstance().allocate(size);
   },
   [](void* p) {
-    c10::GetAllocator(c10::DeviceType::CPU)->raw_deallocate(p);
+    ScratchpadArena::getInstance().deallocate(p);
   }
 );
 
@@ -25,6 +147,24 @@ void clear_computation_cache() {
   // Reset computation_cache for forward convolutions
   // As it also caches max number of OpenMP workers
   ideep::convolution_forward::t_store().clear();
+  // Scratchpad sizes depend on the worker count as well, so pooled blocks
+  // are stale after a thread-count change.
+  ScratchpadArena::getInstance().clear();
+}
+
+// Eviction and capacity control for the pooled oneDNN scratchpad blocks;
+// processes hosting many models can flush or resize the pool when switching
+// working sets.
+void clear_scratchpad_cache() {
+  ScratchpadArena::getInstance().clear();
+}
+
+void set_scratchpad_cache_capacity(size_t bytes) {
+  ScratchpadArena::getInstance().set_capacity(bytes);
+}
+
+size_t scratchpad_cache_capacity() {
+  return ScratchpadArena::getInstance().capacity();
 }
 
 }}} // namespace  at::native::mkldnn
@@ -30,6 +30,18 @@ TORCH_API ideep::tensor itensor_from_tensor(const Tensor& tensor);
 // Set MKLDNN verbose level
 TORCH_API int set_verbose(int level);
 
+namespace mkldnn {
+
+// Controls for the pooled oneDNN scratchpad blocks, defined in
+// IDeepRegistration.cpp. clear_scratchpad_cache releases every pooled
+// block; set_scratchpad_cache_capacity bounds the bytes kept for reuse
+// (0 disables pooling entirely).
+TORCH_API void clear_scratchpad_cache();
+TORCH_API void set_scratchpad_cache_capacity(size_t bytes);
+TORCH_API size_t scratchpad_cache_capacity();
+
+} // namespace mkldnn
+
 }}
 
 #endif // AT_MKLDNN_ENABLED
@@ -15,9 +15,13 @@ c10::intrusive_ptr<ConvOpContext> MkldnnConvOpContext::create_context(
     std::vector<int64_t>&& dilation,
     int64_t groups,
     std::vector<int64_t>&& input_size,
-    const ideep::attr_t& attr) {
+    std::string&& attr,
+    c10::List<c10::optional<at::Scalar>>&& scalars,
+    c10::optional<std::string>&& algorithm,
+    c10::optional<std::string>&& binary_attr,
+    const ideep::attr_t& op_attr) {
   auto op_context = mkldnn::internal::convolution::create(
-      weight, bias, padding, stride, dilation, groups, input_size, attr);
+      weight, bias, padding, stride, dilation, groups, input_size, op_attr);
 
   auto conv_op_context = c10::make_intrusive<MkldnnConvOpContext>(
       std::move(weight),
@@ -27,6 +31,10 @@ c10::intrusive_ptr<ConvOpContext> MkldnnConvOpContext::create_context(
       std::move(dilation),
       groups,
       std::move(input_size),
+      std::move(attr),
+      std::move(scalars),
+      std::move(algorithm),
+      std::move(binary_attr),
       std::move(op_context));
 
   return conv_op_context;
@@ -40,6 +48,15 @@ void MkldnnConvOpContext::run(const Tensor& input, void* output) {
   return mkldnn::internal::convolution::run(op_context_, input, output);
 }
 
+Tensor MkldnnConvOpContext::run_binary(
+    const Tensor& input,
+    const Tensor& other) {
+  TORCH_CHECK(
+      binary_attr_.has_value() && binary_attr_.value() != "none",
+      "run_binary: the prepacked context was not compiled with a binary post op");
+  return mkldnn::internal::convolution::run_binary(op_context_, input, other);
+}
+
 } // namespace mkldnn
 } // namespace native
 } // namespace at
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ATen/Tensor.h>
+#include <ATen/core/List.h>
 #include <ATen/core/ivalue.h>
 #include <ATen/native/mkldnn/Common.h>
 
@@ -10,11 +11,6 @@ namespace at {
 namespace native {
 namespace mkldnn {
 
-const static std::map<std::string, ideep::attr_t> fusion_attr_map = {
-    {"none", ideep::attr_t()},
-    {"relu", ideep::attr_t::fuse_relu()},
-};
-
 using SerializationTypeConvPrePack = std::tuple<
     Tensor,
     c10::optional<Tensor>,
@@ -23,7 +19,10 @@ using SerializationTypeConvPrePack = std::tuple<
     std::vector<int64_t>,
     int64_t,
     std::vector<int64_t>,
-    std::string>;
+    std::string,
+    c10::List<c10::optional<at::Scalar>>,
+    c10::optional<std::string>,
+    c10::optional<std::string>>;
 
 class ConvOpContext : public torch::jit::CustomClassHolder {
  protected:
@@ -34,7 +33,14 @@ class ConvOpContext : public torch::jit::CustomClassHolder {
   std::vector<int64_t> dilation_;
   int64_t groups_;
   std::vector<int64_t> input_size_;
+  // The epilogue chain: an optional binary post op (consuming a second
+  // runtime input, see run_binary) followed by an optional eltwise op.
+  // Kept in string/scalar form so the context can be serialized; the
+  // compiled ideep::attr_t lives in the derived class' ContextConv.
   std::string attr_;
+  c10::List<c10::optional<at::Scalar>> scalars_;
+  c10::optional<std::string> algorithm_;
+  c10::optional<std::string> binary_attr_;
 
  public:
   SerializationTypeConvPrePack unpack() {
@@ -46,11 +52,15 @@ class ConvOpContext : public torch::jit::CustomClassHolder {
         dilation_,
         groups_,
         input_size_,
-        attr_);
+        attr_,
+        scalars_,
+        algorithm_,
+        binary_attr_);
   }
 
   virtual Tensor run(const Tensor& input) = 0;
   virtual void run(const Tensor& input, void* output) = 0;
+  virtual Tensor run_binary(const Tensor& input, const Tensor& other) = 0;
 };
 
 class MkldnnConvOpContext final : public ConvOpContext {
@@ -66,6 +76,10 @@ class MkldnnConvOpContext final : public ConvOpContext {
       std::vector<int64_t>&& dilation,
       uint64_t groups,
       std::vector<int64_t>&& input_size,
+      std::string&& attr,
+      c10::List<c10::optional<at::Scalar>>&& scalars,
+      c10::optional<std::string>&& algorithm,
+      c10::optional<std::string>&& binary_attr,
       ContextConv&& op_context)
       : op_context_(std::move(op_context)) {
     orig_weight_ = std::move(weight);
@@ -75,12 +89,18 @@ class MkldnnConvOpContext final : public ConvOpContext {
     dilation_ = std::move(dilation);
     groups_ = groups;
     input_size_ = std::move(input_size);
+    attr_ = std::move(attr);
+    scalars_ = std::move(scalars);
+    algorithm_ = std::move(algorithm);
+    binary_attr_ = std::move(binary_attr);
   }
 
   Tensor run(const Tensor& input) override;
 
   void run(const Tensor& input, void* output) override;
 
+  Tensor run_binary(const Tensor& input, const Tensor& other) override;
+
   static c10::intrusive_ptr<ConvOpContext> create_context(
       Tensor&& weight,
       c10::optional<Tensor>&& bias,
@@ -89,7 +109,11 @@ class MkldnnConvOpContext final : public ConvOpContext {
       std::vector<int64_t>&& dilation,
       int64_t groups,
       std::vector<int64_t>&& input_size,
-      const ideep::attr_t& attr);
+      std::string&& attr,
+      c10::List<c10::optional<at::Scalar>>&& scalars,
+      c10::optional<std::string>&& algorithm,
+      c10::optional<std::string>&& binary_attr,
+      const ideep::attr_t& op_attr);
 };
 
 } // namespace mkldnn
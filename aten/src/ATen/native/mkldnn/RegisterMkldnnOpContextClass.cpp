@@ -29,7 +29,10 @@ TORCH_LIBRARY(mkldnn, m) {
                 std::move(std::get<4>(state)),
                 std::move(std::get<5>(state)),
                 std::move(std::get<6>(state)),
-                std::move(std::get<7>(state)));
+                std::move(std::get<7>(state)),
+                std::move(std::get<8>(state)),
+                std::move(std::get<9>(state)),
+                std::move(std::get<10>(state)));
           });
 
   m.def(TORCH_SELECTIVE_SCHEMA(
@@ -50,10 +53,13 @@ TORCH_LIBRARY(mkldnn, m) {
 
 TORCH_LIBRARY(mkldnn_prepacked, m) {
   m.def(TORCH_SELECTIVE_SCHEMA(
-      "mkldnn_prepacked::conv2d_prepack(Tensor W, Tensor? B, int[2] stride, int[2] padding, int[2] dilation, int groups, int[4] input_size, str attr) -> __torch__.torch.classes.mkldnn.ConvOpContext"));
+      "mkldnn_prepacked::conv2d_prepack(Tensor W, Tensor? B, int[2] stride, int[2] padding, int[2] dilation, int groups, int[4] input_size, str attr, Scalar?[] scalars, str? algorithm, str? binary_attr) -> __torch__.torch.classes.mkldnn.ConvOpContext"));
 
   m.def(TORCH_SELECTIVE_SCHEMA(
       "mkldnn_prepacked::conv2d_run(Tensor X, __torch__.torch.classes.mkldnn.ConvOpContext W_prepack) -> Tensor Y"));
+
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "mkldnn_prepacked::conv2d_run_binary(Tensor X, Tensor other, __torch__.torch.classes.mkldnn.ConvOpContext W_prepack) -> Tensor Y"));
 }
 
 TORCH_LIBRARY_IMPL(mkldnn_prepacked, CPU, m) {
@@ -63,6 +69,10 @@ TORCH_LIBRARY_IMPL(mkldnn_prepacked, CPU, m) {
 
   m.impl(
       TORCH_SELECTIVE_NAME("mkldnn_prepacked::conv2d_run"), TORCH_FN(conv_run));
+
+  m.impl(
+      TORCH_SELECTIVE_NAME("mkldnn_prepacked::conv2d_run_binary"),
+      TORCH_FN(conv_run_binary));
 }
 
 } // namespace mkldnn
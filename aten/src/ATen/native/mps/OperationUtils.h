@@ -9,6 +9,7 @@
 #include <ATen/native/mps/TensorFactory.h>
 #include <c10/core/ScalarType.h>
 #include <torch/library.h>
+#include <cstdlib>
 #include <unordered_map>
 
 #ifdef __OBJC__
@@ -142,9 +143,14 @@ struct MPSCachedGraph
   NSObject *object() const { return _object; }
   MPSGraphExecutable *getExecultable() const { return _executable; }
   void setExecultable(MPSGraphExecutable *executable) { _executable = executable; }
+  // Key string this graph was cached under; used by the executable disk
+  // cache (see Note [MPS executable disk cache] in OperationUtils.mm).
+  const std::string& cacheKey() const { return _cacheKey; }
+  void setCacheKey(const std::string& cacheKey) { _cacheKey = cacheKey; }
 private:
   NSObject *_object = nullptr;
   MPSGraphExecutable* _executable = nullptr;
+  std::string _cacheKey;
 };
 
 struct MPSUnaryCachedGraph : public MPSCachedGraph
@@ -173,6 +179,10 @@ struct MPSGraphCache
     CacheEntry(const std::string& key, MPSCachedGraph *cachedGraph) : cachedGraph_(cachedGraph), key_(key) {}
     MPSCachedGraph* cachedGraph_ = nullptr;
     std::string key_;
+    // generation of the last lookup/creation of this entry; entries with the
+    // smallest generation are evicted first when the cache is over budget.
+    // mutable so that the logically-const LookUp() can refresh it.
+    mutable uint64_t lastUseGeneration_ = 0;
   };
 
  public:
@@ -209,10 +219,15 @@ struct MPSGraphCache
         auto& entry = cache_.at(hash);
         TORCH_INTERNAL_ASSERT_DEBUG_ONLY(key == entry.key_, "Key collision in the MPS cached graph!\n");
         cachedGraph = entry.cachedGraph_;
+        recordCacheHit(entry);
       } else {
+        recordCacheMiss();
         cachedGraph = createCacheBlock();
+        cachedGraph->setCacheKey(key);
         CacheEntry entry(key, cachedGraph);
+        entry.lastUseGeneration_ = ++generation_;
         cache_.emplace(hash, entry);
+        evictOverBudgetLocked();
         profileCachedGraph(entry);
       }
     });
@@ -235,7 +250,10 @@ struct MPSGraphCache
         auto& entry = cache_.at(hash);
         TORCH_INTERNAL_ASSERT_DEBUG_ONLY(key == entry.key_, "Key collision in the MPS cached graph!\n");
         cachedGraph = entry.cachedGraph_;
+        recordCacheHit(entry);
         profileCachedGraph(entry);
+      } else {
+        recordCacheMiss();
       }
     });
     return cachedGraph;
@@ -249,14 +267,33 @@ struct MPSGraphCache
  private:
   MPSGraphCache() {
     serialQueue_ = dispatch_queue_create("cache queue", DISPATCH_QUEUE_SERIAL);
+    // 0 (the default) keeps every compiled graph, matching the old behavior.
+    // Shape-polymorphic workloads can cap the cache to stop compiled-graph
+    // host memory from growing without bound.
+    if (const char* max_entries_str = std::getenv("PYTORCH_MPS_GRAPH_CACHE_MAX_ENTRIES")) {
+      max_entries_ = strtoull(max_entries_str, nullptr, 0);
+    }
   }
-  // this is defined in OperationUtils.mm to not include
+  // these are defined in OperationUtils.mm to not include
   // MPSProfiler.h in header OperationUtils.h
   void profileCachedGraph(const CacheEntry& cacheEntry) const;
+  void recordCacheHit(const CacheEntry& cacheEntry) const;
+  void recordCacheMiss() const;
+  // Evicts least-recently-used entries until the cache fits max_entries_
+  // again; must run on serialQueue_. Note that eviction deletes the cached
+  // graph immediately, so the budget must be large enough that an entry
+  // returned to a concurrently-running op cannot reach the LRU tail while
+  // that op is still executing (any realistic budget is).
+  void evictOverBudgetLocked();
 
   static MPSGraphCache* _instance_cache;
   std::unordered_map<MPSCacheKey, CacheEntry> cache_;
   dispatch_queue_t serialQueue_ = nullptr;
+  // bumped on every lookup/creation; mutable so that the logically-const
+  // LookUp() can maintain the LRU ordering
+  mutable uint64_t generation_ = 0;
+  // entry budget; 0 means unlimited
+  uint64_t max_entries_ = 0;
 
 };
 
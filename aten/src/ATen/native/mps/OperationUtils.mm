@@ -4,8 +4,82 @@
 #include <ATen/mps/MPSAllocatorInterface.h>
 #include <ATen/mps/MPSProfiler.h>
 
+// MPSGraphPackage serialization selectors, which postdate the SDKs this file
+// may be built against; see Note [MPS executable disk cache] below. Every use
+// is gated at runtime with respondsToSelector:.
+@interface MPSGraphExecutable (PackageSerialization)
+- (void)serializeToMPSGraphPackageAtURL:(NSURL*)url
+                             descriptor:(id _Nullable)descriptor;
+- (nullable instancetype)initWithMPSGraphPackageAtURL:(NSURL*)url
+                                compilationDescriptor:(MPSGraphCompilationDescriptor* _Nullable)compilationDescriptor;
+@end
+
 namespace at::native::mps {
 
+// Note [MPS executable disk cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// MPSGraphCache only memoizes compiled graphs within a process, so every
+// launch pays the full MPSGraph compilation cost over again. When
+// PYTORCH_MPS_EXECUTABLE_CACHE_PATH points at a directory (created if
+// absent), executables compiled here are serialized into it as
+// MPSGraphPackages, named after the hash of the same key string the
+// in-memory cache uses, and subsequent launches deserialize them instead of
+// recompiling. The serialization API is newer than the SDKs this file may be
+// built against, so its selectors are declared in a category at the top of
+// this file and checked with respondsToSelector: at runtime; on OSes that
+// lack them the disk cache silently degrades to the status quo. The hook
+// lives in runMPSGraph() because only the disableTypeInference path compiles
+// executables at all.
+static NSURL* executableCacheURL(const std::string& key) {
+  static NSString* cacheDir = []() -> NSString* {
+    const char* env = std::getenv("PYTORCH_MPS_EXECUTABLE_CACHE_PATH");
+    if (!env || !env[0]) {
+      return nil;
+    }
+    NSString* dir = [[NSString stringWithUTF8String:env] retain];
+    NSError* error = nil;
+    if (![[NSFileManager defaultManager] createDirectoryAtPath:dir
+                                   withIntermediateDirectories:YES
+                                                    attributes:nil
+                                                         error:&error]) {
+      TORCH_WARN_ONCE("MPS: cannot create executable cache directory ", env,
+                      "; the executable disk cache is disabled");
+      return nil;
+    }
+    return dir;
+  }();
+  if (cacheDir == nil || key.empty()) {
+    return nil;
+  }
+  const uint64_t hash = std::hash<std::string>{}(key);
+  NSString* name = [NSString stringWithFormat:@"%016llx.mpsgraphpackage",
+                                              (unsigned long long)hash];
+  return [NSURL fileURLWithPath:[cacheDir stringByAppendingPathComponent:name]];
+}
+
+static MPSGraphExecutable* loadCachedExecutable(const std::string& key,
+                                                MPSGraphCompilationDescriptor* compilationDescriptor) {
+  if (![MPSGraphExecutable instancesRespondToSelector:@selector(initWithMPSGraphPackageAtURL:compilationDescriptor:)]) {
+    return nil;
+  }
+  NSURL* url = executableCacheURL(key);
+  if (!url || ![[NSFileManager defaultManager] fileExistsAtPath:url.path]) {
+    return nil;
+  }
+  return [[MPSGraphExecutable alloc] initWithMPSGraphPackageAtURL:url
+                                            compilationDescriptor:compilationDescriptor];
+}
+
+static void saveCachedExecutable(const std::string& key, MPSGraphExecutable* executable) {
+  if (![executable respondsToSelector:@selector(serializeToMPSGraphPackageAtURL:descriptor:)]) {
+    return;
+  }
+  NSURL* url = executableCacheURL(key);
+  if (url) {
+    [executable serializeToMPSGraphPackageAtURL:url descriptor:nil];
+  }
+}
+
 void runMPSGraph(MPSStream* mpsStream, MPSGraph* mpsGraph, NSDictionary* feeds,
                  NSDictionary* results) {
   mpsStream->executeMPSGraph(mpsGraph, feeds, results, SyncType::COMMIT_ADAPTIVE);
@@ -28,11 +102,16 @@ void runMPSGraph(MPSStream* mpsStream, MPSCachedGraph *cachedGraph, NSDictionary
         MPSGraphCompilationDescriptor *compilationDescriptor = [[MPSGraphCompilationDescriptor new] autorelease];
         [compilationDescriptor disableTypeInference];
 
-        executable = [[mpsGraph compileWithDevice:nil
-                                            feeds:shapes
-                                    targetTensors:[results allKeys]
-                                 targetOperations:nil
-                            compilationDescriptor:compilationDescriptor] retain];
+        // see Note [MPS executable disk cache]
+        executable = loadCachedExecutable(cachedGraph->cacheKey(), compilationDescriptor);
+        if (!executable) {
+          executable = [[mpsGraph compileWithDevice:nil
+                                              feeds:shapes
+                                      targetTensors:[results allKeys]
+                                   targetOperations:nil
+                              compilationDescriptor:compilationDescriptor] retain];
+          saveCachedExecutable(cachedGraph->cacheKey(), executable);
+        }
         // store the executable within the cachedGraph to reuse next time
         cachedGraph->setExecultable(executable);
       }
@@ -499,6 +578,36 @@ string get_mem_format_string(c10::MemoryFormat memory_format) {
 
 MPSGraphCache* MPSGraphCache::_instance_cache = nullptr;
 
+void MPSGraphCache::recordCacheHit(const CacheEntry& cacheEntry) const {
+  cacheEntry.lastUseGeneration_ = ++generation_;
+  getMPSProfiler().recordGraphCacheHit();
+}
+
+void MPSGraphCache::recordCacheMiss() const {
+  getMPSProfiler().recordGraphCacheMiss();
+}
+
+void MPSGraphCache::evictOverBudgetLocked() {
+  if (max_entries_ == 0 || cache_.size() <= max_entries_) {
+    return;
+  }
+  uint64_t evicted = 0;
+  while (cache_.size() > max_entries_) {
+    // O(n) scan per eviction; at steady state the budget is exceeded by at
+    // most one entry per insertion, so this runs once per cache miss.
+    auto lru = cache_.begin();
+    for (auto it = std::next(cache_.begin()); it != cache_.end(); ++it) {
+      if (it->second.lastUseGeneration_ < lru->second.lastUseGeneration_) {
+        lru = it;
+      }
+    }
+    delete lru->second.cachedGraph_;
+    cache_.erase(lru);
+    evicted++;
+  }
+  getMPSProfiler().recordGraphCacheEvictions(evicted);
+}
+
 void MPSGraphCache::profileCachedGraph(const CacheEntry& cacheEntry) const {
   auto& profiler = getMPSProfiler();
   if (profiler.isOperationProfilingEnabled()) {
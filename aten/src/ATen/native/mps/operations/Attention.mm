@@ -0,0 +1,397 @@
+//  Copyright © 2022 Apple Inc.
+
+#include <ATen/native/mps/OperationUtils.h>
+#include <ATen/mps/MPSProfiler.h>
+#include <ATen/native/transformers/attention.h>
+#include <ATen/native/transformers/sdp_utils_cpp.h>
+#include <c10/core/GradMode.h>
+
+#include <cmath>
+
+namespace at::native {
+namespace mps {
+
+// Note [MPS fused scaled dot product attention]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The composite math path materializes the full [L, S] score matrix through
+// MPSGraph matmul/softmax/matmul, which dominates memory traffic at long
+// sequence lengths. The kernel below instead streams over the key/value rows
+// with an online softmax (running max and denominator, rescaling the partial
+// output as the max grows), so no score matrix is ever written out. One thread
+// handles one (batch, head, query row) triple and keeps its query row and
+// partial output in registers, which caps the supported head dimension at
+// kSDPAMaxHeadDim. Accumulation is always in float, including for half
+// inputs. The logsumexp per row is written out with the same semantics as the
+// CUDA flash attention path so the dispatch plumbing stays identical.
+static constexpr uint32_t kSDPAMaxHeadDim = 128;
+
+static char* SDPA_OPS_TEMPLATE = R"METAL_SDPA(
+#include <metal_stdlib>
+using namespace metal;
+
+constant constexpr uint MAX_HEAD_DIM = 128;
+
+struct SDPAParams {
+  uint q_len;
+  uint k_len;
+  uint head_dim;
+  uint is_causal;
+  float scale;
+};
+
+template<typename T>
+kernel void sdpa_forward(constant T          * query     [[buffer(0)]],
+                         constant T          * key       [[buffer(1)]],
+                         constant T          * value     [[buffer(2)]],
+                         device   T          * output    [[buffer(3)]],
+                         device   float      * logsumexp [[buffer(4)]],
+                         constant SDPAParams & params    [[buffer(5)]],
+                         uint tid [[thread_position_in_grid]]) {
+  const uint row = tid % params.q_len;
+  const uint bh  = tid / params.q_len;
+  const uint D   = params.head_dim;
+
+  constant T* q_row  = query + (bh * params.q_len + row) * D;
+  constant T* k_base = key   + bh * params.k_len * D;
+  constant T* v_base = value + bh * params.k_len * D;
+
+  uint kv_limit = params.k_len;
+  if (params.is_causal) {
+    const int causal_limit = (int)params.k_len - (int)params.q_len + (int)row + 1;
+    kv_limit = (uint)clamp(causal_limit, 0, (int)params.k_len);
+  }
+
+  float q_local[MAX_HEAD_DIM];
+  float acc[MAX_HEAD_DIM];
+  for (uint d = 0; d < D; d++) {
+    q_local[d] = (float)q_row[d] * params.scale;
+    acc[d] = 0.0f;
+  }
+
+  float row_max = -INFINITY;
+  float row_sum = 0.0f;
+  for (uint j = 0; j < kv_limit; j++) {
+    constant T* k_row = k_base + j * D;
+    float s = 0.0f;
+    for (uint d = 0; d < D; d++) {
+      s += q_local[d] * (float)k_row[d];
+    }
+    const float new_max = max(row_max, s);
+    const float correction = exp(row_max - new_max);
+    const float p = exp(s - new_max);
+    constant T* v_row = v_base + j * D;
+    for (uint d = 0; d < D; d++) {
+      acc[d] = acc[d] * correction + p * (float)v_row[d];
+    }
+    row_sum = row_sum * correction + p;
+    row_max = new_max;
+  }
+
+  device T* out_row = output + (bh * params.q_len + row) * D;
+  const float inv_sum = row_sum > 0.0f ? 1.0f / row_sum : 0.0f;
+  for (uint d = 0; d < D; d++) {
+    out_row[d] = (T)(acc[d] * inv_sum);
+  }
+  logsumexp[bh * params.q_len + row] = row_max + log(row_sum);
+}
+
+template
+[[host_name("sdpa_forward_float")]]
+kernel void sdpa_forward<float>(constant float*, constant float*, constant float*,
+                                device float*, device float*, constant SDPAParams&, uint);
+template
+[[host_name("sdpa_forward_half")]]
+kernel void sdpa_forward<half>(constant half*, constant half*, constant half*,
+                               device half*, device float*, constant SDPAParams&, uint);
+
+struct RopeParams {
+  uint seq_len;
+  uint half_dim;
+};
+
+// Rotary position embedding: pairs (2j, 2j + 1) of a row are the real and
+// imaginary lanes of the complex rotation at pair index j. One thread
+// handles one pair, so input and output may alias (in-place variant).
+template<typename T>
+kernel void rotary_embedding(constant T          * input  [[buffer(0)]],
+                             constant T          * cos_t  [[buffer(1)]],
+                             constant T          * sin_t  [[buffer(2)]],
+                             device   T          * output [[buffer(3)]],
+                             constant RopeParams & params [[buffer(4)]],
+                             uint tid [[thread_position_in_grid]]) {
+  const uint j    = tid % params.half_dim;
+  const uint row  = tid / params.half_dim;
+  const uint pos  = row % params.seq_len;
+  const uint base = row * params.half_dim * 2 + j * 2;
+  const float c  = (float)cos_t[pos * params.half_dim + j];
+  const float s  = (float)sin_t[pos * params.half_dim + j];
+  const float x0 = (float)input[base];
+  const float x1 = (float)input[base + 1];
+  output[base]     = (T)(x0 * c - x1 * s);
+  output[base + 1] = (T)(x0 * s + x1 * c);
+}
+
+template
+[[host_name("rotary_embedding_float")]]
+kernel void rotary_embedding<float>(constant float*, constant float*, constant float*,
+                                    device float*, constant RopeParams&, uint);
+template
+[[host_name("rotary_embedding_half")]]
+kernel void rotary_embedding<half>(constant half*, constant half*, constant half*,
+                                   device half*, constant RopeParams&, uint);
+)METAL_SDPA";
+
+struct SDPAParams {
+  uint32_t q_len;
+  uint32_t k_len;
+  uint32_t head_dim;
+  uint32_t is_causal;
+  float scale;
+};
+
+struct RopeParams {
+  uint32_t seq_len;
+  uint32_t half_dim;
+};
+
+static id<MTLLibrary> compileSDPAOpsLibrary(id<MTLDevice> device) {
+  static id<MTLLibrary> sdpaLib = nil;
+  if (sdpaLib != nil) {
+    return sdpaLib;
+  }
+  NSError *error = nil;
+  MTLCompileOptions *options = [[MTLCompileOptions new] autorelease];
+  MTLLanguageVersion languageVersion = MTLLanguageVersion2_2;
+#if defined(__MAC_13_0)
+  if (is_macos_13_or_newer(MacOSVersion::MACOS_VER_13_0_PLUS)) {
+    languageVersion = MTLLanguageVersion3_0;
+  }
+#endif
+  [options setLanguageVersion: languageVersion];
+  sdpaLib = [device newLibraryWithSource:[NSString stringWithUTF8String:SDPA_OPS_TEMPLATE]
+                                 options:options
+                                   error:&error];
+  TORCH_CHECK(sdpaLib != nil && error == nil, "Failed to compile library: ", [[error localizedDescription] UTF8String]);
+  return sdpaLib;
+}
+
+static id<MTLComputePipelineState> getSDPAPSO(id<MTLDevice> device, const std::string& fname) {
+  static std::unordered_map<std::string, id<MTLComputePipelineState>> cplMap;
+  auto it = cplMap.find(fname);
+  if (it != cplMap.end()) {
+    return it->second;
+  }
+  NSError *error = nil;
+  id<MTLLibrary> sdpaLib = compileSDPAOpsLibrary(device);
+  id<MTLFunction> func = [sdpaLib newFunctionWithName:[NSString stringWithUTF8String:fname.c_str()]];
+  TORCH_CHECK(func != nil, "Can't get function ", fname);
+  auto rc = [device newComputePipelineStateWithFunction:func error:&error];
+  TORCH_CHECK(rc != nil && error == nil, "Failed to construct pipeline state: ", [[error localizedDescription] UTF8String]);
+  cplMap[fname] = rc;
+  return rc;
+}
+
+// The fused kernel only handles dense 4-dim [Batch, Num_heads, Seq, Dim]
+// inputs without an attention mask or dropout, and has no backward; anything
+// else is sent to the composite math path by _fused_sdp_choice_mps.
+static bool can_use_fused_sdpa_on_mps(const Tensor& query, const Tensor& key, const Tensor& value,
+                                      const c10::optional<Tensor>& attn_mask, double dropout_p) {
+  if (attn_mask.has_value() || dropout_p != 0.0) {
+    return false;
+  }
+  if (query.is_nested() || key.is_nested() || value.is_nested()) {
+    return false;
+  }
+  if (query.dim() != 4 || key.dim() != 4 || value.dim() != 4) {
+    return false;
+  }
+  if (query.scalar_type() != kFloat && query.scalar_type() != kHalf) {
+    return false;
+  }
+  if (query.size(-1) > kSDPAMaxHeadDim || query.size(-1) != value.size(-1)) {
+    return false;
+  }
+  // No fused backward exists on MPS, so gradients must take the math path.
+  if (c10::GradMode::is_enabled() &&
+      (query.requires_grad() || key.requires_grad() || value.requires_grad())) {
+    return false;
+  }
+  return true;
+}
+
+} // namespace mps
+
+int64_t _fused_sdp_choice_mps(const Tensor& query, const Tensor& key, const Tensor& value,
+        const c10::optional<Tensor>& attn_mask, double dropout_p, bool is_causal) {
+  if (mps::can_use_fused_sdpa_on_mps(query, key, value, attn_mask, dropout_p)) {
+    return static_cast<int64_t>(sdp::SDPBackend::flash_attention);
+  }
+  return static_cast<int64_t>(sdp::SDPBackend::math);
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor, int64_t, int64_t, int64_t, int64_t, Tensor>
+_scaled_dot_product_flash_attention_mps(
+    const Tensor& query_,
+    const Tensor& key_,
+    const Tensor& value_,
+    double dropout_p,
+    bool is_causal,
+    bool return_debug_mask) {
+  using namespace mps;
+
+  TORCH_CHECK(query_.dim() == 4 && key_.dim() == 4 && value_.dim() == 4,
+              "scaled_dot_product_flash_attention: expected 4 dimensional inputs on MPS");
+  TORCH_CHECK(dropout_p == 0.0,
+              "scaled_dot_product_flash_attention: dropout is not supported on MPS");
+  TORCH_CHECK(!return_debug_mask,
+              "scaled_dot_product_flash_attention: debug mask is not supported on MPS");
+  TORCH_CHECK(query_.scalar_type() == kFloat || query_.scalar_type() == kHalf,
+              "scaled_dot_product_flash_attention: MPS only supports float and half inputs");
+  TORCH_CHECK(key_.size(2) == value_.size(2),
+              "scaled_dot_product_flash_attention: expected key and value to have the same sequence length");
+  TORCH_CHECK(query_.size(3) <= kSDPAMaxHeadDim,
+              "scaled_dot_product_flash_attention: MPS supports head dimensions up to ", kSDPAMaxHeadDim);
+
+  const int64_t batch_size = query_.size(0);
+  const int64_t num_heads = query_.size(1);
+  const int64_t max_seqlen_q = query_.size(2);
+  const int64_t max_seqlen_k = key_.size(2);
+  const int64_t head_dim = query_.size(3);
+
+  Tensor query = query_.contiguous();
+  Tensor key = key_.contiguous();
+  Tensor value = value_.contiguous();
+
+  Tensor output = at::empty_like(query);
+  Tensor logsumexp = at::empty({batch_size, num_heads, max_seqlen_q},
+                               query.options().dtype(kFloat));
+  if (query.numel() == 0 || key.numel() == 0) {
+    output.zero_();
+    return std::make_tuple(std::move(output), std::move(logsumexp),
+                           Tensor(), Tensor(), max_seqlen_q, max_seqlen_k, 0, 0, Tensor());
+  }
+
+  const int64_t num_rows = batch_size * num_heads * max_seqlen_q;
+  TORCH_CHECK(num_rows <= UINT32_MAX && key.numel() <= UINT32_MAX,
+              "scaled_dot_product_flash_attention: inputs are too large for the MPS fused kernel");
+
+  SDPAParams params;
+  params.q_len = static_cast<uint32_t>(max_seqlen_q);
+  params.k_len = static_cast<uint32_t>(max_seqlen_k);
+  params.head_dim = static_cast<uint32_t>(head_dim);
+  params.is_causal = is_causal ? 1 : 0;
+  params.scale = 1.0f / std::sqrt(static_cast<float>(head_dim));
+
+  MPSStream* mpsStream = getCurrentMPSStream();
+  id<MTLDevice> device = MPSDevice::getInstance()->device();
+
+  id<MTLBuffer> queryBuffer = getMTLBufferStorage(query);
+  id<MTLBuffer> keyBuffer = getMTLBufferStorage(key);
+  id<MTLBuffer> valueBuffer = getMTLBufferStorage(value);
+  id<MTLBuffer> outputBuffer = getMTLBufferStorage(output);
+  id<MTLBuffer> logsumexpBuffer = getMTLBufferStorage(logsumexp);
+
+  dispatch_sync(mpsStream->queue(), ^(){
+    @autoreleasepool {
+      const uint32_t numThreads = static_cast<uint32_t>(num_rows);
+      id<MTLComputeCommandEncoder> computeEncoder = mpsStream->commandEncoder();
+      const std::string kernel = query.scalar_type() == kHalf ? "sdpa_forward_half" : "sdpa_forward_float";
+      id<MTLComputePipelineState> sdpaPSO = getSDPAPSO(device, kernel);
+
+      getMPSProfiler().beginProfileKernel(sdpaPSO, kernel, {query, key, value, output});
+      [computeEncoder setComputePipelineState:sdpaPSO];
+      [computeEncoder setBuffer:queryBuffer offset:query.storage_offset() * query.element_size() atIndex:0];
+      [computeEncoder setBuffer:keyBuffer offset:key.storage_offset() * key.element_size() atIndex:1];
+      [computeEncoder setBuffer:valueBuffer offset:value.storage_offset() * value.element_size() atIndex:2];
+      [computeEncoder setBuffer:outputBuffer offset:output.storage_offset() * output.element_size() atIndex:3];
+      [computeEncoder setBuffer:logsumexpBuffer offset:logsumexp.storage_offset() * logsumexp.element_size() atIndex:4];
+      [computeEncoder setBytes:&params length:sizeof(SDPAParams) atIndex:5];
+
+      MTLSize gridSize = MTLSizeMake(numThreads, 1, 1);
+      NSUInteger tgSize = sdpaPSO.maxTotalThreadsPerThreadgroup;
+      if (tgSize > numThreads) {
+        tgSize = numThreads;
+      }
+      MTLSize threadGroupSize = MTLSizeMake(tgSize, 1, 1);
+      [computeEncoder dispatchThreads: gridSize
+                threadsPerThreadgroup: threadGroupSize];
+      mpsStream->commitAdaptive({query, key, value, output}, sdpaPSO);
+    }
+  });
+
+  return std::make_tuple(std::move(output), std::move(logsumexp),
+                         Tensor(), Tensor(), max_seqlen_q, max_seqlen_k, 0, 0, Tensor());
+}
+
+namespace mps {
+
+// Shared by the functional and in-place entry points; output may alias self
+// since each thread owns its pair.
+static void rotary_embedding_out_mps(const Tensor& output, const Tensor& self,
+                                     const Tensor& cos, const Tensor& sin) {
+  check_rotary_embedding_inputs(self, cos, sin);
+  TORCH_CHECK(self.scalar_type() == kFloat || self.scalar_type() == kHalf,
+              "_rotary_embedding: MPS only supports float and half inputs");
+  if (self.numel() == 0) {
+    return;
+  }
+  const int64_t half_dim = self.size(-1) / 2;
+  const int64_t seq_len = self.size(-2);
+  const int64_t num_pairs = self.numel() / 2;
+  TORCH_CHECK(num_pairs <= UINT32_MAX,
+              "_rotary_embedding: input is too large for the MPS kernel");
+
+  RopeParams params;
+  params.seq_len = static_cast<uint32_t>(seq_len);
+  params.half_dim = static_cast<uint32_t>(half_dim);
+
+  MPSStream* mpsStream = getCurrentMPSStream();
+  id<MTLDevice> device = MPSDevice::getInstance()->device();
+
+  id<MTLBuffer> inputBuffer = getMTLBufferStorage(self);
+  id<MTLBuffer> cosBuffer = getMTLBufferStorage(cos);
+  id<MTLBuffer> sinBuffer = getMTLBufferStorage(sin);
+  id<MTLBuffer> outputBuffer = getMTLBufferStorage(output);
+
+  dispatch_sync(mpsStream->queue(), ^(){
+    @autoreleasepool {
+      const uint32_t numThreads = static_cast<uint32_t>(num_pairs);
+      id<MTLComputeCommandEncoder> computeEncoder = mpsStream->commandEncoder();
+      const std::string kernel = self.scalar_type() == kHalf ? "rotary_embedding_half" : "rotary_embedding_float";
+      id<MTLComputePipelineState> ropePSO = getSDPAPSO(device, kernel);
+
+      getMPSProfiler().beginProfileKernel(ropePSO, kernel, {self, cos, sin, output});
+      [computeEncoder setComputePipelineState:ropePSO];
+      [computeEncoder setBuffer:inputBuffer offset:self.storage_offset() * self.element_size() atIndex:0];
+      [computeEncoder setBuffer:cosBuffer offset:cos.storage_offset() * cos.element_size() atIndex:1];
+      [computeEncoder setBuffer:sinBuffer offset:sin.storage_offset() * sin.element_size() atIndex:2];
+      [computeEncoder setBuffer:outputBuffer offset:output.storage_offset() * output.element_size() atIndex:3];
+      [computeEncoder setBytes:&params length:sizeof(RopeParams) atIndex:4];
+
+      MTLSize gridSize = MTLSizeMake(numThreads, 1, 1);
+      NSUInteger tgSize = ropePSO.maxTotalThreadsPerThreadgroup;
+      if (tgSize > numThreads) {
+        tgSize = numThreads;
+      }
+      MTLSize threadGroupSize = MTLSizeMake(tgSize, 1, 1);
+      [computeEncoder dispatchThreads: gridSize
+                threadsPerThreadgroup: threadGroupSize];
+      mpsStream->commitAdaptive({self, cos, sin, output}, ropePSO);
+    }
+  });
+}
+
+} // namespace mps
+
+Tensor rotary_embedding_mps(const Tensor& self, const Tensor& cos, const Tensor& sin) {
+  Tensor output = at::empty_like(self);
+  mps::rotary_embedding_out_mps(output, self, cos, sin);
+  return output;
+}
+
+Tensor& rotary_embedding__mps(Tensor& self, const Tensor& cos, const Tensor& sin) {
+  mps::rotary_embedding_out_mps(self, self, cos, sin);
+  return self;
+}
+
+} // namespace at::native
@@ -4,6 +4,8 @@
 #include <ATen/native/mps/OperationUtils.h>
 #include <ATen/mps/MPSProfiler.h>
 
+#include <mutex>
+
 namespace at::native {
 namespace mps {
 
@@ -42,6 +44,70 @@ bool is_strided_contiguous(const at::Tensor& t) {
   return compute_strided_size(t) == t.numel();
 }
 
+// Note [MPS CPU staging buffer pool]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// CPU fallbacks copy every tensor argument to the CPU and every result back to
+// MPS, and pipelines that hit fallbacks do so many times per iteration. Each
+// such transfer used to wrap the host allocation in a fresh
+// newBufferWithBytesNoCopy MTLBuffer, and creating and destroying that wrapper
+// costs a VM remap per call. For small transfers we instead borrow a reusable
+// shared-storage-mode buffer from the pool below and pay a memcpy, which on
+// unified memory is cheaper than the per-call buffer churn. Large transfers
+// keep the zero-copy wrapper path, where the wrapping cost is amortized over
+// the transfer itself.
+static constexpr size_t kMinStagingBufferSize = 4096;
+static constexpr size_t kMaxStagingCopySize = 1024 * 1024;
+static constexpr size_t kMaxPooledStagingBytes = 32 * 1024 * 1024;
+
+class MPSStagingBufferPool {
+public:
+  static MPSStagingBufferPool& getInstance() {
+    static MPSStagingBufferPool pool;
+    return pool;
+  }
+
+  id<MTLBuffer> acquire(size_t nbytes) {
+    size_t length = kMinStagingBufferSize;
+    while (length < nbytes) {
+      length <<= 1;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = free_buffers_.find(length);
+      if (it != free_buffers_.end() && !it->second.empty()) {
+        id<MTLBuffer> buffer = it->second.back();
+        it->second.pop_back();
+        pooled_bytes_ -= length;
+        return buffer;
+      }
+    }
+    id<MTLDevice> device = MPSDevice::getInstance()->device();
+    id<MTLBuffer> buffer = [device newBufferWithLength:length
+                                               options:MTLResourceOptionCPUCacheModeDefault | MTLResourceStorageModeShared];
+    TORCH_CHECK(buffer != nil, "Failed to allocate MPS staging buffer of size ", length);
+    return buffer;
+  }
+
+  void release(id<MTLBuffer> buffer) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (pooled_bytes_ + buffer.length <= kMaxPooledStagingBytes) {
+        pooled_bytes_ += buffer.length;
+        free_buffers_[buffer.length].push_back(buffer);
+        return;
+      }
+    }
+    [buffer release];
+  }
+
+private:
+  MPSStagingBufferPool() = default;
+
+  std::mutex mutex_;
+  std::unordered_map<size_t, std::vector<id<MTLBuffer>>> free_buffers_;
+  size_t pooled_bytes_ = 0;
+};
+
 // Copy sourceBuffer into destBuffer, casting sourceBuffer to src.scalar_type().
 // The shapes and dtypes are taken from dst and src, but their storage pointers are not used.
 void copy_cast_mps(at::Tensor& dst, const at::Tensor& src,
@@ -130,6 +196,31 @@ static at::Tensor& copy_from_mps_(at::Tensor& dst_, const at::Tensor& src_, bool
   id<MTLBuffer> sourceBuffer = getMTLBufferStorage(src);
   size_t dst_tensor_nbytes = dst.nbytes();
 
+  // Small same-dtype blocking copies borrow a reusable shared buffer instead of
+  // wrapping the host allocation in a throwaway MTLBuffer; see
+  // Note [MPS CPU staging buffer pool]. Non-blocking copies keep the zero-copy
+  // wrapper below, since with staging the host data would only become valid
+  // once a completion handler ran.
+  if (src_.dtype() == dst.dtype() && !non_blocking &&
+      src.nbytes() > 0 && src.nbytes() <= kMaxStagingCopySize) {
+    @autoreleasepool {
+      auto& stagingPool = MPSStagingBufferPool::getInstance();
+      const size_t size_to_copy = src.nbytes();
+      id<MTLBuffer> stagingBuffer = stagingPool.acquire(size_to_copy);
+      TORCH_INTERNAL_ASSERT(sourceBuffer && dst_tensor_nbytes > 0);
+      uint64_t profile_id = getMPSProfiler().beginProfileCopy(sourceBuffer, stagingBuffer,
+                                        src, dst, size_to_copy, non_blocking);
+      stream->copy_and_sync(sourceBuffer, stagingBuffer, size_to_copy, storage_byte_offset,
+                            0, non_blocking, profile_id);
+      memcpy(dst.storage().data(), [stagingBuffer contents], size_to_copy);
+      stagingPool.release(stagingBuffer);
+    }
+    if (!dst.is_same(dst_)) {
+      dst_.copy_(dst, non_blocking);
+    }
+    return dst_;
+  }
+
   @autoreleasepool {
     MTLResourceOptions options = MTLResourceOptionCPUCacheModeDefault | MTLResourceStorageModeShared;
     NSUInteger alignedLength = 0;
@@ -197,6 +288,33 @@ static void copy_to_mps_stride_contig(at::Tensor& dst, const at::Tensor& src, bo
 
   TORCH_INTERNAL_ASSERT(src.dtype() == dst.dtype() && src.strides() == dst.strides() && is_strided_contiguous(src));
 
+  // Stage small host-to-device copies through the pool (see
+  // Note [MPS CPU staging buffer pool]). The source bytes are captured in the
+  // staging buffer up front, so this works for non-blocking copies too; the
+  // buffer is returned to the pool once the blit's command buffer completes.
+  if (size_to_copy > 0 && size_to_copy <= kMaxStagingCopySize) {
+    @autoreleasepool {
+      auto& stagingPool = MPSStagingBufferPool::getInstance();
+      id<MTLBuffer> stagingBuffer = stagingPool.acquire(size_to_copy);
+      memcpy([stagingBuffer contents], host_src, size_to_copy);
+      uint64_t profile_id = getMPSProfiler().beginProfileCopy(stagingBuffer, destBuffer,
+                                src, dst, size_to_copy, non_blocking);
+      if (non_blocking) {
+        // Added before the blit is committed so the handler runs on the same
+        // command buffer.
+        stream->addCompletedHandler(^(id<MTLCommandBuffer> commandBuffer) {
+          MPSStagingBufferPool::getInstance().release(stagingBuffer);
+        });
+      }
+      stream->copy_and_sync(stagingBuffer, destBuffer, size_to_copy, 0,
+                            dst_byte_offset, non_blocking, profile_id);
+      if (!non_blocking) {
+        stagingPool.release(stagingBuffer);
+      }
+    }
+    return;
+  }
+
   @autoreleasepool {
     MTLResourceOptions options = MTLResourceOptionCPUCacheModeDefault | MTLResourceStorageModeShared;
     NSUInteger alignedLength = 0;
@@ -21,6 +21,29 @@ struct RandomCachedGraph : public MPSCachedGraph
   MPSGraphTensor *meanTensor = nil, *stdTensor = nil;
 };
 
+// Builds the Philox state tensor data fed to the graph for one launch, with a
+// counter range of `increment` values reserved from the generator so that
+// back-to-back random ops no longer serialize on per-call engine updates.
+// See Note [MPS batched Philox offsets] in MPSGeneratorImpl.mm.
+static MPSGraphTensorData* getPhiloxStateTensorData(MPSGeneratorImpl* mps_gen, uint64_t increment, MPSStream* stream) {
+  MPSNDArrayDescriptor *stateDesc = [MPSNDArrayDescriptor descriptorWithDataType: MPSDataTypeInt32 shape: @[@(at::mps::detail::PHILOX_STATE_N)]];
+  MPSNDArray *stateNDArray = [[[MPSNDArray alloc] initWithDevice: stream->device() descriptor: stateDesc] autorelease];
+  std::array<uint32_t, at::mps::detail::PHILOX_STATE_N> state{1};
+  uint64_t seed = 0, offset = 0;
+  {
+    // See Note [Acquire lock when using random generators]
+    std::lock_guard<std::mutex> lock(mps_gen->mutex_);
+    std::tie(seed, offset) = mps_gen->philox_engine_inputs(increment);
+  }
+  // state layout matches MPSGeneratorImpl: [1], counters, and the two key words
+  state[1] = static_cast<uint32_t>(offset);
+  state[2] = static_cast<uint32_t>(offset >> 32);
+  state[5] = static_cast<uint32_t>(seed);
+  state[6] = static_cast<uint32_t>(seed >> 32);
+  [stateNDArray writeBytes: state.data() strideBytes: nil];
+  return [[[MPSGraphTensorData alloc] initWithMPSNDArray: stateNDArray] autorelease];
+}
+
 typedef MPSGraphTensor* (^RandomOpBlock)(RandomCachedGraph*, MPSGraphTensor*);
 #define RandomOpFn(graph, randomTensor) MPSGraphTensor* (mps::RandomCachedGraph* graph, MPSGraphTensor* randomTensor)
 
@@ -93,17 +116,8 @@ Tensor& random_mps_impl(Tensor& self, scalar_t val1, scalar_t val2,
         return newCachedGraph;
       });
     }
-    // feed the updated state values to the graph
-    MPSNDArrayDescriptor *stateDesc = [MPSNDArrayDescriptor descriptorWithDataType: MPSDataTypeInt32 shape: @[@(at::mps::detail::PHILOX_STATE_N)]];
-    MPSNDArray *stateNDArray = [[[MPSNDArray alloc] initWithDevice: stream->device() descriptor: stateDesc] autorelease];
-    {
-      // See Note [Acquire lock when using random generators]
-      std::lock_guard<std::mutex> lock(mps_gen->mutex_);
-      // update the Philox state values on each run
-      mps_gen->update_philox_counters();
-      [stateNDArray writeBytes: mps_gen->state_data() strideBytes: nil];
-    }
-    MPSGraphTensorData* stateTensorData = [[[MPSGraphTensorData alloc] initWithMPSNDArray: stateNDArray] autorelease];
+    // feed the state values with a freshly reserved counter range to the graph
+    MPSGraphTensorData* stateTensorData = getPhiloxStateTensorData(mps_gen, self.numel(), stream);
 
     Placeholder meanPlaceholder, stdPlaceholder;
     NSMutableDictionary *feeds = [[NSMutableDictionary new] autorelease];
@@ -508,17 +522,9 @@ Tensor& multinomial_with_replacement_mps_kernel(
         return newCachedGraph;
      });
     }
-    // update the Philox state values on each run of the same graph
-    MPSNDArrayDescriptor *stateDesc = [MPSNDArrayDescriptor descriptorWithDataType: MPSDataTypeInt32 shape: @[@(at::mps::detail::PHILOX_STATE_N)]];
-    MPSNDArray *stateNDArray = [[[MPSNDArray alloc] initWithDevice: stream->device() descriptor: stateDesc] autorelease];
-    {
-      // See Note [Acquire lock when using random generators]
-      std::lock_guard<std::mutex> lock(mps_gen->mutex_);
-      // update the Philox state values on each run
-      mps_gen->update_philox_counters();
-      [stateNDArray writeBytes: mps_gen->state_data() strideBytes: nil];
-    }
-    MPSGraphTensorData* stateTensorData = [[[MPSGraphTensorData alloc] initWithMPSNDArray: stateNDArray] autorelease];
+    // feed the state values with a freshly reserved counter range to the graph
+    MPSGraphTensorData* stateTensorData = getPhiloxStateTensorData(
+        mps_gen, static_cast<uint64_t>(numDist) * n_sample, stream);
 
     auto probPlaceholder = Placeholder(cachedGraph->probTensor, self_v);
     auto outputPlaceholder = Placeholder(cachedGraph->resultTensor, result_v);
@@ -143,6 +143,91 @@ bool dispatchIndexKernel(TensorIteratorBase& iter,
   return true;
 }
 
+// Note [MPS dim-wise indexing kernels]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Dim-wise indexing ops (index_select, gather, scatter) and boolean masking
+// were originally implemented by building an MPSGraph network per shape.
+// Graph construction, the shape-keyed cache lookup and graph execution
+// overhead dominate on the small tensors these ops typically see, so for the
+// common contiguous case we dispatch the hand-written Metal kernels from
+// IndexKernels.h instead (the same library the advanced-indexing kernels
+// above come from). The kernels are templated on element bit-size only and
+// move raw bytes, so every MPS dtype is covered. Callers fall back to the
+// MPSGraph path whenever a fast-path precondition does not hold.
+static void dispatchIndexSelectDimKernel(const Tensor& self,
+                                         int64_t dim,
+                                         const Tensor& index,
+                                         Tensor& output) {
+  using namespace mps;
+  const uint32_t numThreads = output.numel();
+  uint32_t innerSize = 1;
+  for (const auto i: c10::irange(dim + 1, self.dim())) {
+    innerSize *= self.size(i);
+  }
+  const uint32_t dimSize = self.size(dim);
+  const uint32_t numIndices = index.numel();
+  MPSStream* mpsStream = getCurrentMPSStream();
+  dispatch_sync(mpsStream->queue(), ^(){
+    @autoreleasepool {
+      const std::string kernel = "index_select_dim_" + getBitSizeString(self.scalar_type()) +
+          (index.scalar_type() == ScalarType::Long ? "_idx64" : "_idx32");
+      id<MTLComputePipelineState> pso = MPSDevice::getInstance()->metalIndexingFunction(kernel);
+      id<MTLComputeCommandEncoder> computeEncoder = mpsStream->commandEncoder();
+      // this function call is a no-op if MPS Profiler is not enabled
+      getMPSProfiler().beginProfileKernel(pso, kernel, {self, index});
+
+      [computeEncoder setComputePipelineState:pso];
+      [computeEncoder setBuffer:getMTLBufferStorage(self) offset:self.storage_offset() * self.element_size() atIndex:0];
+      [computeEncoder setBuffer:getMTLBufferStorage(output) offset:output.storage_offset() * output.element_size() atIndex:1];
+      [computeEncoder setBuffer:getMTLBufferStorage(index) offset:index.storage_offset() * index.element_size() atIndex:2];
+      [computeEncoder setBytes:&dimSize length:sizeof(uint32_t) atIndex:3];
+      [computeEncoder setBytes:&innerSize length:sizeof(uint32_t) atIndex:4];
+      [computeEncoder setBytes:&numIndices length:sizeof(uint32_t) atIndex:5];
+
+      NSUInteger tgSize = pso.maxTotalThreadsPerThreadgroup;
+      if (tgSize > numThreads) {
+          tgSize = numThreads;
+      }
+      [computeEncoder dispatchThreads: MTLSizeMake(numThreads, 1, 1)
+                threadsPerThreadgroup: MTLSizeMake(tgSize, 1, 1)];
+      mpsStream->commitAdaptive({self, index, output}, pso);
+    }
+  });
+}
+
+// see Note [MPS dim-wise indexing kernels]
+static void dispatchMaskedFillScalarKernel(Tensor& self, const Tensor& mask, const Scalar& value) {
+  using namespace mps;
+  const uint32_t numThreads = self.numel();
+  MPSScalar valueScalar = getMPSScalar(value, self.scalar_type());
+  // MPSScalar is not copyable (it may own a buffer), so copy the raw value
+  // out before it is captured by the block
+  const auto rawValue = valueScalar.value;
+  MPSStream* mpsStream = getCurrentMPSStream();
+  dispatch_sync(mpsStream->queue(), ^(){
+    @autoreleasepool {
+      const std::string kernel = "masked_fill_scalar_" + getBitSizeString(self.scalar_type());
+      id<MTLComputePipelineState> pso = MPSDevice::getInstance()->metalIndexingFunction(kernel);
+      id<MTLComputeCommandEncoder> computeEncoder = mpsStream->commandEncoder();
+      // this function call is a no-op if MPS Profiler is not enabled
+      getMPSProfiler().beginProfileKernel(pso, kernel, {self, mask});
+
+      [computeEncoder setComputePipelineState:pso];
+      [computeEncoder setBuffer:getMTLBufferStorage(self) offset:self.storage_offset() * self.element_size() atIndex:0];
+      [computeEncoder setBuffer:getMTLBufferStorage(mask) offset:mask.storage_offset() * mask.element_size() atIndex:1];
+      [computeEncoder setBytes:&rawValue length:self.element_size() atIndex:2];
+
+      NSUInteger tgSize = pso.maxTotalThreadsPerThreadgroup;
+      if (tgSize > numThreads) {
+          tgSize = numThreads;
+      }
+      [computeEncoder dispatchThreads: MTLSizeMake(numThreads, 1, 1)
+                threadsPerThreadgroup: MTLSizeMake(tgSize, 1, 1)];
+      mpsStream->commitAdaptive({self, mask}, pso);
+    }
+  });
+}
+
 static void validateInputData(const TensorIteratorBase& iter, IntArrayRef index_size, IntArrayRef index_stride, const std::string& op, bool accumulate) {
   using namespace mps;
 
@@ -655,6 +740,15 @@ Tensor& index_select_out_mps(const Tensor & self,
     return output;
   }
 
+  // see Note [MPS dim-wise indexing kernels]
+  if (self.is_contiguous() && output.is_contiguous() && index.is_contiguous() &&
+      self.size(dim) > 0 && output.numel() > 0 &&
+      output.numel() == (self.numel() / self.size(dim)) * index.numel() &&
+      self.numel() <= UINT32_MAX && output.numel() <= UINT32_MAX) {
+    dispatchIndexSelectDimKernel(self, dim, index, output);
+    return output;
+  }
+
   // Derive from MPSCachedGraph
   struct CachedGraph : public MPSCachedGraph
   {
@@ -741,6 +835,14 @@ Tensor & masked_fill__mps(Tensor& self, const Tensor & mask, const Scalar& value
 
   c10::MaybeOwned<Tensor> b_mask = expand_inplace(self, mask, "masked_fill_");
 
+  // see Note [MPS dim-wise indexing kernels]
+  if (self.is_contiguous() && b_mask->is_contiguous() &&
+      mask.scalar_type() == kBool && self.numel() <= UINT32_MAX) {
+    dispatchMaskedFillScalarKernel(self, *b_mask, value);
+    namedinference::propagate_names_if_nonempty(self, maybe_outnames);
+    return self;
+  }
+
   struct CachedGraph : public MPSCachedGraph
   {
     CachedGraph(MPSGraph *graph) : MPSCachedGraph(graph) {}
@@ -1,9 +1,63 @@
 //  Copyright © 2022 Apple Inc.
 
+#include <ATen/mps/MPSProfiler.h>
 #include <ATen/native/mps/OperationUtils.h>
+#include <ATen/native/mps/operations/Indexing.h>
 
 namespace at::native {
 
+// Dispatches the hand-written gather_dim/scatter_dim Metal kernels from
+// IndexKernels.h; see Note [MPS dim-wise indexing kernels] in Indexing.mm.
+// `iter_sizes` is the index tensor's shape; for gather `strides` belongs to
+// the (read) src tensor, for scatter to the (written) dst tensor.
+static void dispatchGatherScatterDimKernel(const Tensor& src,
+                                           const Tensor& dst,
+                                           int64_t dim,
+                                           const Tensor& index,
+                                           bool scatter) {
+  using namespace mps;
+  const uint32_t numThreads = index.numel();
+  const uint32_t numDims = index.dim();
+  const uint32_t dim32 = dim;
+  const uint32_t dimSize = scatter ? dst.size(dim) : src.size(dim);
+  const Tensor& stridedTensor = scatter ? dst : src;
+  std::vector<uint32_t> iterSizes(numDims);
+  std::vector<uint32_t> strides(numDims);
+  for (const auto i: c10::irange(numDims)) {
+    iterSizes[i] = index.size(i);
+    strides[i] = stridedTensor.stride(i);
+  }
+  MPSStream* mpsStream = getCurrentMPSStream();
+  dispatch_sync(mpsStream->queue(), ^(){
+    @autoreleasepool {
+      const std::string kernel = (scatter ? "scatter_dim_" : "gather_dim_") +
+          getBitSizeString(src.scalar_type());
+      id<MTLComputePipelineState> pso = MPSDevice::getInstance()->metalIndexingFunction(kernel);
+      id<MTLComputeCommandEncoder> computeEncoder = mpsStream->commandEncoder();
+      // this function call is a no-op if MPS Profiler is not enabled
+      getMPSProfiler().beginProfileKernel(pso, kernel, {src, index});
+
+      [computeEncoder setComputePipelineState:pso];
+      [computeEncoder setBuffer:getMTLBufferStorage(src) offset:src.storage_offset() * src.element_size() atIndex:0];
+      [computeEncoder setBuffer:getMTLBufferStorage(dst) offset:dst.storage_offset() * dst.element_size() atIndex:1];
+      [computeEncoder setBuffer:getMTLBufferStorage(index) offset:index.storage_offset() * index.element_size() atIndex:2];
+      [computeEncoder setBytes:iterSizes.data() length:sizeof(uint32_t) * numDims atIndex:3];
+      [computeEncoder setBytes:strides.data() length:sizeof(uint32_t) * numDims atIndex:4];
+      [computeEncoder setBytes:&numDims length:sizeof(uint32_t) atIndex:5];
+      [computeEncoder setBytes:&dim32 length:sizeof(uint32_t) atIndex:6];
+      [computeEncoder setBytes:&dimSize length:sizeof(uint32_t) atIndex:7];
+
+      NSUInteger tgSize = pso.maxTotalThreadsPerThreadgroup;
+      if (tgSize > numThreads) {
+          tgSize = numThreads;
+      }
+      [computeEncoder dispatchThreads: MTLSizeMake(numThreads, 1, 1)
+                threadsPerThreadgroup: MTLSizeMake(tgSize, 1, 1)];
+      mpsStream->commitAdaptive({src, index, dst}, pso);
+    }
+  });
+}
+
 TORCH_IMPL_FUNC(gather_out_mps)
 (const Tensor & self_arg,
  int64_t dim,
@@ -25,6 +79,14 @@ TORCH_IMPL_FUNC(gather_out_mps)
   TORCH_CHECK(dim >= 0 && dim < self.dim(),
               "gather(): Indexing dim ", dim, " is out of bounds of tensor");
 
+  // see Note [MPS dim-wise indexing kernels] in Indexing.mm
+  if (self.is_contiguous() && index.is_contiguous() && output.is_contiguous() &&
+      self.dim() == index.dim() && index.scalar_type() == ScalarType::Long &&
+      self.numel() <= UINT32_MAX && index.numel() <= UINT32_MAX) {
+    dispatchGatherScatterDimKernel(self, output, dim, index, /*scatter=*/false);
+    return;
+  }
+
   struct CachedGraph : public MPSCachedGraph
   {
     CachedGraph(MPSGraph *graph) : MPSCachedGraph(graph) {}
@@ -154,6 +216,23 @@ void scatter_mps_general
   TORCH_CHECK(dim >= 0 && dim < self.dim(),
               "scatter(): Indexing dim ", dim, " is out of bounds of tensor");
 
+  // see Note [MPS dim-wise indexing kernels] in Indexing.mm. Only the plain
+  // "set" mode maps onto the byte-moving scatter_dim kernel; the reduction
+  // modes stay on MPSGraph.
+  if (reduce == "set" &&
+      self.is_contiguous() && index.is_contiguous() && src.is_contiguous() &&
+      output.is_contiguous() &&
+      self.dim() == index.dim() && index.dim() == src.dim() &&
+      index.sizes().equals(src.sizes()) &&
+      index.scalar_type() == ScalarType::Long &&
+      output.numel() <= UINT32_MAX && index.numel() <= UINT32_MAX) {
+    if (!output.is_same(self)) {
+      output.copy_(self);
+    }
+    dispatchGatherScatterDimKernel(src, output, dim, index, /*scatter=*/true);
+    return;
+  }
+
   struct CachedGraph : public MPSCachedGraph
   {
     CachedGraph(MPSGraph *graph) : MPSCachedGraph(graph) {}
@@ -10,10 +10,15 @@
 #include <ATen/TensorOperators.h>
 #include <ATen/TensorUtils.h>
 #include <ATen/core/Tensor.h>
+#include <ATen/native/CPUBlas.h>
 #include <ATen/native/layer_norm.h>
 #include <ATen/native/nested/NestedTensorUtils.h>
 
+#include <algorithm>
+#include <array>
+#include <map>
 #include <tuple>
+#include <vector>
 
 namespace at {
 namespace native {
@@ -48,6 +53,7 @@ Tensor bmm_nested(const Tensor& self, const Tensor& mat2) {
   const Tensor& self_sizemat = self_ptr->get_nested_size_tensor();
   Tensor out_sizemat = self_sizemat.new_empty(self_sizemat.sizes());
   int64_t* out_sizemat_ptr = out_sizemat.data_ptr<int64_t>();
+  std::vector<int64_t> out_offsets(ntensors);
   for (int64_t i = 0; i < ntensors; i++) {
     const IntArrayRef& self_shape = self_sizes[i],
         & mat2_shape = mat2_sizes[i];
@@ -60,10 +66,94 @@ Tensor bmm_nested(const Tensor& self, const Tensor& mat2) {
     out_sizemat_ptr[0] = self_size0;
     out_sizemat_ptr[1] = mat2_size1;
     out_sizemat_ptr += 2;
+    out_offsets[i] = out_numel;
     out_numel += self_size0 * mat2_size1;
   }
   Tensor out_buffer = self_buffer.new_empty(out_numel);
   Tensor output = wrap_buffer(out_buffer, out_sizemat);
+  const auto dtype = self_buffer.scalar_type();
+  if (self_buffer.device().is_cpu() && (dtype == kFloat || dtype == kDouble)) {
+    // Jagged batches usually contain many segments with equal problem
+    // shapes, so instead of dispatching one mm per segment, group segments
+    // by gemm shape and issue one cpublas::gemm_batched call per group
+    // (MKL's batched gemm when available, a batch-parallel loop otherwise).
+    // Segments whose layout BLAS cannot consume directly, and segments with
+    // an empty contraction dimension (which must zero their output), fall
+    // back to mm below.
+    std::vector<int64_t> fallback;
+    // group key, in gemm terms: (m, k, n, lda, ldb, transa, transb)
+    std::map<std::array<int64_t, 7>, std::vector<int64_t>> groups;
+    for (int64_t i = 0; i < ntensors; i++) {
+      const int64_t m = self_sizes[i][0], k = self_sizes[i][1],
+          n = mat2_sizes[i][1];
+      if (m == 0 || n == 0) {
+        // empty output segment, nothing to compute
+        continue;
+      }
+      if (k == 0) {
+        fallback.push_back(i);
+        continue;
+      }
+      const bool self_rm = self_strides[i][1] == 1 &&
+          self_strides[i][0] >= std::max<int64_t>(1, k);
+      const bool self_cm = self_strides[i][0] == 1 &&
+          self_strides[i][1] >= std::max<int64_t>(1, m);
+      const bool mat2_rm = mat2_strides[i][1] == 1 &&
+          mat2_strides[i][0] >= std::max<int64_t>(1, n);
+      const bool mat2_cm = mat2_strides[i][0] == 1 &&
+          mat2_strides[i][1] >= std::max<int64_t>(1, k);
+      if ((!self_rm && !self_cm) || (!mat2_rm && !mat2_cm)) {
+        fallback.push_back(i);
+        continue;
+      }
+      const int64_t lda = mat2_rm ? mat2_strides[i][0] : mat2_strides[i][1];
+      const int64_t ldb = self_rm ? self_strides[i][0] : self_strides[i][1];
+      groups[{m, k, n, lda, ldb,
+              mat2_rm ? int64_t{0} : int64_t{1},
+              self_rm ? int64_t{0} : int64_t{1}}].push_back(i);
+    }
+    AT_DISPATCH_FLOATING_TYPES(dtype, "bmm_nested", [&] {
+      const scalar_t* self_data = self_buffer.data_ptr<scalar_t>();
+      const scalar_t* mat2_data = mat2_buffer.data_ptr<scalar_t>();
+      scalar_t* out_data = out_buffer.data_ptr<scalar_t>();
+      std::vector<const scalar_t*> a_ptrs, b_ptrs;
+      std::vector<scalar_t*> c_ptrs;
+      for (const auto& group : groups) {
+        const auto& key = group.first;
+        const auto& idxs = group.second;
+        a_ptrs.clear();
+        b_ptrs.clear();
+        c_ptrs.clear();
+        for (const auto i : idxs) {
+          a_ptrs.push_back(mat2_data + mat2_offsets[i]);
+          b_ptrs.push_back(self_data + self_offsets[i]);
+          c_ptrs.push_back(out_data + out_offsets[i]);
+        }
+        // gemm expects fortran-order matrices, so compute
+        // out^T = mat2^T * self^T by swapping the argument order,
+        // as baddbmm_with_gemm_ does.
+        at::native::cpublas::gemm_batched(
+            key[5] != 0 ? TransposeType::Transpose : TransposeType::NoTranspose,
+            key[6] != 0 ? TransposeType::Transpose : TransposeType::NoTranspose,
+            static_cast<int64_t>(idxs.size()),
+            /*m=*/key[2], /*n=*/key[0], /*k=*/key[1],
+            scalar_t(1),
+            a_ptrs.data(), key[3],
+            b_ptrs.data(), key[4],
+            scalar_t(0),
+            c_ptrs.data(), /*ldc=*/key[2]);
+      }
+    });
+    if (!fallback.empty()) {
+      std::vector<Tensor> output_unbind = output.unbind();
+      for (const auto i : fallback) {
+        at::mm_out(output_unbind[i],
+                   self_buffer.as_strided(self_sizes[i], self_strides[i], self_offsets[i]),
+                   mat2_buffer.as_strided(mat2_sizes[i], mat2_strides[i], mat2_offsets[i]));
+      }
+    }
+    return output;
+  }
   // call tensor mm
   // TODO: `padding nested tensor -> bmm -> remove padding` may be more efficient
   //       until we have specialized nested tensor bmm kernel
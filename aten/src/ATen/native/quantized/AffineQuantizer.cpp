@@ -41,6 +41,18 @@ void checkFloatTensor(const std::string& fn_name, const Tensor& t) {
       t.scalar_type());
 }
 
+// Per-tensor quantization also accepts reduced-precision float sources,
+// which the CPU kernels widen in-register instead of requiring callers to
+// materialize an fp32 copy first.
+void checkQuantizeSourceTensor(const std::string& fn_name, const Tensor& t) {
+  TORCH_CHECK(
+      t.scalar_type() == kFloat || t.scalar_type() == kHalf ||
+          t.scalar_type() == kBFloat16,
+      fn_name,
+      " expects a Float, Half or BFloat16 Tensor, got ",
+      t.scalar_type());
+}
+
 void checkSameDevice(
     const std::string& fn_name,
     const Tensor& t1,
@@ -122,7 +134,7 @@ Tensor& quantize_tensor_per_tensor_affine(
   static constexpr auto fn_name = "quantize_tensor_per_tensor_affine";
 
   checkRoundingMode(fn_name);
-  checkFloatTensor(fn_name, rtensor);
+  checkQuantizeSourceTensor(fn_name, rtensor);
   checkSameDevice(fn_name, rtensor, qtensor);
   checkSameSize(fn_name, qtensor, rtensor);
 
@@ -132,14 +144,25 @@ Tensor& quantize_tensor_per_tensor_affine(
     checkZeroPoint<underlying_t>(fn_name, zero_point);
   });
 
+  const bool is_sub_byte =
+      qtensor.scalar_type() == at::ScalarType::QUInt4x2 ||
+      qtensor.scalar_type() == at::ScalarType::QUInt2x4;
+  // Only the CPU byte-sized kernels consume bf16/fp16 sources directly;
+  // the other backends still get an fp32 view of the data.
+  Tensor rtensor_ = rtensor;
+  if (rtensor.scalar_type() != kFloat &&
+      (rtensor.device().type() != DeviceType::CPU || is_sub_byte)) {
+    rtensor_ = rtensor.to(kFloat);
+  }
+
   // Temporary solution to pack the tensor if dtype is torch.quint4x2
   // Can move this into the fbgemm::Quantize op.
-  if (qtensor.scalar_type() == at::ScalarType::QUInt4x2 || qtensor.scalar_type() == at::ScalarType::QUInt2x4) {
+  if (is_sub_byte) {
     quantize_tensor_per_tensor_affine_sub_byte_stub(
-        rtensor.device().type(), rtensor, qtensor, scale, zero_point);
+        rtensor_.device().type(), rtensor_, qtensor, scale, zero_point);
   } else {
     quantize_tensor_per_tensor_affine_stub(
-        rtensor.device().type(), rtensor, qtensor, scale, zero_point);
+        rtensor_.device().type(), rtensor_, qtensor, scale, zero_point);
   }
   return qtensor;
 }
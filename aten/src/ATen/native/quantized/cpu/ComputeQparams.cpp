@@ -0,0 +1,228 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/TensorIterator.h>
+#include <ATen/native/quantized/cpu/ComputeQparams.h>
+#include <c10/util/irange.h>
+#include <limits>
+#include <numeric>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_compute_qparams_per_channel_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+#ifdef USE_FBGEMM
+#include <fbgemm/QuantUtils.h>
+#endif
+#include <ATen/native/quantized/cpu/QuantUtils.h>
+
+namespace at {
+namespace native {
+
+namespace {
+
+template <typename zero_point_t>
+inline void choose_qparams_for_channel(
+    float x_min,
+    float x_max,
+    int32_t quant_min,
+    int32_t quant_max,
+    bool preserve_sparsity,
+    float* scale_out,
+    zero_point_t* zero_point_out) {
+#ifdef USE_FBGEMM
+  const auto qparams = fbgemm::ChooseQuantizationParams(
+      x_min,
+      x_max,
+      quant_min,
+      quant_max,
+      preserve_sparsity,
+      false /* force_scale_power_of_two */);
+#else
+  const auto qparams = quant_utils::ChooseQuantizationParams(
+      x_min,
+      x_max,
+      quant_min,
+      quant_max,
+      preserve_sparsity,
+      false /* force_scale_power_of_two */);
+#endif
+  *scale_out = qparams.scale;
+  *zero_point_out = static_cast<zero_point_t>(qparams.zero_point);
+}
+
+std::pair<float, float> row_min_max(const float* x, int64_t size) {
+  using Vec = vec::Vectorized<float>;
+  float min_val = std::numeric_limits<float>::infinity();
+  float max_val = -std::numeric_limits<float>::infinity();
+  int64_t d = 0;
+  if (size >= Vec::size()) {
+    Vec vmin = Vec::loadu(x);
+    Vec vmax = vmin;
+    for (d = Vec::size(); d + Vec::size() <= size; d += Vec::size()) {
+      Vec v = Vec::loadu(x + d);
+      vmin = vec::minimum(vmin, v);
+      vmax = vec::maximum(vmax, v);
+    }
+    min_val = vec::vec_reduce_all<float>(
+        [](Vec& a, Vec& b) { return vec::minimum(a, b); }, vmin);
+    max_val = vec::vec_reduce_all<float>(
+        [](Vec& a, Vec& b) { return vec::maximum(a, b); }, vmax);
+  }
+  for (; d < size; d++) {
+    min_val = std::min(min_val, x[d]);
+    max_val = std::max(max_val, x[d]);
+  }
+  return {min_val, max_val};
+}
+
+} // namespace
+
+template <typename zero_point_t>
+void compute_qparams_from_minmax(
+    const float* x_min,
+    const float* x_max,
+    float* scale,
+    zero_point_t* zero_point,
+    int64_t num_channels,
+    int32_t quant_min,
+    int32_t quant_max,
+    bool preserve_sparsity) {
+  at::parallel_for(
+      0,
+      num_channels,
+      at::internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+        for (const auto c : c10::irange(begin, end)) {
+          choose_qparams_for_channel(
+              x_min[c],
+              x_max[c],
+              quant_min,
+              quant_max,
+              preserve_sparsity,
+              scale + c,
+              zero_point + c);
+        }
+      });
+}
+
+template void compute_qparams_from_minmax<float>(
+    const float*,
+    const float*,
+    float*,
+    float*,
+    int64_t,
+    int32_t,
+    int32_t,
+    bool);
+template void compute_qparams_from_minmax<int32_t>(
+    const float*,
+    const float*,
+    float*,
+    int32_t*,
+    int64_t,
+    int32_t,
+    int32_t,
+    bool);
+template void compute_qparams_from_minmax<int64_t>(
+    const float*,
+    const float*,
+    float*,
+    int64_t*,
+    int64_t,
+    int32_t,
+    int32_t,
+    bool);
+
+/* Fused per-channel observer reduction.
+
+A single parallel sweep over the input produces the per-channel min and max
+(vectorized) together with the affine scale and zero_point derived from
+them, instead of a generic aminmax reduction followed by a per-channel loop
+of tensor indexing ops.
+
+Args:
+  self: float input tensor.
+  axis: channel axis to compute parameters over.
+  quant_min, quant_max: bounds of the quantized range.
+  preserve_sparsity: symmetric quantization, keeps 0 exactly representable.
+Returns:
+  (min, max, scale, zero_point), each of shape [self.size(axis)].
+*/
+std::tuple<Tensor, Tensor, Tensor, Tensor> compute_qparams_per_channel_cpu(
+    const Tensor& self,
+    int64_t axis,
+    int64_t quant_min,
+    int64_t quant_max,
+    bool preserve_sparsity) {
+  TORCH_CHECK(
+      self.scalar_type() == ScalarType::Float,
+      "_compute_qparams_per_channel expects a Float tensor, found ",
+      self.scalar_type());
+  TORCH_CHECK(
+      axis >= 0 && axis < self.dim(),
+      "`axis` must be between 0 and number of dimensions of input");
+  TORCH_CHECK(
+      quant_min < quant_max,
+      "`quant_min` should be less than `quant_max`.");
+  TORCH_CHECK(
+      self.numel() > 0,
+      "_compute_qparams_per_channel expects a non-empty input tensor");
+
+  // Flatten to [C, elements_per_channel] with the channel axis leading,
+  // the same normalization fused_moving_avg_obs_fake_quant_cpu performs.
+  at::Tensor y = self;
+  if (self.dim() != 2 || axis != 0) {
+    auto res = DimVector(self.sizes());
+    std::iota(res.begin(), res.end(), 0);
+    res[axis] = 0;
+    res[0] = axis;
+    y = self.permute(res).flatten(1);
+  }
+  y = y.contiguous();
+
+  const int64_t num_channels = self.size(axis);
+  const int64_t elements_per_channel = y.numel() / num_channels;
+
+  auto x_min = at::empty({num_channels}, self.options());
+  auto x_max = at::empty({num_channels}, self.options());
+  auto scale = at::empty({num_channels}, self.options().dtype(at::kFloat));
+  auto zero_point = at::empty({num_channels}, self.options().dtype(at::kInt));
+
+  const float* x_data = y.data_ptr<float>();
+  float* min_data = x_min.data_ptr<float>();
+  float* max_data = x_max.data_ptr<float>();
+  float* scale_data = scale.data_ptr<float>();
+  int32_t* zero_point_data = zero_point.data_ptr<int32_t>();
+
+  const int64_t grain_size = std::max(
+      (int64_t)1, at::internal::GRAIN_SIZE / elements_per_channel);
+  at::parallel_for(
+      0, num_channels, grain_size, [&](int64_t begin, int64_t end) {
+        for (const auto c : c10::irange(begin, end)) {
+          const auto min_max =
+              row_min_max(x_data + c * elements_per_channel, elements_per_channel);
+          min_data[c] = min_max.first;
+          max_data[c] = min_max.second;
+          choose_qparams_for_channel(
+              min_max.first,
+              min_max.second,
+              static_cast<int32_t>(quant_min),
+              static_cast<int32_t>(quant_max),
+              preserve_sparsity,
+              scale_data + c,
+              zero_point_data + c);
+        }
+      });
+
+  return std::make_tuple(x_min, x_max, scale, zero_point);
+}
+
+} // namespace native
+} // namespace at
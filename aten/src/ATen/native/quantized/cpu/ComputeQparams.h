@@ -0,0 +1,26 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+#include <cstdint>
+
+namespace at {
+namespace native {
+
+// Computes affine quantization parameters for every channel from
+// pre-reduced per-channel min/max values in one parallel sweep, writing
+// through raw pointers. Shared between the `_compute_qparams_per_channel`
+// op and the fused observer path; instantiated for float, int32_t and
+// int64_t zero_point storage.
+template <typename zero_point_t>
+TORCH_API void compute_qparams_from_minmax(
+    const float* x_min,
+    const float* x_max,
+    float* scale,
+    zero_point_t* zero_point,
+    int64_t num_channels,
+    int32_t quant_min,
+    int32_t quant_max,
+    bool preserve_sparsity);
+
+} // namespace native
+} // namespace at
@@ -410,7 +410,15 @@ static bool should_use_onednn_quant(
       is_weight_symmetric_quant(weight, is_transposed_conv);
   bool opad_all_zero =
       std::all_of(output_padding.begin(), output_padding.end(), [](int i) { return i==0; });
-  return vnni_available && (groups <= 100) && w_sym_quant && opad_all_zero;
+  // Depthwise convolutions carry one group per channel, so the group cap
+  // below would always route them to fbgemm, whose specialized depthwise
+  // kernels only cover a few geometries (e.g. not stride-2 5x5). onednn
+  // JITs VNNI NHWC depthwise kernels for arbitrary stride/kernel
+  // combinations, so prefer it whenever the weight is depthwise.
+  bool is_depthwise = !is_transposed_conv && weight.dim() >= 3 &&
+      groups > 1 && weight.size(1) == 1;
+  return vnni_available && (is_depthwise || groups <= 100) && w_sym_quant &&
+      opad_all_zero;
 #endif
 }
 
@@ -22,6 +22,7 @@
 #ifdef USE_FBGEMM
 #include <fbgemm/QuantUtils.h>
 #endif
+#include <ATen/native/quantized/cpu/ComputeQparams.h>
 #include <ATen/native/quantized/cpu/QuantUtils.h>
 
 namespace {
@@ -74,7 +75,28 @@ std::tuple<at::Tensor, at::Tensor> choose_qparams_fake_quant(
   if (per_row_fake_quant) {
     float* x_min_data = inp_running_min.data_ptr<float>();
     float* x_max_data = inp_running_max.data_ptr<float>();
-    for (const auto i : c10::irange(inp_running_min.numel())) {
+    const int64_t num_channels = inp_running_min.numel();
+    // Single sweep writing scale/zero_point through raw pointers; the
+    // per-element Tensor indexing below dispatches a full op per channel,
+    // which dominated observer time for wide layers. The indexing loop
+    // stays as the fallback for qparam dtypes the helper is not
+    // instantiated for.
+    if (scale.is_contiguous() && zero_point.is_contiguous() &&
+        scale.scalar_type() == at::kFloat &&
+        zero_point.scalar_type() == at::kInt) {
+      at::native::compute_qparams_from_minmax(
+          x_min_data,
+          x_max_data,
+          scale.data_ptr<float>(),
+          zero_point.data_ptr<int32_t>(),
+          num_channels,
+          qmin,
+          qmax,
+          symmetric_quant);
+      return at::fake_quantize_per_channel_affine_cachemask(
+          x, scale, zero_point, ch_axis, qmin, qmax);
+    }
+    for (const auto i : c10::irange(num_channels)) {
 #ifdef USE_FBGEMM
       fbgemm::TensorQuantizationParams x_qparams{};
       x_qparams = fbgemm::ChooseQuantizationParams(
@@ -3212,12 +3212,109 @@ void quantized_groupnorm_nhwc_kernel(
   }); // AT_DISPATCH_QINT_TYPES
 }
 
+// Fused single-pass quantization for reduced-precision float sources:
+// bf16/fp16 values are widened to fp32 in-register and fed straight into
+// the vectorized scale+round+clamp+pack, so mixed-precision pipelines do
+// not have to materialize an fp32 copy of the activation at the int8
+// hand-off boundary.
+template <typename scalar_t>
+void quantize_tensor_bfloat16_impl(
+    const c10::BFloat16* rdata,
+    scalar_t* qdata,
+    int64_t numel,
+    float scale,
+    int32_t zero_point) {
+  using bVec = Vectorized<c10::BFloat16>;
+  using fVec = Vectorized<float>;
+  using qVec = Vectorized<scalar_t>;
+  constexpr int kNumFloatVecs = qVec::float_num_vecs();
+  const float inv_scale = 1.0f / scale;
+  int64_t i = 0;
+  // A bf16 load widens into two float vectors, so the vectorized path needs
+  // an even number of float vectors per quantized vector; qint32 carries a
+  // single one and takes the scalar loop below instead.
+  if constexpr (kNumFloatVecs % 2 == 0) {
+    constexpr int64_t kBlock = kNumFloatVecs * fVec::size();
+    typename qVec::float_vec_return_type fvals;
+    for (; i + kBlock <= numel; i += kBlock) {
+      for (int j = 0; j < kNumFloatVecs; j += 2) {
+        const auto bvals = bVec::loadu(rdata + i + j * fVec::size());
+        std::tie(fvals[j], fvals[j + 1]) = convert_bfloat16_float(bvals);
+      }
+      qVec::quantize(fvals, scale, zero_point, inv_scale).store(qdata + i);
+    }
+  }
+  for (; i < numel; ++i) {
+    qdata[i] = at::native::quantize_val<scalar_t>(
+        scale, zero_point, static_cast<float>(rdata[i]));
+  }
+}
+
+template <typename scalar_t>
+void quantize_tensor_half_impl(
+    const c10::Half* rdata,
+    scalar_t* qdata,
+    int64_t numel,
+    float scale,
+    int32_t zero_point) {
+  // There is no x86 Vectorized<Half>; the scalar fp16 -> fp32 conversion
+  // still goes through the F16C unit where the build enables it, and the
+  // fused pass avoids the fp32 round-trip through memory.
+  for (const auto i : c10::irange(numel)) {
+    qdata[i] = at::native::quantize_val<scalar_t>(
+        scale, zero_point, static_cast<float>(rdata[i]));
+  }
+}
+
+void quantize_tensor_per_tensor_affine_reduced_float_cpu(
+    const Tensor& rtensor,
+    Tensor& qtensor,
+    double scale,
+    int64_t zero_point) {
+  check_tensor_memory_format(rtensor, qtensor);
+  const int64_t numel = rtensor.numel();
+  constexpr int64_t kParallelGrainSize = 1 << 16;
+  AT_DISPATCH_QINT_TYPES(
+      qtensor.scalar_type(), "quantize_tensor_per_tensor_affine_cpu", [&]() {
+        scalar_t* qdata = qtensor.data_ptr<scalar_t>();
+        if (rtensor.scalar_type() == at::ScalarType::BFloat16) {
+          const c10::BFloat16* rdata = rtensor.data_ptr<c10::BFloat16>();
+          at::parallel_for(
+              0, numel, kParallelGrainSize, [&](int64_t begin, int64_t end) {
+                quantize_tensor_bfloat16_impl<scalar_t>(
+                    rdata + begin,
+                    qdata + begin,
+                    end - begin,
+                    static_cast<float>(scale),
+                    static_cast<int32_t>(zero_point));
+              });
+        } else {
+          const c10::Half* rdata = rtensor.data_ptr<c10::Half>();
+          at::parallel_for(
+              0, numel, kParallelGrainSize, [&](int64_t begin, int64_t end) {
+                quantize_tensor_half_impl<scalar_t>(
+                    rdata + begin,
+                    qdata + begin,
+                    end - begin,
+                    static_cast<float>(scale),
+                    static_cast<int32_t>(zero_point));
+              });
+        }
+      });
+}
+
 #ifdef USE_FBGEMM
 void quantize_tensor_per_tensor_affine_cpu(
     const Tensor& rtensor,
     Tensor& qtensor,
     double scale,
     int64_t zero_point) {
+  if (rtensor.scalar_type() != at::ScalarType::Float) {
+    // fbgemm::Quantize only consumes fp32 sources.
+    quantize_tensor_per_tensor_affine_reduced_float_cpu(
+        rtensor, qtensor, scale, zero_point);
+    return;
+  }
   AT_DISPATCH_QINT_TYPES(
       qtensor.scalar_type(), "quantize_tensor_per_tensor_affine_cpu", [&]() {
         check_tensor_memory_format(rtensor, qtensor);
@@ -3552,6 +3649,11 @@ void quantize_tensor_per_tensor_affine_cpu(
     Tensor& qtensor,
     double scale,
     int64_t zero_point) {
+  if (rtensor.scalar_type() != at::ScalarType::Float) {
+    quantize_tensor_per_tensor_affine_reduced_float_cpu(
+        rtensor, qtensor, scale, zero_point);
+    return;
+  }
   check_tensor_memory_format(rtensor, qtensor);
   const float* rdata = rtensor.data_ptr<float>();
   int numel = rtensor.numel();
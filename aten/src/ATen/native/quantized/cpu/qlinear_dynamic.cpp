@@ -269,14 +269,26 @@ at::Tensor PackedLinearWeightsQnnp::apply_dynamic_impl(
   const float* bias_ptr = bias_contig.data_ptr<float>();
 
   // Calculate statistics for quantization of input Tensor
-  // TODO: optimized kernel
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   float x_min;
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   float x_max;
   if (input.numel() > 0) {
-    x_min = input_contig.min().item<float>();
-    x_max = input_contig.max().item<float>();
+#ifdef USE_FBGEMM
+    // Use FBGEMM's FindMinMax if available since it's faster
+    fbgemm::FindMinMax(
+        /*m=*/input_contig.data_ptr<float>(),
+        /*min=*/&x_min,
+        /*max=*/&x_max,
+        /*len=*/input.numel());
+#else
+    // A single fused sweep over the activation instead of separate
+    // min and max reductions.
+    Tensor t_min, t_max;
+    std::tie(t_min, t_max) = at::aminmax(input_contig);
+    x_min = t_min.item<float>();
+    x_max = t_max.item<float>();
+#endif
   } else {
     // On empty input, no output data will be generated,
     // so use arbitrary qparams.
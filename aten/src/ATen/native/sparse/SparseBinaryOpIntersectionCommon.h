@@ -7,6 +7,15 @@
 #include <ATen/ExpandUtils.h>
 #include <ATen/SparseTensorUtils.h>
 
+#ifndef GPUCC
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
+#include <c10/util/irange.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#endif
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
@@ -86,6 +95,117 @@ ForwardIt find_bound(ForwardIt first, ForwardIt last, const T& value) {
     return first;
 }
 
+#ifndef GPUCC
+// Note [Flat-table hash intersection on CPU]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The binary search above costs log2(len) dependent cache misses per source
+// element, which dominates the intersection when source is much larger than
+// probably_coalesced. On CPU we instead build a flat open-addressing table
+// over the unique values of sorted_hash once and resolve each source element
+// with a single bucket lookup. A bucket holds kBucketWidth consecutive keys,
+// so one probe compares an entire bucket with at::vec::Vectorized (a single
+// 512-bit compare for int64_t keys under AVX-512) and moves to the next
+// bucket only on overflow, which the <= 1/2 load factor keeps rare.
+// Duplicate hashes of an uncoalesced operand form runs in sorted_hash; only
+// run starts are inserted and the run length is recovered by scanning
+// sorted_hash forward on a hit. The hash values are non-negative (indices
+// are valid and the hash coefficients are contiguous strides), so -1 is a
+// safe empty sentinel. The build is serial, hence this path is only taken
+// when the probing side is large enough to dominate, see its use below.
+template <typename hash_t>
+class FlatHashIntersectionTable {
+ public:
+  using Vec = at::vec::Vectorized<hash_t>;
+  static constexpr int64_t kBucketWidth = Vec::size() < 8 ? 8 : Vec::size();
+  static constexpr hash_t kEmpty = -1;
+
+  FlatHashIntersectionTable(const hash_t* sorted_hash, int64_t len)
+      : sorted_hash_(sorted_hash), len_(len) {
+    // Size for a load factor of at most 1/2 and at least two buckets
+    // so that the multiplicative hash below always has bits to take.
+    const int64_t min_slots = std::max<int64_t>(2 * len, 2 * kBucketWidth);
+    int64_t log2_buckets = 1;
+    while ((int64_t(1) << log2_buckets) * kBucketWidth < min_slots) {
+      ++log2_buckets;
+    }
+    num_buckets_ = int64_t(1) << log2_buckets;
+    shift_ = 64 - log2_buckets;
+    keys_.resize(num_buckets_ * kBucketWidth, kEmpty);
+    first_pos_.resize(num_buckets_ * kBucketWidth);
+    for (const auto i : c10::irange(len)) {
+      if (i > 0 && sorted_hash[i] == sorted_hash[i - 1]) {
+        // Not a run start.
+        continue;
+      }
+      auto bucket = bucket_of(sorted_hash[i]);
+      while (true) {
+        hash_t* RESTRICT bucket_keys = keys_.data() + bucket * kBucketWidth;
+        bool inserted = false;
+        for (const auto lane : c10::irange(kBucketWidth)) {
+          if (bucket_keys[lane] == kEmpty) {
+            bucket_keys[lane] = sorted_hash[i];
+            first_pos_[bucket * kBucketWidth + lane] = i;
+            inserted = true;
+            break;
+          }
+        }
+        if (inserted) {
+          break;
+        }
+        bucket = (bucket + 1) & (num_buckets_ - 1);
+      }
+    }
+  }
+
+  // Returns (first position in sorted_hash, run length) for hash,
+  // or (0, 0) if hash is absent.
+  std::pair<int64_t, int64_t> lookup(hash_t hash) const {
+    const auto key_vec = Vec(hash);
+    auto bucket = bucket_of(hash);
+    while (true) {
+      const hash_t* RESTRICT bucket_keys = keys_.data() + bucket * kBucketWidth;
+      hash_t match[kBucketWidth];
+      for (int64_t i = 0; i < kBucketWidth; i += Vec::size()) {
+        (Vec::loadu(bucket_keys + i) == key_vec).store(match + i);
+      }
+      // Insertion fills lanes left to right, so within a bucket a match can
+      // never sit behind an empty lane.
+      for (const auto lane : c10::irange(kBucketWidth)) {
+        if (match[lane]) {
+          const auto pos = first_pos_[bucket * kBucketWidth + lane];
+          int64_t count = 1;
+          while (pos + count < len_ && sorted_hash_[pos + count] == hash) {
+            ++count;
+          }
+          return std::make_pair(pos, count);
+        }
+        if (bucket_keys[lane] == kEmpty) {
+          // Linear probing never skips an empty slot: the key is absent.
+          return std::make_pair(int64_t{0}, int64_t{0});
+        }
+      }
+      bucket = (bucket + 1) & (num_buckets_ - 1);
+    }
+  }
+
+ private:
+  int64_t bucket_of(hash_t hash) const {
+    // Multiplicative (Fibonacci) hashing. The perfect hash values have their
+    // low bits strongly correlated with the last sparse dimension, so the
+    // bucket is taken from the high bits of the product instead.
+    const auto h = static_cast<uint64_t>(hash) * uint64_t{0x9E3779B97F4A7C15};
+    return static_cast<int64_t>(h >> shift_);
+  }
+
+  std::vector<hash_t> keys_;
+  std::vector<int64_t> first_pos_;
+  const hash_t* sorted_hash_;
+  int64_t len_;
+  int64_t num_buckets_;
+  int shift_;
+};
+#endif
+
 template <template <typename func_t> class kernel_t>
 struct KernelLauncher {
   template <typename func_t>
@@ -374,6 +494,43 @@ void _sparse_binary_op_intersection_kernel_impl(
     // non-const because of gcc-5/clang-5 issues
     auto indices_dim_stride = source_indices.stride(0);
     auto indices_nnz_stride = source_indices.stride(1);
+
+#ifndef GPUCC
+    // See Note [Flat-table hash intersection on CPU]. The serial table build
+    // over sorted_hash only pays off when the probing side dominates it.
+    if (source_nnz >= at::internal::GRAIN_SIZE
+        && source_nnz >= 4 * sorted_hash.numel()) {
+      const auto* RESTRICT ptr_indices = source_indices.data_ptr<index_t>();
+      const auto* RESTRICT ptr_sorted_hash = sorted_hash.data_ptr<hash_t>();
+      const auto sorted_hash_len = sorted_hash.numel();
+      const auto* RESTRICT ptr_hash_coeffs = hash_coeffs.template data_ptr<hash_t>();
+      auto* RESTRICT ptr_intersection_count = intersection_count.data_ptr<hash_t>();
+      auto* RESTRICT ptr_intersection_first_idx = intersection_first_idx.data_ptr<hash_t>();
+
+      const FlatHashIntersectionTable<hash_t> table(ptr_sorted_hash, sorted_hash_len);
+      at::parallel_for(0, source_nnz, at::internal::GRAIN_SIZE,
+          [&](int64_t begin, int64_t end) {
+        for (const auto nnz_idx : c10::irange(begin, end)) {
+          // Compute hash value
+          const auto* RESTRICT ptr_indices_dim = ptr_indices + nnz_idx * indices_nnz_stride;
+          auto hash = hash_t {0};
+          for (uint32_t dim = 0; dim < sdim; ++dim) {
+            // Use only int32_t operations when hash_t == int32_t.
+            const auto dim_hash_coeff = ptr_hash_coeffs[dim];
+            const auto dim_index = static_cast<hash_t>(ptr_indices_dim[dim * indices_dim_stride]);
+            hash += dim_index * dim_hash_coeff;
+          }
+
+          const auto pos_count = table.lookup(hash);
+          ptr_intersection_count[nnz_idx] = static_cast<hash_t>(pos_count.second);
+          ptr_intersection_first_idx[nnz_idx] = static_cast<hash_t>(pos_count.first);
+        }
+      });
+
+      return std::make_tuple(intersection_count, intersection_first_idx);
+    }
+#endif
+
     auto dummy = at::empty({1}, source_arange.options());
 
     auto iter = TensorIteratorConfig()
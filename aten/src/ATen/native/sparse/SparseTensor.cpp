@@ -653,6 +653,93 @@ SparseTensor coalesce(const SparseTensor& self) {
   return at::_coalesce(self);
 }
 
+// Note [Parallel COO coalesce]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Coalescing sorts the flattened indices and then folds duplicate entries
+// into one. For gradient-sized inputs (hundreds of millions of nnz) the
+// single-threaded Tensor sort plus the serial merge take seconds, so large
+// inputs take a parallel path instead: an LSD radix sort over the flattened
+// indices (8 bits per pass, skipping passes beyond the largest key) carrying
+// the permutation, followed by a parallel segmented reduction that sums the
+// values of duplicate entries. Small inputs keep the serial path, which has
+// a lower constant factor.
+constexpr int64_t kParallelCoalesceNnzThreshold = 1 << 16;
+
+// Parallel LSD radix sort of the non-negative flattened indices in `keys`,
+// carrying `perm` along. Sorts into the tmp buffers on each pass; returns
+// pointers to the buffers holding the final sorted keys and permutation.
+static std::pair<int64_t*, int64_t*> radix_sort_flattened_indices(
+    int64_t* keys,
+    int64_t* perm,
+    int64_t* keys_tmp,
+    int64_t* perm_tmp,
+    int64_t nnz) {
+  constexpr int64_t RADIX_BITS = 8;
+  constexpr int64_t RADIX_SIZE = 1 << RADIX_BITS;
+  constexpr int64_t RADIX_MASK = RADIX_SIZE - 1;
+
+  const int64_t num_threads = at::get_num_threads();
+  const int64_t chunk_size = divup(nnz, num_threads);
+
+  const int64_t max_key = at::parallel_reduce(
+      0, nnz, at::internal::GRAIN_SIZE, (int64_t)0,
+      [&](int64_t begin, int64_t end, int64_t init) {
+        int64_t max_val = init;
+        for (const auto j : c10::irange(begin, end)) {
+          max_val = std::max(max_val, keys[j]);
+        }
+        return max_val;
+      },
+      [](int64_t a, int64_t b) { return std::max(a, b); });
+
+  int64_t num_passes = 1;
+  while (num_passes < 8 && (max_key >> (num_passes * RADIX_BITS)) != 0) {
+    num_passes++;
+  }
+
+  std::vector<int64_t> histograms(num_threads * RADIX_SIZE);
+  for (const auto pass : c10::irange(num_passes)) {
+    const int64_t shift = pass * RADIX_BITS;
+    std::fill(histograms.begin(), histograms.end(), 0);
+    // per-chunk digit histograms
+    at::parallel_for(0, num_threads, 1, [&](int64_t cbegin, int64_t cend) {
+      for (const auto t : c10::irange(cbegin, cend)) {
+        const int64_t begin = std::min(t * chunk_size, nnz);
+        const int64_t end = std::min(begin + chunk_size, nnz);
+        int64_t* hist = histograms.data() + t * RADIX_SIZE;
+        for (const auto j : c10::irange(begin, end)) {
+          hist[(keys[j] >> shift) & RADIX_MASK]++;
+        }
+      }
+    });
+    // exclusive scan in (digit, chunk) order so the scatter below is stable
+    int64_t sum = 0;
+    for (const auto d : c10::irange(RADIX_SIZE)) {
+      for (const auto t : c10::irange(num_threads)) {
+        int64_t count = histograms[t * RADIX_SIZE + d];
+        histograms[t * RADIX_SIZE + d] = sum;
+        sum += count;
+      }
+    }
+    // stable scatter into the temporary buffers
+    at::parallel_for(0, num_threads, 1, [&](int64_t cbegin, int64_t cend) {
+      for (const auto t : c10::irange(cbegin, cend)) {
+        const int64_t begin = std::min(t * chunk_size, nnz);
+        const int64_t end = std::min(begin + chunk_size, nnz);
+        int64_t* offsets = histograms.data() + t * RADIX_SIZE;
+        for (const auto j : c10::irange(begin, end)) {
+          int64_t slot = offsets[(keys[j] >> shift) & RADIX_MASK]++;
+          keys_tmp[slot] = keys[j];
+          perm_tmp[slot] = perm[j];
+        }
+      }
+    });
+    std::swap(keys, keys_tmp);
+    std::swap(perm, perm_tmp);
+  }
+  return std::make_pair(keys, perm);
+}
+
 SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
   AT_ASSERT(self.defined());
   TORCH_INTERNAL_ASSERT(at::impl::variable_excluded_from_dispatch());
@@ -686,6 +773,102 @@ SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
   Tensor newValues = at::empty(values.sizes(), values.options());
   alias_into_sparse(dst, newIndices, newValues);
 
+  // See Note [Parallel COO coalesce]
+  if (nnz >= kParallelCoalesceNnzThreshold && at::get_num_threads() > 1) {
+    const int64_t num_threads = at::get_num_threads();
+    const int64_t chunk_size = divup(nnz, num_threads);
+
+    Tensor keysBuffer = indices_scalar.contiguous();
+    Tensor permBuffer = at::empty({nnz}, keysBuffer.options());
+    Tensor keysTmp = at::empty({nnz}, keysBuffer.options());
+    Tensor permTmp = at::empty({nnz}, keysBuffer.options());
+    int64_t* perm_init = permBuffer.data_ptr<int64_t>();
+    at::parallel_for(0, nnz, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+      for (const auto j : c10::irange(begin, end)) {
+        perm_init[j] = j;
+      }
+    });
+    auto sorted = radix_sort_flattened_indices(
+        keysBuffer.data_ptr<int64_t>(), perm_init,
+        keysTmp.data_ptr<int64_t>(), permTmp.data_ptr<int64_t>(), nnz);
+    const int64_t* keys = sorted.first;
+    const int64_t* perm = sorted.second;
+
+    // count the segment starts in each chunk, then prefix-sum the counts so
+    // each chunk can write its start positions to a disjoint output range
+    std::vector<int64_t> chunk_segments(num_threads + 1, 0);
+    at::parallel_for(0, num_threads, 1, [&](int64_t cbegin, int64_t cend) {
+      for (const auto t : c10::irange(cbegin, cend)) {
+        const int64_t begin = std::min(t * chunk_size, nnz);
+        const int64_t end = std::min(begin + chunk_size, nnz);
+        int64_t count = 0;
+        for (const auto j : c10::irange(begin, end)) {
+          if (j == 0 || keys[j] != keys[j - 1]) {
+            count++;
+          }
+        }
+        chunk_segments[t + 1] = count;
+      }
+    });
+    for (const auto t : c10::irange(num_threads)) {
+      chunk_segments[t + 1] += chunk_segments[t];
+    }
+    const int64_t new_nnz = chunk_segments[num_threads];
+    Tensor segmentOffsets = at::empty({new_nnz + 1}, keysBuffer.options());
+    int64_t* seg_offsets = segmentOffsets.data_ptr<int64_t>();
+    at::parallel_for(0, num_threads, 1, [&](int64_t cbegin, int64_t cend) {
+      for (const auto t : c10::irange(cbegin, cend)) {
+        const int64_t begin = std::min(t * chunk_size, nnz);
+        const int64_t end = std::min(begin + chunk_size, nnz);
+        int64_t s = chunk_segments[t];
+        for (const auto j : c10::irange(begin, end)) {
+          if (j == 0 || keys[j] != keys[j - 1]) {
+            seg_offsets[s++] = j;
+          }
+        }
+      }
+    });
+    seg_offsets[new_nnz] = nnz;
+
+    // segmented reduction: one output entry per segment, summing duplicates
+    auto newIndicesAccessor = newIndices.accessor<int64_t, 2>();
+    auto indicesAccessor = indices.accessor<int64_t, 2>();
+    AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(
+        at::ScalarType::ComplexHalf, at::ScalarType::BFloat16, at::ScalarType::Half, at::ScalarType::Bool,
+        values.scalar_type(), "coalesce", [&] {
+      int64_t blockSize = values.stride(0);
+      scalar_t* values_ptr = values.data_ptr<scalar_t>();
+      scalar_t* newValues_ptr = newValues.data_ptr<scalar_t>();
+      const int64_t grain_size = std::max((int64_t)1, at::internal::GRAIN_SIZE / std::max(blockSize, (int64_t)1));
+      at::parallel_for(0, new_nnz, grain_size, [&](int64_t begin, int64_t end) {
+        for (const auto s : c10::irange(begin, end)) {
+          const int64_t pos = seg_offsets[s];
+          const int64_t p = perm[pos];
+          for (const auto d : c10::irange(sparse_dim)) {
+            newIndicesAccessor[d][s] = indicesAccessor[d][p];
+          }
+          if (values.numel() > 0) {
+            at::native::cpublas::copy<scalar_t>(
+                blockSize, values_ptr + p * blockSize, 1, newValues_ptr + s * blockSize, 1);
+            for (int64_t e = pos + 1; e < seg_offsets[s + 1]; e++) {
+              at::native::cpublas::axpy<scalar_t>(
+                  blockSize,
+                  static_cast<scalar_t>(1),
+                  values_ptr + perm[e] * blockSize,
+                  1,
+                  newValues_ptr + s * blockSize,
+                  1);
+            }
+          }
+        }
+      });
+    });
+
+    dst._coalesced_(true);
+    get_sparse_impl(dst)->set_nnz_and_narrow(new_nnz);
+    return dst;
+  }
+
   Tensor indicesBuffer;
   Tensor indicesPermutation;
   std::tie(indicesBuffer, indicesPermutation) = indices_scalar.sort(0);
@@ -10,6 +10,7 @@
 #include <ATen/cpu/vec/vec256/vec256.h>
 #include <ATen/native/transformers/attention.h>
 #include <ATen/native/transformers/sdp_utils_cpp.h>
+#include <cstring>
 #include <type_traits>
 #include <utility>
 #include <c10/core/SymIntArrayRef.h>
@@ -32,6 +33,9 @@ namespace native {
 DEFINE_DISPATCH(_fused_sdp_choice_stub);
 REGISTER_NO_CPU_DISPATCH(_fused_sdp_choice_stub);
 
+DEFINE_DISPATCH(flash_attention_kernel);
+DEFINE_DISPATCH(rotary_embedding_kernel);
+
 namespace {
 
 Tensor gemm_nt(const Tensor& self, const Tensor& other) {
@@ -664,7 +668,66 @@ std::tuple<Tensor, Tensor, Tensor, Tensor> native_decoder_only_multi_head_attent
 
 int64_t _fused_sdp_choice_cpp(const Tensor& query_, const Tensor& key, const Tensor& value,
         const c10::optional<Tensor>& attn_mask_, double dropout_p, bool is_causal){
-  return static_cast<int64_t>(sdp::SDPBackend::math);
+  sdp::sdp_params kernel_params{query_, key, value, attn_mask_.has_value(), dropout_p, is_causal};
+  return static_cast<int64_t>(sdp::select_sdp_backend_cpp(kernel_params));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor, int64_t, int64_t, int64_t, int64_t, Tensor>
+_scaled_dot_product_flash_attention_cpu(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    double dropout_p,
+    bool is_causal,
+    bool return_debug_mask) {
+  C10_LOG_API_USAGE_ONCE("torch.sdpa.flash_attention_cpu");
+  // Query (Batch x Num_heads x Q_seq_len  x Dim_per_head)
+  // Key   (Batch x Num_heads x KV_seq_len x Dim_per_head)
+  // Value (Batch x Num_heads x KV_seq_len x Dim_per_head)
+  TORCH_CHECK(
+      query.dim() == 4 && key.dim() == 4 && value.dim() == 4,
+      "scaled_dot_product_flash_attention: Expected 4 dimensional query, key and value");
+  const int64_t batch_size = query.size(0);
+  const int64_t num_heads = query.size(1);
+  const int64_t max_seqlen_q = query.size(2);
+  const int64_t head_dim = query.size(3);
+  const int64_t max_seqlen_k = key.size(2);
+  TORCH_CHECK(
+      key.size(3) == head_dim && value.size(3) == head_dim,
+      "scaled_dot_product_flash_attention: Query, Key and Value must have the same head size");
+  TORCH_CHECK(
+      value.size(2) == max_seqlen_k,
+      "scaled_dot_product_flash_attention: Key and Value must have the same sequence length");
+  TORCH_CHECK(
+      max_seqlen_q > 0 && max_seqlen_k > 0,
+      "scaled_dot_product_flash_attention: Expected non-empty sequences");
+  TORCH_CHECK(
+      dropout_p == 0.0,
+      "scaled_dot_product_flash_attention: dropout is not supported on CPU");
+  TORCH_CHECK(
+      !return_debug_mask,
+      "scaled_dot_product_flash_attention: return_debug_mask is not supported on CPU");
+
+  auto q = query.contiguous();
+  auto k = key.contiguous();
+  auto v = value.contiguous();
+  auto output =
+      at::empty({batch_size, num_heads, max_seqlen_q, head_dim}, query.options());
+  auto logsumexp =
+      at::empty({batch_size, num_heads, max_seqlen_q}, query.options());
+
+  flash_attention_kernel(kCPU, output, logsumexp, q, k, v, dropout_p, is_causal);
+
+  return std::make_tuple(
+      std::move(output),
+      std::move(logsumexp),
+      Tensor(),
+      Tensor(),
+      max_seqlen_q,
+      max_seqlen_k,
+      0,
+      0,
+      Tensor());
 }
 
 int64_t _fused_sdp_choice_meta(
@@ -777,6 +840,11 @@ Tensor scaled_dot_product_attention(
   if (query_.device().type() == DeviceType::CUDA){
     choice_int = _fused_sdp_choice_stub(query_.device().type(),
       query_, key, value, attn_mask_, dropout_p, is_causal);
+  } else if (query_.device().type() == DeviceType::MPS || query_.device().type() == DeviceType::CPU) {
+    // MPS and CPU register their choice functions directly in
+    // native_functions.yaml rather than through the dispatch stub.
+    choice_int = at::_fused_sdp_choice(
+        query_, key, value, attn_mask_, dropout_p, is_causal);
   }
   sdp::SDPBackend backend = static_cast<sdp::SDPBackend>(choice_int);
   switch (backend) {
@@ -965,5 +1033,140 @@ Tensor triton_multi_head_attention(
 #endif
   return proj;
 }
+
+void check_kv_cache_append_inputs(
+    const Tensor& cache,
+    const Tensor& step,
+    const Tensor& lengths) {
+  TORCH_CHECK(
+      cache.dim() >= 2,
+      "_kv_cache_append_: expected cache of shape (B, S, ...), got ",
+      cache.dim(),
+      "-D tensor");
+  TORCH_CHECK(
+      step.dim() == cache.dim() - 1,
+      "_kv_cache_append_: step must have one dimension fewer than cache");
+  TORCH_CHECK(
+      step.size(0) == cache.size(0),
+      "_kv_cache_append_: cache and step must have the same batch size");
+  for (int64_t d = 1; d < step.dim(); d++) {
+    TORCH_CHECK(
+        step.size(d) == cache.size(d + 1),
+        "_kv_cache_append_: step shape must match cache shape with the "
+        "sequence dimension removed");
+  }
+  TORCH_CHECK(
+      step.scalar_type() == cache.scalar_type(),
+      "_kv_cache_append_: cache and step must have the same dtype");
+  TORCH_CHECK(
+      lengths.scalar_type() == at::kLong && lengths.numel() == cache.size(0),
+      "_kv_cache_append_: lengths must be a Long tensor with one entry per "
+      "batch element");
+  TORCH_CHECK(
+      !cache.is_nested() && !step.is_nested(),
+      "_kv_cache_append_: nested tensors are not supported; nested layouts "
+      "do not support in-place writes");
+  TORCH_CHECK(
+      cache.is_contiguous() && step.is_contiguous() &&
+          lengths.is_contiguous(),
+      "_kv_cache_append_: cache, step and lengths must be contiguous");
+}
+
+Tensor& kv_cache_append__cpu(
+    Tensor& cache,
+    const Tensor& step,
+    Tensor& lengths) {
+  check_kv_cache_append_inputs(cache, step, lengths);
+  const int64_t B = cache.size(0);
+  const int64_t S = cache.size(1);
+  const int64_t row_size = cache.numel() / (B * S);
+  AT_DISPATCH_ALL_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      cache.scalar_type(),
+      "kv_cache_append_",
+      [&] {
+        scalar_t* cache_data = cache.data_ptr<scalar_t>();
+        const scalar_t* step_data = step.data_ptr<scalar_t>();
+        int64_t* lengths_data = lengths.data_ptr<int64_t>();
+        at::parallel_for(0, B, 1, [&](int64_t begin, int64_t end) {
+          for (const auto b : c10::irange(begin, end)) {
+            TORCH_CHECK(
+                lengths_data[b] >= 0,
+                "_kv_cache_append_: lengths must be non-negative, got ",
+                lengths_data[b],
+                " for batch element ",
+                b);
+            // ring semantics: a linear cache simply never lets lengths
+            // reach S, so the modulo is a no-op for it
+            const int64_t pos = lengths_data[b] % S;
+            std::memcpy(
+                cache_data + (b * S + pos) * row_size,
+                step_data + b * row_size,
+                row_size * sizeof(scalar_t));
+            lengths_data[b]++;
+          }
+        });
+      });
+  return cache;
+}
+
+void check_rotary_embedding_inputs(
+    const Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin) {
+  TORCH_CHECK(
+      self.dim() >= 2,
+      "_rotary_embedding: expected self of shape (..., S, D), got ",
+      self.dim(),
+      "-D tensor");
+  const int64_t seq_len = self.size(-2);
+  const int64_t dim = self.size(-1);
+  TORCH_CHECK(
+      dim % 2 == 0,
+      "_rotary_embedding: the rotated dimension must be even, got ",
+      dim);
+  TORCH_CHECK(
+      cos.dim() == 2 && cos.size(0) == seq_len && cos.size(1) == dim / 2,
+      "_rotary_embedding: expected cos of shape (",
+      seq_len,
+      ", ",
+      dim / 2,
+      "), got ",
+      cos.sizes());
+  TORCH_CHECK(
+      sin.sizes() == cos.sizes(),
+      "_rotary_embedding: cos and sin must have the same shape");
+  TORCH_CHECK(
+      self.scalar_type() == cos.scalar_type() &&
+          self.scalar_type() == sin.scalar_type(),
+      "_rotary_embedding: self, cos and sin must have the same dtype");
+  TORCH_CHECK(
+      !self.is_nested(),
+      "_rotary_embedding: nested tensors are not supported");
+  TORCH_CHECK(
+      self.is_contiguous() && cos.is_contiguous() && sin.is_contiguous(),
+      "_rotary_embedding: self, cos and sin must be contiguous");
+}
+
+Tensor rotary_embedding_cpu(
+    const Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin) {
+  check_rotary_embedding_inputs(self, cos, sin);
+  auto output = at::empty_like(self);
+  rotary_embedding_kernel(kCPU, output, self, cos, sin);
+  return output;
+}
+
+Tensor& rotary_embedding__cpu(
+    Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin) {
+  check_rotary_embedding_inputs(self, cos, sin);
+  // The kernel reads each pair before writing it, so output may alias self.
+  rotary_embedding_kernel(kCPU, self, self, cos, sin);
+  return self;
+}
 } // namespace native
 } // namespace at
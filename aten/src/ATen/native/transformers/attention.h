@@ -12,6 +12,21 @@ using fused_sdp_choice_fn = int64_t (*)(const Tensor& query_, const Tensor& key,
 
 DECLARE_DISPATCH(fused_sdp_choice_fn, _fused_sdp_choice_stub);
 
+using flash_attention_fn = void (*)(
+    const Tensor& output, const Tensor& logsumexp,
+    const Tensor& query, const Tensor& key, const Tensor& value,
+    double dropout_p, bool is_causal);
+
+DECLARE_DISPATCH(flash_attention_fn, flash_attention_kernel);
+
+using rotary_embedding_fn = void (*)(
+    const Tensor& output,
+    const Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin);
+
+DECLARE_DISPATCH(rotary_embedding_fn, rotary_embedding_kernel);
+
 TORCH_API Tensor bmm_nt(const Tensor& a, const Tensor& b);
 TORCH_API Tensor masked_softmax(
     Tensor& attn_scores,
@@ -36,5 +51,18 @@ TORCH_API Tensor qkv_projection(
     const int64_t embed_dim,
     const Tensor& qkv_weight);
 
+// shared shape/dtype validation for the CPU and CUDA _kv_cache_append_
+// implementations
+TORCH_API void check_kv_cache_append_inputs(
+    const Tensor& cache,
+    const Tensor& step,
+    const Tensor& lengths);
+
+// shared shape/dtype validation for the _rotary_embedding backends
+TORCH_API void check_rotary_embedding_inputs(
+    const Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin);
+
 } // namespace native
 } // namespace at
@@ -3,6 +3,8 @@
 #include <ATen/ATen.h>
 #include <ATen/AccumulateType.h>
 #include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/ceil_div.h>
 #include <ATen/native/DispatchStub.h>
 #include <ATen/NestedTensorImpl.h>
 #include <ATen/TensorAccessor.h>
@@ -1028,6 +1030,142 @@ Tensor triton_scaled_dot_attention(const Tensor& q, const Tensor& k, const Tenso
   return at::Tensor();
 }
 
+namespace {
+
+template <typename scalar_t>
+__global__ void kv_cache_append_kernel(
+    scalar_t* cache,
+    const scalar_t* step,
+    int64_t* lengths,
+    int64_t S,
+    int64_t row_size) {
+  const int64_t b = blockIdx.x;
+  // a negative (stale) length would index before the cache; the modulo
+  // below keeps any non-negative value in bounds
+  CUDA_KERNEL_ASSERT(lengths[b] >= 0);
+  // ring semantics: a linear cache never lets lengths reach S, so the
+  // modulo is a no-op for it
+  const int64_t pos = lengths[b] % S;
+  // make sure every thread has read lengths[b] before thread 0 bumps it
+  __syncthreads();
+  scalar_t* dst = cache + (b * S + pos) * row_size;
+  const scalar_t* src = step + b * row_size;
+  for (int64_t i = threadIdx.x; i < row_size; i += blockDim.x) {
+    dst[i] = src[i];
+  }
+  if (threadIdx.x == 0) {
+    lengths[b]++;
+  }
+}
+
+// One block per (leading dims, sequence position) row; each thread rotates
+// whole pairs, so no synchronization or aliasing hazard even when out == x.
+template <typename scalar_t>
+__global__ void rotary_embedding_kernel_cuda(
+    scalar_t* out,
+    const scalar_t* x,
+    const scalar_t* cos,
+    const scalar_t* sin,
+    int64_t S,
+    int64_t half) {
+  const int64_t row = blockIdx.x;
+  const int64_t pos = row % S;
+  const scalar_t* x_row = x + row * half * 2;
+  const scalar_t* cos_row = cos + pos * half;
+  const scalar_t* sin_row = sin + pos * half;
+  scalar_t* out_row = out + row * half * 2;
+  using opmath_t = at::opmath_type<scalar_t>;
+  for (int64_t j = threadIdx.x; j < half; j += blockDim.x) {
+    const opmath_t x0 = static_cast<opmath_t>(x_row[2 * j]);
+    const opmath_t x1 = static_cast<opmath_t>(x_row[2 * j + 1]);
+    const opmath_t c = static_cast<opmath_t>(cos_row[j]);
+    const opmath_t s = static_cast<opmath_t>(sin_row[j]);
+    out_row[2 * j] = static_cast<scalar_t>(x0 * c - x1 * s);
+    out_row[2 * j + 1] = static_cast<scalar_t>(x0 * s + x1 * c);
+  }
+}
+
+void launch_rotary_embedding_kernel(
+    const Tensor& output,
+    const Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin) {
+  const int64_t dim = self.size(-1);
+  const int64_t seq_len = self.size(-2);
+  const int64_t half = dim / 2;
+  const int64_t rows = self.numel() / dim;
+  if (rows == 0) {
+    return;
+  }
+  const int64_t threads = std::min<int64_t>(
+      at::ceil_div(half, (int64_t)C10_WARP_SIZE) * C10_WARP_SIZE, 256);
+  cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      self.scalar_type(),
+      "rotary_embedding",
+      [&] {
+        rotary_embedding_kernel_cuda<scalar_t><<<rows, threads, 0, stream>>>(
+            output.data_ptr<scalar_t>(),
+            self.data_ptr<scalar_t>(),
+            cos.data_ptr<scalar_t>(),
+            sin.data_ptr<scalar_t>(),
+            seq_len,
+            half);
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+}
+
+} // namespace
+
+Tensor& kv_cache_append__cuda(
+    Tensor& cache,
+    const Tensor& step,
+    Tensor& lengths) {
+  check_kv_cache_append_inputs(cache, step, lengths);
+  const int64_t B = cache.size(0);
+  const int64_t S = cache.size(1);
+  const int64_t row_size = cache.numel() / (B * S);
+  const int64_t threads = std::min<int64_t>(
+      at::ceil_div(row_size, (int64_t)C10_WARP_SIZE) * C10_WARP_SIZE, 256);
+  cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_ALL_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      cache.scalar_type(),
+      "kv_cache_append_",
+      [&] {
+        kv_cache_append_kernel<scalar_t><<<B, threads, 0, stream>>>(
+            cache.data_ptr<scalar_t>(),
+            step.data_ptr<scalar_t>(),
+            lengths.data_ptr<int64_t>(),
+            S,
+            row_size);
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+  return cache;
+}
+
+Tensor rotary_embedding_cuda(
+    const Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin) {
+  check_rotary_embedding_inputs(self, cos, sin);
+  auto output = at::empty_like(self);
+  launch_rotary_embedding_kernel(output, self, cos, sin);
+  return output;
+}
+
+Tensor& rotary_embedding__cuda(
+    Tensor& self,
+    const Tensor& cos,
+    const Tensor& sin) {
+  check_rotary_embedding_inputs(self, cos, sin);
+  launch_rotary_embedding_kernel(self, self, cos, sin);
+  return self;
+}
+
 REGISTER_CUDA_DISPATCH(_fused_sdp_choice_stub, &_fused_sdp_choice_cuda);
 
 } // namespace native
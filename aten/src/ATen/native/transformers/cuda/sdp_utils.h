@@ -38,14 +38,8 @@ constexpr auto array_of(T&&... t)
     return {{ std::forward<T>(t)... }};
 }
 
-struct sdp_params {
-  const at::Tensor& query;
-  const at::Tensor& key;
-  const at::Tensor& value;
-  bool has_attn_mask;
-  double dropout;
-  bool is_causal;
-};
+// sdp_params lives in sdp_utils_cpp.h so that the CPU backend selection can
+// share it.
 
 inline std::array<SDPBackend, num_backends> priority_order(sdp_params params) {
   constexpr std::array<SDPBackend, num_backends> default_order{
@@ -1,4 +1,9 @@
 #pragma once
+#include <ATen/Context.h>
+#include <ATen/core/Tensor.h>
+#include <c10/core/GradMode.h>
+#include <c10/core/ScalarType.h>
+#include <c10/util/Exception.h>
 #include <cstdint>
 namespace sdp {
 
@@ -9,4 +14,86 @@ enum class SDPBackend {
   flash_attention = 1,
   efficient_attention = 2
 };
-} // namespace sdp
\ No newline at end of file
+
+struct sdp_params {
+  const at::Tensor& query;
+  const at::Tensor& key;
+  const at::Tensor& value;
+  bool has_attn_mask;
+  double dropout;
+  bool is_causal;
+};
+
+// Eligibility check for the CPU flash attention kernel. This mirrors the
+// constraint-function style of cuda/sdp_utils.h but is kept as a single
+// check since the CPU kernel has no dtype/arch variants: it supports dense
+// 4-d float/double inputs with a shared head dim, no mask, no dropout, and
+// forward only.
+inline bool use_flash_attention_cpp(sdp_params params, bool debug) {
+  if (!at::globalContext().userEnabledFlashSDP()) {
+    if (debug) {
+      TORCH_WARN("Flash attention has been runtime disabled.");
+    }
+    return false;
+  }
+  if (params.has_attn_mask || params.dropout != 0.0) {
+    if (debug) {
+      TORCH_WARN(
+          "CPU flash attention does not support attention masks or dropout.");
+    }
+    return false;
+  }
+  if (params.query.is_nested() || params.key.is_nested() ||
+      params.value.is_nested()) {
+    if (debug) {
+      TORCH_WARN("CPU flash attention does not support nested tensors.");
+    }
+    return false;
+  }
+  const auto query_dtype = params.query.dtype();
+  if (!(query_dtype == params.key.dtype() &&
+        query_dtype == params.value.dtype() &&
+        (query_dtype == at::kFloat || query_dtype == at::kDouble))) {
+    if (debug) {
+      TORCH_WARN(
+          "Expected query, key and value to all be of dtype float32 or float64. Got ",
+          "Query dtype: ", params.query.dtype(),
+          ", Key dtype: ", params.key.dtype(),
+          ", and Value dtype: ", params.value.dtype(), " instead.");
+    }
+    return false;
+  }
+  if (params.query.dim() != 4 || params.key.dim() != 4 ||
+      params.value.dim() != 4 ||
+      params.query.size(3) != params.key.size(3) ||
+      params.query.size(3) != params.value.size(3) ||
+      params.key.size(2) != params.value.size(2) ||
+      params.query.size(2) == 0 || params.key.size(2) == 0 ||
+      params.query.numel() == 0) {
+    if (debug) {
+      TORCH_WARN(
+          "CPU flash attention requires non-empty (batch, num_heads, seq_len, head_dim) inputs ",
+          "with matching head dims and key/value sequence lengths.");
+    }
+    return false;
+  }
+  // Only the forward kernel is implemented on CPU.
+  if (c10::GradMode::is_enabled() &&
+      (params.query.requires_grad() || params.key.requires_grad() ||
+       params.value.requires_grad())) {
+    if (debug) {
+      TORCH_WARN("CPU flash attention does not support gradients.");
+    }
+    return false;
+  }
+  return true;
+}
+
+inline SDPBackend select_sdp_backend_cpp(sdp_params params) {
+  if (use_flash_attention_cpp(params, false)) {
+    return SDPBackend::flash_attention;
+  }
+  return SDPBackend::math;
+}
+
+} // namespace sdp
@@ -161,8 +161,10 @@ inline Tensor new_qtensor(
 
 Tensor PerTensorAffineQuantizer::quantize(const Tensor& rtensor) {
   TORCH_CHECK(
-      rtensor.scalar_type() == kFloat,
-      "Quantize only works on Float Tensor, got ", rtensor.scalar_type());
+      rtensor.scalar_type() == kFloat || rtensor.scalar_type() == kHalf ||
+          rtensor.scalar_type() == kBFloat16,
+      "Quantize only works on Float, Half and BFloat16 Tensors, got ",
+      rtensor.scalar_type());
   // Here we need a std::intrusive_ptr<Quantizer>.. but actually "this" is the
   // quantizer that can be reused, so I'm using intrusive_from_this here
   Tensor qtensor = new_qtensor(
@@ -200,6 +200,15 @@ class LocalCallbackManager {
   // Runtime cache.
   size_t global_version_{GlobalCallbackManager::NoVersion};
   std::array<CacheEntry, NumRecordScopes> active_callbacks_;
+
+  // Bit i is set iff scope i has at least one registered callback, including
+  // sampled callbacks waiting for their next run. Ops in an unwatched scope
+  // (e.g. everything outside a profiler's scope filter) are rejected with a
+  // single branch, without touching the scope's CacheEntry.
+  uint64_t watched_scopes_{0};
+  static_assert(
+      NumRecordScopes <= 64, "watched_scopes_ bitmask needs widening");
+
   std::mt19937 generator_{};
 };
 
@@ -398,6 +407,10 @@ StepCallbacks LocalCallbackManager::getActiveCallbacks(
 c10::optional<StepCallbacks> LocalCallbackManager::getActiveCallbacksUnlessEmpty(
     const RecordScope scope) {
   rebuildActiveCallbacksIfNeeded();
+  if (C10_LIKELY(
+          !(watched_scopes_ & (uint64_t(1) << static_cast<size_t>(scope))))) {
+    return c10::nullopt;
+  }
   return active_callbacks_[static_cast<size_t>(scope)].getActiveCallbacksUnlessEmpty();
 }
 
@@ -487,6 +500,12 @@ void LocalCallbackManager::rebuild_scope(
     populate_callbacks(global_snapshot.second);
     populate_callbacks(registered_callbacks_.sorted_tls_callbacks_);
   }
+  const auto scope_bit = uint64_t(1) << static_cast<size_t>(scope);
+  if (callbacks.empty()) {
+    watched_scopes_ &= ~scope_bit;
+  } else {
+    watched_scopes_ |= scope_bit;
+  }
   active_callbacks_[static_cast<size_t>(scope)].update(callbacks);
 }
 
@@ -0,0 +1,47 @@
+#pragma once
+
+// ${generated_comment}
+
+// Open-addressed hash table over the name of every operator schema in
+// native_functions.yaml, built at codegen time. The reader side lives in
+// ATen/core/dispatch/Dispatcher.cpp; see Note [Static operator lookup]
+// there. Keys are crc64("name.overload_name") (trailing '.' when there is
+// no overload); a hash match is confirmed against static_operator_names
+// before an index is trusted.
+
+#include <cstdint>
+
+namespace at {
+namespace detail {
+
+// Number of statically known operator schemas.
+constexpr uint32_t kStaticOperatorCount = ${static_operator_count};
+
+// Power-of-two table size, sized for a load factor of at most one half.
+constexpr uint32_t kStaticOperatorTableSize = ${static_operator_table_size};
+
+// Longest probe sequence produced while placing keys; lookups may stop
+// probing after this many slots.
+constexpr uint32_t kStaticOperatorMaxProbe = ${static_operator_max_probe};
+
+constexpr uint32_t kStaticOperatorEmptySlot = 0xffffffffu;
+
+// "name.overload_name" for each static operator index.
+constexpr const char* static_operator_names[kStaticOperatorCount] = {
+${static_operator_names}
+};
+
+struct StaticOperatorSlot {
+  uint64_t hash;
+  uint32_t index;
+};
+
+// Keys are placed at hash % kStaticOperatorTableSize with linear probing;
+// empty slots carry kStaticOperatorEmptySlot.
+constexpr StaticOperatorSlot
+    static_operator_hash_table[kStaticOperatorTableSize] = {
+${static_operator_hash_table}
+};
+
+} // namespace detail
+} // namespace at
@@ -170,6 +170,34 @@ TEST(TensorIteratorTest, SerialLoopSingleThread) {
   });
 }
 
+TEST(TensorIteratorTest, ForEachFastPath1d) {
+  // large enough for for_each to chunk across threads via the coalesced
+  // 1-d fast path
+  Tensor out;
+  auto in = at::randn({50000});
+  auto expected = in.add(1);
+  auto iter = TensorIterator::unary_op(out, in);
+  at::native::cpu_kernel(iter, [=](float a) -> float { return a + 1; });
+  EXPECT_TRUE(out.allclose(expected));
+
+  // strided but still 1-d operands also take the fast path
+  Tensor strided_out;
+  auto strided_in = at::randn({50000, 2}).select(1, 0);
+  auto strided_expected = strided_in.add(1);
+  auto strided_iter = TensorIterator::unary_op(strided_out, strided_in);
+  at::native::cpu_kernel(
+      strided_iter, [=](float a) -> float { return a + 1; });
+  EXPECT_TRUE(strided_out.allclose(strided_expected));
+
+  // non-coalescable operands keep taking the 2d strided path
+  Tensor t_out;
+  auto t_in = at::randn({300, 300}).t();
+  auto t_expected = t_in.add(1);
+  auto t_iter = TensorIterator::unary_op(t_out, t_in);
+  at::native::cpu_kernel(t_iter, [=](float a) -> float { return a + 1; });
+  EXPECT_TRUE(t_out.allclose(t_expected));
+}
+
 TEST(TensorIteratorTest, InputDType) {
   auto iter = at::TensorIteratorConfig()
       .check_all_same_dtype(false)
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <benchmark/benchmark.h>
+#include <c10/core/InferenceMode.h>
+
+#include <vector>
+
+namespace op_bench {
+
+// Shape/dtype grid applied to every generated case. Args are
+// (side length of a square 2-D tensor, index into grid_dtype below).
+inline void GridArgs(benchmark::internal::Benchmark* b) {
+  for (const int64_t side : {8, 64, 512}) {
+    for (const int64_t dtype : {0, 1}) {
+      b->Args({side, dtype});
+    }
+  }
+}
+
+inline at::ScalarType grid_dtype(int64_t index) {
+  return index == 0 ? at::kFloat : at::kBFloat16;
+}
+
+// Runs `fn` over `num_tensors` freshly materialized grid tensors. The first
+// call happens outside the timed loop, both as a warm-up and as a probe: ops
+// that reject the dtype (or need non-float inputs) skip instead of aborting
+// the whole suite.
+template <typename Fn>
+void RunOp(benchmark::State& state, int num_tensors, const Fn& fn) {
+  c10::InferenceMode guard;
+  const int64_t side = state.range(0);
+  const auto dtype = grid_dtype(state.range(1));
+
+  std::vector<at::Tensor> ts;
+  at::Tensor output;
+  try {
+    for (int i = 0; i < num_tensors; ++i) {
+      ts.push_back(at::randn({side, side}, at::TensorOptions().dtype(dtype)));
+    }
+    output = fn(ts);
+  } catch (const std::exception& e) {
+    state.SkipWithError(e.what());
+    return;
+  }
+
+  for (auto _ : state) {
+    output = fn(ts);
+  }
+
+  size_t bytes = output.nbytes();
+  for (const auto& t : ts) {
+    bytes += t.nbytes();
+  }
+  state.counters["GB/s"] = benchmark::Counter(
+      // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
+      state.iterations() * bytes,
+      benchmark::Counter::kIsRate);
+}
+
+} // namespace op_bench
@@ -0,0 +1,84 @@
+"""Compares two bench_ops result files and flags regressions.
+
+Collect a baseline and a contender run with Google Benchmark's JSON output:
+
+    ./bin/bench_ops --benchmark_out=baseline.json --benchmark_out_format=json
+    # ... apply the change, rebuild ...
+    ./bin/bench_ops --benchmark_out=contender.json --benchmark_out_format=json
+    python benchmarks/cpp/ops/compare_ops_bench.py baseline.json contender.json
+
+Exits non-zero when any benchmark slowed down by more than --threshold, so
+this can gate a CI job.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_times(path):
+    with open(path) as f:
+        data = json.load(f)
+    times = {}
+    for b in data.get("benchmarks", []):
+        # Skips (unsupported dtype etc.) report no meaningful time.
+        if b.get("error_occurred"):
+            continue
+        times[b["name"]] = b["real_time"]
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare two bench_ops JSON result files"
+    )
+    parser.add_argument("baseline")
+    parser.add_argument("contender")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="relative slowdown treated as a regression (default: 0.05)",
+    )
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline)
+    contender = load_times(args.contender)
+    common = sorted(set(baseline) & set(contender))
+    if not common:
+        print("No common benchmarks between the two files", file=sys.stderr)
+        sys.exit(2)
+
+    rows = []
+    for name in common:
+        ratio = contender[name] / baseline[name] - 1.0
+        rows.append((ratio, name, baseline[name], contender[name]))
+    rows.sort(reverse=True)
+
+    regressions = 0
+    print(f"{'delta':>8}  {'baseline':>12}  {'contender':>12}  name")
+    for ratio, name, base, cont in rows:
+        marker = ""
+        if ratio > args.threshold:
+            marker = "  <-- regression"
+            regressions += 1
+        print(f"{ratio:+7.1%}  {base:12.1f}  {cont:12.1f}  {name}{marker}")
+
+    only_base = set(baseline) - set(contender)
+    only_cont = set(contender) - set(baseline)
+    if only_base:
+        print(f"\n{len(only_base)} benchmark(s) only in baseline")
+    if only_cont:
+        print(f"{len(only_cont)} benchmark(s) only in contender")
+
+    if regressions:
+        print(
+            f"\n{regressions} benchmark(s) regressed more than "
+            f"{args.threshold:.0%}",
+            file=sys.stderr,
+        )
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
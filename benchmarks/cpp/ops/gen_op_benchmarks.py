@@ -0,0 +1,122 @@
+"""Generates Google-Benchmark cases for structured ATen operators.
+
+Walks native_functions.yaml and emits one benchmark per functional op that
+delegates to a structured kernel, provided every argument is either a plain
+Tensor or has a schema default. Each case calls the op through the dispatcher
+with tensors drawn from the shape/dtype grid in bench_ops_harness.h, so a
+TensorIterator (or other shared-infrastructure) regression shows up across
+the whole suite instead of on a production dashboard.
+
+Driven by CMake (see ../CMakeLists.txt, target `bench_ops`); can also be run
+by hand:
+
+    python benchmarks/cpp/ops/gen_op_benchmarks.py \
+        --native-functions-path aten/src/ATen/native/native_functions.yaml \
+        --tags-path aten/src/ATen/native/tags.yaml \
+        --output bench_ops_generated.cpp
+"""
+
+import argparse
+import sys
+from pathlib import Path
+from typing import List, Optional
+
+# Allow running from anywhere without installing torchgen.
+sys.path.insert(0, str(Path(__file__).resolve().parents[3]))
+
+from torchgen.api import cpp
+from torchgen.api.types.signatures import DispatcherSignature
+from torchgen.gen import parse_native_yaml
+from torchgen.model import BaseTy, BaseType, NativeFunction, SchemaKind
+
+# More tensor inputs than this and a uniform shape grid stops making sense
+# (e.g. addmm wants two matrix shapes plus a bias).
+MAX_TENSOR_ARGS = 2
+
+HEADER = """\
+// @generated by benchmarks/cpp/ops/gen_op_benchmarks.py from
+// aten/src/ATen/native/native_functions.yaml. Do not edit.
+#include <ATen/core/dispatch/Dispatcher.h>
+
+#include "ops/bench_ops_harness.h"
+
+namespace {
+"""
+
+FOOTER = """\
+} // namespace
+"""
+
+CASE = """\
+static void BM_{fn_name}(benchmark::State& state) {{
+  static auto op = c10::Dispatcher::singleton()
+      .findSchemaOrThrow("aten::{base_name}", "{overload_name}")
+      .typed<{sig_type}>();
+  op_bench::RunOp(state, {num_tensors}, [](const std::vector<at::Tensor>& ts) {{
+    return op.call({call_args});
+  }});
+}}
+BENCHMARK(BM_{fn_name})->Apply(op_bench::GridArgs)->Unit(benchmark::kMicrosecond);
+"""
+
+
+def benchmark_case(f: NativeFunction) -> Optional[str]:
+    if f.structured_delegate is None or f.func.kind() != SchemaKind.functional:
+        return None
+    returns = f.func.returns
+    if len(returns) != 1 or returns[0].type != BaseType(BaseTy.Tensor):
+        return None
+
+    call_args: List[str] = []
+    num_tensors = 0
+    for a in f.func.arguments.flat_all:
+        if a.type == BaseType(BaseTy.Tensor):
+            call_args.append(f"ts[{num_tensors}]")
+            num_tensors += 1
+        elif a.default is not None:
+            call_args.append(cpp.default_expr(a.default, a.type, symint=False))
+        else:
+            # No generic way to make up a value (dims, scalars without
+            # defaults, ...); leave this op to a hand-written benchmark.
+            return None
+    if num_tensors == 0 or num_tensors > MAX_TENSOR_ARGS:
+        return None
+
+    name = f.func.name
+    return CASE.format(
+        fn_name=str(name).replace(".", "_"),
+        base_name=name.name,
+        overload_name=name.overload_name,
+        sig_type=DispatcherSignature.from_schema(f.func).type(),
+        num_tensors=num_tensors,
+        call_args=", ".join(call_args),
+    )
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(
+        description="Generate operator microbenchmarks from native_functions.yaml"
+    )
+    parser.add_argument("--native-functions-path", required=True)
+    parser.add_argument("--tags-path", required=True)
+    parser.add_argument("--output", required=True)
+    args = parser.parse_args()
+
+    parsed = parse_native_yaml(args.native_functions_path, args.tags_path)
+    cases = []
+    for f in sorted(parsed.native_functions, key=lambda f: str(f.func.name)):
+        case = benchmark_case(f)
+        if case is not None:
+            cases.append(case)
+
+    with open(args.output, "w") as out:
+        out.write(HEADER)
+        out.write("\n")
+        out.write("\n".join(cases))
+        out.write("\n")
+        out.write(FOOTER)
+    print(f"Generated {len(cases)} operator benchmarks -> {args.output}")
+
+
+if __name__ == "__main__":
+    main()
@@ -170,6 +170,7 @@ GENERATED_H_CORE = [
     "MethodOperators.h",
     "core/aten_interned_strings.h",
     "core/enum_tag.h",
+    "core/static_operator_name_table.h",
 ]
 
 GENERATED_H_CUDA = [
@@ -2,8 +2,23 @@
 
 #include <c10/util/ThreadLocalDebugInfo.h>
 
+#include <atomic>
+
 namespace c10 {
 
+namespace {
+std::atomic<AllocationReportHook> allocation_report_hook{nullptr};
+std::atomic<OutOfMemoryReportHook> out_of_memory_report_hook{nullptr};
+} // namespace
+
+void SetAllocationReportHook(AllocationReportHook hook) {
+  allocation_report_hook.store(hook);
+}
+
+void SetOutOfMemoryReportHook(OutOfMemoryReportHook hook) {
+  out_of_memory_report_hook.store(hook);
+}
+
 static void deleteInefficientStdFunctionContext(void* ptr) {
   delete static_cast<InefficientStdFunctionContext*>(ptr);
 }
@@ -38,6 +53,9 @@ at::Allocator* GetAllocator(const at::DeviceType& t) {
 }
 
 bool memoryProfilingEnabled() {
+  if (allocation_report_hook.load(std::memory_order_relaxed) != nullptr) {
+    return true;
+  }
   auto* reporter_ptr = static_cast<MemoryReportingInfoBase*>(
       ThreadLocalDebugInfo::get(DebugInfoKind::PROFILER_STATE));
   return reporter_ptr && reporter_ptr->memoryProfilingEnabled();
@@ -49,6 +67,9 @@ void reportMemoryUsageToProfiler(
     size_t total_allocated,
     size_t total_reserved,
     Device device) {
+  if (auto* hook = allocation_report_hook.load(std::memory_order_relaxed)) {
+    hook(ptr, alloc_size, total_allocated, total_reserved, device);
+  }
   auto* reporter_ptr = static_cast<MemoryReportingInfoBase*>(
       ThreadLocalDebugInfo::get(DebugInfoKind::PROFILER_STATE));
   if (reporter_ptr) {
@@ -62,6 +83,9 @@ void reportOutOfMemoryToProfiler(
     size_t total_allocated,
     size_t total_reserved,
     Device device) {
+  if (auto* hook = out_of_memory_report_hook.load(std::memory_order_relaxed)) {
+    hook(alloc_size, total_allocated, total_reserved, device);
+  }
   auto* reporter_ptr = static_cast<MemoryReportingInfoBase*>(
       ThreadLocalDebugInfo::get(DebugInfoKind::PROFILER_STATE));
   if (reporter_ptr) {
@@ -266,4 +266,27 @@ C10_API void reportOutOfMemoryToProfiler(
     size_t total_reserved,
     Device device);
 
+// Process-wide observers for allocator events. Unlike the thread local
+// MemoryReportingInfoBase reporter, an installed hook fires on every thread,
+// which makes it suitable for standing tools such as the profiler's memory
+// flight recorder. Hooks must be safe to call concurrently and must not
+// allocate through the reporting allocator. Installing an allocation hook
+// also makes memoryProfilingEnabled() return true so allocators that gate
+// their reporting on it (e.g. the CPU allocator) start emitting events.
+// Pass nullptr to uninstall.
+using AllocationReportHook = void (*)(
+    void* ptr,
+    int64_t alloc_size,
+    size_t total_allocated,
+    size_t total_reserved,
+    Device device);
+using OutOfMemoryReportHook = void (*)(
+    int64_t alloc_size,
+    size_t total_allocated,
+    size_t total_reserved,
+    Device device);
+
+C10_API void SetAllocationReportHook(AllocationReportHook hook);
+C10_API void SetOutOfMemoryReportHook(OutOfMemoryReportHook hook);
+
 } // namespace c10
@@ -18,7 +18,8 @@ struct C10_API AutogradState {
       : grad_mode_(grad_mode),
         inference_mode_(inference_mode),
         fw_grad_mode_(fw_grad_mode),
-        mulithreading_enabled_(multithreading_enabled) {}
+        mulithreading_enabled_(multithreading_enabled),
+        pure_inference_(false) {}
 
   void set_grad_mode(bool enabled) {
     grad_mode_ = enabled;
@@ -40,6 +41,10 @@ struct C10_API AutogradState {
     view_replay_enabled_ = view_replay_enabled;
   }
 
+  void set_pure_inference(bool enabled) {
+    pure_inference_ = enabled;
+  }
+
   bool get_grad_mode() const {
     return grad_mode_;
   }
@@ -60,12 +65,19 @@ struct C10_API AutogradState {
     return view_replay_enabled_;
   }
 
+  // See Note [Pure inference fast path] in
+  // torch/csrc/autograd/pure_inference_mode.h
+  bool get_pure_inference() const {
+    return pure_inference_;
+  }
+
  private:
   bool grad_mode_ : 1;
   bool inference_mode_ : 1;
   bool fw_grad_mode_ : 1;
   bool mulithreading_enabled_ : 1;
   bool view_replay_enabled_ : 1;
+  bool pure_inference_ : 1;
 };
 
 } // namespace c10
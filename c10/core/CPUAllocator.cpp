@@ -7,6 +7,9 @@
 #include <c10/mobile/CPUProfilingAllocator.h>
 #include <c10/util/Logging.h>
 
+#include <memory>
+#include <unordered_map>
+
 // TODO: rename flag to C10
 C10_DEFINE_bool(
     caffe2_report_cpu_memory_usage,
@@ -144,6 +147,50 @@ class DefaultMobileCPUAllocator final : public at::Allocator {
   }
 };
 
+// Allocator pinned to a single NUMA node: allocations are mbind'ed to
+// that node instead of the node of the calling thread. Freeing is
+// placement-agnostic, so the default deleter is reused.
+struct C10_API NUMAPinnedCPUAllocator final : at::Allocator {
+  explicit NUMAPinnedCPUAllocator(int numa_node_id)
+      : numa_node_id_(numa_node_id) {}
+  at::DataPtr allocate(size_t nbytes) const override {
+    void* data = nullptr;
+    try {
+      data = c10::alloc_cpu(nbytes, numa_node_id_);
+    } catch (c10::Error& e) {
+      profiledCPUMemoryReporter().OutOfMemory(nbytes);
+      throw e;
+    }
+    profiledCPUMemoryReporter().New(data, nbytes);
+    return {
+        data,
+        data,
+        &DefaultCPUAllocator::ReportAndDelete,
+        at::Device(at::DeviceType::CPU)};
+  }
+
+  at::DeleterFnPtr raw_deleter() const override {
+    return &DefaultCPUAllocator::ReportAndDelete;
+  }
+
+ private:
+  int numa_node_id_;
+};
+
+at::Allocator* GetNUMAPinnedCPUAllocator(int numa_node_id) {
+  TORCH_CHECK(
+      numa_node_id >= 0, "Invalid NUMA node id: ", numa_node_id);
+  static std::mutex mutex;
+  static std::unordered_map<int, std::unique_ptr<NUMAPinnedCPUAllocator>>
+      allocators;
+  std::lock_guard<std::mutex> guard(mutex);
+  auto& allocator = allocators[numa_node_id];
+  if (!allocator) {
+    allocator = std::make_unique<NUMAPinnedCPUAllocator>(numa_node_id);
+  }
+  return allocator.get();
+}
+
 void NoDelete(void*) {}
 
 at::Allocator* GetCPUAllocator() {
@@ -44,6 +44,14 @@ C10_API void SetCPUAllocator(at::Allocator* alloc, uint8_t priority = 0);
 // Get the Default CPU Allocator
 C10_API at::Allocator* GetDefaultCPUAllocator();
 
+// Get a CPU allocator whose allocations are placed on the given NUMA
+// node, regardless of which thread allocates. Useful for giving
+// DataLoader workers or inference threads node-local tensor memory on
+// multi-socket hosts. Falls back to the default placement policy when
+// NUMA is unavailable. The returned allocator is owned by c10 and valid
+// for the lifetime of the process.
+C10_API at::Allocator* GetNUMAPinnedCPUAllocator(int numa_node_id);
+
 // Get the Default Mobile CPU Allocator
 C10_API at::Allocator* GetDefaultMobileCPUAllocator();
 
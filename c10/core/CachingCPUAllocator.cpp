@@ -0,0 +1,320 @@
+#include <c10/core/CachingCPUAllocator.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/core/alignment.h>
+#include <c10/core/impl/alloc_cpu.h>
+#include <c10/util/SmallVector.h>
+#include <c10/util/env.h>
+#include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
+#include <c10/util/numa.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace c10 {
+
+namespace {
+
+// Allocations are rounded up to the next power of two between
+// kMinBlockBytes and kMaxCachedBytes. Anything larger bypasses the cache
+// entirely; large blocks are rare and the underlying mmap-backed
+// allocation is not the contended path.
+constexpr size_t kMinBlockLog2 = 9; // 512 B
+constexpr size_t kMaxCachedLog2 = 26; // 64 MiB
+constexpr size_t kMinBlockBytes = size_t(1) << kMinBlockLog2;
+constexpr size_t kMaxCachedBytes = size_t(1) << kMaxCachedLog2;
+constexpr size_t kNumBuckets = kMaxCachedLog2 - kMinBlockLog2 + 1;
+
+// Cap on blocks parked in a single thread-local bucket before overflowing
+// to the global pool. Keeps per-thread retention bounded for threads that
+// free far more than they allocate (e.g. consumer threads in a pipeline).
+constexpr size_t kMaxBlocksPerThreadBucket = 8;
+
+// Each cached block is preceded by a header recording its bucket so the
+// (stateless) DataPtr deleter can route the block back to the right
+// freelist. The header is a full gAlignment so the pointer handed to the
+// user keeps SIMD alignment, mirroring DefaultMobileCPUAllocator's
+// pre-guard scheme.
+struct alignas(gAlignment) BlockHeader {
+  size_t bucket; // bucket index, or kNumBuckets for uncached blocks
+  int node; // NUMA node the block is bound to, -1 if NUMA is unavailable
+};
+static_assert(sizeof(BlockHeader) == gAlignment, "header breaks alignment");
+
+size_t size_to_bucket(size_t block_bytes) {
+  if (block_bytes <= kMinBlockBytes) {
+    return 0;
+  }
+  return llvm::Log2_64_Ceil(block_bytes) - kMinBlockLog2;
+}
+
+size_t bucket_to_size(size_t bucket) {
+  return kMinBlockBytes << bucket;
+}
+
+std::atomic<size_t> cached_bytes_{0};
+
+// Global per-bucket pools. Each bucket has its own mutex so threads
+// hitting different size classes do not contend. The two-generation
+// (available/stale) split implements trimming: the trimmer demotes
+// available blocks to stale and frees whatever was still stale, so a
+// block is only returned to the OS after a full interval without reuse.
+struct GlobalBucket {
+  std::mutex mutex;
+  c10::SmallVector<void*, 16> available;
+  c10::SmallVector<void*, 16> stale;
+};
+
+// Pools are partitioned by NUMA node so blocks freed on one socket are
+// never handed to threads on the other: on dual-socket inference hosts
+// cross-node tensor memory shows up directly as interconnect traffic.
+// Node -1 (NUMA unavailable) maps to a single partition.
+size_t num_node_partitions() {
+  static const size_t n = std::max(GetNumNUMANodes(), 1);
+  return n;
+}
+
+size_t node_partition(int node) {
+  return node >= 0 && static_cast<size_t>(node) < num_node_partitions()
+      ? static_cast<size_t>(node)
+      : 0;
+}
+
+// NUMA node of the calling thread, resolved once per thread. Inference
+// threads and DataLoader workers are expected to be node-pinned (e.g.
+// via NUMABind), so caching the lookup is safe and avoids a sched_getcpu
+// call per allocation.
+int current_thread_node() {
+  thread_local const int node = GetCurrentNUMANode();
+  return node;
+}
+
+std::array<GlobalBucket, kNumBuckets>& global_pools(int node) {
+  static auto* pools =
+      new std::vector<std::array<GlobalBucket, kNumBuckets>>(
+          num_node_partitions());
+  return (*pools)[node_partition(node)];
+}
+
+void os_free_block(void* base, size_t bucket) {
+  c10::free_cpu(base);
+  cached_bytes_.fetch_sub(
+      bucket_to_size(bucket) + sizeof(BlockHeader),
+      std::memory_order_relaxed);
+}
+
+void push_global(size_t bucket, int node, void* base) {
+  auto& pool = global_pools(node)[bucket];
+  std::lock_guard<std::mutex> guard(pool.mutex);
+  pool.available.push_back(base);
+}
+
+void* pop_global(size_t bucket, int node) {
+  auto& pool = global_pools(node)[bucket];
+  std::lock_guard<std::mutex> guard(pool.mutex);
+  if (!pool.available.empty()) {
+    return pool.available.pop_back_val();
+  }
+  if (!pool.stale.empty()) {
+    return pool.stale.pop_back_val();
+  }
+  return nullptr;
+}
+
+// Thread-local front cache. The destructor flushes surviving blocks to
+// the global pools so memory parked by exiting threads stays reusable.
+struct ThreadCache {
+  std::array<c10::SmallVector<void*, kMaxBlocksPerThreadBucket>, kNumBuckets>
+      buckets;
+
+  ~ThreadCache() {
+    for (const auto bucket : c10::irange(kNumBuckets)) {
+      for (void* base : buckets[bucket]) {
+        push_global(bucket, static_cast<BlockHeader*>(base)->node, base);
+      }
+    }
+  }
+};
+
+thread_local ThreadCache thread_cache_;
+
+// Background trimmer. Started lazily on the first cached allocation;
+// never joined (detached), matching how other c10 background threads
+// (e.g. the CUDACachingAllocator's) live for the process lifetime.
+std::once_flag trimmer_once_;
+
+void trim_pass() {
+  for (const auto node : c10::irange(num_node_partitions())) {
+    for (const auto bucket : c10::irange(kNumBuckets)) {
+      c10::SmallVector<void*, 16> to_free;
+      {
+        auto& pool = global_pools(static_cast<int>(node))[bucket];
+        std::lock_guard<std::mutex> guard(pool.mutex);
+        to_free = std::move(pool.stale);
+        pool.stale = std::move(pool.available);
+        pool.available.clear();
+      }
+      for (void* base : to_free) {
+        os_free_block(base, bucket);
+      }
+    }
+  }
+}
+
+void start_trimmer() {
+  std::call_once(trimmer_once_, []() {
+    std::thread trimmer([]() {
+      constexpr auto kTrimInterval = std::chrono::seconds(10);
+      while (true) {
+        std::this_thread::sleep_for(kTrimInterval);
+        trim_pass();
+      }
+    });
+    trimmer.detach();
+  });
+}
+
+struct CachingCPUAllocatorImpl final : at::Allocator {
+  at::DataPtr allocate(size_t nbytes) const override {
+    if (C10_UNLIKELY(nbytes == 0)) {
+      return {nullptr, nullptr, &ReportAndDelete, at::Device(DeviceType::CPU)};
+    }
+    const size_t bucket = size_to_bucket(nbytes);
+    void* base = nullptr;
+    if (C10_LIKELY(bucket < kNumBuckets)) {
+      auto& local = thread_cache_.buckets[bucket];
+      if (!local.empty()) {
+        base = local.pop_back_val();
+      } else {
+        base = pop_global(bucket, current_thread_node());
+      }
+      if (base != nullptr) {
+        cached_bytes_.fetch_sub(
+            bucket_to_size(bucket) + sizeof(BlockHeader),
+            std::memory_order_relaxed);
+      }
+    }
+    if (base == nullptr) {
+      const size_t alloc_bytes = bucket < kNumBuckets
+          ? bucket_to_size(bucket) + sizeof(BlockHeader)
+          : nbytes + sizeof(BlockHeader);
+      try {
+        base = c10::alloc_cpu(alloc_bytes);
+      } catch (c10::Error&) {
+        // Under memory pressure give everything cached back to the OS and
+        // retry once before surfacing the failure.
+        CachingCPUAllocator::emptyCache();
+        try {
+          base = c10::alloc_cpu(alloc_bytes);
+        } catch (c10::Error& e) {
+          profiledCPUMemoryReporter().OutOfMemory(nbytes);
+          throw e;
+        }
+      }
+      auto* header = static_cast<BlockHeader*>(base);
+      header->bucket = bucket < kNumBuckets ? bucket : kNumBuckets;
+      header->node = current_thread_node();
+      if (bucket < kNumBuckets) {
+        start_trimmer();
+      }
+    }
+    void* data = static_cast<uint8_t*>(base) + sizeof(BlockHeader);
+    profiledCPUMemoryReporter().New(data, nbytes);
+    return {data, base, &ReportAndDelete, at::Device(DeviceType::CPU)};
+  }
+
+  static void ReportAndDelete(void* base) {
+    if (C10_UNLIKELY(!base)) {
+      return;
+    }
+    void* data = static_cast<uint8_t*>(base) + sizeof(BlockHeader);
+    profiledCPUMemoryReporter().Delete(data);
+    const size_t bucket = static_cast<BlockHeader*>(base)->bucket;
+    if (C10_UNLIKELY(bucket >= kNumBuckets)) {
+      c10::free_cpu(base);
+      return;
+    }
+    cached_bytes_.fetch_add(
+        bucket_to_size(bucket) + sizeof(BlockHeader),
+        std::memory_order_relaxed);
+    // Only park the block thread-locally if it lives on this thread's
+    // node; otherwise hand it straight back to its home partition so it
+    // is reused by threads on that socket.
+    const int node = static_cast<BlockHeader*>(base)->node;
+    auto& local = thread_cache_.buckets[bucket];
+    if (node_partition(node) == node_partition(current_thread_node()) &&
+        local.size() < kMaxBlocksPerThreadBucket) {
+      local.push_back(base);
+    } else {
+      push_global(bucket, node, base);
+    }
+  }
+
+  at::DeleterFnPtr raw_deleter() const override {
+    return &ReportAndDelete;
+  }
+};
+
+CachingCPUAllocatorImpl g_caching_cpu_allocator;
+
+// Opt in via environment variable. Priority 1 outranks the default
+// allocator registered by CPUAllocator.cpp while still losing to an
+// explicit SetCPUAllocator call with a higher priority.
+struct EnvRegistrar {
+  EnvRegistrar() {
+    if (c10::utils::check_env("TORCH_CPU_CACHING_ALLOCATOR") == true) {
+      SetCPUAllocator(&g_caching_cpu_allocator, /*priority=*/1);
+    }
+  }
+};
+EnvRegistrar g_env_registrar;
+
+} // namespace
+
+Allocator* GetCachingCPUAllocator() {
+  return &g_caching_cpu_allocator;
+}
+
+namespace CachingCPUAllocator {
+
+void emptyCache() {
+  for (const auto bucket : c10::irange(kNumBuckets)) {
+    auto& local = thread_cache_.buckets[bucket];
+    for (void* base : local) {
+      os_free_block(base, bucket);
+    }
+    local.clear();
+  }
+  for (const auto node : c10::irange(num_node_partitions())) {
+    for (const auto bucket : c10::irange(kNumBuckets)) {
+      c10::SmallVector<void*, 16> to_free;
+      {
+        auto& pool = global_pools(static_cast<int>(node))[bucket];
+        std::lock_guard<std::mutex> guard(pool.mutex);
+        to_free = std::move(pool.available);
+        for (void* base : pool.stale) {
+          to_free.push_back(base);
+        }
+        pool.available.clear();
+        pool.stale.clear();
+      }
+      for (void* base : to_free) {
+        os_free_block(base, bucket);
+      }
+    }
+  }
+}
+
+size_t currentCachedBytes() {
+  return cached_bytes_.load(std::memory_order_relaxed);
+}
+
+} // namespace CachingCPUAllocator
+
+} // namespace c10
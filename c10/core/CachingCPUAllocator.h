@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+
+#include <c10/core/Allocator.h>
+#include <c10/macros/Export.h>
+
+/*
+ * CachingCPUAllocator:
+ * A size-bucketed caching allocator for CPU tensor memory.
+ *
+ * Why?
+ *   DefaultCPUAllocator pays a posix_memalign/free pair on every tensor
+ *   allocation. Eager-mode CPU inference allocates thousands of small,
+ *   short-lived intermediate tensors per request, so allocator overhead
+ *   (and malloc lock contention across inference threads) becomes a
+ *   measurable fraction of wall time. This allocator caches freed blocks
+ *   in power-of-two size buckets, with a small per-thread cache in front
+ *   of per-bucket global pools, so steady-state allocation is a
+ *   thread-local freelist pop.
+ *
+ * Memory that sits unused in the global pools is returned to the OS by a
+ * background trimmer thread using a two-generation scheme: blocks that
+ * survive a full trim interval without being reused are freed.
+ *
+ * Usage:
+ *   Set the environment variable TORCH_CPU_CACHING_ALLOCATOR=1, or install
+ *   explicitly:
+ *     c10::SetCPUAllocator(c10::GetCachingCPUAllocator(), priority);
+ *
+ * Unlike c10/mobile/CPUCachingAllocator.h (which is scope-guarded and
+ * caches exact sizes), this allocator is a drop-in c10::Allocator and is
+ * safe to install process-wide.
+ */
+
+namespace c10 {
+
+// Returns the process-wide caching CPU allocator instance.
+C10_API Allocator* GetCachingCPUAllocator();
+
+namespace CachingCPUAllocator {
+
+// Frees all cached blocks (global pools and the calling thread's cache)
+// back to the OS. Blocks currently in use are unaffected.
+C10_API void emptyCache();
+
+// Number of bytes currently held in caches (global pools plus all
+// thread-local caches), i.e. allocated from the OS but not handed out.
+C10_API size_t currentCachedBytes();
+
+} // namespace CachingCPUAllocator
+
+} // namespace c10
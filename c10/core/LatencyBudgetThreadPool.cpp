@@ -0,0 +1,171 @@
+#include <c10/core/LatencyBudgetThreadPool.h>
+
+#include <c10/util/Logging.h>
+#include <c10/util/irange.h>
+
+namespace c10 {
+
+namespace {
+
+// Queue-delay budget per class, in nanoseconds. Interactive has a zero
+// budget, so its tasks are "overdue" immediately and compete by raw wait
+// time; Default and Batch only enter the race once their head has waited
+// past the budget, i.e. they age into eligibility instead of starving.
+constexpr std::array<int64_t, kNumDeadlineClasses> kBudgetNs = {
+    0, // Interactive
+    10 * 1000 * 1000, // Default: 10ms
+    100 * 1000 * 1000, // Batch: 100ms
+};
+
+thread_local DeadlineClass tls_deadline_class = DeadlineClass::Default;
+
+std::atomic<QueueDelayObserver> queue_delay_observer{nullptr};
+
+} // namespace
+
+DeadlineClass currentDeadlineClass() {
+  return tls_deadline_class;
+}
+
+void setCurrentDeadlineClass(DeadlineClass cls) {
+  tls_deadline_class = cls;
+}
+
+void setQueueDelayObserver(QueueDelayObserver observer) {
+  queue_delay_observer.store(observer, std::memory_order_release);
+}
+
+LatencyBudgetThreadPool::LatencyBudgetThreadPool(
+    int pool_size,
+    int numa_node_id,
+    std::function<void()> init_thread)
+    : threads_(pool_size < 0 ? defaultNumThreads() : pool_size),
+      available_(threads_.size()) {
+  (void)numa_node_id; // NUMA binding happens in init_thread
+  for (auto& thread : threads_) {
+    thread = std::thread([this, init_thread]() {
+      if (init_thread) {
+        init_thread();
+      }
+      this->main_loop();
+    });
+  }
+}
+
+LatencyBudgetThreadPool::~LatencyBudgetThreadPool() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    running_ = false;
+    condition_.notify_all();
+  }
+  for (auto& t : threads_) {
+    try {
+      t.join();
+    } catch (const std::exception&) {
+    }
+  }
+}
+
+size_t LatencyBudgetThreadPool::size() const {
+  return threads_.size();
+}
+
+size_t LatencyBudgetThreadPool::numAvailable() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return available_;
+}
+
+bool LatencyBudgetThreadPool::inThreadPool() const {
+  for (auto& thread : threads_) {
+    if (thread.get_id() == std::this_thread::get_id()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void LatencyBudgetThreadPool::run(std::function<void()> func) {
+  if (threads_.empty()) {
+    throw std::runtime_error("No threads to run a task");
+  }
+  const auto cls = static_cast<size_t>(currentDeadlineClass());
+  std::lock_guard<std::mutex> guard(mutex_);
+  queues_[cls].push_back(Task{std::move(func), std::chrono::steady_clock::now()});
+  ++num_pending_;
+  condition_.notify_one();
+}
+
+DeadlineClass LatencyBudgetThreadPool::pop_task(Task& task) {
+  const auto now = std::chrono::steady_clock::now();
+  // Among overdue queue heads (wait > budget) pick the most overdue one;
+  // if nothing is overdue, pick the highest-priority non-empty queue.
+  // Interactive's zero budget makes it always overdue, so an interactive
+  // task only loses to lower-class work that has already blown its budget
+  // by more than the interactive task has waited at all.
+  size_t best = kNumDeadlineClasses;
+  int64_t best_overdue = 0;
+  size_t first_nonempty = kNumDeadlineClasses;
+  for (const auto cls : c10::irange(kNumDeadlineClasses)) {
+    if (queues_[cls].empty()) {
+      continue;
+    }
+    if (first_nonempty == kNumDeadlineClasses) {
+      first_nonempty = cls;
+    }
+    const int64_t wait_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            now - queues_[cls].front().enqueued)
+            .count();
+    const int64_t overdue = wait_ns - kBudgetNs[cls];
+    if (overdue >= 0 && (best == kNumDeadlineClasses || overdue > best_overdue)) {
+      best = cls;
+      best_overdue = overdue;
+    }
+  }
+  if (best == kNumDeadlineClasses) {
+    best = first_nonempty;
+  }
+  task = std::move(queues_[best].front());
+  queues_[best].pop_front();
+  --num_pending_;
+  return static_cast<DeadlineClass>(best);
+}
+
+void LatencyBudgetThreadPool::main_loop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (running_) {
+    condition_.wait(lock, [&]() { return num_pending_ > 0 || !running_; });
+    if (!running_) {
+      break;
+    }
+    Task task;
+    const auto cls = pop_task(task);
+    --available_;
+    lock.unlock();
+
+    if (auto* observer = queue_delay_observer.load(std::memory_order_acquire)) {
+      observer(
+          cls,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - task.enqueued)
+              .count());
+    }
+
+    // Run under the task's class so continuations it submits (from this
+    // thread) land in the same queue; same exception surface as ThreadPool.
+    setCurrentDeadlineClass(cls);
+    try {
+      task.fn();
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Exception in thread pool task: " << e.what();
+    } catch (...) {
+      LOG(ERROR) << "Exception in thread pool task: unknown";
+    }
+    task.fn = nullptr;
+
+    lock.lock();
+    ++available_;
+  }
+}
+
+} // namespace c10
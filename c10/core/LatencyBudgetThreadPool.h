@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <c10/core/thread_pool.h>
+
+namespace c10 {
+
+// Deadline class carried by inter-op tasks. Lower values are more latency
+// sensitive. The class of a task is sampled from the submitting thread
+// (see currentDeadlineClass) when it enters the pool, and a pool worker
+// adopts the class of the task it is running, so continuations spawned by
+// a task (e.g. the JIT interpreter re-launching itself after a future
+// completes) inherit the class of the work they continue.
+enum class DeadlineClass : uint8_t {
+  Interactive = 0,
+  Default = 1,
+  Batch = 2,
+};
+
+constexpr size_t kNumDeadlineClasses = 3;
+
+// The deadline class tasks submitted by the calling thread will carry.
+// Defaults to DeadlineClass::Default. Threads outside any pool (e.g. a
+// serving frontend) set this before calling at::launch / running a module.
+C10_API DeadlineClass currentDeadlineClass();
+C10_API void setCurrentDeadlineClass(DeadlineClass cls);
+
+// RAII scope for the calling thread's deadline class.
+struct C10_API DeadlineClassGuard {
+  explicit DeadlineClassGuard(DeadlineClass cls)
+      : prev_(currentDeadlineClass()) {
+    setCurrentDeadlineClass(cls);
+  }
+  ~DeadlineClassGuard() {
+    setCurrentDeadlineClass(prev_);
+  }
+  DeadlineClassGuard(const DeadlineClassGuard&) = delete;
+  DeadlineClassGuard& operator=(const DeadlineClassGuard&) = delete;
+
+ private:
+  DeadlineClass prev_;
+};
+
+// Invoked once per dequeued task with its class and the time it spent in
+// the queue, in nanoseconds. A plain function pointer (not std::function)
+// so installation is an atomic store and the read on the hot path is a
+// relaxed load. Installed by torch::monitor to export per-class
+// queue-delay stats without making c10 depend on the monitor API; see
+// torch/csrc/monitor/interop_latency.h.
+using QueueDelayObserver = void (*)(DeadlineClass, int64_t);
+C10_API void setQueueDelayObserver(QueueDelayObserver observer);
+
+/**
+ * A deadline-aware alternative to c10::ThreadPool for latency-SLO serving.
+ *
+ * When batch jobs share a process with interactive inference, a FIFO pool
+ * lets a burst of batch tasks queue ahead of an interactive request and
+ * inflate its tail latency. This pool keeps one FIFO queue per
+ * DeadlineClass and schedules by priority with aging: each class has a
+ * queue-delay budget, and a task whose delay exceeds its budget competes
+ * with higher classes by how overdue it is. Interactive work therefore
+ * wins while batch work is within budget, but batch work cannot starve --
+ * once its head task is sufficiently overdue it is scheduled even ahead
+ * of fresh interactive arrivals.
+ *
+ * All queues hang off a single mutex: the aging decision needs a global
+ * view of the queue heads, so per-worker deques (as in
+ * WorkStealingThreadPool) would not help, and admission-controlled
+ * serving workloads submit coarse tasks at rates where one mutex is not
+ * the bottleneck.
+ *
+ * Implements TaskThreadPoolBase, so it is a drop-in for TaskThreadPool in
+ * the ThreadPoolRegistry.
+ */
+class C10_API LatencyBudgetThreadPool : public TaskThreadPoolBase {
+ public:
+  LatencyBudgetThreadPool() = delete;
+
+  explicit LatencyBudgetThreadPool(
+      int pool_size,
+      int numa_node_id = -1,
+      std::function<void()> init_thread = nullptr);
+
+  ~LatencyBudgetThreadPool() override;
+
+  size_t size() const override;
+
+  size_t numAvailable() const override;
+
+  bool inThreadPool() const override;
+
+  // Enqueues under currentDeadlineClass() of the calling thread.
+  void run(std::function<void()> func) override;
+
+ private:
+  struct Task {
+    std::function<void()> fn;
+    std::chrono::steady_clock::time_point enqueued;
+  };
+
+  // @brief Entry point for pool threads.
+  void main_loop();
+
+  // Picks the next task per the aging policy. Caller must hold mutex_ and
+  // have checked that some queue is non-empty. Returns the task's class.
+  DeadlineClass pop_task(Task& task);
+
+  std::vector<std::thread> threads_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::array<std::deque<Task>, kNumDeadlineClasses> queues_;
+  size_t num_pending_{0};
+  size_t available_;
+  bool running_{true};
+};
+
+} // namespace c10
@@ -6,6 +6,8 @@
 
 #include <c10/util/intrusive_ptr.h>
 
+#include <algorithm>
+
 namespace c10 {
 
 // A storage represents the underlying backing data buffer for a
@@ -78,6 +80,7 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
     data_ptr_.clear();
     size_bytes_ = 0;
     size_bytes_is_symbolic_ = false;
+    capacity_bytes_ = 0;
   }
 
   template <typename T>
@@ -115,6 +118,29 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
     size_bytes_ = std::move(size_bytes);
   }
 
+  // True when capacity beyond nbytes() has been explicitly reserved (see
+  // at::native::reserve_bytes_cpu). Ordinary storages report false and
+  // keep their historical resize behavior.
+  bool is_capacity_reserved() const {
+    return capacity_bytes_ != 0;
+  }
+
+  // Number of bytes actually backed by data_ptr_; equal to nbytes() unless
+  // capacity was reserved. Resizes within this capacity can be
+  // metadata-only.
+  size_t capacity_bytes() const {
+    TORCH_CHECK(!size_bytes_is_symbolic_);
+    return std::max(
+        capacity_bytes_, static_cast<size_t>(size_bytes_.as_int_unchecked()));
+  }
+
+  // Records the allocated capacity backing data_ptr_; pass 0 to drop back
+  // to ordinary (unreserved) semantics. The caller is responsible for
+  // data_ptr_ actually holding this many bytes.
+  void set_capacity_bytes(size_t capacity_bytes) {
+    capacity_bytes_ = capacity_bytes;
+  }
+
   bool resizable() const {
     return resizable_;
   };
@@ -199,6 +225,7 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
     data_ptr_ = std::move(data_ptr);
     size_bytes_ = size_bytes;
     size_bytes_is_symbolic_ = false;
+    capacity_bytes_ = 0;
     allocator_ = nullptr;
     resizable_ = false;
   }
@@ -216,6 +243,9 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
  private:
   DataPtr data_ptr_;
   SymInt size_bytes_;
+  // Reserved capacity backing data_ptr_, or 0 when no capacity was
+  // reserved; see is_capacity_reserved().
+  size_t capacity_bytes_{0};
   bool size_bytes_is_symbolic_;
   bool resizable_;
   // Identifies that Storage was received from another process and doesn't have
@@ -10,6 +10,7 @@
 #include <c10/util/Optional.h>
 #include <c10/util/irange.h>
 
+#include <array>
 #include <utility>
 
 C10_DEFINE_bool(
@@ -25,6 +26,82 @@ C10_DEFINE_int64(
 
 namespace c10 {
 
+namespace {
+
+// Note [TensorImpl freelist]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every view, detach and factory call allocates a TensorImpl, and in
+// eager loops those impls are extremely short-lived: the one we are
+// about to allocate was very likely just freed by the previous
+// iteration.  Rather than bouncing each of them through the global
+// allocator, we keep a small per-thread stack of dead TensorImpl-sized
+// blocks and satisfy TensorImpl::operator new from it.  The list is
+// per-thread, so no locking is involved; blocks freed on a different
+// thread than they were allocated on simply migrate to the freeing
+// thread's list.  Only blocks of exactly sizeof(TensorImpl) are cached
+// (subclasses fall through to the global allocator), and the class-level
+// sized operator delete tells us the block size without any per-object
+// bookkeeping.
+//
+// The `alive_` flag handles thread shutdown: TLS destruction order is
+// unspecified, so a TensorImpl destroyed by a later TLS destructor must
+// not push onto an already-destroyed list.
+class TensorImplFreelist {
+ public:
+  void* pop() {
+    if (count_ == 0) {
+      return nullptr;
+    }
+    return blocks_[--count_];
+  }
+
+  bool push(void* ptr) {
+    if (!alive_ || count_ == kMaxBlocks) {
+      return false;
+    }
+    blocks_[count_++] = ptr;
+    return true;
+  }
+
+  ~TensorImplFreelist() {
+    alive_ = false;
+    while (count_ > 0) {
+      ::operator delete(blocks_[--count_]);
+    }
+  }
+
+ private:
+  // 256 impls is plenty to absorb the working set of an eager iteration
+  // while keeping the worst-case retained memory per thread small.
+  static constexpr size_t kMaxBlocks = 256;
+
+  bool alive_ = true;
+  size_t count_ = 0;
+  std::array<void*, kMaxBlocks> blocks_;
+};
+
+thread_local TensorImplFreelist tensor_impl_freelist;
+
+} // namespace
+
+void* TensorImpl::operator new(std::size_t nbytes) {
+  if (C10_LIKELY(nbytes == sizeof(TensorImpl))) {
+    if (void* recycled = tensor_impl_freelist.pop()) {
+      return recycled;
+    }
+  }
+  return ::operator new(nbytes);
+}
+
+void TensorImpl::operator delete(void* ptr, std::size_t nbytes) {
+  if (C10_LIKELY(nbytes == sizeof(TensorImpl))) {
+    if (tensor_impl_freelist.push(ptr)) {
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
 const char* const TensorImpl::err_msg_tensor_metadata_change_not_allowed =
     "is not allowed on a Tensor created from .data or .detach().\n"
     "If your intent is to change the metadata of a Tensor (such as sizes / strides / storage / storage_offset)\n"
@@ -1239,6 +1316,9 @@ void TensorImpl::empty_tensor_restride_symint(MemoryFormat memory_format) {
 
 namespace impl {
 
+// See Note [Names-in-use process latch]
+std::atomic<bool> named_tensors_in_use{false};
+
 namespace {
 AutogradMetaFactory* meta_factory = nullptr;
 } // namespace
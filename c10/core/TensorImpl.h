@@ -207,6 +207,28 @@ struct C10_API NamedTensorMetaInterface {
   };
 };
 
+namespace impl {
+
+// Note [Names-in-use process latch]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Most workloads never use named tensors, yet every op pays a couple of
+// dependent loads per operand (extra_meta_, then named_tensor_meta_) in
+// the has_names() checks guarding name propagation. This latch flips to
+// true the first time any tensor in the process is given dimension names
+// and never flips back (even if every named tensor is later destroyed);
+// while it is false, has_names() is a single predictable load of a
+// shared, read-mostly global. A one-way latch needs no synchronization
+// beyond the relaxed atomic: readers that race with the first set may
+// see false, but at that point the tensor being named cannot yet have
+// reached them.
+C10_API extern std::atomic<bool> named_tensors_in_use;
+
+inline bool were_names_ever_used() {
+  return named_tensors_in_use.load(std::memory_order_relaxed);
+}
+
+} // namespace impl
+
 // For ease of copy pasting
 #if 0
 is_contiguous
@@ -577,6 +599,18 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   TensorImpl(TensorImpl&&) = delete;
   TensorImpl& operator=(TensorImpl&&) = delete;
 
+  /**
+   * TensorImpls are recycled through a per-thread freelist instead of
+   * going back to the heap: every view / detach / factory call allocates
+   * one, and the malloc/free pair shows up prominently in eager
+   * profiles.  Only blocks of exactly sizeof(TensorImpl) are cached;
+   * subclasses (which inherit these operators but pass their own size)
+   * transparently fall through to the global allocator.  See
+   * Note [TensorImpl freelist] in TensorImpl.cpp.
+   */
+  static void* operator new(std::size_t nbytes);
+  static void operator delete(void* ptr, std::size_t nbytes);
+
   /**
    * Release (decref) storage, and any other external allocations.  This
    * override is for `intrusive_ptr_target` and is used to implement weak
@@ -1800,6 +1834,11 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
       }
       extra_meta_->named_tensor_meta_ = std::move(named_tensor_meta);
       key_set_ = key_set_.add(DispatchKey::Named);
+      // Latch before this tensor can be shared with other threads; see
+      // Note [Names-in-use process latch]
+      if (C10_UNLIKELY(!impl::were_names_ever_used())) {
+        impl::named_tensors_in_use.store(true, std::memory_order_relaxed);
+      }
     } else {
       if (extra_meta_) {
         extra_meta_->named_tensor_meta_ = nullptr;
@@ -0,0 +1,179 @@
+#include <c10/core/WorkStealingThreadPool.h>
+
+#include <c10/util/Logging.h>
+#include <c10/util/irange.h>
+
+namespace c10 {
+
+namespace {
+
+// Workers attempt this many full sweeps over the other workers' deques
+// before going to sleep, so short gaps between task bursts don't pay a
+// condition-variable round trip.
+constexpr size_t kStealAttemptsBeforeSleep = 2;
+
+// Cheap per-thread xorshift for victim selection; no need for the
+// quality (or the cost) of <random> here.
+uint32_t next_random(uint32_t& state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+thread_local int tls_worker_index = -1;
+
+} // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+    int pool_size,
+    int numa_node_id,
+    std::function<void()> init_thread)
+    : workers_(pool_size < 0 ? defaultNumThreads() : pool_size),
+      threads_(workers_.size()) {
+  (void)numa_node_id; // NUMA binding happens in init_thread
+  for (const auto i : c10::irange(threads_.size())) {
+    threads_[i] = std::thread([this, i, init_thread]() {
+      if (init_thread) {
+        init_thread();
+      }
+      tls_worker_index = static_cast<int>(i);
+      this->main_loop(i);
+    });
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  running_ = false;
+  {
+    std::lock_guard<std::mutex> guard(idle_mutex_);
+    idle_condition_.notify_all();
+  }
+  for (auto& t : threads_) {
+    try {
+      t.join();
+    } catch (const std::exception&) {
+    }
+  }
+}
+
+size_t WorkStealingThreadPool::size() const {
+  return threads_.size();
+}
+
+size_t WorkStealingThreadPool::numAvailable() const {
+  std::lock_guard<std::mutex> guard(idle_mutex_);
+  return num_idle_;
+}
+
+bool WorkStealingThreadPool::inThreadPool() const {
+  for (auto& thread : threads_) {
+    if (thread.get_id() == std::this_thread::get_id()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingThreadPool::run(std::function<void()> func) {
+  if (threads_.empty()) {
+    throw std::runtime_error("No threads to run a task");
+  }
+  // Submissions from a pool thread go to its own deque (the task is a
+  // continuation of what it is running, LIFO keeps it cache-hot).
+  // External submissions are spread round-robin.
+  size_t index = tls_worker_index >= 0
+      ? static_cast<size_t>(tls_worker_index)
+      : submit_counter_.fetch_add(1, std::memory_order_relaxed) %
+          workers_.size();
+  {
+    auto& worker = workers_[index];
+    std::lock_guard<std::mutex> guard(worker.mutex);
+    worker.tasks.push_back(std::move(func));
+  }
+  pending_tasks_.fetch_add(1, std::memory_order_release);
+  // Wake a sleeper only if someone is actually asleep; the idle mutex is
+  // off the fast path when all workers are busy.
+  {
+    std::lock_guard<std::mutex> guard(idle_mutex_);
+    if (num_idle_ > 0) {
+      idle_condition_.notify_one();
+    }
+  }
+}
+
+bool WorkStealingThreadPool::try_get_task(
+    size_t index,
+    std::function<void()>& task) {
+  // Own deque first, newest task first.
+  {
+    auto& own = workers_[index];
+    std::lock_guard<std::mutex> guard(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      return true;
+    }
+  }
+  if (workers_.size() == 1) {
+    return false;
+  }
+  // Steal from the front of a random victim, sweeping all workers from a
+  // random starting point so two thieves don't hammer the same victim.
+  thread_local uint32_t rng_state =
+      0x9e3779b9u ^ static_cast<uint32_t>(index + 1);
+  const size_t start = next_random(rng_state) % workers_.size();
+  for (const auto offset : c10::irange(workers_.size())) {
+    const size_t victim = (start + offset) % workers_.size();
+    if (victim == index) {
+      continue;
+    }
+    auto& worker = workers_[victim];
+    std::lock_guard<std::mutex> guard(worker.mutex);
+    if (!worker.tasks.empty()) {
+      task = std::move(worker.tasks.front());
+      worker.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingThreadPool::main_loop(size_t index) {
+  while (running_) {
+    std::function<void()> task;
+    bool found = false;
+    for (const auto attempt : c10::irange(kStealAttemptsBeforeSleep)) {
+      (void)attempt;
+      if (try_get_task(index, task)) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      std::unique_lock<std::mutex> lock(idle_mutex_);
+      ++num_idle_;
+      idle_condition_.wait(lock, [&]() {
+        return !running_ ||
+            pending_tasks_.load(std::memory_order_acquire) > 0;
+      });
+      --num_idle_;
+      continue;
+    }
+    pending_tasks_.fetch_sub(1, std::memory_order_acq_rel);
+
+    // Run the task with the same exception surface as ThreadPool; the
+    // task object is destroyed before the next dequeue so captured state
+    // (e.g. shared_ptrs) is released promptly.
+    try {
+      task();
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Exception in thread pool task: " << e.what();
+    } catch (...) {
+      LOG(ERROR) << "Exception in thread pool task: unknown";
+    }
+    task = nullptr;
+  }
+}
+
+} // namespace c10
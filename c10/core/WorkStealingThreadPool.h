@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <c10/core/thread_pool.h>
+
+namespace c10 {
+
+/**
+ * A work-stealing alternative to c10::ThreadPool.
+ *
+ * ThreadPool funnels every submission and every dequeue through a single
+ * mutex + condition variable, which collapses under the fine-grained task
+ * storms produced by the inter-op JIT executor (at::launch and interpreter
+ * continuations). This pool instead gives every worker its own deque:
+ * tasks submitted from a worker are pushed to, and popped from, the back
+ * of that worker's deque (LIFO, keeping continuation chains hot in cache),
+ * while idle workers steal from the front of a randomly chosen victim's
+ * deque (FIFO, taking the oldest and therefore likely largest piece of
+ * work). The only global synchronization left is an idle-sleep condition
+ * variable that is touched when a worker runs out of work to steal.
+ *
+ * Implements TaskThreadPoolBase, so it is a drop-in for TaskThreadPool in
+ * the ThreadPoolRegistry.
+ */
+class C10_API WorkStealingThreadPool : public TaskThreadPoolBase {
+ public:
+  WorkStealingThreadPool() = delete;
+
+  explicit WorkStealingThreadPool(
+      int pool_size,
+      int numa_node_id = -1,
+      std::function<void()> init_thread = nullptr);
+
+  ~WorkStealingThreadPool() override;
+
+  size_t size() const override;
+
+  size_t numAvailable() const override;
+
+  bool inThreadPool() const override;
+
+  void run(std::function<void()> func) override;
+
+ private:
+  // Per-worker task deque. The mutex is worker-local, so in the common
+  // case (owner pushing/popping its own tasks) it is uncontended; it only
+  // sees cross-thread traffic from occasional steals and external
+  // submissions.
+  struct alignas(64) Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  // @brief Entry point for pool threads.
+  void main_loop(size_t index);
+
+  // Pops from the owner's deque (back) or steals from a random victim
+  // (front). Returns false if no work was found anywhere.
+  bool try_get_task(size_t index, std::function<void()>& task);
+
+  std::vector<Worker> workers_;
+  std::vector<std::thread> threads_;
+
+  // Idle-sleep machinery; only touched when a worker has nothing to steal
+  // or a submitter needs to wake a sleeper.
+  mutable std::mutex idle_mutex_;
+  std::condition_variable idle_condition_;
+  size_t num_idle_{0};
+
+  std::atomic_bool running_{true};
+  std::atomic<size_t> submit_counter_{0};
+  std::atomic<size_t> pending_tasks_{0};
+};
+
+class C10_API WorkStealingTaskThreadPool : public WorkStealingThreadPool {
+ public:
+  explicit WorkStealingTaskThreadPool(
+      std::size_t pool_size,
+      int numa_node_id = -1)
+      : WorkStealingThreadPool(pool_size, numa_node_id, [numa_node_id]() {
+          setThreadName("CaffeTaskThread");
+          NUMABind(numa_node_id);
+        }) {}
+};
+
+} // namespace c10
@@ -1,8 +1,85 @@
 #include <c10/core/impl/SizesAndStrides.h>
 
+#include <array>
+
 namespace c10 {
 namespace impl {
 
+namespace {
+
+// Note [SizesAndStrides freelist]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Tensors with more than C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE dimensions
+// keep their sizes/strides in a heap block, and view ops copy that block
+// on every SizesAndStrides copy.  Since almost all such tensors still
+// have <= kMaxCachedDims dimensions, we allocate every block in that
+// range at one fixed capacity and recycle dead blocks through a small
+// per-thread stack, mirroring the TensorImpl freelist (see
+// Note [TensorImpl freelist] in TensorImpl.cpp, including the `alive_`
+// treatment of TLS destruction order).  Blocks above kMaxCachedDims are
+// sized exactly and bypass the cache.
+class StorageFreelist {
+ public:
+  int64_t* pop() {
+    if (count_ == 0) {
+      return nullptr;
+    }
+    return blocks_[--count_];
+  }
+
+  bool push(int64_t* ptr) {
+    if (!alive_ || count_ == kMaxBlocks) {
+      return false;
+    }
+    blocks_[count_++] = ptr;
+    return true;
+  }
+
+  ~StorageFreelist() {
+    alive_ = false;
+    while (count_ > 0) {
+      // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+      free(blocks_[--count_]);
+    }
+  }
+
+ private:
+  static constexpr size_t kMaxBlocks = 64;
+
+  bool alive_ = true;
+  size_t count_ = 0;
+  std::array<int64_t*, kMaxBlocks> blocks_;
+};
+
+thread_local StorageFreelist storage_freelist;
+
+} // namespace
+
+int64_t* SizesAndStrides::allocStorage(size_t size) {
+  if (C10_LIKELY(size <= kMaxCachedDims)) {
+    if (int64_t* recycled = storage_freelist.pop()) {
+      return recycled;
+    }
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  auto* storage = static_cast<int64_t*>(malloc(storageCapacityBytes(size)));
+  TORCH_CHECK(
+      storage, "Could not allocate memory for Tensor SizesAndStrides!");
+  return storage;
+}
+
+void SizesAndStrides::freeStorage(int64_t* storage, size_t size) {
+  // By the capacity invariant (see storageCapacityBytes), a block whose
+  // current size is <= kMaxCachedDims has exactly the cached capacity.
+  if (C10_LIKELY(size <= kMaxCachedDims)) {
+    if (storage_freelist.push(storage)) {
+      return;
+    }
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  free(storage);
+}
+
 void SizesAndStrides::resizeSlowPath(
     const size_t newSize,
     const size_t oldSize) {
@@ -19,20 +96,14 @@ void SizesAndStrides::resizeSlowPath(
         &inlineStorage_[C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE],
         &tempStorage[oldSize],
         C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE * sizeof(inlineStorage_[0]));
-    // CANNOT USE freeOutOfLineStorage() HERE! outOfLineStorage_
-    // HAS BEEN OVERWRITTEN!
-    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
-    free(tempStorage);
+    // NB: we saved outOfLineStorage_ into tempStorage above because the
+    // memcpys overwrite the union.
+    freeStorage(tempStorage, oldSize);
   } else {
     if (isInline()) {
       // CANNOT USE allocateOutOfLineStorage(newSize) HERE! WOULD
       // OVERWRITE inlineStorage_!
-      int64_t* tempStorage =
-          // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
-          static_cast<int64_t*>(malloc(storageBytes(newSize)));
-      TORCH_CHECK(
-          tempStorage,
-          "Could not allocate memory to change Tensor SizesAndStrides!");
+      int64_t* tempStorage = allocStorage(newSize);
       const auto bytesToCopy = oldSize * sizeof(inlineStorage_[0]);
       const auto bytesToZero = (newSize > oldSize)
           ? (newSize - oldSize) * sizeof(tempStorage[0])
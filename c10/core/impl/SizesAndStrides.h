@@ -37,7 +37,7 @@ class C10_API SizesAndStrides {
 
   ~SizesAndStrides() {
     if (C10_UNLIKELY(!isInline())) {
-      free(outOfLineStorage_);
+      freeStorage(outOfLineStorage_, size_);
     }
   }
 
@@ -56,7 +56,7 @@ class C10_API SizesAndStrides {
     }
     if (C10_LIKELY(rhs.isInline())) {
       if (C10_UNLIKELY(!isInline())) {
-        free(outOfLineStorage_);
+        freeStorage(outOfLineStorage_, size_);
       }
       copyDataInline(rhs);
     } else {
@@ -90,13 +90,13 @@ class C10_API SizesAndStrides {
     }
     if (C10_LIKELY(rhs.isInline())) {
       if (C10_UNLIKELY(!isInline())) {
-        free(outOfLineStorage_);
+        freeStorage(outOfLineStorage_, size_);
       }
       copyDataInline(rhs);
     } else {
       // They're outline. We're going to steal their vector.
       if (!isInline()) {
-        free(outOfLineStorage_);
+        freeStorage(outOfLineStorage_, size_);
       }
       outOfLineStorage_ = rhs.outOfLineStorage_;
       rhs.outOfLineStorage_ = nullptr;
@@ -277,17 +277,38 @@ class C10_API SizesAndStrides {
     return size * 2 * sizeof(int64_t);
   }
 
+  // Out-of-line blocks for up to kMaxCachedDims dimensions are allocated
+  // at a single fixed capacity so they can be recycled through a
+  // per-thread freelist; larger blocks are sized exactly and go straight
+  // to malloc/free.  See Note [SizesAndStrides freelist] in
+  // SizesAndStrides.cpp.  INVARIANT: an out-of-line block whose current
+  // size is <= kMaxCachedDims has capacity exactly
+  // storageBytes(kMaxCachedDims).
+  static constexpr size_t kMaxCachedDims = 8;
+
+  static size_t storageCapacityBytes(size_t size) noexcept {
+    return storageBytes(std::max(size, kMaxCachedDims));
+  }
+
+  // Defined in SizesAndStrides.cpp; allocStorage throws on allocation
+  // failure.
+  static int64_t* allocStorage(size_t size);
+  static void freeStorage(int64_t* storage, size_t size);
+
   void allocateOutOfLineStorage(size_t size) {
-    outOfLineStorage_ = static_cast<int64_t*>(malloc(storageBytes(size)));
-    TORCH_CHECK(
-        outOfLineStorage_,
-        "Could not allocate memory for Tensor SizesAndStrides!");
+    outOfLineStorage_ = allocStorage(size);
   }
 
   void resizeOutOfLineStorage(size_t newSize) {
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(!isInline());
-    outOfLineStorage_ = static_cast<int64_t*>(
-        realloc(outOfLineStorage_, storageBytes(newSize)));
+    // NB: size_ still holds the old size here; callers update it after.
+    const auto oldCapacity = storageCapacityBytes(size_);
+    const auto newCapacity = storageCapacityBytes(newSize);
+    if (oldCapacity == newCapacity) {
+      return;
+    }
+    outOfLineStorage_ =
+        static_cast<int64_t*>(realloc(outOfLineStorage_, newCapacity));
     TORCH_CHECK(
         outOfLineStorage_,
         "Could not allocate memory for Tensor SizesAndStrides!");
@@ -44,6 +44,10 @@ void memset_junk(void* data, size_t num) {
 } // namespace
 
 void* alloc_cpu(size_t nbytes) {
+  return alloc_cpu(nbytes, GetCurrentNUMANode());
+}
+
+void* alloc_cpu(size_t nbytes, int numa_node_id) {
   if (nbytes == 0) {
     return nullptr;
   }
@@ -83,8 +87,8 @@ void* alloc_cpu(size_t nbytes) {
       ")");
 #endif
 
-  // move data to a thread's NUMA node
-  NUMAMove(data, nbytes, GetCurrentNUMANode());
+  // move data to the requested NUMA node (by default, the thread's node)
+  NUMAMove(data, nbytes, numa_node_id);
   CHECK(
       !FLAGS_caffe2_cpu_allocator_do_zero_fill ||
       !FLAGS_caffe2_cpu_allocator_do_junk_fill)
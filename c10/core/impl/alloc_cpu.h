@@ -7,6 +7,10 @@
 namespace c10 {
 
 C10_API void* alloc_cpu(size_t nbytes);
+// Same as alloc_cpu, but places the allocation on the given NUMA node
+// instead of the node of the calling thread. A negative node id (or a
+// build without NUMA support) leaves placement to the OS.
+C10_API void* alloc_cpu(size_t nbytes, int numa_node_id);
 C10_API void free_cpu(void* data);
 
 } // namespace c10
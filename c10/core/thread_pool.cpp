@@ -1,7 +1,25 @@
 #include <c10/core/thread_pool.h>
+#include <c10/util/env.h>
 
 namespace c10 {
 
+namespace {
+
+// Number of times an idle worker polls for new work before parking on the
+// condition variable. Opt-in via TORCH_THREADPOOL_SPIN_POLL for
+// latency-critical deployments: a spinning worker picks up the next task
+// without a futex wakeup (and the core migration that often follows one),
+// at the cost of burning its core while idle.
+constexpr int kWorkerSpinIterations = 10000;
+
+bool spin_poll_enabled() {
+  static bool enabled =
+      c10::utils::check_env("TORCH_THREADPOOL_SPIN_POLL") == true;
+  return enabled;
+}
+
+} // namespace
+
 ThreadPool::ThreadPool(
     int pool_size,
     int numa_node_id,
@@ -65,6 +83,7 @@ void ThreadPool::run(std::function<void()> func) {
   // Set task and signal condition variable so that a worker thread will
   // wake up and use the task.
   tasks_.emplace(std::move(func));
+  num_pending_.fetch_add(1, std::memory_order_release);
   complete_ = false;
   condition_.notify_one();
 }
@@ -77,6 +96,20 @@ void ThreadPool::waitWorkComplete() {
 void ThreadPool::main_loop(std::size_t index) {
   std::unique_lock<std::mutex> lock(mutex_);
   while (running_) {
+    // In keep-warm mode, busy-poll for a bounded window before sleeping so
+    // a task submitted shortly after the last one is picked up by a still
+    // warm (and still pinned) core.
+    if (spin_poll_enabled() && tasks_.empty() && running_) {
+      lock.unlock();
+      for (int spin = 0; spin < kWorkerSpinIterations &&
+           num_pending_.load(std::memory_order_acquire) == 0 && running_;
+           ++spin) {
+        if ((spin & 63) == 63) {
+          std::this_thread::yield();
+        }
+      }
+      lock.lock();
+    }
     // Wait on condition variable while the task is empty and
     // the pool is still running.
     condition_.wait(lock, [&]() { return !tasks_.empty() || !running_; });
@@ -93,6 +126,7 @@ void ThreadPool::main_loop(std::size_t index) {
     {
       task_element_t tasks = std::move(tasks_.front());
       tasks_.pop();
+      num_pending_.fetch_sub(1, std::memory_order_relaxed);
       // Decrement count, indicating thread is no longer available.
       --available_;
 
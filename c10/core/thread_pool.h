@@ -69,6 +69,9 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
   std::size_t available_;
   std::size_t total_;
   int numa_node_id_;
+  // Lock-free mirror of tasks_.size(); lets idle workers busy-poll for new
+  // work without touching mutex_ (see main_loop).
+  std::atomic_size_t num_pending_{0};
 
  public:
   ThreadPool() = delete;
@@ -95,6 +98,7 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
     // Set task and signal condition variable so that a worker thread will
     // wake up and use the task.
     tasks_.emplace(static_cast<std::function<void(std::size_t)>>(task));
+    num_pending_.fetch_add(1, std::memory_order_release);
     complete_ = false;
     condition_.notify_one();
   }
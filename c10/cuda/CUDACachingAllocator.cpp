@@ -10,8 +10,19 @@
 #include <c10/util/llvmMathExtras.h>
 
 #include <cuda_runtime_api.h>
+
+#if defined(__linux__) && !defined(USE_ROCM) && defined(CUDART_VERSION) && \
+    CUDART_VERSION >= 11040
+#include <c10/cuda/driver_api.h>
+// Expandable segments (cuMemAddressReserve/cuMemMap) need the CUDA VMM
+// driver API, which we only wire up for Linux builds against CUDA >= 11.4.
+#define PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+#endif
+
 #include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <chrono>
 #include <cstdint>
 #include <deque>
 #include <iterator>
@@ -29,6 +40,115 @@ C10_DEFINE_REGISTRY(FreeCudaMemoryCallbacksRegistry, FreeMemoryCallback);
 
 namespace cuda {
 namespace CUDACachingAllocator {
+
+// --- Allocator telemetry ring buffer -----------------------------------
+//
+// A fixed-size ring of alloc/free/segment events, written lock-free from
+// the allocation hot path and drained asynchronously (see the API notes
+// in CUDACachingAllocator.h). Each slot is a miniature seqlock: a writer
+// claims slot (idx % N) by publishing sequence number 2*idx+1 (write in
+// progress), fills the payload, then publishes 2*idx+2. A reader accepts
+// the slot only if it observes exactly 2*idx+2 after copying, so torn or
+// overwritten slots are detected and counted as dropped rather than
+// surfaced with garbage contents.
+
+namespace {
+
+constexpr size_t kTelemetryRingSize = 1 << 16; // must be a power of two
+
+struct TelemetrySlot {
+  std::atomic<uint64_t> seq{0};
+  TelemetryEvent event;
+};
+
+std::atomic<bool> telemetry_enabled{true};
+std::atomic<uint64_t> telemetry_write_idx{0};
+std::atomic<uint64_t> telemetry_dropped{0};
+
+TelemetrySlot* telemetry_ring() {
+  // Leaked intentionally: events may be recorded from exit handlers.
+  static TelemetrySlot* ring = new TelemetrySlot[kTelemetryRingSize];
+  return ring;
+}
+
+uint64_t telemetry_now_ns() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+} // namespace
+
+void record_telemetry(
+    TelemetryEvent::Kind kind,
+    int device,
+    const void* addr,
+    size_t size,
+    cudaStream_t stream) {
+  if (!telemetry_enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  const uint64_t idx =
+      telemetry_write_idx.fetch_add(1, std::memory_order_relaxed);
+  TelemetrySlot& slot = telemetry_ring()[idx & (kTelemetryRingSize - 1)];
+  slot.seq.store(2 * idx + 1, std::memory_order_release);
+  slot.event.kind = kind;
+  slot.event.device = static_cast<int32_t>(device);
+  slot.event.addr = reinterpret_cast<uint64_t>(addr);
+  slot.event.size = static_cast<uint64_t>(size);
+  slot.event.stream = reinterpret_cast<uint64_t>(stream);
+  slot.event.timestamp_ns = telemetry_now_ns();
+  slot.seq.store(2 * idx + 2, std::memory_order_release);
+}
+
+void setTelemetryEnabled(bool enabled) {
+  telemetry_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool telemetryEnabled() {
+  return telemetry_enabled.load(std::memory_order_relaxed);
+}
+
+std::vector<TelemetryEvent> drainTelemetry() {
+  // The reader mutex only serializes concurrent drainers; writers never
+  // touch it.
+  static std::mutex reader_mutex;
+  static uint64_t read_cursor = 0;
+  std::lock_guard<std::mutex> guard(reader_mutex);
+
+  const uint64_t end = telemetry_write_idx.load(std::memory_order_acquire);
+  uint64_t begin = read_cursor;
+  if (end > kTelemetryRingSize && begin < end - kTelemetryRingSize) {
+    // Ring wrapped since the last drain; the overwritten prefix is gone.
+    telemetry_dropped.fetch_add(
+        (end - kTelemetryRingSize) - begin, std::memory_order_relaxed);
+    begin = end - kTelemetryRingSize;
+  }
+  std::vector<TelemetryEvent> result;
+  result.reserve(end - begin);
+  for (uint64_t idx = begin; idx < end; ++idx) {
+    TelemetrySlot& slot = telemetry_ring()[idx & (kTelemetryRingSize - 1)];
+    if (slot.seq.load(std::memory_order_acquire) != 2 * idx + 2) {
+      // Writer still in flight or slot already recycled.
+      telemetry_dropped.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+    TelemetryEvent copy = slot.event;
+    if (slot.seq.load(std::memory_order_acquire) != 2 * idx + 2) {
+      telemetry_dropped.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+    result.push_back(copy);
+  }
+  read_cursor = end;
+  return result;
+}
+
+uint64_t telemetryDroppedEvents() {
+  return telemetry_dropped.load(std::memory_order_relaxed);
+}
+
 namespace Native {
 
 //
@@ -160,6 +280,7 @@ void update_stat_array(
 
 struct Block;
 struct PrivatePool;
+struct ExpandableSegment;
 typedef bool (*Comparison)(const Block*, const Block*);
 
 struct BlockPool {
@@ -193,6 +314,8 @@ struct Block {
   int event_count{0}; // number of outstanding CUDA events
   int gc_count{0}; // counter for prioritizing older / less useful blocks for
                    // garbage collection
+  ExpandableSegment* expandable_segment_{nullptr}; // owning expandable
+                                                   // segment, if any
   std::unique_ptr<HistoryChain> history;
   HistoryChain* history_last{nullptr};
 
@@ -223,6 +346,165 @@ struct Block {
   }
 };
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+/*
+Note [Expandable Segments]
+
+A conventional segment is a fixed-size cudaMalloc carve-out: once the
+allocator splits it, freed space can only be reused by allocations that
+fit the resulting holes, and long-running jobs with varying activation
+sizes eventually OOM on fragmentation even though plenty of bytes are
+free in aggregate.
+
+An expandable segment instead reserves a large virtual address range up
+front (cuMemAddressReserve, sized to the device's total memory) and maps
+physical memory into it on demand in granularity-sized chunks
+(cuMemCreate + cuMemMap). When an allocation does not fit in the cached
+blocks of the segment, the segment grows in place at its mapped end: if
+the last block before the unmapped tail is free, only the difference is
+mapped and that block is extended, so requests larger than any cached
+hole no longer force a brand-new disjoint segment. Blocks inside the
+segment split and merge through the allocator's usual machinery since
+they are plain VA-contiguous ranges.
+
+The end of the mapped region is marked by a placeholder Block (allocated
+= true, size = 0, never in a BlockPool) so the grow path can find the
+trailing free block in O(1) and so ordinary block merging can never run
+past the mapped boundary. Physical memory of a segment is returned to
+the system by release_expandable_segments() (empty_cache) once the whole
+segment has coalesced into a single free block.
+
+Enabled with PYTORCH_CUDA_ALLOC_CONF=expandable_segments:True.
+*/
+struct ExpandableSegment {
+  ExpandableSegment(int device, cudaStream_t stream, size_t max_size)
+      : device_(device), stream_(stream), max_size_(max_size) {
+    CUmemAllocationProp prop = {};
+    prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+    prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    prop.location.id = device_;
+    auto* api = DriverAPI::get();
+    C10_CUDA_DRIVER_CHECK(api->cuMemGetAllocationGranularity_(
+        &granularity_, &prop, CU_MEM_ALLOC_GRANULARITY_RECOMMENDED));
+    max_size_ = round_up(max_size_);
+    C10_CUDA_DRIVER_CHECK(
+        api->cuMemAddressReserve_(&ptr_, max_size_, 0, 0, 0));
+  }
+  ExpandableSegment(const ExpandableSegment&) = delete;
+  ExpandableSegment& operator=(const ExpandableSegment&) = delete;
+
+  // Maps at least `size` more bytes at the end of the mapped region.
+  // On success, rounds `size` up to the granted (granularity-aligned)
+  // amount and returns a pointer to the start of the new mapping; returns
+  // nullptr (leaving the segment unchanged) if the VA space is exhausted
+  // or physical memory cannot be allocated.
+  char* grow(size_t& size) {
+    const size_t requested = round_up(size);
+    if (requested == 0 || mapped_size_ + requested > max_size_) {
+      return nullptr;
+    }
+    auto* api = DriverAPI::get();
+    CUmemAllocationProp prop = {};
+    prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+    prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    prop.location.id = device_;
+    size_t mapped = 0;
+    while (mapped < requested) {
+      CUmemGenericAllocationHandle handle = 0;
+      auto status = api->cuMemCreate_(&handle, granularity_, &prop, 0);
+      if (status != CUDA_SUCCESS) {
+        break;
+      }
+      status = api->cuMemMap_(
+          ptr_ + mapped_size_ + mapped, granularity_, 0, handle, 0);
+      if (status != CUDA_SUCCESS) {
+        api->cuMemRelease_(handle);
+        break;
+      }
+      handles_.push_back(handle);
+      mapped += granularity_;
+    }
+    if (mapped < requested) {
+      // Roll back the partial mapping; the caller falls over to the
+      // regular (cudaMalloc) path and its OOM handling.
+      unmap_trailing(mapped);
+      return nullptr;
+    }
+    CUmemAccessDesc desc = {};
+    desc.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    desc.location.id = device_;
+    desc.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+    C10_CUDA_DRIVER_CHECK(
+        api->cuMemSetAccess_(ptr_ + mapped_size_, mapped, &desc, 1));
+    char* result = begin() + mapped_size_;
+    mapped_size_ += mapped;
+    size = mapped;
+    return result;
+  }
+
+  char* begin() const {
+    return reinterpret_cast<char*>(static_cast<uintptr_t>(ptr_));
+  }
+  char* mapped_end() const {
+    return begin() + mapped_size_;
+  }
+  size_t mapped_size() const {
+    return mapped_size_;
+  }
+  cudaStream_t stream() const {
+    return stream_;
+  }
+
+  ~ExpandableSegment() {
+    unmap_all();
+    DriverAPI::get()->cuMemAddressFree_(ptr_, max_size_);
+  }
+
+  // End-of-mapped-region marker; owned by DeviceCachingAllocator. See
+  // Note [Expandable Segments].
+  Block* placeholder_{nullptr};
+
+ private:
+  size_t round_up(size_t size) const {
+    return granularity_ > 0
+        ? ((size + granularity_ - 1) / granularity_) * granularity_
+        : size;
+  }
+
+  // Unmaps and releases `bytes` worth of handles mapped beyond
+  // mapped_size_ (used only to roll back a failed grow).
+  void unmap_trailing(size_t bytes) {
+    auto* api = DriverAPI::get();
+    while (bytes > 0) {
+      bytes -= granularity_;
+      api->cuMemUnmap_(ptr_ + mapped_size_ + bytes, granularity_);
+      api->cuMemRelease_(handles_.back());
+      handles_.pop_back();
+    }
+  }
+
+  void unmap_all() {
+    auto* api = DriverAPI::get();
+    if (mapped_size_ > 0) {
+      api->cuMemUnmap_(ptr_, mapped_size_);
+    }
+    for (auto handle : handles_) {
+      api->cuMemRelease_(handle);
+    }
+    handles_.clear();
+    mapped_size_ = 0;
+  }
+
+  int device_;
+  cudaStream_t stream_;
+  CUdeviceptr ptr_{};
+  size_t granularity_{0};
+  size_t mapped_size_{0};
+  size_t max_size_;
+  std::vector<CUmemGenericAllocationHandle> handles_;
+};
+#endif // PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+
 static bool BlockComparator(const Block* a, const Block* b) {
   if (a->stream != b->stream) {
     return (uintptr_t)a->stream < (uintptr_t)b->stream;
@@ -396,6 +678,14 @@ class CachingAllocatorConfig {
     return instance().m_garbage_collection_threshold;
   }
 
+  static bool expandable_segments() {
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+    return instance().m_expandable_segments;
+#else
+    return false;
+#endif
+  }
+
   // This is used to round-up allocation size to nearest power of 2 divisions.
   // More description below in function roundup_power2_next_division
   // As ane example, if we want 4 divisions between 2's power, this can be done
@@ -435,7 +725,8 @@ class CachingAllocatorConfig {
  private:
   CachingAllocatorConfig()
       : m_max_split_size(std::numeric_limits<size_t>::max()),
-        m_garbage_collection_threshold(0) {
+        m_garbage_collection_threshold(0),
+        m_expandable_segments(false) {
     m_roundup_power2_divisions.assign(Native::kRoundUpPowerOfTwoIntervals, 0);
   }
 
@@ -456,9 +747,14 @@ class CachingAllocatorConfig {
       size_t i,
       bool& used_cudaMallocAsync);
 
+  size_t parseExpandableSegments(
+      const std::vector<std::string>& config,
+      size_t i);
+
   std::atomic<size_t> m_max_split_size;
   std::vector<size_t> m_roundup_power2_divisions;
   std::atomic<double> m_garbage_collection_threshold;
+  std::atomic<bool> m_expandable_segments;
 };
 
 void CachingAllocatorConfig::lexArgs(
@@ -613,6 +909,30 @@ size_t CachingAllocatorConfig::parseRoundUpPower2Divisions(
   return i;
 }
 
+size_t CachingAllocatorConfig::parseExpandableSegments(
+    const std::vector<std::string>& config,
+    size_t i) {
+  consumeToken(config, ++i, ':');
+  if (++i < config.size()) {
+    TORCH_CHECK(
+        config[i] == "True" || config[i] == "False",
+        "Expected a single True/False argument for expandable_segments");
+    const bool enabled = (config[i] == "True");
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+    m_expandable_segments = enabled;
+#else
+    if (enabled) {
+      TORCH_WARN(
+          "expandable_segments not supported on this platform (requires "
+          "Linux and CUDA >= 11.4), falling back to fixed segments");
+    }
+#endif
+  } else {
+    TORCH_CHECK(false, "Error, expecting expandable_segments value", "");
+  }
+  return i;
+}
+
 size_t CachingAllocatorConfig::parseAllocatorConfig(
     const std::vector<std::string>& config,
     size_t i,
@@ -676,6 +996,9 @@ void CachingAllocatorConfig::parseArgs(const char* env) {
     } else if (config[i].compare("roundup_power2_divisions") == 0) {
       i = parseRoundUpPower2Divisions(config, i);
       used_native_specific_option = true;
+    } else if (config[i].compare("expandable_segments") == 0) {
+      i = parseExpandableSegments(config, i);
+      used_native_specific_option = true;
     } else if (config[i].compare("backend") == 0) {
       i = parseAllocatorConfig(config, i, used_cudaMallocAsync);
     } else {
@@ -726,6 +1049,14 @@ class DeviceCachingAllocator {
       std::deque<std::pair<EventPool::Event, Block*>>>
       cuda_events;
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+  // One expandable segment per allocation stream; grown on demand when
+  // the cached blocks inside it can't satisfy a request. See Note
+  // [Expandable Segments].
+  ska::flat_hash_map<cudaStream_t, std::unique_ptr<ExpandableSegment>>
+      expandable_segments_;
+#endif
+
   // record used memory.
   size_t total_allocated_memory = 0;
 
@@ -879,6 +1210,9 @@ class DeviceCachingAllocator {
       }
       stats.num_ooms += 1;
 
+      record_telemetry(
+          TelemetryEvent::Kind::OOM, device, nullptr, params.size(), stream);
+
       c10::reportOutOfMemoryToProfiler(
           size,
           stats.allocated_bytes[static_cast<int64_t>(StatType::AGGREGATE)]
@@ -960,6 +1294,7 @@ class DeviceCachingAllocator {
       remaining = block;
 
       block = new Block(device, stream, size, &pool, block->ptr);
+      block->expandable_segment_ = remaining->expandable_segment_;
       block->prev = remaining->prev;
       if (block->prev) {
         block->prev->next = block;
@@ -1047,12 +1382,26 @@ class DeviceCachingAllocator {
         stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)].current,
         c10::Device(c10::DeviceType::CUDA, device));
 
+    record_telemetry(
+        TelemetryEvent::Kind::ALLOC,
+        block->device,
+        block->ptr,
+        orig_size,
+        block->stream);
+
     return block;
   }
 
   void free(Block* block) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
 
+    record_telemetry(
+        TelemetryEvent::Kind::FREE,
+        block->device,
+        block->ptr,
+        block->requested_size,
+        block->stream);
+
     block->allocated = false;
 
     // following logic might modifying underlaying Block, causing the size
@@ -1680,6 +2029,21 @@ class DeviceCachingAllocator {
       stats.num_alloc_retries += 1;
     }
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+    // Expandable segments only back the ordinary large pool: small-pool
+    // churn is already handled well by fixed segments, and graph private
+    // pools / capture need cudaMalloc semantics.
+    if (CachingAllocatorConfig::expandable_segments() && !p.pool->is_small &&
+        !p.pool->owner_PrivatePool && captures_underway == 0) {
+      if (alloc_expandable_block(p)) {
+        return true;
+      }
+      // Otherwise fall through to the cudaMalloc path (e.g. VA space
+      // exhausted, or physical memory temporarily unavailable) so the
+      // caller's cache-release/retry ladder still applies.
+    }
+#endif
+
     if (set_fraction &&
         total_allocated_memory + size > allowed_memory_maximum) {
       p.err = cudaErrorMemoryAllocation;
@@ -1722,9 +2086,169 @@ class DeviceCachingAllocator {
 
     // p.block came from new, not cudaMalloc. It should not be nullptr here.
     TORCH_INTERNAL_ASSERT(p.block != nullptr && p.block->ptr != nullptr);
+    record_telemetry(
+        TelemetryEvent::Kind::SEGMENT_ALLOC,
+        p.device(),
+        p.block->ptr,
+        size,
+        p.stream());
     return true;
   }
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+  // Satisfies p by growing the stream's expandable segment at its mapped
+  // end, extending the trailing free block in place when there is one.
+  // Returns false (without touching p.err) when the segment cannot grow.
+  bool alloc_expandable_block(AllocParams& p) {
+    const size_t size = p.alloc_size;
+    if (set_fraction &&
+        total_allocated_memory + size > allowed_memory_maximum) {
+      return false;
+    }
+    auto& segment = expandable_segments_[p.stream()];
+    bool created = false;
+    if (!segment) {
+      created = true;
+      size_t device_free = 0;
+      size_t device_total = 0;
+      C10_CUDA_CHECK(cudaMemGetInfo(&device_free, &device_total));
+      try {
+        segment = std::make_unique<ExpandableSegment>(
+            p.device(), p.stream(), device_total);
+      } catch (c10::Error&) {
+        // VA reservation failed (e.g. exotic driver restrictions); behave
+        // as if the mode were off for this stream.
+        expandable_segments_.erase(p.stream());
+        return false;
+      }
+      auto* placeholder =
+          new Block(p.device(), p.stream(), 0, p.pool, segment->mapped_end());
+      // Marked allocated so try_merge_blocks never subsumes it; it is
+      // never in a BlockPool and never visible to free().
+      placeholder->allocated = true;
+      placeholder->expandable_segment_ = segment.get();
+      segment->placeholder_ = placeholder;
+    }
+    Block* placeholder = segment->placeholder_;
+    Block* tail = placeholder->prev;
+    // Grow in place into the trailing free block when possible, so a
+    // request larger than every cached hole maps only the difference.
+    const bool grow_tail = tail != nullptr && !tail->allocated &&
+        tail->event_count == 0 && tail->stream_uses.empty() &&
+        tail->size < size;
+    size_t granted = grow_tail ? size - tail->size : size;
+    char* grown = segment->grow(granted);
+    if (grown == nullptr) {
+      if (created) {
+        // Don't keep an empty segment (and its VA reservation) around if
+        // we couldn't even map the first allocation into it.
+        delete segment->placeholder_;
+        expandable_segments_.erase(p.stream());
+      }
+      return false;
+    }
+    if (created) {
+      for_each_selected_stat_type(p.stat_types, [&](size_t stat_type) {
+        update_stat(stats.segment[stat_type], 1);
+      });
+    }
+    total_allocated_memory += granted;
+    Block* block;
+    if (grow_tail) {
+      auto erased = p.pool->blocks.erase(tail);
+      TORCH_INTERNAL_ASSERT(erased == 1);
+      tail->size += granted;
+      block = tail;
+    } else {
+      block = new Block(p.device(), p.stream(), granted, p.pool, grown);
+      block->prev = placeholder->prev;
+      if (block->prev) {
+        block->prev->next = block;
+      }
+      block->next = placeholder;
+      placeholder->prev = block;
+      block->expandable_segment_ = segment.get();
+    }
+    placeholder->ptr = segment->mapped_end();
+    record_telemetry(
+        TelemetryEvent::Kind::SEGMENT_ALLOC,
+        p.device(),
+        grown,
+        granted,
+        p.stream());
+    for_each_selected_stat_type(p.stat_types, [&](size_t stat_type) {
+      update_stat(
+          stats.reserved_bytes[stat_type], static_cast<std::int64_t>(granted));
+      // Blocks inside an expandable segment are always "split" (their
+      // next is at least the placeholder). The caller's bookkeeping will
+      // subtract the full block as an inactive split becoming active, so
+      // pre-balance the portion that was never accounted as inactive.
+      update_stat(
+          stats.inactive_split_bytes[stat_type],
+          static_cast<std::int64_t>(granted));
+      if (!grow_tail) {
+        update_stat(stats.inactive_split[stat_type], 1);
+      }
+    });
+    p.block = block;
+    p.err = cudaSuccess;
+    return true;
+  }
+
+  // Returns whole expandable segments to the system once every byte of
+  // them has coalesced back into a single free block.
+  void release_expandable_segments() {
+    for (auto it = expandable_segments_.begin();
+         it != expandable_segments_.end();) {
+      ExpandableSegment* segment = it->second.get();
+      Block* placeholder = segment->placeholder_;
+      Block* head = placeholder->prev;
+      if (head == nullptr || head->prev != nullptr || head->allocated ||
+          head->event_count > 0 || !head->stream_uses.empty()) {
+        ++it;
+        continue;
+      }
+      TORCH_INTERNAL_ASSERT_DEBUG_ONLY(head->size == segment->mapped_size());
+      record_telemetry(
+          TelemetryEvent::Kind::SEGMENT_FREE,
+          head->device,
+          head->ptr,
+          head->size,
+          head->stream);
+      auto& pool = *head->pool;
+      auto erased = pool.blocks.erase(head);
+      TORCH_INTERNAL_ASSERT(erased == 1);
+      total_allocated_memory -= head->size;
+      StatTypes stat_types = {false};
+      stat_types[static_cast<size_t>(StatType::AGGREGATE)] = true;
+      stat_types[static_cast<size_t>(get_stat_type_for_pool(pool))] = true;
+      for_each_selected_stat_type(stat_types, [&](size_t stat_type) {
+        update_stat(stats.segment[stat_type], -1);
+        update_stat(
+            stats.reserved_bytes[stat_type],
+            -static_cast<std::int64_t>(head->size));
+        // The lone free block was still accounted as an inactive split
+        // because of the placeholder link.
+        update_stat(stats.inactive_split[stat_type], -1);
+        update_stat(
+            stats.inactive_split_bytes[stat_type],
+            -static_cast<std::int64_t>(head->size));
+      });
+      if (head->history) {
+        record_trace(
+            TraceEntry::SEGMENT_FREE,
+            int64_t(head->ptr),
+            head->size,
+            head->stream,
+            head->history->h.context);
+      }
+      delete head;
+      delete placeholder;
+      it = expandable_segments_.erase(it);
+    }
+  }
+#endif // PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+
   /** Free one or more oversize blocks to the system allocator.  But only enough
    * **/
   /** to satisfy the target size **/
@@ -1745,7 +2269,8 @@ class DeviceCachingAllocator {
         ? CachingAllocatorConfig::max_split_size()
         : key.size;
     auto it = pool.blocks.lower_bound(&key);
-    if (it == pool.blocks.end() || (*it)->stream != p.stream()) {
+    if (it == pool.blocks.end() || (*it)->stream != p.stream() ||
+        (*it)->expandable_segment_) {
       // No single block is large enough; free multiple oversize blocks,
       // starting with the largest
       if (it == pool.blocks.begin())
@@ -1755,7 +2280,7 @@ class DeviceCachingAllocator {
             // stream
       while ((totalReleased < key.size) &&
              ((*it)->size >= CachingAllocatorConfig::max_split_size()) &&
-             ((*it)->stream == p.stream())) {
+             ((*it)->stream == p.stream()) && !(*it)->expandable_segment_) {
         auto cur = it;
         totalReleased += (*it)->size;
         if (it != pool.blocks.begin()) {
@@ -1782,6 +2307,9 @@ class DeviceCachingAllocator {
     // Free all non-split cached blocks to system allocator
     release_blocks(large_blocks);
     release_blocks(small_blocks);
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+    release_expandable_segments();
+#endif
 
     for (auto it = graph_pools_freeable.begin();
          it != graph_pools_freeable.end();) {
@@ -1802,7 +2330,16 @@ class DeviceCachingAllocator {
   }
 
   void release_block(Block* block) {
+    // Blocks inside expandable segments are released through
+    // release_expandable_segments(), never via cudaFree.
+    TORCH_INTERNAL_ASSERT(!block->expandable_segment_);
     C10_CUDA_CHECK(cudaFree((void*)block->ptr));
+    record_telemetry(
+        TelemetryEvent::Kind::SEGMENT_FREE,
+        block->device,
+        block->ptr,
+        block->size,
+        block->stream);
     total_allocated_memory -= block->size;
 
     auto* pool = block->pool;
@@ -1862,12 +2399,15 @@ class DeviceCachingAllocator {
     insert_events_deferred_until_no_capture();
 
     for (auto& st : cuda_events) {
+      if (!st.second.empty()) {
+        // Events recorded on the same stream complete in order, so
+        // syncing on the most recently recorded one covers the rest.
+        C10_CUDA_CHECK(cudaEventSynchronize(*st.second.back().first));
+      }
       for (auto& e : st.second) {
         EventPool::Event event = std::move(e.first);
         Block* block = e.second;
 
-        C10_CUDA_CHECK(cudaEventSynchronize(*event));
-
         block->event_count--;
         if (block->event_count == 0) {
           free_block(block);
@@ -1919,7 +2459,34 @@ class DeviceCachingAllocator {
 
     // Iterate over different streams.
     for (auto it = cuda_events.begin(); it != cuda_events.end();) {
-      // Iterate over this stream's (event, block) pairs.
+      // Events recorded on the same stream complete in order, so if the
+      // most recently recorded event has completed, every event ahead of
+      // it has too and the whole queue can be retired with a single query.
+      // This keeps the steady-state poll at one driver call per stream
+      // instead of one per completed event.
+      if (!it->second.empty()) {
+        cudaError_t err =
+            C10_CUDA_ERROR_HANDLED(cudaEventQuery(*it->second.back().first));
+        if (err == cudaErrorNotReady) {
+          // ignore and clear the error if not ready
+          cudaGetLastError();
+        } else if (err != cudaSuccess) {
+          C10_CUDA_CHECK(err);
+        } else {
+          for (auto& e : it->second) {
+            EventPool::Event event = std::move(e.first);
+            Block* block = e.second;
+            block->event_count--;
+            if (block->event_count == 0) {
+              free_block(block);
+            }
+          }
+          it->second.clear();
+        }
+      }
+
+      // Iterate over this stream's (event, block) pairs, retiring from the
+      // front until the first still-running event.
       while (!it->second.empty()) {
         auto& e = it->second.front();
         EventPool::Event event = std::move(e.first);
@@ -2343,6 +2910,91 @@ void setAllocatorSettings(const std::string& env) {
   CachingAllocatorConfig::instance().parseArgs(env.c_str());
 }
 
+// Reserved workspace pool. See the header for the usage contract.
+namespace {
+
+// grow in 1 MiB steps so small size fluctuations don't reallocate
+constexpr size_t kWorkspaceRoundup = 1048576;
+
+struct ReservedWorkspace {
+  void* ptr{nullptr};
+  size_t size{0};
+  int device{-1};
+};
+
+struct ReservedWorkspacePool {
+  std::mutex mutex;
+  ska::flat_hash_map<cudaStream_t, ReservedWorkspace> workspaces;
+  ska::flat_hash_map<int, size_t> device_bytes;
+};
+
+ReservedWorkspacePool& reservedWorkspacePool() {
+  static ReservedWorkspacePool pool;
+  return pool;
+}
+
+} // namespace
+
+void* getReservedWorkspace(size_t nbytes, CUDAStream stream) {
+  auto& pool = reservedWorkspacePool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  ReservedWorkspace& workspace = pool.workspaces[stream.stream()];
+  if (workspace.ptr != nullptr && workspace.size >= nbytes) {
+    return workspace.ptr;
+  }
+
+  CUDAGuard device_guard(stream.device_index());
+  if (workspace.ptr != nullptr) {
+    // kernels already enqueued on the stream may still be using the old
+    // buffer; growth is rare once the high watermark is reached
+    C10_CUDA_CHECK(cudaStreamSynchronize(stream.stream()));
+    C10_CUDA_CHECK(cudaFree(workspace.ptr));
+    pool.device_bytes[workspace.device] -= workspace.size;
+    workspace.ptr = nullptr;
+    workspace.size = 0;
+  }
+
+  size_t alloc_size =
+      ((std::max(nbytes, static_cast<size_t>(1)) + kWorkspaceRoundup - 1) /
+       kWorkspaceRoundup) *
+      kWorkspaceRoundup;
+  cudaError_t err = cudaMalloc(&workspace.ptr, alloc_size);
+  if (err == cudaErrorMemoryAllocation) {
+    // return cached blocks to the system and retry once before reporting OOM
+    cudaGetLastError();
+    emptyCache();
+    err = cudaMalloc(&workspace.ptr, alloc_size);
+  }
+  C10_CUDA_CHECK(err);
+  workspace.size = alloc_size;
+  workspace.device = stream.device_index();
+  pool.device_bytes[workspace.device] += alloc_size;
+  return workspace.ptr;
+}
+
+size_t getReservedWorkspaceSize(int device) {
+  auto& pool = reservedWorkspacePool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  auto it = pool.device_bytes.find(device);
+  return it == pool.device_bytes.end() ? 0 : it->second;
+}
+
+void releaseReservedWorkspaces() {
+  auto& pool = reservedWorkspacePool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  for (auto& entry : pool.workspaces) {
+    ReservedWorkspace& workspace = entry.second;
+    if (workspace.ptr == nullptr) {
+      continue;
+    }
+    CUDAGuard device_guard(workspace.device);
+    C10_CUDA_CHECK(cudaStreamSynchronize(entry.first));
+    C10_CUDA_CHECK(cudaFree(workspace.ptr));
+  }
+  pool.workspaces.clear();
+  pool.device_bytes.clear();
+}
+
 // Size pretty-printer
 inline std::string format_size(uint64_t size) {
   std::ostringstream os;
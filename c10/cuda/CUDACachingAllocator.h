@@ -172,6 +172,64 @@ struct SnapshotInfo {
 
 C10_CUDA_API void setAllocatorSettings(const std::string& env);
 
+// Always-on allocator telemetry.
+//
+// Unlike recordHistory()/snapshot(), which hold the device lock and stall
+// allocation while they run, telemetry events are written into a fixed-size
+// lock-free ring buffer on every alloc/free/segment transition and can be
+// drained asynchronously by a monitoring thread. Writers never block: if
+// the ring wraps before a drain, the oldest events are overwritten and
+// counted in telemetryDroppedEvents(). Only the native allocator backend
+// emits telemetry events.
+struct TelemetryEvent {
+  enum class Kind : uint8_t {
+    ALLOC, // block handed to client code
+    FREE, // block returned by client code
+    SEGMENT_ALLOC, // memory obtained from the system (cudaMalloc/cuMemMap)
+    SEGMENT_FREE, // memory returned to the system
+    OOM, // allocation failed after cache flush; size_ is requested bytes
+  };
+  Kind kind;
+  int32_t device;
+  uint64_t addr;
+  uint64_t size;
+  uint64_t stream;
+  uint64_t timestamp_ns; // steady-clock time the event was recorded
+};
+
+// Telemetry is enabled by default; disabling it reduces the (already
+// small) per-allocation cost to a single relaxed atomic load.
+C10_CUDA_API void setTelemetryEnabled(bool enabled);
+C10_CUDA_API bool telemetryEnabled();
+// Returns all events recorded since the previous drain, oldest first.
+// Safe to call concurrently with allocation; never takes the device lock.
+C10_CUDA_API std::vector<TelemetryEvent> drainTelemetry();
+// Number of events lost to ring wrap-around since process start.
+C10_CUDA_API uint64_t telemetryDroppedEvents();
+
+// Reserved workspace pool.
+//
+// RNN, attention and conv kernels need large transient scratch buffers that,
+// allocated through the caching allocator per call, fragment the general pool
+// and trigger synchronizing cudaFree flushes under memory pressure. The
+// reserved workspace is a per-stream buffer allocated with cudaMalloc outside
+// the caching pool and sized to its high watermark: it only grows, in 1 MiB
+// steps, and growth synchronizes the stream before replacing the buffer.
+//
+// The returned pointer stays valid until a larger workspace is requested on
+// the same stream or releaseReservedWorkspaces() is called. Callers must only
+// touch the buffer from kernels enqueued on `stream`; stream ordering then
+// serializes reuse between successive borrowers. Not usable during CUDA graph
+// capture - growth would cudaMalloc and synchronize mid-capture - so callers
+// should fall back to a regular allocation when capturing.
+C10_CUDA_API void* getReservedWorkspace(size_t nbytes, CUDAStream stream);
+
+// Bytes currently held by reserved workspaces on `device`.
+C10_CUDA_API size_t getReservedWorkspaceSize(int device);
+
+// Synchronizes the owning streams and frees all reserved workspaces.
+C10_CUDA_API void releaseReservedWorkspaces();
+
 // Size pretty-printer
 std::string format_size(uint64_t size);
 
@@ -6,8 +6,10 @@
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <cstdlib>
 #include <mutex>
 #include <vector>
 
@@ -20,8 +22,9 @@ namespace {
 // Global stream state and constants
 static c10::once_flag init_flag;
 static DeviceIndex num_gpus = -1;
-static constexpr int kStreamsPerPoolBits = 5;
-static constexpr int kStreamsPerPool = 1 << kStreamsPerPoolBits;
+static constexpr int kStreamsPerPoolBits = 8;
+static constexpr int kMaxStreamsPerPool = 1 << kStreamsPerPoolBits;
+static constexpr int kDefaultStreamsPerPool = 32;
 static constexpr unsigned int kDefaultFlags = cudaStreamNonBlocking;
 static constexpr int kStreamTypeBits = 3;
 
@@ -29,6 +32,14 @@ static constexpr int kStreamTypeBits = 3;
 static constexpr int kHighPriority = -1;
 static constexpr int kLowPriority = 0;
 
+// Pool configuration, read once from the environment in
+// initGlobalStreamState before any pool is created. The priorities are
+// clamped per device to the range the hardware supports (see
+// initDeviceStreamState).
+static int streams_per_pool = kDefaultStreamsPerPool;
+static int low_priority = kLowPriority;
+static int high_priority = kHighPriority;
+
 // Non-default streams
 // Note: the number of CUDA devices is determined at run time,
 // and the low and high priority pools are lazily initialized
@@ -43,18 +54,24 @@ static constexpr int kLowPriority = 0;
 // crash. It's likely an issue in CUDA, but to be safe - let's just "forget"
 // the destruction.
 static c10::once_flag device_flags[C10_COMPILE_TIME_MAX_GPUS];
+static std::atomic<bool> device_flags_set[C10_COMPILE_TIME_MAX_GPUS];
 static std::atomic<uint32_t> low_priority_counters[C10_COMPILE_TIME_MAX_GPUS];
 static std::atomic<uint32_t> high_priority_counters[C10_COMPILE_TIME_MAX_GPUS];
 static cudaStream_t low_priority_streams[C10_COMPILE_TIME_MAX_GPUS]
-                                        [kStreamsPerPool];
+                                        [kMaxStreamsPerPool];
 static cudaStream_t high_priority_streams[C10_COMPILE_TIME_MAX_GPUS]
-                                         [kStreamsPerPool];
+                                         [kMaxStreamsPerPool];
+// Per-stream hand-out counts for getStreamPoolStats
+static std::atomic<uint64_t> low_priority_uses[C10_COMPILE_TIME_MAX_GPUS]
+                                              [kMaxStreamsPerPool];
+static std::atomic<uint64_t> high_priority_uses[C10_COMPILE_TIME_MAX_GPUS]
+                                               [kMaxStreamsPerPool];
 
 // Note [StreamId assignment]
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~
 // How do we assign stream IDs?
 //
-// -- 57 bits --  -- 5 bits -----  -- 3 bits --
+// -- 53 bits --  -- 8 bits -----  -- 3 bits --
 // zeros          stream id index  StreamIdType
 //
 // Where StreamIdType:
@@ -149,6 +166,26 @@ static void initGlobalStreamState() {
       "max number of gpus expected (",
       C10_COMPILE_TIME_MAX_GPUS,
       "). Increase that and recompile.");
+  if (const char* env = std::getenv("TORCH_CUDA_STREAMS_PER_POOL")) {
+    const int size = std::atoi(env);
+    if (size >= 1 && size <= kMaxStreamsPerPool) {
+      streams_per_pool = size;
+    } else {
+      TORCH_WARN(
+          "TORCH_CUDA_STREAMS_PER_POOL must be between 1 and ",
+          kMaxStreamsPerPool,
+          ", got ",
+          env,
+          "; keeping the default of ",
+          streams_per_pool);
+    }
+  }
+  if (const char* env = std::getenv("TORCH_CUDA_STREAM_LOW_PRIORITY")) {
+    low_priority = std::atoi(env);
+  }
+  if (const char* env = std::getenv("TORCH_CUDA_STREAM_HIGH_PRIORITY")) {
+    high_priority = std::atoi(env);
+  }
 }
 
 // Creates the low and high priority stream pools for the specified device
@@ -158,14 +195,26 @@ static void initDeviceStreamState(DeviceIndex device_index) {
   // with it.
   CUDAGuard device_guard{device_index};
 
-  for (const auto i : c10::irange(kStreamsPerPool)) {
+  // Clamp the configured priorities to what this device supports.
+  // Note: lower numbers are higher priorities, so "least" is the upper
+  // bound and "greatest" the lower bound of the valid range.
+  int least_priority = 0;
+  int greatest_priority = 0;
+  C10_CUDA_CHECK(
+      cudaDeviceGetStreamPriorityRange(&least_priority, &greatest_priority));
+  const int lowpri_priority =
+      std::min(std::max(low_priority, greatest_priority), least_priority);
+  const int hipri_priority =
+      std::min(std::max(high_priority, greatest_priority), least_priority);
+
+  for (const auto i : c10::irange(streams_per_pool)) {
     auto& lowpri_stream = low_priority_streams[device_index][i];
     auto& hipri_stream = high_priority_streams[device_index][i];
 
     C10_CUDA_CHECK(cudaStreamCreateWithPriority(
-        &lowpri_stream, kDefaultFlags, kLowPriority));
+        &lowpri_stream, kDefaultFlags, lowpri_priority));
     C10_CUDA_CHECK(cudaStreamCreateWithPriority(
-        &hipri_stream, kDefaultFlags, kHighPriority));
+        &hipri_stream, kDefaultFlags, hipri_priority));
 
     const c10::impl::PyInterpreter* interp = c10::impl::GPUTrace::get_trace();
     if (C10_UNLIKELY(interp)) {
@@ -178,6 +227,7 @@ static void initDeviceStreamState(DeviceIndex device_index) {
 
   low_priority_counters[device_index] = 0;
   high_priority_counters[device_index] = 0;
+  device_flags_set[device_index] = true;
 }
 
 // Init front-end to ensure initialization only occurs once
@@ -205,7 +255,19 @@ static inline void check_gpu(DeviceIndex device_index) {
 // Note: Streams are returned round-robin (see note in CUDAStream.h)
 static uint32_t get_idx(std::atomic<uint32_t>& counter) {
   auto raw_idx = counter++;
-  return raw_idx % kStreamsPerPool;
+  return raw_idx % streams_per_pool;
+}
+
+// Queries whether a stream still has unfinished work, without blocking.
+static bool stream_is_busy(cudaStream_t stream) {
+  cudaError_t err = cudaStreamQuery(stream);
+  if (err == cudaErrorNotReady) {
+    // ignore and clear the error
+    (void)cudaGetLastError();
+    return true;
+  }
+  C10_CUDA_CHECK(err);
+  return false;
 }
 
 CUDAStream CUDAStreamForId(DeviceIndex device_index, StreamId stream_id) {
@@ -271,13 +333,43 @@ CUDAStream getStreamFromPool(
 
   if (isHighPriority) {
     const auto idx = get_idx(high_priority_counters[device_index]);
+    ++high_priority_uses[device_index][idx];
     return CUDAStreamForId(device_index, makeStreamId(StreamIdType::HIGH, idx));
   }
 
   const auto idx = get_idx(low_priority_counters[device_index]);
+  ++low_priority_uses[device_index][idx];
   return CUDAStreamForId(device_index, makeStreamId(StreamIdType::LOW, idx));
 }
 
+CUDAStreamPoolStats getStreamPoolStats(DeviceIndex device_index) {
+  initCUDAStreamsOnce();
+  if (device_index == -1) {
+    device_index = current_device();
+  }
+  check_gpu(device_index);
+
+  CUDAStreamPoolStats stats;
+  stats.low_priority_uses.resize(streams_per_pool, 0);
+  stats.high_priority_uses.resize(streams_per_pool, 0);
+  stats.low_priority_busy.resize(streams_per_pool, false);
+  stats.high_priority_busy.resize(streams_per_pool, false);
+  // The pools are created lazily; until then every counter is zero and
+  // there is nothing to query.
+  if (!device_flags_set[device_index].load()) {
+    return stats;
+  }
+  for (const auto i : c10::irange(streams_per_pool)) {
+    stats.low_priority_uses[i] = low_priority_uses[device_index][i].load();
+    stats.high_priority_uses[i] = high_priority_uses[device_index][i].load();
+    stats.low_priority_busy[i] =
+        stream_is_busy(low_priority_streams[device_index][i]);
+    stats.high_priority_busy[i] =
+        stream_is_busy(high_priority_streams[device_index][i]);
+  }
+  return stats;
+}
+
 CUDAStream getStreamFromExternal(
     cudaStream_t ext_stream,
     DeviceIndex device_index) {
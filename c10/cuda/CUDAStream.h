@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <utility>
+#include <vector>
 
 #include <cuda_runtime_api.h>
 
@@ -24,17 +25,21 @@
  *
  * The second pool is the "low priority" or "default priority" streams. In
  * HIP builds there is no distinction between streams in this pool and streams
- * in the third pool (below). There are 32 of these streams per device, and
+ * in the third pool (below). There are 32 of these streams per device by
+ * default (configurable through TORCH_CUDA_STREAMS_PER_POOL, up to 256), and
  * when a stream is requested one of these streams is returned round-robin.
  * That is, the first stream requested is at index 0, the second at index 1...
- * to index 31, then index 0 again.
+ * to the last index, then index 0 again.
  *
- * This means that if 33 low priority streams are requested, the first and
- * last streams requested are actually the same stream (under the covers)
- * and kernels enqueued on them cannot run concurrently.
+ * This means that if more streams are requested than the pool holds, the
+ * first and last streams requested are actually the same stream (under the
+ * covers) and kernels enqueued on them cannot run concurrently.
  *
  * The third pool is the "high priority" streams. The third pool acts like
  * the second pool except the streams are created with a higher priority.
+ * The priority values used for the two pools can be overridden through
+ * TORCH_CUDA_STREAM_LOW_PRIORITY and TORCH_CUDA_STREAM_HIGH_PRIORITY; they
+ * are clamped to the priority range each device supports.
  *
  * These pools suggest that stream users should prefer many short-lived streams,
  * as the cost of acquiring and releasing streams is effectively zero. If
@@ -206,6 +211,31 @@ class C10_CUDA_API CUDAStream {
 C10_API CUDAStream
 getStreamFromPool(const bool isHighPriority = false, DeviceIndex device = -1);
 
+/**
+ * A snapshot of per-stream statistics for one device's stream pools, with
+ * one entry per pooled stream. `*_uses` counts how many times each stream
+ * has been handed out by getStreamFromPool since program start; `*_busy`
+ * records whether the stream still had unfinished work when the snapshot
+ * was taken (via cudaStreamQuery). Sampling the busy bits periodically
+ * gives an approximate per-stream occupancy window, which is enough to
+ * spot starved or oversubscribed streams without an external profiler.
+ */
+struct C10_API CUDAStreamPoolStats {
+  std::vector<uint64_t> low_priority_uses;
+  std::vector<uint64_t> high_priority_uses;
+  std::vector<bool> low_priority_busy;
+  std::vector<bool> high_priority_busy;
+};
+
+/**
+ * Get a statistics snapshot for the stream pools of the passed CUDA
+ * device, or of the current device if no device index is passed. If the
+ * device's pools have not been created yet, all counters are zero and no
+ * stream is busy.
+ */
+C10_API CUDAStreamPoolStats
+getStreamPoolStats(DeviceIndex device_index = -1);
+
 /**
  * Get a CUDAStream from a externally allocated one.
  *
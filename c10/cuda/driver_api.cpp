@@ -0,0 +1,36 @@
+#if defined(__linux__) && !defined(USE_ROCM)
+#include <c10/cuda/driver_api.h>
+#include <c10/util/Exception.h>
+#include <dlfcn.h>
+
+namespace c10 {
+namespace cuda {
+
+namespace {
+
+DriverAPI create_driver_api() {
+  // RTLD_NOLOAD: by the time anyone asks for driver entry points the CUDA
+  // runtime has already loaded the driver, so we only look it up.
+  void* handle = dlopen("libcuda.so.1", RTLD_LAZY | RTLD_NOLOAD);
+  TORCH_INTERNAL_ASSERT(handle, "Can't open libcuda.so.1: ", dlerror());
+  DriverAPI r{};
+
+#define LOOKUP_LIBCUDA_ENTRY(name)                     \
+  r.name##_ = ((decltype(&name))dlsym(handle, #name)); \
+  TORCH_INTERNAL_ASSERT(r.name##_, "Can't find ", #name, ": ", dlerror())
+  C10_LIBCUDA_DRIVER_API(LOOKUP_LIBCUDA_ENTRY)
+#undef LOOKUP_LIBCUDA_ENTRY
+  return r;
+}
+
+} // namespace
+
+DriverAPI* DriverAPI::get() {
+  static DriverAPI singleton = create_driver_api();
+  return &singleton;
+}
+
+} // namespace cuda
+} // namespace c10
+
+#endif
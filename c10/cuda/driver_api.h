@@ -0,0 +1,50 @@
+#pragma once
+#include <cuda.h>
+
+#include <c10/cuda/CUDAMacros.h>
+#include <c10/util/Exception.h>
+
+// Thin dlopen-based shim over the CUDA driver API entry points that the
+// caching allocator's expandable-segment mode needs. We resolve the
+// symbols from the already-loaded libcuda.so.1 rather than linking
+// against the driver stub, so builds (and non-GPU machines running
+// CPU-only code paths) do not pick up a hard libcuda dependency.
+
+#define C10_CUDA_DRIVER_CHECK(EXPR)                                        \
+  do {                                                                     \
+    CUresult __err = EXPR;                                                 \
+    if (__err != CUDA_SUCCESS) {                                           \
+      const char* err_str;                                                 \
+      CUresult get_error_str_err C10_UNUSED =                              \
+          c10::cuda::DriverAPI::get()->cuGetErrorString_(__err, &err_str); \
+      if (get_error_str_err != CUDA_SUCCESS) {                             \
+        AT_ERROR("CUDA driver error: unknown error");                      \
+      } else {                                                             \
+        AT_ERROR("CUDA driver error: ", err_str);                         \
+      }                                                                    \
+    }                                                                      \
+  } while (0)
+
+#define C10_LIBCUDA_DRIVER_API(_)  \
+  _(cuMemAddressReserve)           \
+  _(cuMemRelease)                  \
+  _(cuMemMap)                      \
+  _(cuMemAddressFree)              \
+  _(cuMemSetAccess)                \
+  _(cuMemUnmap)                    \
+  _(cuMemCreate)                   \
+  _(cuMemGetAllocationGranularity) \
+  _(cuGetErrorString)
+
+namespace c10 {
+namespace cuda {
+
+struct C10_CUDA_API DriverAPI {
+#define CREATE_MEMBER(name) decltype(&name) name##_;
+  C10_LIBCUDA_DRIVER_API(CREATE_MEMBER)
+#undef CREATE_MEMBER
+  static DriverAPI* get();
+};
+
+} // namespace cuda
+} // namespace c10
@@ -0,0 +1,61 @@
+#include <c10/core/CachingCPUAllocator.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(CachingCPUAllocatorTest, ReusesBlocks) {
+  auto* allocator = c10::GetCachingCPUAllocator();
+  void* first = nullptr;
+  {
+    auto ptr = allocator->allocate(1024);
+    first = ptr.get();
+    ASSERT_NE(first, nullptr);
+    std::memset(first, 0xab, 1024);
+  }
+  // Same size class should be served from the thread-local cache.
+  auto ptr = allocator->allocate(1000);
+  EXPECT_EQ(ptr.get(), first);
+}
+
+TEST(CachingCPUAllocatorTest, EmptyCacheReleasesEverything) {
+  auto* allocator = c10::GetCachingCPUAllocator();
+  {
+    std::vector<c10::DataPtr> ptrs;
+    for (int i = 0; i < 16; ++i) {
+      ptrs.emplace_back(allocator->allocate(4096));
+    }
+  }
+  EXPECT_GT(c10::CachingCPUAllocator::currentCachedBytes(), 0u);
+  c10::CachingCPUAllocator::emptyCache();
+  EXPECT_EQ(c10::CachingCPUAllocator::currentCachedBytes(), 0u);
+}
+
+TEST(CachingCPUAllocatorTest, CrossThreadFree) {
+  auto* allocator = c10::GetCachingCPUAllocator();
+  auto ptr = allocator->allocate(2048);
+  std::memset(ptr.get(), 0, 2048);
+  // Freeing on a different thread must route the block back into a cache
+  // (or the OS) without corruption.
+  std::thread t([moved = std::move(ptr)]() mutable { moved.clear(); });
+  t.join();
+  c10::CachingCPUAllocator::emptyCache();
+}
+
+TEST(CachingCPUAllocatorTest, LargeAllocationsBypassCache) {
+  auto* allocator = c10::GetCachingCPUAllocator();
+  const size_t before = c10::CachingCPUAllocator::currentCachedBytes();
+  {
+    auto ptr = allocator->allocate(256ULL * 1024 * 1024);
+    ASSERT_NE(ptr.get(), nullptr);
+  }
+  EXPECT_EQ(c10::CachingCPUAllocator::currentCachedBytes(), before);
+}
+
+TEST(CachingCPUAllocatorTest, ZeroSizeAllocation) {
+  auto* allocator = c10::GetCachingCPUAllocator();
+  auto ptr = allocator->allocate(0);
+  EXPECT_EQ(ptr.get(), nullptr);
+}
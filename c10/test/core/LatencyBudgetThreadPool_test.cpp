@@ -0,0 +1,91 @@
+#include <c10/core/LatencyBudgetThreadPool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+TEST(LatencyBudgetThreadPoolTest, RunsSubmittedTasks) {
+  c10::LatencyBudgetThreadPool pool(4);
+  ASSERT_EQ(pool.size(), 4);
+
+  constexpr int kNumTasks = 100;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::atomic<int> count{0};
+  for (int i = 0; i < kNumTasks; ++i) {
+    pool.run([&]() {
+      if (count.fetch_add(1) + 1 == kNumTasks) {
+        std::lock_guard<std::mutex> guard(mutex);
+        cv.notify_one();
+      }
+    });
+  }
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [&]() { return count.load() == kNumTasks; });
+  ASSERT_EQ(count.load(), kNumTasks);
+}
+
+TEST(LatencyBudgetThreadPoolTest, InteractiveRunsBeforeBatch) {
+  // Single worker, held busy while both classes queue up: once released,
+  // the interactive task must be dequeued before the batch tasks that
+  // were submitted ahead of it (none of them is past its aging budget).
+  c10::LatencyBudgetThreadPool pool(1);
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::atomic<bool> release{false};
+  std::atomic<bool> done{false};
+  std::vector<int> order;
+
+  pool.run([&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&]() { return release.load(); });
+  });
+
+  {
+    c10::DeadlineClassGuard guard(c10::DeadlineClass::Batch);
+    for (int i = 0; i < 4; ++i) {
+      pool.run([&, i]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(i);
+      });
+    }
+  }
+  {
+    c10::DeadlineClassGuard guard(c10::DeadlineClass::Interactive);
+    pool.run([&]() {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(-1);
+      }
+      done = true;
+      cv.notify_all();
+    });
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    release = true;
+    cv.notify_all();
+  }
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [&]() { return done.load(); });
+  ASSERT_FALSE(order.empty());
+  ASSERT_EQ(order.front(), -1);
+}
+
+TEST(LatencyBudgetThreadPoolTest, GuardRestoresClass) {
+  ASSERT_EQ(c10::currentDeadlineClass(), c10::DeadlineClass::Default);
+  {
+    c10::DeadlineClassGuard guard(c10::DeadlineClass::Batch);
+    ASSERT_EQ(c10::currentDeadlineClass(), c10::DeadlineClass::Batch);
+  }
+  ASSERT_EQ(c10::currentDeadlineClass(), c10::DeadlineClass::Default);
+}
+
+} // namespace
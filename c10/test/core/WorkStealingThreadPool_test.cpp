@@ -0,0 +1,72 @@
+#include <c10/core/WorkStealingThreadPool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace {
+
+// Runs tasks until `count` reaches `expected`, then returns.
+void wait_for(
+    std::mutex& mutex,
+    std::condition_variable& cv,
+    std::atomic<int>& count,
+    int expected) {
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [&]() { return count.load() == expected; });
+}
+
+TEST(WorkStealingThreadPoolTest, RunsExternallySubmittedTasks) {
+  c10::WorkStealingThreadPool pool(4);
+  ASSERT_EQ(pool.size(), 4);
+
+  constexpr int kNumTasks = 100;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::atomic<int> count{0};
+  for (int i = 0; i < kNumTasks; ++i) {
+    pool.run([&]() {
+      if (count.fetch_add(1) + 1 == kNumTasks) {
+        std::lock_guard<std::mutex> guard(mutex);
+        cv.notify_one();
+      }
+    });
+  }
+  wait_for(mutex, cv, count, kNumTasks);
+  ASSERT_EQ(count.load(), kNumTasks);
+}
+
+TEST(WorkStealingThreadPoolTest, RunsNestedSubmissions) {
+  c10::WorkStealingThreadPool pool(2);
+
+  // Each task fans out into more tasks from inside the pool; all of them
+  // must eventually run even though the submitters are pool threads.
+  constexpr int kFanOut = 8;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::atomic<int> count{0};
+  for (int i = 0; i < kFanOut; ++i) {
+    pool.run([&]() {
+      ASSERT_TRUE(pool.inThreadPool());
+      for (int j = 0; j < kFanOut; ++j) {
+        pool.run([&]() {
+          if (count.fetch_add(1) + 1 == kFanOut * kFanOut) {
+            std::lock_guard<std::mutex> guard(mutex);
+            cv.notify_one();
+          }
+        });
+      }
+    });
+  }
+  wait_for(mutex, cv, count, kFanOut * kFanOut);
+  ASSERT_EQ(count.load(), kFanOut * kFanOut);
+}
+
+TEST(WorkStealingThreadPoolTest, InThreadPoolIsFalseOutside) {
+  c10::WorkStealingThreadPool pool(2);
+  ASSERT_FALSE(pool.inThreadPool());
+}
+
+} // namespace
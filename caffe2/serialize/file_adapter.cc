@@ -3,6 +3,9 @@
 #include <cerrno>
 #include <cstdio>
 #include <string>
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
 #include "caffe2/core/common.h"
 
 namespace caffe2 {
@@ -62,6 +65,7 @@ size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
   // user requested to read beyond the end of the file, we clamp to just the
   // end of the file.
   n = std::min(static_cast<size_t>(size_ - pos), n);
+#if defined(_WIN32)
 #if defined(_MSC_VER)
   const int fseek_ret = _fseeki64(file_.fp_, pos, SEEK_SET);
 #else
@@ -74,6 +78,24 @@ size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
     ", context: ",
     what);
   return fread(buf, 1, n, file_.fp_);
+#else
+  // Positional reads leave the shared file offset alone, which is what lets
+  // supportsConcurrentReads() advertise that read() is thread-safe.
+  size_t read_so_far = 0;
+  while (read_so_far < n) {
+    const ssize_t ret = pread(
+        fileno(file_.fp_),
+        static_cast<char*>(buf) + read_so_far,
+        n - read_so_far,
+        pos + read_so_far);
+    TORCH_CHECK(ret >= 0, "pread returned ", ret, ", context: ", what);
+    if (ret == 0) {
+      break;
+    }
+    read_so_far += ret;
+  }
+  return read_so_far;
+#endif
 }
 
 FileAdapter::~FileAdapter() = default;
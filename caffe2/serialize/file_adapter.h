@@ -17,6 +17,14 @@ class TORCH_API FileAdapter final : public ReadAdapterInterface {
   size_t size() const override;
   size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const override;
+  bool supportsConcurrentReads() const override {
+    // On POSIX, read() uses pread and never touches the shared file offset.
+#if defined(_WIN32)
+    return false;
+#else
+    return true;
+#endif
+  }
   ~FileAdapter() override;
 
  private:
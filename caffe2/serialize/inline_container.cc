@@ -5,6 +5,8 @@
 #include <ostream>
 #include <fstream>
 #include <algorithm>
+#include <mutex>
+#include <thread>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -292,6 +294,18 @@ std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), key, &stat);
   valid("retrieving file meta-data for ", name.c_str());
+  // Serve the record straight out of the caller-provided archive image when
+  // one was registered; see setInMemoryData(). m_method == 0 means the
+  // record is stored rather than deflated, which is how PyTorchStreamWriter
+  // writes everything by default.
+  if (in_memory_base_ != nullptr && stat.m_method == 0) {
+    size_t offset = getRecordDataOffset(stat.m_local_header_ofs);
+    if (offset + stat.m_uncomp_size > in_memory_size_) {
+      CAFFE_THROW("record ", name, " extends past the end of the archive");
+    }
+    at::DataPtr retval(in_memory_base_ + offset, c10::DeviceType::CPU);
+    return std::make_tuple(std::move(retval), stat.m_uncomp_size);
+  }
   at::DataPtr retval = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
   mz_zip_reader_extract_to_mem(ar_.get(), key, retval.get(), stat.m_uncomp_size, 0);
   valid("reading file ", name.c_str());
@@ -299,25 +313,130 @@ std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string
   return std::make_tuple(std::move(retval), stat.m_uncomp_size);
 }
 
+std::vector<std::tuple<at::DataPtr, size_t>>
+PyTorchStreamReader::getRecordsParallel(const std::vector<std::string>& names) {
+  std::vector<std::tuple<at::DataPtr, size_t>> result(names.size());
+  struct ReadJob {
+    size_t offset;
+    size_t size;
+    void* dest;
+  };
+  std::vector<ReadJob> jobs;
+  std::vector<size_t> fallback;
+  // Planning phase, under the lock: resolve every record that can be read
+  // positionally to a raw byte range and allocate its destination buffer.
+  // Compressed records, or everything when the adapter keeps a shared
+  // cursor, are deferred to plain getRecord calls instead.
+  {
+    std::lock_guard<std::mutex> guard(reader_lock_);
+    const bool concurrent_ok =
+        in_->supportsConcurrentReads() && in_memory_base_ == nullptr;
+    for (size_t i = 0; i < names.size(); i++) {
+      if ((!load_debug_symbol_) &&
+          c10::string_view(names[i]).ends_with(kDebugPklSuffix)) {
+        continue;
+      }
+      if (!concurrent_ok) {
+        fallback.push_back(i);
+        continue;
+      }
+      size_t key = getRecordID(names[i]);
+      mz_zip_archive_file_stat stat;
+      mz_zip_reader_file_stat(ar_.get(), key, &stat);
+      valid("retrieving file meta-data for ", names[i].c_str());
+      if (stat.m_method != 0) {
+        fallback.push_back(i);
+        continue;
+      }
+      at::DataPtr ptr = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
+      jobs.push_back(ReadJob{
+          getRecordDataOffset(stat.m_local_header_ofs),
+          static_cast<size_t>(stat.m_uncomp_size),
+          ptr.get()});
+      result[i] = std::make_tuple(std::move(ptr), stat.m_uncomp_size);
+    }
+  }
+  // Read phase, outside the lock: workers pull disjoint byte ranges with
+  // positional reads. The cap keeps the queue depth reasonable; past a
+  // handful of in-flight reads the device, not the CPU, is the bottleneck.
+  if (!jobs.empty()) {
+    constexpr size_t kMaxReadThreads = 8;
+    const size_t num_threads = std::min(
+        {jobs.size(),
+         static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())),
+         kMaxReadThreads});
+    std::mutex error_guard;
+    std::exception_ptr error;
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (size_t t = 0; t < num_threads; t++) {
+      workers.emplace_back([&, t]() {
+        try {
+          for (size_t j = t; j < jobs.size(); j += num_threads) {
+            const auto& job = jobs[j];
+            size_t read = in_->read(
+                job.offset,
+                static_cast<char*>(job.dest),
+                job.size,
+                "reading record");
+            TORCH_CHECK(
+                read == job.size,
+                "short read: got ",
+                read,
+                " of ",
+                job.size,
+                " bytes");
+          }
+        } catch (...) {
+          std::lock_guard<std::mutex> guard(error_guard);
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  for (size_t i : fallback) {
+    result[i] = getRecord(names[i]);
+  }
+  return result;
+}
+
 static int64_t read_le_16(uint8_t* buf) {
   return buf[0] + (buf[1] << 8);
 }
 
-size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
-  std::lock_guard<std::mutex> guard(reader_lock_);
-  mz_zip_archive_file_stat stat;
-  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
-  valid("retrieving file meta-data for ", name.c_str());
+size_t PyTorchStreamReader::getRecordDataOffset(uint64_t local_header_ofs) {
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
   uint8_t local_header[MZ_ZIP_LOCAL_DIR_HEADER_SIZE];
   in_->read(
-      stat.m_local_header_ofs,
+      local_header_ofs,
       local_header,
       MZ_ZIP_LOCAL_DIR_HEADER_SIZE,
       "reading file header");
   size_t filename_len = read_le_16(local_header + MZ_ZIP_LDH_FILENAME_LEN_OFS);
   size_t extra_len = read_le_16(local_header + MZ_ZIP_LDH_EXTRA_LEN_OFS);
-  return stat.m_local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+  return local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+}
+
+size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
+  valid("retrieving file meta-data for ", name.c_str());
+  return getRecordDataOffset(stat.m_local_header_ofs);
+}
+
+void PyTorchStreamReader::setInMemoryData(void* base, size_t size) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  in_memory_base_ = static_cast<uint8_t*>(base);
+  in_memory_size_ = size;
 }
 
 
@@ -406,6 +525,9 @@ void PyTorchStreamWriter::writeRecord(
   std::string full_name = archive_name_plus_slash_ + name;
   size_t padding_size =
       detail::getPadding(ar_->m_archive_size, full_name.size(), size, padding_);
+  // Tensor payloads are stored uncompressed (compress defaults to false), so
+  // for large records the CPU cost of this call is the checksum pass inside
+  // miniz; see Note [Parallel CRC32 for large buffers] in crc.cc.
   uint32_t flags = compress ? MZ_BEST_COMPRESSION : 0;
   mz_zip_writer_add_mem_ex_v2(
       ar_.get(),
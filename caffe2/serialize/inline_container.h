@@ -101,7 +101,22 @@ class TORCH_API PyTorchStreamReader final {
 
   // return dataptr, size
   std::tuple<at::DataPtr, size_t> getRecord(const std::string& name);
+  // Reads several records at once, returning (dataptr, size) pairs in the
+  // order of `names`. When the underlying adapter supports concurrent reads,
+  // stored (uncompressed) records are fetched with positional reads spread
+  // over a small pool of threads so archive loading can approach raw device
+  // bandwidth; otherwise this degenerates to sequential getRecord calls.
+  std::vector<std::tuple<at::DataPtr, size_t>> getRecordsParallel(
+      const std::vector<std::string>& names);
   size_t getRecordOffset(const std::string& name);
+
+  // Points the reader at an in-memory image of the whole archive, typically
+  // an mmap of the file backing `in`. getRecord() then hands out non-owning
+  // DataPtrs into the image for records that are stored uncompressed instead
+  // of copying them out of the zip; compressed records still take the
+  // copying path. The caller must keep `base` alive for as long as any
+  // DataPtr returned by getRecord().
+  void setInMemoryData(void* base, size_t size);
   bool hasRecord(const std::string& name);
   std::vector<std::string> getAllRecords();
 
@@ -119,6 +134,7 @@ class TORCH_API PyTorchStreamReader final {
   size_t read(uint64_t pos, char* buf, size_t n);
   void valid(const char* what, const char* info = "");
   size_t getRecordID(const std::string& name);
+  size_t getRecordDataOffset(uint64_t local_header_ofs);
 
   friend size_t
   istream_read_func(void* pOpaque, uint64_t file_ofs, void* pBuf, size_t n);
@@ -129,6 +145,8 @@ class TORCH_API PyTorchStreamReader final {
   int64_t version_;
   std::mutex reader_lock_;
   bool load_debug_symbol_ = true;
+  uint8_t* in_memory_base_ = nullptr;
+  size_t in_memory_size_ = 0;
 };
 
 class TORCH_API PyTorchStreamWriter final {
@@ -16,6 +16,11 @@ class TORCH_API ReadAdapterInterface {
   virtual size_t size() const = 0;
   virtual size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const = 0;
+  // Whether read() may be called from several threads at once. Adapters that
+  // keep a shared cursor (e.g. IStreamAdapter) must leave this false.
+  virtual bool supportsConcurrentReads() const {
+    return false;
+  }
   virtual ~ReadAdapterInterface();
 };
 
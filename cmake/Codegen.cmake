@@ -290,7 +290,9 @@ if(INTERN_BUILD_ATEN_OPS)
       if(MSVC)
         list(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG}/arch:AVX2")
       else(MSVC)
-        list(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG} -mavx2 -mfma ${CPU_NO_AVX256_SPLIT_FLAGS}")
+        # F16C ships with every AVX2 CPU; it is needed for the vectorized
+        # half<->float conversions in vec256_bfloat16.h.
+        list(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG} -mavx2 -mfma -mf16c ${CPU_NO_AVX256_SPLIT_FLAGS}")
       endif(MSVC)
     endif()
   endif(CXX_AVX2_FOUND)
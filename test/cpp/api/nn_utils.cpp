@@ -344,6 +344,33 @@ TEST_F(NNUtilsTest, ClipGradValue) {
   ASSERT_TRUE(torch::allclose(p1.grad(), p2.grad()));
 }
 
+TEST_F(NNUtilsTest, ParameterDoubleBuffer) {
+  auto param = torch::zeros({4, 4});
+  auto view = param.view({16});
+  utils::ParameterDoubleBuffer buffer(param);
+
+  auto new_weights = torch::rand({4, 4});
+  buffer.shadow().copy_(new_weights);
+
+  // Nothing is visible until both publish and commit.
+  ASSERT_FALSE(buffer.commit());
+  ASSERT_TRUE(param.eq(0).all().item<bool>());
+  buffer.publish();
+  ASSERT_TRUE(buffer.commit());
+  ASSERT_TRUE(param.allclose(new_weights));
+  // Views share the storage and observe the flip too.
+  ASSERT_TRUE(view.view({4, 4}).allclose(new_weights));
+  ASSERT_EQ(buffer.version(), 1);
+
+  // The retired buffer is reused as the next shadow.
+  auto newer_weights = torch::rand({4, 4});
+  buffer.shadow().copy_(newer_weights);
+  buffer.publish();
+  ASSERT_TRUE(buffer.commit());
+  ASSERT_TRUE(param.allclose(newer_weights));
+  ASSERT_EQ(buffer.version(), 2);
+}
+
 TEST_F(NNUtilsTest, ConvertParameters) {
   std::vector<torch::Tensor> parameters{
       torch::arange(9, torch::kFloat32),
@@ -1195,14 +1195,14 @@ TEST(FlatbufferTest, OperatorSize1) {
   const auto& func = bc.get_method("forward").function();
   ASSERT_EQ(
       func.get_code().operator_input_sizes_.size(),
-      func.get_code().operators_.size());
+      func.get_code().operators_->size());
 
   auto buff = save_mobile_module_to_bytes(bc);
   mobile::Module bc2 = parse_mobile_module(buff->data(), buff->size());
   const auto& func2 = bc.get_method("forward").function();
   ASSERT_EQ(
       func2.get_code().operator_input_sizes_.size(),
-      func2.get_code().operators_.size());
+      func2.get_code().operators_->size());
 }
 
 TEST(FlatbufferTest, BoolAndDoubleList) {
@@ -1258,14 +1258,14 @@ TEST(FlatbufferTest, OperatorTest2) { // NOLINT (use =delete in gtest)
     const auto& func = bc.get_method("test_func").function();
     ASSERT_EQ(
         func.get_code().operator_input_sizes_.size(),
-        func.get_code().operators_.size());
+        func.get_code().operators_->size());
 
     auto buff = save_mobile_module_to_bytes(bc);
     mobile::Module bc2 = parse_mobile_module(buff->data(), buff->size());
     const auto& func2 = bc.get_method("test_func").function();
     ASSERT_EQ(
         func2.get_code().operator_input_sizes_.size(),
-        func2.get_code().operators_.size());
+        func2.get_code().operators_->size());
   }
 }
 
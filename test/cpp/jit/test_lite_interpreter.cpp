@@ -1615,7 +1615,7 @@ TEST(LiteInterpreterTest, OperatorSize1) {
   const auto& func = bc.get_method("forward").function();
   ASSERT_EQ(
       func.get_code().operator_input_sizes_.size(),
-      func.get_code().operators_.size());
+      func.get_code().operators_->size());
 }
 
 TEST(LiteInterpreterTest, OperatorTest2) { // NOLINT (use =delete in gtest)
@@ -1650,7 +1650,7 @@ TEST(LiteInterpreterTest, OperatorTest2) { // NOLINT (use =delete in gtest)
     const auto& func = bc.get_method("test_func").function();
     ASSERT_EQ(
         func.get_code().operator_input_sizes_.size(),
-        func.get_code().operators_.size());
+        func.get_code().operators_->size());
   }
 }
 
@@ -2085,10 +2085,12 @@ TEST(LiteInterpreterUpgraderTest, Upgrader) {
 
   for (auto& byteCodeFunctionWithOperator : getUpgraderBytecodeList()) {
     byteCodeFunctionWithOperator.function.initialize_operators(true);
-    ASSERT_EQ(
-        byteCodeFunctionWithOperator.function.get_code().operators_.size(),
-        byteCodeFunctionWithOperator.function.get_code().op_names_.size());
-    if (byteCodeFunctionWithOperator.function.get_code().operators_.empty()) {
+    const auto& code = byteCodeFunctionWithOperator.function.get_code();
+    // operators_ stays unset when operator resolution failed.
+    if (code.operators_ != nullptr) {
+      ASSERT_EQ(code.operators_->size(), code.op_names_.size());
+    }
+    if (code.operators_ == nullptr || code.operators_->empty()) {
       for (const auto& op : byteCodeFunctionWithOperator.operators) {
         byteCodeFunctionWithOperator.function.append_operator(
             op.name, op.overload_name, op.num_specified_args);
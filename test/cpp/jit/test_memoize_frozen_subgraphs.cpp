@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <test/cpp/jit/test_utils.h>
+
+#include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/passes/memoize_frozen_subgraphs.h>
+#include <torch/csrc/jit/runtime/interpreter.h>
+#include <torch/csrc/jit/testing/file_check.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+const auto shape_dependent_src = R"IR(
+graph(%x : Tensor):
+  %zero : int = prim::Constant[value=0]()
+  %one : int = prim::Constant[value=1]()
+  %none : NoneType = prim::Constant()
+  %len : int = aten::size(%x, %zero)
+  %shape : int[] = prim::ListConstruct(%len, %len)
+  %t : Tensor = aten::ones(%shape, %none, %none, %none, %none)
+  %out : Tensor = aten::add(%x, %t, %one)
+  return (%out)
+)IR";
+} // namespace
+
+TEST(MemoizeFrozenSubgraphsTest, OutlinesShapeDependentChain) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(shape_dependent_src, &*graph);
+
+  ASSERT_TRUE(MemoizeFrozenSubgraphs(graph));
+  // aten::size reads off a tensor so it stays outside and feeds the
+  // subgraph its scalar cache key; the shape-only chain is outlined
+  testing::FileCheck()
+      .check("aten::size")
+      ->check("prim::MemoizedSubgraph")
+      ->check("aten::add")
+      ->run(*graph);
+  testing::FileCheck().check_not("aten::ones")->run(*graph);
+}
+
+TEST(MemoizeFrozenSubgraphsTest, SkipsTensorDependentNodes) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%x : Tensor):
+  %one : int = prim::Constant[value=1]()
+  %y : Tensor = aten::relu(%x)
+  %z : Tensor = aten::add(%y, %x, %one)
+  return (%z)
+)IR",
+      &*graph);
+
+  ASSERT_FALSE(MemoizeFrozenSubgraphs(graph));
+  testing::FileCheck().check_not("prim::MemoizedSubgraph")->run(*graph);
+}
+
+TEST(MemoizeFrozenSubgraphsTest, CachedResultsMatchRecomputation) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(shape_dependent_src, &*graph);
+  ASSERT_TRUE(MemoizeFrozenSubgraphs(graph));
+
+  Code code(graph, "");
+
+  auto run = [&](const at::Tensor& x) {
+    std::vector<IValue> stack({x});
+    InterpreterState(code).run(stack);
+    return stack.at(0).toTensor();
+  };
+
+  auto a = at::rand({3, 3});
+  // first call populates the cache, second call hits it
+  ASSERT_TRUE(exactlyEqual(run(a), a + at::ones({3, 3})));
+  ASSERT_TRUE(exactlyEqual(run(a), a + at::ones({3, 3})));
+
+  // a different shape misses the cache and recomputes
+  auto b = at::rand({2, 2});
+  ASSERT_TRUE(exactlyEqual(run(b), b + at::ones({2, 2})));
+}
+
+} // namespace jit
+} // namespace torch
@@ -303,3 +303,86 @@ TEST(MonitorTest, StatEventDestruction) {
   };
   ASSERT_EQ(e.data, data);
 }
+
+template <typename T>
+struct TestHistogramStat : public HistogramStat<T> {
+  uint64_t mockWindowId{1};
+
+  TestHistogramStat(
+      std::string name,
+      T lower,
+      T upper,
+      size_t numBuckets,
+      std::initializer_list<double> percentiles,
+      std::chrono::milliseconds windowSize)
+      : HistogramStat<T>(
+            name,
+            lower,
+            upper,
+            numBuckets,
+            percentiles,
+            windowSize) {}
+
+  uint64_t currentWindowId() const override {
+    return mockWindowId;
+  }
+};
+
+TEST(MonitorTest, HistogramStatPercentile) {
+  HistogramStat<int64_t> a{
+      "a",
+      0,
+      100,
+      100,
+      {0.5, 0.99},
+      std::chrono::hours(10),
+  };
+  ASSERT_EQ(a.count(), 0);
+  ASSERT_EQ(a.percentile(0.5), 0);
+
+  for (int64_t i = 0; i < 100; i++) {
+    a.add(i);
+  }
+  ASSERT_EQ(a.count(), 100);
+
+  // bucket midpoints
+  ASSERT_EQ(a.percentile(0.5), 50);
+  ASSERT_EQ(a.percentile(0.99), 99);
+
+  // out of range values are clamped into the edge buckets
+  a.add(-10);
+  a.add(1000);
+  ASSERT_EQ(a.count(), 102);
+}
+
+TEST(MonitorTest, HistogramStatEvent) {
+  HandlerGuard<AggregatingEventHandler> guard;
+
+  TestHistogramStat<int64_t> a{
+      "a",
+      0,
+      100,
+      100,
+      {0.5, 0.99},
+      std::chrono::milliseconds(1),
+  };
+  for (int64_t i = 0; i < 100; i++) {
+    a.add(i);
+  }
+  ASSERT_EQ(guard.handler->events.size(), 0);
+
+  a.mockWindowId = 100;
+
+  a.add(1);
+  ASSERT_EQ(a.count(), 1);
+
+  ASSERT_EQ(guard.handler->events.size(), 1);
+  Event e = guard.handler->events.at(0);
+  ASSERT_EQ(e.name, "torch.monitor.Stat");
+  std::unordered_map<std::string, data_value_t> data{
+      {"a.p50", 50L},
+      {"a.p99", 99L},
+      {"a.count", 100L},
+  };
+  ASSERT_EQ(e.data, data);
+}
@@ -603,6 +603,20 @@ CALL_REDISPATCH = CodeTemplate(
     """\
 at::redispatch::${api_name}(${unpacked_args})"""
 )
+
+# Emitted at the top of every generated kernel. When the thread-local pure
+# inference flag is set there is no graph to build, so the wrapper (and the
+# ADInplaceOrView hop) is skipped entirely and the plumbed keys go straight
+# to the backend kernel. See Note [Pure inference fast path] in
+# torch/csrc/autograd/pure_inference_mode.h.
+PURE_INFERENCE_FAST_PATH = CodeTemplate(
+    """\
+if (C10_UNLIKELY(torch::autograd::pure_inference_enabled())) {
+  at::AutoDispatchBelowADInplaceOrView guard;
+  ${fast_path_call}
+}
+"""
+)
 # If the non-variable operation has return values, we use the `tmp` variable to hold the
 # values temporarily and pass the values to the return variables outside of the
 # `at::AutoDispatchBelowAutograd` guard block.
@@ -1248,16 +1262,19 @@ def emit_body(
     #  - redispatch() avoids a redundant call to RecordFunction, which was already called right before
     #    we entered this autograd kernel.
     def emit_dispatch_call(
-        f: NativeFunction, input_base: str, unpacked_args: Sequence[str]
+        f: NativeFunction,
+        input_base: str,
+        unpacked_args: Sequence[str],
+        # code-generated autograd kernels plumb and recompute dispatch keys
+        # directly through the kernel for performance.
+        # Ops also always have a function variant of the redispatch API.
+        # See Note [Plumbing Keys Through The Dispatcher] for details.
+        dispatch_key_set: str = "ks & c10::after_autograd_keyset",
     ) -> str:
         """Dispatch call via function in a namespace or method on Tensor."""
         dispatcher_sig = DispatcherSignature.from_schema(f.func)
         dispatcher_exprs = dispatcher_sig.exprs()
 
-        # code-generated autograd kernels plumb and recompute dispatch keys directly through the kernel for performance.
-        # Ops also always have a function variant of the redispatch API.
-        # See Note [Plumbing Keys Through The Dispatcher] for details.
-        dispatch_key_set = "ks & c10::after_autograd_keyset"
         call = CALL_REDISPATCH.substitute(
             api_name=cpp.name(
                 f.func,
@@ -1712,6 +1729,23 @@ def emit_body(
     body: List[str] = []
     unpack_args_stats, unpacked_bindings = unpack_args(f)
 
+    # See Note [Pure inference fast path] in
+    # torch/csrc/autograd/pure_inference_mode.h. The formals are passed along
+    # as-is: they already match the faithful redispatch signature, and no
+    # unpacking has happened yet at this point.
+    fast_path_call = emit_dispatch_call(
+        f,
+        "self",
+        [a.name for a in f.func.schema_order_arguments()],
+        dispatch_key_set="ks & c10::after_ADInplaceOrView_keyset",
+    )
+    body.append(
+        PURE_INFERENCE_FAST_PATH.substitute(
+            fast_path_call=f"{fast_path_call};\nreturn;"
+            if returns_void
+            else f"return {fast_path_call};"
+        )
+    )
     body.extend(unpack_args_stats)
     if requires_derivative:
         body.extend(emit_any_requires_grad())
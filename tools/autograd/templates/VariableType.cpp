@@ -1,6 +1,7 @@
 #include "torch/csrc/autograd/VariableTypeUtils.h"
 #include "torch/csrc/autograd/generated/VariableType.h"
 #include "torch/csrc/autograd/FunctionsManual.h"
+#include "torch/csrc/autograd/pure_inference_mode.h"
 
 #include <ATen/RedispatchFunctions.h>
 #include <c10/core/impl/TorchDispatchModeTLS.h>
@@ -39,3 +39,9 @@ class EventHandlerHandle: ...
 
 def register_event_handler(handler: Callable[[Event], None]) -> EventHandlerHandle: ...
 def unregister_event_handler(handle: EventHandlerHandle) -> None: ...
+
+def _enable_op_latency_collection() -> None: ...
+def _disable_op_latency_collection() -> None: ...
+def _reset_op_latency_histograms() -> None: ...
+def _get_op_latency_histograms() -> Dict[str, List[int]]: ...
+def _op_latency_bucket_bounds() -> List[int]: ...
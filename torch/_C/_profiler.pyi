@@ -52,6 +52,10 @@ class _ExperimentalConfig:
         profiler_metrics: List[str] = ...,
         profiler_measure_per_kernel: bool = ...,
         verbose: bool = ...,
+        performance_events: List[str] = ...,
+        adjust_timestamps: bool = ...,
+        profiler_sample_rate: int = ...,
+        profiler_event_budget: int = ...,
     ) -> None: ...
     ...
 
@@ -141,6 +145,8 @@ class _ExtraFields_TorchOp:
     def inputs(self) -> List[Input]: ...
     @property
     def scope(self) -> RecordScope: ...
+    @property
+    def perf_event_counters(self) -> Optional[List[int]]: ...
 
 class _ExtraFields_Backend: ...
 
@@ -214,3 +220,23 @@ def _add_execution_graph_observer(output_file_path: str) -> bool: ...
 def _remove_execution_graph_observer() -> None: ...
 def _enable_execution_graph_observer() -> None: ...
 def _disable_execution_graph_observer() -> None: ...
+
+class _MemoryFlightEvent:
+    timestamp_ns: int
+    tid: int
+    alloc_size: int
+    total_allocated: int
+    total_reserved: int
+    is_oom: bool
+
+    @property
+    def ptr(self) -> int: ...
+    @property
+    def device(self) -> device: ...
+    @property
+    def op_name(self) -> str: ...
+
+def _enable_memory_flight_recorder(capacity: int) -> None: ...
+def _disable_memory_flight_recorder() -> None: ...
+def _memory_flight_recorder_enabled() -> bool: ...
+def _dump_memory_flight_recorder() -> List[_MemoryFlightEvent]: ...
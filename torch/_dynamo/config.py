@@ -69,6 +69,13 @@ assume_static_by_default = False
 # Set this to False to assume nn.Modules() contents are immutable (similar assumption as freezing)
 guard_nn_modules = False
 
+# Lower simple guards (type id / object id / grad mode checks) into a
+# GuardProgram evaluated in C++ without entering the interpreter, with
+# clauses reordered by observed failure rates. See
+# torch/csrc/dynamo/guards.cpp. Guards that cannot be lowered still run
+# as part of the Python check function.
+cpp_guards = os.environ.get("TORCHDYNAMO_DISABLE_CPP_GUARDS") != "1"
+
 # This feature doesn't really work.  We offer this flag for experimental
 # purposes / if you want to help us build out support.
 #
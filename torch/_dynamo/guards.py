@@ -44,6 +44,8 @@ log = logging.getLogger(__name__)
 TensorGuards = torch._C._dynamo.guards.TensorGuards
 check_obj_id = torch._C._dynamo.guards.check_obj_id
 check_type_id = torch._C._dynamo.guards.check_type_id
+dict_version = torch._C._dynamo.guards.dict_version
+GuardProgram = torch._C._dynamo.guards.GuardProgram
 
 
 CLOSURE_VARS = collections.OrderedDict(
@@ -80,6 +82,65 @@ def strip_getattr_getitem(name):
     return re.split(r"[.\[]", name)[0]
 
 
+# Guard code parts of these shapes can be lowered onto a C++ GuardProgram
+# (see torch/csrc/dynamo/guards.cpp) so that hot frame checks do not enter
+# the interpreter. A "ref" is a plain attribute/item chain rooted at a
+# local or global name; anything more complicated stays in the Python
+# check function.
+_guards_c = torch._C._dynamo.guards
+_guard_ref_regex = re.compile(
+    r"^([A-Za-z_][A-Za-z0-9_]*)"
+    r"((?:\.[A-Za-z_][A-Za-z0-9_]*|\[-?[0-9]+\]|\['[^'\\]*'\])*)$"
+)
+_guard_ref_step_regex = re.compile(
+    r"\.([A-Za-z_][A-Za-z0-9_]*)|\[(-?[0-9]+)\]|\['([^'\\]*)'\]"
+)
+_guard_type_id_regex = re.compile(r"^___check_type_id\((.*), (\d+)\)$")
+_guard_obj_id_regex = re.compile(r"^___check_obj_id\((.*), (\d+)\)$")
+
+
+def _lower_guard_ref(ref, root_names):
+    """Translate an attribute/item chain into GuardProgram instructions."""
+    m = _guard_ref_regex.match(ref)
+    if m is None:
+        return None
+    root = m.group(1)
+    if root not in root_names:
+        root_names[root] = len(root_names)
+    insts = [(_guards_c.OP_LOAD_ROOT, root_names[root])]
+    for step in _guard_ref_step_regex.finditer(m.group(2)):
+        if step.group(1) is not None:
+            insts.append((_guards_c.OP_GETATTR, step.group(1)))
+        elif step.group(2) is not None:
+            insts.append((_guards_c.OP_GETITEM, int(step.group(2))))
+        else:
+            insts.append((_guards_c.OP_GETITEM, step.group(3)))
+    return insts
+
+
+def _lower_guard_part(part, root_names):
+    """Try to compile one guard code part into a GuardProgram clause.
+
+    Returns None when the part has no C++ equivalent and must stay in the
+    Python check function.
+    """
+    if part == "___is_grad_enabled()":
+        return [(_guards_c.OP_CHECK_GRAD_MODE, 1)]
+    if part == "not ___is_grad_enabled()":
+        return [(_guards_c.OP_CHECK_GRAD_MODE, 0)]
+    for regex, opcode in (
+        (_guard_type_id_regex, _guards_c.OP_CHECK_TYPE_ID),
+        (_guard_obj_id_regex, _guards_c.OP_CHECK_OBJ_ID),
+    ):
+        m = regex.match(part)
+        if m is not None:
+            insts = _lower_guard_ref(m.group(1), root_names)
+            if insts is not None:
+                insts.append((opcode, int(m.group(2))))
+                return insts
+    return None
+
+
 class GuardBuilder(GuardBuilderBase):
     def __init__(
         self,
@@ -665,12 +726,35 @@ class CheckFunctionManager:
         verbose_code_parts.extend(local_builder.shape_env_code)
         assert not global_builder.shape_env_code
 
+        # Lower simple guards into a single C++ GuardProgram call; parts
+        # without a C++ equivalent remain in the Python expression. The
+        # verbose_code_parts are left untouched so that failure reporting
+        # still has one string per original guard.
+        guard_program = None
+        if config.cpp_guards:
+            root_names: Dict[str, int] = {}
+            clauses = []
+            residual_parts = [code_parts[0]]  # ___guarded_code.valid
+            for part in unique(code_parts[1:]):
+                clause = _lower_guard_part(part, root_names)
+                if clause is None:
+                    residual_parts.append(part)
+                else:
+                    clauses.append(clause)
+            if clauses:
+                guard_program = GuardProgram(clauses)
+                program_call = f"___check_guard_program({', '.join(root_names)})"
+                code_parts = (
+                    residual_parts[:1] + [program_call] + residual_parts[1:]
+                )
+
         code = " and ".join(unique(code_parts))
         closure_vars = collections.OrderedDict(
             [
                 ("___guarded_code", self),
                 ("___check_tensors", check_tensors_fn),
                 ("___check_tensors_verbose", check_tensors_verbose_fn),
+                ("___check_guard_program", guard_program.check if guard_program else None),
                 ("tensor_check_names", tensor_check_names),
             ]
             + list(SYMPY_INTERP.items())
@@ -694,6 +778,7 @@ def ___make_guard_fn({','.join(closure_vars.keys())}):
         guard_fn.verbose_code_parts = verbose_code_parts
         guard_fn.global_scope = global_builder.scope
         guard_fn.guard_fail_fn = guard_fail_fn
+        guard_fn.guard_program = guard_program
         return guard_fn
 
     def invalidate(self, ref):
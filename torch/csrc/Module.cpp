@@ -14,6 +14,7 @@
 #include <ATen/Parallel.h>
 #include <ATen/Utils.h>
 #include <ATen/core/Vitals.h>
+#include <ATen/core/dispatch/Dispatcher.h>
 #include <ATen/dlpack.h>
 #include <ATen/native/ConvUtils.h>
 #include <c10/core/DispatchKeySet.h>
@@ -452,6 +453,33 @@ PyObject* THPModule_fromDLPack(PyObject* _unused, PyObject* data) {
   END_HANDLE_TH_ERRORS
 }
 
+PyObject* THPModule_fromDLPackBatch(PyObject* _unused, PyObject* capsules) {
+  using namespace torch::autograd;
+  HANDLE_TH_ERRORS
+  THPUtils_assert(
+      PySequence_Check(capsules), "_from_dlpack_batch expects a sequence");
+  THPObjectPtr seq(PySequence_Fast(capsules, "expected a sequence of capsules"));
+  if (!seq)
+    return nullptr;
+  const Py_ssize_t size = PySequence_Fast_GET_SIZE(seq.get());
+  THPObjectPtr result(PyList_New(size));
+  if (!result)
+    return nullptr;
+  for (Py_ssize_t i = 0; i < size; i++) {
+    // tensor_fromDLPack validates and consumes each capsule, so a bad entry
+    // mid-batch leaves the earlier capsules already imported (owned by the
+    // tensors in `result`) and the later ones untouched.
+    auto tensor =
+        torch::utils::tensor_fromDLPack(PySequence_Fast_GET_ITEM(seq.get(), i));
+    PyObject* wrapped = THPVariable_Wrap(tensor);
+    if (!wrapped)
+      return nullptr;
+    PyList_SET_ITEM(result.get(), i, wrapped);
+  }
+  return result.release();
+  END_HANDLE_TH_ERRORS
+}
+
 PyObject* THModule_getCppBacktrace(PyObject* _unused, PyObject* args) {
   HANDLE_TH_ERRORS
   size_t frames_to_skip;
@@ -1129,6 +1157,7 @@ static PyMethodDef TorchMethods[] = {
      nullptr},
     {"_to_dlpack", THPModule_toDLPack, METH_O, nullptr},
     {"_from_dlpack", THPModule_fromDLPack, METH_O, nullptr},
+    {"_from_dlpack_batch", THPModule_fromDLPackBatch, METH_O, nullptr},
     {"_get_cpp_backtrace", THModule_getCppBacktrace, METH_VARARGS, nullptr},
     {"_rename_privateuse1_backend",
      THModule_rename_privateuse1_backend,
@@ -1253,6 +1282,12 @@ PyObject* initModule() {
 
   at::internal::lazy_init_num_threads();
 
+  // By the time the Python module initializes, all statically linked operator
+  // and fallback registrations have run, so this is the spot to materialize
+  // dispatch tables that were deferred during startup.
+  // See Note [Deferred dispatch table updates]
+  c10::Dispatcher::singleton().flushDeferredDispatchTableUpdates();
+
   C10_LOG_API_USAGE_ONCE("torch.python.import");
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -1400,6 +1435,17 @@ Initializes the number of parallel threads used on the current thread.
 
 Call this whenever a new thread is created in order to propagate values from
 :func:`torch.set_num_threads` onto the new thread.
+)");
+
+  py_module.def(
+      "_set_thread_affinity",
+      [](const std::vector<int>& cpus) { at::set_thread_affinity(cpus); },
+      py::arg("cpus"),
+      R"(
+_set_thread_affinity(cpus)
+
+Pins the calling thread and the intra-op worker threads to the given list of
+logical cpu ids. Only effective on Linux.
 )");
 
   ASSERT_TRUE(
@@ -1461,6 +1507,8 @@ Call this whenever a new thread is created in order to propagate values from
       .value("SlowDilated3d", at::native::ConvBackend::SlowDilated3d)
       .value("SlowTranspose2d", at::native::ConvBackend::SlowTranspose2d)
       .value("SlowTranspose3d", at::native::ConvBackend::SlowTranspose3d)
+      .value("DepthwiseDirect2d", at::native::ConvBackend::DepthwiseDirect2d)
+      .value("Winograd3x3", at::native::ConvBackend::Winograd3x3)
       .value(
           "Winograd3x3Depthwise", at::native::ConvBackend::Winograd3x3Depthwise)
       .value("Xnnpack2d", at::native::ConvBackend::Xnnpack2d)
@@ -29,6 +29,7 @@
 #include <ATen/StorageUtils.h>
 #include <torch/csrc/utils/python_numbers.h>
 #include <atomic>
+#include <cstring>
 #include <string>
 
 static PyObject* THPStorage_sharedDecref(PyObject* _self, PyObject* noargs) {
@@ -261,6 +262,161 @@ static PyObject* THPStorage_newSharedFd(PyObject* _unused, PyObject* args) {
   END_HANDLE_TH_ERRORS
 }
 
+// Note [Arena sharing]
+// ~~~~~~~~~~~~~~~~~~~~
+// The file_descriptor strategy creates one shm segment, fd and mmap per
+// shared storage. Pipelines that fan out thousands of small tensors hit fd
+// exhaustion and pay a map/unmap syscall pair per tensor. Arena sharing
+// packs small storages into pooled shm segments managed by
+// torch.multiprocessing.reductions: the sender copies the bytes into a
+// slice of an fd-backed segment and becomes a view of it, and the receiver
+// maps each segment once (cached by fd identity) and builds view storages
+// at the sent offsets. A view's DataPtr context holds a reference to the
+// segment storage, so the segment stays mapped as long as any slice of it
+// is alive.
+namespace {
+
+void deleteArenaViewContext(void* ctx);
+
+struct ArenaViewContext {
+  at::Storage segment;
+  int64_t offset;
+
+  static ArenaViewContext* fromDataPtr(const at::DataPtr& data_ptr) {
+    return data_ptr.get_deleter() == &deleteArenaViewContext
+        ? static_cast<ArenaViewContext*>(data_ptr.get_context())
+        : nullptr;
+  }
+};
+
+void deleteArenaViewContext(void* ctx) {
+  delete static_cast<ArenaViewContext*>(ctx);
+}
+
+c10::intrusive_ptr<c10::StorageImpl> newArenaViewStorageImpl(
+    at::Storage segment,
+    int64_t offset,
+    int64_t size) {
+  TORCH_CHECK(
+      offset >= 0 && size >= 0 &&
+          static_cast<uint64_t>(offset) + static_cast<uint64_t>(size) <=
+              segment.nbytes(),
+      "arena view [",
+      offset,
+      ", ",
+      offset + size,
+      ") is out of bounds for a segment of ",
+      segment.nbytes(),
+      " bytes");
+  char* base = static_cast<char*>(segment.unsafeGetStorageImpl()->data());
+  auto* ctx = new ArenaViewContext{std::move(segment), offset};
+  return c10::make_intrusive<at::StorageImpl>(
+      c10::StorageImpl::use_byte_size_t(),
+      size,
+      at::DataPtr(
+          base + offset, ctx, &deleteArenaViewContext, at::DeviceType::CPU),
+      /*allocator=*/nullptr,
+      /*resizable=*/false);
+}
+
+} // namespace
+
+static PyObject* THPStorage_shareFdArena(PyObject* _self, PyObject* args) {
+  HANDLE_TH_ERRORS
+  TORCH_CHECK(
+      reinterpret_cast<THPStorage*>(_self)->cdata->device_type() == at::kCPU,
+      "_share_fd_arena_: only available on CPU");
+  auto self = (THPStorage*)_self;
+  c10::StorageImpl* storage = self->cdata;
+
+  PyObject* _segment = nullptr;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  long long offset;
+  if (!PyArg_ParseTuple(args, "OL", &_segment, &offset)) {
+    return nullptr;
+  }
+  THPUtils_assert(
+      torch::isStorage(_segment), "_share_fd_arena_: segment must be a storage");
+
+  // Returns (fd, segment_size, offset, size, packed_now). The caller only
+  // advances its bump pointer when packed_now is true.
+  bool packed_now = false;
+  at::MapAllocator* segment_ctx = nullptr;
+  if (ArenaViewContext* view = ArenaViewContext::fromDataPtr(storage->data_ptr())) {
+    // Already packed into a segment; hand out the existing slice.
+    segment_ctx = at::MapAllocator::fromDataPtr(
+        view->segment.unsafeGetStorageImpl()->data_ptr());
+    AT_ASSERT(segment_ctx);
+    offset = view->offset;
+  } else {
+    TORCH_CHECK(
+        !at::MapAllocator::fromDataPtr(storage->data_ptr()) &&
+            !THManagedMapAllocator::fromDataPtr(storage->data_ptr()),
+        "_share_fd_arena_: storage is already in shared memory");
+    at::Storage segment = torch::createStorage(_segment);
+    segment_ctx = at::MapAllocator::fromDataPtr(
+        segment.unsafeGetStorageImpl()->data_ptr());
+    TORCH_CHECK(
+        segment_ctx && segment_ctx->fd() != -1,
+        "_share_fd_arena_: segment must be an fd-backed shared memory storage");
+
+    auto view_impl = newArenaViewStorageImpl(
+        segment, offset, static_cast<int64_t>(storage->nbytes()));
+    memcpy(view_impl->data(), storage->data(), storage->nbytes());
+    std::swap(*storage, *view_impl);
+    packed_now = true;
+  }
+
+  ArenaViewContext* view = ArenaViewContext::fromDataPtr(storage->data_ptr());
+  AT_ASSERT(view);
+  THPObjectPtr tuple(PyTuple_New(5));
+  if (!tuple)
+    return nullptr;
+  PyTuple_SET_ITEM(tuple.get(), 0, THPUtils_packInt32(segment_ctx->fd()));
+  PyTuple_SET_ITEM(
+      tuple.get(),
+      1,
+      THPUtils_packUInt64(view->segment.nbytes()));
+  PyTuple_SET_ITEM(tuple.get(), 2, THPUtils_packInt64(offset));
+  PyTuple_SET_ITEM(tuple.get(), 3, THPUtils_packUInt64(storage->nbytes()));
+  PyTuple_SET_ITEM(tuple.get(), 4, PyBool_FromLong(packed_now));
+  return tuple.release();
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* THPStorage_isArenaView(PyObject* _self, PyObject* noargs) {
+  HANDLE_TH_ERRORS
+  auto self = (THPStorage*)_self;
+  return PyBool_FromLong(
+      self->cdata->device_type() == at::kCPU &&
+      ArenaViewContext::fromDataPtr(self->cdata->data_ptr()) != nullptr);
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* THPStorage_newSharedFdArena(
+    PyObject* _unused,
+    PyObject* args) {
+  HANDLE_TH_ERRORS
+  PyObject* _segment = nullptr;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  long long offset;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  long long size;
+  if (!PyArg_ParseTuple(args, "OLL", &_segment, &offset, &size)) {
+    return nullptr;
+  }
+  THPUtils_assert(
+      torch::isStorage(_segment),
+      "_new_shared_fd_arena_cpu: segment must be a storage");
+  at::Storage segment = torch::createStorage(_segment);
+  TORCH_CHECK(
+      segment.device_type() == at::kCPU,
+      "_new_shared_fd_arena_cpu: only available on CPU");
+  return THPStorage_New(
+      newArenaViewStorageImpl(std::move(segment), offset, size));
+  END_HANDLE_TH_ERRORS
+}
+
 static PyObject* THPStorage_shareCuda(PyObject* _self, PyObject* noargs) {
   HANDLE_TH_ERRORS
 #ifdef USE_CUDA
@@ -615,7 +771,8 @@ PyObject* THPStorage_isShared(PyObject* _self, PyObject* noargs) {
     Py_RETURN_TRUE;
   }
   if (at::MapAllocator::fromDataPtr(self->cdata->data_ptr()) ||
-      THManagedMapAllocator::fromDataPtr(self->cdata->data_ptr())) {
+      THManagedMapAllocator::fromDataPtr(self->cdata->data_ptr()) ||
+      ArenaViewContext::fromDataPtr(self->cdata->data_ptr())) {
     Py_RETURN_TRUE;
   } else {
     Py_RETURN_FALSE;
@@ -642,6 +799,12 @@ static PyMethodDef THPStorage_sharingMethods[] = {
      THPStorage_newSharedFd,
      METH_VARARGS | METH_STATIC,
      nullptr},
+    {"_share_fd_arena_cpu_", THPStorage_shareFdArena, METH_VARARGS, nullptr},
+    {"_is_arena_view_cpu", THPStorage_isArenaView, METH_NOARGS, nullptr},
+    {"_new_shared_fd_arena_cpu",
+     THPStorage_newSharedFdArena,
+     METH_VARARGS | METH_STATIC,
+     nullptr},
     {"_new_using_fd_cpu",
      THPStorage_pyNewFdStorage,
      METH_VARARGS | METH_STATIC,
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <torch/data/datasets/chunk.h>
+#include <torch/data/example.h>
+#include <torch/types.h>
+
+#include <ATen/MapAllocator.h>
+#include <c10/util/Exception.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace datasets {
+
+/// A reference on-disk format for `ChunkDataset`, plus a reader and writer.
+///
+/// `ChunkDataset` leaves chunk I/O entirely to the user; this header provides
+/// a simple binary format so that a fast reader does not have to be
+/// reinvented per project. A chunk file holds fixed-shape (data, target)
+/// example pairs in native byte order:
+///
+///   - a fixed 512-byte header recording dtypes, per-example shapes, the
+///     number of examples and the examples-per-chunk grouping;
+///   - one record per example, with the data and target payloads each
+///     aligned to 64 bytes and a fixed record stride, so the byte offset of
+///     any example is a single multiplication -- O(1) random access.
+///
+/// `ChunkFileReader` memory-maps the file with `at::MapAllocator` and returns
+/// examples as zero-copy views over the mapped pages, so reading a chunk is
+/// bounded by page-in bandwidth rather than allocation and deserialization.
+/// Background prefetch comes from `ChunkDataset` itself, whose preloader
+/// threads call `read_chunk` concurrently into the batch buffer; the reader
+/// is stateless after construction and safe to call from those threads.
+namespace chunk_file {
+
+constexpr char kMagic[8] = {'T', 'O', 'R', 'C', 'H', 'C', 'H', 'K'};
+constexpr int64_t kVersion = 1;
+constexpr size_t kMaxDims = 8;
+constexpr size_t kAlignment = 64;
+constexpr size_t kHeaderBytes = 512;
+
+/// The fixed file header. All integers are native-endian int64.
+struct Header {
+  char magic[8];
+  int64_t version;
+  int64_t data_dtype;
+  int64_t target_dtype;
+  int64_t num_examples;
+  int64_t examples_per_chunk;
+  int64_t data_ndim;
+  int64_t data_sizes[kMaxDims];
+  int64_t target_ndim;
+  int64_t target_sizes[kMaxDims];
+  int64_t target_record_offset;
+  int64_t record_stride;
+};
+static_assert(
+    sizeof(Header) <= kHeaderBytes,
+    "chunk file header must fit in the fixed header region");
+
+inline size_t align_up(size_t value) {
+  return (value + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+} // namespace chunk_file
+
+/// Writes fixed-shape (data, target) examples into a chunk file; see the
+/// format description above. Examples are appended with `write_example` and
+/// the header is finalized on `finalize()` (or destruction).
+class ChunkFileWriter {
+ public:
+  ChunkFileWriter(
+      const std::string& filename,
+      at::IntArrayRef data_sizes,
+      at::ScalarType data_dtype,
+      at::IntArrayRef target_sizes,
+      at::ScalarType target_dtype,
+      size_t examples_per_chunk)
+      : stream_(filename, std::ios::binary | std::ios::trunc) {
+    TORCH_CHECK(stream_, "Failed to open chunk file for writing: ", filename);
+    TORCH_CHECK(
+        data_sizes.size() <= chunk_file::kMaxDims &&
+            target_sizes.size() <= chunk_file::kMaxDims,
+        "Chunk file examples support at most ",
+        chunk_file::kMaxDims,
+        " dimensions");
+    TORCH_CHECK(
+        examples_per_chunk > 0, "examples_per_chunk must be positive");
+    std::memset(&header_, 0, sizeof(header_));
+    std::memcpy(header_.magic, chunk_file::kMagic, sizeof(header_.magic));
+    header_.version = chunk_file::kVersion;
+    header_.data_dtype = static_cast<int64_t>(data_dtype);
+    header_.target_dtype = static_cast<int64_t>(target_dtype);
+    header_.examples_per_chunk = static_cast<int64_t>(examples_per_chunk);
+    header_.data_ndim = static_cast<int64_t>(data_sizes.size());
+    for (size_t i = 0; i < data_sizes.size(); ++i) {
+      header_.data_sizes[i] = data_sizes[i];
+    }
+    header_.target_ndim = static_cast<int64_t>(target_sizes.size());
+    for (size_t i = 0; i < target_sizes.size(); ++i) {
+      header_.target_sizes[i] = target_sizes[i];
+    }
+    data_bytes_ = c10::elementSize(data_dtype);
+    for (const auto size : data_sizes) {
+      data_bytes_ *= size;
+    }
+    target_bytes_ = c10::elementSize(target_dtype);
+    for (const auto size : target_sizes) {
+      target_bytes_ *= size;
+    }
+    header_.target_record_offset =
+        static_cast<int64_t>(chunk_file::align_up(data_bytes_));
+    header_.record_stride = static_cast<int64_t>(
+        chunk_file::align_up(header_.target_record_offset + target_bytes_));
+    // Reserve the header region; the final header is written in finalize(),
+    // when the example count is known.
+    write_header();
+    stream_.seekp(chunk_file::kHeaderBytes);
+  }
+
+  ChunkFileWriter(const ChunkFileWriter&) = delete;
+  ChunkFileWriter& operator=(const ChunkFileWriter&) = delete;
+
+  ~ChunkFileWriter() {
+    if (stream_.is_open()) {
+      finalize();
+    }
+  }
+
+  /// Appends one example. The tensors must match the shapes and dtypes the
+  /// writer was constructed with.
+  void write_example(const Example<>& example) {
+    write_tensor(example.data, header_.data_dtype, data_bytes_, "data");
+    pad_to(header_.target_record_offset - static_cast<int64_t>(data_bytes_));
+    write_tensor(example.target, header_.target_dtype, target_bytes_, "target");
+    pad_to(
+        header_.record_stride - header_.target_record_offset -
+        static_cast<int64_t>(target_bytes_));
+    header_.num_examples++;
+  }
+
+  /// Rewrites the header with the final example count and closes the file.
+  void finalize() {
+    stream_.seekp(0);
+    write_header();
+    stream_.close();
+    TORCH_CHECK(stream_, "Failed to finalize chunk file");
+  }
+
+ private:
+  void write_header() {
+    char buffer[chunk_file::kHeaderBytes] = {};
+    std::memcpy(buffer, &header_, sizeof(header_));
+    stream_.write(buffer, sizeof(buffer));
+  }
+
+  void write_tensor(
+      const at::Tensor& tensor,
+      int64_t dtype,
+      size_t bytes,
+      const char* what) {
+    TORCH_CHECK(
+        static_cast<int64_t>(tensor.scalar_type()) == dtype,
+        "Example ",
+        what,
+        " tensor has the wrong dtype for this chunk file");
+    auto contiguous = tensor.contiguous();
+    TORCH_CHECK(
+        contiguous.nbytes() == bytes,
+        "Example ",
+        what,
+        " tensor has the wrong shape for this chunk file");
+    stream_.write(static_cast<const char*>(contiguous.data_ptr()), bytes);
+  }
+
+  void pad_to(int64_t padding) {
+    static const char zeros[chunk_file::kAlignment] = {};
+    if (padding > 0) {
+      stream_.write(zeros, padding);
+    }
+  }
+
+  std::ofstream stream_;
+  chunk_file::Header header_;
+  size_t data_bytes_ = 0;
+  size_t target_bytes_ = 0;
+};
+
+/// Memory-mapped reader for the chunk file format; a drop-in
+/// `ChunkDataReader` for `ChunkDataset`. Examples are zero-copy views over
+/// the mapped pages (a private mapping, so mutating a view triggers
+/// copy-on-write and never reaches the file -- `clone()` first if you want a
+/// plainly owned tensor). The reader keeps no per-call state, so
+/// `ChunkDataset`'s preloader threads can call `read_chunk` concurrently.
+class ChunkFileReader : public ChunkDataReader<Example<>> {
+ public:
+  explicit ChunkFileReader(const std::string& filename) {
+    size_t file_size = 0;
+    {
+      std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+      TORCH_CHECK(stream, "Failed to open chunk file: ", filename);
+      file_size = static_cast<size_t>(stream.tellg());
+    }
+    TORCH_CHECK(
+        file_size >= chunk_file::kHeaderBytes,
+        "File too small to be a chunk file: ",
+        filename);
+    size_t actual_size = 0;
+    map_ = std::make_shared<at::DataPtr>(at::MapAllocator::makeDataPtr(
+        filename, /*flags=*/0, file_size, &actual_size));
+    std::memcpy(&header_, map_->get(), sizeof(header_));
+    TORCH_CHECK(
+        std::memcmp(header_.magic, chunk_file::kMagic, sizeof(header_.magic)) ==
+            0,
+        "Not a chunk file: ",
+        filename);
+    TORCH_CHECK(
+        header_.version == chunk_file::kVersion,
+        "Unsupported chunk file version: ",
+        header_.version);
+    TORCH_CHECK(
+        chunk_file::kHeaderBytes +
+                static_cast<size_t>(header_.num_examples) *
+                    static_cast<size_t>(header_.record_stride) <=
+            file_size,
+        "Chunk file is truncated: ",
+        filename);
+    data_sizes_.assign(
+        header_.data_sizes, header_.data_sizes + header_.data_ndim);
+    target_sizes_.assign(
+        header_.target_sizes, header_.target_sizes + header_.target_ndim);
+  }
+
+  /// Returns the `index`-th example as a zero-copy view over the mapping.
+  Example<> example(size_t index) {
+    TORCH_CHECK(
+        index < static_cast<size_t>(header_.num_examples),
+        "Example index ",
+        index,
+        " out of range");
+    char* record = static_cast<char*>(map_->get()) + chunk_file::kHeaderBytes +
+        index * static_cast<size_t>(header_.record_stride);
+    return {
+        view(record, data_sizes_, static_cast<at::ScalarType>(header_.data_dtype)),
+        view(
+            record + header_.target_record_offset,
+            target_sizes_,
+            static_cast<at::ScalarType>(header_.target_dtype))};
+  }
+
+  ChunkType read_chunk(size_t chunk_index) override {
+    const auto begin =
+        chunk_index * static_cast<size_t>(header_.examples_per_chunk);
+    const auto end = std::min(
+        begin + static_cast<size_t>(header_.examples_per_chunk),
+        static_cast<size_t>(header_.num_examples));
+    TORCH_CHECK(begin < end, "Chunk index ", chunk_index, " out of range");
+    ChunkType chunk;
+    chunk.reserve(end - begin);
+    for (size_t index = begin; index < end; ++index) {
+      chunk.push_back(example(index));
+    }
+    return chunk;
+  }
+
+  size_t chunk_count() override {
+    return (static_cast<size_t>(header_.num_examples) +
+            static_cast<size_t>(header_.examples_per_chunk) - 1) /
+        static_cast<size_t>(header_.examples_per_chunk);
+  }
+
+  size_t example_count() const noexcept {
+    return static_cast<size_t>(header_.num_examples);
+  }
+
+  void reset() override {}
+
+ private:
+  at::Tensor view(
+      char* pointer,
+      const std::vector<int64_t>& sizes,
+      at::ScalarType dtype) {
+    // The deleter keeps the mapping alive for as long as any view does.
+    auto map = map_;
+    return torch::from_blob(
+        pointer,
+        sizes,
+        [map](void*) {},
+        at::TensorOptions().dtype(dtype));
+  }
+
+  std::shared_ptr<at::DataPtr> map_;
+  chunk_file::Header header_;
+  std::vector<int64_t> data_sizes_;
+  std::vector<int64_t> target_sizes_;
+};
+
+} // namespace datasets
+} // namespace data
+} // namespace torch
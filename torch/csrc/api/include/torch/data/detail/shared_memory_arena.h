@@ -0,0 +1,162 @@
+#pragma once
+
+#include <torch/types.h>
+
+#include <ATen/MapAllocator.h>
+#include <c10/util/Exception.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace detail {
+
+/// A ring of shared-memory segments from which batch tensors are
+/// bump-allocated.
+///
+/// The `DataLoader` moves batches from worker to consumer through in-process
+/// queues, so the transport itself does not copy; what remains per batch is
+/// an allocator round trip for every tensor in it, and -- when a batch has to
+/// cross a process boundary -- a serialization copy on both ends. The arena
+/// removes both: a worker allocates batch tensors directly out of a
+/// shared-memory segment (`at::MapAllocator` pages, so another process can
+/// map the same pages under the segment's handle), and the consumer's tensors
+/// alias those pages. A segment is recycled wholesale once every tensor
+/// allocated from it has been released, replacing per-tensor malloc/free
+/// churn with a single fence per ring slot.
+///
+/// Batch construction is dataset-defined in the C++ frontend, so the arena is
+/// an opt-in building block rather than something the `DataLoader` wires up
+/// itself. Typical use is one arena per worker:
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   SharedMemoryArena arena(/*segment_bytes=*/64 << 20, /*num_segments=*/4);
+///   auto batch = arena.allocate({batch_size, 3, 224, 224}, torch::kFloat32);
+///   // ... fill `batch` and hand it to the data shuttle ...
+///   arena.advance(); // blocks until the next ring slot's tensors are freed
+/// \endrst
+class SharedMemoryArena {
+ public:
+  /// Creates `num_segments` shared-memory segments of (at least)
+  /// `segment_bytes` each. A segment must be large enough to hold every
+  /// tensor allocated between two calls to `advance()`.
+  explicit SharedMemoryArena(size_t segment_bytes, size_t num_segments = 2) {
+    TORCH_CHECK(segment_bytes > 0, "segment_bytes must be positive");
+    TORCH_CHECK(num_segments >= 2, "A ring needs at least two segments");
+    segments_.reserve(num_segments);
+    for (size_t i = 0; i < num_segments; ++i) {
+      auto segment = std::make_shared<Segment>();
+      segment->handle = at::NewProcessWideShmHandle();
+      size_t actual_size = 0;
+      segment->data = at::MapAllocator::makeDataPtr(
+          segment->handle,
+          at::ALLOCATOR_MAPPED_SHAREDMEM | at::ALLOCATOR_MAPPED_EXCLUSIVE,
+          segment_bytes,
+          &actual_size);
+      segment->size = actual_size;
+      segments_.push_back(std::move(segment));
+    }
+  }
+
+  /// Returns a CPU tensor of the given shape and options whose storage lives
+  /// in the current shared-memory segment. The tensor aliases the segment's
+  /// pages; it must be released (on whichever side of the queue it ends up)
+  /// before the segment's ring slot can be reused.
+  at::Tensor allocate(at::IntArrayRef sizes, at::TensorOptions options = {}) {
+    TORCH_CHECK(
+        options.device().is_cpu(),
+        "SharedMemoryArena can only allocate CPU tensors");
+    int64_t numel = 1;
+    for (const auto size : sizes) {
+      TORCH_CHECK(size >= 0, "Tensor sizes must be non-negative");
+      numel *= size;
+    }
+    const size_t bytes = static_cast<size_t>(numel) * options.dtype().itemsize();
+    auto segment = segments_[current_];
+    const size_t aligned_offset =
+        (segment->offset + kAlignment - 1) & ~(kAlignment - 1);
+    TORCH_CHECK(
+        aligned_offset + bytes <= segment->size,
+        "SharedMemoryArena segment of ",
+        segment->size,
+        " bytes cannot hold another ",
+        bytes,
+        " byte allocation; increase segment_bytes or call advance() more often");
+    void* pointer = static_cast<char*>(segment->data.get()) + aligned_offset;
+    segment->offset = aligned_offset + bytes;
+    segment->outstanding.fetch_add(1, std::memory_order_acq_rel);
+    // The deleter holds a reference to the segment, so the mapping outlives
+    // every tensor allocated from it even if the arena is destroyed first.
+    return torch::from_blob(
+        pointer,
+        sizes,
+        [segment](void*) {
+          if (segment->outstanding.fetch_sub(1, std::memory_order_acq_rel) ==
+              1) {
+            std::lock_guard<std::mutex> lock(segment->mutex);
+            segment->cv.notify_all();
+          }
+        },
+        options);
+  }
+
+  /// Moves on to the next segment in the ring, blocking until every tensor
+  /// previously allocated from that segment has been released. Call this once
+  /// per batch, after the batch has been pushed to the consumer; the wait is
+  /// the backpressure that stops a worker from overwriting pages the consumer
+  /// still reads.
+  void advance() {
+    current_ = (current_ + 1) % segments_.size();
+    auto& segment = *segments_[current_];
+    std::unique_lock<std::mutex> lock(segment.mutex);
+    segment.cv.wait(lock, [&segment] {
+      return segment.outstanding.load(std::memory_order_acquire) == 0;
+    });
+    segment.offset = 0;
+  }
+
+  /// The shared-memory handle of the `index`-th segment. Another process can
+  /// map the same pages by passing this handle to
+  /// `at::MapAllocator::makeDataPtr` with `ALLOCATOR_MAPPED_SHAREDMEM |
+  /// ALLOCATOR_MAPPED_NOCREATE` and construct tensors over them with
+  /// `torch::from_blob`.
+  const std::string& handle(size_t index) const {
+    return segments_.at(index)->handle;
+  }
+
+  /// The number of segments in the ring.
+  size_t size() const noexcept {
+    return segments_.size();
+  }
+
+ private:
+  // Matches the alignment guaranteed by the default CPU allocator.
+  static constexpr size_t kAlignment = 64;
+
+  struct Segment {
+    at::DataPtr data;
+    std::string handle;
+    size_t size = 0;
+    size_t offset = 0;
+    // Number of live tensors allocated from this segment.
+    std::atomic<int64_t> outstanding{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+
+  std::vector<std::shared_ptr<Segment>> segments_;
+  size_t current_ = 0;
+};
+
+} // namespace detail
+} // namespace data
+} // namespace torch
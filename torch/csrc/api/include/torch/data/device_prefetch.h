@@ -0,0 +1,212 @@
+#pragma once
+
+#include <torch/data/example.h>
+#include <torch/types.h>
+
+#include <c10/core/Event.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+#include <c10/util/Exception.h>
+#include <c10/util/Optional.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+
+namespace torch {
+namespace data {
+
+/// Moves a batch component to `device` without blocking the host.
+///
+/// CPU tensors bound for a CUDA device are staged through pinned memory
+/// first, so the subsequent copy can run asynchronously on the current
+/// stream. Overloads exist for the common batch shapes; add another overload
+/// for custom batch types.
+inline at::Tensor to_device_async(at::Tensor tensor, Device device) {
+  if (!tensor.defined() || tensor.device() == device) {
+    return tensor;
+  }
+  if (device.is_cuda() && tensor.device().is_cpu() && !tensor.is_pinned()) {
+    tensor = tensor.pin_memory();
+  }
+  return tensor.to(tensor.options().device(device), /*non_blocking=*/true);
+}
+
+template <typename Data, typename Target>
+Example<Data, Target> to_device_async(
+    Example<Data, Target> example,
+    Device device) {
+  return {
+      to_device_async(std::move(example.data), device),
+      to_device_async(std::move(example.target), device)};
+}
+
+template <typename Data>
+Example<Data, example::NoTarget> to_device_async(
+    Example<Data, example::NoTarget> example,
+    Device device) {
+  return {to_device_async(std::move(example.data), device)};
+}
+
+template <typename T>
+std::vector<T> to_device_async(std::vector<T> batch, Device device) {
+  for (auto& item : batch) {
+    item = to_device_async(std::move(item), device);
+  }
+  return batch;
+}
+
+/// An adapter that keeps a pipeline of batches in flight to a device.
+///
+/// The `DataLoader` overlaps batch *construction* with training, but the
+/// batch it hands out still lives on the CPU; a training loop that calls
+/// `.to(device)` per batch serializes the host-to-device copy with the step
+/// that consumes it. The prefetcher pulls batches from a producer on a
+/// background thread, stages them through pinned memory, and issues the copy
+/// on a dedicated stream taken from the device's pool, so up to `depth`
+/// batches are in flight while the current one is being consumed. `next()`
+/// returns device-resident batches; it makes the consumer's current stream
+/// wait on the copy (via an event, not a host sync) before handing the batch
+/// out.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   auto iterator = data_loader->begin();
+///   DevicePrefetcher<Batch> prefetcher(
+///       [&]() -> torch::optional<Batch> {
+///         if (iterator == data_loader->end()) {
+///           return torch::nullopt;
+///         }
+///         auto batch = std::move(*iterator);
+///         ++iterator;
+///         return batch;
+///       },
+///       torch::kCUDA);
+///   while (auto batch = prefetcher.next()) {
+///     train_step(*batch);
+///   }
+/// \endrst
+///
+/// The producer is called only from the prefetcher's own thread, and must
+/// eventually return (the destructor joins that thread). Destroy the
+/// prefetcher before the `DataLoader` it draws from.
+template <typename Batch>
+class DevicePrefetcher {
+ public:
+  using BatchProducer = std::function<optional<Batch>()>;
+
+  DevicePrefetcher(BatchProducer next_batch, Device device, size_t depth = 2)
+      : next_batch_(std::move(next_batch)),
+        device_(device),
+        depth_(depth),
+        impl_(device.type()) {
+    TORCH_CHECK(depth_ >= 1, "DevicePrefetcher depth must be at least 1");
+    worker_ = std::thread([this] { this->run(); });
+  }
+
+  DevicePrefetcher(const DevicePrefetcher&) = delete;
+  DevicePrefetcher& operator=(const DevicePrefetcher&) = delete;
+
+  ~DevicePrefetcher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    room_cv_.notify_all();
+    worker_.join();
+  }
+
+  /// Returns the next device-resident batch, or `nullopt` when the producer
+  /// is exhausted. Blocks the host only when no batch has finished staging
+  /// yet; the copy itself is ordered against the caller's current stream
+  /// through an event.
+  optional<Batch> next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ready_cv_.wait(lock, [this] {
+      return !ready_.empty() || exhausted_ || exception_;
+    });
+    if (exception_) {
+      auto exception = exception_;
+      exception_ = nullptr;
+      std::rethrow_exception(exception);
+    }
+    if (ready_.empty()) {
+      return nullopt;
+    }
+    Slot slot = std::move(ready_.front());
+    ready_.pop();
+    lock.unlock();
+    room_cv_.notify_one();
+    // Order the consumer's current stream after the staging copy. This is a
+    // device-side dependency; the host does not wait for the copy to finish.
+    slot.copied.block(impl_.getStream(device_));
+    return std::move(slot.batch);
+  }
+
+ private:
+  struct Slot {
+    Batch batch;
+    c10::Event copied;
+  };
+
+  void run() {
+    // One dedicated stream for the lifetime of the prefetcher; every staging
+    // copy is issued on it so copies from consecutive batches queue up behind
+    // each other instead of the consumer's work.
+    const c10::Stream stream = impl_.getStreamFromGlobalPool(device_);
+    while (true) {
+      optional<Batch> batch;
+      try {
+        batch = next_batch_();
+        if (batch) {
+          c10::StreamGuard guard(stream);
+          *batch = to_device_async(std::move(*batch), device_);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exception_ = std::current_exception();
+        ready_cv_.notify_all();
+        return;
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!batch) {
+        exhausted_ = true;
+        ready_cv_.notify_all();
+        return;
+      }
+      room_cv_.wait(
+          lock, [this] { return ready_.size() < depth_ || stop_; });
+      if (stop_) {
+        return;
+      }
+      Slot slot{std::move(*batch), c10::Event(device_.type())};
+      slot.copied.record(stream);
+      ready_.push(std::move(slot));
+      ready_cv_.notify_one();
+    }
+  }
+
+  BatchProducer next_batch_;
+  const Device device_;
+  const size_t depth_;
+  c10::impl::VirtualGuardImpl impl_;
+
+  std::mutex mutex_;
+  std::condition_variable ready_cv_;
+  std::condition_variable room_cv_;
+  std::queue<Slot> ready_;
+  bool exhausted_ = false;
+  bool stop_ = false;
+  std::exception_ptr exception_;
+
+  std::thread worker_;
+};
+
+} // namespace data
+} // namespace torch
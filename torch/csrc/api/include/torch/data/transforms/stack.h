@@ -14,6 +14,18 @@ namespace transforms {
 template <typename T = Example<>>
 struct Stack;
 
+namespace detail {
+/// Collates on CPU through `_stack_parallel`, which scatters the example
+/// copies across the intra-op pool; everything else goes through the
+/// regular serial `stack`.
+inline torch::Tensor collate_stack(const std::vector<torch::Tensor>& data) {
+  if (!data.empty() && data.front().device().is_cpu()) {
+    return torch::_stack_parallel(data);
+  }
+  return torch::stack(data);
+}
+} // namespace detail
+
 /// A `Collation` for `Example<Tensor, Tensor>` types that stacks all data
 /// tensors into one tensor, and all target (label) tensors into one tensor.
 template <>
@@ -26,7 +38,7 @@ struct Stack<Example<>> : public Collation<Example<>> {
       data.push_back(std::move(example.data));
       targets.push_back(std::move(example.target));
     }
-    return {torch::stack(data), torch::stack(targets)};
+    return {detail::collate_stack(data), detail::collate_stack(targets)};
   }
 };
 
@@ -41,7 +53,7 @@ struct Stack<TensorExample>
     for (auto& example : examples) {
       data.push_back(std::move(example.data));
     }
-    return torch::stack(data);
+    return detail::collate_stack(data);
   }
 };
 } // namespace transforms
@@ -64,6 +64,17 @@ class TORCH_API LinearImpl : public Cloneable<LinearImpl> {
   /// optionally adding the `bias`, if `with_bias` is true in the options.
   Tensor forward(const Tensor& input);
 
+  /// Freezes the module for inference. The parameters are snapshotted into
+  /// detached tensors (with the weight transpose materialized once), so
+  /// subsequent `forward` calls skip autograd bookkeeping and the per-call
+  /// view construction in `F::linear`. Intended for serving loops that call
+  /// the same module many times; parameter updates made after `freeze` are
+  /// not observed until `unfreeze` (or another `freeze`) is called.
+  void freeze();
+
+  /// Reverts `freeze`; `forward` goes back to reading the live parameters.
+  void unfreeze();
+
   /// The options used to configure this module.
   LinearOptions options;
 
@@ -73,6 +84,13 @@ class TORCH_API LinearImpl : public Cloneable<LinearImpl> {
   /// The learned bias. If `bias` is false in the `options`, this tensor is
   /// undefined.
   Tensor bias;
+
+ private:
+  /// Set by `freeze`: the detached, transposed weight (and detached bias)
+  /// reused across `forward` calls while frozen.
+  Tensor frozen_weight_t_;
+  Tensor frozen_bias_;
+  bool is_frozen_ = false;
 };
 
 /// A `ModuleHolder` subclass for `LinearImpl`.
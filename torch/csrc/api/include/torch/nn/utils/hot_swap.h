@@ -0,0 +1,114 @@
+#pragma once
+
+#include <torch/types.h>
+
+#include <atomic>
+#include <utility>
+
+namespace torch {
+namespace nn {
+namespace utils {
+
+// Double-buffered in-place weight refresh for serving.
+//
+// An online-learning service that refreshes weights every few seconds
+// otherwise has to pause serving while copy_ overwrites the live tensors.
+// ParameterDoubleBuffer keeps a shadow allocation per parameter: a
+// background thread fills the shadow at leisure (`shadow()`, `publish()`),
+// and the serving thread flips the parameter's StorageImpl data pointer to
+// the ready shadow at an op boundary of its choosing (`commit()`, e.g.
+// between forward passes). The flip is two pointer swaps, so the stall is
+// effectively zero, and because it happens at the storage level every view
+// and alias of the parameter observes the new weights at once. The retired
+// live buffer becomes the next shadow, so steady-state refresh allocates
+// nothing.
+//
+// Threading contract: exactly one writer thread may use shadow()/publish()
+// and exactly one serving thread may call commit(). commit() must only run
+// at an op boundary -- a kernel that is concurrently reading the parameter
+// on another thread may otherwise see the buffer change under it. The
+// writer owns the shadow buffer until publish(); after publish() it must
+// not touch the shadow again until the next shadow() call returns.
+//
+// The flip bumps the parameter's autograd version counter (the same
+// machinery copy_ uses), so saved-for-backward checks still detect the
+// mutation; this facility is intended for inference parameters.
+class ParameterDoubleBuffer {
+ public:
+  explicit ParameterDoubleBuffer(Tensor parameter)
+      : parameter_(std::move(parameter)) {
+    TORCH_CHECK(
+        parameter_.defined(), "ParameterDoubleBuffer: undefined parameter");
+    // Contiguous so the storage flip covers exactly the parameter's bytes.
+    TORCH_CHECK(
+        parameter_.is_contiguous(),
+        "ParameterDoubleBuffer: parameter must be contiguous");
+    shadow_ = torch::empty_like(parameter_);
+  }
+
+  ParameterDoubleBuffer(const ParameterDoubleBuffer&) = delete;
+  ParameterDoubleBuffer& operator=(const ParameterDoubleBuffer&) = delete;
+
+  // Writable tensor over the inactive buffer. Only valid while no publish
+  // is pending; typical use is shadow().copy_(new_weights).
+  Tensor shadow() {
+    TORCH_CHECK(
+        state_.load(std::memory_order_acquire) == State::WriterOwnsShadow,
+        "ParameterDoubleBuffer: shadow() called while a publish is pending; "
+        "wait for the serving thread to commit()");
+    return shadow_;
+  }
+
+  // Hands the filled shadow to the serving thread. The writer must not
+  // touch the shadow buffer again until its next shadow() call.
+  void publish() {
+    TORCH_CHECK(
+        state_.load(std::memory_order_relaxed) == State::WriterOwnsShadow,
+        "ParameterDoubleBuffer: publish() without a writable shadow");
+    state_.store(State::ReadyToCommit, std::memory_order_release);
+  }
+
+  // Called by the serving thread at an op boundary. If a publish is
+  // pending, flips the parameter's storage to the shadow buffer and
+  // retires the old live buffer as the next shadow. Returns true if a
+  // flip happened.
+  bool commit() {
+    if (state_.load(std::memory_order_acquire) != State::ReadyToCommit) {
+      return false;
+    }
+    auto* live = parameter_.storage().unsafeGetStorageImpl();
+    auto* shadow = shadow_.storage().unsafeGetStorageImpl();
+    TORCH_CHECK(
+        live->nbytes() == shadow->nbytes(),
+        "ParameterDoubleBuffer: parameter storage was resized while "
+        "double-buffered");
+    at::DataPtr shadow_data =
+        shadow->set_data_ptr(at::DataPtr(nullptr, shadow->device()));
+    shadow->set_data_ptr_noswap(live->set_data_ptr(std::move(shadow_data)));
+    parameter_.unsafeGetTensorImpl()->bump_version();
+    ++commit_count_;
+    state_.store(State::WriterOwnsShadow, std::memory_order_release);
+    return true;
+  }
+
+  // Number of flips committed so far.
+  uint64_t version() const {
+    return commit_count_;
+  }
+
+  const Tensor& parameter() const {
+    return parameter_;
+  }
+
+ private:
+  enum class State : uint8_t { WriterOwnsShadow, ReadyToCommit };
+
+  Tensor parameter_;
+  Tensor shadow_;
+  std::atomic<State> state_{State::WriterOwnsShadow};
+  uint64_t commit_count_{0};
+};
+
+} // namespace utils
+} // namespace nn
+} // namespace torch
@@ -62,7 +62,32 @@ void LinearImpl::pretty_print(std::ostream& stream) const {
          << ", bias=" << options.bias() << ")";
 }
 
+void LinearImpl::freeze() {
+  // Snapshot detached copies so the frozen forward neither records autograd
+  // history nor rebuilds the weight transpose view on every call.
+  frozen_weight_t_ = weight.detach().t();
+  frozen_bias_ = bias.defined() ? bias.detach() : Tensor();
+  is_frozen_ = true;
+}
+
+void LinearImpl::unfreeze() {
+  frozen_weight_t_ = Tensor();
+  frozen_bias_ = Tensor();
+  is_frozen_ = false;
+}
+
 Tensor LinearImpl::forward(const Tensor& input) {
+  if (is_frozen_) {
+    // Same computation as F::linear, but against the frozen snapshots.
+    if (input.dim() == 2 && frozen_bias_.defined()) {
+      return torch::addmm(frozen_bias_, input, frozen_weight_t_);
+    }
+    auto output = input.matmul(frozen_weight_t_);
+    if (frozen_bias_.defined()) {
+      output += frozen_bias_;
+    }
+    return output;
+  }
   return F::linear(input, weight, bias);
 }
 
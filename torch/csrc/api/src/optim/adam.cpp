@@ -10,6 +10,7 @@
 
 #include <cmath>
 #include <functional>
+#include <unordered_map>
 
 namespace torch {
 namespace optim {
@@ -70,6 +71,58 @@ void AdamParamState::serialize(torch::serialize::InputArchive& archive) {
   _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(Tensor, max_exp_avg_sq);
 }
 
+namespace {
+
+// True when every parameter of the group that has a gradient can be handed
+// to the fused kernel behind `_fused_adam_`: dense strided tensors whose
+// gradients share their layout, all on one device with one floating dtype
+// the fused kernels support. Anything else keeps the per-parameter path.
+bool can_use_fused_kernel(const std::vector<Tensor>& params) {
+  Tensor first;
+  for (const auto& p : params) {
+    if (!p.grad().defined()) {
+      continue;
+    }
+    const auto& grad = p.grad();
+    if (p.layout() != c10::kStrided || !p.is_non_overlapping_and_dense() ||
+        grad.layout() != c10::kStrided || grad.sizes() != p.sizes() ||
+        grad.strides() != p.strides() || grad.scalar_type() != p.scalar_type()) {
+      return false;
+    }
+    const auto dtype = p.scalar_type();
+    if (p.is_cpu()) {
+      if (dtype != torch::kFloat && dtype != torch::kDouble) {
+        return false;
+      }
+    } else if (p.is_cuda()) {
+      if (dtype != torch::kFloat && dtype != torch::kDouble &&
+          dtype != torch::kHalf && dtype != torch::kBFloat16) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+    if (!first.defined()) {
+      first = p;
+    } else if (p.device() != first.device() ||
+               dtype != first.scalar_type()) {
+      return false;
+    }
+  }
+  return first.defined();
+}
+
+// Whether a state buffer is laid out exactly like its parameter, which the
+// fused kernels require. Freshly initialized state always is; deserialized
+// state may not be.
+bool state_tensor_matches(const Tensor& t, const Tensor& p) {
+  return t.defined() && t.layout() == c10::kStrided &&
+      t.scalar_type() == p.scalar_type() && t.device() == p.device() &&
+      t.sizes() == p.sizes() && t.strides() == p.strides();
+}
+
+} // namespace
+
 Tensor Adam::step(LossClosure closure) {
   NoGradGuard no_grad;
   Tensor loss = {};
@@ -78,6 +131,83 @@ Tensor Adam::step(LossClosure closure) {
     loss = closure();
   }
   for (auto& group : param_groups_) {
+    auto& options = static_cast<AdamOptions&>(group.options());
+    bool fused = can_use_fused_kernel(group.params());
+    if (fused) {
+      // Initialize state lazily exactly like the per-parameter path does,
+      // then verify the buffers are usable by the fused kernel.
+      for (auto& p : group.params()) {
+        if (!p.grad().defined()) {
+          continue;
+        }
+        auto param_state =
+            state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
+        if (param_state == state_.end()) {
+          auto state = std::make_unique<AdamParamState>();
+          state->step(0);
+          state->exp_avg(torch::zeros_like(p, MemoryFormat::Preserve));
+          state->exp_avg_sq(torch::zeros_like(p, MemoryFormat::Preserve));
+          if (options.amsgrad()) {
+            state->max_exp_avg_sq(torch::zeros_like(p, MemoryFormat::Preserve));
+          }
+          state_[c10::guts::to_string(p.unsafeGetTensorImpl())] =
+              std::move(state);
+        }
+        auto& state = static_cast<AdamParamState&>(
+            *state_[c10::guts::to_string(p.unsafeGetTensorImpl())]);
+        if (!state_tensor_matches(state.exp_avg(), p) ||
+            !state_tensor_matches(state.exp_avg_sq(), p) ||
+            (options.amsgrad() &&
+             !state_tensor_matches(state.max_exp_avg_sq(), p))) {
+          fused = false;
+          break;
+        }
+      }
+    }
+    if (fused) {
+      std::vector<Tensor> params, grads, exp_avgs, exp_avg_sqs,
+          max_exp_avg_sqs, state_steps;
+      // Typically every parameter shares the step count, so one scalar step
+      // tensor (a device copy for CUDA groups) serves the whole group.
+      std::unordered_map<int64_t, Tensor> step_tensors;
+      for (auto& p : group.params()) {
+        if (!p.grad().defined()) {
+          continue;
+        }
+        auto& state = static_cast<AdamParamState&>(
+            *state_[c10::guts::to_string(p.unsafeGetTensorImpl())]);
+        state.step(state.step() + 1);
+        auto& step_tensor = step_tensors[state.step()];
+        if (!step_tensor.defined()) {
+          step_tensor = torch::scalar_tensor(
+              static_cast<double>(state.step()),
+              p.options().dtype(torch::kFloat));
+        }
+        params.push_back(p);
+        grads.push_back(p.grad());
+        exp_avgs.push_back(state.exp_avg());
+        exp_avg_sqs.push_back(state.exp_avg_sq());
+        if (options.amsgrad()) {
+          max_exp_avg_sqs.push_back(state.max_exp_avg_sq());
+        }
+        state_steps.push_back(step_tensor);
+      }
+      at::_fused_adam_(
+          params,
+          grads,
+          exp_avgs,
+          exp_avg_sqs,
+          max_exp_avg_sqs,
+          state_steps,
+          options.lr(),
+          std::get<0>(options.betas()),
+          std::get<1>(options.betas()),
+          options.weight_decay(),
+          options.eps(),
+          options.amsgrad(),
+          /*maximize=*/false);
+      continue;
+    }
     for (auto& p : group.params()) {
       if (!p.grad().defined()) {
         continue;
@@ -86,7 +216,6 @@ Tensor Adam::step(LossClosure closure) {
       TORCH_CHECK(!grad.is_sparse(), "Adam does not support sparse gradients" /*, please consider SparseAdam instead*/);
       auto param_state =
           state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
-      auto& options = static_cast<AdamOptions&>(group.options());
 
       // State initialization
       if (param_state == state_.end()) {
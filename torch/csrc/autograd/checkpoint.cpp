@@ -0,0 +1,139 @@
+#include <torch/csrc/autograd/checkpoint.h>
+
+#include <torch/csrc/autograd/autograd.h>
+#include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/functions/utils.h>
+
+#include <utility>
+
+namespace torch {
+namespace autograd {
+
+namespace {
+
+struct CheckpointBackward : public Node {
+  CheckpointBackward(recompute_fn fn, const variable_list& inputs)
+      : fn_(std::move(fn)) {
+    // Save the inputs detached from the surrounding graph; gradients flow
+    // past the segment through this node's next_edges instead. Keeping the
+    // original requires_grad flags lets the replayed segment rebuild the
+    // same graph the eager forward would have built.
+    saved_inputs_.reserve(inputs.size());
+    for (const auto& input : inputs) {
+      if (input.defined()) {
+        auto detached = input.detach();
+        detached.set_requires_grad(input.requires_grad());
+        saved_inputs_.push_back(std::move(detached));
+      } else {
+        saved_inputs_.emplace_back();
+      }
+    }
+  }
+
+  variable_list apply(variable_list&& grads) override;
+
+  recompute_fn fn_;
+  variable_list saved_inputs_;
+};
+
+variable_list CheckpointBackward::apply(variable_list&& grads) {
+  // Replay the forward segment with grad recording on. We are running on an
+  // engine worker thread here, so the nested grad() call below is a
+  // reentrant backward; the engine already knows how to handle those (see
+  // Note [Reentrant backwards] in engine.cpp).
+  variable_list outputs;
+  {
+    at::AutoGradMode grad_mode(true);
+    outputs = fn_(saved_inputs_);
+  }
+  TORCH_CHECK(
+      outputs.size() == grads.size(),
+      "checkpoint: function produced ",
+      outputs.size(),
+      " outputs on replay but ",
+      grads.size(),
+      " were recorded in the forward pass");
+
+  variable_list outputs_with_grad;
+  variable_list grad_outputs;
+  for (const auto i : c10::irange(outputs.size())) {
+    if (outputs[i].defined() && outputs[i].requires_grad() &&
+        grads[i].defined()) {
+      outputs_with_grad.push_back(outputs[i]);
+      grad_outputs.push_back(grads[i]);
+    }
+  }
+  TORCH_CHECK(
+      !outputs_with_grad.empty(),
+      "checkpoint: none of the replayed outputs requires grad; the "
+      "checkpointed function must be differentiable w.r.t. its inputs");
+
+  variable_list diff_inputs;
+  for (const auto& input : saved_inputs_) {
+    if (input.defined() && input.requires_grad()) {
+      diff_inputs.push_back(input);
+    }
+  }
+  auto input_grads = grad(
+      outputs_with_grad,
+      diff_inputs,
+      grad_outputs,
+      /*retain_graph=*/false,
+      /*create_graph=*/false,
+      /*allow_unused=*/true);
+
+  // Scatter the computed gradients back to the positions of the original
+  // inputs; non-differentiable inputs get undefined gradients.
+  variable_list results;
+  results.reserve(saved_inputs_.size());
+  size_t grad_idx = 0;
+  for (const auto& input : saved_inputs_) {
+    if (input.defined() && input.requires_grad()) {
+      results.push_back(input_grads[grad_idx++]);
+    } else {
+      results.emplace_back();
+    }
+  }
+  return results;
+}
+
+} // namespace
+
+variable_list checkpoint(recompute_fn function, const variable_list& inputs) {
+  TORCH_CHECK(function, "checkpoint: expected a callable function");
+
+  bool any_requires_grad = false;
+  for (const auto& input : inputs) {
+    if (input.defined() && input.requires_grad()) {
+      any_requires_grad = true;
+      break;
+    }
+  }
+  if (!any_requires_grad || !GradMode::is_enabled()) {
+    return function(inputs);
+  }
+
+  variable_list outputs;
+  {
+    at::NoGradGuard no_grad;
+    outputs = function(inputs);
+  }
+
+  auto node =
+      std::make_shared<CheckpointBackward>(std::move(function), inputs);
+  node->set_next_edges(collect_next_edges(inputs));
+  for (auto& output : outputs) {
+    if (output.defined() && !isDifferentiableType(output.scalar_type())) {
+      // Non-differentiable outputs still occupy a grad slot on the node so
+      // that replayed outputs line up with the recorded ones; they just
+      // never receive a defined gradient.
+      node->add_input_metadata(Node::undefined_input());
+      continue;
+    }
+    set_history(output, node);
+  }
+  return outputs;
+}
+
+} // namespace autograd
+} // namespace torch
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <torch/csrc/autograd/variable.h>
+
+#include <functional>
+
+namespace torch {
+namespace autograd {
+
+/// A forward segment that can be replayed during the backward pass. Takes the
+/// (detached) inputs the segment was originally run with and returns its
+/// outputs; it must be side-effect free and produce fresh tensors (not alias
+/// its inputs).
+using recompute_fn = std::function<variable_list(const variable_list&)>;
+
+/// Activation checkpointing without the Python round-trip.
+///
+/// Runs `function` on `inputs` with grad recording disabled, so none of the
+/// segment's intermediate activations are saved, and attaches a single
+/// CheckpointBackward node to the outputs. When the backward pass first
+/// reaches those outputs the node replays `function` with grad recording
+/// enabled (as a reentrant backward, on the engine's own threads) and
+/// differentiates the recomputed segment to produce the input gradients.
+///
+/// Like the reentrant Python checkpoint, this trades compute for memory and
+/// does not support double backward through the checkpointed segment.
+TORCH_API variable_list
+checkpoint(recompute_fn function, const variable_list& inputs);
+
+} // namespace autograd
+} // namespace torch
@@ -3,6 +3,7 @@
 #include <torch/csrc/autograd/anomaly_mode.h>
 #include <torch/csrc/autograd/autograd.h>
 #include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/functions/accumulate_grad.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/autograd/variable.h>
@@ -17,6 +18,7 @@
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
+#include <ATen/ops/_foreach_add.h>
 #include <ATen/ops/isnan.h>
 #endif
 
@@ -29,6 +31,7 @@
 #include <c10/util/ThreadLocal.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -503,6 +506,9 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
   // local_ready_queue should already been initialized when we get into
   // thread_main
   TORCH_INTERNAL_ASSERT(local_ready_queue != nullptr);
+  // A successor that evaluate_function handed directly to this worker,
+  // bypassing the ready queue. See Note [Local task handoff].
+  c10::optional<NodeTask> handoff_task;
   while (graph_task == nullptr || !graph_task->future_result_->completed()) {
     // local_graph_task represents the graph_task we retrieve from the queue.
     // The outer graph_task represents the overall graph_task we need to execute
@@ -512,7 +518,10 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
       // Scope this block of execution since NodeTask is not needed after this
       // block and can be deallocated (release any references to grad tensors
       // as part of inputs_).
-      NodeTask task = local_ready_queue->pop();
+      NodeTask task = handoff_task.has_value()
+          ? std::move(*handoff_task)
+          : local_ready_queue->pop();
+      handoff_task.reset();
       // This will only work if the worker is running a non backward task
       // TODO Needs to be fixed this to work in all cases
       if (task.isShutdownTask_) {
@@ -551,7 +560,8 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
                 local_graph_task,
                 task.fn_.get(),
                 task.inputs_,
-                local_graph_task->cpu_ready_queue_);
+                local_graph_task->cpu_ready_queue_,
+                &handoff_task);
           }
         } catch (std::exception& e) {
           thread_on_exception(local_graph_task, task.fn_, e);
@@ -583,6 +593,14 @@ auto Engine::thread_main(const std::shared_ptr<GraphTask>& graph_task) -> void {
       }
     }
   }
+  if (handoff_task.has_value()) {
+    // A reentrant graph task shares this queue, so the loop can exit (its
+    // future completed) while the slot holds a task of another graph task.
+    // Return it to the queue; outstanding_tasks_ was already incremented
+    // when the task was stashed.
+    local_ready_queue->push(
+        std::move(*handoff_task), /*incrementOutstandingTasks=*/false);
+  }
 }
 
 // Reentrant call will re-use the graph_task's owner thread ready_queue for
@@ -714,6 +732,14 @@ void GraphTask::exec_post_processing() {
     //     after backward().
     c10::MultiStreamGuard g(caller_current_streams_filtered);
 
+    // See Note [Batched AccumulateGrad]: the leaf streams have been synced
+    // with the caller's current streams above, so the fused adds launched
+    // here can safely consume any deferred grad — and final callbacks below
+    // then observe fully accumulated grads.
+    if (!pending_grad_accumulations_.empty()) {
+      flush_pending_grad_accumulations();
+    }
+
     // Set the ThreadLocalState before calling the function.
     // NB: The ThreadLocalStateGuard doesn't set the grad_mode because GraphTask
     // always saves ThreadLocalState without grad_mode.
@@ -936,11 +962,169 @@ static variable_list call_function(
   return outputs;
 }
 
+// Note [Batched AccumulateGrad]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// For models with many small parameters, a backward pass ends in one tiny
+// `grad += new_grad` per parameter; launching thousands of such micro-ops
+// dominates the cost of gradient accumulation. When an AccumulateGrad node
+// would take the plain in-place accumulation path and nothing can observe
+// the grad before the backward call returns — default execution mode (empty
+// exec_info_, i.e. .backward() without inputs=), no double backward, no
+// node or tensor hooks, grad already allocated with matching
+// device/dtype/sizes — the engine defers the add instead of running the
+// node. The deferred (node, new_grad) pairs are flushed during
+// exec_post_processing: grouped per device and dtype and applied with
+// _foreach_add_, collapsing the per-parameter micro-ops into a handful of
+// fused calls. The flush happens after the leaf stream sync and on the
+// caller's current streams, so every deferred grad is safe to consume where
+// the fused adds are launched, and before final callbacks so those observe
+// fully accumulated grads. Each node's mutex is taken during the flush —
+// the same lock apply() takes — so a concurrent backward over shared leaves
+// cannot race the batched adds. Anything else (first accumulation, sparse
+// or layout-changing cases, hooks, capture) keeps the regular path.
+static bool can_accumulate_grad_inplace(
+    const at::Tensor& grad,
+    const at::Tensor& new_grad) {
+  return grad.defined() && new_grad.defined() &&
+      grad.layout() == c10::kStrided && new_grad.layout() == c10::kStrided &&
+      !grad.is_nested() && !new_grad.is_nested() &&
+      grad.device() == new_grad.device() &&
+      grad.scalar_type() == new_grad.scalar_type() &&
+      grad.sizes().equals(new_grad.sizes()) &&
+      at::inplaceIsVmapCompatible(grad, new_grad);
+}
+
+static bool try_defer_accumulate_grad(
+    const std::shared_ptr<GraphTask>& graph_task,
+    Node* func,
+    InputBuffer& inputs,
+    const c10::optional<c10::Stream>& opt_parent_stream) {
+  if (!graph_task->exec_info_.empty() || GradMode::is_enabled()) {
+    return false;
+  }
+  auto* accumulate = dynamic_cast<AccumulateGrad*>(func);
+  if (accumulate == nullptr) {
+    return false;
+  }
+  if (!accumulate->pre_hooks().empty() || !accumulate->post_hooks().empty() ||
+      !accumulate->tensor_pre_hooks().empty() ||
+      !accumulate->retains_grad_hooks().empty()) {
+    return false;
+  }
+  const auto& variable = accumulate->variable;
+  if (!variable.defined() || variable.grad_fn() || !variable.requires_grad()) {
+    return false;
+  }
+  if (inputs.buffer.size() != 1 || !inputs.buffer[0].defined()) {
+    return false;
+  }
+  if (!can_accumulate_grad_inplace(variable.grad(), inputs.buffer[0])) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(
+        graph_task->pending_grad_accumulations_mutex_);
+    graph_task->pending_grad_accumulations_.emplace_back(
+        std::static_pointer_cast<AccumulateGrad>(func->shared_from_this()),
+        std::move(inputs.buffer[0]));
+  }
+  // Records leaf stream (if applicable), as the regular execution of the
+  // node would. See Note [Streaming backwards]
+  if (opt_parent_stream) {
+    std::lock_guard<std::mutex> lock(graph_task->mutex_);
+    graph_task->leaf_streams.emplace(*opt_parent_stream);
+  }
+  return true;
+}
+
+void GraphTask::flush_pending_grad_accumulations() {
+  // The engine threads that normally perform these adds run with grad mode
+  // off; the flush must not record them either.
+  AutoGradMode grad_mode(false);
+
+  // Lock the nodes in address order so concurrent apply() calls (which hold
+  // at most one node mutex and acquire no others) cannot deadlock with us.
+  auto& pending = pending_grad_accumulations_;
+  std::sort(pending.begin(), pending.end(), [](const auto& a, const auto& b) {
+    return a.first.get() < b.first.get();
+  });
+  std::vector<std::unique_lock<std::mutex>> locks;
+  locks.reserve(pending.size());
+  for (auto& item : pending) {
+    locks.emplace_back(item.first->mutex());
+  }
+
+  struct Bucket {
+    at::Device device;
+    at::ScalarType dtype;
+    std::vector<at::Tensor> grads;
+    std::vector<at::Tensor> new_grads;
+  };
+  std::vector<Bucket> buckets;
+  for (auto& item : pending) {
+    auto& accumulate = *item.first;
+    at::Tensor& grad = accumulate.variable.mutable_grad();
+    at::Tensor& new_grad = item.second;
+    if (!can_accumulate_grad_inplace(grad, new_grad)) {
+      // the grad was replaced between deferral and flush (e.g. by another
+      // backward over the same leaf); fall back to the full accumulation
+      AccumulateGrad::accumulateGrad(
+          accumulate.variable,
+          grad,
+          new_grad,
+          1 /* num_expected_refs */,
+          [&grad](at::Tensor&& grad_update) { grad = std::move(grad_update); });
+      continue;
+    }
+    Bucket* bucket = nullptr;
+    for (auto& candidate : buckets) {
+      if (candidate.device == grad.device() &&
+          candidate.dtype == grad.scalar_type()) {
+        bucket = &candidate;
+        break;
+      }
+    }
+    if (bucket == nullptr) {
+      buckets.push_back(Bucket{grad.device(), grad.scalar_type(), {}, {}});
+      bucket = &buckets.back();
+    }
+    bucket->grads.push_back(grad);
+    bucket->new_grads.push_back(new_grad);
+  }
+  for (auto& bucket : buckets) {
+    at::OptionalDeviceGuard guard(bucket.device);
+    at::_foreach_add_(bucket.grads, bucket.new_grads);
+  }
+  pending.clear();
+}
+
+// Note [Local task handoff]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// Most autograd graphs are chain-shaped: evaluating a node typically makes
+// exactly one successor ready, on the same device as the node itself. In the
+// queue-only scheme that successor is pushed onto the very ReadyQueue the
+// worker is about to pop from, paying a mutex acquisition and a condition
+// variable notify on push and another mutex acquisition on pop — per node.
+// With several device threads feeding each other (multi-GPU or streaming
+// backward) those queue mutexes become contended.
+//
+// Instead, thread_main passes evaluate_function a single-slot buffer: the
+// first successor that becomes ready on the calling worker's own queue is
+// stashed in the slot and executed next, with no queue round trip. Any
+// further ready successors take the normal queue path, so other workers can
+// still pick them up and no parallelism is lost. The stashed task still
+// increments outstanding_tasks_, keeping the completion accounting identical
+// to a push. As a bonus, a CUDA node's successor keeps running on the thread
+// that is already guarded onto the producing stream.
+//
+// The slot lives on thread_main's stack, so a reentrant backward nested
+// inside call_function gets its own slot and cannot interleave with ours.
 void Engine::evaluate_function(
     std::shared_ptr<GraphTask>& graph_task,
     Node* func,
     InputBuffer& inputs,
-    const std::shared_ptr<ReadyQueue>& cpu_ready_queue) {
+    const std::shared_ptr<ReadyQueue>& cpu_ready_queue,
+    c10::optional<NodeTask>* local_handoff) {
   // The InputBuffer::adds that supplied incoming grads took pains to
   // ensure they're safe to consume in the context of the present
   // func's stream (if applicable). So we guard onto that stream
@@ -948,6 +1132,11 @@ void Engine::evaluate_function(
   const auto opt_parent_stream = (*func).stream(c10::DeviceType::CUDA);
   c10::OptionalStreamGuard parent_stream_guard{opt_parent_stream};
 
+  // See Note [Batched AccumulateGrad]
+  if (try_defer_accumulate_grad(graph_task, func, inputs, opt_parent_stream)) {
+    return;
+  }
+
   // If exec_info_ is not empty, we have to instrument the execution
   auto& exec_info_ = graph_task->exec_info_;
   if (!exec_info_.empty()) {
@@ -1061,8 +1250,16 @@ void Engine::evaluate_function(
 
       if (is_ready) {
         auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
-        queue->push(
-            NodeTask(graph_task, next.function, std::move(input_buffer)));
+        if (local_handoff && !local_handoff->has_value() &&
+            queue == local_ready_queue) {
+          // See Note [Local task handoff]
+          ++graph_task->outstanding_tasks_;
+          local_handoff->emplace(
+              graph_task, next.function, std::move(input_buffer));
+        } else {
+          queue->push(
+              NodeTask(graph_task, next.function, std::move(input_buffer)));
+        }
       } else {
         not_ready.emplace(next.function.get(), std::move(input_buffer));
       }
@@ -1076,8 +1273,16 @@ void Engine::evaluate_function(
           next.input_nr, std::move(output), opt_parent_stream, opt_next_stream);
       if (is_ready) {
         auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
-        queue->push(
-            NodeTask(graph_task, next.function, std::move(input_buffer)));
+        if (local_handoff && !local_handoff->has_value() &&
+            queue == local_ready_queue) {
+          // See Note [Local task handoff]
+          ++graph_task->outstanding_tasks_;
+          local_handoff->emplace(
+              graph_task, next.function, std::move(input_buffer));
+        } else {
+          queue->push(
+              NodeTask(graph_task, next.function, std::move(input_buffer)));
+        }
         not_ready.erase(not_ready_it);
       }
     }
@@ -1097,6 +1302,177 @@ inline static uint64_t compute_min_topological_nr(const edge_list& outputs) {
   return min_topo_nr;
 }
 
+// Note [Backward plan cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every Engine::execute call walks the whole graph twice before running a
+// single node: compute_dependencies counts in-edges and init_to_execute
+// marks the nodes on a path to the requested outputs. For workloads that
+// call backward repeatedly on the same graph — retain_graph training loops,
+// repeated autograd.grad over one forward, checkpointing inner loops — that
+// setup is identical every time and can dominate short backward passes.
+//
+// When enabled (set_backward_plan_cache_enabled, off by default), the
+// engine caches the dependency counts, the set of nodes in the graph and
+// the exec_info skeleton, keyed by the root nodes, the output edges and the
+// accumulate_grad flag. Entries hold weak references; a hit requires every
+// stored weak_ptr to lock to the exact node it was created from, which both
+// keeps the cache from extending graph lifetime and guards against node
+// pointers recycled by the allocator. Fresh graphs (the usual per-step
+// rebuild) simply miss and are computed and cached as before; graph
+// structure is immutable after construction, so a validated hit cannot go
+// stale. The dummy GraphRoot created for multi-root calls is ephemeral, so
+// its exec_info entry is stored positionally and re-attached to the new
+// root on a hit. Capture hooks are deliberately not cached — they are
+// registered on the per-call exec_info after this stage.
+static std::atomic<bool> backward_plan_cache_enabled{false};
+
+bool is_backward_plan_cache_enabled() {
+  return backward_plan_cache_enabled.load(std::memory_order_relaxed);
+}
+
+void set_backward_plan_cache_enabled(bool enabled) {
+  backward_plan_cache_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+// Bound the cache so pathological workloads (e.g. a new retained graph per
+// step) cannot grow it without limit.
+static constexpr size_t kMaxCachedBackwardPlans = 16;
+
+uint64_t Engine::execution_plan_key(
+    const edge_list& roots,
+    const edge_list& outputs,
+    bool accumulate_grad) {
+  uint64_t key = accumulate_grad ? 1 : 0;
+  const auto mix = [&key](uint64_t value) {
+    // 64-bit variant of boost::hash_combine
+    key ^= value + 0x9e3779b97f4a7c15ull + (key << 6) + (key >> 2);
+  };
+  for (const auto& edge : roots) {
+    mix(reinterpret_cast<uintptr_t>(edge.function.get()));
+    mix(edge.input_nr);
+  }
+  mix(0xffffffffull); // separates the two lists
+  for (const auto& edge : outputs) {
+    mix(reinterpret_cast<uintptr_t>(edge.function.get()));
+    mix(edge.input_nr);
+  }
+  return key;
+}
+
+bool Engine::try_apply_cached_plan(
+    const edge_list& roots,
+    const edge_list& outputs,
+    bool accumulate_grad,
+    GraphTask& task,
+    Node* graph_root) {
+  std::lock_guard<std::mutex> lock(plan_cache_mutex_);
+  auto it = plan_cache_.find(execution_plan_key(roots, outputs, accumulate_grad));
+  if (it == plan_cache_.end()) {
+    return false;
+  }
+  // Validate the hash hit: every stored weak_ptr must still lock to the node
+  // it was created from; anything else is an expired graph or a recycled
+  // pointer.
+  const auto& plan = it->second;
+  if (plan.accumulate_grad != accumulate_grad ||
+      plan.root_fns.size() != roots.size() ||
+      plan.output_fns.size() != outputs.size()) {
+    return false;
+  }
+  for (const auto i : c10::irange(roots.size())) {
+    if (plan.root_fns[i].lock().get() != roots[i].function.get()) {
+      return false;
+    }
+  }
+  for (const auto i : c10::irange(outputs.size())) {
+    if (plan.output_fns[i].lock().get() != outputs[i].function.get() ||
+        plan.output_input_nrs[i] != outputs[i].input_nr) {
+      return false;
+    }
+  }
+  task.dependencies_ = plan.dependencies;
+  task.nodes_in_graph_ = plan.nodes_in_graph;
+  if (plan.has_exec_info) {
+    auto& exec_info = task.exec_info_;
+    for (const auto& entry : plan.exec_info) {
+      auto& info = exec_info[entry.first];
+      info.needed_ = entry.second.needed;
+      if (!entry.second.captures.empty()) {
+        info.captures_ =
+            std::make_unique<std::vector<GraphTask::ExecInfo::Capture>>();
+        for (const auto& capture : entry.second.captures) {
+          info.captures_->emplace_back(capture.first, capture.second);
+        }
+      }
+    }
+    exec_info[graph_root].needed_ |= plan.root_needed;
+    task.captured_vars_.resize(plan.num_captures);
+  }
+  if (plan.will_use_cuda) {
+    // See Note [Streaming backwards]
+    task.stash_current_streams();
+  }
+  return true;
+}
+
+void Engine::cache_execution_plan(
+    const edge_list& roots,
+    const edge_list& outputs,
+    bool accumulate_grad,
+    GraphTask& task,
+    Node* graph_root) {
+  ExecutionPlan plan;
+  plan.accumulate_grad = accumulate_grad;
+  plan.root_fns.reserve(roots.size());
+  for (const auto& edge : roots) {
+    plan.root_fns.emplace_back(edge.function);
+  }
+  plan.output_fns.reserve(outputs.size());
+  plan.output_input_nrs.reserve(outputs.size());
+  for (const auto& edge : outputs) {
+    plan.output_fns.emplace_back(edge.function);
+    plan.output_input_nrs.push_back(edge.input_nr);
+  }
+  plan.dependencies = task.dependencies_;
+  plan.nodes_in_graph = task.nodes_in_graph_;
+  plan.has_exec_info = !task.exec_info_.empty();
+  for (const auto& entry : task.exec_info_) {
+    ExecutionPlan::NodeExecInfo info;
+    info.needed = entry.second.needed_;
+    if (entry.second.captures_) {
+      for (const auto& capture : *entry.second.captures_) {
+        info.captures.emplace_back(capture.input_idx_, capture.output_idx_);
+      }
+    }
+    if (entry.first == graph_root && roots.size() > 1) {
+      // the dummy GraphRoot of a multi-root call does not outlive the call;
+      // remember its entry positionally instead of by pointer. (A single
+      // root is its own graph root and is cached by pointer like any other
+      // node, captures included.)
+      plan.root_needed = info.needed;
+      continue;
+    }
+    plan.exec_info.emplace(entry.first, std::move(info));
+  }
+  plan.num_captures = static_cast<int>(task.captured_vars_.size());
+  // stash_current_streams() only ran if the graph can use CUDA
+  plan.will_use_cuda = !task.caller_current_streams_.empty();
+
+  std::lock_guard<std::mutex> lock(plan_cache_mutex_);
+  if (plan_cache_.size() >= kMaxCachedBackwardPlans) {
+    for (auto it = plan_cache_.begin(); it != plan_cache_.end();) {
+      const bool expired = !it->second.root_fns.empty() &&
+          it->second.root_fns.front().expired();
+      it = expired ? plan_cache_.erase(it) : std::next(it);
+    }
+    if (plan_cache_.size() >= kMaxCachedBackwardPlans) {
+      plan_cache_.clear();
+    }
+  }
+  plan_cache_[execution_plan_key(roots, outputs, accumulate_grad)] =
+      std::move(plan);
+}
+
 auto Engine::compute_dependencies(
     Node* root,
     GraphTask& task,
@@ -1190,12 +1566,22 @@ auto Engine::execute(
       : std::make_shared<GraphRoot>(root_edges, inputs);
 
   auto min_topo_nr = compute_min_topological_nr(outputs);
-  // Now compute the dependencies for all executable functions
-  compute_dependencies(graph_root.get(), *graph_task, min_topo_nr);
-
-  if (!outputs.empty()) {
-    graph_task->init_to_execute(
-        *graph_root, outputs, accumulate_grad, min_topo_nr);
+  // Now compute the dependencies for all executable functions, unless a
+  // cached plan for this graph applies. See Note [Backward plan cache].
+  const bool plan_cache_enabled = is_backward_plan_cache_enabled();
+  if (!plan_cache_enabled ||
+      !try_apply_cached_plan(
+          root_edges, outputs, accumulate_grad, *graph_task, graph_root.get())) {
+    compute_dependencies(graph_root.get(), *graph_task, min_topo_nr);
+
+    if (!outputs.empty()) {
+      graph_task->init_to_execute(
+          *graph_root, outputs, accumulate_grad, min_topo_nr);
+    }
+    if (plan_cache_enabled) {
+      cache_execution_plan(
+          root_edges, outputs, accumulate_grad, *graph_task, graph_root.get());
+    }
   }
 
   // Queue the root
@@ -16,6 +16,7 @@
 #include <torch/csrc/autograd/utils/warnings.h>
 
 #include <c10/util/CallOnce.h>
+#include <c10/util/Optional.h>
 
 #include <deque>
 #include <exception>
@@ -24,6 +25,7 @@
 #include <queue>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -50,6 +52,10 @@ void validate_outputs(
     variable_list& grads,
     const std::function<std::string(const std::string&)>& format_error);
 
+// See Note [Backward plan cache] in engine.cpp. Off by default.
+TORCH_API bool is_backward_plan_cache_enabled();
+TORCH_API void set_backward_plan_cache_enabled(bool enabled);
+
 struct NodeTask {
   std::weak_ptr<GraphTask> base_;
   std::shared_ptr<Node> fn_;
@@ -168,12 +174,16 @@ struct TORCH_API Engine {
   }
 
   // We pass cpu_ready_queue to evaluate_function, so that it knows
-  // the correct ready queue to push to after a NodeTask is ready
+  // the correct ready queue to push to after a NodeTask is ready.
+  // When local_handoff is non-null, one successor that became ready on the
+  // calling worker's own queue may be stashed there instead of being pushed;
+  // see Note [Local task handoff] in engine.cpp.
   void evaluate_function(
       std::shared_ptr<GraphTask>& graph_task,
       Node* func,
       InputBuffer& inputs,
-      const std::shared_ptr<ReadyQueue>& cpu_ready_queue);
+      const std::shared_ptr<ReadyQueue>& cpu_ready_queue,
+      c10::optional<NodeTask>* local_handoff = nullptr);
 
   void initialize_device_threads_pool();
   virtual void thread_on_exception(
@@ -201,6 +211,53 @@ struct TORCH_API Engine {
   Engine();
   void compute_dependencies(Node* root, GraphTask& task, uint64_t min_topo_nr);
 
+  // A cached backward execution plan; see Note [Backward plan cache] in
+  // engine.cpp. Holds only weak references to the graph so caching never
+  // extends its lifetime.
+  struct ExecutionPlan {
+    // the identity of the graph the plan was computed for, used to validate
+    // a hash hit and to detect node pointers recycled by the allocator
+    std::vector<std::weak_ptr<Node>> root_fns;
+    std::vector<std::weak_ptr<Node>> output_fns;
+    std::vector<uint32_t> output_input_nrs;
+    bool accumulate_grad{false};
+    // the cached metadata itself
+    std::unordered_map<Node*, int> dependencies;
+    std::unordered_set<Node*> nodes_in_graph;
+    struct NodeExecInfo {
+      bool needed{false};
+      // (input_idx, output_idx) pairs, mirroring ExecInfo::Capture
+      std::vector<std::pair<int, int>> captures;
+    };
+    bool has_exec_info{false};
+    bool root_needed{false};
+    std::unordered_map<Node*, NodeExecInfo> exec_info;
+    int num_captures{0};
+    bool will_use_cuda{false};
+  };
+  static uint64_t execution_plan_key(
+      const edge_list& roots,
+      const edge_list& outputs,
+      bool accumulate_grad);
+  bool try_apply_cached_plan(
+      const edge_list& roots,
+      const edge_list& outputs,
+      bool accumulate_grad,
+      GraphTask& task,
+      Node* graph_root);
+  void cache_execution_plan(
+      const edge_list& roots,
+      const edge_list& outputs,
+      bool accumulate_grad,
+      GraphTask& task,
+      Node* graph_root);
+
+  // Protects plan_cache_
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::mutex plan_cache_mutex_;
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::unordered_map<uint64_t, ExecutionPlan> plan_cache_;
+
   // initialize the thread local ready queue with the ready queue that is
   // created elsewhere (i.e. thread_init, Engine::execute, etc), or create a new
   // ready queue if ready_queue is not provided.
@@ -1,5 +1,7 @@
 #include <torch/csrc/autograd/forward_grad.h>
 
+#include <atomic>
+
 namespace torch {
 namespace autograd {
 
@@ -9,6 +11,15 @@ namespace {
 
 std::mutex all_forward_levels_mutex_;
 std::vector<std::shared_ptr<ForwardADLevel>> all_forward_levels_;
+// Mirrors all_forward_levels_.size() so that lookups can bail out without
+// taking the mutex while no levels exist, which is the overwhelmingly common
+// state: outside of a dual_level context every ForwardGrad::clear and every
+// fw-grad query would otherwise serialize on the global lock.
+std::atomic<size_t> num_forward_levels_{0};
+// A level object retired by release_idx with no outstanding references; the
+// next get_next_idx reuses it (including its grads_ hash table buckets)
+// instead of allocating a fresh one. Guarded by all_forward_levels_mutex_.
+std::shared_ptr<ForwardADLevel> recycled_forward_level_;
 
 const static at::Tensor singleton_undefined_tensor;
 } // namespace
@@ -18,7 +29,14 @@ uint64_t ForwardADLevel::get_next_idx() {
   auto next_idx = all_forward_levels_.size();
   TORCH_CHECK(
       next_idx == 0, "Nested forward mode AD is not supported at the moment");
-  all_forward_levels_.push_back(std::make_shared<ForwardADLevel>(next_idx));
+  if (recycled_forward_level_) {
+    recycled_forward_level_->idx_ = next_idx;
+    all_forward_levels_.push_back(std::move(recycled_forward_level_));
+  } else {
+    all_forward_levels_.push_back(std::make_shared<ForwardADLevel>(next_idx));
+  }
+  num_forward_levels_.store(
+      all_forward_levels_.size(), std::memory_order_release);
   return next_idx;
 }
 
@@ -33,6 +51,15 @@ void ForwardADLevel::release_idx(uint64_t idx) {
   // Keep the level alive until we have released the lock
   auto lvl = all_forward_levels_.back();
   all_forward_levels_.pop_back();
+  num_forward_levels_.store(
+      all_forward_levels_.size(), std::memory_order_release);
+  if (lvl.use_count() == 1) {
+    // We hold the only reference: clear the tangents now and keep the object
+    // for the next level instead of destroying it.
+    lvl->reset_grads();
+    recycled_forward_level_ = std::move(lvl);
+    return;
+  }
   lock.unlock();
 }
 
@@ -46,6 +73,13 @@ std::shared_ptr<ForwardADLevel> ForwardADLevel::get_by_idx(uint64_t idx) {
 }
 
 std::shared_ptr<ForwardADLevel> ForwardADLevel::try_get_by_idx(uint64_t idx) {
+  if (idx >= num_forward_levels_.load(std::memory_order_acquire)) {
+    // No such level right now; levels are never created behind our back
+    // between this check and the caller acting on the nullptr, because the
+    // caller would have an owning reference if it expected the level to
+    // stay alive.
+    return nullptr;
+  }
   std::lock_guard<std::mutex> lock(all_forward_levels_mutex_);
   if (idx < all_forward_levels_.size()) {
     return all_forward_levels_[idx];
@@ -54,7 +88,7 @@ std::shared_ptr<ForwardADLevel> ForwardADLevel::try_get_by_idx(uint64_t idx) {
   }
 }
 
-ForwardADLevel::~ForwardADLevel() {
+void ForwardADLevel::reset_grads() {
   std::lock_guard<std::mutex> lock(mutex_);
   auto it = grads_.begin();
   while (it != grads_.end()) {
@@ -66,10 +100,14 @@ ForwardADLevel::~ForwardADLevel() {
   }
 }
 
+ForwardADLevel::~ForwardADLevel() {
+  reset_grads();
+}
+
 const at::Tensor& ForwardGrad::value(uint64_t level) const {
   std::lock_guard<std::mutex> lock(mutex_);
-  const auto& it = content_.find(level);
-  return it == content_.end() ? singleton_undefined_tensor : (*it).second;
+  const auto it = find_level(level);
+  return it == content_.end() ? singleton_undefined_tensor : it->second;
 }
 
 const at::Tensor& ForwardGrad::undef_grad() {
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <ATen/core/Tensor.h>
+#include <c10/util/SmallVector.h>
+
+#include <algorithm>
 
 namespace torch {
 namespace autograd {
@@ -119,6 +122,11 @@ struct TORCH_API ForwardADLevel {
   }
 
  private:
+  // Clears all the tangents registered with this level. Used by the
+  // destructor and by release_idx when the level object is recycled instead
+  // of destroyed (see the comment in forward_grad.cpp).
+  void reset_grads();
+
   std::unordered_set<std::shared_ptr<ForwardGrad>> grads_;
   std::mutex mutex_;
   uint64_t idx_;
@@ -141,7 +149,7 @@ struct TORCH_API ForwardGrad : std::enable_shared_from_this<ForwardGrad> {
 
     {
       std::lock_guard<std::mutex> lock(mutex_);
-      for (auto& c : content_) {
+      for (const auto& c : content_) {
         levels_idx.push_back(c.first);
       }
     }
@@ -165,7 +173,9 @@ struct TORCH_API ForwardGrad : std::enable_shared_from_this<ForwardGrad> {
     forward_level->insert(shared_from_this());
 
     std::lock_guard<std::mutex> lock(mutex_);
-    content_.insert({level, value});
+    if (find_level(level) == content_.end()) {
+      content_.emplace_back(level, value);
+    }
   }
 
   // This function removes the tangent for a given level from this ForwardGrad
@@ -177,14 +187,14 @@ struct TORCH_API ForwardGrad : std::enable_shared_from_this<ForwardGrad> {
     }
 
     std::unique_lock<std::mutex> lock(mutex_);
-    const auto& it = content_.find(level);
+    auto it = find_level(level);
     TORCH_INTERNAL_ASSERT(
         it != content_.end(), "Resetting a non-existent level.");
     // Keep the Tensor alive until we have released the lock
     // This is needed as we can be in a case where this function is called by
     // ForwardADLevel destructor
-    auto t = (*it).second;
-    content_.erase(level);
+    auto t = std::move(it->second);
+    content_.erase(it);
     lock.unlock();
   }
 
@@ -192,7 +202,7 @@ struct TORCH_API ForwardGrad : std::enable_shared_from_this<ForwardGrad> {
 
   bool contains(uint64_t level) {
     std::lock_guard<std::mutex> lock(mutex_);
-    return content_.count(level) > 0;
+    return find_level(level) != content_.end();
   }
 
   bool empty() const {
@@ -202,8 +212,26 @@ struct TORCH_API ForwardGrad : std::enable_shared_from_this<ForwardGrad> {
   static const at::Tensor& undef_grad();
 
  private:
-  // TODO(albanD): replace this with a SmallVector
-  std::unordered_map<uint64_t, at::Tensor> content_;
+  // Tangents per level. A SmallVector with inline storage for the expected
+  // number of levels: virtually all ForwardGrads hold a single tangent, so
+  // both construction and lookup stay allocation-free, unlike the
+  // unordered_map this used to be.
+  using Content =
+      c10::SmallVector<std::pair<uint64_t, at::Tensor>, EXPECTED_MAX_LEVEL>;
+
+  Content::iterator find_level(uint64_t level) {
+    return std::find_if(content_.begin(), content_.end(), [level](auto& c) {
+      return c.first == level;
+    });
+  }
+  Content::const_iterator find_level(uint64_t level) const {
+    return std::find_if(
+        content_.begin(), content_.end(), [level](const auto& c) {
+          return c.first == level;
+        });
+  }
+
+  Content content_;
   mutable std::mutex mutex_;
 };
 
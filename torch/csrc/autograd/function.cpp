@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -36,6 +37,76 @@ std::shared_ptr<Node> get_current_node() {
   return current_evaluating_node;
 }
 
+// Note [Node allocation pool]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every forward op in training allocates a Node subclass (with its
+// SavedVariables and edge list stored inline), and the whole graph is freed
+// again when the last reference to the loss dies, so a training loop hammers
+// malloc/free with the same handful of allocation sizes — one per backward op
+// — every step. Since nodes are individually owned by shared_ptrs and die
+// piecemeal (a true per-graph arena released wholesale would be unsound),
+// the storage is instead recycled through size-bucketed free lists: a freed
+// block goes back to the bucket for its size class and the next node of a
+// similar size reuses it, so the steady state of a training loop performs no
+// heap traffic for node construction at all.
+//
+// Nodes are allocated on forward threads and freed on engine threads, so the
+// buckets are global, each guarded by its own mutex; both operations are a
+// vector push/pop, so the critical sections are tiny. Blocks larger than the
+// biggest size class (rare: ops capturing many tensors) and overflow beyond
+// the per-bucket cap fall through to the regular heap.
+namespace {
+
+// one cache line; also the size-class granularity
+constexpr size_t kNodeBlockGranularity = 64;
+// covers node sizes up to 2 KiB
+constexpr size_t kNodeSizeClasses = 32;
+// at most 4 MiB of pooled storage per size class
+constexpr size_t kMaxFreeBlocksPerClass = 1024;
+
+struct NodeSizeClass {
+  std::mutex mutex;
+  std::vector<void*> free_blocks;
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+NodeSizeClass node_size_classes[kNodeSizeClasses];
+
+inline size_t node_size_class_index(size_t size) {
+  return (size + kNodeBlockGranularity - 1) / kNodeBlockGranularity - 1;
+}
+
+} // namespace
+
+void* Node::operator new(std::size_t size) {
+  const auto index = node_size_class_index(size);
+  if (index < kNodeSizeClasses) {
+    auto& size_class = node_size_classes[index];
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    if (!size_class.free_blocks.empty()) {
+      void* ptr = size_class.free_blocks.back();
+      size_class.free_blocks.pop_back();
+      return ptr;
+    }
+  }
+  // Allocate the rounded-up class size so the block is reusable by any node
+  // in the same class when it comes back.
+  return ::operator new((index + 1) * kNodeBlockGranularity);
+}
+
+void Node::operator delete(void* ptr, std::size_t size) {
+  const auto index = node_size_class_index(size);
+  if (index < kNodeSizeClasses) {
+    auto& size_class = node_size_classes[index];
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    if (size_class.free_blocks.size() < kMaxFreeBlocksPerClass) {
+      size_class.free_blocks.push_back(ptr);
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
 void Node::assign_parent() {
   metadata()->assign_parent(current_evaluating_node);
 }
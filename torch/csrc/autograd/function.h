@@ -146,6 +146,14 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
   Node& operator=(Node&& other) = delete;
   virtual ~Node() = default;
 
+  // Node storage is recycled between graphs through a size-bucketed pool
+  // instead of going to the heap; see Note [Node allocation pool] in
+  // function.cpp. All subclasses (including the generated backward nodes,
+  // which are created with plain `new`) inherit these operators. The sized
+  // delete receives the dynamic type's size because ~Node is virtual.
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size);
+
   std::shared_ptr<Node> getptr() {
     return shared_from_this();
   }
@@ -49,6 +49,13 @@ struct TORCH_API AccumulateGrad : public Node {
     //     to all other Nodes). So we must lazily read the Tensor hooks here.
     return impl::hooks(variable);
   }
+
+  // Exposes the Node mutex to the engine's batched accumulation stage (see
+  // Note [Batched AccumulateGrad] in engine.cpp), which takes the same lock
+  // apply() takes before touching variable's grad.
+  std::mutex& mutex() noexcept {
+    return mutex_;
+  }
   // Given a variable with its current grad as variable_grad, accumulates
   // new_grad into variable_grad if in place accumulation is possible.
   // Otherwise, uses 'update_grad' to update the grad for the variable.
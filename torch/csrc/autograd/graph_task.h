@@ -10,6 +10,7 @@ namespace torch {
 namespace autograd {
 
 using edge_list = std::vector<Edge>;
+struct AccumulateGrad;
 struct ReadyQueue;
 
 static constexpr int NO_DEVICE = -2;
@@ -183,6 +184,16 @@ struct GraphTask : std::enable_shared_from_this<GraphTask> {
   // tasks are done.
   c10::intrusive_ptr<at::ivalue::Future> future_result_;
 
+  // Leaf gradient accumulations deferred by evaluate_function so they can be
+  // applied in batches; see Note [Batched AccumulateGrad] in engine.cpp.
+  // Each entry pairs the AccumulateGrad node (kept alive so its mutex can be
+  // taken during the flush) with the incoming gradient.
+  std::vector<std::pair<std::shared_ptr<AccumulateGrad>, at::Tensor>>
+      pending_grad_accumulations_;
+  // Protects pending_grad_accumulations_. Intentionally not reusing mutex_;
+  // deferrals happen on the hot path of every worker thread.
+  std::mutex pending_grad_accumulations_mutex_;
+
   // Final callbacks installed during execution of this GraphTask
   std::vector<std::function<void()>> final_callbacks_;
   // To protect reads and writes to final_callbacks_. Intentionally no reusing
@@ -215,6 +226,9 @@ struct GraphTask : std::enable_shared_from_this<GraphTask> {
  private:
   // run GraphTask post processing
   void exec_post_processing();
+  // apply pending_grad_accumulations_ with _foreach_add_, grouped per
+  // device and dtype; see Note [Batched AccumulateGrad] in engine.cpp
+  void flush_pending_grad_accumulations();
 };
 
 // The guard that sets and restores current_graph_task.
@@ -11,6 +11,7 @@
 #include <c10/core/impl/PythonDispatcherTLS.h>
 #include <torch/csrc/Exceptions.h>
 #include <torch/csrc/autograd/autograd.h>
+#include <torch/csrc/autograd/engine.h>
 #include <torch/csrc/autograd/function.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/autograd/profiler.h>
@@ -346,6 +347,23 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject* unused) {
   m.def("_pop_saved_tensors_default_hooks", []() {
     torch::autograd::PyDefaultSavedVariableHooks::pop_hooks();
   });
+  // See Note [CPU offload of saved tensors] in saved_variable.cpp
+  m.def("_set_saved_tensors_cpu_offload_enabled", [](bool enabled) {
+    torch::autograd::set_saved_tensors_cpu_offload_enabled(enabled);
+  });
+  m.def("_is_saved_tensors_cpu_offload_enabled", []() {
+    return torch::autograd::is_saved_tensors_cpu_offload_enabled();
+  });
+  m.def("_set_saved_tensors_cpu_offload_min_bytes", [](size_t min_bytes) {
+    torch::autograd::set_saved_tensors_cpu_offload_min_bytes(min_bytes);
+  });
+  // See Note [Backward plan cache] in engine.cpp
+  m.def("_set_backward_plan_cache_enabled", [](bool enabled) {
+    torch::autograd::set_backward_plan_cache_enabled(enabled);
+  });
+  m.def("_is_backward_plan_cache_enabled", []() {
+    return torch::autograd::is_backward_plan_cache_enabled();
+  });
 
   _C_m.def(
       "_register_py_class_for_device",
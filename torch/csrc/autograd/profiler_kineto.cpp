@@ -476,7 +476,11 @@ void onFunctionExit(
   const auto& config = state_ptr->config();
   auto* kineto_ctx_ptr =
       static_cast<torch::profiler::impl::KinetoObserverContext*>(ctx_ptr);
-  TORCH_INTERNAL_ASSERT(kineto_ctx_ptr != nullptr);
+  if (kineto_ctx_ptr == nullptr) {
+    // The enter callback skipped this op (profiler_sample_rate /
+    // profiler_event_budget); no correlation id was pushed either.
+    return;
+  }
   kineto_ctx_ptr->event_->end_time_ =
       torch::profiler::impl::getApproximateTime();
   if (!config.experimental_config.performance_events.empty()) {
@@ -489,10 +493,10 @@ void onFunctionExit(
     try {
       auto fallback = kineto_ctx_ptr->fallback_;
       TORCH_INTERNAL_ASSERT(fallback != nullptr);
-      torch::profiler::impl::cudaStubs()->record(
+      torch::profiler::impl::gpuFallbackStubs()->record(
           nullptr, &fallback->cuda_event_end_, nullptr);
     } catch (const std::exception& e) {
-      LOG(WARNING) << "Failed to record CUDA event. " << e.what();
+      LOG(WARNING) << "Failed to record GPU event. " << e.what();
     }
   }
 
@@ -797,10 +801,10 @@ int64_t KinetoEvent::cudaElapsedUs() const {
     return -1;
   }
   try {
-    return (int64_t)torch::profiler::impl::cudaStubs()->elapsed(
+    return (int64_t)torch::profiler::impl::gpuFallbackStubs()->elapsed(
         &cuda_event_start, &cuda_event_end);
   } catch (std::exception& e) {
-    LOG(WARNING) << "Failed to measure time between two CUDA events. "
+    LOG(WARNING) << "Failed to measure time between two GPU events. "
                  << e.what();
   }
   return -1;
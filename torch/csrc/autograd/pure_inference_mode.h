@@ -0,0 +1,71 @@
+#pragma once
+
+#include <c10/core/AutogradState.h>
+#include <c10/core/GradMode.h>
+#include <torch/csrc/Export.h>
+
+namespace torch {
+namespace autograd {
+
+// Note [Pure inference fast path]
+//
+// InferenceMode already bypasses the autograd layers at dispatch time: it
+// excludes the Autograd keys from the thread-local dispatch key set, so the
+// generated VariableType wrappers are never entered (see Note [Expected TLS
+// state in InferenceMode] in c10/core/InferenceMode.h). But InferenceMode
+// comes with inference-tensor semantics: tensors created inside it cannot
+// later participate in autograd, and in-place ops on *normal* tensors still
+// route through the ADInplaceOrView kernel for view/version bookkeeping.
+//
+// Plain no-grad mode (NoGradGuard) has no such restrictions, but pays for
+// them: every call still traverses the full generated VariableType wrapper
+// (argument unpacking, compute_requires_grad, debug sanity checks) plus a
+// second dispatcher hop through ADInplaceOrView for in-place and view ops,
+// even though no graph is ever built.
+//
+// PureInferenceMode is a thread-local opt-in for serving-style workloads that
+// want no-grad semantics at InferenceMode cost. While the guard is active,
+// each generated VariableType wrapper takes a single-branch fast path that
+// redispatches straight to the backend kernel with both the autograd and
+// ADInplaceOrView bits masked out (ks & c10::after_ADInplaceOrView_keyset).
+// Unlike InferenceMode, the outputs are ordinary tensors and remain fully
+// usable once the guard is gone.
+//
+// The caller promises that, within the guarded region:
+//   - no input tensor requires grad or carries a forward grad, and
+//   - no tensor mutated in place is saved for backward by autograd nodes
+//     created outside the region (version counters are not bumped here, so
+//     saved-tensor checks cannot catch such mutations).
+// Code that cannot uphold this contract should use NoGradGuard instead.
+//
+// Operators with hand-written wrappers in VariableTypeManual.cpp keep their
+// manual paths; they either have no backend redispatch to shortcut or do
+// bookkeeping that must run regardless (e.g. detach_, resize_).
+
+inline bool pure_inference_enabled() {
+  return c10::AutogradState::get_tls_state().get_pure_inference();
+}
+
+// RAII guard that enables the pure inference fast path (and disables grad
+// mode) for the current thread, restoring the previous state on destruction.
+struct TORCH_API PureInferenceMode {
+  PureInferenceMode()
+      : prev_pure_inference_(pure_inference_enabled()),
+        prev_grad_mode_(c10::GradMode::is_enabled()) {
+    c10::AutogradState::get_tls_state().set_pure_inference(true);
+    c10::GradMode::set_enabled(false);
+  }
+
+  ~PureInferenceMode() {
+    c10::AutogradState::get_tls_state().set_pure_inference(
+        prev_pure_inference_);
+    c10::GradMode::set_enabled(prev_grad_mode_);
+  }
+
+ private:
+  bool prev_pure_inference_;
+  bool prev_grad_mode_;
+};
+
+} // namespace autograd
+} // namespace torch
@@ -8,6 +8,8 @@
 #include <torch/csrc/autograd/variable.h>
 
 #include <ATen/Tensor.h>
+#include <c10/core/Event.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
 
 #include <cstdint>
 #include <list>
@@ -17,6 +19,85 @@
 namespace torch {
 namespace autograd {
 
+// Note [CPU offload of saved tensors]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Saved-tensors hooks let users trade device memory for transfer time by
+// packing activations to host memory, but going through the Python hooks
+// costs a GIL round trip per saved tensor, which on busy training loops eats
+// most of the win. These hooks do the same exchange natively: pack copies
+// the tensor into pinned host memory with a non-blocking copy enqueued on
+// the producing stream, so the transfer overlaps the rest of the forward
+// pass and the device block is released back to the caching allocator in
+// stream order. An event recorded after the copy makes unpack safe: the
+// backward thread first makes its current stream wait on the event, then
+// copies the data back. The copy back is synchronous so the pinned buffer
+// cannot be freed while a transfer is still reading it; from pinned memory
+// that is a single full-bandwidth DMA.
+//
+// Only worthwhile for tensors whose sole surviving reference would be the
+// graph: leaves (parameters) stay alive in the user's hands anyway, so
+// offloading them saves nothing, and small tensors are not worth the
+// round trip. Both filters are applied in should_offload_to_cpu below.
+namespace {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local bool saved_tensors_cpu_offload_enabled = false;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local size_t saved_tensors_cpu_offload_min_bytes_ = 1 << 20;
+
+struct CpuOffloadSavedVariableHooks : public SavedVariableHooks {
+  void call_pack_hook(const at::Tensor& tensor) override {
+    source_device_ = tensor.device();
+    auto host_options =
+        tensor.options().device(at::kCPU).pinned_memory(true);
+    // Stream-ordered on the producing stream: the copy reads the data after
+    // the producing kernel, and the caching allocator's stream-ordered
+    // reuse makes dropping the device reference safe.
+    cpu_data_ = tensor.to(host_options, /*non_blocking=*/true);
+    c10::impl::VirtualGuardImpl impl(source_device_.type());
+    copy_done_ = c10::Event(source_device_.type());
+    copy_done_.record(impl.getStream(source_device_));
+  }
+
+  at::Tensor call_unpack_hook() override {
+    // Order the backward stream after the offload copy, then copy back
+    // synchronously (see the note above for why).
+    c10::impl::VirtualGuardImpl impl(source_device_.type());
+    copy_done_.block(impl.getStream(source_device_));
+    return cpu_data_.to(source_device_, /*non_blocking=*/false);
+  }
+
+ private:
+  at::Tensor cpu_data_;
+  at::Device source_device_ = at::kCPU;
+  c10::Event copy_done_{at::kCPU};
+};
+
+bool should_offload_to_cpu(const Variable& variable) {
+  return saved_tensors_cpu_offload_enabled && variable.is_cuda() &&
+      variable.layout() == at::kStrided && !variable.is_leaf() &&
+      static_cast<size_t>(variable.nbytes()) >=
+      saved_tensors_cpu_offload_min_bytes_;
+}
+
+} // namespace
+
+bool is_saved_tensors_cpu_offload_enabled() {
+  return saved_tensors_cpu_offload_enabled;
+}
+
+void set_saved_tensors_cpu_offload_enabled(bool enabled) {
+  saved_tensors_cpu_offload_enabled = enabled;
+}
+
+size_t saved_tensors_cpu_offload_min_bytes() {
+  return saved_tensors_cpu_offload_min_bytes_;
+}
+
+void set_saved_tensors_cpu_offload_min_bytes(size_t min_bytes) {
+  saved_tensors_cpu_offload_min_bytes_ = min_bytes;
+}
+
 SavedVariable::SavedVariable(
     const Variable& variable,
     bool is_output,
@@ -58,6 +139,11 @@ SavedVariable::SavedVariable(
     }
 
     auto maybe_hooks = get_default_hooks();
+    // User-provided (Python) hooks take precedence over the native offload;
+    // see Note [CPU offload of saved tensors]
+    if (!maybe_hooks && should_offload_to_cpu(variable)) {
+      maybe_hooks = std::make_unique<CpuOffloadSavedVariableHooks>();
+    }
 
     // Avoid wrapped numbers from being leaked to the user
     if (maybe_hooks && !variable.unsafeGetTensorImpl()->is_wrapped_number()) {
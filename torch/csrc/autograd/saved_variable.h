@@ -17,6 +17,16 @@ struct Node;
 
 TORCH_API extern const char* ERR_BACKWARD_TWICE;
 
+// Controls for offloading saved tensors to pinned host memory; see
+// Note [CPU offload of saved tensors] in saved_variable.cpp. The setting is
+// thread-local, like the Python saved-tensors hooks, so it scopes naturally
+// to the forward pass of the calling thread. Off by default.
+TORCH_API bool is_saved_tensors_cpu_offload_enabled();
+TORCH_API void set_saved_tensors_cpu_offload_enabled(bool enabled);
+// Tensors smaller than this many bytes stay on the device (default 1 MiB).
+TORCH_API size_t saved_tensors_cpu_offload_min_bytes();
+TORCH_API void set_saved_tensors_cpu_offload_min_bytes(size_t min_bytes);
+
 /// A snapshot of a variable at a certain version. A `SavedVariable` stores
 /// enough information to reconstruct a variable from a certain point in time.
 class TORCH_API SavedVariable {
@@ -5,6 +5,7 @@
 #include <ATen/native/cudnn/Macros.h>
 
 #endif
+#include <ATen/cuda/BatchedTransfer.h>
 #include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAGeneratorImpl.h>
 #include <ATen/cuda/CachingHostAllocator.h>
@@ -934,6 +935,67 @@ static void registerCudaDeviceProperties(PyObject* module) {
             alloc_trace_max_entries,
             alloc_trace_record_context);
       });
+
+  m.def("_cuda_setAllocatorTelemetryEnabled", [](bool enabled) {
+    c10::cuda::CUDACachingAllocator::setTelemetryEnabled(enabled);
+  });
+
+  m.def("_cuda_allocatorTelemetryDroppedEvents", []() {
+    return c10::cuda::CUDACachingAllocator::telemetryDroppedEvents();
+  });
+
+  // Drains the allocator telemetry ring buffer (see TelemetryEvent in
+  // CUDACachingAllocator.h). Returns a list of dicts, oldest event first.
+  m.def("_cuda_drainAllocatorTelemetry", []() {
+    using c10::cuda::CUDACachingAllocator::TelemetryEvent;
+    std::vector<TelemetryEvent> events;
+    {
+      py::gil_scoped_release release;
+      events = c10::cuda::CUDACachingAllocator::drainTelemetry();
+    }
+    py::list result;
+    for (const auto& e : events) {
+      py::dict entry;
+      switch (e.kind) {
+        case TelemetryEvent::Kind::ALLOC:
+          entry["kind"] = "alloc";
+          break;
+        case TelemetryEvent::Kind::FREE:
+          entry["kind"] = "free";
+          break;
+        case TelemetryEvent::Kind::SEGMENT_ALLOC:
+          entry["kind"] = "segment_alloc";
+          break;
+        case TelemetryEvent::Kind::SEGMENT_FREE:
+          entry["kind"] = "segment_free";
+          break;
+        case TelemetryEvent::Kind::OOM:
+          entry["kind"] = "oom";
+          break;
+      }
+      entry["device"] = e.device;
+      entry["addr"] = e.addr;
+      entry["size"] = e.size;
+      entry["stream"] = e.stream;
+      entry["timestamp_ns"] = e.timestamp_ns;
+      result.append(std::move(entry));
+    }
+    return result;
+  });
+
+  // Coalesced host-to-device copy of many small tensors; see
+  // at::cuda::batched_h2d_copy.
+  m.def(
+      "_cuda_batchedCopyH2D",
+      [](const std::vector<at::Tensor>& dsts,
+         const std::vector<at::Tensor>& srcs,
+         bool non_blocking) {
+        py::gil_scoped_release release;
+        at::cuda::batched_h2d_copy(dsts, srcs, non_blocking);
+      },
+      py::arg("dsts"),
+      py::arg("srcs"),
+      py::arg("non_blocking") = true);
 }
 
 static void registerCudaPluggableAllocator(PyObject* module) {
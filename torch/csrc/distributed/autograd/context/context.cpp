@@ -68,6 +68,11 @@ DistAutogradContext::recvFunctions() const {
   return recvAutogradFunctions_;
 }
 
+void DistAutogradContext::setGradReadyCallback(GradReadyCallback callback) {
+  std::lock_guard<std::mutex> guard(lock_);
+  gradReadyCallback_ = std::move(callback);
+}
+
 void DistAutogradContext::accumulateGrad(
     const torch::autograd::Variable& variable,
     const torch::Tensor& grad,
@@ -75,7 +80,7 @@ void DistAutogradContext::accumulateGrad(
   TORCH_INTERNAL_ASSERT(grad.defined());
   TORCH_INTERNAL_ASSERT(variable.requires_grad());
 
-  std::lock_guard<std::mutex> guard(lock_);
+  std::unique_lock<std::mutex> guard(lock_);
   auto it = accumulatedGrads_.find(variable);
   at::Tensor old_grad;
   if (it != accumulatedGrads_.end()) {
@@ -110,6 +115,16 @@ void DistAutogradContext::accumulateGrad(
         accumulatedGrads_.insert(variable, std::move(grad_update));
         recordGradEvent(device);
       });
+
+  if (gradReadyCallback_) {
+    // Snapshot under the lock, but run the callback outside of it: streaming
+    // callbacks typically issue RPCs that re-enter this context (e.g. via
+    // addOutstandingRpc).
+    auto callback = gradReadyCallback_;
+    auto accumulated = accumulatedGrads_.at(variable);
+    guard.unlock();
+    callback(variable, accumulated);
+  }
 }
 
 std::shared_ptr<torch::autograd::GraphTask> DistAutogradContext::
@@ -63,6 +63,19 @@ class TORCH_API DistAutogradContext {
       const torch::autograd::Variable& variable,
       GradCallback&& cb);
 
+  // Callback invoked each time a local gradient is accumulated into this
+  // context, with the variable and its accumulated gradient so far. This
+  // allows streaming gradients out (e.g. over RPC) while the rest of the
+  // backward pass is still running, instead of waiting for the whole context
+  // to finish, overlapping backward compute with network transfer. Note that
+  // a variable whose gradient is touched multiple times during the pass fires
+  // the callback on every accumulation; receivers should treat later values
+  // as replacements. The callback runs on autograd engine threads and must
+  // not block on the backward pass it is part of.
+  using GradReadyCallback = std::function<
+      void(const torch::autograd::Variable&, const torch::Tensor&)>;
+  void setGradReadyCallback(GradReadyCallback callback);
+
   DistAutogradContext(const DistAutogradContext&) = delete;
   DistAutogradContext& operator=(const DistAutogradContext&) = delete;
   DistAutogradContext(DistAutogradContext&&) = delete;
@@ -135,6 +148,9 @@ class TORCH_API DistAutogradContext {
   // that needs to be accumulated on that variable..
   c10::Dict<torch::Tensor, torch::Tensor> accumulatedGrads_;
 
+  // See comments for setGradReadyCallback.
+  GradReadyCallback gradReadyCallback_;
+
   // See comments for recordGradEvent(c10::Device device);
   std::unordered_map<c10::Device, c10::Event> gradReadyEvents_;
   const c10::impl::VirtualGuardImpl impl_;
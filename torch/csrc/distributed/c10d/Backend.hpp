@@ -62,6 +62,14 @@ class TORCH_API Backend : public torch::CustomClassHolder {
     // no-op for backends that have not implemented endCoalescing
   }
 
+  // Ends a coalescing block and returns a single work object covering every
+  // operation issued inside the block, so callers don't have to collect the
+  // per-op works themselves.
+  virtual c10::intrusive_ptr<Work> endCoalescing() {
+    // no-op for backends that have not implemented endCoalescing
+    return nullptr;
+  }
+
   // Subclasses must override this method to return the backend name
   virtual const std::string getBackendName() const {
     TORCH_INTERNAL_ASSERT(false, "getBackendName is not implemented.");
@@ -86,6 +86,8 @@ std::string opTypeToString(OpType opType) {
       return "UNKNOWN";
     case OpType::_REDUCE_SCATTER_BASE:
       return "_REDUCE_SCATTER_BASE";
+    case OpType::COALESCED:
+      return "COALESCED";
     default:
       TORCH_INTERNAL_ASSERT(false, "Unknown op type!");
   }
@@ -119,6 +119,18 @@ class TORCH_API ProcessGroup : public torch::CustomClassHolder {
     }
   }
 
+  // Flavor of endCoalescing that flushes the block as one batch and returns a
+  // single work object tracking it, instead of requiring the caller to hold
+  // on to every per-op work.
+  virtual c10::intrusive_ptr<Work> endCoalescing(c10::DeviceType deviceType) {
+    // only nccl has implemented startCoalescing so only execute for nccl
+    // backends
+    if (getBackendType() == BackendType::NCCL) {
+      return getBackend(deviceType)->endCoalescing();
+    }
+    return nullptr;
+  }
+
   virtual c10::intrusive_ptr<Work> broadcast(
       std::vector<at::Tensor>& tensors,
       const BroadcastOptions& opts = BroadcastOptions()) {
@@ -1028,6 +1028,90 @@ class AsyncAllreduceWork : public ProcessGroupGloo::AsyncWork {
   }
 };
 
+// Note [Chunk-pipelined allreduce]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Handing one huge buffer to gloo serializes that collective's own
+// reduce-scatter and allgather phases: while a phase waits on the wire, the
+// summation cores idle, and vice versa. Splitting the buffer into segments
+// that travel as independent collectives lets one segment's summation overlap
+// another segment's transfer. The segments carry consecutive tags, so when
+// the process group was constructed with multiple devices they also stripe
+// round-robin across the corresponding contexts (see getContext), i.e.
+// across NICs. Each segment runs on its own thread because the gloo
+// collective API is blocking; this mirrors how the worker pool already runs
+// independent collectives with distinct tags concurrently on one context.
+class AsyncAllreduceChunkedWork : public AsyncAllreduceWork {
+ public:
+  AsyncAllreduceChunkedWork(
+      std::vector<std::shared_ptr<gloo::Context>> contexts,
+      std::vector<uint32_t> tags,
+      std::vector<at::Tensor>& inputs,
+      ReduceOp reduceOp)
+      : AsyncAllreduceWork(contexts[0], inputs, reduceOp, tags[0]),
+        contexts_(std::move(contexts)),
+        tags_(std::move(tags)) {}
+
+  void run() override {
+    at::Tensor flat = inputs[0].view({-1});
+    const int64_t numel = flat.numel();
+    const auto numSegments = static_cast<int64_t>(tags_.size());
+    const int64_t segmentNumel = (numel + numSegments - 1) / numSegments;
+
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    std::vector<std::thread> workers;
+    workers.reserve(numSegments);
+    for (const auto segment : c10::irange(numSegments)) {
+      workers.emplace_back([&, segment]() {
+        try {
+          const int64_t begin = segment * segmentNumel;
+          const int64_t len = std::min(segmentNumel, numel - begin);
+          std::vector<at::Tensor> tensors = {flat.narrow(0, begin, len)};
+          const auto& scalarType = tensors[0].scalar_type();
+          gloo::AllreduceOptions opts(contexts_[segment]);
+          opts.setReduceFunction(getFunction(scalarType, reduceOp));
+          opts.setTag(tags_[segment]);
+          GENERATE_ALL_TYPES(scalarType, setOutputs, opts, tensors);
+          gloo::allreduce(opts);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(errorMutex);
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  std::vector<std::shared_ptr<gloo::Context>> contexts_;
+  std::vector<uint32_t> tags_;
+};
+
+// Decides how many segments a dense allreduce should be pipelined over.
+// Only a single large contiguous CPU tensor benefits; every rank computes
+// the same answer from the (identical) tensor sizes, keeping tag sequences
+// in lockstep across the group.
+size_t allreduceSegmentCount(const std::vector<at::Tensor>& inputs) {
+  constexpr size_t kSegmentBytes = 16 * 1024 * 1024;
+  constexpr size_t kMaxSegments = 8;
+  if (inputs.size() != 1 || !inputs[0].is_contiguous()) {
+    return 1;
+  }
+  const size_t bytes = inputs[0].numel() * inputs[0].element_size();
+  // Below two segments' worth of data the pipeline has nothing to overlap.
+  if (bytes < 2 * kSegmentBytes) {
+    return 1;
+  }
+  return std::min(kMaxSegments, bytes / kSegmentBytes);
+}
+
 class AsyncAllreduceCoalescedWork : public AsyncAllreduceWork {
  public:
   AsyncAllreduceCoalescedWork(
@@ -1467,8 +1551,26 @@ c10::intrusive_ptr<Work> ProcessGroupGloo::allreduce(
   auto context = getContext(tag);
   if (device.type() == at::kCPU) {
     if (layout == c10::kStrided) {
-      work = c10::make_intrusive<AsyncAllreduceWork>(
-          std::move(context), inputs, opts.reduceOp, tag);
+      const size_t numSegments = allreduceSegmentCount(inputs);
+      if (numSegments > 1) {
+        // See Note [Chunk-pipelined allreduce]
+        std::vector<std::shared_ptr<gloo::Context>> contexts;
+        std::vector<uint32_t> tags;
+        contexts.reserve(numSegments);
+        tags.reserve(numSegments);
+        contexts.push_back(std::move(context));
+        tags.push_back(tag);
+        for (size_t i = 1; i < numSegments; i++) {
+          const auto segmentTag = nextTag();
+          contexts.push_back(getContext(segmentTag));
+          tags.push_back(segmentTag);
+        }
+        work = c10::make_intrusive<AsyncAllreduceChunkedWork>(
+            std::move(contexts), std::move(tags), inputs, opts.reduceOp);
+      } else {
+        work = c10::make_intrusive<AsyncAllreduceWork>(
+            std::move(context), inputs, opts.reduceOp, tag);
+      }
     } else if (layout == c10::kSparse) {
       work = c10::make_intrusive<AsyncSparseAllreduceWork>(
           std::move(context), inputs, tag);
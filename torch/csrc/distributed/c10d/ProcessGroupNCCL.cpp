@@ -5,6 +5,7 @@
 
 #ifdef USE_C10D_NCCL
 
+#include <algorithm>
 #include <exception>
 #include <map>
 #include <stdexcept>
@@ -352,7 +353,8 @@ ProcessGroupNCCL::WorkNCCL::WorkNCCL(const WorkNCCL& w)
       workStartTime_(w.workStartTime_),
       seq_(w.seq_),
       startTraceUpdated_(w.startTraceUpdated_),
-      store_(w.store_) {
+      store_(w.store_),
+      gpuExecutionComplete_(w.gpuExecutionComplete_) {
   exception_ = w.exception_;
 }
 
@@ -416,6 +418,11 @@ bool ProcessGroupNCCL::WorkNCCL::startedGPUExecutionInternal() const {
 }
 
 bool ProcessGroupNCCL::WorkNCCL::finishedGPUExecutionInternal() const {
+  // Set by the completion host function when NCCL_COMPLETION_CALLBACKS is
+  // enabled; lets us skip the event queries below.
+  if (gpuExecutionComplete_ && gpuExecutionComplete_->load()) {
+    return true;
+  }
   try {
     for (const auto i : c10::irange(devices_.size())) {
       // Checking the work's corresponding CUDA events' status
@@ -479,10 +486,29 @@ void ProcessGroupNCCL::WorkNCCL::synchronizeStreams() {
   if (avoidRecordStreams_) {
     // TORCH_INTERNAL_ASSERT(outputs_->size() > 0);
     // TORCH_INTERNAL_ASSERT(stashed_for_allocator_safety_->size() > 0);
+    // The completion callback thread may already have dropped the stash;
+    // see WorkNCCL::releaseStashedTensors.
+    std::lock_guard<std::mutex> lock(mutex_);
     stashed_for_allocator_safety_->clear();
   }
 }
 
+void ProcessGroupNCCL::WorkNCCL::releaseStashedTensors() {
+  // Called from the completion callback thread once the collective's kernels
+  // have finished on the GPU. At that point the stashed input references are
+  // no longer needed for allocator safety, so drop them now instead of
+  // holding them until the user thread calls wait(). Take the stash out
+  // under the lock but destroy the tensors outside it: freeing device memory
+  // re-enters the caching allocator.
+  std::vector<at::Tensor> stash;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stashed_for_allocator_safety_) {
+      std::swap(stash, *stashed_for_allocator_safety_);
+    }
+  }
+}
+
 // Waiting on the work's corresponding CUDA events
 void ProcessGroupNCCL::WorkNCCL::synchronizeInternal(
     std::chrono::milliseconds timeout) {
@@ -630,6 +656,9 @@ ProcessGroupNCCL::ProcessGroupNCCL(
   desyncDebug_ = parseEnvVarFlag(NCCL_DESYNC_DEBUG) ||
       (dist_debug_level_ >= DebugLevel::Detail);
   avoidRecordStreams_ = parseEnvVarFlag(NCCL_AVOID_RECORD_STREAMS);
+  completionCallbacks_ = parseEnvVarFlag(NCCL_COMPLETION_CALLBACKS);
+  commPoolSize_ = std::max(
+      1, parseEnvVarIntDefault(NCCL_COMM_POOL, options_->comm_pool_size));
 
   if (blockingWait_) {
     if (asyncErrorHandling_ != NoHandling || desyncDebug_) {
@@ -668,6 +697,12 @@ ProcessGroupNCCL::ProcessGroupNCCL(
     workCleanupThread_ = std::thread(&ProcessGroupNCCL::workCleanupLoop, this);
   }
 
+  if (completionCallbacks_) {
+    completionQueue_ = std::make_shared<CompletionQueue>();
+    completionCallbackThread_ =
+        std::thread(&ProcessGroupNCCL::completionCallbackLoop, this);
+  }
+
   init();
   LOG(INFO) << "[Rank " << rank_
             << "] ProcessGroupNCCL initialized with following options:"
@@ -676,7 +711,9 @@ ProcessGroupNCCL::ProcessGroupNCCL(
             << "\nNCCL_BLOCKING_WAIT: " << blockingWait_
             << "\nTIMEOUT(ms): " << options_->timeout.count()
             << "\nUSE_HIGH_PRIORITY_STREAM: "
-            << options_->is_high_priority_stream;
+            << options_->is_high_priority_stream
+            << "\nNCCL_COMM_POOL: " << commPoolSize_
+            << "\nNCCL_COMPLETION_CALLBACKS: " << completionCallbacks_;
 
   RECORD_PARAM_COMMS(
       0, // seq
@@ -789,6 +826,15 @@ ProcessGroupNCCL::~ProcessGroupNCCL() {
     workCleanupThread_.join();
   }
 
+  if (completionCallbacks_) {
+    {
+      std::lock_guard<std::mutex> lock(completionQueue_->mutex);
+      completionQueue_->terminated = true;
+    }
+    completionQueue_->cv.notify_one();
+    completionCallbackThread_.join();
+  }
+
   {
     // Abort all NCCL Communicators on Process Group Destruction
     std::lock_guard<std::mutex> lock(mutex_);
@@ -997,7 +1043,10 @@ void ProcessGroupNCCL::workCleanupLoop() {
       workMetaListCV_.wait_for(
           lock,
           std::chrono::milliseconds(kWorkCleanupThreadSleepMillis),
-          [&]() -> bool { return terminateProcessGroup_.load(); });
+          [&]() -> bool {
+            return terminateProcessGroup_.load() || completedWorkPending_;
+          });
+      completedWorkPending_ = false;
 
       for (auto it = workMetaList_.begin(); it != workMetaList_.end();
            /* no increment*/) {
@@ -1054,6 +1103,123 @@ void ProcessGroupNCCL::workCleanupLoop() {
   }
 }
 
+// Note [NCCL completion callbacks]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// By default, completed collectives are only discovered by workCleanupLoop,
+// which re-scans the enqueued works every kWorkCleanupThreadSleepMillis and
+// queries their end events. That puts up to a full poll interval between a
+// collective's kernels finishing and (a) its exception being surfaced and
+// (b) its stashed_for_allocator_safety_ references being dropped — with
+// NCCL_AVOID_RECORD_STREAMS, bucket gradients can stay allocated long after
+// the allreduce that consumed them has finished.
+//
+// With NCCL_COMPLETION_CALLBACKS set, every collective also launches a host
+// function (cudaLaunchHostFunc) on each of its NCCL streams, enqueued right
+// after the end events, so the CUDA runtime runs it once the collective's
+// kernels are done. Host functions may not call any CUDA API — even
+// destroying a tensor can re-enter the caching allocator and record events —
+// so the callback only flips the work's completion flag and pushes a
+// WorkCompletion record onto completionQueue_. completionCallbackThread_
+// then, on an ordinary thread, drops the stashed references immediately and
+// wakes workCleanupLoop so the finished work is reaped and its exception
+// handled without waiting out the poll interval.
+//
+// The watchdog and cleanup threads keep their error-detection duties
+// unchanged: a hung collective's host function simply never fires, and
+// timeouts and asynchronous NCCL errors are caught by the existing polling.
+//
+// Callbacks are not attached while a CUDA graph capture is active: the host
+// function would be captured into the graph instead of running now, and
+// replays would signal completion for work objects that no longer exist.
+//
+// Shutdown: each WorkCompletion holds a shared_ptr to the queue, so a
+// callback that fires while (or after) the process group is being destroyed
+// pushes into a queue that is still alive but no longer drained; the record
+// and the work it pins are abandoned. That only happens when the group is
+// destroyed with collectives still in flight, in which case the
+// communicators are aborted anyway.
+void ProcessGroupNCCL::completionCallbackLoop() {
+  while (true) {
+    std::deque<WorkCompletion*> ready;
+    bool done = false;
+    {
+      std::unique_lock<std::mutex> lock(completionQueue_->mutex);
+      completionQueue_->cv.wait(lock, [&]() -> bool {
+        return completionQueue_->terminated || !completionQueue_->ready.empty();
+      });
+      done = completionQueue_->terminated;
+      std::swap(ready, completionQueue_->ready);
+    }
+
+    for (auto* completion : ready) {
+      completion->work->releaseStashedTensors();
+      delete completion;
+    }
+
+    if (done) {
+      return;
+    }
+
+    if (!ready.empty()) {
+      // Wake the cleanup thread so the finished works are reaped now rather
+      // than on its next poll.
+      {
+        std::lock_guard<std::mutex> lock(workMetaListMutex_);
+        completedWorkPending_ = true;
+      }
+      workMetaListCV_.notify_one();
+    }
+  }
+}
+
+void ProcessGroupNCCL::workCompletionCallback(void* data) {
+  // Runs as a CUDA host function on a driver thread. No CUDA API may be
+  // called from here, and destroying a tensor can free device memory through
+  // the caching allocator, so this only signals; the real work happens on
+  // completionCallbackThread_. See Note [NCCL completion callbacks].
+  auto* completion = static_cast<WorkCompletion*>(data);
+  if (completion->pendingCallbacks.fetch_sub(1) != 1) {
+    // Another device's callback is still outstanding.
+    return;
+  }
+  completion->work->gpuExecutionComplete_->store(true);
+  // Keep the queue alive past the push: the completion thread may consume
+  // and delete the record as soon as it is enqueued.
+  auto queue = completion->queue;
+  {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->ready.push_back(completion);
+  }
+  queue->cv.notify_one();
+}
+
+void ProcessGroupNCCL::attachCompletionCallbacks(
+    const c10::intrusive_ptr<WorkNCCL>& work,
+    std::vector<at::cuda::CUDAStream>& ncclStreams,
+    size_t numDevices) {
+  // During a graph capture the host function would be captured into the
+  // graph instead of running now; completion of captured collectives is
+  // governed by graph replay, so fall back to event polling for them.
+  if (c10::cuda::currentStreamCaptureStatusMayInitCtx() !=
+      c10::cuda::CaptureStatus::None) {
+    return;
+  }
+  work->gpuExecutionComplete_ = std::make_shared<std::atomic<bool>>(false);
+  // The callbacks jointly own the record: the last one to fire hands it to
+  // completionCallbackThread_, which deletes it. If a launch below throws,
+  // the record (and the work it pins) leaks rather than risking a callback
+  // dereferencing freed memory.
+  auto* completion = new WorkCompletion();
+  completion->work = work;
+  completion->queue = completionQueue_;
+  completion->pendingCallbacks.store(static_cast<int>(numDevices));
+  for (const auto i : c10::irange(numDevices)) {
+    at::cuda::CUDAGuard gpuGuard(work->devices_[i]);
+    C10_CUDA_CHECK(cudaLaunchHostFunc(
+        ncclStreams[i].stream(), workCompletionCallback, completion));
+  }
+}
+
 std::exception_ptr ProcessGroupNCCL::WorkNCCL::checkForNCCLErrors(
     const std::vector<std::shared_ptr<NCCLComm>>& ncclComms) const {
   return checkForNCCLErrorsInternal(ncclComms);
@@ -1502,8 +1668,43 @@ ProcessGroupNCCL::Options::Options(bool is_high_priority_stream)
     : Backend::Options(NCCL_BACKEND_NAME),
       is_high_priority_stream(is_high_priority_stream) {}
 
+// Note [NCCL communicator pool]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A single communicator per device set means every collective issued against
+// it is serialized on that communicator's internal stream, even when the
+// collectives are logically independent (e.g. an overlapping
+// pipeline-parallel batch and a data-parallel allreduce issued through the
+// same group). When Options::comm_pool_size (or the NCCL_COMM_POOL
+// environment variable) is > 1, collectives rotate round-robin over that
+// many communicator cliques for the same device set; each clique is a
+// separate devNCCLCommMap_/ncclStreams_ entry, so they run on independent
+// internal streams and can make concurrent progress on the links.
+//
+// Two caveats follow from the rotation:
+//  - It is only applied to collectives, never to point-to-point ops (those
+//    already get a dedicated communicator per rank pair), and never inside a
+//    coalescing block, where all ops must share one communicator clique.
+//  - The rotation is driven by a per-device-set counter that advances once
+//    per collective, so it stays in lockstep across ranks as long as ranks
+//    issue their collectives in the same order -- the same requirement NCCL
+//    itself already imposes. Callers remain responsible for ordering
+//    dependent collectives via Work::wait(), as outputs produced on one pool
+//    slot are not implicitly ordered before collectives on another slot.
+std::string ProcessGroupNCCL::pooledCommKey(const std::string& devicesKey) {
+  if (commPoolSize_ <= 1 || coalescing_active_) {
+    return devicesKey;
+  }
+  const auto slot = commPoolCounters_[devicesKey]++ % commPoolSize_;
+  if (slot == 0) {
+    // Slot 0 reuses the unpooled cache entry.
+    return devicesKey;
+  }
+  return devicesKey + "_pool" + std::to_string(slot);
+}
+
 void ProcessGroupNCCL::startCoalescing() {
   coalescedDevices_.clear();
+  coalescedComms_.clear();
   coalescing_active_ = true;
   groupStart();
 }
@@ -1525,11 +1726,72 @@ void ProcessGroupNCCL::endCoalescing(
     for (const auto i : c10::irange(devices.size())) {
       (*ncclWork->ncclEndEvents_)[i].record(ncclStreams[i]);
     }
+    // See Note [NCCL completion callbacks].
+    if (completionCallbacks_) {
+      auto workRef = c10::intrusive_ptr<WorkNCCL>::reclaim_copy(ncclWork);
+      attachCompletionCallbacks(workRef, ncclStreams, devices.size());
+    }
     batch_idx += 1;
   }
   coalescing_active_ = false;
 }
 
+c10::intrusive_ptr<Work> ProcessGroupNCCL::endCoalescing() {
+  groupEnd();
+  coalescing_active_ = false;
+  if (coalescedDevices_.empty()) {
+    return nullptr;
+  }
+
+  // All ops in the block went through the same ncclGroup, and callers of this
+  // flavor get back one work object tracking the whole batch, so the batch
+  // must target a single communicator clique: one set of devices, one set of
+  // streams, one set of end events.
+  const auto& devices = coalescedDevices_[0];
+  const auto key = getKeyFromDevices(devices);
+  for (const auto& coalescedDevices : coalescedDevices_) {
+    TORCH_CHECK(
+        getKeyFromDevices(coalescedDevices) == key,
+        "Ops in a coalescing block must all target the same device set when "
+        "a single work object is requested; use the endCoalescing overload "
+        "taking the per-op works otherwise");
+  }
+  auto& ncclStreams = ncclStreams_[key];
+
+  auto work = initWork(devices, rank_, OpType::COALESCED);
+  work->outputs_ = std::make_shared<std::vector<at::Tensor>>();
+  work->ncclComms_ = coalescedComms_[0];
+
+  // One set of end events for the whole batch; the per-op works (if any were
+  // kept) never had theirs recorded because coalescing was active.
+  for (const auto i : c10::irange(devices.size())) {
+    (*work->ncclEndEvents_)[i].record(ncclStreams[i]);
+  }
+
+  // See Note [NCCL completion callbacks].
+  if (completionCallbacks_) {
+    attachCompletionCallbacks(work, ncclStreams, devices.size());
+  }
+
+  {
+    c10::cuda::CUDAMultiStreamGuard streamGuard(ncclStreams);
+    work->future_ = c10::make_intrusive<at::ivalue::Future>(
+        c10::ListType::create(c10::TensorType::get()), devices);
+    work->future_->markCompleted(at::IValue(*work->outputs_));
+  }
+
+  work->blockingWait_ = blockingWait_;
+  work->avoidRecordStreams_ = avoidRecordStreams_;
+  work->opTimeout_ = options_->timeout;
+  work->store_ = store_;
+
+  if (asyncErrorHandling_ != NoHandling) {
+    workEnqueue(work);
+  }
+
+  return work;
+}
+
 template <typename Fn, typename PreProcess, typename PostProcess>
 c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
     std::vector<at::Tensor>& inputs,
@@ -1558,11 +1820,13 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
   //    across `inputs' tensors).
   const auto devices = getDeviceList(inputs);
   const bool inputs_same_dev = (devices.size() == 1);
-  const auto key = getKeyFromDevices(devices);
+  // See Note [NCCL communicator pool]
+  const auto key = pooledCommKey(getKeyFromDevices(devices));
   auto& ncclComms = getNCCLComm(key, devices, opType);
 
   if (coalescing_active_) {
     coalescedDevices_.push_back(devices);
+    coalescedComms_.push_back(ncclComms);
   }
 
   // Used many times below, so we stash the unordered_map lookup
@@ -1639,6 +1903,12 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::collective(
     work->ncclComms_[i] = ncclComms[i];
   }
 
+  // See Note [NCCL completion callbacks]. Coalesced collectives get their
+  // callbacks attached in endCoalescing, along with their end events.
+  if (completionCallbacks_ && !coalescing_active_) {
+    attachCompletionCallbacks(work, ncclStreams, devices.size());
+  }
+
   {
     c10::cuda::CUDAMultiStreamGuard streamGuard(ncclStreams);
     work->future_ = c10::make_intrusive<at::ivalue::Future>(
@@ -1713,6 +1983,7 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::pointToPoint(
 
   if (coalescing_active_) {
     coalescedDevices_.push_back(devices);
+    coalescedComms_.push_back(ncclComms);
   }
 
   // First let NCCL streams wait for input tensors allocation streams
@@ -1787,6 +2058,11 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::pointToPoint(
     work->store_ = store_;
   }
 
+  // See Note [NCCL completion callbacks].
+  if (completionCallbacks_ && !coalescing_active_) {
+    attachCompletionCallbacks(work, ncclStreams_[key], tensors.size());
+  }
+
   // Future only needs to be created and marked completed with outputs for
   // recv(), but still create future for use cases such as profiling even for
   // send().
@@ -1872,9 +2148,183 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_impl(
       "nccl:all_reduce");
 }
 
+// Note [Sparse allreduce]
+// ~~~~~~~~~~~~~~~~~~~~~~~
+// NCCL has no native sparse collectives, so before this path existed sparse
+// gradients had to be densified before reduction -- for embedding-style
+// gradients with few touched rows that can amplify traffic by orders of
+// magnitude. Sparse allreduce is instead composed from dense collectives:
+//
+// 1. coalesce() the local tensor so duplicate indices are summed before
+//    anything hits the wire.
+// 2. (opt-in, NCCL_SPARSE_ALLREDUCE_V2) bucket nonzeros to owner ranks by
+//    leading sparse index and exchange them with an alltoallv; each owner
+//    coalesces its shard, so an index hot on every rank is reduced once at
+//    its owner rather than world-size times on every rank in step 3.
+// 3. allgather the per-rank nnz, then the indices and values padded to the
+//    global max nnz, and sum the resulting per-rank sparse shards locally,
+//    coalescing to fold duplicates.
+//
+// Unlike the dense path this is synchronous: gather buffer sizes depend on
+// remote nnz values, which must be read on the host before the next
+// collective can be posted. The returned work is the one for the final
+// values allgather; by the time the caller sees it the result has already
+// been copied into the input tensor, matching the in-place contract of the
+// Gloo sparse path.
+c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduceSparse(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  TORCH_CHECK(
+      tensors.size() == 1,
+      "Sparse allreduce only supports a single tensor per rank");
+  TORCH_CHECK(
+      opts.reduceOp == ReduceOp::SUM,
+      "Sparse allreduce only supports ReduceOp.SUM");
+  auto& tensor = tensors[0];
+  TORCH_CHECK(tensor.is_cuda(), "Sparse allreduce expects a CUDA tensor");
+
+  // Pre-reduction local coalescing; see Note [Sparse allreduce] step 1.
+  auto input = tensor.coalesce();
+
+  if (parseEnvVarFlag(NCCL_SPARSE_ALLREDUCE_V2)) {
+    input = sparseOwnerShard(input);
+  }
+
+  const auto sparseDim = input.sparse_dim();
+  const auto sizes = input.sizes();
+  int64_t denseNumel = 1;
+  for (const auto i : c10::irange(sparseDim, input.dim())) {
+    denseNumel *= sizes[i];
+  }
+  const int64_t nnz = input._nnz();
+  auto longOpts = at::TensorOptions().dtype(at::kLong).device(input.device());
+
+  // nnz may differ across ranks; exchange it first to size gather buffers.
+  auto nnzIn = at::full({1}, nnz, longOpts);
+  auto nnzOut = at::empty({size_}, longOpts);
+  auto work = _allgather_base(nnzOut, nnzIn);
+  work->wait();
+  auto nnzHost = nnzOut.cpu();
+  auto nnzAcc = nnzHost.accessor<int64_t, 1>();
+  int64_t maxNnz = 0;
+  for (const auto r : c10::irange(size_)) {
+    maxNnz = std::max(maxNnz, nnzAcc[r]);
+  }
+  if (maxNnz == 0) {
+    // Globally empty; the (empty) local coalesced tensor is the result.
+    tensor.copy_(input);
+    return work;
+  }
+
+  // Pad to the global max nnz so every rank contributes equal-shaped
+  // buffers to the allgathers below.
+  auto paddedIndices =
+      at::constant_pad_nd(input.indices(), {0, maxNnz - nnz}).contiguous();
+  auto paddedValues = at::constant_pad_nd(
+                          input.values().reshape({nnz, denseNumel}),
+                          {0, 0, 0, maxNnz - nnz})
+                          .contiguous();
+
+  auto indicesIn = paddedIndices.reshape({-1});
+  auto indicesOut = at::empty({size_ * sparseDim * maxNnz}, longOpts);
+  _allgather_base(indicesOut, indicesIn)->wait();
+
+  auto valuesIn = paddedValues.reshape({-1});
+  auto valuesOut =
+      at::empty({size_ * maxNnz * denseNumel}, input.values().options());
+  work = _allgather_base(valuesOut, valuesIn);
+  work->wait();
+
+  // Sum the per-rank shards; coalesce folds duplicate indices.
+  auto indicesByRank = indicesOut.reshape({size_, sparseDim, maxNnz});
+  auto valuesByRank = valuesOut.reshape({size_, maxNnz, denseNumel});
+  at::Tensor output;
+  for (const auto r : c10::irange(size_)) {
+    const auto rankNnz = nnzAcc[r];
+    if (rankNnz == 0) {
+      continue;
+    }
+    std::vector<int64_t> valueShape{rankNnz};
+    for (const auto i : c10::irange(sparseDim, input.dim())) {
+      valueShape.push_back(sizes[i]);
+    }
+    auto shard = at::sparse_coo_tensor(
+        indicesByRank[r].narrow(1, 0, rankNnz),
+        valuesByRank[r].narrow(0, 0, rankNnz).reshape(valueShape),
+        sizes,
+        input.options());
+    output = output.defined() ? output + shard : shard;
+  }
+  tensor.copy_(output.coalesce());
+  return work;
+}
+
+// See Note [Sparse allreduce] step 2.
+at::Tensor ProcessGroupNCCL::sparseOwnerShard(const at::Tensor& input) {
+  const auto sparseDim = input.sparse_dim();
+  const auto sizes = input.sizes();
+  const int64_t nnz = input._nnz();
+  int64_t denseNumel = 1;
+  for (const auto i : c10::irange(sparseDim, input.dim())) {
+    denseNumel *= sizes[i];
+  }
+  auto longOpts = at::TensorOptions().dtype(at::kLong).device(input.device());
+
+  // Bucket nonzeros by the owner rank of their leading sparse index and
+  // group them so rows destined for the same rank are contiguous.
+  auto indices = input.indices();
+  auto owners = indices.select(0, 0).remainder(size_);
+  at::Tensor sortedOwners, perm;
+  std::tie(sortedOwners, perm) = owners.sort();
+  auto sendIndices = indices.index_select(1, perm).t().contiguous();
+  auto sendValues =
+      input.values().reshape({nnz, denseNumel}).index_select(0, perm).contiguous();
+
+  // Exchange per-rank row counts so the receive buffers can be sized.
+  auto sendCounts = at::bincount(owners, /*weights=*/{}, /*minlength=*/size_);
+  auto recvCounts = at::empty({size_}, longOpts);
+  std::vector<int64_t> equalSplits;
+  alltoall_base(recvCounts, sendCounts, equalSplits, equalSplits)->wait();
+  auto sendCountsHost = sendCounts.cpu();
+  auto recvCountsHost = recvCounts.cpu();
+  auto sendCountsAcc = sendCountsHost.accessor<int64_t, 1>();
+  auto recvCountsAcc = recvCountsHost.accessor<int64_t, 1>();
+  std::vector<int64_t> inSplits(size_);
+  std::vector<int64_t> outSplits(size_);
+  int64_t totalRecv = 0;
+  for (const auto r : c10::irange(size_)) {
+    inSplits[r] = sendCountsAcc[r];
+    outSplits[r] = recvCountsAcc[r];
+    totalRecv += recvCountsAcc[r];
+  }
+
+  // alltoallv the rows themselves; splits are dim 0 slices.
+  auto recvIndices = at::empty({totalRecv, sparseDim}, longOpts);
+  alltoall_base(recvIndices, sendIndices, outSplits, inSplits)->wait();
+  auto recvValues = at::empty({totalRecv, denseNumel}, input.values().options());
+  alltoall_base(recvValues, sendValues, outSplits, inSplits)->wait();
+
+  // Coalesce the owned shard: cross-rank duplicates are folded here, once,
+  // instead of on every rank after the final gather.
+  std::vector<int64_t> valueShape{totalRecv};
+  for (const auto i : c10::irange(sparseDim, input.dim())) {
+    valueShape.push_back(sizes[i]);
+  }
+  return at::sparse_coo_tensor(
+             recvIndices.t().contiguous(),
+             recvValues.reshape(valueShape),
+             sizes,
+             input.options())
+      .coalesce();
+}
+
 c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce(
     std::vector<at::Tensor>& tensors,
     const AllreduceOptions& opts) {
+  if (tensors.size() == 1 && tensors[0].is_sparse()) {
+    // See Note [Sparse allreduce]
+    return allreduceSparse(tensors, opts);
+  }
   check_gpu_tensors_different_devices(tensors);
 
   // @lint-ignore CLANGTIDY
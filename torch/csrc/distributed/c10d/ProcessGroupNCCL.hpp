@@ -3,6 +3,7 @@
 #ifdef USE_C10D_NCCL
 
 #include <chrono>
+#include <deque>
 #include <iostream>
 #include <list>
 #include <mutex>
@@ -56,6 +57,30 @@ enum ErrorHandlingMode { NoHandling = 0, TearDown = 1, CleanUpOnly = 2 };
 // See stashed_for_allocator_safety_ below.
 constexpr const char* NCCL_AVOID_RECORD_STREAMS = "NCCL_AVOID_RECORD_STREAMS";
 
+// Control the number of NCCL communicators kept per device set. Each
+// communicator in the pool gets its own internal stream, and independent
+// collectives are issued round-robin across the pool so they can run
+// concurrently on the links. Overrides Options::comm_pool_size when set.
+// See Note [NCCL communicator pool] in ProcessGroupNCCL.cpp.
+constexpr const char* NCCL_COMM_POOL = "NCCL_COMM_POOL";
+
+// When set, every collective additionally launches a host function
+// (cudaLaunchHostFunc) on its NCCL streams. The host function fires as soon
+// as the collective's kernels finish and hands the work to a completion
+// thread, which drops the stashed tensor references and wakes the work
+// cleanup thread right away instead of letting it discover completion on its
+// next kWorkCleanupThreadSleepMillis poll. The watchdog and cleanup threads
+// remain responsible for error and timeout detection.
+// See Note [NCCL completion callbacks] in ProcessGroupNCCL.cpp.
+constexpr const char* NCCL_COMPLETION_CALLBACKS = "NCCL_COMPLETION_CALLBACKS";
+
+// When set, ProcessGroupNCCL's sparse allreduce buckets nonzeros to owner
+// ranks with an alltoall-based reduce-scatter before the final allgather, so
+// an index duplicated across ranks is reduced once at its owner instead of
+// world-size times on every rank. See Note [Sparse allreduce] in
+// ProcessGroupNCCL.cpp.
+constexpr const char* NCCL_SPARSE_ALLREDUCE_V2 = "NCCL_SPARSE_ALLREDUCE_V2";
+
 // ProcessGroupNCCL implements NCCL bindings for c10d.
 //
 // All functions of the class are expected to be called in the same order
@@ -219,6 +244,11 @@ class TORCH_API ProcessGroupNCCL : public Backend {
     // exception_ptr.
     bool finishedGPUExecutionInternal() const;
 
+    // Drops stashed_for_allocator_safety_'s contents. Called from the
+    // completion callback thread once the collective's kernels have
+    // finished; see Note [NCCL completion callbacks].
+    void releaseStashedTensors();
+
     // Reference to the store so that we can write aborted communicators
     // to the store.
     c10::intrusive_ptr<Store> store_;
@@ -239,6 +269,13 @@ class TORCH_API ProcessGroupNCCL : public Backend {
     // but that doesn't do any harm.
     std::shared_ptr<std::vector<at::Tensor>> stashed_for_allocator_safety_;
 
+    // Set by the completion host function once the collective's kernels have
+    // finished, letting isCompleted() skip the cudaEventQuery calls. Shared
+    // between the user-facing work and its workMetaList_ copy. Only
+    // populated when NCCL_COMPLETION_CALLBACKS is set; see
+    // Note [NCCL completion callbacks].
+    std::shared_ptr<std::atomic<bool>> gpuExecutionComplete_;
+
     // The future returned by getFuture.
     c10::intrusive_ptr<at::ivalue::Future> future_;
 
@@ -281,6 +318,12 @@ class TORCH_API ProcessGroupNCCL : public Backend {
 
     // Schedule NCCL operations on high priority CUDA streams
     bool is_high_priority_stream;
+
+    // Number of NCCL communicators (each with its own internal stream) to
+    // round-robin independent collectives across per device set. May be
+    // overridden by the NCCL_COMM_POOL environment variable. See
+    // Note [NCCL communicator pool] in ProcessGroupNCCL.cpp.
+    int comm_pool_size = 1;
   };
 
   // If you wish to create multiple process groups, each with a potentially
@@ -329,6 +372,8 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   void endCoalescing(
       std::vector<c10::intrusive_ptr<Work>>& reqs) override;
 
+  c10::intrusive_ptr<Work> endCoalescing() override;
+
   c10::intrusive_ptr<Work> broadcast(
       std::vector<at::Tensor>& tensors,
       const BroadcastOptions& opts = BroadcastOptions()) override;
@@ -454,6 +499,11 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       int p2pRank = 0,
       bool isSendRecvSelf = false);
 
+  // Returns the communicator cache key to use for a collective on the given
+  // device set, rotating through the communicator pool when one is
+  // configured. See Note [NCCL communicator pool].
+  std::string pooledCommKey(const std::string& devicesKey);
+
   // Wrapper method which can be overridden for tests.
   virtual std::exception_ptr checkForNCCLErrors(
       const std::vector<std::shared_ptr<NCCLComm>>& ncclComms);
@@ -519,6 +569,17 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       std::vector<at::Tensor>& tensors,
       const AllreduceOptions& opts = AllreduceOptions());
 
+  // Allreduce for sparse COO tensors, implemented by composing dense
+  // collectives; see Note [Sparse allreduce].
+  c10::intrusive_ptr<Work> allreduceSparse(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts);
+
+  // Exchanges nonzeros so that each rank owns the entries whose leading
+  // sparse index hashes to it, and returns the locally reduced shard. Used
+  // by allreduceSparse when NCCL_SPARSE_ALLREDUCE_V2 is set.
+  at::Tensor sparseOwnerShard(const at::Tensor& input);
+
   // Checks for NCCL errors on each of the communicators and returns an
   // appropriate exception_ptr (nullptr if no errors).
   static std::exception_ptr checkForNCCLErrorsInternal(
@@ -557,6 +618,23 @@ class TORCH_API ProcessGroupNCCL : public Backend {
 
   void workCleanupLoop();
 
+  // Function that runs on completionCallbackThread_ and processes the
+  // WorkCompletion records handed over by the cudaLaunchHostFunc callbacks.
+  // See Note [NCCL completion callbacks].
+  void completionCallbackLoop();
+
+  // Launches a host function for `work` on each of its NCCL streams so its
+  // completion is signalled as soon as the kernels finish. No-op while a
+  // CUDA graph capture is active. See Note [NCCL completion callbacks].
+  void attachCompletionCallbacks(
+      const c10::intrusive_ptr<WorkNCCL>& work,
+      std::vector<at::cuda::CUDAStream>& ncclStreams,
+      size_t numDevices);
+
+  // Entry point for the cudaLaunchHostFunc callbacks; `data` is the
+  // WorkCompletion allocated by attachCompletionCallbacks.
+  static void workCompletionCallback(void* data);
+
  protected:
   static const int64_t kWatchdogThreadSleepMillis;
   static const int64_t kWorkCleanupThreadSleepMillis;
@@ -641,9 +719,52 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Vector to Store WorkNCCL pointers
   std::list<ProcessGroupNCCL::WorkNCCL> workMetaList_;
 
+  // Set under workMetaListMutex_ by the completion callback thread so that
+  // workCleanupLoop re-scans workMetaList_ as soon as a collective finishes
+  // instead of waiting out its poll interval.
+  bool completedWorkPending_ = false;
+
   // Add Work Pointer to workVector
   void workEnqueue(c10::intrusive_ptr<ProcessGroupNCCL::WorkNCCL>);
 
+  // Queue of collectives whose host functions have all fired, shared between
+  // the process group, completionCallbackThread_ and the in-flight
+  // WorkCompletion records. Held through a shared_ptr so a callback that
+  // fires during (or after) process group shutdown never touches freed
+  // memory. See Note [NCCL completion callbacks].
+  struct WorkCompletion;
+  struct CompletionQueue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<WorkCompletion*> ready;
+    bool terminated = false;
+  };
+
+  // A collective in flight with completion callbacks attached. Allocated by
+  // attachCompletionCallbacks, handed to completionCallbackThread_ by the
+  // last host function to fire, and deleted by that thread.
+  struct WorkCompletion {
+    // Keeps the user-facing work (and its stashed references) alive until
+    // the completion thread has processed it. The host function must not
+    // drop this reference itself: destroying a tensor can free device
+    // memory, and no CUDA API may be called from inside a host function.
+    c10::intrusive_ptr<WorkNCCL> work;
+    // Keeps the queue reachable for callbacks that outlive the group.
+    std::shared_ptr<CompletionQueue> queue;
+    // One host function is launched per device; only the last one to run
+    // hands this record over to the completion thread.
+    std::atomic<int> pendingCallbacks{0};
+  };
+
+  // Whether or not NCCL_COMPLETION_CALLBACKS was set
+  bool completionCallbacks_ = false;
+
+  std::shared_ptr<CompletionQueue> completionQueue_;
+
+  // Thread that drains completionQueue_; only started when
+  // NCCL_COMPLETION_CALLBACKS is set.
+  std::thread completionCallbackThread_;
+
   // The CUDA steams used by NCCL kernels
   std::unordered_map<std::string, std::vector<at::cuda::CUDAStream>>
       ncclStreams_;
@@ -660,6 +781,14 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Stores device indexes for all collectives run inside a coalescing block
   std::vector<std::vector<at::Device>> coalescedDevices_;
 
+  // Stores communicators for all collectives run inside a coalescing block
+  std::vector<std::vector<std::shared_ptr<NCCLComm>>> coalescedComms_;
+
+  // Size of the communicator pool and the per-device-set round-robin
+  // cursors; see Note [NCCL communicator pool].
+  int commPoolSize_ = 1;
+  std::unordered_map<std::string, uint64_t> commPoolCounters_;
+
   // map from the key: "group name + pg counter (ID)" to the
   // unique NCCL ID count. This needs to be group and pg specific
   //
@@ -381,9 +381,10 @@ Replaces the tensor in the bucket with the input tensor buffer.
 )");
 
   py::enum_<::c10d::BuiltinCommHookType>(module, "BuiltinCommHookType", R"(
-An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_COMPRESS``.)")
+An enum-like class for built-in communication hooks: ``ALLREDUCE``, ``FP16_COMPRESS`` and ``BF16_COMPRESS``.)")
       .value("ALLREDUCE", ::c10d::BuiltinCommHookType::ALLREDUCE)
-      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS);
+      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS)
+      .value("BF16_COMPRESS", ::c10d::BuiltinCommHookType::BF16_COMPRESS);
 
   shared_ptr_class_<::c10d::Reducer>(module, "Reducer")
       .def(
@@ -1456,6 +1457,14 @@ Arguments:
               py::arg("device_type"),
               py::arg("reqs"),
               py::call_guard<py::gil_scoped_release>())
+          .def(
+              "_end_coalescing",
+              [](const c10::intrusive_ptr<::c10d::ProcessGroup>& self,
+                 const c10::Device& device) {
+                return self->endCoalescing(device.type());
+              },
+              py::arg("device_type"),
+              py::call_guard<py::gil_scoped_release>())
           .def(
               "_register_backend",
               [](const c10::intrusive_ptr<::c10d::ProcessGroup>& self,
@@ -1813,8 +1822,15 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
               py::call_guard<py::gil_scoped_release>())
           .def(
               "_end_coalescing",
-              &::c10d::Backend::endCoalescing,
+              static_cast<void (::c10d::Backend::*)(
+                  std::vector<c10::intrusive_ptr<::c10d::Work>>&)>(
+                  &::c10d::Backend::endCoalescing),
               py::arg("reqs"),
+              py::call_guard<py::gil_scoped_release>())
+          .def(
+              "_end_coalescing",
+              static_cast<c10::intrusive_ptr<::c10d::Work> (
+                  ::c10d::Backend::*)()>(&::c10d::Backend::endCoalescing),
               py::call_guard<py::gil_scoped_release>());
 
 #ifdef USE_C10D_GLOO
@@ -1961,6 +1977,11 @@ Arguments:
             group to pick up high priority cuda streams. It lets CUDA driver
             to prioritize NCCL kernels when there are compute kernels waiting.
             Default is False.
+    comm_pool_size (int, optional): number of NCCL communicators, each with
+            its own internal stream, to round-robin independent collectives
+            across per device set, so they can run concurrently on the links.
+            Can be overridden by the ``NCCL_COMM_POOL`` environment variable.
+            Default is 1.
 
 Example::
     >>> import torch.distributed as dist
@@ -1972,7 +1993,10 @@ Example::
       .def(py::init<bool>(), py::arg("is_high_priority_stream") = false)
       .def_readwrite(
           "is_high_priority_stream",
-          &::c10d::ProcessGroupNCCL::Options::is_high_priority_stream);
+          &::c10d::ProcessGroupNCCL::Options::is_high_priority_stream)
+      .def_readwrite(
+          "comm_pool_size",
+          &::c10d::ProcessGroupNCCL::Options::comm_pool_size);
   processGroupNCCL.def_static(
       "_group_start", []() { ::c10d::ProcessGroupNCCL::groupStart(); });
   processGroupNCCL.def_static(
@@ -125,6 +125,9 @@ Reducer::Reducer(
               << bucket_bytes_cap_
               << " first_bucket_bytes_cap: " << first_bucket_bytes_cap;
   }
+
+  // See Note [DDP bucket size auto-tuning]
+  tune_bucket_caps_ = (parse_env("DDP_TUNE_BUCKET_CAP") == "1");
   // Check whether the module is multi_device_module
   {
     std::set<int> unique_devices;
@@ -1216,11 +1219,102 @@ void Reducer::populate_bucket_views_out(
 void Reducer::prepare_for_forward() {
   std::lock_guard<std::mutex> lock(mutex_);
   num_iterations_++;
+  // Sample the previous iteration's timer events before this forward
+  // overwrites them.
+  maybe_tune_bucket_sizes();
   if (should_collect_runtime_stats()) {
     record_forward_compute_start_time();
   }
 }
 
+// Note [DDP bucket size auto-tuning]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The static bucket_bytes_cap handed to the Reducer is a guess: too small a
+// cap fragments the backward into many small allreduces that each pay the
+// per-collective launch cost, while too large a cap delays bucket readiness
+// and leaves communication dangling past the end of backward compute. When
+// DDP_TUNE_BUCKET_CAP=1, the reducer samples the timer events it already
+// records for the logger over a fixed window of iterations after the first
+// bucket rebuild, compares the communication tail (backward compute end to
+// backward comm end) against the backward compute span, and makes a single
+// adjustment to bucket_bytes_cap_ before freezing:
+//  - a tail above ~5% of compute means allreduces are not overlapping well;
+//    halve the cap so buckets become ready (and kick off) earlier;
+//  - a negligible tail with many buckets means we are paying per-collective
+//    overhead for overlap headroom we do not need; double the cap.
+// The adjustment is applied by clearing has_rebuilt_bucket_ so that the
+// existing rebuild path (ready-order parameter collection,
+// sync_bucket_indices, initialize_buckets) performs the actual re-bucketing.
+// Because that path issues collective broadcasts, all ranks must take the
+// same decision at the same iteration: the tuning window is advanced by
+// iteration count (never by sample validity, which can differ across ranks)
+// and rank 0's chosen cap is broadcast before it is applied.
+void Reducer::maybe_tune_bucket_sizes() {
+  if (!tune_bucket_caps_ || bucket_tuning_done_ || !has_rebuilt_bucket_ ||
+      timer_ == nullptr) {
+    return;
+  }
+
+  constexpr int64_t kBucketTuneWindow = 10;
+  constexpr int64_t kMinBucketBytesCap = int64_t(1024) * 1024;
+  constexpr int64_t kMaxBucketBytesCap = int64_t(1024) * 1024 * 1024;
+
+  bucket_tune_iterations_++;
+  auto compute_time = timer_->measureDifference(
+      Timer::Event::kBackwardComputeStart, Timer::Event::kBackwardComputeEnd);
+  auto comm_tail_time = timer_->measureDifference(
+      Timer::Event::kBackwardComputeEnd, Timer::Event::kBackwardCommEnd);
+  if (compute_time && comm_tail_time && *compute_time > 0) {
+    bucket_tune_valid_samples_++;
+    accumulated_backward_compute_time_ += *compute_time;
+    accumulated_comm_tail_time_ += *comm_tail_time;
+  }
+  if (bucket_tune_iterations_ < kBucketTuneWindow) {
+    return;
+  }
+  bucket_tuning_done_ = true;
+
+  int64_t new_cap = bucket_bytes_cap_;
+  if (bucket_tune_valid_samples_ > 0) {
+    const auto avg_compute =
+        accumulated_backward_compute_time_ / bucket_tune_valid_samples_;
+    const auto avg_tail =
+        accumulated_comm_tail_time_ / bucket_tune_valid_samples_;
+    if (avg_tail * 20 > avg_compute) {
+      new_cap = std::max(kMinBucketBytesCap, bucket_bytes_cap_ / 2);
+    } else if (avg_tail * 100 < avg_compute && buckets_.size() > 4) {
+      new_cap = std::min(kMaxBucketBytesCap, bucket_bytes_cap_ * 2);
+    }
+  }
+
+  // Rank 0 decides for everyone. Timer readings differ across ranks, and the
+  // rebuild below broadcasts bucket assignments collectively, so applying
+  // divergent caps would hang. Copy through a device tensor as the
+  // process_group_ could be NCCL and it can only broadcast device tensors.
+  at::TensorOptions options;
+  options = options.dtype(at::kLong);
+  options = options.device(params_[0].device());
+  auto cap_tensor = at::empty({1}, at::kLong);
+  cap_tensor.fill_(new_cap);
+  auto cap_tensor_device = at::empty({1}, options);
+  cap_tensor_device.copy_(cap_tensor, /*non_blocking=*/true);
+  std::vector<at::Tensor> cap_tensor_list = {cap_tensor_device};
+  process_group_->broadcast(cap_tensor_list)->wait();
+  cap_tensor.copy_(cap_tensor_list.front(), /*non_blocking=*/false);
+  new_cap = cap_tensor.item<int64_t>();
+
+  if (new_cap == bucket_bytes_cap_) {
+    return;
+  }
+  LOG(INFO) << "Retuning DDP bucket_bytes_cap from " << bucket_bytes_cap_
+            << " to " << new_cap
+            << " based on observed backward compute/communication overlap.";
+  bucket_bytes_cap_ = new_cap;
+  // Let the next backward collect parameters in ready order again so that the
+  // rebuild path re-buckets with the new cap.
+  has_rebuilt_bucket_ = false;
+}
+
 void Reducer::reset_bucket_counting() {
   next_bucket_ = 0;
   // Reset num_buckets_ready_ at the beginning of backward computation
@@ -1781,6 +1875,10 @@ void Reducer::register_builtin_comm_hook(
       comm_hook_ = std::make_unique<c10d::FP16CompressCommHook>(process_group_);
       LOG(INFO) << "Built-in communication hook FP16_COMPRESS is registered.";
       break;
+    case c10d::BuiltinCommHookType::BF16_COMPRESS:
+      comm_hook_ = std::make_unique<c10d::BF16CompressCommHook>(process_group_);
+      LOG(INFO) << "Built-in communication hook BF16_COMPRESS is registered.";
+      break;
     default:
       TORCH_WARN_ONCE(
           "Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
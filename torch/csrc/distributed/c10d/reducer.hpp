@@ -421,7 +421,24 @@ class TORCH_API Reducer {
   bool has_rebuilt_bucket_;
   std::vector<at::Tensor> rebuilt_params_;
   std::vector<int64_t> rebuilt_param_indices_;
-  const int64_t bucket_bytes_cap_;
+  // May be adjusted once at runtime when DDP_TUNE_BUCKET_CAP=1; see
+  // Note [DDP bucket size auto-tuning] in reducer.cpp.
+  int64_t bucket_bytes_cap_;
+
+  // State for the one-shot bucket size controller; see
+  // Note [DDP bucket size auto-tuning] in reducer.cpp.
+  bool tune_bucket_caps_ = false;
+  bool bucket_tuning_done_ = false;
+  int64_t bucket_tune_iterations_ = 0;
+  int64_t bucket_tune_valid_samples_ = 0;
+  int64_t accumulated_backward_compute_time_ = 0;
+  int64_t accumulated_comm_tail_time_ = 0;
+
+  // Samples the overlap between backward compute and gradient communication
+  // for the previous iteration and, once per training run, adjusts
+  // bucket_bytes_cap_ and schedules a bucket rebuild. Called with mutex_ held
+  // from prepare_for_forward(). See Note [DDP bucket size auto-tuning].
+  void maybe_tune_bucket_sizes();
 
 #ifndef _WIN32
   struct RpcContext {
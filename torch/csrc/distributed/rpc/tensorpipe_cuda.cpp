@@ -3,6 +3,8 @@
 
 #if defined(USE_TENSORPIPE) && !defined(USE_ROCM)
 
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CachingHostAllocator.h>
 #include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAGuard.h>
 #include <c10/cuda/CUDAStream.h>
@@ -123,6 +125,25 @@ class TensorpipeCudaConverter : public TensorpipeDeviceTypeConverter {
 
 C10_REGISTER_TENSORPIPE_DEVICE_TYPE_CONVERTER(CUDA, TensorpipeCudaConverter);
 
+// Lands host-destined receive buffers in the caching host allocator's pinned
+// pool (falling back to pageable memory if no GPU is actually present at
+// runtime). The pool recycles page-locked blocks across receives, so the
+// cudaHostAlloc cost is paid once per buffer size, not per message.
+at::DataPtr allocatePinnedReceiveBuffer(size_t length) {
+  if (!at::cuda::is_available()) {
+    return at::getCPUAllocator()->allocate(length);
+  }
+  return at::cuda::getCachingHostAllocator()->allocate(length);
+}
+
+struct PinnedReceiveBufferRegistrar {
+  PinnedReceiveBufferRegistrar() {
+    setCpuReceiveBufferAllocator(&allocatePinnedReceiveBuffer);
+  }
+};
+
+PinnedReceiveBufferRegistrar g_pinned_receive_buffer_registrar;
+
 } // namespace
 } // namespace rpc
 } // namespace distributed
@@ -15,6 +15,14 @@ namespace {
 // payloads. This allows the agent to provide the data to TensorPipe without
 // performing a copy into a single contiguous buffer, and without storing it as
 // metadata, which is less efficient.
+//
+// In other words the write path is a single gather at the transport: the
+// message type/id, the (moved) pickled payload, the tensor-table pickle and
+// the tensor storages all reach TensorPipe as pointers into buffers we
+// already own (see TensorpipeWriteBuffers, which keeps them alive until the
+// write callback fires). The only payload that is ever copied here is a
+// storage without a deleter (torch::from_blob), whose lifetime we cannot
+// extend by reference counting.
 
 // First come the rpc::Message::type() and ::id().
 constexpr int kTpMessageTypeIdx = 0;
@@ -73,9 +81,19 @@ class TensorpipeCpuConverter : public TensorpipeDeviceTypeConverter {
   at::DataPtr allocateTensorForReceiving(
       int /* deviceIndex */,
       size_t length,
-      const std::vector<c10::Stream>& /* streams */,
+      const std::vector<c10::Stream>& streams,
       tensorpipe::Allocation& allocation) const override {
-    at::DataPtr dataPtr = at::getCPUAllocator()->allocate(length);
+    // A non-empty stream list means this agent manages accelerator devices;
+    // land host-destined payloads in pinned memory so a later non-blocking
+    // host-to-device copy of the received tensor doesn't have to stage
+    // through pageable memory. CPU-only agents keep the plain allocator.
+    at::DataPtr dataPtr;
+    CpuReceiveBufferAllocator pinnedAllocator = getCpuReceiveBufferAllocator();
+    if (pinnedAllocator != nullptr && !streams.empty()) {
+      dataPtr = pinnedAllocator(length);
+    } else {
+      dataPtr = at::getCPUAllocator()->allocate(length);
+    }
 
     tensorpipe::CpuBuffer buffer;
     buffer.ptr = dataPtr.get();
@@ -121,6 +139,20 @@ std::array<
     static_cast<size_t>(DeviceType::COMPILE_TIME_MAX_DEVICE_TYPES)>
     device_type_converter_registry;
 
+namespace {
+
+std::atomic<CpuReceiveBufferAllocator> cpu_receive_buffer_allocator{nullptr};
+
+} // namespace
+
+void setCpuReceiveBufferAllocator(CpuReceiveBufferAllocator allocator) {
+  cpu_receive_buffer_allocator.store(allocator);
+}
+
+CpuReceiveBufferAllocator getCpuReceiveBufferAllocator() {
+  return cpu_receive_buffer_allocator.load();
+}
+
 TensorpipeDeviceTypeConverterRegistrar::TensorpipeDeviceTypeConverterRegistrar(
     DeviceType type,
     const TensorpipeDeviceTypeConverter* impl) {
@@ -134,6 +166,8 @@ std::tuple<tensorpipe::Message, TensorpipeWriteBuffers> tensorpipeSerialize(
   tensorpipe::Message tpMessage;
   TensorpipeWriteBuffers buffers;
 
+  tpMessage.payloads.reserve(4);
+
   // Metadata
   buffers.type = std::make_unique<MessageType>(rpcMessage->type());
   buffers.id = std::make_unique<int64_t>(rpcMessage->id());
@@ -163,6 +197,10 @@ std::tuple<tensorpipe::Message, TensorpipeWriteBuffers> tensorpipeSerialize(
     buffers.tensors = cloneSparseTensors(rpcMessage->tensors()).vec();
   }
 
+  // This pickle only carries the tensor table (metadata); the tensor payloads
+  // themselves are handed to the transport by reference below. Presize the
+  // buffer so the pickler's flushes don't trigger a cascade of reallocations.
+  buffers.pickle.reserve(64 + 64 * buffers.tensors.size());
   torch::jit::Pickler pickler([&](const void* buf, size_t sz) -> size_t {
     buffers.pickle.insert(
         buffers.pickle.end(),
@@ -18,6 +18,16 @@ TORCH_API const c10::Stream& getStreamForDevice(
     const std::vector<c10::Stream>& streams,
     const c10::Device& device);
 
+// Optional hook for allocating CPU receive buffers out of a pinned-memory
+// pool. The CUDA side installs it at load time (see tensorpipe_cuda.cpp) so
+// that, on agents which also manage CUDA devices, host-destined payloads land
+// directly in page-locked storage: the channel can DMA into the buffer and a
+// later non-blocking host-to-device copy of the received tensor stays
+// asynchronous, instead of staging through pageable memory.
+using CpuReceiveBufferAllocator = at::DataPtr (*)(size_t length);
+TORCH_API void setCpuReceiveBufferAllocator(CpuReceiveBufferAllocator allocator);
+TORCH_API CpuReceiveBufferAllocator getCpuReceiveBufferAllocator();
+
 // Inspired by c10/core/impl/DeviceGuardImplInterface.h.
 
 class TensorpipeDeviceTypeConverter {
@@ -318,6 +318,259 @@ static PyTypeObject TensorGuardsType = {
     // NOLINTNEXTLINE
     PyVarObject_HEAD_INIT(NULL, 0)};
 
+// GuardProgram evaluates a flat list of guard clauses without entering the
+// interpreter. Each clause is a short instruction sequence that walks from a
+// root object (an argument of check()) through attribute/item accesses to a
+// terminal CHECK_* predicate; the first failing clause short-circuits the
+// whole check. Compilation from guard code strings happens on the Python
+// side, see torch/_dynamo/guards.py. Tensor guards keep going through
+// TensorGuards above, which is already a single C call.
+//
+// Clauses are kept in a self-organizing order: whenever a clause fails and
+// has failed more often than the clause evaluated just before it, the two
+// swap places. Frequently failing guards thus migrate to the front, so the
+// common "recompile needed" case exits as early as possible.
+
+enum GuardOpcode {
+  GUARD_OP_LOAD_ROOT = 0, // num: index into the check() argument tuple
+  GUARD_OP_GETATTR = 1, // obj: attribute name
+  GUARD_OP_GETITEM = 2, // obj: key
+  GUARD_OP_CHECK_TYPE_ID = 3, // num: id(type(value))
+  GUARD_OP_CHECK_OBJ_ID = 4, // num: id(value)
+  GUARD_OP_CHECK_DICT_VERSION = 5, // num: expected ma_version_tag
+  GUARD_OP_CHECK_GRAD_MODE = 6, // num: expected grad mode
+};
+
+struct GuardInstruction {
+  int opcode;
+  uint64_t num; // numeric immediate
+  PyObject* obj; // owned reference, may be NULL
+};
+
+struct GuardClause {
+  std::vector<GuardInstruction> insts;
+  uint64_t failures = 0;
+};
+
+struct GuardProgramImpl {
+  std::vector<GuardClause> clauses;
+  // evaluation order, indices into clauses
+  std::vector<size_t> order;
+};
+
+typedef struct {
+  PyObject_HEAD;
+  GuardProgramImpl* program;
+} GuardProgram;
+
+static void GuardProgram_dealloc(GuardProgram* self) {
+  if (self->program != NULL) {
+    for (auto& clause : self->program->clauses) {
+      for (auto& inst : clause.insts) {
+        Py_XDECREF(inst.obj);
+      }
+    }
+    delete self->program;
+    self->program = NULL;
+  }
+  Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyObject* GuardProgram_new(
+    PyTypeObject* type,
+    PyObject* args,
+    PyObject* kwds) {
+  GuardProgram* self = (GuardProgram*)type->tp_alloc(type, 0);
+  if (self != NULL) {
+    self->program = new GuardProgramImpl();
+  }
+  return (PyObject*)self;
+}
+
+static int GuardProgram_init(
+    GuardProgram* self,
+    PyObject* args,
+    PyObject* kwds) {
+  PyObject* clauses_py;
+  if (!PyArg_ParseTuple(args, "O", &clauses_py)) {
+    return -1;
+  }
+  if (!PyList_Check(clauses_py)) {
+    PyErr_SetString(PyExc_TypeError, "expected list of clauses");
+    return -1;
+  }
+  auto& program = *self->program;
+  auto num_clauses = PyList_GET_SIZE(clauses_py);
+  program.clauses.reserve(num_clauses);
+  program.order.reserve(num_clauses);
+  for (auto i : c10::irange(num_clauses)) {
+    PyObject* clause_py = PyList_GET_ITEM(clauses_py, i);
+    if (!PyList_Check(clause_py) || PyList_GET_SIZE(clause_py) == 0) {
+      PyErr_SetString(PyExc_TypeError, "expected non-empty instruction list");
+      return -1;
+    }
+    GuardClause clause;
+    auto num_insts = PyList_GET_SIZE(clause_py);
+    clause.insts.reserve(num_insts);
+    bool clause_ok = true;
+    for (auto j : c10::irange(num_insts)) {
+      PyObject* inst_py = PyList_GET_ITEM(clause_py, j);
+      if (!PyTuple_Check(inst_py) || PyTuple_GET_SIZE(inst_py) != 2) {
+        PyErr_SetString(PyExc_TypeError, "expected (opcode, arg) tuple");
+        clause_ok = false;
+        break;
+      }
+      GuardInstruction inst = {};
+      inst.opcode = (int)PyLong_AsLong(PyTuple_GET_ITEM(inst_py, 0));
+      PyObject* arg = PyTuple_GET_ITEM(inst_py, 1);
+      switch (inst.opcode) {
+        case GUARD_OP_GETATTR:
+          if (!PyUnicode_Check(arg)) {
+            PyErr_SetString(PyExc_TypeError, "GETATTR expects a string");
+            clause_ok = false;
+            break;
+          }
+          // fallthrough
+        case GUARD_OP_GETITEM:
+          Py_INCREF(arg);
+          inst.obj = arg;
+          break;
+        case GUARD_OP_LOAD_ROOT:
+        case GUARD_OP_CHECK_TYPE_ID:
+        case GUARD_OP_CHECK_OBJ_ID:
+        case GUARD_OP_CHECK_DICT_VERSION:
+        case GUARD_OP_CHECK_GRAD_MODE:
+          inst.num = PyLong_AsUnsignedLongLong(arg);
+          if (inst.num == (uint64_t)-1 && PyErr_Occurred()) {
+            clause_ok = false;
+          }
+          break;
+        default:
+          PyErr_SetString(PyExc_TypeError, "unknown guard opcode");
+          clause_ok = false;
+          break;
+      }
+      if (!clause_ok) {
+        break;
+      }
+      clause.insts.emplace_back(inst);
+    }
+    if (clause_ok && clause.insts.back().opcode < GUARD_OP_CHECK_TYPE_ID) {
+      PyErr_SetString(PyExc_TypeError, "clause must end with a CHECK_* op");
+      clause_ok = false;
+    }
+    if (!clause_ok) {
+      // hand the partially built clause to dealloc so the owned
+      // instruction references are released
+      program.clauses.emplace_back(std::move(clause));
+      return -1;
+    }
+    program.order.emplace_back(program.clauses.size());
+    program.clauses.emplace_back(std::move(clause));
+  }
+  return 0;
+}
+
+PyObject* GuardProgram_check(GuardProgram* self, PyObject* args) {
+  auto& program = *self->program;
+  bool grad_mode_enabled = at::GradMode::is_enabled();
+  auto num_roots = PyTuple_GET_SIZE(args);
+  for (size_t pos = 0; pos < program.order.size(); ++pos) {
+    GuardClause& clause = program.clauses[program.order[pos]];
+    PyObject* value = NULL; // strong reference to the current value
+    bool ok = true;
+    for (auto& inst : clause.insts) {
+      switch (inst.opcode) {
+        case GUARD_OP_LOAD_ROOT:
+          if (inst.num >= (uint64_t)num_roots) {
+            Py_XDECREF(value);
+            PyErr_SetString(PyExc_IndexError, "guard root index out of range");
+            return NULL;
+          }
+          Py_XDECREF(value);
+          value = PyTuple_GET_ITEM(args, inst.num);
+          Py_INCREF(value);
+          break;
+        case GUARD_OP_GETATTR: {
+          PyObject* next = PyObject_GetAttr(value, inst.obj);
+          Py_DECREF(value);
+          if (next == NULL) {
+            return NULL;
+          }
+          value = next;
+          break;
+        }
+        case GUARD_OP_GETITEM: {
+          PyObject* next = PyObject_GetItem(value, inst.obj);
+          Py_DECREF(value);
+          if (next == NULL) {
+            return NULL;
+          }
+          value = next;
+          break;
+        }
+        case GUARD_OP_CHECK_TYPE_ID:
+          ok = Py_TYPE(value) == (void*)inst.num;
+          break;
+        case GUARD_OP_CHECK_OBJ_ID:
+          ok = value == (void*)inst.num;
+          break;
+        case GUARD_OP_CHECK_DICT_VERSION:
+          ok = PyDict_Check(value) &&
+              ((PyDictObject*)value)->ma_version_tag == inst.num;
+          break;
+        case GUARD_OP_CHECK_GRAD_MODE:
+          ok = grad_mode_enabled == (bool)inst.num;
+          break;
+      }
+      if (!ok) {
+        break;
+      }
+    }
+    Py_XDECREF(value);
+    if (!ok) {
+      clause.failures++;
+      if (pos > 0 &&
+          clause.failures > program.clauses[program.order[pos - 1]].failures) {
+        std::swap(program.order[pos], program.order[pos - 1]);
+      }
+      Py_RETURN_FALSE;
+    }
+  }
+  Py_RETURN_TRUE;
+}
+
+PyObject* GuardProgram_fail_counts(GuardProgram* self, PyObject* args) {
+  // failure counts in original clause order, for debugging/introspection
+  auto& clauses = self->program->clauses;
+  PyObject* result = PyList_New(clauses.size());
+  if (result == NULL) {
+    return NULL;
+  }
+  for (size_t i = 0; i < clauses.size(); ++i) {
+    PyObject* count = PyLong_FromUnsignedLongLong(clauses[i].failures);
+    if (count == NULL) {
+      Py_DECREF(result);
+      return NULL;
+    }
+    PyList_SET_ITEM(result, i, count);
+  }
+  return result;
+}
+
+static PyMethodDef GuardProgram_methods[] = {
+    {"check", (PyCFunction)GuardProgram_check, METH_VARARGS, ""},
+    {"fail_counts",
+     (PyCFunction)GuardProgram_fail_counts,
+     METH_NOARGS,
+     "per-clause failure counts, in construction order"},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject GuardProgramType = {
+    // NOLINTNEXTLINE
+    PyVarObject_HEAD_INIT(NULL, 0)};
+
 static PyObject* check_type_id(PyObject* dummy, PyObject* args) {
   // faster `lambda obj, expected: id(type(obj)) == expected`
   PyObject* obj;
@@ -389,10 +642,24 @@ static PyObject* assert_size_stride(PyObject* dummy, PyObject* args) {
   Py_RETURN_TRUE;
 }
 
+static PyObject* dict_version(PyObject* dummy, PyObject* args) {
+  // the version tag of a dict, for GUARD_OP_CHECK_DICT_VERSION guards
+  PyObject* obj;
+  if (!PyArg_ParseTuple(args, "O", &obj)) {
+    return NULL;
+  }
+  if (!PyDict_Check(obj)) {
+    PyErr_SetString(PyExc_TypeError, "expected dict()");
+    return NULL;
+  }
+  return THPUtils_packUInt64(((PyDictObject*)obj)->ma_version_tag);
+}
+
 static PyMethodDef _methods[] = {
     {"check_type_id", check_type_id, METH_VARARGS, NULL},
     {"check_obj_id", check_obj_id, METH_VARARGS, NULL},
     {"assert_size_stride", assert_size_stride, METH_VARARGS, NULL},
+    {"dict_version", dict_version, METH_VARARGS, NULL},
     {NULL, NULL, 0, NULL}};
 
 static struct PyModuleDef _module = {
@@ -431,5 +698,44 @@ PyObject* torch_c_dynamo_guards_init() {
     return NULL;
   }
 
+  // initialize GuardProgramType
+  GuardProgramType.tp_name = "torch._C._dynamo.guards.GuardProgram";
+  GuardProgramType.tp_basicsize = sizeof(GuardProgram);
+  GuardProgramType.tp_itemsize = 0;
+  GuardProgramType.tp_dealloc = (destructor)GuardProgram_dealloc;
+  GuardProgramType.tp_flags = Py_TPFLAGS_DEFAULT;
+  GuardProgramType.tp_doc = "Evaluate compiled guard clauses in C++";
+  GuardProgramType.tp_methods = GuardProgram_methods;
+  GuardProgramType.tp_init = (initproc)GuardProgram_init;
+  GuardProgramType.tp_new = GuardProgram_new;
+
+  if (PyType_Ready(&GuardProgramType) < 0) {
+    Py_DECREF(m);
+    return NULL;
+  }
+
+  Py_INCREF(&GuardProgramType);
+  if (PyModule_AddObject(m, "GuardProgram", (PyObject*)&GuardProgramType) < 0) {
+    Py_DECREF(&GuardProgramType);
+    Py_DECREF(m);
+    return NULL;
+  }
+
+  // opcode constants used by the Python-side guard lowering
+  if (PyModule_AddIntConstant(m, "OP_LOAD_ROOT", GUARD_OP_LOAD_ROOT) < 0 ||
+      PyModule_AddIntConstant(m, "OP_GETATTR", GUARD_OP_GETATTR) < 0 ||
+      PyModule_AddIntConstant(m, "OP_GETITEM", GUARD_OP_GETITEM) < 0 ||
+      PyModule_AddIntConstant(m, "OP_CHECK_TYPE_ID", GUARD_OP_CHECK_TYPE_ID) <
+          0 ||
+      PyModule_AddIntConstant(m, "OP_CHECK_OBJ_ID", GUARD_OP_CHECK_OBJ_ID) <
+          0 ||
+      PyModule_AddIntConstant(
+          m, "OP_CHECK_DICT_VERSION", GUARD_OP_CHECK_DICT_VERSION) < 0 ||
+      PyModule_AddIntConstant(
+          m, "OP_CHECK_GRAD_MODE", GUARD_OP_CHECK_GRAD_MODE) < 0) {
+    Py_DECREF(m);
+    return NULL;
+  }
+
   return m;
 }
@@ -389,4 +389,10 @@ OperatorName parseName(const std::string& name) {
   return std::move(parsed.left());
 }
 
+OperatorName parseSchemaName(const std::string& schema) {
+  // Only lexes the leading qualified name (and overload name, if any) of
+  // the declaration; the argument list is never touched.
+  return SchemaParser(schema).parseName();
+}
+
 } // namespace torch::jit
@@ -12,6 +12,10 @@ TORCH_API c10::either<c10::OperatorName, c10::FunctionSchema> parseSchemaOrName(
     const std::string& schemaOrName);
 TORCH_API c10::FunctionSchema parseSchema(const std::string& schema);
 TORCH_API c10::OperatorName parseName(const std::string& name);
+// Extracts just the operator name from a full schema declaration. This is
+// much cheaper than parseSchema when only the name is needed, e.g. for
+// registry bookkeeping, because the argument list is never parsed.
+TORCH_API c10::OperatorName parseSchemaName(const std::string& schema);
 
 } // namespace jit
 } // namespace torch
@@ -671,6 +671,9 @@ void AliasDb::analyzeImpl(Node* node) {
     case prim::FusedConcat:
     case prim::MMTreeReduce:
     case prim::MMBatchSide:
+    // MemoizedSubgraph only takes non-aliasing scalar inputs and its cached
+    // outputs are copied on reuse, so its outputs are fresh values
+    case prim::MemoizedSubgraph:
     case prim::BroadcastSizes:
     case prim::ChunkSizes:
     // this should never be seen outside of initial compilation
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <ATen/core/ivalue.h>
@@ -21,7 +22,14 @@ struct Code {
   std::vector<DebugHandle> debug_handles_;
   std::vector<c10::OperatorName> op_names_;
   std::vector<int> operator_input_sizes_;
-  std::vector<std::function<void(Stack&)>> operators_;
+  // Resolved operator table. Immutable once published: it is built off to
+  // the side and installed wholesale with an atomic pointer swap (see
+  // Function::initialize_operators), so interpreter threads either observe
+  // the complete table or none at all, and never block on a loader thread
+  // that is still resolving operators for a freshly swapped-in module.
+  // A null pointer means the operators haven't been (successfully)
+  // resolved yet.
+  std::shared_ptr<const std::vector<std::function<void(Stack&)>>> operators_;
   std::vector<c10::IValue> constants_;
   std::vector<c10::TypePtr> types_;
   // TODO After we actually export CALL instructions we can remove this.
@@ -30,8 +38,11 @@ struct Code {
   // be done in parseMethods().
   std::vector<mobile::Function*> functions_;
   size_t register_size_ = 0; // Aggregated output size.
-  // initialized means operators_ array is filled with operators
-  bool initialized = false;
+  // High-water mark of the interpreter value stack observed while running
+  // this code unit (including any nested CALLs, which share the stack).
+  // It is 0 until the first run and is used by Function::run() to reserve
+  // the stack up front so that steady-state runs never reallocate it.
+  size_t stack_size_hint_ = 0;
 };
 
 } // namespace mobile
@@ -124,6 +124,10 @@ class FlatbufferLoader final {
     should_copy_tensor_memory_ = should_copy_tensor_memory;
   }
 
+  void setShouldLoadOperators(bool should_load_operators) {
+    should_load_operators_ = should_load_operators;
+  }
+
   std::shared_ptr<mobile::CompilationUnit> mcu_;
   std::shared_ptr<CompilationUnit> cu_;
 
@@ -150,6 +154,7 @@ class FlatbufferLoader final {
   mobile::serialization::Module* module_ = nullptr;
   bool module_parsed_ = false;
   bool should_copy_tensor_memory_ = false;
+  bool should_load_operators_ = true;
   // 0 -> mobile_ivalue_size_ elements are from the mobile module.
   uint32_t mobile_ivalue_size_ = 0;
 };
@@ -360,7 +365,13 @@ std::unique_ptr<mobile::Function> FlatbufferLoader::parseFunction(
         op->name()->str(), op->overload_name()->str(), num_args);
   }
 
-  function->initialize_operators(true);
+  // Resolving operators dominates method parse time. When operator loading
+  // is deferred, Function::run() performs the resolution (including the
+  // missing-operator check) the first time the method is called, so methods
+  // that are never invoked pay nothing.
+  if (should_load_operators_) {
+    function->initialize_operators(true);
+  }
 
   for (const auto i : *method->type_annotations()) {
     function->append_type(getOrCreateTypeAnnotations(i));
@@ -746,7 +757,8 @@ mobile::Module parse_and_initialize_mobile_module(
     size_t,
     c10::optional<at::Device>,
     ExtraFilesMap* extra_files,
-    bool should_copy_tensor_memory) {
+    bool should_copy_tensor_memory,
+    bool should_load_operators) {
   TORCH_CHECK(
       mobile::serialization::ModuleBufferHasIdentifier(data), "Format error");
   // TODO(T128189662): If not copying, enforce that data is aligned to
@@ -754,6 +766,7 @@ mobile::Module parse_and_initialize_mobile_module(
 
   FlatbufferLoader loader;
   loader.setShouldCopyTensorMemory(should_copy_tensor_memory);
+  loader.setShouldLoadOperators(should_load_operators);
 
   // Flatbuffer doesn't seem to have a way to provide the buffer size when
   // interacting with the buffer.
@@ -769,13 +782,15 @@ mobile::Module parse_and_initialize_mobile_module(
     std::shared_ptr<char> data,
     size_t size,
     c10::optional<at::Device> device,
-    ExtraFilesMap* extra_files) {
+    ExtraFilesMap* extra_files,
+    bool should_load_operators) {
   mobile::Module m = parse_and_initialize_mobile_module(
       data.get(),
       size,
       device,
       extra_files,
-      /*should_copy_tensor_memory=*/false);
+      /*should_copy_tensor_memory=*/false,
+      should_load_operators);
   m.set_delete_memory(std::move(data));
   return m;
 }
@@ -55,12 +55,20 @@ using ExtraFilesMap = std::unordered_map<std::string, std::string>;
 // that points inside of `data`; the caller will need to make sure that `data`
 // outlives the returned Module. Also, `data` must be aligned to
 // kFlatbufferDataAlignmentBytes.
+//
+// If should_load_operators is false, operator resolution for each method is
+// deferred until the method is first called. This shortens cold start for
+// modules with many methods when only a subset (typically `forward`) is ever
+// invoked, at the cost of surfacing missing-operator errors on first call
+// instead of at load time. Methods must then not be called for the first time
+// from multiple threads concurrently.
 TORCH_API mobile::Module parse_and_initialize_mobile_module(
     void* data,
     size_t size, // of `data`, in bytes.
     c10::optional<at::Device> device = c10::nullopt,
     ExtraFilesMap* extra_files = nullptr,
-    bool should_copy_tensor_memory = false);
+    bool should_copy_tensor_memory = false,
+    bool should_load_operators = true);
 
 // Parse a mobile::Module from raw bytes.
 //
@@ -71,11 +79,14 @@ TORCH_API mobile::Module parse_and_initialize_mobile_module(
 //
 // If you do not want the Module to hold a reference to `data`, see the raw
 // pointer overload of this function.
+//
+// See the raw pointer overload for the meaning of should_load_operators.
 TORCH_API mobile::Module parse_and_initialize_mobile_module(
     std::shared_ptr<char> data,
     size_t size, // of `data`, in bytes.
     c10::optional<at::Device> device = c10::nullopt,
-    ExtraFilesMap* extra_files = nullptr);
+    ExtraFilesMap* extra_files = nullptr,
+    bool should_load_operators = true);
 
 // Parse a mobile::Module from raw bytes, also returning JIT-related metadata.
 //
@@ -127,7 +138,8 @@ TORCH_API mobile::Module parse_and_initialize_mobile_module(
     size_t,
     c10::optional<at::Device>,
     ExtraFilesMap* extra_files,
-    bool should_copy_tensor_memory);
+    bool should_copy_tensor_memory,
+    bool should_load_operators);
 
 // no op, TODO(qihan) delete
 TORCH_API bool register_flatbuffer_loader();
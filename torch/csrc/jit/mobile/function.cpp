@@ -62,11 +62,15 @@ std::string operator_str(const c10::OperatorName& opname) {
 }
 
 bool Function::initialize_operators(bool should_check_operators) {
-  if (code_.initialized) {
+  // Fast path for inference threads: a published table is immutable, so a
+  // single acquire load is all the synchronization they ever need -- no lock
+  // is shared with loader threads resolving some other module's operators.
+  if (std::atomic_load(&code_.operators_) != nullptr) {
     return true;
   }
   std::unordered_set<std::string> unsupported_op_names;
-  code_.operators_.resize(code_.op_names_.size());
+  auto operators = std::make_shared<std::vector<std::function<void(Stack&)>>>(
+      code_.op_names_.size());
   bool all_ops_supported = true;
   for (int i = 0; i < code_.op_names_.size(); i++) {
     const auto& opname = code_.op_names_[i];
@@ -78,7 +82,7 @@ bool Function::initialize_operators(bool should_check_operators) {
       unsupported_op_names.insert(operator_str(opname));
       all_ops_supported = false;
     } else {
-      code_.operators_[i] = *func;
+      (*operators)[i] = *func;
     }
   }
   if (should_check_operators) {
@@ -88,7 +92,17 @@ bool Function::initialize_operators(bool should_check_operators) {
         c10::Join(", ", unsupported_op_names),
         "]. Please check if the operator library is included in the build. If built with selected ops, check if these ops are in the list. If you are a Meta employee, please see fburl.com/missing_ops for a fix. Or post it in https://discuss.pytorch.org/c/mobile/");
   }
-  code_.initialized = all_ops_supported;
+  if (all_ops_supported) {
+    // Publish the complete table. Concurrent initializers built identical
+    // tables; the first swap wins and the losers just drop theirs.
+    std::shared_ptr<const std::vector<std::function<void(Stack&)>>> expected =
+        nullptr;
+    std::atomic_compare_exchange_strong(
+        &code_.operators_,
+        &expected,
+        std::shared_ptr<const std::vector<std::function<void(Stack&)>>>(
+            std::move(operators)));
+  }
   return all_ops_supported;
 }
 
@@ -134,8 +148,16 @@ void Function::run(Stack& stack) {
     getSchema().checkAndNormalizeInputs<c10::DynamicType>(
         stack, std::unordered_map<std::string, IValue>{} /*kwargs*/);
   }
+  // The interpreter pushes and pops IValues on `stack` on every instruction;
+  // reserving the depth observed on previous runs means steady-state
+  // inference never reallocates the stack. The first run still grows it
+  // geometrically and records the resulting capacity as the hint.
+  stack.reserve(code_.stack_size_hint_);
   InterpreterState interp_state(code_);
   interp_state.run(stack);
+  if (stack.capacity() > code_.stack_size_hint_) {
+    code_.stack_size_hint_ = stack.capacity();
+  }
 }
 
 at::IValue Function::operator()(Stack& stack) {
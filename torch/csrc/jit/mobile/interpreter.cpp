@@ -131,14 +131,14 @@ bool InterpreterState::run(Stack& stack) {
 
           RECORD_EDGE_SCOPE_WITH_DEBUG_HANDLE_AND_INPUTS(
               code.op_names_[inst.X].name, debug_handle, stack);
-          code.operators_[inst.X](stack);
+          (*code.operators_)[inst.X](stack);
           frame.step();
         } break;
         case OPN: {
           stack.emplace_back(inst.N);
           RECORD_EDGE_SCOPE_WITH_DEBUG_HANDLE_AND_INPUTS(
               code.op_names_[inst.X].name, debug_handle, stack);
-          code.operators_[inst.X](stack);
+          (*code.operators_)[inst.X](stack);
           frame.step();
         } break;
         case CALL: {
@@ -5,10 +5,14 @@
 #include <torch/csrc/jit/passes/frozen_conv_folding.h>
 #include <torch/csrc/jit/passes/frozen_graph_optimizations.h>
 #include <torch/csrc/jit/passes/frozen_linear_folding.h>
+#include <torch/csrc/jit/passes/memoize_frozen_subgraphs.h>
 #include <torch/csrc/jit/passes/remove_dropout.h>
 #include <torch/csrc/jit/runtime/graph_executor.h>
 #include <torch/csrc/utils/memory.h>
 
+#include <cstdlib>
+#include <cstring>
+
 namespace torch {
 namespace jit {
 
@@ -28,6 +32,13 @@ void OptimizeFrozenGraph(
       changed |= FoldFrozenLinearBatchnorm(graph);
     } while (changed);
   }
+  // opt-in: cached subgraph outputs are shared across calls, which is only
+  // sound when the frozen module is used for read-only inference
+  static const char* memoize_enabled =
+      std::getenv("TORCH_JIT_MEMOIZE_FROZEN_SUBGRAPHS");
+  if (memoize_enabled && std::strcmp(memoize_enabled, "0") != 0) {
+    MemoizeFrozenSubgraphs(graph);
+  }
 }
 
 } // namespace jit
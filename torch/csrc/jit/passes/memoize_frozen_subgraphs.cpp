@@ -0,0 +1,351 @@
+#include <torch/csrc/jit/passes/memoize_frozen_subgraphs.h>
+
+#include <c10/util/hash.h>
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+#include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+#include <torch/csrc/jit/runtime/custom_operator.h>
+#include <torch/csrc/jit/runtime/interpreter.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Minimum number of non-constant nodes for a subgraph to be worth a cache
+// lookup. Single nodes with scalar-only inputs are cheap enough that
+// memoization overhead isn't worth it.
+constexpr size_t kMinSubgraphSize = 2;
+
+// Maximum number of distinct input-value keys cached per subgraph. Models
+// with unbounded dynamic shapes would otherwise grow the cache without
+// limit; when full the cache is cleared and re-learned.
+constexpr size_t kMaxCacheEntries = 64;
+
+c10::AliasAnalysisKind aliasAnalysisIsSpecialCase() {
+  return AliasAnalysisKind::INTERNAL_SPECIAL_CASE;
+}
+
+// Types whose runtime values can be hashed and compared cheaply to form a
+// cache key. Tensors are deliberately excluded - a tensor input means the
+// subgraph depends on more than constants and shapes.
+bool isHashableType(const TypePtr& type) {
+  if (type->isSubtypeOf(*IntType::get()) ||
+      type->isSubtypeOf(*FloatType::get()) ||
+      type->isSubtypeOf(*BoolType::get()) ||
+      type->isSubtypeOf(*StringType::get()) ||
+      type->isSubtypeOf(*NoneType::get()) ||
+      type->isSubtypeOf(*DeviceObjType::get())) {
+    return true;
+  }
+  if (auto list = type->cast<ListType>()) {
+    return isHashableType(list->getElementType());
+  }
+  if (auto opt = type->cast<OptionalType>()) {
+    return isHashableType(opt->getElementType());
+  }
+  if (auto tup = type->cast<TupleType>()) {
+    return std::all_of(
+        tup->elements().begin(), tup->elements().end(), isHashableType);
+  }
+  return false;
+}
+
+// Types whose runtime values can be stored in the cache and handed back via
+// IValue::deepcopy.
+bool isCacheableType(const TypePtr& type) {
+  if (type->isSubtypeOf(*TensorType::get())) {
+    return true;
+  }
+  if (auto list = type->cast<ListType>()) {
+    return isCacheableType(list->getElementType());
+  }
+  if (auto opt = type->cast<OptionalType>()) {
+    return isCacheableType(opt->getElementType());
+  }
+  if (auto tup = type->cast<TupleType>()) {
+    return std::all_of(
+        tup->elements().begin(), tup->elements().end(), isCacheableType);
+  }
+  return isHashableType(type);
+}
+
+size_t hashIValue(const IValue& v) {
+  // IValue::hash doesn't support lists, which are the common shape-derived
+  // input (aten::size returns int[])
+  if (v.isList()) {
+    size_t seed = c10::get_hash(v.toListRef().size());
+    for (const IValue& elem : v.toListRef()) {
+      seed = c10::hash_combine(seed, hashIValue(elem));
+    }
+    return seed;
+  }
+  return IValue::hash(v);
+}
+
+struct KeyHash {
+  size_t operator()(const std::vector<IValue>& key) const {
+    size_t seed = key.size();
+    for (const IValue& v : key) {
+      seed = c10::hash_combine(seed, hashIValue(v));
+    }
+    return seed;
+  }
+};
+
+struct KeyEqual {
+  bool operator()(
+      const std::vector<IValue>& a,
+      const std::vector<IValue>& b) const {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+  }
+};
+
+// One cache per prim::MemoizedSubgraph node instance, owned by the Operation
+// closure created for it. Executions of the same plan share it, so lookups
+// and inserts are serialized by a mutex - the subgraph body itself runs
+// outside the lock.
+struct SubgraphCache {
+  std::mutex mutex;
+  std::unordered_map<
+      std::vector<IValue>,
+      std::vector<IValue>,
+      KeyHash,
+      KeyEqual>
+      entries;
+};
+
+RegisterOperators MemoizedSubgraphOp({Operator(
+    prim::MemoizedSubgraph,
+    [](const Node* node) -> Operation {
+      auto code = std::make_shared<Code>(
+          node->g(attr::Subgraph), "<memoized_subgraph>");
+      auto cache = std::make_shared<SubgraphCache>();
+      size_t num_inputs = node->inputs().size();
+      size_t num_outputs = node->outputs().size();
+      return [code, cache, num_inputs, num_outputs](Stack& stack) {
+        std::vector<IValue> key(stack.end() - num_inputs, stack.end());
+        {
+          std::lock_guard<std::mutex> guard(cache->mutex);
+          auto it = cache->entries.find(key);
+          if (it != cache->entries.end()) {
+            drop(stack, num_inputs);
+            for (const IValue& v : it->second) {
+              // hand out copies so callers can't corrupt the cached values
+              stack.emplace_back(v.deepcopy());
+            }
+            return;
+          }
+        }
+
+        InterpreterState(*code).run(stack);
+
+        std::vector<IValue> stored;
+        stored.reserve(num_outputs);
+        for (auto it = stack.end() - num_outputs; it != stack.end(); ++it) {
+          stored.emplace_back(it->deepcopy());
+        }
+        // detach the key from any caller-owned containers as well
+        for (IValue& k : key) {
+          k = k.deepcopy();
+        }
+        std::lock_guard<std::mutex> guard(cache->mutex);
+        if (cache->entries.size() >= kMaxCacheEntries) {
+          cache->entries.clear();
+        }
+        cache->entries.emplace(std::move(key), std::move(stored));
+      };
+    },
+    aliasAnalysisIsSpecialCase())});
+
+struct FrozenSubgraphMemoizer {
+  explicit FrozenSubgraphMemoizer(std::shared_ptr<Graph> graph)
+      : graph_(std::move(graph)), aliasDb_(graph_) {}
+
+  bool run() {
+    return run(graph_->block());
+  }
+
+ private:
+  bool run(Block* block) {
+    bool changed = false;
+    for (Node* node : block->nodes()) {
+      for (Block* subblock : node->blocks()) {
+        changed |= run(subblock);
+      }
+    }
+
+    std::unordered_set<Node*> candidates;
+    for (Node* node : block->nodes()) {
+      if (isMemoizable(node, candidates)) {
+        candidates.insert(node);
+      }
+    }
+
+    // Visit in reverse order so each group is seeded from its most
+    // downstream node and grown towards producers.
+    std::vector<Node*> order;
+    for (Node* node : block->nodes()) {
+      order.push_back(node);
+    }
+    std::unordered_set<Node*> consumed;
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+      Node* seed = *it;
+      if (!candidates.count(seed) || consumed.count(seed)) {
+        continue;
+      }
+      auto group = growGroup(seed, candidates, consumed);
+      if (!isWorthMemoizing(group)) {
+        continue;
+      }
+      outlineGroup(group);
+      for (Node* member : group) {
+        consumed.insert(member);
+      }
+      changed = true;
+    }
+    return changed;
+  }
+
+  // A node can participate in a memoized subgraph if it's deterministic,
+  // side effect free, and each input is a constant, the output of another
+  // candidate, or a hashable scalar that can become part of the cache key.
+  bool isMemoizable(Node* node, const std::unordered_set<Node*>& candidates) {
+    if (node->kind() == prim::Constant) {
+      return false;
+    }
+    if (!node->blocks().empty() || node->hasSideEffects() ||
+        node->isNondeterministic()) {
+      return false;
+    }
+    for (Value* output : node->outputs()) {
+      if (!isCacheableType(output->type()) || aliasDb_.hasWriters(output)) {
+        return false;
+      }
+    }
+    for (Value* input : node->inputs()) {
+      Node* producer = input->node();
+      if (producer->kind() == prim::Constant || candidates.count(producer)) {
+        continue;
+      }
+      if (!isHashableType(input->type()) || aliasDb_.hasWriters(input)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Grow the group from `seed` by pulling in candidate producers whose
+  // outputs are used exclusively inside the group. Producers with external
+  // uses stay outside; the boundary check in isWorthMemoizing rejects the
+  // group if that leaves a non-hashable value crossing into it.
+  std::unordered_set<Node*> growGroup(
+      Node* seed,
+      const std::unordered_set<Node*>& candidates,
+      const std::unordered_set<Node*>& consumed) {
+    std::unordered_set<Node*> group{seed};
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      std::vector<Node*> members(group.begin(), group.end());
+      for (Node* member : members) {
+        for (Value* input : member->inputs()) {
+          Node* producer = input->node();
+          if (consumed.count(producer) || group.count(producer) ||
+              !candidates.count(producer)) {
+            continue;
+          }
+          bool allUsesInGroup = true;
+          for (Value* output : producer->outputs()) {
+            for (const Use& use : output->uses()) {
+              if (!group.count(use.user)) {
+                allUsesInGroup = false;
+                break;
+              }
+            }
+          }
+          if (allUsesInGroup) {
+            group.insert(producer);
+            changed = true;
+          }
+        }
+      }
+    }
+    return group;
+  }
+
+  bool isWorthMemoizing(const std::unordered_set<Node*>& group) {
+    if (group.size() < kMinSubgraphSize) {
+      return false;
+    }
+    bool hasTensorOutput = false;
+    for (Node* member : group) {
+      for (Value* input : member->inputs()) {
+        Node* producer = input->node();
+        if (producer->kind() == prim::Constant || group.count(producer)) {
+          continue;
+        }
+        // a candidate producer that didn't join (it has external uses) may
+        // feed us a tensor, which can't be part of the cache key
+        if (!isHashableType(input->type())) {
+          return false;
+        }
+      }
+      for (Value* output : member->outputs()) {
+        for (const Use& use : output->uses()) {
+          if (!group.count(use.user) &&
+              output->type()->isSubtypeOf(*TensorType::get())) {
+            hasTensorOutput = true;
+          }
+        }
+      }
+    }
+    // if nothing tensorial escapes, constant propagation or plain CSE are
+    // the right tools and caching buys nothing
+    return hasTensorOutput;
+  }
+
+  void outlineGroup(const std::unordered_set<Node*>& group) {
+    std::vector<Node*> sorted(group.begin(), group.end());
+    std::sort(sorted.begin(), sorted.end(), [](Node* a, Node* b) {
+      return a->isBefore(b);
+    });
+    GRAPH_UPDATE(
+        "Outlining ", sorted.size(), " nodes into a MemoizedSubgraph");
+    Node* subgraphNode = SubgraphUtils::createSingletonSubgraph(
+        sorted.back(), prim::MemoizedSubgraph);
+    // merge from the most downstream producer up; each member's uses are
+    // already inside the subgraph by the time it's merged
+    for (auto it = sorted.rbegin() + 1; it != sorted.rend(); ++it) {
+      SubgraphUtils::mergeNodeIntoSubgraph(*it, subgraphNode);
+    }
+  }
+
+  std::shared_ptr<Graph> graph_;
+  AliasDb aliasDb_;
+};
+
+} // namespace
+
+bool MemoizeFrozenSubgraphs(std::shared_ptr<Graph>& graph) {
+  FrozenSubgraphMemoizer memoizer(graph);
+  bool changed = memoizer.run();
+  if (changed) {
+    // constants cloned into subgraphs may have lost their remaining uses
+    EliminateDeadCode(graph);
+    GRAPH_DUMP("After MemoizeFrozenSubgraphs: ", graph);
+  }
+  return changed;
+}
+
+} // namespace jit
+} // namespace torch
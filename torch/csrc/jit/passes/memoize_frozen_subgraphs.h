@@ -0,0 +1,21 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Outlines subgraphs that depend only on constants and hashable scalar
+// inputs (typically shape values read off the graph inputs) into
+// prim::MemoizedSubgraph nodes whose outputs are cached across calls,
+// keyed by the runtime values of the scalar inputs.
+//
+// Intended for frozen inference graphs, where preprocessing chains such as
+// normalization constants or position encodings are recomputed per call
+// even though they only vary with the input shape.
+//
+// Returns true if any subgraph was outlined.
+TORCH_API bool MemoizeFrozenSubgraphs(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
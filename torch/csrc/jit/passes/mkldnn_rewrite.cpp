@@ -1,6 +1,9 @@
 #include <ATen/Config.h>
 #include <ATen/code_template.h>
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <torch/csrc/jit/ir/constants.h>
 #include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/ir/subgraph_matcher.h>
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/passes/constant_propagation.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
@@ -57,8 +60,16 @@ void insertPrePackedConvOpForNode(Node* n) {
     prepack_node->addInput(v);
   }
   prepack_node->addInput(input_size);
+  // Epilogue chain: starts empty, filled in by the fusion rewrites below.
   auto attr = graph->insertConstant(IValue("none"));
   prepack_node->addInput(attr);
+  auto scalars =
+      graph->insertConstant(IValue(c10::List<c10::optional<at::Scalar>>()));
+  prepack_node->addInput(scalars);
+  auto algorithm = graph->insertConstant(IValue());
+  prepack_node->addInput(algorithm);
+  auto binary_attr = graph->insertConstant(IValue());
+  prepack_node->addInput(binary_attr);
   prepack_node->output()->setType(
       getCustomClass("__torch__.torch.classes.mkldnn.ConvOpContext"));
   graph->insertNode(prepack_node);
@@ -122,24 +133,59 @@ void insertMkldnnPrePackedOps(script::Module& module) {
   }
 }
 
-void FuseReluWithPackedOps(std::shared_ptr<Graph>& graph) {
+// True if the prepack node matched by the pattern has not had an eltwise
+// post op attached yet.
+static bool attrIsNone(
+    const Match& match,
+    const std::unordered_map<std::string, Value*>& vmap) {
+  auto attr_value = toIValue(match.values_map.at(vmap.at("dummy_attr")));
+  return attr_value.has_value() && attr_value->isString() &&
+      attr_value->toStringRef() == "none";
+}
+
+static bool binaryAttrIsNone(
+    const Match& match,
+    const std::unordered_map<std::string, Value*>& vmap) {
+  auto attr_value =
+      toIValue(match.values_map.at(vmap.at("dummy_binary_attr")));
+  if (!attr_value.has_value()) {
+    return false;
+  }
+  return attr_value->isNone() ||
+      (attr_value->isString() && attr_value->toStringRef() == "none");
+}
+
+static bool alphaIsOne(
+    const Match& match,
+    const std::unordered_map<std::string, Value*>& vmap) {
+  auto alpha_value = toIValue(match.values_map.at(vmap.at("alpha")));
+  if (!alpha_value.has_value()) {
+    return false;
+  }
+  return (alpha_value->isInt() && alpha_value->toInt() == 1) ||
+      (alpha_value->isDouble() && alpha_value->toDouble() == 1.0);
+}
+
+void FuseEltwiseWithPackedOps(std::shared_ptr<Graph>& graph) {
   auto conv_op_rstring = at::jit::CodeTemplate(R"(
     graph(%input, %weight, %bias, %stride:int[], %padding:int[],
-          %dilation:int[], %groups:int, %input_size:int[], %dummy_attr:str):
+          %dilation:int[], %groups:int, %input_size:int[], %dummy_attr:str,
+          %scalars:Scalar?[], %algorithm:str?, %binary_attr:str?):
         %packed_weight_bias = mkldnn_prepacked::conv2d_prepack(
             %weight, %bias, %stride, %padding, %dilation, %groups,
-            %input_size, %dummy_attr)
+            %input_size, %dummy_attr, %scalars, %algorithm, %binary_attr)
         %conv2d_res = mkldnn_prepacked::conv2d_run(%input, %packed_weight_bias)
         %res = aten::${op}(%conv2d_res)
         return (%res))");
 
   auto conv_op_fused_rstring = at::jit::CodeTemplate(R"(
     graph(%input, %weight, %bias, %stride:int[], %padding:int[],
-          %dilation:int[], %groups:int, %input_size:int[], %dummy_attr:str):
+          %dilation:int[], %groups:int, %input_size:int[], %dummy_attr:str,
+          %scalars:Scalar?[], %algorithm:str?, %binary_attr:str?):
         %attr: str = prim::Constant[value="${op_attr}"]()
         %packed_weight_bias : __torch__.torch.classes.mkldnn.ConvOpContext = mkldnn_prepacked::conv2d_prepack(
             %weight, %bias, %stride, %padding, %dilation, %groups,
-            %input_size, %attr)
+            %input_size, %attr, %scalars, %algorithm, %binary_attr)
         %res = mkldnn_prepacked::conv2d_run(%input, %packed_weight_bias)
         return (%res))");
 
@@ -160,10 +206,175 @@ void FuseReluWithPackedOps(std::shared_ptr<Graph>& graph) {
         conv_op_rstring.format(env), conv_op_fused_rstring.format(env_fused));
 
     auto filters = it.second;
+    filters.emplace_back(attrIsNone);
     rewriter.runOnGraph(graph, filters);
   }
+
+  // conv2d_run_binary + relu: attach the eltwise op behind the binary one.
+  // The chain is compiled at prepack time in the order binary then eltwise,
+  // which matches relu(add(conv(x), other)).
+  std::string conv_binary_relu_rstring = R"(
+    graph(%input, %other, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %input_size:int[], %dummy_attr:str,
+          %scalars:Scalar?[], %algorithm:str?, %binary_attr:str?):
+        %packed_weight_bias = mkldnn_prepacked::conv2d_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %input_size, %dummy_attr, %scalars, %algorithm, %binary_attr)
+        %conv2d_res = mkldnn_prepacked::conv2d_run_binary(
+            %input, %other, %packed_weight_bias)
+        %res = aten::relu(%conv2d_res)
+        return (%res))";
+
+  std::string conv_binary_relu_fused_rstring = R"(
+    graph(%input, %other, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %input_size:int[], %dummy_attr:str,
+          %scalars:Scalar?[], %algorithm:str?, %binary_attr:str?):
+        %attr: str = prim::Constant[value="relu"]()
+        %packed_weight_bias : __torch__.torch.classes.mkldnn.ConvOpContext = mkldnn_prepacked::conv2d_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %input_size, %attr, %scalars, %algorithm, %binary_attr)
+        %res = mkldnn_prepacked::conv2d_run_binary(
+            %input, %other, %packed_weight_bias)
+        return (%res))";
+
+  SubgraphRewriter binary_relu_rewriter;
+  binary_relu_rewriter.RegisterRewritePattern(
+      conv_binary_relu_rstring, conv_binary_relu_fused_rstring);
+  binary_relu_rewriter.runOnGraph(graph, {attrIsNone});
+}
+
+void FuseBinaryWithPackedOps(std::shared_ptr<Graph>& graph) {
+  auto conv_add_rstring = at::jit::CodeTemplate(R"(
+    graph(%input, %other, %alpha, %weight, %bias, %stride:int[],
+          %padding:int[], %dilation:int[], %groups:int, %input_size:int[],
+          %dummy_attr:str, %scalars:Scalar?[], %algorithm:str?,
+          %dummy_binary_attr:str?):
+        %packed_weight_bias = mkldnn_prepacked::conv2d_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %input_size, %dummy_attr, %scalars, %algorithm,
+            %dummy_binary_attr)
+        %conv2d_res = mkldnn_prepacked::conv2d_run(%input, %packed_weight_bias)
+        %res = aten::add(${add_inputs}, %alpha)
+        return (%res))");
+
+  std::string conv_add_fused_rstring = R"(
+    graph(%input, %other, %alpha, %weight, %bias, %stride:int[],
+          %padding:int[], %dilation:int[], %groups:int, %input_size:int[],
+          %dummy_attr:str, %scalars:Scalar?[], %algorithm:str?,
+          %dummy_binary_attr:str?):
+        %binary_attr: str = prim::Constant[value="add"]()
+        %packed_weight_bias : __torch__.torch.classes.mkldnn.ConvOpContext = mkldnn_prepacked::conv2d_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %input_size, %dummy_attr, %scalars, %algorithm, %binary_attr)
+        %res = mkldnn_prepacked::conv2d_run_binary(
+            %input, %other, %packed_weight_bias)
+        return (%res))";
+
+  // add is commutative, so match the conv output on either side.
+  for (const auto& add_inputs :
+       {std::string("%conv2d_res, %other"), std::string("%other, %conv2d_res")}) {
+    at::jit::TemplateEnv env;
+    env.s("add_inputs", add_inputs);
+
+    SubgraphRewriter rewriter;
+    rewriter.RegisterRewritePattern(
+        conv_add_rstring.format(env), conv_add_fused_rstring);
+    rewriter.runOnGraph(
+        graph, {alphaIsOne, attrIsNone, binaryAttrIsNone});
+  }
+}
+
+#if AT_MKL_ENABLED()
+
+// The packed panel is an opaque mkldnn tensor: it has no storage, so it
+// cannot live in a prim::Constant (see insertableTensor() in constants.cpp).
+// prim::ConstantMKLDNNTensor exists for exactly this case; the op itself is
+// registered in frozen_ops_to_mkldnn.cpp.
+Node* createConstantMKLDNNTensorNode(
+    Graph* g,
+    const at::Tensor& mkldnn_tensor) {
+  TORCH_INTERNAL_ASSERT(mkldnn_tensor.is_mkldnn());
+  auto op = g->create(prim::ConstantMKLDNNTensor);
+  op->t_(attr::value, mkldnn_tensor);
+  return op;
+}
+
+bool isMKLPackableLinear(Node* n) {
+  if (n->kind() != aten::linear) {
+    return false;
+  }
+  // Packing happens at rewrite time, so the weight must already be frozen
+  // into the graph; cblas_sgemm_pack only handles fp32 2-d weights.
+  auto weight = constant_as<at::Tensor>(n->namedInput("weight"));
+  return weight.has_value() && weight->device().is_cpu() &&
+      weight->scalar_type() == c10::ScalarType::Float && weight->dim() == 2;
+}
+
+void insertMKLPrepackedLinearOpForNode(Node* n, int64_t batch_size) {
+  auto weight = constant_as<at::Tensor>(n->namedInput("weight")).value();
+
+  // Build the packed panel now rather than at runtime: the per-call pack
+  // phase is exactly what this rewrite takes off the hot path.
+  auto reorder = c10::Dispatcher::singleton()
+                     .findSchemaOrThrow("mkl::_mkl_reorder_linear_weight", "")
+                     .typed<at::Tensor(const at::Tensor&, int64_t)>();
+  at::Tensor packed_weight = reorder.call(weight.to_mkldnn(), batch_size);
+
+  WithInsertPoint guard(n);
+  auto graph = n->owningGraph();
+
+  Value* packed_weight_value =
+      createConstantMKLDNNTensorNode(graph, packed_weight)
+          ->insertBefore(n)
+          ->output();
+  packed_weight_value->setDebugName(
+      n->namedInput("weight")->debugName() + "_mkl_packed");
+  auto batch_size_value = graph->insertConstant(IValue(batch_size));
+
+  // mkl::_mkl_linear keeps the original weight around so it can fall back
+  // to aten::linear when the runtime M does not match batch_size.
+  auto mkl_linear = graph->insertNode(
+      graph->create(Symbol::fromQualString("mkl::_mkl_linear"), 1));
+  mkl_linear->addInput(n->namedInput("input"));
+  mkl_linear->addInput(packed_weight_value);
+  mkl_linear->addInput(n->namedInput("weight"));
+  mkl_linear->addInput(n->namedInput("bias"));
+  mkl_linear->addInput(batch_size_value);
+  mkl_linear->output()->setType(n->output()->type()->cast<TensorType>());
+
+  n->output()->replaceAllUsesWith(mkl_linear->output());
+}
+
+void insertMKLPrepackedLinearOp(Block* b, int64_t batch_size) {
+  for (Node* n : b->nodes()) {
+    for (Block* block : n->blocks()) {
+      insertMKLPrepackedLinearOp(block, batch_size);
+    }
+    if (isMKLPackableLinear(n)) {
+      insertMKLPrepackedLinearOpForNode(n, batch_size);
+    }
+  }
+  EliminateDeadCode(b);
+}
+
+void PrepackMKLLinear(std::shared_ptr<Graph>& graph, int64_t batch_size) {
+  TORCH_CHECK(
+      batch_size >= 1,
+      "PrepackMKLLinear: batch_size must be at least 1, got ",
+      batch_size);
+  GRAPH_DEBUG("Before PrepackMKLLinear\n", *graph);
+  insertMKLPrepackedLinearOp(graph->block(), batch_size);
+  GRAPH_DEBUG("After PrepackMKLLinear\n", *graph);
+}
+
+#else
+
+void PrepackMKLLinear(std::shared_ptr<Graph>& graph, int64_t batch_size) {
+  GRAPH_DEBUG("MKL not enabled");
 }
 
+#endif // AT_MKL_ENABLED()
+
 void PrePackingOpsFolder(Block* b) {
   auto is_foldable_op = [](const Node* n) -> bool {
     return (
@@ -211,10 +422,15 @@ void FuseConvWithEltwise(std::shared_ptr<Graph>& graph) {
       *graph);
   insertMkldnnPrePackedOps(graph);
   GRAPH_DEBUG(
-      "After insertMkldnnPrePackedOps, before FuseReluWithPackedOps\n", *graph);
-  FuseReluWithPackedOps(graph);
+      "After insertMkldnnPrePackedOps, before FuseBinaryWithPackedOps\n",
+      *graph);
+  FuseBinaryWithPackedOps(graph);
+  GRAPH_DEBUG(
+      "After FuseBinaryWithPackedOps, before FuseEltwiseWithPackedOps\n",
+      *graph);
+  FuseEltwiseWithPackedOps(graph);
   GRAPH_DEBUG(
-      "After FuseReluWithPackedOps, before FoldPrePackingOps\n", *graph);
+      "After FuseEltwiseWithPackedOps, before FoldPrePackingOps\n", *graph);
   FoldPrePackingOps(graph);
   GRAPH_DEBUG("After FoldPrePackingOps. End of FuseConvWithEltwise\n", *graph);
 }
@@ -225,6 +441,10 @@ void FuseConvWithEltwise(std::shared_ptr<Graph>& graph) {
   GRAPH_DEBUG("MKLDNN Not enabled");
 }
 
+void PrepackMKLLinear(std::shared_ptr<Graph>& graph, int64_t batch_size) {
+  GRAPH_DEBUG("MKLDNN Not enabled");
+}
+
 #endif // AT_MKLDNN_ENABLED()
 
 } // namespace jit
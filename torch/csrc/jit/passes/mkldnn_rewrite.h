@@ -18,10 +18,19 @@ namespace jit {
 
 namespace mkldnn {
 
+// Keys are both the aten op name matched in the graph and the attr string
+// handed to mkldnn_prepacked::conv2d_prepack; they must stay in sync with
+// at::native::fusion_unary_attr_map(). Only eltwise ops whose aten form
+// takes no extra arguments can be listed here, since the rewrite pattern
+// matches a single-input call.
 const static std::map<std::string, std::vector<torch::jit::MatchFilter>>
     fusion_rewrite_map = {
         {"none", {}},
         {"relu", {}},
+        {"sigmoid", {}},
+        {"tanh", {}},
+        {"hardswish", {}},
+        {"hardsigmoid", {}},
 };
 
 } // namespace mkldnn
@@ -30,5 +39,16 @@ const static std::map<std::string, std::vector<torch::jit::MatchFilter>>
 
 void FuseConvWithEltwise(std::shared_ptr<Graph>& graph);
 
+// Rewrites frozen fp32 aten::linear ops into mkl::_mkl_linear calls whose
+// weight panel has been transposed and packed ahead of time with
+// mkl::_mkl_reorder_linear_weight, so the GEMM skips the per-call pack
+// phase. The packed layout is specialized for inputs with batch_size rows;
+// calls with a different leading dimension fall back to aten::linear inside
+// mkl::_mkl_linear, so the rewrite stays shape-safe. This pass only works
+// on frozen graphs and is a no-op unless both MKL and MKLDNN are built.
+TORCH_API void PrepackMKLLinear(
+    std::shared_ptr<Graph>& graph,
+    int64_t batch_size);
+
 } // namespace jit
 } // namespace torch
@@ -262,6 +262,95 @@ void fuseHardtanhWithPackedOps(std::shared_ptr<Graph>& graph) {
   rewriter.runOnGraph(graph, torch::jit::graph_rewrite_helper::isClampFusable);
 }
 
+void fuseClampWithPackedOps(std::shared_ptr<Graph>& graph) {
+  // aten::clamp is aten::hardtanh with optional bounds; the prepack ops
+  // accept Scalar? min/max, so a constant (possibly None) clamp folds into
+  // the packed context the same way hardtanh does.
+  SubgraphRewriter rewriter;
+
+  std::string linear_prepack_run_clamp_fused = R"(
+    graph(%input, %weight, %bias, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias : __torch__.torch.classes.xnnpack.LinearOpContext = prepacked::linear_clamp_prepack(
+            %weight, %bias, %output_min, %output_max)
+        %res = prepacked::linear_clamp_run(%input, %packed_weight_bias)
+        return (%res))";
+
+  std::string conv2d_prepack_run_clamp_fused = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias : __torch__.torch.classes.xnnpack.Conv2dOpContext = prepacked::conv2d_clamp_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %output_min, %output_max)
+        %res = prepacked::conv2d_clamp_run(%input, %packed_weight_bias)
+        return (%res) )";
+
+  std::string linear_prepack_run_clamp = R"(
+    graph(%input, %weight, %bias, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::linear_clamp_prepack(
+            %weight, %bias, %dummy_min_max, %dummy_min_max)
+        %linear_res = prepacked::linear_clamp_run(%input, %packed_weight_bias)
+        %res = aten::clamp(%linear_res, %output_min, %output_max)
+        return (%res))";
+
+  std::vector<std::pair<std::string, std::string>> value_mappings(
+      {{"packed_weight_bias", "packed_weight_bias"}, {"res", "res"}});
+
+  rewriter.RegisterRewritePattern(
+      linear_prepack_run_clamp, linear_prepack_run_clamp_fused, value_mappings);
+
+  std::string conv2d_prepack_run_clamp = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::conv2d_clamp_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %dummy_min_max, %dummy_min_max)
+        %conv2d_res = prepacked::conv2d_clamp_run(%input, %packed_weight_bias)
+        %res = aten::clamp(%conv2d_res, %output_min, %output_max)
+        return (%res) )";
+
+  value_mappings = {
+      {"packed_weight_bias", "packed_weight_bias"}, {"res", "res"}};
+
+  rewriter.RegisterRewritePattern(
+      conv2d_prepack_run_clamp, conv2d_prepack_run_clamp_fused, value_mappings);
+
+  std::string linear_prepack_run_clamp_inplace = R"(
+    graph(%input, %weight, %bias, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::linear_clamp_prepack(
+            %weight, %bias, %dummy_min_max, %dummy_min_max)
+        %linear_res = prepacked::linear_clamp_run(%input, %packed_weight_bias)
+        %res = aten::clamp_(%linear_res, %output_min, %output_max)
+        return (%res))";
+
+  std::string conv2d_prepack_run_clamp_inplace = R"(
+    graph(%input, %weight, %bias, %stride:int[], %padding:int[],
+          %dilation:int[], %groups:int, %output_min, %output_max, %dummy_min_max):
+        %packed_weight_bias = prepacked::conv2d_clamp_prepack(
+            %weight, %bias, %stride, %padding, %dilation, %groups,
+            %dummy_min_max, %dummy_min_max)
+        %conv2d_res = prepacked::conv2d_clamp_run(%input, %packed_weight_bias)
+        %res = aten::clamp_(%conv2d_res, %output_min, %output_max)
+        return (%res) )";
+
+  value_mappings = {
+      {"packed_weight_bias", "packed_weight_bias"}, {"res", "res"}};
+
+  rewriter.RegisterRewritePattern(
+      linear_prepack_run_clamp_inplace,
+      linear_prepack_run_clamp_fused,
+      value_mappings);
+
+  value_mappings = {
+      {"packed_weight_bias", "packed_weight_bias"}, {"res", "res"}};
+
+  rewriter.RegisterRewritePattern(
+      conv2d_prepack_run_clamp_inplace,
+      conv2d_prepack_run_clamp_fused,
+      value_mappings);
+
+  rewriter.runOnGraph(graph, torch::jit::graph_rewrite_helper::isClampFusable);
+}
+
 void fuseReluWithPackedOps(std::shared_ptr<Graph>& graph) {
   SubgraphRewriter rewriter;
 
@@ -394,6 +483,7 @@ void fusePrePackedLinearConvWithClamp(script::Module& module) {
     auto graph = method.graph();
     fuseReluWithPackedOps(graph);
     fuseHardtanhWithPackedOps(graph);
+    fuseClampWithPackedOps(graph);
 
     // Ignore user defined classes for later passes
     ConstantPropagation(graph, true);
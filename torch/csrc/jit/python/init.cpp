@@ -53,6 +53,7 @@
 #include <torch/csrc/jit/passes/lower_graph.h>
 #include <torch/csrc/jit/passes/lower_tuples.h>
 #include <torch/csrc/jit/passes/metal_rewrite.h>
+#include <torch/csrc/jit/passes/mkldnn_rewrite.h>
 #include <torch/csrc/jit/passes/mobile_optimizer_type.h>
 #include <torch/csrc/jit/passes/normalize_ops.h>
 #include <torch/csrc/jit/passes/peephole.h>
@@ -403,6 +404,11 @@ void initJITBindings(PyObject* module) {
       .def("_jit_pass_convert_frozen_ops_to_mkldnn", &ConvertFrozenOpsToMKLDNN)
       .def("_jit_pass_fuse_frozen_conv_add_relu", &FuseFrozenConvAddRelu)
       .def("_jit_pass_transpose_frozen_linear", &FrozenLinearTranspose)
+      .def(
+          "_jit_pass_mkl_prepack_frozen_linear",
+          &PrepackMKLLinear,
+          py::arg("graph"),
+          py::arg("batch_size"))
       .def("_jit_pass_optimize_frozen_graph", &OptimizeFrozenGraph)
       .def(
           "_jit_pass_optimize_for_inference",
@@ -97,6 +97,31 @@ ArgumentSpecCreator::ArgumentSpecCreator(Graph& graph)
   for (Value* input : graph.inputs()) {
     scan(input->type(), 0, written_slots);
   }
+  // Note [Flat argument specs]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Most scripted functions take only tensors (plus non-specializable
+  // arguments) at the top level, so their extraction program is a flat
+  // sequence of SPECIALIZE_TENSOR/SKIP with no aggregates or optionals. Each
+  // such instruction consumes exactly one input, so the instruction index is
+  // the input offset; we record the offsets of the specialized tensors once
+  // here and create() runs a straight-line loop over them, skipping the
+  // instruction dispatch and the IValue stack entirely. If the program
+  // specializes nothing at all, the spec and its hash are identical on every
+  // call, so the spec is built once here and create() just copies it.
+  is_flat_ =
+      std::all_of(instructions_.begin(), instructions_.end(), [](Inst i) {
+        return i == SPECIALIZE_TENSOR || i == SKIP;
+      });
+  if (is_flat_) {
+    for (const auto i : c10::irange(instructions_.size())) {
+      if (instructions_[i] == SPECIALIZE_TENSOR) {
+        flat_tensor_offsets_.push_back(i);
+      }
+    }
+    if (flat_tensor_offsets_.empty()) {
+      trivial_spec_.emplace(num_tensors_, num_optionals_);
+    }
+  }
 }
 
 void ArgumentSpecCreator::dump() const {
@@ -130,6 +155,18 @@ void ArgumentSpecCreator::dump() const {
 
 ArgumentSpec ArgumentSpecCreator::create(bool with_grad, const Stack& input)
     const {
+  if (C10_LIKELY(is_flat_)) {
+    // See Note [Flat argument specs]
+    if (trivial_spec_) {
+      return *trivial_spec_;
+    }
+    ArgumentSpec flat_spec(num_tensors_, num_optionals_);
+    const IValue* args = last(input, num_inputs_).begin();
+    for (uint32_t offset : flat_tensor_offsets_) {
+      flat_spec.addTensor(args[offset], with_grad);
+    }
+    return flat_spec;
+  }
   ArgumentSpec spec(num_tensors_, num_optionals_);
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
   const IValue* stack[ARG_SPEC_DEPTH_LIMIT]; // The stack of IValue lists
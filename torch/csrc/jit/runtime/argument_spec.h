@@ -103,7 +103,10 @@ struct ArgumentSpec {
     const at::Tensor* t = reinterpret_cast<const at::Tensor*>(&input);
     arg.defined_ = t->defined();
     if (arg.defined_) {
-      arg.requires_grad_ = with_grad && autograd::Variable(*t).requires_grad();
+      // Variable is an alias of Tensor, so query requires_grad() directly
+      // rather than constructing a Variable, which would cost another
+      // refcount bump/drop per tensor (see [argspec refcounting] above).
+      arg.requires_grad_ = with_grad && t->requires_grad();
       arg.dim_ = t->dim();
       // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
       at::Device device = t->device();
@@ -209,6 +212,11 @@ struct TORCH_API ArgumentSpecCreator {
   size_t num_tensors_ = 0;
   size_t num_optionals_ = 0;
   std::vector<Inst> instructions_;
+  // Fast-path state for flat extraction programs; see
+  // Note [Flat argument specs] in argument_spec.cpp.
+  bool is_flat_ = false;
+  std::vector<uint32_t> flat_tensor_offsets_;
+  c10::optional<ArgumentSpec> trivial_spec_;
 };
 
 // CompleteArgumentSpec represents one particular specialization.
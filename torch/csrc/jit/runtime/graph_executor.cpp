@@ -49,6 +49,7 @@
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -643,6 +644,7 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
     if (fallback) {
       state.fallback = fallback;
     }
+    std::shared_lock<std::shared_mutex> lock(plan_cache_mutex);
     for (auto& entry : plan_cache) {
       state.execution_plans.emplace(entry.first, entry.second);
     }
@@ -667,8 +669,24 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
     // path ArgumentSpec even computes its hashCode here.
     ArgumentSpec spec =
         arg_spec_creator_.create(autograd::GradMode::is_enabled(), stack);
+    // After warmup every call is a cache hit, so take the mutex in shared
+    // mode first: concurrent inference threads then only serialize while one
+    // of them is compiling a new spec. Entries are never erased and
+    // unordered_map insertion does not invalidate references to existing
+    // elements, so a reference obtained under the shared lock stays valid.
     {
-      std::lock_guard<std::mutex> lock(compile_mutex);
+      std::shared_lock<std::shared_mutex> lock(plan_cache_mutex);
+      auto it = plan_cache.find(spec);
+      if (it != plan_cache.end()) {
+        logging::getLogger()->addStatValue(
+            logging::runtime_counters::EXECUTION_PLAN_CACHE_HIT, 1.0);
+        return it->second;
+      }
+    }
+    {
+      std::unique_lock<std::shared_mutex> lock(plan_cache_mutex);
+      // Another thread may have compiled this spec while we re-acquired the
+      // lock in exclusive mode.
       auto it = plan_cache.find(spec);
       if (it != plan_cache.end()) {
         logging::getLogger()->addStatValue(
@@ -787,6 +805,10 @@ struct GraphExecutorImpl : public GraphExecutorImplBase {
   // that are specialized to the spec.
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   std::unordered_map<ArgumentSpec, ExecutionPlan> plan_cache;
+  // Guards plan_cache; taken in shared mode on the lookup fast path and in
+  // exclusive mode only to compile and insert a new plan.
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::shared_mutex plan_cache_mutex;
 };
 
 GraphExecutor::GraphExecutor(
@@ -74,7 +74,11 @@ namespace jit {
   _(WARN, "I") /* emit a warning with line information */                      \
   _(ENTER, "EN") /* enter scope of a contextmanager */                         \
   _(EXIT, "EX") /* exit the last entered contextmanager */                     \
-  _(AWAITABLE, "CN") /* initialize await for code entry x with N inputs  */
+  _(AWAITABLE, "CN") /* initialize await for code entry x with N inputs  */   \
+  _(LOAD2, "RR") /* push values from register X then register N (fused       \
+                    LOAD;LOAD) */                                             \
+  _(OP_STORE, "OR") /* invoke operator X, store its output to register N     \
+                       (fused OP;STORE) */
 
 enum OpCode : uint8_t {
 #define DEFINE_OP(op, _) op,
@@ -293,6 +293,18 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 #ifndef NDEBUG
             frame.function->assert_stack_size(inst.X, init_size, stack.size());
 #endif
+          }
+            INST_NEXT;
+          case INST(OP_STORE): {
+            INST_GUARD;
+#ifndef NDEBUG
+            size_t init_size = stack.size();
+#endif
+            frame.function->operator_table_[inst.X](stack);
+#ifndef NDEBUG
+            frame.function->assert_stack_size(inst.X, init_size, stack.size());
+#endif
+            reg(inst.N) = pop(stack);
           }
             INST_NEXT;
           case INST(OPN): {
@@ -312,6 +324,12 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             stack.emplace_back(reg(inst.X));
           }
             INST_NEXT;
+          case INST(LOAD2): {
+            INST_GUARD;
+            stack.emplace_back(reg(inst.X));
+            stack.emplace_back(reg(inst.N));
+          }
+            INST_NEXT;
           case INST(MOVE): {
             INST_GUARD;
             stack.emplace_back(std::move(reg(inst.X)));
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -133,6 +134,11 @@ struct CodeImpl {
   std::vector<std::unique_ptr<Function>> bailout_functions_;
   size_t remaining_bailout_depth_;
 
+  // Whether insertInstruction may merge adjacent instructions into
+  // superinstructions (LOAD2, OP_STORE). Disabled for mobile bytecode, which
+  // must only contain opcodes accepted by isOpSupportedInMobile.
+  bool enable_superinstructions_ = true;
+
   CodeImpl(
       const std::shared_ptr<Graph>& graph,
       std::string function_name,
@@ -213,7 +219,39 @@ struct CodeImpl {
     return instructions_source_;
   }
 
+  // Merges the instruction about to be emitted into the previous one when the
+  // pair forms a known superinstruction, halving the dispatches for the
+  // hottest sequences the emitter produces (back-to-back LOADs of operator
+  // inputs, and the STORE that follows nearly every OP). The fused
+  // instruction reuses the slot of the first of the pair, so any recorded
+  // jump target stays valid: targets always point at the instruction directly
+  // following a control-flow opcode (JF, JMP, LOOP, RET, TAIL_CALL, GUARD),
+  // none of which can be the first half of a fusion.
+  bool tryFuseInstruction(OpCode op, int64_t X, uint64_t N) {
+    if (!enable_superinstructions_ || instructions_.empty() || N != 0 ||
+        X < 0 || X > std::numeric_limits<uint16_t>::max()) {
+      return false;
+    }
+    Instruction& prev = instructions_.back();
+    if (op == LOAD && prev.op == LOAD) {
+      prev.op = LOAD2;
+      prev.N = static_cast<uint16_t>(X);
+      return true;
+    }
+    if (op == STORE && prev.op == OP) {
+      // The OP and its STORE come from the same node, so the recorded source
+      // for the fused slot is already correct.
+      prev.op = OP_STORE;
+      prev.N = static_cast<uint16_t>(X);
+      return true;
+    }
+    return false;
+  }
+
   void insertInstruction(OpCode op, int64_t X = 0, uint64_t N = 0) {
+    if (tryFuseInstruction(op, X, N)) {
+      return;
+    }
     instructions_.emplace_back(
         op,
         safe_narrow_cast<int32_t, int64_t>(X),
@@ -810,7 +848,7 @@ struct CodeImpl {
   void dump(std::ostream& out, size_t i) const {
     out << i << " " << instructions_[i];
     if (instructions_[i].op == OP || instructions_[i].op == CALL ||
-        instructions_[i].op == OPN) {
+        instructions_[i].op == OPN || instructions_[i].op == OP_STORE) {
       out << " # " << *instructions_source_[i];
     } else {
       out << "\n";
@@ -889,6 +927,8 @@ struct MobileCodeImpl : CodeImpl {
         emit_default_input_instructions_(emit_default_input_instructions),
         support_default_args_before_out_(support_default_args_before_out),
         emit_promoted_ops_(emit_promoted_ops) {
+    // superinstructions are not part of the mobile bytecode format
+    enable_superinstructions_ = false;
     // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
     run();
   }
@@ -36,6 +36,12 @@ struct OperatorRegistry {
   std::unordered_map<std::string, std::shared_ptr<Operator>> operators_by_sig;
   std::unordered_map<const char*, std::shared_ptr<Operator>>
       operators_by_sig_literal;
+  // Operators that are already in the symbol map but whose canonical
+  // signature string has not been computed yet. Computing it requires the
+  // fully parsed schema, so it is deferred until a signature lookup for
+  // that symbol actually happens; this keeps the first registry lookup
+  // from parsing every registered schema at once.
+  OperatorMap to_canonicalize;
 
   // Remember all registered operator names to check that they aren't
   // registered a second time. Registering an op multiple times is
@@ -47,24 +53,38 @@ struct OperatorRegistry {
 
   // XXX - caller must be holding lock
   void registerPendingOperators() {
-    for (const auto& op : to_register) {
-      Symbol sym = Symbol::fromQualString(op->schema().name());
+    for (auto& op : to_register) {
+      // operatorName() only lexes the name, so pending operators can be
+      // filed under their symbol without parsing their full schemas.
+      Symbol sym = Symbol::fromQualString(op->operatorName().name);
       operators[sym].push_back(op);
-      operators_by_sig[canonicalSchemaString(op->schema())] = op;
+      to_canonicalize[sym].push_back(std::move(op));
     }
     to_register.clear();
   }
 
+  // XXX - caller must be holding lock
+  void canonicalizeOperatorsFor(Symbol sym) {
+    auto it = to_canonicalize.find(sym);
+    if (it == to_canonicalize.end()) {
+      return;
+    }
+    for (const auto& op : it->second) {
+      operators_by_sig[canonicalSchemaString(op->schema())] = op;
+    }
+    to_canonicalize.erase(it);
+  }
+
  public:
   void registerOperator(Operator&& op) {
     std::lock_guard<std::mutex> guard(lock);
 #ifdef C10_MOBILE
     TORCH_INTERNAL_ASSERT(
-        0 == registered_operator_names.count(op.schema().operator_name()),
+        0 == registered_operator_names.count(op.operatorName()),
         "Tried to register operator \"",
         op.schema(),
         "\" to JIT but the operator name was already registered before. Please add or change the overload name.");
-    registered_operator_names.insert(op.schema().operator_name());
+    registered_operator_names.insert(op.operatorName());
 #endif
     to_register.push_back(std::make_shared<Operator>(std::move(op)));
   }
@@ -92,6 +112,9 @@ struct OperatorRegistry {
       return;
     }
 
+    // The signature map is filled in lazily per symbol
+    canonicalizeOperatorsFor(sym);
+
     // Remove operator from signature map
     auto sig_it = operators_by_sig.find(sig);
     if (sig_it == operators_by_sig.end()) {
@@ -125,8 +148,11 @@ struct OperatorRegistry {
     registerPendingOperators();
     auto it = operators_by_sig_literal.find(name);
     if (it == operators_by_sig_literal.end()) {
-      auto op_ptr_it =
-          operators_by_sig.find(canonicalSchemaString(parseSchema(name)));
+      auto parsed = parseSchema(name);
+      // Only operators under the literal's symbol can possibly match, so
+      // only their signature strings need to be materialized.
+      canonicalizeOperatorsFor(Symbol::fromQualString(parsed.name()));
+      auto op_ptr_it = operators_by_sig.find(canonicalSchemaString(parsed));
       // Handy debugging code that dumps all operators we know about on mismatch
 #if 0
       if (op_ptr_it == operators_by_sig.end()) {
@@ -252,6 +278,7 @@ bool printerHasSpecialCaseFor(Symbol sym) {
       prim::Load, // used in interpreter only
       prim::MMTreeReduce, // used as an optimization
       prim::MMBatchSide, // used as an optimization
+      prim::MemoizedSubgraph, // optimization pass adds it
       prim::Store, // used in interpreter only
       prim::profile, // used in interpreter only
       prim::profile_ivalue, // used in interpreter only
@@ -300,6 +327,7 @@ bool aliasAnalysisHasSpecialCaseFor(Symbol symbol) {
       prim::GradOf,
       prim::MMTreeReduce,
       prim::MMBatchSide,
+      prim::MemoizedSubgraph,
       prim::BroadcastSizes,
       prim::ChunkSizes,
       prim::Closure,
@@ -354,7 +382,10 @@ bool aliasAnalysisHasSpecialCaseFor(Symbol symbol) {
 }
 
 void registerOperator(Operator&& op) {
-  if (op.schema().is_varret()) {
+  // isVarret() deliberately avoids materializing the schema: almost no
+  // operators are varret, and parsing every schema here would serialize
+  // all of static operator registration behind the schema parser.
+  if (op.isVarret()) {
     Symbol s = Symbol::fromQualString(op.schema().name());
     if (!printerHasSpecialCaseFor(s)) {
       AT_ERROR(
@@ -176,6 +176,45 @@ struct TORCH_API Operator {
         });
   }
 
+  // Returns the name of the operator without materializing the schema.
+  // Lazily-parsed operators only lex the leading qualified name of their
+  // schema string, so registry bookkeeping (symbol tables, duplicate
+  // checks) stays cheap during static operator registration.
+  c10::OperatorName operatorName() const {
+    return op_.fold<c10::OperatorName>(
+        [](const C10Operator& op) { return op.handle_.operator_name(); },
+        [](const JitOnlyOperator& op) {
+          return op.schema_.fold<c10::OperatorName>(
+              [](const FunctionSchema& schema) {
+                return schema.operator_name();
+              },
+              [](const UnparsedFunctionSchema& schema) {
+                return parseSchemaName(schema.schema_string_);
+              });
+        });
+  }
+
+  // Returns true iff the schema has a varargs return ("-> ..."). For
+  // lazily-parsed operators this is answered textually so that asking
+  // does not force a full schema parse.
+  bool isVarret() const {
+    return op_.fold<bool>(
+        [](const C10Operator& op) { return op.handle_.schema().is_varret(); },
+        [](const JitOnlyOperator& op) {
+          return op.schema_.fold<bool>(
+              [](const FunctionSchema& schema) { return schema.is_varret(); },
+              [](const UnparsedFunctionSchema& schema) {
+                // Return types never contain an arrow, so the last "->" in
+                // the string is the return arrow, and "..." can only appear
+                // after it as the varargs return marker.
+                auto arrow = schema.schema_string_.rfind("->");
+                return arrow != std::string::npos &&
+                    schema.schema_string_.find("...", arrow) !=
+                    std::string::npos;
+              });
+        });
+  }
+
   c10::ArrayRef<at::Tag> getTags() const {
     return op_.fold<c10::ArrayRef<at::Tag>>(
         [](const C10Operator& op) { return op.handle_.getTags(); },
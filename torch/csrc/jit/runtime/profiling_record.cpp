@@ -10,6 +10,7 @@
 #include <torch/csrc/jit/runtime/autodiff.h>
 #include <torch/csrc/jit/runtime/graph_executor.h>
 #include <torch/csrc/jit/runtime/interpreter.h>
+#include <torch/csrc/jit/runtime/shape_profile_store.h>
 namespace torch {
 namespace jit {
 
@@ -337,6 +338,18 @@ std::unique_ptr<ProfilingRecord> ProfilingRecord::instrumentGraph(
   unprofileBlock(new_g->block());
   pr->instrumentBlock(new_g->block());
 
+  if (shapeProfileStoreEnabled()) {
+    // Key off the pre-instrumentation graph: the instrumented one mutates as
+    // profiled types accumulate, so its print isn't stable across runs.
+    pr->store_key_ = shapeProfileKey(*graph);
+    if (preloadShapeProfiles(*pr)) {
+      // Every profile node was pre-seeded from yesterday's shapes; skip the
+      // profiling runs and let the executor specialize immediately. Stale
+      // shapes are caught by the usual TypeCheck guards.
+      pr->profiling_count_ = 0;
+    }
+  }
+
   std::function<void(Stack&)> counter = [raw_pr](Stack& stack) {
     int64_t frame_id = 0;
     pop(stack, frame_id);
@@ -345,6 +358,11 @@ std::unique_ptr<ProfilingRecord> ProfilingRecord::instrumentGraph(
 
     if (raw_pr->profiling_count_ > 0) {
       raw_pr->profiling_count_--;
+      if (raw_pr->profiling_count_ == 0 && !raw_pr->store_key_.empty()) {
+        // Profiling just finished; snapshot the merged types for the next
+        // process. Takes only the store's own lock.
+        recordShapeProfiles(*raw_pr);
+      }
     }
   };
 
@@ -184,6 +184,9 @@ struct ProfilingRecord {
   std::shared_ptr<Graph> profiled_graph_;
   mutable std::mutex mutex_;
   size_t profiling_count_;
+  // Database key when the persistent shape-profile store is enabled, empty
+  // otherwise. See Note [Persistent shape profiles].
+  std::string store_key_;
 
   bool ready() const;
 
@@ -0,0 +1,317 @@
+#include <torch/csrc/jit/runtime/shape_profile_store.h>
+
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/runtime/profiling_record.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+constexpr const char* kFileHeader = "torchjit-shape-profile-v1";
+
+// Profile nodes in deterministic (topological, blocks depth-first) order;
+// the same traversal is used for snapshotting and pre-seeding so entries
+// line up across processes. The run counter is also a prim::profile node
+// but has no inputs, so it is skipped here.
+void collectProfileNodes(Block* block, std::vector<ProfileOp*>& out) {
+  for (Node* n : block->nodes()) {
+    if (n->kind() == prim::profile && n->inputs().size() == 1 &&
+        n->outputs().size() == 1) {
+      out.push_back(static_cast<ProfileOp*>(n));
+    }
+    for (Block* b : n->blocks()) {
+      collectProfileNodes(b, out);
+    }
+  }
+}
+
+// An entry serializes one profile node as a single line:
+//   <seen_none> <has_tensor> [<dtype> <device> <requires_grad> <sizes>]
+// where dtype is the ScalarType integer or '?', requires_grad is 0/1/?, and
+// sizes is '?' for unknown rank or a comma-separated list whose elements are
+// either concrete dimensions or 's<id>' for run-varying ones. Symbol ids are
+// file-local; they are remapped to fresh process-local ShapeSymbols on load,
+// preserving equalities within one graph's entries. Stride properties are
+// not persisted; the executor re-derives them against today's inputs.
+std::string serializeEntry(
+    const ProfileOp* pn,
+    std::map<c10::ShapeSymbol, int64_t>& symbol_ids) {
+  std::ostringstream out;
+  out << pn->i(attr::seen_none) << ' ' << (pn->hasSeenTensor() ? 1 : 0);
+  if (!pn->hasSeenTensor()) {
+    return out.str();
+  }
+  const auto& type = pn->ty(attr::profiled_type)->expectRef<TensorType>();
+  out << ' ';
+  if (type.scalarType().has_value()) {
+    out << static_cast<int64_t>(*type.scalarType());
+  } else {
+    out << '?';
+  }
+  out << ' ';
+  if (type.device().has_value()) {
+    out << *type.device();
+  } else {
+    out << '?';
+  }
+  out << ' ';
+  if (type.requiresGrad().has_value()) {
+    out << (*type.requiresGrad() ? 1 : 0);
+  } else {
+    out << '?';
+  }
+  out << ' ';
+  const auto& sizes = type.symbolic_sizes();
+  if (!sizes.rank().has_value()) {
+    out << '?';
+  } else {
+    for (const auto i : c10::irange(*sizes.rank())) {
+      if (i != 0) {
+        out << ',';
+      }
+      const auto& s = sizes[i];
+      if (s.is_static()) {
+        out << s.static_size();
+      } else {
+        auto it = symbol_ids.find(s);
+        if (it == symbol_ids.end()) {
+          it = symbol_ids.emplace(s, (int64_t)symbol_ids.size()).first;
+        }
+        out << 's' << it->second;
+      }
+    }
+  }
+  return out.str();
+}
+
+// Returns false if the entry cannot be parsed (corrupt or future-format
+// file); the caller then treats the whole graph as absent.
+bool applyEntry(
+    const std::string& entry,
+    ProfileOp* pn,
+    std::map<int64_t, c10::ShapeSymbol>& symbols) {
+  std::istringstream in(entry);
+  int64_t seen_none = 0;
+  int64_t has_tensor = 0;
+  if (!(in >> seen_none >> has_tensor)) {
+    return false;
+  }
+  pn->i_(attr::seen_none, seen_none);
+  if (!has_tensor) {
+    return true;
+  }
+  std::string dtype_str, device_str, req_grad_str, sizes_str;
+  if (!(in >> dtype_str >> device_str >> req_grad_str >> sizes_str)) {
+    return false;
+  }
+  c10::optional<at::ScalarType> dtype;
+  if (dtype_str != "?") {
+    dtype = static_cast<at::ScalarType>(std::stoll(dtype_str));
+  }
+  c10::optional<c10::Device> device;
+  if (device_str != "?") {
+    device = c10::Device(device_str);
+  }
+  c10::optional<bool> requires_grad;
+  if (req_grad_str != "?") {
+    requires_grad = req_grad_str != "0";
+  }
+  c10::SymbolicShape sizes;
+  if (sizes_str != "?") {
+    std::vector<c10::ShapeSymbol> dims;
+    std::istringstream dims_in(sizes_str);
+    std::string dim;
+    while (std::getline(dims_in, dim, ',')) {
+      if (!dim.empty() && dim[0] == 's') {
+        int64_t id = std::stoll(dim.substr(1));
+        auto it = symbols.find(id);
+        if (it == symbols.end()) {
+          it = symbols.emplace(id, c10::ShapeSymbol::newSymbol()).first;
+        }
+        dims.push_back(it->second);
+      } else {
+        dims.push_back(c10::ShapeSymbol::fromStaticSize(std::stoll(dim)));
+      }
+    }
+    sizes = c10::SymbolicShape(std::move(dims));
+  }
+  pn->ty_(
+      attr::profiled_type,
+      TensorType::create(
+          dtype,
+          device,
+          std::move(sizes),
+          c10::VaryingShape<c10::Stride>(),
+          requires_grad));
+  pn->setHasSeenTensor(true);
+  return true;
+}
+
+class ShapeProfileStore {
+ public:
+  static ShapeProfileStore& get() {
+    static ShapeProfileStore store;
+    return store;
+  }
+
+  bool enabled() const {
+    return !path_.empty();
+  }
+
+  bool lookup(const std::string& key, std::vector<std::string>& entries) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return false;
+    }
+    entries = it->second;
+    return true;
+  }
+
+  void insert(const std::string& key, std::vector<std::string> entries) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[key] = std::move(entries);
+    dirty_ = true;
+  }
+
+ private:
+  ShapeProfileStore() {
+    const char* path = std::getenv("TORCH_JIT_SHAPE_PROFILE_DB");
+    if (path == nullptr || *path == '\0') {
+      return;
+    }
+    path_ = path;
+    load();
+    // Flushed at exit rather than on every snapshot so a process that
+    // profiles many graphs doesn't rewrite the file repeatedly. The store
+    // holds only plain strings, so the handler never touches Graphs, which
+    // may already be destroyed during static teardown.
+    std::atexit([]() { ShapeProfileStore::get().flush(); });
+  }
+
+  void load() {
+    std::ifstream in(path_);
+    if (!in) {
+      return;
+    }
+    std::string header;
+    if (!std::getline(in, header) || header != kFileHeader) {
+      GRAPH_DEBUG("Ignoring shape profile db with unknown header: ", path_);
+      return;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+      std::istringstream graph_line(line);
+      std::string key;
+      size_t num_entries = 0;
+      if (!(graph_line >> key >> num_entries)) {
+        break;
+      }
+      std::vector<std::string> entries;
+      entries.reserve(num_entries);
+      for (const auto i : c10::irange(num_entries)) {
+        (void)i;
+        if (!std::getline(in, line)) {
+          return;
+        }
+        entries.push_back(line);
+      }
+      entries_[key] = std::move(entries);
+    }
+  }
+
+  void flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!dirty_) {
+      return;
+    }
+    std::ofstream out(path_, std::ios::trunc);
+    if (!out) {
+      return;
+    }
+    out << kFileHeader << '\n';
+    for (const auto& kv : entries_) {
+      out << kv.first << ' ' << kv.second.size() << '\n';
+      for (const auto& entry : kv.second) {
+        out << entry << '\n';
+      }
+    }
+    dirty_ = false;
+  }
+
+  std::mutex mutex_;
+  std::string path_;
+  std::unordered_map<std::string, std::vector<std::string>> entries_;
+  bool dirty_ = false;
+};
+
+} // namespace
+
+bool shapeProfileStoreEnabled() {
+  return ShapeProfileStore::get().enabled();
+}
+
+std::string shapeProfileKey(const Graph& graph) {
+  // The printed IR of two structurally identical graphs built by the same
+  // deterministic frontend matches, so its hash makes a stable cross-process
+  // key. A collision hands a graph somebody else's shapes, which the
+  // TypeCheck guards then reject at runtime -- wasted work, not wrong
+  // results.
+  std::ostringstream printed;
+  printed << graph;
+  std::ostringstream key;
+  key << std::hex << std::hash<std::string>()(printed.str());
+  return key.str();
+}
+
+bool preloadShapeProfiles(ProfilingRecord& record) {
+  std::vector<std::string> entries;
+  if (!ShapeProfileStore::get().lookup(record.store_key_, entries)) {
+    return false;
+  }
+  std::vector<ProfileOp*> profile_nodes;
+  collectProfileNodes(record.graph()->block(), profile_nodes);
+  if (entries.size() != profile_nodes.size()) {
+    return false;
+  }
+  std::map<int64_t, c10::ShapeSymbol> symbols;
+  for (const auto i : c10::irange(entries.size())) {
+    if (!applyEntry(entries[i], profile_nodes[i], symbols)) {
+      return false;
+    }
+  }
+  GRAPH_DEBUG(
+      "Pre-seeded ",
+      profile_nodes.size(),
+      " profile nodes from shape profile db for key ",
+      record.store_key_);
+  return true;
+}
+
+void recordShapeProfiles(const ProfilingRecord& record) {
+  if (record.store_key_.empty()) {
+    return;
+  }
+  std::vector<ProfileOp*> profile_nodes;
+  collectProfileNodes(record.graph()->block(), profile_nodes);
+  std::vector<std::string> entries;
+  entries.reserve(profile_nodes.size());
+  std::map<c10::ShapeSymbol, int64_t> symbol_ids;
+  for (const ProfileOp* pn : profile_nodes) {
+    entries.push_back(serializeEntry(pn, symbol_ids));
+  }
+  ShapeProfileStore::get().insert(record.store_key_, std::move(entries));
+}
+
+} // namespace jit
+} // namespace torch
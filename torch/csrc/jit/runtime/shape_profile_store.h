@@ -0,0 +1,50 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+
+#include <string>
+
+// Note [Persistent shape profiles]
+// The profiling executor re-learns shapes from scratch in every process: the
+// first getNumProfiledRuns() iterations of each graph run unspecialized while
+// prim::profile nodes collect TensorTypes, and only then do the fusers see
+// specialized shapes. For services that redeploy often, the long tail of
+// shapes seen yesterday goes through the slow profiling iterations again
+// after every restart.
+//
+// When TORCH_JIT_SHAPE_PROFILE_DB is set to a file path, the merged profiled
+// types of every graph that finishes profiling are snapshotted into an
+// in-memory database keyed by a hash of the graph's IR, and written back to
+// the file at process exit. At the next startup the file is loaded, and
+// instrumented graphs whose key is present have their profile nodes
+// pre-seeded from the database and skip the profiling runs entirely.
+//
+// This is purely a warm-start: the pre-seeded types flow into the same guard
+// (TypeCheck) machinery as freshly profiled ones, so a stale database -- or
+// even a key collision -- only costs a guard failure and a deoptimized
+// re-profile, never a wrong result.
+
+namespace torch {
+namespace jit {
+
+struct Graph;
+struct ProfilingRecord;
+
+// Whether TORCH_JIT_SHAPE_PROFILE_DB is set (checked once per process).
+TORCH_API bool shapeProfileStoreEnabled();
+
+// Database key for a graph, computed from its IR before instrumentation.
+TORCH_API std::string shapeProfileKey(const Graph& graph);
+
+// Pre-seeds the profile nodes of a freshly instrumented record from the
+// database. Returns true if every profile node received a stored entry, in
+// which case the caller may skip the profiling runs.
+TORCH_API bool preloadShapeProfiles(ProfilingRecord& record);
+
+// Snapshots the merged profiled types of a record that just finished
+// profiling into the in-memory database. Called with the record's mutex
+// held; only takes the store's own lock.
+TORCH_API void recordShapeProfiles(const ProfilingRecord& record);
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,22 @@
+#include <torch/csrc/jit/runtime/static/cuda_graph.h>
+
+#include <atomic>
+
+namespace torch {
+namespace jit {
+
+namespace {
+std::atomic<CudaGraphCapturerFactory> cuda_graph_capturer_factory{nullptr};
+} // namespace
+
+void setCudaGraphCapturerFactory(CudaGraphCapturerFactory factory) {
+  cuda_graph_capturer_factory.store(factory);
+}
+
+std::unique_ptr<CudaGraphCapturer> createCudaGraphCapturer() {
+  auto* factory = cuda_graph_capturer_factory.load();
+  return factory != nullptr ? factory() : nullptr;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+
+#include <functional>
+#include <memory>
+
+namespace torch {
+namespace jit {
+
+// [Note: Static Runtime CUDA graphs]
+// Static Runtime's MemoryPlanner gives every managed tensor a stable
+// address across iterations, which is exactly the invariant CUDA graph
+// replay needs. When `StaticModuleOptions::enable_cuda_graphs` is set,
+// the runtime executes eagerly for a few warm-up iterations, captures its
+// op sequence into a CUDA graph, and replays the graph on subsequent
+// calls with matching input shapes, collapsing one kernel launch per op
+// into a single graph launch. A new graph is captured per distinct
+// input-shape bucket.
+//
+// Static Runtime is compiled into the CPU library, which cannot reference
+// at::cuda::CUDAGraph directly. Instead, the CUDA library registers a
+// capturer factory here from a static initializer in cuda_graph_impl.cpp
+// (the same load-time wiring used by register_cuda_ops.cpp), and the
+// runtime falls back to eager execution when no factory was registered.
+struct TORCH_API CudaGraphCapturer {
+  virtual ~CudaGraphCapturer() = default;
+
+  // Synchronizes the device, then runs `fn` once under stream capture on
+  // a side stream. CUDA kernels launched by `fn` are recorded into the
+  // graph without executing; host-side work runs eagerly.
+  virtual void capture(const std::function<void()>& fn) = 0;
+
+  // Replays the captured kernels on the current stream.
+  virtual void replay() = 0;
+};
+
+using CudaGraphCapturerFactory = std::unique_ptr<CudaGraphCapturer> (*)();
+
+TORCH_API void setCudaGraphCapturerFactory(CudaGraphCapturerFactory factory);
+
+// Returns nullptr when no CUDA backend has registered a factory.
+TORCH_API std::unique_ptr<CudaGraphCapturer> createCudaGraphCapturer();
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,45 @@
+#include <torch/csrc/jit/runtime/static/cuda_graph.h>
+
+#include <ATen/cuda/CUDAGraph.h>
+#include <c10/cuda/CUDAFunctions.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAStream.h>
+
+namespace torch {
+namespace jit {
+namespace {
+
+// See [Note: Static Runtime CUDA graphs]
+struct CudaGraphCapturerImpl : public CudaGraphCapturer {
+  void capture(const std::function<void()>& fn) override {
+    // Capture is not allowed on the default stream, and all warm-up work
+    // must have completed before it begins.
+    at::cuda::CUDAStream capture_stream = at::cuda::getStreamFromPool();
+    c10::cuda::device_synchronize();
+    c10::cuda::CUDAStreamGuard guard(capture_stream);
+    graph_.capture_begin();
+    fn();
+    graph_.capture_end();
+  }
+
+  void replay() override {
+    graph_.replay();
+  }
+
+  at::cuda::CUDAGraph graph_;
+};
+
+std::unique_ptr<CudaGraphCapturer> createCapturer() {
+  return std::make_unique<CudaGraphCapturerImpl>();
+}
+
+struct RegisterCapturerFactory {
+  RegisterCapturerFactory() {
+    setCudaGraphCapturerFactory(&createCapturer);
+  }
+};
+RegisterCapturerFactory register_capturer_factory;
+
+} // namespace
+} // namespace jit
+} // namespace torch
@@ -34,8 +34,10 @@
 #include <ATen/ops/clone_native.h>
 #endif
 
+#include <condition_variable>
 #include <iterator>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 
@@ -559,6 +561,14 @@ StaticModule::StaticModule(
         opts_.enable_out_variant,
         "When optimize_memory is true, enable_out_variant must be set to true");
   }
+  if (opts_.enable_parallel_op_execution) {
+    // Storage re-use gives tensors with non-overlapping lifetimes the same
+    // backing storage, where lifetimes are computed assuming sequential
+    // execution order; see Note [Parallel op execution].
+    TORCH_CHECK(
+        !opts_.optimize_memory,
+        "When enable_parallel_op_execution is true, optimize_memory must be set to false");
+  }
 
   // handle schema
   if (module_.has_value()) {
@@ -604,6 +614,9 @@ StaticModule::StaticModule(
   for (auto& block_and_info : block_infos_) {
     auto& block_info = block_and_info.second;
     block_info.prepare_for_memory_planner(alias_db, opts);
+    if (opts_.enable_parallel_op_execution) {
+      block_info.compute_parallel_schedule(alias_db);
+    }
   }
 }
 
@@ -812,6 +825,91 @@ void BlockInfo::prepare_for_memory_planner(
       ManagedTensorRanges(block_, alias_db, managed_tensor_values_);
 }
 
+// Note [Parallel op execution]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Graphs with wide independent branches (e.g. multi-tower ranking models)
+// leave most of the inter-op pool idle when nodes run strictly sequentially.
+// When enable_parallel_op_execution is set, each block's node list is
+// partitioned at load time into dependency levels: a node's level is one
+// greater than the maximum level of the nodes producing its inputs, computed
+// from the ProcessedNodeInputs/outputs_offset dataflow. At runtime the block
+// runner executes the levels in order, running the nodes within a level
+// concurrently on the inter-op pool and joining before the next level starts.
+//
+// Two kinds of nodes cannot be freely reordered against their neighbors and
+// are treated as barriers (a level of their own, after every earlier node and
+// before every later one):
+//   - nodes that mutate values per the AliasDb, since the value-index
+//     dataflow does not capture write-after-read hazards through aliases;
+//   - nodes with sub-blocks (prim::If/prim::Loop), since their bodies read
+//     outer values that do not appear among the node's inputs.
+// Storage re-use (optimize_memory) is incompatible with this mode because
+// tensor lifetimes are computed assuming sequential order, so the StaticModule
+// constructor rejects the combination.
+void BlockInfo::compute_parallel_schedule(const AliasDb& alias_db) {
+  parallel_schedule_.clear();
+  const auto num_nodes = nodes_.size();
+  if (num_nodes < 2) {
+    return;
+  }
+  // Maps each value index to the node that produces it.
+  FastMap<uint32_t, uint32_t> producing_node;
+  for (const auto node_idx : c10::irange(num_nodes)) {
+    const auto& pnode = nodes_[node_idx];
+    for (const auto i : c10::irange(pnode.num_outputs())) {
+      producing_node.emplace(pnode.output_ivalue_index(i), node_idx);
+    }
+  }
+
+  std::vector<uint32_t> level(num_nodes, 0);
+  uint32_t num_levels = 0;
+  // All nodes preceding the most recent barrier have levels below this.
+  uint32_t barrier_level = 0;
+  for (const auto node_idx : c10::irange(num_nodes)) {
+    const auto& pnode = nodes_[node_idx];
+    auto lvl = barrier_level;
+    for (const auto i : c10::irange(pnode.inputs().size())) {
+      const auto it = producing_node.find(pnode.inputs()[i]);
+      if (it != producing_node.end()) {
+        lvl = std::max(lvl, level[it->second] + 1);
+      }
+    }
+    auto* node = pnode.node();
+    const bool is_barrier =
+        !node->blocks().empty() || alias_db.isMutable(node);
+    if (is_barrier) {
+      for (const auto prev_idx : c10::irange(node_idx)) {
+        lvl = std::max(lvl, level[prev_idx] + 1);
+      }
+      barrier_level = lvl + 1;
+    }
+    level[node_idx] = lvl;
+    num_levels = std::max(num_levels, lvl + 1);
+  }
+
+  parallel_schedule_.resize(num_levels);
+  for (const auto node_idx : c10::irange(num_nodes)) {
+    parallel_schedule_[level[node_idx]].push_back(node_idx);
+  }
+  const bool has_parallelism = std::any_of(
+      parallel_schedule_.begin(),
+      parallel_schedule_.end(),
+      [](const auto& nodes) { return nodes.size() > 1; });
+  if (!has_parallelism) {
+    // Every level is a single node; the sequential executor is strictly
+    // cheaper.
+    parallel_schedule_.clear();
+    GRAPH_DEBUG("Block has no exploitable parallelism");
+    return;
+  }
+  GRAPH_DEBUG(
+      "Parallel schedule with ",
+      num_levels,
+      " levels for ",
+      num_nodes,
+      " nodes");
+}
+
 const StaticModuleOptions& StaticModule::opts() const {
   return opts_;
 }
@@ -870,7 +968,8 @@ BlockRunner::BlockRunner(
       // TODO(T108633124): Turn on manage output tensors for sub-blocks.
       manage_output_tensors_enabled_(
           is_root_block_ && sm.opts().manage_output_tensors),
-      values_(values) {
+      values_(values),
+      launcher_(launcher) {
   nodes_.reserve(block_info_.nodes().size());
   for (auto& pre_pnode : block_info_.nodes()) {
     nodes_.emplace_back(pre_pnode, values_);
@@ -1206,6 +1305,61 @@ void BlockRunner::Deallocator::cleanupImpl() {
   }
 }
 
+// See Note [Parallel op execution]
+void BlockRunner::run_nodes_parallel() {
+  struct LevelState {
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    size_t remaining{0};
+    std::exception_ptr error;
+  };
+  LevelState state;
+
+  auto run_node = [this, &state](uint32_t node_idx) {
+    try {
+      auto& n = nodes_[node_idx];
+      n.run();
+      // Check for incorrect schema alias info.
+      verify_and_correct_memory_overlap(n);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      if (!state.error) {
+        state.error = std::current_exception();
+      }
+    }
+  };
+
+  for (const auto& level : block_info_.parallel_schedule()) {
+    if (level.size() == 1) {
+      run_node(level[0]);
+    } else {
+      state.remaining = level.size() - 1;
+      for (size_t i = 1; i < level.size(); ++i) {
+        const auto node_idx = level[i];
+        (*launcher_)([&run_node, &state, node_idx]() {
+          // InferenceMode is thread local; the pool threads are not covered
+          // by the guard in run_impl.
+          c10::InferenceMode mode;
+          run_node(node_idx);
+          {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            --state.remaining;
+          }
+          state.done_cv.notify_one();
+        });
+      }
+      run_node(level[0]);
+      std::unique_lock<std::mutex> lock(state.mutex);
+      state.done_cv.wait(lock, [&state] { return state.remaining == 0; });
+    }
+    // Do not start the next level (or unwind while pool threads may still
+    // reference this frame) until the whole level has drained.
+    if (C10_UNLIKELY(state.error)) {
+      std::rethrow_exception(state.error);
+    }
+  }
+}
+
 template <typename IValueList>
 c10::IValue BlockRunner::run_impl(
     IValueList&& args,
@@ -1226,11 +1380,15 @@ c10::IValue BlockRunner::run_impl(
 
     set_inputs(std::forward<IValueList>(args), kwargs);
 
-    for (auto& n : nodes_) {
-      // LOG(INFO) << "Running node: " << PrintNode(n.node());
-      n.run();
-      // Check for incorrect schema alias info.
-      verify_and_correct_memory_overlap(n);
+    if (C10_UNLIKELY(!block_info_.parallel_schedule().empty())) {
+      run_nodes_parallel();
+    } else {
+      for (auto& n : nodes_) {
+        // LOG(INFO) << "Running node: " << PrintNode(n.node());
+        n.run();
+        // Check for incorrect schema alias info.
+        verify_and_correct_memory_overlap(n);
+      }
     }
     on_exit.setFinished();
   }
@@ -2145,17 +2303,135 @@ StaticRuntime::StaticRuntime(const StaticModule& sm)
       sm.root_block(),
       &async_task_launcher_,
       true /*is_root_block*/);
+  if (sm.opts().enable_cuda_graphs) {
+    TORCH_CHECK(
+        !sm.opts().manage_output_tensors,
+        "enable_cuda_graphs is incompatible with manage_output_tensors: "
+        "deallocating output tensors would free addresses baked into the "
+        "captured graphs");
+    TORCH_CHECK(
+        !sm.opts().enable_parallel_op_execution,
+        "enable_cuda_graphs is incompatible with "
+        "enable_parallel_op_execution: kernels launched from worker "
+        "threads are not recorded by stream capture");
+    cuda_graphs_enabled_ = true;
+  }
+}
+
+namespace {
+
+// See [Note: Static Runtime CUDA graphs]
+constexpr size_t kCudaGraphWarmupRuns = 3;
+constexpr size_t kMaxCapturedCudaGraphs = 8;
+
+bool hasCudaTensorArg(const std::vector<c10::IValue>& args) {
+  return std::any_of(args.begin(), args.end(), [](const c10::IValue& arg) {
+    return arg.isTensor() && arg.toTensor().is_cuda();
+  });
+}
+
+// Shape-bucket match: tensors must agree on sizes, dtype, and device
+// (fresh data is copied into the captured tensors before replay), and
+// non-tensor inputs must be equal outright, since their values are baked
+// into the captured kernels.
+bool matchesCapturedArgs(
+    const std::vector<c10::IValue>& captured,
+    const std::vector<c10::IValue>& args) {
+  if (captured.size() != args.size()) {
+    return false;
+  }
+  for (const auto i : c10::irange(args.size())) {
+    const auto& expected = captured[i];
+    const auto& actual = args[i];
+    if (expected.isTensor()) {
+      if (!actual.isTensor()) {
+        return false;
+      }
+      const auto& expected_tensor = expected.toTensor();
+      const auto& actual_tensor = actual.toTensor();
+      if (expected_tensor.sizes() != actual_tensor.sizes() ||
+          expected_tensor.scalar_type() != actual_tensor.scalar_type() ||
+          expected_tensor.device() != actual_tensor.device()) {
+        return false;
+      }
+    } else if (expected != actual) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+c10::IValue StaticRuntime::run_with_cuda_graph(
+    const std::vector<c10::IValue>& args,
+    const KeywordArgs& kwargs) {
+  // Graphs are only replayed for positional calls whose inputs touch the
+  // GPU; anything else runs eagerly.
+  if (!kwargs.empty() || !hasCudaTensorArg(args)) {
+    return (*block_)(args, kwargs);
+  }
+  CapturedGraph* entry = nullptr;
+  for (auto& candidate : captured_graphs_) {
+    if (matchesCapturedArgs(candidate->args, args)) {
+      entry = candidate.get();
+      break;
+    }
+  }
+  if (entry == nullptr) {
+    if (captured_graphs_.size() == kMaxCapturedCudaGraphs) {
+      // Too many distinct shape buckets; don't thrash on re-captures.
+      return (*block_)(args, kwargs);
+    }
+    captured_graphs_.emplace_back(std::make_unique<CapturedGraph>());
+    entry = captured_graphs_.back().get();
+    entry->warmup_runs_left = kCudaGraphWarmupRuns;
+  }
+  if (entry->capturer == nullptr) {
+    entry->args = args;
+    if (entry->warmup_runs_left > 0) {
+      --entry->warmup_runs_left;
+      return (*block_)(args, kwargs);
+    }
+    auto capturer = createCudaGraphCapturer();
+    if (capturer == nullptr) {
+      LOG(WARNING) << "enable_cuda_graphs was set, but no CUDA backend is "
+                      "loaded; running eagerly";
+      cuda_graphs_enabled_ = false;
+      return (*block_)(args, kwargs);
+    }
+    // Capture records the kernels without executing them, so replay once
+    // to actually produce this call's output.
+    capturer->capture([&]() { entry->output = (*block_)(args, kwargs); });
+    entry->capturer = std::move(capturer);
+    entry->capturer->replay();
+    return entry->output;
+  }
+  for (const auto i : c10::irange(args.size())) {
+    if (entry->args[i].isTensor()) {
+      entry->args[i].toTensor().copy_(
+          args[i].toTensor(), /*non_blocking=*/true);
+    }
+  }
+  entry->capturer->replay();
+  return entry->output;
 }
 
 c10::IValue StaticRuntime::operator()(
     const std::vector<c10::IValue>& args,
     const KeywordArgs& kwargs) {
+  if (C10_UNLIKELY(cuda_graphs_enabled_)) {
+    return run_with_cuda_graph(args, kwargs);
+  }
   return (*block_)(args, kwargs);
 }
 
 c10::IValue StaticRuntime::operator()(
     std::vector<c10::IValue>&& args,
     const KeywordArgs& kwargs) {
+  if (C10_UNLIKELY(cuda_graphs_enabled_)) {
+    return run_with_cuda_graph(args, kwargs);
+  }
   return (*block_)(std::move(args), kwargs);
 }
 
@@ -13,6 +13,7 @@
 #include <torch/csrc/jit/passes/freeze_module.h>
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/runtime/static/ProcessedNodeInputs.h>
+#include <torch/csrc/jit/runtime/static/cuda_graph.h>
 #include <torch/custom_class.h>
 #include <limits>
 
@@ -186,6 +187,26 @@ struct TORCH_API StaticModuleOptions {
   bool use_maybe_copy_variants{true};
   // enable TensorExpr fusion of ops at model loading time
   bool enable_tensorexpr_fusion{false};
+  // Partition each block's node list into dependency levels at load time and
+  // run the nodes within a level concurrently on the inter-op thread pool.
+  // Only profitable for graphs with wide independent branches (e.g.
+  // multi-tower models); blocks without exploitable parallelism fall back to
+  // the sequential executor. Requires optimize_memory to be false, since
+  // storage re-use assumes sequential execution order.
+  // See Note [Parallel op execution].
+  bool enable_parallel_op_execution{false};
+  // Capture the op sequence into a CUDA graph after a few warm-up
+  // iterations and replay it afterwards, collapsing one kernel launch
+  // per op into a single graph launch. A graph is captured per distinct
+  // input-shape bucket; replays copy the new inputs into the captured
+  // input tensors and return (and overwrite) the same output tensors on
+  // every call, so callers must consume outputs before the next call.
+  // All ops must run on the GPU and be capturable (no stream
+  // synchronization), and only synchronous `StaticRuntime::operator()`
+  // calls with positional arguments replay graphs. Incompatible with
+  // manage_output_tensors and enable_parallel_op_execution.
+  // See [Note: Static Runtime CUDA graphs].
+  bool enable_cuda_graphs{false};
 };
 
 /*
@@ -340,6 +361,15 @@ class BlockInfo {
       const AliasDb& alias_db,
       const StaticModuleOptions& opt);
 
+  // See Note [Parallel op execution]
+  void compute_parallel_schedule(const AliasDb& alias_db);
+
+  // The node indices of each dependency level, in execution order. Empty if
+  // the block is executed sequentially.
+  const std::vector<std::vector<uint32_t>>& parallel_schedule() const {
+    return parallel_schedule_;
+  }
+
   const auto& managed_output_tensor_values() const {
     return managed_output_tensor_values_;
   }
@@ -364,6 +394,8 @@ class BlockInfo {
 
   ManagedTensorRanges managed_tensor_ranges_{};
 
+  std::vector<std::vector<uint32_t>> parallel_schedule_;
+
   // The index of this block's inputs in the shared values_ array.
   const uint16_t input_idx_;
   // The indices of this block's outputs in the shared values_ array.
@@ -698,6 +730,10 @@ class TORCH_API BlockRunner {
   template <typename IValueList>
   c10::IValue run_impl(IValueList&& args, const KeywordArgs& kwargs);
 
+  // Executes the nodes level by level according to
+  // block_info_.parallel_schedule(). See Note [Parallel op execution].
+  void run_nodes_parallel();
+
   template <typename IValueList>
   c10::IValue run_impl_record_functions(
       IValueList&& args,
@@ -780,6 +816,10 @@ class TORCH_API BlockRunner {
   // knows how to find the indices of its outputs/inputs in this array.
   IValue* values_;
 
+  // The launcher used to run levels of the parallel schedule (and async ops)
+  // on the inter-op thread pool.
+  torch::jit::TaskLauncher* launcher_;
+
   std::vector<IValue*> outputs_;
   std::vector<ProcessedNode> nodes_;
 };
@@ -843,6 +883,15 @@ class TORCH_API StaticNodeInfo {
     return fn_->kind() == ProcessedFunction::Kind::kOutVariant;
   }
 
+  const ProcessedNodeInputs& inputs() const {
+    return inputs_;
+  }
+
+  uint16_t output_ivalue_index(uint16_t i) const {
+    DCHECK(i < num_outputs());
+    return outputs_offset_ + i;
+  }
+
  private:
   friend class ProcessedNode;
 
@@ -1109,6 +1158,22 @@ class TORCH_API StaticRuntime {
   }
 
  private:
+  // One captured CUDA graph and the tensors whose addresses are baked
+  // into it; see [Note: Static Runtime CUDA graphs]. `args` holds the
+  // capture-time inputs (replays copy fresh data into the tensors among
+  // them) and doubles as the shape bucket key. `output` is produced by
+  // the captured kernels in place, so it is returned by every replay.
+  struct CapturedGraph {
+    std::unique_ptr<CudaGraphCapturer> capturer;
+    std::vector<c10::IValue> args;
+    c10::IValue output;
+    size_t warmup_runs_left;
+  };
+
+  c10::IValue run_with_cuda_graph(
+      const std::vector<c10::IValue>& args,
+      const KeywordArgs& kwargs);
+
   // An array of IValues with unchanging size/data ptr.
   class IValueArray {
    public:
@@ -1143,6 +1208,8 @@ class TORCH_API StaticRuntime {
   // for execution of async operations present in graph
   torch::jit::TaskLauncher async_task_launcher_;
   IValueArray values_;
+  std::vector<std::unique_ptr<CapturedGraph>> captured_graphs_;
+  bool cuda_graphs_enabled_ = false;
 };
 
 } // namespace jit
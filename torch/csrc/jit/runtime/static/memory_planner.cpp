@@ -1,4 +1,5 @@
 #include <c10/core/alignment.h>
+#include <c10/util/llvmMathExtras.h>
 #include <torch/csrc/jit/runtime/static/memory_planner.h>
 
 #include <ATen/Tensor.h>
@@ -62,6 +63,30 @@ size_t compute_aligned_tensor_size(size_t nbytes) {
   return (nbytes + c10::gAlignment - 1) & (~(c10::gAlignment - 1));
 }
 
+// Note [Bucketed tensor size classes]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The planner sizes its arenas from the high watermark of the previous
+// iterations. When input batch sizes vary continuously, the watermark of some
+// storage group creeps up by a few elements on many iterations, so the total
+// buffer size keeps changing and the caching allocator (whose free lists are
+// keyed by allocation size) misses nearly every time, degenerating into a
+// malloc/free pair per iteration. To avoid this, watermarks are recorded
+// rounded up to a size class: multiples of the tensor alignment for small
+// sizes, and jemalloc-style classes at every 1/8 step between powers of two
+// above that. Any batch whose tensors fit in the current classes reuses the
+// same arena, at the cost of at most 12.5% slack per storage group.
+constexpr size_t kSizeClassGranularityThreshold = 512;
+
+size_t round_up_to_size_class(size_t nbytes) {
+  if (nbytes <= kSizeClassGranularityThreshold) {
+    return compute_aligned_tensor_size(nbytes);
+  }
+  const uint64_t step = c10::llvm::PowerOf2Ceil(nbytes) >> 3;
+  // step is a power of two no smaller than the tensor alignment, so the
+  // result stays aligned.
+  return (nbytes + step - 1) & (~(step - 1));
+}
+
 at::DataPtr allocate_buffer(size_t size) {
   at::Allocator* allocator = c10::GetCPUCachingAllocator();
   return allocator->allocate(size);
@@ -324,7 +349,8 @@ void MemoryPlanner::deallocateOutputTensors() {
         compute_aligned_tensor_size(tensor->storage().nbytes());
     tensor->storage().unsafeGetStorageImpl()->reset();
     if (current_size > ms.first) {
-      ms.first = current_size;
+      // See Note [Bucketed tensor size classes]
+      ms.first = round_up_to_size_class(current_size);
     }
     output_buffer_bytes += ms.first;
   }
@@ -467,7 +493,11 @@ void StandardMemoryPlanner::deallocateManagedTensors() {
     // the tensor size from the previous run to allocate tensors for the next
     // run (following C2 tradition), exploiting the fact that tensor storage
     // size does not have to match that of real tensor size. The following logic
-    // records the tensor storage size for the next run.
+    // records the tensor storage size for the next run. The watermark is
+    // rounded up to a size class so that varying batch sizes within a bucket
+    // keep the total buffer size (and hence the allocator's cached buffer)
+    // stable; see Note [Bucketed tensor size classes].
+    max = round_up_to_size_class(max);
     managed_tensor_storage_impls_[group_idx++].first = max;
     ms.setMaxTensorSize(max);
     managed_bytes_ += max;
@@ -150,6 +150,8 @@ mobile::Code compileGraphToMobileCode(
   // operator names
   std::vector<std::string> method_names;
   std::vector<int64_t> op_debug_handles;
+  // built here, published into mobile_code.operators_ wholesale at the end
+  std::vector<std::function<void(Stack&)>> operators;
   int next_new_op_index = 0;
 
   auto op_to_specified_args = code.op_to_num_specified_args();
@@ -179,7 +181,7 @@ mobile::Code compileGraphToMobileCode(
           "Operator with name: ",
           toString(opname),
           " not found");
-      mobile_code.operators_.emplace_back(*func);
+      operators.emplace_back(*func);
       next_new_op_index++;
     }
     // CALL nodes at this point represent built-in (i.e. non-Graph)
@@ -243,6 +245,9 @@ mobile::Code compileGraphToMobileCode(
 
   mobile_code.types_ = code.type_table();
   mobile_code.register_size_ = code.register_size();
+  mobile_code.operators_ =
+      std::make_shared<const std::vector<std::function<void(Stack&)>>>(
+          std::move(operators));
   return mobile_code;
 }
 
@@ -38,6 +38,7 @@
 #include <ATen/ATen.h>
 #include <fmt/format.h>
 
+#include <cstdlib>
 #include <fstream>
 #include <string>
 #include <unordered_map>
@@ -77,6 +78,45 @@ void postSetStateValidate(const IValue& v) {
 
 namespace {
 
+// Note [mmap'd module loading]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// When PYTORCH_JIT_MMAP_WEIGHTS is set, file-based torch::jit::load maps the
+// archive with a private copy-on-write mapping and builds tensor storages
+// directly over it instead of copying every record out of the zip, so load
+// time and peak RSS no longer scale with checkpoint size.
+// PyTorchStreamWriter stores records uncompressed and 64-byte aligned, which
+// is what makes the in-place storages valid (see the layout notes in
+// caffe2/serialize/inline_container.h); compressed records produced by
+// foreign zip tools silently fall back to the copying path. Writing to a
+// loaded tensor copies only that tensor's pages via the kernel's
+// copy-on-write machinery. The mapping is kept alive by the returned Module,
+// so tensors handed out by it must not outlive the module.
+bool useMmapWeights() {
+  static const char* enabled = std::getenv("PYTORCH_JIT_MMAP_WEIGHTS");
+  return enabled != nullptr && enabled[0] != '0';
+}
+
+#if defined(HAVE_MMAP)
+std::tuple<std::shared_ptr<char>, size_t> mmapFilePrivate(
+    const std::string& filename) {
+  int fd = open(filename.c_str(), O_RDONLY);
+  TORCH_CHECK(
+      fd >= 0, "could not open ", filename, " for mmap (errno ", errno, ")");
+  struct stat statbuf {};
+  fstat(fd, &statbuf);
+  size_t size = statbuf.st_size;
+  // PROT_WRITE with MAP_PRIVATE: pages stay shared with the page cache until
+  // they are written, at which point just the touched pages are copied.
+  void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  TORCH_CHECK(
+      ptr != MAP_FAILED, "could not mmap ", filename, " (errno ", errno, ")");
+  std::shared_ptr<char> data(
+      static_cast<char*>(ptr), [size](char* p) { munmap(p, size); });
+  return std::make_tuple(std::move(data), size);
+}
+#endif
+
 // This is a deserializer class which loads script modules from pt files.
 // Content of the file is written using PyTorchStreamWriter, for details please
 // check caffe2/serialize/inline_container.h.
@@ -429,6 +469,22 @@ Module import_ir_module(
   // NOTE: Zipformat can be large files. So using stream version directly
   // instead of reading the file all at once.
   if (getFileFormat(filename) != FileFormat::FlatbufferFileFormat) {
+#if defined(HAVE_MMAP)
+    if (useMmapWeights()) {
+      // See Note [mmap'd module loading]
+      std::shared_ptr<char> data;
+      size_t size = 0;
+      std::tie(data, size) = mmapFilePrivate(filename);
+      auto rai = std::make_unique<MemoryReadAdapter>(data.get(), size);
+      auto reader = torch::make_unique<PyTorchStreamReader>(std::move(rai));
+      reader->setShouldLoadDebugSymbol(load_debug_files);
+      reader->setInMemoryData(data.get(), size);
+      ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
+      Module m = deserializer.deserialize(device, extra_files, restore_shapes);
+      m.set_delete_memory(std::move(data));
+      return m;
+    }
+#endif
     auto reader = torch::make_unique<PyTorchStreamReader>(filename);
     reader->setShouldLoadDebugSymbol(load_debug_files);
     ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
@@ -1,8 +1,104 @@
+#include <c10/util/irange.h>
 #include <caffe2/serialize/inline_container.h>
 #include <torch/csrc/jit/serialization/import_read.h>
 
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 namespace torch::jit {
 
+namespace {
+
+// Note [Content-addressed weight sharing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// When PYTORCH_JIT_DEDUP_WEIGHTS is set, tensor records whose payloads are
+// byte-identical share a single allocation across every torch::jit::load in
+// the process, so a fleet hosting many fine-tunes of one base model pays for
+// the unchanged base weights once instead of per variant. Candidates are
+// found via a 64-bit content hash and confirmed with memcmp before aliasing,
+// and the registry keeps only weak references, so a payload is freed once
+// the last module using it goes away. The aliases genuinely share pages --
+// there is no copy-on-write upgrade at the StorageImpl level -- so this must
+// only be enabled in inference processes that treat loaded weights as
+// read-only: a write through any alias is visible to all of them.
+bool useDedupWeights() {
+  static const char* enabled = std::getenv("PYTORCH_JIT_DEDUP_WEIGHTS");
+  return enabled != nullptr && enabled[0] != '0';
+}
+
+uint64_t hashRecordBytes(const char* data, size_t size) {
+  // FNV-1a. The zip reader checksums records with CRC32 but miniz does not
+  // surface the digests, and one pass over freshly-read bytes is cheap
+  // relative to the read itself.
+  uint64_t h = 14695981039346656037ull;
+  for (size_t i = 0; i < size; ++i) {
+    h = (h ^ static_cast<uint8_t>(data[i])) * 1099511628211ull;
+  }
+  return h;
+}
+
+void deleteSharedRecord(void* ctx) {
+  delete static_cast<std::shared_ptr<at::DataPtr>*>(ctx);
+}
+
+class DedupedRecordRegistry {
+ public:
+  static DedupedRecordRegistry& singleton() {
+    static DedupedRecordRegistry registry;
+    return registry;
+  }
+
+  // Returns a DataPtr aliasing an already-loaded identical payload if one is
+  // still alive; otherwise registers `data` and returns an alias of it.
+  at::DataPtr dedup(at::DataPtr data, size_t size) {
+    if (data.device() != at::kCPU || size == 0) {
+      return data;
+    }
+    const uint64_t hash =
+        hashRecordBytes(static_cast<const char*>(data.get()), size);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto range = entries_.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+      auto held = it->second.data.lock();
+      if (!held) {
+        it = entries_.erase(it);
+        continue;
+      }
+      if (it->second.size == size &&
+          std::memcmp(held->get(), data.get(), size) == 0) {
+        return makeAlias(std::move(held));
+      }
+      ++it;
+    }
+    auto held = std::make_shared<at::DataPtr>(std::move(data));
+    entries_.emplace(hash, Entry{held, size});
+    return makeAlias(std::move(held));
+  }
+
+ private:
+  struct Entry {
+    std::weak_ptr<at::DataPtr> data;
+    size_t size;
+  };
+
+  static at::DataPtr makeAlias(std::shared_ptr<at::DataPtr> held) {
+    void* ptr = held->get();
+    return at::DataPtr(
+        ptr,
+        new std::shared_ptr<at::DataPtr>(std::move(held)),
+        &deleteSharedRecord,
+        at::kCPU);
+  }
+
+  std::mutex mutex_;
+  std::unordered_multimap<uint64_t, Entry> entries_;
+};
+
+} // namespace
+
 IValue readArchiveAndTensors(
     const std::string& archive_name,
     const std::string& pickle_prefix,
@@ -35,9 +131,43 @@ IValue readArchiveAndTensors(
   std::string tensor_dir_path =
       (!tensor_prefix.empty()) ? tensor_prefix : archive_name + "/";
 
+  // Bulk-read the archive's tensor records up front so the reads can go wide
+  // (see PyTorchStreamReader::getRecordsParallel); the unpickler then just
+  // picks the buffers out of the map as it encounters each storage. Skipped
+  // when a storage context shares storages across archives, since most
+  // records may already be materialized there.
+  std::unordered_map<std::string, std::tuple<at::DataPtr, size_t>> prefetched;
+  if (storage_context == nullptr) {
+    std::vector<std::string> tensor_names;
+    for (const auto& record : stream_reader.getAllRecords()) {
+      if (record.compare(0, tensor_dir_path.size(), tensor_dir_path) == 0) {
+        tensor_names.push_back(record);
+      }
+    }
+    auto records = stream_reader.getRecordsParallel(tensor_names);
+    for (const auto i : c10::irange(tensor_names.size())) {
+      prefetched.emplace(
+          tensor_names[i].substr(tensor_dir_path.size()),
+          std::move(records[i]));
+    }
+  }
+
   auto read_record = [&](const std::string& name) {
-    std::string ss = tensor_dir_path + name;
-    return std::get<0>(stream_reader.getRecord(ss));
+    at::DataPtr data;
+    size_t size = 0;
+    auto it = prefetched.find(name);
+    if (it != prefetched.end()) {
+      std::tie(data, size) = std::move(it->second);
+      prefetched.erase(it);
+    } else {
+      std::string ss = tensor_dir_path + name;
+      std::tie(data, size) = stream_reader.getRecord(ss);
+    }
+    if (useDedupWeights()) {
+      // See Note [Content-addressed weight sharing]
+      return DedupedRecordRegistry::singleton().dedup(std::move(data), size);
+    }
+    return data;
   };
 
   Unpickler unpickler(
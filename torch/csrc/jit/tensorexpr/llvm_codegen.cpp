@@ -55,9 +55,11 @@
 #include <llvm/Support/TypeSize.h>
 #endif
 
+#include <c10/util/hash.h>
 #include <torch/csrc/jit/tensorexpr/expr.h>
 #include <torch/csrc/jit/tensorexpr/external_functions_registry.h>
 #include <torch/csrc/jit/tensorexpr/half_support.h>
+#include <torch/csrc/jit/tensorexpr/hash_provider.h>
 #include <torch/csrc/jit/tensorexpr/ir.h>
 #include <torch/csrc/jit/tensorexpr/ir_printer.h>
 #include <torch/csrc/jit/tensorexpr/tensor.h>
@@ -66,6 +68,7 @@
 #include <torch/csrc/jit/jit_log.h>
 
 #include <memory>
+#include <sstream>
 
 using namespace torch::jit::tensorexpr;
 
@@ -74,6 +77,11 @@ C10_DEFINE_bool(
     false,
     "Use fast (but slightly less accurate) implementations of tanh and sigmoid");
 
+C10_DEFINE_bool(
+    torch_jit_llvm_prefer_wide_vectors,
+    false,
+    "Allow 512-bit vectorization of NNC kernels on AVX-512 capable targets");
+
 namespace torch::jit::tensorexpr {
 
 c10::optional<std::string>& LLVMTargetTriple() {
@@ -241,6 +249,11 @@ class LLVMCodeGenImpl : public IRVisitor {
   std::string llvmCode_;
   std::string asmCode_;
 
+  // Set when the target supports 512-bit vectors and the
+  // torch_jit_llvm_prefer_wide_vectors flag is on; see Note [NNC preferred
+  // vector width].
+  c10::optional<std::string> preferredVectorWidth_;
+
  private:
   llvm::LLVMContext& getContext();
   llvm::Type* dtypeToLLVM(Dtype dtype);
@@ -495,6 +508,47 @@ LLVMCodeGenImpl::LLVMCodeGenImpl(
   module_->setDataLayout(jit_->getDataLayout());
   module_->setTargetTriple(jit_->getTargetMachine().getTargetTriple().str());
 
+  // Note [NNC preferred vector width]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // The JIT already compiles every kernel for the exact host CPU (see
+  // makeTargetMachineBuilder in llvm_jit.cpp), so no runtime dispatch between
+  // differently-vectorized variants is needed: the per-process "dispatch"
+  // happens at compile time. What that alone does not buy us is 512-bit
+  // vectors -- on AVX-512 subtargets LLVM caps the preferred vector width at
+  // 256 bits unless the function opts in via the "prefer-vector-width"
+  // attribute. Using the full registers can downclock some cores, which is
+  // also why ATen keeps its AVX512 kernels opt-in (see
+  // aten/src/ATen/native/DispatchStub.cpp and gh#80252), so we mirror that
+  // stance here and widen only when the flag asks for it.
+  if (FLAGS_torch_jit_llvm_prefer_wide_vectors) {
+    auto& TM = jit_->getTargetMachine();
+    auto arch = TM.getTargetTriple().getArch();
+    if ((arch == llvm::Triple::x86 || arch == llvm::Triple::x86_64) &&
+        TM.getTargetFeatureString().contains("+avx512f")) {
+      preferredVectorWidth_ = "512";
+    }
+  }
+
+  // Content-address the module so that the persistent kernel cache can look
+  // up its object code without running LLVM; see Note [NNC object cache] in
+  // llvm_jit.cpp. The digest covers everything the emitted object depends
+  // on: the NNC IR, the kernel name, the argument signature, and the exact
+  // target configuration.
+  if (nncKernelObjectCacheEnabled()) {
+    auto& TM = jit_->getTargetMachine();
+    std::ostringstream key;
+    key << HashProvider().hash(stmt)._h << '#' << kernel_func_name_ << '#'
+        << dtype << '#';
+    for (auto const& arg : args) {
+      key << (arg.isVar() ? 'v' : 'b') << arg.dtype() << ',';
+    }
+    key << '#' << module_->getTargetTriple() << '#'
+        << TM.getTargetCPU().str() << '#' << TM.getTargetFeatureString().str()
+        << '#' << preferredVectorWidth_.value_or("") << '#'
+        << LLVM_VERSION_STRING;
+    module_->setModuleIdentifier("nnc_" + c10::sha1(key.str()).str());
+  }
+
   // We support float16 ops by casting expr inputs to float32
   // and then casting the result back to float16
 
@@ -519,6 +573,9 @@ LLVMCodeGenImpl::LLVMCodeGenImpl(
   fn_ = llvm::Function::Create(
       fntype, llvm::Function::PrivateLinkage, "pytorch", module_.get());
   fn_->addFnAttr(llvm::Attribute::AlwaysInline);
+  if (preferredVectorWidth_) {
+    fn_->addFnAttr("prefer-vector-width", *preferredVectorWidth_);
+  }
   for (const auto i : c10::irange(args.size())) {
     if (!args[i].isVar()) {
       fn_->addParamAttr(i, llvm::Attribute::NoAlias);
@@ -578,6 +635,11 @@ void LLVMCodeGenImpl::emitWrapper(const std::vector<llvm::Type*>& params) {
       llvm::Function::ExternalLinkage,
       kernel_func_name_,
       module_.get());
+  // The kernel is always inlined into the wrapper, so the wrapper's preferred
+  // vector width is the one the loop vectorizer ends up consulting.
+  if (preferredVectorWidth_) {
+    wrapper->addFnAttr("prefer-vector-width", *preferredVectorWidth_);
+  }
   auto wrapBB = llvm::BasicBlock::Create(getContext(), "wrapBB", wrapper);
   irb_.SetInsertPoint(wrapBB);
   llvm::SmallVector<llvm::Value*, 6> wrappedArgs;
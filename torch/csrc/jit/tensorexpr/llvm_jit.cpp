@@ -20,6 +20,8 @@ C10_DIAGNOSTIC_POP()
 #pragma GCC diagnostic ignored "-Wnon-virtual-dtor"
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #pragma GCC diagnostic pop
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h>
 #include <llvm/ExecutionEngine/Orc/SymbolStringPool.h>
 #include <llvm/ExecutionEngine/RTDyldMemoryManager.h>
@@ -28,7 +30,9 @@ C10_DIAGNOSTIC_POP()
 #include <llvm/IR/Mangler.h>
 #include <llvm/Support/CFGUpdate.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Target/TargetMachine.h>
 
@@ -37,6 +41,7 @@ C10_DIAGNOSTIC_POP()
 #include <c10/util/Half.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -134,12 +139,134 @@ static void registerIntrinsics(
       JD.define(absoluteSymbols({entry("nnc_aten_free", nnc_aten_free)})));
 }
 
+// Note [NNC object cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~
+// Recompiling identical fusion groups through LLVM at every process start can
+// cost tens of seconds of startup time. When the environment variable
+// PYTORCH_NNC_KERNEL_CACHE_PATH names a directory, compiled objects are
+// persisted there and warm restarts load them via memory-mapped files instead
+// of re-running LLVM. The cache is content addressed: llvm_codegen.cpp names
+// each module "nnc_<digest>", where the digest covers the hash of the NNC IR,
+// the kernel function name and signature, the target triple/cpu/features, and
+// the LLVM version, so a stale or mismatched object can never be returned for
+// a key. Modules without the prefix (and all modules when the variable is
+// unset) bypass the cache. Stores write to a unique temporary file and rename
+// it into place so that concurrent processes only ever observe complete
+// objects.
+namespace {
+
+class NNCObjectCache : public llvm::ObjectCache {
+ public:
+  explicit NNCObjectCache(std::string cache_dir)
+      : cache_dir_(std::move(cache_dir)) {}
+
+  void notifyObjectCompiled(const llvm::Module* M, llvm::MemoryBufferRef Obj)
+      override {
+    const auto path = objectPath(M->getModuleIdentifier());
+    if (path.empty()) {
+      return;
+    }
+    int fd = -1;
+    llvm::SmallString<128> tmp_path;
+    if (llvm::sys::fs::createUniqueFile(path + ".tmp.%%%%%%", fd, tmp_path)) {
+      return;
+    }
+    bool written = false;
+    {
+      llvm::raw_fd_ostream out(fd, /*shouldClose=*/true);
+      out.write(Obj.getBufferStart(), Obj.getBufferSize());
+      out.flush();
+      written = !out.has_error();
+    }
+    if (!written || llvm::sys::fs::rename(tmp_path, path)) {
+      llvm::sys::fs::remove(tmp_path);
+    }
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* M)
+      override {
+    const auto path = objectPath(M->getModuleIdentifier());
+    if (path.empty()) {
+      return nullptr;
+    }
+    // A miss is the common cold-start case, not an error.
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    if (!buffer) {
+      return nullptr;
+    }
+    return std::move(*buffer);
+  }
+
+ private:
+  std::string objectPath(const std::string& module_id) const {
+    // Only modules named by their content digest participate; see the
+    // module identifier setup in llvm_codegen.cpp.
+    if (module_id.compare(0, 4, "nnc_") != 0) {
+      return {};
+    }
+    return cache_dir_ + "/" + module_id + ".o";
+  }
+
+  std::string cache_dir_;
+};
+
+llvm::ObjectCache* getNNCObjectCache() {
+  static std::unique_ptr<NNCObjectCache> cache =
+      []() -> std::unique_ptr<NNCObjectCache> {
+    const char* dir = std::getenv("PYTORCH_NNC_KERNEL_CACHE_PATH");
+    if (dir == nullptr || *dir == '\0') {
+      return nullptr;
+    }
+    return std::make_unique<NNCObjectCache>(dir);
+  }();
+  return cache.get();
+}
+
+} // namespace
+
+namespace torch {
+namespace jit {
+namespace tensorexpr {
+
+bool nncKernelObjectCacheEnabled() {
+  return getNNCObjectCache() != nullptr;
+}
+
+} // namespace tensorexpr
+} // namespace jit
+} // namespace torch
+
 namespace llvm {
 namespace orc {
 
 // Lightly modified implementation from LLVM's Kaleidoscope JIT tutorial:
 // https://llvm.org/docs/tutorial/BuildingAJIT1.html
 #if LLVM_VERSION_MAJOR >= 9
+
+static std::unique_ptr<LLJIT> createLLJIT(JITTargetMachineBuilder JTMB) {
+  LLJITBuilder Builder;
+  Builder.setJITTargetMachineBuilder(std::move(JTMB));
+#if LLVM_VERSION_MAJOR >= 11
+  // Route compilation through the persistent kernel cache when it is
+  // enabled; see Note [NNC object cache]. Older LLVMs use a different
+  // CompileFunctionCreator signature that cannot carry an ObjectCache, so
+  // they always compile from scratch.
+  if (auto* cache = getNNCObjectCache()) {
+    Builder.setCompileFunctionCreator(
+        [cache](JITTargetMachineBuilder JTMB)
+            -> Expected<std::unique_ptr<IRCompileLayer::IRCompiler>> {
+          auto TM = JTMB.createTargetMachine();
+          if (!TM) {
+            return TM.takeError();
+          }
+          return std::make_unique<TMOwningSimpleCompiler>(
+              std::move(*TM), cache);
+        });
+  }
+#endif
+  return assertSuccess(Builder.create());
+}
+
 class TORCH_API PytorchLLVMJITImpl {
  private:
   std::unique_ptr<TargetMachine> TM;
@@ -153,10 +280,7 @@ class TORCH_API PytorchLLVMJITImpl {
       c10::optional<std::string> attrs)
       : TM(assertSuccess(makeTargetMachineBuilder(triple, cpu, attrs)
                              .createTargetMachine())),
-        LLJ(assertSuccess(LLJITBuilder()
-                              .setJITTargetMachineBuilder(
-                                  makeTargetMachineBuilder(triple, cpu, attrs))
-                              .create())) {
+        LLJ(createLLJIT(makeTargetMachineBuilder(triple, cpu, attrs))) {
     auto ProcSymbolsGenerator =
         assertSuccess(DynamicLibrarySearchGenerator::GetForCurrentProcess(
             LLJ->getDataLayout().getGlobalPrefix()));
@@ -251,7 +375,8 @@ class TORCH_API PytorchLLVMJITImpl {
               return RTDyldObjectLinkingLayer::Resources{
                   std::make_shared<SectionMemoryManager>(), Resolver};
             }),
-        CompileLayer(ObjectLayer, SimpleCompiler(*TM)) {
+        // See Note [NNC object cache]
+        CompileLayer(ObjectLayer, SimpleCompiler(*TM, getNNCObjectCache())) {
     auto& JD = ES.getMainJITDylib();
     MangleAndInterner Mangle(ES, DL);
     registerIntrinsics(JD, Mangle, intrinsics);
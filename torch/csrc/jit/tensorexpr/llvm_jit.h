@@ -38,6 +38,12 @@ inline void assertSuccess(llvm::Error err, const char* msg = nullptr) {
   TORCH_INTERNAL_ASSERT(!err, formatError(std::move(err), msg));
 }
 
+// Whether the persistent on-disk cache for NNC-compiled kernels is enabled.
+// When it is, llvm_codegen.cpp content-addresses each module so that the
+// cache can be consulted before running LLVM; see Note [NNC object cache] in
+// llvm_jit.cpp.
+TORCH_API bool nncKernelObjectCacheEnabled();
+
 } // namespace tensorexpr
 } // namespace jit
 } // namespace torch
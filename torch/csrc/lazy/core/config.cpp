@@ -22,11 +22,23 @@ C10_DEFINE_bool(
     false,
     "Reuse IR nodes from previous tracing when possible");
 
+C10_DEFINE_bool(
+    torch_lazy_intern_ir,
+    false,
+    "Intern non-leaf IR nodes by dag hash so repeated tracings reuse "
+    "nodes even when the trie-based reuse misses");
+
 C10_DEFINE_bool(
     torch_lazy_use_thread_pool,
     false,
     "Use thread pool to schedule backend execution");
 
+C10_DEFINE_bool(
+    torch_lazy_background_compile,
+    false,
+    "Compile newly seen lazy graphs on the IO thread pool instead of "
+    "stalling the tracing thread (requires torch_lazy_use_thread_pool)");
+
 C10_DEFINE_int(
     torch_lazy_compilation_cache_size,
     1024,
@@ -36,13 +36,22 @@ NodePtr MakeNode(Args&&... args) {
   return std::make_shared<T>(std::forward<Args>(args)...);
 }
 
+// Swap a freshly built node for the structurally identical node interned
+// during the current or previous step, if any. See NodeInternCache.
+static inline NodePtr InternNode(NodePtr node) {
+  if (FLAGS_torch_lazy_intern_ir) {
+    return NodeInternCache::Get()->Intern(std::move(node));
+  }
+  return node;
+}
+
 // op is passed in for a more efficient node casting, see the implementation of
 // NodeCast
 template <typename T, typename... Args>
 NodePtr ReuseOrMakeNode(Args&&... args) {
   NodePtr node = ReuseNode<T>(std::forward<Args>(args)...);
   if (!node) {
-    node = MakeNode<T>(std::forward<Args>(args)...);
+    node = InternNode(MakeNode<T>(std::forward<Args>(args)...));
     CacheNode(node);
   }
   return node;
@@ -424,6 +424,8 @@ void LazyGraphExecutor::MarkStep(const BackendDevice& device) {
   ResetTrimCounter();
   // Move TrieCache's current pointer back to its root
   TrieCache::Get()->ResetCurrent();
+  // Rotate the interning generations, dropping nodes not traced recently
+  NodeInternCache::Get()->StepCompleted();
 }
 
 void LazyGraphExecutor::WaitDeviceOps(c10::ArrayRef<BackendDevice> devices) {
@@ -843,6 +845,11 @@ std::shared_ptr<LazyGraphExecutor::Async> LazyGraphExecutor::
     return async;
   }
 
+  if (FLAGS_torch_lazy_use_thread_pool && FLAGS_torch_lazy_background_compile) {
+    return ScheduleCompileAndSyncTensorsGraph(
+        tensors, &coll, &po_data, ir_values, tensor_data_vec);
+  }
+
   CompilationResult compile_result =
       Compile(*tensors, devices, coll, &po_data, ir_values);
   if (GRAPH_DUMP_ENABLED) {
@@ -880,46 +887,8 @@ std::shared_ptr<LazyGraphExecutor::Async> LazyGraphExecutor::
       std::move(tensors_data),
       std::move(cached_computation));
 
-  auto syncfn = [async, hash = coll->hash]() {
-    try {
-      VLOG(3) << "Executing IR graph hash " << HashToString(hash)
-              << " on device " << async->device << " ...";
-      auto results = getBackend()->ExecuteComputation(
-          async->cached_computation->computation,
-          async->parameters_data,
-          async->device);
-      VLOG(3) << "Executing IR graph hash " << HashToString(hash)
-              << " on device " << async->device << " done!";
-
-      TORCH_CHECK(
-          async->tensors_data.size() == results.size(),
-          "Expected number of outputs does not match TorchScript Stack size: ",
-          async->tensors_data.size(),
-          " != ",
-          results.size());
-
-      for (const auto i : c10::irange(results.size())) {
-        if (async->tensors_data[i] != nullptr) {
-          async->tensors_data[i]->Assign(*results[i]);
-        } else {
-          async->tensors_data[i] = std::move(results[i]);
-        }
-      }
-    } catch (...) {
-      // There are two paths of discovery of an exception happening on an
-      // asynchronous task. One happens if the creator of the asynchronous task
-      // explicitly waits for completion, in which case the exception will be
-      // thrown from the Wait() API. Re-throwing the exception below makes sure
-      // this will be captured by the completer function created below, and
-      // surfaced by the Wait() API. But we also need to surface the exception
-      // even in case the caller does not wait, and that is accomplished by
-      // setting the unlockers status. In that case the exception will be
-      // surfaced when the user tries to acquire the device locks the next time.
-      for (auto& unlocker : async->unlocker) {
-        unlocker.SetStatus(std::current_exception());
-      }
-      throw;
-    }
+  auto syncfn = [this, async, hash = coll->hash]() {
+    ExecuteAsyncComputation(async, hash);
   };
 
   if (FLAGS_torch_lazy_use_thread_pool) {
@@ -930,6 +899,50 @@ std::shared_ptr<LazyGraphExecutor::Async> LazyGraphExecutor::
   return async;
 }
 
+void LazyGraphExecutor::ExecuteAsyncComputation(
+    const std::shared_ptr<Async>& async,
+    const hash_t& hash) {
+  try {
+    VLOG(3) << "Executing IR graph hash " << HashToString(hash)
+            << " on device " << async->device << " ...";
+    auto results = getBackend()->ExecuteComputation(
+        async->cached_computation->computation,
+        async->parameters_data,
+        async->device);
+    VLOG(3) << "Executing IR graph hash " << HashToString(hash)
+            << " on device " << async->device << " done!";
+
+    TORCH_CHECK(
+        async->tensors_data.size() == results.size(),
+        "Expected number of outputs does not match TorchScript Stack size: ",
+        async->tensors_data.size(),
+        " != ",
+        results.size());
+
+    for (const auto i : c10::irange(results.size())) {
+      if (async->tensors_data[i] != nullptr) {
+        async->tensors_data[i]->Assign(*results[i]);
+      } else {
+        async->tensors_data[i] = std::move(results[i]);
+      }
+    }
+  } catch (...) {
+    // There are two paths of discovery of an exception happening on an
+    // asynchronous task. One happens if the creator of the asynchronous task
+    // explicitly waits for completion, in which case the exception will be
+    // thrown from the Wait() API. Re-throwing the exception below makes sure
+    // this will be captured by the completer function created below, and
+    // surfaced by the Wait() API. But we also need to surface the exception
+    // even in case the caller does not wait, and that is accomplished by
+    // setting the unlockers status. In that case the exception will be
+    // surfaced when the user tries to acquire the device locks the next time.
+    for (auto& unlocker : async->unlocker) {
+      unlocker.SetStatus(std::current_exception());
+    }
+    throw;
+  }
+}
+
 std::shared_ptr<LazyGraphExecutor::Async> LazyGraphExecutor::
     ScheduleSyncTensorsGraph(
         std::vector<LazyTensorPtr>* tensors,
@@ -946,6 +959,75 @@ std::shared_ptr<LazyGraphExecutor::Async> LazyGraphExecutor::
       std::move(cached_computation));
 }
 
+std::shared_ptr<LazyGraphExecutor::Async> LazyGraphExecutor::
+    ScheduleCompileAndSyncTensorsGraph(
+        std::vector<LazyTensorPtr>* tensors,
+        SyncTensorCollection* coll,
+        PostOrderData* po_data,
+        const std::vector<Value>& ir_values,
+        const std::vector<BackendDataPtr>& tensor_data_vec) {
+  // Lowering reads the live IR nodes, which the tracing thread keeps
+  // extending with new uses, so it stays on the caller's thread; only the
+  // backend compile (the multi-second part during warm-up shape
+  // exploration) and the execution are posted to the pool.
+  auto lowering_ctx = LoweringContext::Create(
+      "SyncTensorsGraph",
+      coll->device,
+      po_data->post_order,
+      std::move(po_data->emission_map));
+  for (const auto& ir_value : ir_values) {
+    lowering_ctx->AddResult(ir_value);
+  }
+  ComputationPtr computation = lowering_ctx->Build();
+  computation->in_mark_step = coll->config.force_ltc_data;
+  TORCH_CHECK(
+      computation->parameters_size() == po_data->parameters_data.size());
+
+  TORCH_LAZY_COUNTER("BackgroundCompile", 1);
+  TORCH_LAZY_VALUE_METRIC(
+      "TensorsGraphSize", lowering_ctx->GetEmittedNodeCount());
+  VLOG(5) << "TensorsGraphSize=" << lowering_ctx->GetEmittedNodeCount();
+
+  auto tensors_data =
+      SetTensorData(tensors, coll->config, coll->indices, tensor_data_vec);
+  TensorCollectionBarrier(coll);
+  std::shared_ptr<Async> async = std::make_shared<Async>(
+      coll,
+      std::move(po_data->parameters_data),
+      std::move(tensors_data),
+      /*cached_computation=*/nullptr);
+
+  auto syncfn = [this,
+                 async,
+                 computation = std::move(computation),
+                 hash = coll->hash]() {
+    try {
+      VLOG(3) << "Compiling (background) IR graph hash " << HashToString(hash)
+              << " on device " << async->device << " ...";
+      std::vector<ComputationPtr> computations =
+          getBackend()->Compile({computation});
+      VLOG(3) << "Compiling (background) IR graph hash " << HashToString(hash)
+              << " on device " << async->device << " done!";
+      auto cached_computation = std::make_shared<CachedComputation>(
+          std::move(computations.front()));
+      // Publish to the cache first: a sync on another thread that hits this
+      // hash from here on schedules a plain cached run, which queues up
+      // behind this one's device locks.
+      GetComputationCache()->Add(hash, cached_computation);
+      async->cached_computation = std::move(cached_computation);
+    } catch (...) {
+      // See the error handling notes in ExecuteAsyncComputation.
+      for (auto& unlocker : async->unlocker) {
+        unlocker.SetStatus(std::current_exception());
+      }
+      throw;
+    }
+    ExecuteAsyncComputation(async, hash);
+  };
+  ScheduleIoClosure(async->mwait.Completer(std::move(syncfn)));
+  return async;
+}
+
 std::vector<at::Tensor> LazyGraphExecutor::GetTensorsFused(
     std::vector<LazyTensorPtr>* tensors) {
   SyncTensorsConfig config;
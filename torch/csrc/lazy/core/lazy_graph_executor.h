@@ -407,6 +407,24 @@ class TORCH_API LazyGraphExecutor {
       ComputationCache::TypePtr cached_computation,
       const std::vector<BackendDataPtr>& tensor_data_vec);
 
+  // Compile-and-run path for graphs that miss the computation cache when
+  // FLAGS_torch_lazy_background_compile is set. Lowering happens on the
+  // caller's thread, while the backend compile and the execution are posted
+  // to the thread pool, so the tracing thread is not stalled by warm-up
+  // compiles; the compiled computation is published to the cache when ready.
+  std::shared_ptr<Async> ScheduleCompileAndSyncTensorsGraph(
+      std::vector<LazyTensorPtr>* tensors,
+      SyncTensorCollection* coll,
+      PostOrderData* po_data,
+      const std::vector<Value>& ir_values,
+      const std::vector<BackendDataPtr>& tensor_data_vec);
+
+  // Runs the cached computation attached to the async object and stores the
+  // results, surfacing any error through the async device unlockers.
+  void ExecuteAsyncComputation(
+      const std::shared_ptr<Async>& async,
+      const hash_t& hash);
+
   std::vector<at::Tensor> GetTensorsFused(std::vector<LazyTensorPtr>* tensors);
 
   std::vector<at::Tensor> FetchTensors(
@@ -83,5 +83,78 @@ void TrieCache::DumpToDotFile(const std::string& file_name) {
   graph_file << ss.str();
 }
 
+namespace {
+
+bool SameNodeStructure(const Node& a, const Node& b) {
+  if (a.op() != b.op() || a.num_outputs() != b.num_outputs()) {
+    return false;
+  }
+  const auto& a_operands = a.operands();
+  const auto& b_operands = b.operands();
+  if (a_operands.size() != b_operands.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a_operands.size(); ++i) {
+    if (a_operands[i] != b_operands[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+NodeInternCache* NodeInternCache::Get() {
+  static thread_local NodeInternCache* cache = new NodeInternCache();
+  return cache;
+}
+
+NodePtr* NodeInternCache::LookupVerified(
+    HashMap& map,
+    const hash_t& hash,
+    const Node& node) {
+  auto it = map.find(hash);
+  if (it == map.end()) {
+    return nullptr;
+  }
+  for (auto& candidate : it->second) {
+    if (SameNodeStructure(*candidate, node)) {
+      return &candidate;
+    }
+  }
+  return nullptr;
+}
+
+NodePtr NodeInternCache::Intern(NodePtr node) {
+  // Leaf nodes are never interned, see the class comment.
+  if (node->operands().empty()) {
+    return node;
+  }
+  const hash_t hash = node->hash();
+  if (NodePtr* existing = LookupVerified(current_, hash, *node)) {
+    TORCH_LAZY_COUNTER("IrNodeInterned", 1);
+    return *existing;
+  }
+  if (NodePtr* existing = LookupVerified(previous_, hash, *node)) {
+    TORCH_LAZY_COUNTER("IrNodeInterned", 1);
+    // Promote so the node survives the next rotation
+    NodePtr canonical = *existing;
+    current_[hash].push_back(canonical);
+    return canonical;
+  }
+  current_[hash].push_back(node);
+  return node;
+}
+
+void NodeInternCache::StepCompleted() {
+  previous_ = std::move(current_);
+  current_.clear();
+}
+
+void NodeInternCache::Clear() {
+  current_.clear();
+  previous_.clear();
+}
+
 } // namespace lazy
 } // namespace torch
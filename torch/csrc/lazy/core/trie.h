@@ -2,8 +2,11 @@
 
 #include <atomic>
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 #include <c10/core/ScalarType.h>
+#include <torch/csrc/lazy/core/hash.h>
 #include <torch/csrc/lazy/core/ir.h>
 #include <torch/csrc/lazy/core/metrics.h>
 
@@ -57,6 +60,47 @@ class TORCH_API TrieCache {
   TrieNode* current_;
 };
 
+// Per-thread interning table for IR nodes, keyed by the node's dag hash
+// (which covers the op, the operand hashes and the attributes). It gives
+// trie misses a second chance: when steady-state tracing replays a graph
+// with ops in a different order than the cached trie path (or after the
+// trie diverged mid-step), the freshly built node is swapped for the
+// structurally identical node interned during the current or previous
+// step, so downstream consumers keep seeing stable pointers and cached
+// dag hashes.
+//
+// Because a dag hash is not a sound identity for leaf nodes (DeviceData
+// hashes only by shape and relies on positional reuse plus SetData
+// substitution), leaves are never interned, and a hash hit is only
+// honored after verifying op/num_outputs/operands pointer equality.
+//
+// Two generations are kept: nodes interned during the current step and
+// the ones from the step before. StepCompleted() rotates them, so entries
+// that stop being traced are dropped after two steps. A wholesale
+// arena-style reset is not possible here: live LazyTensors keep shared
+// ownership of their IR beyond MarkStep.
+class TORCH_API NodeInternCache {
+ public:
+  static NodeInternCache* Get();
+
+  // Returns the canonical node for this node's dag hash, interning the
+  // node if it is the first with that structure.
+  NodePtr Intern(NodePtr node);
+
+  // Used in MarkStep to rotate the generations.
+  void StepCompleted();
+
+  void Clear();
+
+ private:
+  using HashMap = std::unordered_map<hash_t, std::vector<NodePtr>, HashReducer>;
+
+  NodePtr* LookupVerified(HashMap& map, const hash_t& hash, const Node& node);
+
+  HashMap current_;
+  HashMap previous_;
+};
+
 template <typename T, typename... Args>
 NodePtr LookupNodeFromTrieCache(Args&&... args) {
   auto& successors = TrieCache::Get()->Current()->successors;
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <bitset>
+#include <memory>
 #include <mutex>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -275,5 +280,217 @@ class Stat {
   const std::chrono::milliseconds windowSize_;
   const int64_t maxSamples_;
 };
+
+// NUM_HISTOGRAM_SHARDS is the number of per-thread shards a HistogramStat
+// spreads its bucket counters across to avoid cache line contention between
+// writer threads.
+constexpr size_t NUM_HISTOGRAM_SHARDS = 16;
+
+// HistogramStat tracks the distribution of values using a fixed set of
+// linearly spaced buckets between `lower` and `upper` so that percentile
+// queries (ex: p50/p99) can be answered without retaining or sorting
+// individual samples. Values outside the range are clamped into the first and
+// last buckets.
+//
+// Unlike Stat, `add` never takes a lock: each value is recorded with a single
+// relaxed atomic increment into a per-thread shard, and the shards are only
+// merged when the distribution is read or when the window closes. This keeps
+// high frequency metric collection off the hot path at the cost of percentile
+// results being quantized to bucket midpoints.
+//
+// Once per `windowSize` the configured percentiles and the sample count are
+// logged via the event handlers as a `torch.monitor.Stat` event, matching the
+// Stat logging format. The window is checked on `add` so a completely idle
+// stat logs nothing.
+template <typename T>
+class HistogramStat {
+ public:
+  HistogramStat(
+      std::string name,
+      T lower,
+      T upper,
+      size_t numBuckets,
+      std::initializer_list<double> percentiles,
+      std::chrono::milliseconds windowSize)
+      : name_(std::move(name)),
+        lower_(lower),
+        upper_(upper),
+        numBuckets_(numBuckets),
+        percentiles_(percentiles),
+        windowSize_(windowSize) {
+    for (auto& shard : shards_) {
+      // value initialization zeroes the counters
+      shard.buckets = std::make_unique<std::atomic<int64_t>[]>(numBuckets_);
+    }
+    windowId_ = currentWindowId();
+  }
+
+  virtual ~HistogramStat() {
+    // on destruction log if there's unlogged data
+    std::lock_guard<std::mutex> guard(mu_);
+    logLocked();
+  }
+
+  // add records the value v in the current window. Lock free and safe to
+  // call concurrently from multiple threads.
+  void add(T v) {
+    maybeLog();
+    shards_[shardIndex()].buckets[bucketFor(v)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+
+  const std::string& name() const noexcept {
+    return name_;
+  }
+
+  // count returns the number of items in the current open window.
+  int64_t count() {
+    std::lock_guard<std::mutex> guard(mu_);
+    int64_t total = 0;
+    for (int64_t count : mergedLocked()) {
+      total += count;
+    }
+    return total;
+  }
+
+  // percentile returns the value at quantile p (ex: 0.99) of the current
+  // open window, quantized to the midpoint of the containing bucket. Zero if
+  // the window has no samples.
+  T percentile(double p) {
+    std::lock_guard<std::mutex> guard(mu_);
+    return percentileLocked(mergedLocked(), p);
+  }
+
+ protected:
+  virtual uint64_t currentWindowId() const {
+    std::chrono::milliseconds now =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch());
+
+    // always returns a currentWindowId of at least 1 to avoid 0 window issues
+    return (now / windowSize_) + 1;
+  }
+
+ private:
+  struct Shard {
+    std::unique_ptr<std::atomic<int64_t>[]> buckets;
+  };
+
+  static size_t shardIndex() noexcept {
+    static std::atomic<size_t> nextShard{0};
+    thread_local size_t index =
+        nextShard.fetch_add(1, std::memory_order_relaxed) %
+        NUM_HISTOGRAM_SHARDS;
+    return index;
+  }
+
+  size_t bucketFor(T v) const noexcept {
+    if (v <= lower_) {
+      return 0;
+    }
+    if (v >= upper_) {
+      return numBuckets_ - 1;
+    }
+    double frac = static_cast<double>(v - lower_) /
+        static_cast<double>(upper_ - lower_);
+    return std::min(
+        static_cast<size_t>(frac * static_cast<double>(numBuckets_)),
+        numBuckets_ - 1);
+  }
+
+  std::vector<int64_t> mergedLocked() const {
+    std::vector<int64_t> counts(numBuckets_, 0);
+    for (const auto& shard : shards_) {
+      for (size_t i = 0; i < numBuckets_; i++) {
+        counts[i] += shard.buckets[i].load(std::memory_order_relaxed);
+      }
+    }
+    return counts;
+  }
+
+  T percentileLocked(const std::vector<int64_t>& counts, double p) const {
+    int64_t total = 0;
+    for (int64_t count : counts) {
+      total += count;
+    }
+    if (total == 0) {
+      return 0;
+    }
+
+    auto target = static_cast<int64_t>(p * static_cast<double>(total));
+    int64_t seen = 0;
+    for (size_t i = 0; i < numBuckets_; i++) {
+      seen += counts[i];
+      if (seen > target) {
+        double width = static_cast<double>(upper_ - lower_) /
+            static_cast<double>(numBuckets_);
+        return static_cast<T>(
+            static_cast<double>(lower_) +
+            (static_cast<double>(i) + 0.5) * width);
+      }
+    }
+    return upper_;
+  }
+
+  void maybeLog() {
+    auto windowId = currentWindowId();
+    if (windowId_.load(std::memory_order_relaxed) == windowId) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> guard(mu_);
+    if (windowId_.load(std::memory_order_relaxed) == windowId) {
+      return;
+    }
+    logLocked();
+    windowId_.store(windowId, std::memory_order_relaxed);
+  }
+
+  void logLocked() {
+    auto counts = mergedLocked();
+    for (auto& shard : shards_) {
+      for (size_t i = 0; i < numBuckets_; i++) {
+        shard.buckets[i].store(0, std::memory_order_relaxed);
+      }
+    }
+
+    int64_t total = 0;
+    for (int64_t count : counts) {
+      total += count;
+    }
+    // don't log event if there's no data
+    if (total == 0) {
+      return;
+    }
+
+    Event e;
+    e.name = "torch.monitor.Stat";
+    e.timestamp = std::chrono::system_clock::now();
+
+    e.data.reserve(percentiles_.size() + 1);
+    for (double p : percentiles_) {
+      std::stringstream key;
+      key << name_;
+      key << ".p";
+      key << static_cast<int>(p * 100);
+      e.data[key.str()] = percentileLocked(counts, p);
+    }
+    e.data[name_ + ".count"] = total;
+
+    logEvent(e);
+  }
+
+  const std::string name_;
+  const T lower_;
+  const T upper_;
+  const size_t numBuckets_;
+  const std::vector<double> percentiles_;
+  const std::chrono::milliseconds windowSize_;
+
+  std::array<Shard, NUM_HISTOGRAM_SHARDS> shards_;
+
+  std::mutex mu_;
+  std::atomic<uint64_t> windowId_{0};
+};
 } // namespace monitor
 } // namespace torch
@@ -0,0 +1,57 @@
+#include <torch/csrc/monitor/interop_latency.h>
+
+#include <chrono>
+
+#include <c10/core/LatencyBudgetThreadPool.h>
+#include <torch/csrc/monitor/counters.h>
+
+namespace torch {
+namespace monitor {
+
+namespace {
+
+// One Stat per deadline class, created on first enable and leaked so a
+// pool worker reporting during process teardown never touches a
+// destructed Stat (same reasoning as OpLatencyCollector's singleton).
+Stat<int64_t>& makeStat(const char* name) {
+  return *new Stat<int64_t>(
+      name,
+      {Aggregation::MEAN, Aggregation::MAX, Aggregation::COUNT},
+      std::chrono::seconds(60));
+}
+
+Stat<int64_t>& statFor(c10::DeadlineClass cls) {
+  static Stat<int64_t>& interactive =
+      makeStat("pytorch.interop.queue_delay_ns.interactive");
+  static Stat<int64_t>& fallback =
+      makeStat("pytorch.interop.queue_delay_ns.default");
+  static Stat<int64_t>& batch =
+      makeStat("pytorch.interop.queue_delay_ns.batch");
+  switch (cls) {
+    case c10::DeadlineClass::Interactive:
+      return interactive;
+    case c10::DeadlineClass::Batch:
+      return batch;
+    case c10::DeadlineClass::Default:
+    default:
+      return fallback;
+  }
+}
+
+void onQueueDelay(c10::DeadlineClass cls, int64_t delay_ns) {
+  statFor(cls).add(delay_ns);
+}
+
+} // namespace
+
+void enableInteropQueueDelayStats() {
+  statFor(c10::DeadlineClass::Interactive); // force Stat registration
+  c10::setQueueDelayObserver(&onQueueDelay);
+}
+
+void disableInteropQueueDelayStats() {
+  c10::setQueueDelayObserver(nullptr);
+}
+
+} // namespace monitor
+} // namespace torch
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+namespace torch {
+namespace monitor {
+
+// Exports per-deadline-class queue-delay stats for the inter-op thread
+// pool (see c10::LatencyBudgetThreadPool). While enabled, the pool's
+// queue-delay observer feeds one Stat per DeadlineClass --
+//   pytorch.interop.queue_delay_ns.{interactive,default,batch}
+// -- aggregated as MEAN/MAX/COUNT over 60s windows and logged through the
+// registered event handlers, so p99 regressions from co-located batch
+// work show up directly in serving dashboards. Both calls are idempotent;
+// they are no-ops in effect unless TORCH_LATENCY_BUDGET_INTEROP selected
+// the latency-budget pool, since no other pool reports queue delays.
+TORCH_API void enableInteropQueueDelayStats();
+TORCH_API void disableInteropQueueDelayStats();
+
+} // namespace monitor
+} // namespace torch
@@ -0,0 +1,136 @@
+#include <torch/csrc/monitor/op_latency.h>
+
+#include <chrono>
+
+#include <ATen/record_function.h>
+#include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
+
+namespace torch {
+namespace monitor {
+
+namespace {
+
+struct OpLatencyContext : public at::ObserverContext {
+  std::chrono::steady_clock::time_point start;
+};
+
+std::unique_ptr<at::ObserverContext> onOpEnter(
+    const at::RecordFunction& /* fn */) {
+  auto ctx = std::make_unique<OpLatencyContext>();
+  ctx->start = std::chrono::steady_clock::now();
+  return ctx;
+}
+
+void onOpExit(const at::RecordFunction& fn, at::ObserverContext* ctx_ptr) {
+  auto* ctx = static_cast<OpLatencyContext*>(ctx_ptr);
+  if (ctx == nullptr) {
+    return;
+  }
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - ctx->start)
+                      .count();
+  OpLatencyCollector::get().record(fn.name(), ns);
+}
+
+} // namespace
+
+OpLatencyCollector& OpLatencyCollector::get() {
+  // Leaky singleton: shards handed out to writer threads must outlive any
+  // late RecordFunction exits during shutdown.
+  static auto* collector = new OpLatencyCollector();
+  return *collector;
+}
+
+void OpLatencyCollector::enable() {
+  std::lock_guard<std::mutex> guard(mu_);
+  if (handle_ != 0) {
+    return;
+  }
+  handle_ = at::addGlobalCallback(
+      at::RecordFunctionCallback(onOpEnter, onOpExit)
+          .scopes(
+              {at::RecordScope::FUNCTION,
+               at::RecordScope::BACKWARD_FUNCTION}));
+}
+
+void OpLatencyCollector::disable() {
+  std::lock_guard<std::mutex> guard(mu_);
+  if (handle_ != 0) {
+    at::removeCallback(handle_);
+    handle_ = 0;
+  }
+}
+
+bool OpLatencyCollector::enabled() const {
+  std::lock_guard<std::mutex> guard(mu_);
+  return handle_ != 0;
+}
+
+void OpLatencyCollector::reset() {
+  std::lock_guard<std::mutex> guard(mu_);
+  for (auto& op : ops_) {
+    for (auto& shard : op.second->shards) {
+      for (auto& bucket : shard->buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+void OpLatencyCollector::record(const std::string& name, int64_t ns) {
+  // Per-thread shard cache; a miss takes the registration lock once per
+  // (thread, op) pair, after that recording is a relaxed fetch_add.
+  thread_local std::unordered_map<std::string, Shard*> shard_cache;
+  auto it = shard_cache.find(name);
+  if (C10_UNLIKELY(it == shard_cache.end())) {
+    std::lock_guard<std::mutex> guard(mu_);
+    auto& hist = ops_[name];
+    if (!hist) {
+      hist = std::make_unique<Histogram>();
+    }
+    hist->shards.emplace_back(std::make_unique<Shard>());
+    it = shard_cache.emplace(name, hist->shards.back().get()).first;
+  }
+  it->second->buckets[bucketFor(ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+std::unordered_map<std::string, std::vector<uint64_t>> OpLatencyCollector::
+    histograms() const {
+  std::unordered_map<std::string, std::vector<uint64_t>> out;
+  std::lock_guard<std::mutex> guard(mu_);
+  for (const auto& op : ops_) {
+    auto& counts = out[op.first];
+    counts.assign(kNumBuckets, 0);
+    for (const auto& shard : op.second->shards) {
+      for (const auto i : c10::irange(kNumBuckets)) {
+        counts[i] += shard->buckets[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+  return out;
+}
+
+int64_t OpLatencyCollector::bucketFor(int64_t ns) {
+  if (ns < kSubBuckets) {
+    return ns < 0 ? 0 : ns;
+  }
+  // msb >= 2 here; the top two value bits select the linear sub-bucket.
+  const auto v = static_cast<uint64_t>(ns);
+  const int64_t msb = c10::llvm::Log2_64(v);
+  const int64_t sub = (v >> (msb - 2)) & (kSubBuckets - 1);
+  return (msb - 1) * kSubBuckets + sub;
+}
+
+std::vector<int64_t> OpLatencyCollector::bucketBounds() {
+  std::vector<int64_t> bounds(kNumBuckets);
+  for (const auto i : c10::irange(kNumBuckets)) {
+    bounds[i] = i < kSubBuckets
+        ? i
+        : (kSubBuckets + i % kSubBuckets) << (i / kSubBuckets - 1);
+  }
+  return bounds;
+}
+
+} // namespace monitor
+} // namespace torch
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <c10/macros/Macros.h>
+
+namespace torch {
+namespace monitor {
+
+// OpLatencyCollector maintains per-operator latency histograms fed by an
+// opt-in global RecordFunction callback (see enable()).
+//
+// The write path is designed to be cheap enough to leave on in production:
+// each thread increments a relaxed atomic counter in its own shard of the
+// op's histogram, so recording never takes a lock once a (thread, op)
+// shard exists. Shards are merged when the histograms are read.
+//
+// Buckets are HDR-style: every power-of-two range of nanoseconds is split
+// into kSubBuckets linear sub-buckets, which bounds the relative error of
+// a bucket to 1 / kSubBuckets across the whole int64 range.
+class TORCH_API OpLatencyCollector {
+ public:
+  static constexpr int64_t kSubBuckets = 4;
+  static constexpr int64_t kNumBuckets = 62 * kSubBuckets;
+
+  static OpLatencyCollector& get();
+
+  // Registers / unregisters the global RecordFunction callback that feeds
+  // the collector. Both are idempotent. Disabling keeps the collected data.
+  void enable();
+  void disable();
+  bool enabled() const;
+
+  // Zeroes all histograms. Shards stay registered so concurrent writers
+  // never observe a dangling shard.
+  void reset();
+
+  // Records one call of `name` that took `ns` nanoseconds.
+  void record(const std::string& name, int64_t ns);
+
+  // Merged histograms: op name -> kNumBuckets counts.
+  std::unordered_map<std::string, std::vector<uint64_t>> histograms() const;
+
+  // Maps a duration in nanoseconds to its bucket index.
+  static int64_t bucketFor(int64_t ns);
+
+  // Lower bound in nanoseconds of every bucket; shared by all histograms.
+  static std::vector<int64_t> bucketBounds();
+
+ private:
+  OpLatencyCollector() = default;
+
+  struct alignas(64) Shard {
+    std::array<std::atomic<uint64_t>, kNumBuckets> buckets{};
+  };
+
+  struct Histogram {
+    // One shard per writer thread; threads that exit leave their shard in
+    // place so merged counts are never lost.
+    std::vector<std::unique_ptr<Shard>> shards;
+  };
+
+  mutable std::mutex mu_;
+  std::unordered_map<std::string, std::unique_ptr<Histogram>> ops_;
+  uint64_t handle_{0};
+};
+
+} // namespace monitor
+} // namespace torch
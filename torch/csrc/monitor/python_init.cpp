@@ -12,6 +12,8 @@
 
 #include <torch/csrc/monitor/counters.h>
 #include <torch/csrc/monitor/events.h>
+#include <torch/csrc/monitor/interop_latency.h>
+#include <torch/csrc/monitor/op_latency.h>
 
 namespace pybind11 {
 namespace detail {
@@ -296,6 +298,59 @@ void initMonitorBindings(PyObject* module) {
         after calling ``register_event_handler``. After this returns the event
         handler will no longer receive events.
       )DOC");
+
+  m.def(
+      "_enable_op_latency_collection",
+      []() { OpLatencyCollector::get().enable(); },
+      R"DOC(
+        Registers a global RecordFunction callback that collects per-operator
+        latency histograms. The write path uses per-thread shards with relaxed
+        atomic counters so it is cheap enough for always-on use.
+      )DOC");
+  m.def(
+      "_disable_op_latency_collection",
+      []() { OpLatencyCollector::get().disable(); },
+      R"DOC(
+        Unregisters the op latency callback. Collected histograms are kept.
+      )DOC");
+  m.def(
+      "_reset_op_latency_histograms",
+      []() { OpLatencyCollector::get().reset(); },
+      R"DOC(
+        Zeroes all collected op latency histograms.
+      )DOC");
+  m.def(
+      "_get_op_latency_histograms",
+      []() { return OpLatencyCollector::get().histograms(); },
+      R"DOC(
+        Returns a dict mapping op name to its list of per-bucket call counts,
+        merged across threads. Bucket boundaries are given by
+        ``_op_latency_bucket_bounds``.
+      )DOC");
+  m.def(
+      "_op_latency_bucket_bounds",
+      []() { return OpLatencyCollector::bucketBounds(); },
+      R"DOC(
+        Returns the lower bound in nanoseconds of every histogram bucket.
+        Buckets are HDR-style: each power-of-two range is split into linear
+        sub-buckets.
+      )DOC");
+
+  m.def(
+      "_enable_interop_queue_delay_stats",
+      []() { enableInteropQueueDelayStats(); },
+      R"DOC(
+        Exports per-deadline-class queue-delay stats for the inter-op thread
+        pool as ``pytorch.interop.queue_delay_ns.*`` Stats. Only the
+        latency-budget pool (``TORCH_LATENCY_BUDGET_INTEROP=1``) reports
+        queue delays.
+      )DOC");
+  m.def(
+      "_disable_interop_queue_delay_stats",
+      []() { disableInteropQueueDelayStats(); },
+      R"DOC(
+        Stops exporting inter-op queue-delay stats.
+      )DOC");
 }
 
 } // namespace monitor
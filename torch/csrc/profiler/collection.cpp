@@ -212,6 +212,33 @@ uint64_t ThreadLocalSubqueue::TorchOpStorage::EventBlock<T, ChunkSize>::
 // ---------------------------------
 std::unique_ptr<KinetoObserverContext> ThreadLocalSubqueue::begin_op(
     const at::RecordFunction& fn) {
+  // Sampling mode for always-on collection: record one in every
+  // `profiler_sample_rate` enters. A skipped enter returns nullptr, which
+  // also suppresses the exit callback for this op. The counter is plain
+  // thread-local state, so the fast path is a single compare.
+  const auto sample_rate = config_.experimental_config.profiler_sample_rate;
+  if (C10_UNLIKELY(sample_rate > 1)) {
+    if (++sample_counter_ < sample_rate) {
+      return nullptr;
+    }
+    sample_counter_ = 0;
+  }
+
+  // Retention budget: once this thread's queue is full, stop recording
+  // rather than growing without bound. (The storage is append-only, so the
+  // oldest events cannot be evicted in favor of new ones.)
+  const auto event_budget = config_.experimental_config.profiler_event_budget;
+  if (C10_UNLIKELY(
+          event_budget > 0 &&
+          static_cast<int64_t>(torch_ops_.op_events_.size()) >=
+              event_budget)) {
+    TORCH_WARN_ONCE(
+        "Profiler event budget (",
+        event_budget,
+        " per thread) exhausted; further ops will not be recorded.");
+    return nullptr;
+  }
+
   KinetoObserverContext::Event* event;
   uint64_t corr_id;
   std::tie(event, corr_id) = torch_ops_.op_events_.emplace_back(
@@ -252,10 +279,10 @@ std::unique_ptr<KinetoObserverContext> ThreadLocalSubqueue::begin_op(
   if (config_.state == ProfilerState::KINETO_GPU_FALLBACK) {
     try {
       out->fallback_ = torch_ops_.gpu_fallback_.emplace_back();
-      torch::profiler::impl::cudaStubs()->record(
+      torch::profiler::impl::gpuFallbackStubs()->record(
           nullptr, &out->fallback_->cuda_event_start_, nullptr);
     } catch (const std::exception& e) {
-      LOG(WARNING) << "Failed to record CUDA event. " << e.what();
+      LOG(WARNING) << "Failed to record GPU event. " << e.what();
     }
   }
 
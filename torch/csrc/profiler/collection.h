@@ -513,6 +513,10 @@ class TORCH_API ThreadLocalSubqueue {
   kineto::DeviceAndResource kineto_info_;
   std::unique_ptr<perf_profiler_t> perf_profiler_;
 
+  // profiler_sample_rate; counts enters since the last recorded one. Each
+  // subqueue is owned by a single thread, so no synchronization is needed.
+  int64_t sample_counter_{0};
+
   friend class RecordQueue;
   // See `containers.h` for block size benchmarks.
   static constexpr size_t BlockSize = 512;
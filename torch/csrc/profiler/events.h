@@ -11,7 +11,7 @@ namespace profiler {
 using perf_counters_t = std::vector<uint64_t>;
 
 /* Standard list of performance events independent of hardware or backend */
-constexpr std::array<const char*, 2> ProfilerPerfEvents = {
+constexpr std::array<const char*, 6> ProfilerPerfEvents = {
     /*
      * Number of Processing Elelement (PE) cycles between two points of interest
      * in time. This should correlate positively with wall-time. Measured in
@@ -25,6 +25,29 @@ constexpr std::array<const char*, 2> ProfilerPerfEvents = {
      * (i.e. work). Across repeat executions, the number of instructions should
      * be more or less invariant. Measured in uint64_t. PE can be non cpu.
      */
-    "instructions"};
+    "instructions",
+
+    /* Number of last-level cache accesses between two points of interest in
+     * time. Together with cache-misses this gives the LLC hit rate; a high
+     * miss fraction indicates a memory-bound region. Measured in uint64_t.
+     */
+    "cache-references",
+
+    /* Number of last-level cache misses between two points of interest in
+     * time, i.e. accesses that had to go out to memory. Measured in uint64_t.
+     */
+    "cache-misses",
+
+    /* Number of cycles where the backend (execution units, memory subsystem)
+     * had no work retiring. High values relative to cycles indicate a
+     * memory- or execution-bound region. Measured in uint64_t.
+     */
+    "backend-stall-cycles",
+
+    /* Number of cycles where the frontend could not deliver instructions to
+     * the backend (fetch/decode starvation). High values relative to cycles
+     * indicate a frontend-bound region. Measured in uint64_t.
+     */
+    "frontend-stall-cycles"};
 } // namespace profiler
 } // namespace torch
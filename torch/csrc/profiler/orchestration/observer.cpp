@@ -18,12 +18,16 @@ ExperimentalConfig::ExperimentalConfig(
     bool profiler_measure_per_kernel,
     bool verbose,
     std::vector<std::string> performance_events,
-    bool adjust_timestamps)
+    bool adjust_timestamps,
+    int64_t profiler_sample_rate,
+    int64_t profiler_event_budget)
     : profiler_metrics{std::move(profiler_metrics)},
       profiler_measure_per_kernel{profiler_measure_per_kernel},
       verbose{verbose},
       performance_events(std::move(performance_events)),
-      adjust_timestamps{adjust_timestamps} {}
+      adjust_timestamps{adjust_timestamps},
+      profiler_sample_rate{profiler_sample_rate},
+      profiler_event_budget{profiler_event_budget} {}
 
 /*explicit*/ ExperimentalConfig::operator bool() const {
   return !profiler_metrics.empty();
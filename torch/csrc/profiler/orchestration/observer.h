@@ -44,7 +44,9 @@ struct TORCH_API ExperimentalConfig {
       bool profiler_measure_per_kernel = false,
       bool verbose = false,
       std::vector<std::string> performance_events = {},
-      bool adjust_timestamps = false);
+      bool adjust_timestamps = false,
+      int64_t profiler_sample_rate = 1,
+      int64_t profiler_event_budget = 0);
   ~ExperimentalConfig() = default;
   explicit operator bool() const;
 
@@ -67,6 +69,20 @@ struct TORCH_API ExperimentalConfig {
    * information instead of the the original information.
    */
   bool adjust_timestamps;
+  /*
+   * Record only one in every `profiler_sample_rate` op enters per thread.
+   * A rate of 1 (the default) records everything. Intended for always-on
+   * fleet monitoring where full collection is too expensive; note that
+   * counts aggregated from a sampled profile have to be scaled by the
+   * rate, while per-event durations need no correction.
+   */
+  int64_t profiler_sample_rate;
+  /*
+   * Upper bound on the number of op events retained per thread; once a
+   * thread's queue is full, further enters are dropped. 0 (the default)
+   * means unbounded, matching the classic profile-a-few-steps workflow.
+   */
+  int64_t profiler_event_budget;
 };
 
 struct TORCH_API ProfilerConfig {
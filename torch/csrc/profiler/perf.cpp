@@ -28,7 +28,8 @@ inline long perf_event_open(
   return syscall(__NR_perf_event_open, hw_event, pid, cpu, group_fd, flags);
 }
 
-// TODO sync with Kineto level abstract events in profiler/events.h
+// Keep in sync with the abstract event list in profiler/events.h; names not
+// listed there are forwarded with a warning (see prepareProfiler).
 static const std::unordered_map<
     std::string,
     std::pair<perf_type_id, /* perf event type */ uint32_t>>
@@ -37,10 +38,10 @@ static const std::unordered_map<
          std::make_pair(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES)},
         {"instructions",
          std::make_pair(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS)},
-
-        // Non Standard events for testing
-        {"pagefaults",
-         std::make_pair(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS)},
+        {"cache-references",
+         std::make_pair(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES)},
+        {"cache-misses",
+         std::make_pair(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES)},
         {"backend-stall-cycles",
          std::make_pair(
              PERF_TYPE_HARDWARE,
@@ -48,7 +49,11 @@ static const std::unordered_map<
         {"frontend-stall-cycles",
          std::make_pair(
              PERF_TYPE_HARDWARE,
-             PERF_COUNT_HW_STALLED_CYCLES_FRONTEND)}};
+             PERF_COUNT_HW_STALLED_CYCLES_FRONTEND)},
+
+        // Non Standard events for testing
+        {"pagefaults",
+         std::make_pair(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS)}};
 
 PerfEvent::~PerfEvent() {
   if (fd_ > -1) {
@@ -104,16 +109,22 @@ uint64_t PerfEvent::ReadCounter() const {
       name_,
       ", error: ",
       std::strerror(errno));
+  if (counter.time_enabled == counter.time_running) {
+    return counter.value;
+  }
+  /* The PMU was overcommitted and the kernel time multiplexed this event;
+   * scale the raw count by enabled/running time to estimate the total. */
   TORCH_CHECK(
-      counter.time_enabled == counter.time_running,
-      "Hardware performance counter time multiplexing is not handled yet",
-      ", name: ",
+      counter.time_running > 0,
+      "Hardware performance counter never scheduled, name: ",
       name_,
       ", enabled: ",
       counter.time_enabled,
       ", running: ",
       counter.time_running);
-  return counter.value;
+  const double scale = static_cast<double>(counter.time_enabled) /
+      static_cast<double>(counter.time_running);
+  return static_cast<uint64_t>(static_cast<double>(counter.value) * scale);
 }
 
 #else /* __ANDROID__ || __linux__ */
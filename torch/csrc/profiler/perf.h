@@ -20,12 +20,12 @@ namespace linux_perf {
 
 /*
  * Maximum number of events supported
- * This stems from the hardware limitation on CPU performance counters, and the
- * fact that we don't support time multiplexing just yet.
- * Time multiplexing involves scaling the counter values proportional to
- * the enabled and running time or running the workload multiple times.
+ * CPUs only have a handful of programmable performance counters; beyond that
+ * the kernel time multiplexes events and ReadCounter() scales the raw count
+ * by enabled/running time, which turns the deltas into estimates. Keep the
+ * cap modest so short ops still mostly see unmultiplexed counts.
  */
-constexpr uint8_t MAX_EVENTS = 4;
+constexpr uint8_t MAX_EVENTS = 8;
 
 struct PerfCounter {
   uint64_t value; /* The value of the event */
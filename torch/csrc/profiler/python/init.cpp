@@ -7,6 +7,7 @@
 #include <torch/csrc/jit/python/pybind_utils.h>
 #include <torch/csrc/profiler/collection.h>
 #include <torch/csrc/profiler/standalone/execution_graph_observer.h>
+#include <torch/csrc/profiler/standalone/memory_flight_recorder.h>
 #include <torch/csrc/utils/pybind.h>
 
 namespace torch {
@@ -56,7 +57,10 @@ void initPythonBindings(PyObject* module) {
               std::vector<std::string> /* profiler_metrics */,
               bool /* profiler_measure_per_kernel */,
               bool /* verbose */,
-              std::vector<std::string> /* performance_events  */
+              std::vector<std::string> /* performance_events  */,
+              bool /* adjust_timestamps */,
+              int64_t /* profiler_sample_rate */,
+              int64_t /* profiler_event_budget */
               >(),
           "An experimental config for Kineto features. Please note that"
           "backward compatibility is not guaranteed.\n"
@@ -66,11 +70,18 @@ void initPythonBindings(PyObject* module) {
           "    profiler_measure_per_kernel (bool) : whether to profile metrics per kernel\n"
           "       or for the entire measurement duration.\n"
           "    verbose (bool) : whether the trace file has `Call stack` field or not.\n"
-          "    performance_events : a list of profiler events to be used for measurement",
+          "    performance_events : a list of profiler events to be used for measurement\n"
+          "    profiler_sample_rate (int) : record one in every N op enters per thread.\n"
+          "       Counts aggregated from a sampled profile have to be scaled by N.\n"
+          "    profiler_event_budget (int) : maximum op events retained per thread,\n"
+          "       0 means unbounded.",
           py::arg("profiler_metrics") = std::vector<std::string>(),
           py::arg("profiler_measure_per_kernel") = false,
           py::arg("verbose") = false,
-          py::arg("performance_events") = std::vector<std::string>())
+          py::arg("performance_events") = std::vector<std::string>(),
+          py::arg("adjust_timestamps") = false,
+          py::arg("profiler_sample_rate") = 1,
+          py::arg("profiler_event_budget") = 0)
       .def(py::pickle(
           [](const ExperimentalConfig& p) { // __getstate__
             py::list py_metrics;
@@ -88,10 +99,13 @@ void initPythonBindings(PyObject* module) {
                 py_metrics,
                 p.profiler_measure_per_kernel,
                 p.verbose,
-                p.performance_events);
+                p.performance_events,
+                p.adjust_timestamps,
+                p.profiler_sample_rate,
+                p.profiler_event_budget);
           },
           [](py::tuple t) { // __setstate__
-            if (t.size() >= 3) {
+            if (t.size() < 3) {
               throw std::runtime_error("Expected atleast 3 values in state");
             }
 
@@ -103,7 +117,7 @@ void initPythonBindings(PyObject* module) {
             }
 
             std::vector<std::string> performance_events;
-            if (t.size() == 4) {
+            if (t.size() >= 4) {
               py::list py_perf_events = t[3].cast<py::list>();
               performance_events.resize(py_perf_events.size());
               for (const auto& py_perf_event : py_perf_events) {
@@ -111,11 +125,23 @@ void initPythonBindings(PyObject* module) {
               }
             }
 
+            bool adjust_timestamps = false;
+            int64_t profiler_sample_rate = 1;
+            int64_t profiler_event_budget = 0;
+            if (t.size() >= 7) {
+              adjust_timestamps = t[4].cast<bool>();
+              profiler_sample_rate = t[5].cast<int64_t>();
+              profiler_event_budget = t[6].cast<int64_t>();
+            }
+
             return ExperimentalConfig(
                 std::move(metrics),
                 t[1].cast<bool>(),
                 t[2].cast<bool>(),
-                std::move(performance_events));
+                std::move(performance_events),
+                adjust_timestamps,
+                profiler_sample_rate,
+                profiler_event_budget);
           }));
 
   py::class_<ProfilerConfig>(m, "ProfilerConfig")
@@ -183,7 +209,17 @@ void initPythonBindings(PyObject* module) {
           })
       .def_readonly("scope", &torch_op_t::scope_)
       .def_readonly("sequence_number", &torch_op_t::sequence_number_)
-      .def_readonly("allow_tf32_cublas", &torch_op_t::allow_tf32_cublas_);
+      .def_readonly("allow_tf32_cublas", &torch_op_t::allow_tf32_cublas_)
+      .def_property_readonly(
+          "perf_event_counters",
+          [](const torch_op_t& op) -> py::object {
+            // Deltas of the counters configured via
+            // _ExperimentalConfig.performance_events, in the same order.
+            if (!op.perf_event_counters_) {
+              return py::none();
+            }
+            return py::cast(*op.perf_event_counters_);
+          });
 
   py::class_<ExtraFields<EventType::Backend>>(m, "_ExtraFields_Backend");
   py::class_<ExtraFields<EventType::Vulkan>>(m, "_ExtraFields_Vulkan");
@@ -291,6 +327,42 @@ void initPythonBindings(PyObject* module) {
   m.def(
       "_disable_execution_graph_observer",
       &torch::profiler::impl::disableExecutionGraphObserver);
+
+  // Standing allocator-event flight recorder (see
+  // standalone/memory_flight_recorder.h).
+  py::class_<MemoryFlightEvent>(m, "_MemoryFlightEvent")
+      .def_readonly("timestamp_ns", &MemoryFlightEvent::timestamp_ns_)
+      .def_readonly("tid", &MemoryFlightEvent::tid_)
+      .def_property_readonly(
+          "ptr",
+          [](const MemoryFlightEvent& e) {
+            return static_cast<intptr_t>(e.addr_);
+          })
+      .def_readonly("alloc_size", &MemoryFlightEvent::alloc_size_)
+      .def_readonly("total_allocated", &MemoryFlightEvent::total_allocated_)
+      .def_readonly("total_reserved", &MemoryFlightEvent::total_reserved_)
+      .def_property_readonly(
+          "device",
+          [](const MemoryFlightEvent& e) {
+            return c10::Device(e.device_type_, e.device_index_);
+          })
+      .def_readonly("is_oom", &MemoryFlightEvent::is_oom_)
+      .def_property_readonly("op_name", [](const MemoryFlightEvent& e) {
+        return std::string(e.op_name_);
+      });
+  m.def(
+      "_enable_memory_flight_recorder",
+      &torch::profiler::impl::enableMemoryFlightRecorder,
+      py::arg("capacity"));
+  m.def(
+      "_disable_memory_flight_recorder",
+      &torch::profiler::impl::disableMemoryFlightRecorder);
+  m.def(
+      "_memory_flight_recorder_enabled",
+      &torch::profiler::impl::memoryFlightRecorderEnabled);
+  m.def(
+      "_dump_memory_flight_recorder",
+      &torch::profiler::impl::dumpMemoryFlightRecorder);
 }
 
 } // namespace profiler
@@ -0,0 +1,207 @@
+#include <torch/csrc/profiler/standalone/memory_flight_recorder.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+#include <ATen/record_function.h>
+#include <c10/core/Allocator.h>
+#include <c10/util/Logging.h>
+#include <torch/csrc/profiler/util.h>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+namespace {
+
+// Number of events logged when an out of memory report arrives.
+constexpr size_t kOomLogEvents = 32;
+
+struct Ring {
+  explicit Ring(size_t capacity) : slots(capacity) {}
+
+  std::vector<MemoryFlightEvent> slots;
+  // Total number of events ever recorded; `next % slots.size()` is the slot
+  // the next event goes into.
+  std::atomic<uint64_t> next{0};
+};
+
+// The active ring is published through an atomic pointer and deliberately
+// leaked on disable: an allocator thread may race with disable and write to
+// the old ring, so it must never be freed. A retired ring is a few KB.
+std::atomic<Ring*> active_ring{nullptr};
+std::mutex control_mutex;
+at::CallbackHandle op_name_handle = 0;
+
+// Stack of truncated names of the RecordFunctions currently live on this
+// thread, maintained by the callbacks below so allocation events can name
+// the op they happened under without an active profiler.
+thread_local std::vector<std::array<char, MemoryFlightEvent::kOpNameLength>>
+    op_name_stack;
+
+std::unique_ptr<at::ObserverContext> onOpEnter(const at::RecordFunction& fn) {
+  op_name_stack.emplace_back();
+  auto& slot = op_name_stack.back();
+  const char* name = fn.name();
+  if (name != nullptr) {
+    strncpy(slot.data(), name, slot.size() - 1);
+  }
+  slot.back() = '\0';
+  return nullptr;
+}
+
+void onOpExit(const at::RecordFunction& /* fn */, at::ObserverContext*) {
+  if (!op_name_stack.empty()) {
+    op_name_stack.pop_back();
+  }
+}
+
+void recordEvent(
+    Ring* ring,
+    void* ptr,
+    int64_t alloc_size,
+    size_t total_allocated,
+    size_t total_reserved,
+    c10::Device device,
+    bool is_oom) {
+  const auto idx =
+      ring->next.fetch_add(1, std::memory_order_relaxed) % ring->slots.size();
+  auto& slot = ring->slots[idx];
+  slot.timestamp_ns_ = getTime();
+  slot.tid_ = at::RecordFunction::currentThreadId();
+  slot.addr_ = reinterpret_cast<uintptr_t>(ptr);
+  slot.alloc_size_ = alloc_size;
+  slot.total_allocated_ = total_allocated;
+  slot.total_reserved_ = total_reserved;
+  slot.device_type_ = device.type();
+  slot.device_index_ = device.index();
+  slot.is_oom_ = is_oom;
+  if (!op_name_stack.empty()) {
+    memcpy(
+        slot.op_name_,
+        op_name_stack.back().data(),
+        MemoryFlightEvent::kOpNameLength);
+  } else {
+    slot.op_name_[0] = '\0';
+  }
+}
+
+void onAllocationReport(
+    void* ptr,
+    int64_t alloc_size,
+    size_t total_allocated,
+    size_t total_reserved,
+    c10::Device device) {
+  auto* ring = active_ring.load(std::memory_order_acquire);
+  if (ring == nullptr) {
+    return;
+  }
+  recordEvent(
+      ring,
+      ptr,
+      alloc_size,
+      total_allocated,
+      total_reserved,
+      device,
+      /*is_oom=*/false);
+}
+
+void onOutOfMemoryReport(
+    int64_t alloc_size,
+    size_t total_allocated,
+    size_t total_reserved,
+    c10::Device device) {
+  auto* ring = active_ring.load(std::memory_order_acquire);
+  if (ring == nullptr) {
+    return;
+  }
+  recordEvent(
+      ring,
+      nullptr,
+      alloc_size,
+      total_allocated,
+      total_reserved,
+      device,
+      /*is_oom=*/true);
+
+  // The process may be about to die; write the tail of the buffer to the
+  // log so the last allocations survive in post-mortems.
+  LOG(WARNING) << "Allocation of " << alloc_size << " bytes failed on "
+               << device << " (allocated: " << total_allocated
+               << ", reserved: " << total_reserved
+               << "); memory flight recorder tail follows. Use"
+               << " torch._C._profiler._dump_memory_flight_recorder() for the"
+               << " full buffer.";
+  const auto next = ring->next.load(std::memory_order_relaxed);
+  const auto capacity = ring->slots.size();
+  const auto count = std::min<uint64_t>(std::min<uint64_t>(next, capacity), kOomLogEvents);
+  for (uint64_t i = next - count; i != next; ++i) {
+    const auto& e = ring->slots[i % capacity];
+    LOG(WARNING) << "  t=" << e.timestamp_ns_ << "ns tid=" << e.tid_
+                 << " device=" << c10::Device(e.device_type_, e.device_index_)
+                 << (e.is_oom_ ? " OOM" : "") << " size=" << e.alloc_size_
+                 << " addr=0x" << std::hex << e.addr_ << std::dec
+                 << " allocated=" << e.total_allocated_
+                 << " reserved=" << e.total_reserved_ << " op="
+                 << (e.op_name_[0] != '\0' ? e.op_name_ : "<none>");
+  }
+}
+
+} // namespace
+
+void enableMemoryFlightRecorder(size_t capacity) {
+  TORCH_CHECK(capacity > 0, "Memory flight recorder capacity must be > 0");
+  std::lock_guard<std::mutex> guard(control_mutex);
+  TORCH_CHECK(
+      active_ring.load() == nullptr,
+      "Memory flight recorder is already enabled");
+  active_ring.store(new Ring(capacity), std::memory_order_release);
+  op_name_handle = at::addGlobalCallback(
+      at::RecordFunctionCallback(onOpEnter, onOpExit)
+          .scopes(
+              {at::RecordScope::FUNCTION,
+               at::RecordScope::BACKWARD_FUNCTION,
+               at::RecordScope::USER_SCOPE}));
+  c10::SetAllocationReportHook(onAllocationReport);
+  c10::SetOutOfMemoryReportHook(onOutOfMemoryReport);
+}
+
+void disableMemoryFlightRecorder() {
+  std::lock_guard<std::mutex> guard(control_mutex);
+  if (active_ring.load() == nullptr) {
+    return;
+  }
+  c10::SetAllocationReportHook(nullptr);
+  c10::SetOutOfMemoryReportHook(nullptr);
+  at::removeCallback(op_name_handle);
+  op_name_handle = 0;
+  // See the comment on `active_ring`: the retired ring is leaked on purpose.
+  active_ring.store(nullptr, std::memory_order_release);
+}
+
+bool memoryFlightRecorderEnabled() {
+  return active_ring.load(std::memory_order_acquire) != nullptr;
+}
+
+std::vector<MemoryFlightEvent> dumpMemoryFlightRecorder() {
+  std::vector<MemoryFlightEvent> out;
+  auto* ring = active_ring.load(std::memory_order_acquire);
+  if (ring == nullptr) {
+    return out;
+  }
+  const auto next = ring->next.load(std::memory_order_relaxed);
+  const auto capacity = ring->slots.size();
+  const auto count = std::min<uint64_t>(next, capacity);
+  out.reserve(count);
+  for (uint64_t i = next - count; i != next; ++i) {
+    out.push_back(ring->slots[i % capacity]);
+  }
+  return out;
+}
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <c10/core/Device.h>
+#include <c10/macros/Export.h>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+// A single allocator event captured by the memory flight recorder. Kept as
+// plain data (fixed size op name, no owning members) so that ring buffer
+// slots can be overwritten in place by concurrent writers.
+struct TORCH_API MemoryFlightEvent {
+  static constexpr size_t kOpNameLength = 64;
+
+  int64_t timestamp_ns_{0};
+  uint64_t tid_{0};
+  uintptr_t addr_{0};
+  int64_t alloc_size_{0}; // negative for frees, zero when is_oom_ is set
+  size_t total_allocated_{0};
+  size_t total_reserved_{0};
+  c10::DeviceType device_type_{c10::DeviceType::CPU};
+  c10::DeviceIndex device_index_{0};
+  bool is_oom_{false};
+  // Truncated name of the innermost RecordFunction active on the allocating
+  // thread, empty if the allocation happened outside any op.
+  char op_name_[kOpNameLength]{};
+};
+
+// Starts the standing flight recorder: a fixed-size circular buffer of the
+// most recent `capacity` allocator events, fed from
+// c10::reportMemoryUsageToProfiler on every thread regardless of whether a
+// trace is active. On an out of memory report the tail of the buffer is
+// written to the log so post-mortems work even when the process dies.
+TORCH_API void enableMemoryFlightRecorder(size_t capacity);
+
+// Stops recording. The collected events are dropped.
+TORCH_API void disableMemoryFlightRecorder();
+
+TORCH_API bool memoryFlightRecorderEnabled();
+
+// Snapshot of the ring, oldest event first. Best effort: events recorded
+// while the snapshot is taken may be torn or missing.
+TORCH_API std::vector<MemoryFlightEvent> dumpMemoryFlightRecorder();
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -74,8 +74,18 @@ struct DefaultStubs : public ProfilerStubs {
 
 REGISTER_DEFAULT(cuda, CUDA)
 REGISTER_DEFAULT(itt, ITT)
+REGISTER_DEFAULT(mps, MPS)
 #undef REGISTER_DEFAULT
 
+const ProfilerStubs* gpuFallbackStubs() {
+  // CUDA takes precedence if both backends are registered; falling back to
+  // the CUDA stubs when neither is preserves the original error message.
+  if (cudaStubs()->enabled() || !mpsStubs()->enabled()) {
+    return cudaStubs();
+  }
+  return mpsStubs();
+}
+
 } // namespace impl
 } // namespace profiler
 } // namespace torch
@@ -38,6 +38,11 @@ TORCH_API void registerCUDAMethods(ProfilerStubs* stubs);
 TORCH_API const ProfilerStubs* cudaStubs();
 TORCH_API void registerITTMethods(ProfilerStubs* stubs);
 TORCH_API const ProfilerStubs* ittStubs();
+TORCH_API void registerMPSMethods(ProfilerStubs* stubs);
+TORCH_API const ProfilerStubs* mpsStubs();
+// The stubs used by ProfilerState::KINETO_GPU_FALLBACK to time ops on the
+// device: CUDA if a CUDA backend is registered, otherwise MPS.
+TORCH_API const ProfilerStubs* gpuFallbackStubs();
 
 using vulkan_id_t = strong::type<
     int64_t,
@@ -0,0 +1,104 @@
+#include <ATen/mps/MPSStream.h>
+#include <torch/csrc/profiler/stubs/base.h>
+#include <torch/csrc/profiler/util.h>
+
+#include <atomic>
+#include <memory>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+namespace {
+
+// A GPU-timeline timestamp, captured when the command buffer that was active
+// at record() time finishes executing. GPUEndTime is in seconds on the GPU
+// timeline, so two of these subtract into a device-side interval the same way
+// a pair of cudaEvents does.
+struct MPSTimingEvent {
+  std::atomic<int64_t> gpu_time_ns{0};
+};
+
+MPSTimingEvent* toTimingEvent(const ProfilerEventStub& stub) {
+  // ProfilerEventStub is typed for CUDA events, but the profiler core only
+  // passes the pointer around opaquely, so we keep our own event type behind
+  // it (see record() below).
+  return reinterpret_cast<MPSTimingEvent*>(stub.get());
+}
+
+struct MPSMethods : public ProfilerStubs {
+  void record(int* device, ProfilerEventStub* event, int64_t* cpu_ns)
+      const override {
+    if (device) {
+      // there is a single MPS device
+      *device = 0;
+    }
+    auto mps_event = std::make_shared<MPSTimingEvent>();
+    // the aliasing constructor keeps the MPSTimingEvent alive through the
+    // CUevent_st-typed stub the profiler stores
+    *event = std::shared_ptr<CUevent_st>(
+        mps_event, reinterpret_cast<CUevent_st*>(mps_event.get()));
+    if (cpu_ns) {
+      *cpu_ns = torch::profiler::impl::getTime();
+    }
+    // Completion handlers fire in submission order, so the captured time is
+    // the point on the GPU timeline at which all work encoded so far has
+    // finished executing. The block copies `mps_event`, keeping it alive
+    // until the handler runs.
+    at::mps::getDefaultMPSStream()->addCompletedHandler(
+        ^(id<MTLCommandBuffer> buffer) {
+          mps_event->gpu_time_ns.store(
+              static_cast<int64_t>([buffer GPUEndTime] * 1e9),
+              std::memory_order_release);
+        });
+  }
+
+  float elapsed(const ProfilerEventStub* event, const ProfilerEventStub* event2)
+      const override {
+    // flush pending work and wait so both completion handlers have fired
+    at::mps::getDefaultMPSStream()->synchronize(
+        at::mps::SyncType::COMMIT_AND_WAIT);
+    const int64_t start_ns =
+        toTimingEvent(*event)->gpu_time_ns.load(std::memory_order_acquire);
+    const int64_t end_ns =
+        toTimingEvent(*event2)->gpu_time_ns.load(std::memory_order_acquire);
+    TORCH_CHECK(
+        start_ns > 0 && end_ns > 0,
+        "MPS profiler events were not recorded on the GPU");
+    // microseconds, matching the CUDA stub
+    return static_cast<float>(end_ns - start_ns) / 1000.0f;
+  }
+
+  // Instruments signposts for MPS are emitted by at::mps::MPSProfiler; these
+  // annotation hooks have no separate backend to forward to.
+  void mark(const char* name) const override {}
+
+  void rangePush(const char* name) const override {}
+
+  void rangePop() const override {}
+
+  void onEachDevice(std::function<void(int)> op) const override {
+    op(0);
+  }
+
+  void synchronize() const override {
+    at::mps::getDefaultMPSStream()->synchronize(
+        at::mps::SyncType::COMMIT_AND_WAIT);
+  }
+
+  bool enabled() const override {
+    return true;
+  }
+};
+
+struct RegisterMPSMethods {
+  RegisterMPSMethods() {
+    static MPSMethods methods;
+    registerMPSMethods(&methods);
+  }
+};
+RegisterMPSMethods reg;
+
+} // namespace
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -6,6 +6,7 @@ import torch.distributed as dist
 from . import (
     debugging_hooks as debugging,
     default_hooks as default,
+    hierarchical_allreduce_hook as hierarchical,
     powerSGD_hook as powerSGD,
     quantization_hooks as quantization,
     optimizer_overlap_hooks as optimizer_overlap,
@@ -36,6 +37,18 @@ def _powerSGD_comm_hook_wrapper(
     model.register_comm_hook(powerSGD_state, comm_hook)
 
 
+def _hierarchical_allreduce_comm_hook_wrapper(comm_hook, model, state, subgroup_size=None):
+    """
+    The input state is ignored; the hierarchical hook derives its intra- and
+    cross-node subgroups from the default process group, which every rank must
+    have joined before registration.
+    """
+    hierarchical_state = hierarchical.HierarchicalAllreduceState(
+        subgroup_size=subgroup_size
+    )
+    model.register_comm_hook(hierarchical_state, comm_hook)
+
+
 class DDPCommHookType(Enum):
     """
     DDPCommHookType enumerates the hooks of ``torch.distributed.algorithms.ddp_comm_hooks``
@@ -80,6 +93,12 @@ class DDPCommHookType(Enum):
         comm_hook=powerSGD.batched_powerSGD_hook,
         matrix_approximation_rank=2,
     )
+    # Cuts inter-node allreduce traffic by the number of ranks per node; only
+    # useful for multi-node jobs with a fast intra-node interconnect.
+    HIERARCHICAL_ALLREDUCE = partial(
+        _hierarchical_allreduce_comm_hook_wrapper,
+        comm_hook=hierarchical.hierarchical_allreduce_hook,
+    )
     NOOP = partial(
         _ddp_comm_hook_wrapper, comm_hook=debugging.noop_hook,
     )
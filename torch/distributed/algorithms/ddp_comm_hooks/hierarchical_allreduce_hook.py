@@ -0,0 +1,120 @@
+import torch
+import torch.distributed as dist
+
+__all__ = ["HierarchicalAllreduceState", "hierarchical_allreduce_hook"]
+
+
+class HierarchicalAllreduceState:
+    r"""
+    Stores the subgroups used by :meth:`hierarchical_allreduce_hook`.
+
+    On construction, every rank of the default process group must call into
+    this, since subgroup creation is itself collective. Two families of
+    subgroups are created: one *intra-node* subgroup per machine (all ranks on
+    that machine, typically connected over NVLink), and one *cross-node*
+    subgroup per local rank (the ranks holding the same local index on every
+    machine, communicating over the inter-node fabric).
+
+    Args:
+        subgroup_size (int, optional): The number of ranks per machine. If
+            ``None``, the number of CUDA devices on this machine is used, which
+            assumes a homogeneous cluster. The world size must be divisible by
+            the subgroup size.
+    """
+
+    def __init__(self, subgroup_size=None):
+        self.intra_node_group, _ = dist.new_subgroups(group_size=subgroup_size)
+        self.subgroup_size = self.intra_node_group.size()
+        world_size = dist.get_world_size()
+        if world_size % self.subgroup_size != 0:
+            raise ValueError(
+                f"The world size ({world_size}) must be divisible by "
+                f"the subgroup size ({self.subgroup_size})."
+            )
+        num_nodes = world_size // self.subgroup_size
+        cross_node_ranks = [
+            [local_rank + node * self.subgroup_size for node in range(num_nodes)]
+            for local_rank in range(self.subgroup_size)
+        ]
+        self.cross_node_group, _ = dist.new_subgroups_by_enumeration(
+            cross_node_ranks
+        )
+
+
+def hierarchical_allreduce_hook(
+    state: HierarchicalAllreduceState, bucket: dist.GradBucket
+) -> torch.futures.Future[torch.Tensor]:
+    """
+    This DDP communication hook replaces the flat allreduce with a three-stage
+    hierarchical schedule: a reduce-scatter inside each node, an allreduce of
+    the resulting 1/``subgroup_size`` shards across nodes, and an all-gather
+    inside each node. Only the shard crosses the inter-node fabric, so with
+    ``k`` ranks per node the inter-node traffic drops by a factor of ``k``
+    compared to a flat ring spanning all ranks, while the intra-node stages
+    run over the much faster local interconnect. The result is numerically
+    equivalent to ``allreduce_hook`` up to floating-point reduction order.
+
+    This hook assumes the default process group spans a homogeneous cluster
+    (same number of ranks per node, ranks numbered contiguously per node, as
+    launched by e.g. torchrun) and requires a backend whose collectives return
+    CUDA futures (i.e. NCCL). On a single node it degenerates to a plain
+    allreduce over the intra-node group.
+
+    Example::
+        >>> # xdoctest: +SKIP
+        >>> state = HierarchicalAllreduceState()
+        >>> ddp_model.register_comm_hook(state, hierarchical_allreduce_hook)
+    """
+    buffer = bucket.buffer()
+    world_size = dist.get_world_size()
+    subgroup_size = state.subgroup_size
+
+    # Apply the division first to avoid overflow, especially for FP16.
+    buffer.div_(world_size)
+
+    if subgroup_size == world_size or subgroup_size == 1:
+        # Single node (or a single rank per node): there is no hierarchy to
+        # exploit, so issue one flat allreduce over the group that spans
+        # everything.
+        group = (
+            state.intra_node_group
+            if subgroup_size == world_size
+            else state.cross_node_group
+        )
+        return (
+            dist.all_reduce(buffer, group=group, async_op=True)
+            .get_future()
+            .then(lambda fut: fut.value()[0])
+        )
+
+    # Pad the bucket so it splits evenly into one shard per local rank.
+    numel = buffer.numel()
+    shard_numel = (numel + subgroup_size - 1) // subgroup_size
+    if shard_numel * subgroup_size == numel:
+        padded = buffer
+    else:
+        padded = buffer.new_empty(shard_numel * subgroup_size)
+        padded[:numel].copy_(buffer)
+        padded[numel:].zero_()
+    shard = buffer.new_empty(shard_numel)
+
+    intra_fut = dist.reduce_scatter_tensor(
+        shard, padded, group=state.intra_node_group, async_op=True
+    ).get_future()
+
+    def cross_node_allreduce(fut):
+        return (
+            dist.all_reduce(shard, group=state.cross_node_group, async_op=True)
+            .get_future()
+            .wait()[0]
+        )
+
+    def intra_node_allgather(fut):
+        dist.all_gather_into_tensor(
+            padded, shard, group=state.intra_node_group, async_op=True
+        ).get_future().wait()
+        if padded is not buffer:
+            buffer.copy_(padded[:numel])
+        return buffer
+
+    return intra_fut.then(cross_node_allreduce).then(intra_node_allgather)
@@ -1404,14 +1404,24 @@ class P2POp:
 
 
 @contextlib.contextmanager
-def _coalescing_manager(group, device, reqs):
+def _coalescing_manager(group, device, reqs=None):
     if group is None:
         group = _get_default_group()
     group._start_coalescing(device)
     try:
         yield
     finally:
-        group._end_coalescing(device, reqs)
+        if reqs is None:
+            # Flush the block as one batch tracked by a single work object.
+            # wait() only blocks the current stream on the batch's end events,
+            # so this keeps the block asynchronous with respect to the host.
+            # Callers that need to hold on to per-op works (e.g.
+            # batch_isend_irecv) pass `reqs` and wait themselves.
+            work = group._end_coalescing(device)
+            if work is not None:
+                work.wait()
+        else:
+            group._end_coalescing(device, reqs)
 
 
 def batch_isend_irecv(p2p_op_list):
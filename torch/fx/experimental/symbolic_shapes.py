@@ -227,6 +227,7 @@ def constrain_unify(a, b):
             assert isinstance(b.node.expr, sympy.Symbol), "constraining non-Symbols NYI"
             shape_env = b.node.shape_env
             shape_env.replacements[b.node.expr] = sympy.Integer(a)
+            shape_env._version_counter += 1
     else:
         # TODO: Actually, we can support this as long as one of them is a symbol.
         # NB: We can't actually do "unification" as our operators are not
@@ -235,11 +236,13 @@ def constrain_unify(a, b):
         shape_env = a.node.shape_env
         if not isinstance(b, SymInt):
             shape_env.replacements[a.node.expr] = sympy.Integer(b)
+            shape_env._version_counter += 1
         else:
             assert a.node.shape_env is b.node.shape_env
             assert isinstance(b.node.expr, sympy.Symbol), "constraining non-Symbols NYI"
             new_var = shape_env._find(a.node.expr)
             shape_env.replacements[b.node.expr] = new_var
+            shape_env._version_counter += 1
 
 def guard_bool(a):
     if isinstance(a, SymBool):
@@ -1144,8 +1147,9 @@ def _lru_cache(fn, maxsize=None):
     @functools.wraps(fn)
     def wrapper(self, *args, **kwargs):
         nonlocal prior_key
-        if prior_key != self._get_key():
-            prior_key = self._get_key()
+        cur_key = self._get_key()
+        if prior_key != cur_key:
+            prior_key = cur_key
             fn_cache.cache_clear()
         return fn_cache(self, *args, **kwargs)
 
@@ -1217,6 +1221,14 @@ class ShapeEnv:
         self.replacements: Dict["sympy.Symbol", "sympy.Expr"] = {}  #
         # Set holds a % b expressions that evaluate to 0.
         self.divisible: Set["sympy.Expr"] = set()
+        # Version counter for replacements/divisible.  The shape env is
+        # queried far more often than it learns new facts, so the _lru_cache
+        # wrapper keys its invalidation check off this single integer (via
+        # _get_key) rather than inspecting the containers themselves.  Bumped
+        # whenever a new replacement or divisibility fact is recorded; note
+        # that path compression in _find rewrites replacements in place
+        # without changing their meaning, so it deliberately does not bump.
+        self._version_counter = 0
         # Duck-shaping says that if two input tensors have the same size,
         # they get assigned the same symbolic variable
         self.val_to_var: Dict[int, "sympy.Expr"] = {}
@@ -1245,7 +1257,7 @@ class ShapeEnv:
         Defines the current "state" of the guards we've accumulated in this ShapeEnv.
         Determines when we need to invalidate our cache
         """
-        return (len(self.replacements), len(self.divisible))
+        return self._version_counter
 
     def _produce_dyn_sizes(self, ex: torch.Tensor, source: Source) -> List[sympy.Expr]:
         from torch._dynamo.source import TensorPropertySource, TensorProperty
@@ -1713,7 +1725,9 @@ class ShapeEnv:
             if len(res.free_symbols) > 0:
                 new_divisible.add(k)
 
-        self.divisible = new_divisible
+        if new_divisible != self.divisible:
+            self.divisible = new_divisible
+            self._version_counter += 1
 
     @_lru_cache
     def simplify(self, expr: "sympy.Expr") -> "sympy.Expr":
@@ -1840,6 +1854,7 @@ class ShapeEnv:
                 if all(t.is_integer for t in sympy.preorder_traversal(solution)):
                     new_var = self._find(solution)
                     self.replacements[cast(sympy.Symbol, free[0])] = new_var
+                    self._version_counter += 1
             except NotImplementedError:
                 pass
             except RecursionError:
@@ -1850,6 +1865,7 @@ class ShapeEnv:
                 solutions = sympy.solve(lhs - rhs, mod_expr, dict=True)
                 if len(solutions) == 1 and solutions[0][mod_expr] == 0:
                     self.divisible.add(mod_expr)
+                    self._version_counter += 1
             except NotImplementedError:
                 pass
         return
@@ -15,11 +15,12 @@ contents, and we recommend referring to very good docs of the original module.
 """
 import torch
 import sys
-from .reductions import init_reductions
+from .reductions import init_reductions, set_arena_sharing, get_arena_sharing
 import multiprocessing
 
 __all__ = ['set_sharing_strategy', 'get_sharing_strategy',
-           'get_all_sharing_strategies']
+           'get_all_sharing_strategies',
+           'set_arena_sharing', 'get_arena_sharing']
 
 
 from multiprocessing import *  # noqa: F403
@@ -303,6 +303,67 @@ def storage_from_cache(cls, key):
     return torch.UntypedStorage._new_with_weak_ptr(storage_ref.cdata)
 
 
+# Arena sharing packs small storages into pooled shm segments so that the
+# file_descriptor strategy creates one fd and one mmap per segment instead
+# of one per storage (see Note [Arena sharing] in torch/csrc/StorageSharing.cpp).
+# Opt-in because the packed copies keep their whole segment alive until
+# every slice of it is released on both ends.
+_ARENA_SEGMENT_SIZE = 4 * 1024 * 1024
+_ARENA_MAX_STORAGE_BYTES = 64 * 1024
+_ARENA_ALIGNMENT = 64
+_arena_enabled = os.environ.get('TORCH_SHM_ARENA', '0') == '1'
+_arena_segment = None
+_arena_offset = 0
+
+
+def set_arena_sharing(enabled):
+    r"""Routes small CPU storages sent with the ``file_descriptor`` sharing
+    strategy through pooled shared memory segments, cutting the number of
+    file descriptors and map/unmap syscalls when many small tensors are
+    shared."""
+    global _arena_enabled
+    _arena_enabled = enabled
+
+
+def get_arena_sharing():
+    return _arena_enabled
+
+
+def _arena_share(storage):
+    global _arena_segment, _arena_offset
+    nbytes = storage.nbytes()
+    aligned = (nbytes + _ARENA_ALIGNMENT - 1) & ~(_ARENA_ALIGNMENT - 1)
+    if _arena_segment is None or _arena_offset + aligned > _arena_segment.nbytes():
+        _arena_segment = torch.UntypedStorage._new_using_fd_cpu(
+            max(_ARENA_SEGMENT_SIZE, aligned))
+        _arena_offset = 0
+    fd, segment_size, offset, size, packed_now = storage._share_fd_arena_cpu_(
+        _arena_segment, _arena_offset)
+    if packed_now:
+        _arena_offset += aligned
+    return fd, segment_size, offset, size
+
+
+def rebuild_storage_fd_arena(cls, df, segment_size, offset, size):
+    fd = df.detach()
+    try:
+        segment_key = fd_id(fd)
+        storage = storage_from_cache(cls, (segment_key, offset))
+        if storage is not None:
+            return storage
+        segment = storage_from_cache(torch.UntypedStorage, segment_key)
+        if segment is None:
+            # One mmap per segment; every slice rebuilt afterwards reuses it.
+            segment = torch.UntypedStorage._new_shared_fd_cpu(fd, segment_size)
+            shared_cache[segment_key] = StorageWeakRef(segment)
+        storage = torch.UntypedStorage._new_shared_fd_arena_cpu(
+            segment, offset, size)
+        shared_cache[(segment_key, offset)] = StorageWeakRef(storage)
+        return storage
+    finally:
+        os.close(fd)
+
+
 def rebuild_storage_fd(cls, df, size):
     fd = df.detach()
     try:
@@ -365,6 +426,13 @@ def reduce_storage(storage):
         # This is special cased because Empty tensors
         # (with size 0) cannot be mmapped.
         return (rebuild_storage_empty, (type(storage),))
+    elif (_arena_enabled and storage.nbytes() <= _ARENA_MAX_STORAGE_BYTES
+            and (not storage.is_shared() or storage._is_arena_view_cpu())):
+        fd, segment_size, offset, size = _arena_share(storage)
+        df = multiprocessing.reduction.DupFd(fd)
+        cache_key = (fd_id(fd), offset)
+        metadata = (df, segment_size, offset, size)
+        rebuild = rebuild_storage_fd_arena  # type: ignore[assignment]
     else:
         fd, size = storage._share_fd_cpu_()
         df = multiprocessing.reduction.DupFd(fd)
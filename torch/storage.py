@@ -39,6 +39,8 @@ class _StorageBase:
     # Defined in torch/csrc/generic/StorageSharing.cpp
     def _share_filename_cpu_(self, *args, **kwargs): ...  # noqa: E704
     def _share_fd_cpu_(self, *args, **kwargs): ...  # noqa: E704
+    def _share_fd_arena_cpu_(self, *args, **kwargs): ...  # noqa: E704
+    def _is_arena_view_cpu(self) -> bool: ...  # noqa: E704
     @classmethod
     def _new_using_filename_cpu(cls: Type[T], size: int) -> T: ...  # noqa: E704
     @classmethod
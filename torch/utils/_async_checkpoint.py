@@ -0,0 +1,191 @@
+"""Asynchronous checkpointing with double-buffered snapshot tensors.
+
+``torch.save`` blocks the caller for the full serialization and file write.
+For large models that stall can dwarf a training step, even though the only
+part that has to happen synchronously is taking a consistent snapshot of
+the tensors. :class:`AsyncCheckpointWriter` splits the two phases:
+
+1. ``save()`` copies every tensor in the checkpoint into one of two
+   reusable snapshot buffers. CUDA tensors are copied on a side stream
+   into pinned CPU buffers, so the caller only pays the enqueue cost; the
+   device-to-host transfer overlaps with the next training step.
+2. A background thread waits for the snapshot copies to finish and runs
+   the regular ``torch.save`` serializer (and thus PyTorchStreamWriter)
+   against the snapshot.
+
+Double buffering means one checkpoint can be serializing while the next
+snapshot is being taken; a third ``save()`` blocks until a buffer frees
+up, which bounds the memory overhead to two snapshots.
+
+This is a private utility; the API may change without notice.
+"""
+import queue
+import threading
+
+import torch
+from torch.utils._pytree import tree_flatten, tree_unflatten
+
+__all__ = ["AsyncCheckpointWriter"]
+
+
+class _SnapshotSlot:
+    """One snapshot buffer set plus the event guarding its copies."""
+
+    def __init__(self):
+        self.buffers = []
+        self.event = None
+
+    def take_snapshot(self, leaves):
+        """Copies tensor leaves into this slot's buffers, reusing storage
+        from the previous checkpoint when shapes and dtypes still match."""
+        copy_stream = None
+        if torch.cuda.is_initialized() and any(
+            isinstance(leaf, torch.Tensor) and leaf.is_cuda for leaf in leaves
+        ):
+            copy_stream = torch.cuda.Stream()
+            copy_stream.wait_stream(torch.cuda.current_stream())
+
+        snapshot = []
+        buffers = []
+        reusable = self.buffers
+        for i, leaf in enumerate(leaves):
+            if not isinstance(leaf, torch.Tensor):
+                snapshot.append(leaf)
+                buffers.append(None)
+                continue
+            leaf = leaf.detach()
+            buf = reusable[i] if i < len(reusable) else None
+            if (
+                buf is None
+                or buf.shape != leaf.shape
+                or buf.dtype != leaf.dtype
+            ):
+                if leaf.is_cuda:
+                    buf = torch.empty_like(leaf, device="cpu", pin_memory=True)
+                else:
+                    buf = torch.empty_like(leaf)
+            if leaf.is_cuda:
+                with torch.cuda.stream(copy_stream):
+                    buf.copy_(leaf, non_blocking=True)
+                # The source is read on the copy stream; keep the caching
+                # allocator from handing its storage to another tensor
+                # before the copy has finished.
+                leaf.record_stream(copy_stream)
+            else:
+                buf.copy_(leaf)
+            snapshot.append(buf)
+            buffers.append(buf)
+        self.buffers = buffers
+        if copy_stream is not None:
+            # Order the caller's subsequent kernels after the snapshot
+            # reads: without this the next training step could mutate the
+            # parameters while the D2H copies are still in flight, tearing
+            # the snapshot the docstring promises is consistent.
+            torch.cuda.current_stream().wait_stream(copy_stream)
+            self.event = torch.cuda.Event()
+            self.event.record(copy_stream)
+        else:
+            self.event = None
+        return snapshot
+
+    def wait_for_snapshot(self):
+        if self.event is not None:
+            self.event.synchronize()
+            self.event = None
+
+
+class AsyncCheckpointWriter:
+    """Writes checkpoints on a background thread after a cheap snapshot.
+
+    Usage::
+
+        writer = AsyncCheckpointWriter()
+        for step in range(num_steps):
+            train_step(...)
+            if step % save_every == 0:
+                writer.save(model.state_dict(), f"ckpt_{step}.pt")
+        writer.close()  # or use it as a context manager
+
+    The object graph passed to ``save()`` must flatten with
+    :mod:`torch.utils._pytree` (dicts, lists, tuples and tensor or
+    plain-value leaves), which covers state_dicts. The snapshot aliases
+    nothing from the caller, so the caller may mutate its tensors
+    immediately after ``save()`` returns.
+    """
+
+    _SHUTDOWN = object()
+
+    def __init__(self, num_buffers=2):
+        if num_buffers < 1:
+            raise ValueError(
+                f"num_buffers must be at least 1, got {num_buffers}"
+            )
+        self._slots = queue.Queue()
+        for _ in range(num_buffers):
+            self._slots.put(_SnapshotSlot())
+        self._pending = queue.Queue()
+        self._error = None
+        self._worker = threading.Thread(
+            target=self._serialize_loop, name="AsyncCheckpointWriter", daemon=True
+        )
+        self._worker.start()
+
+    def save(self, obj, f, **save_kwargs):
+        """Snapshots ``obj`` and schedules ``torch.save(snapshot, f)``.
+
+        Blocks only while taking the snapshot (and, if all buffers are in
+        flight, until the oldest write completes). Errors from background
+        writes are re-raised here or in ``close()``.
+        """
+        self._maybe_raise()
+        leaves, spec = tree_flatten(obj)
+        slot = self._slots.get()
+        try:
+            snapshot = tree_unflatten(slot.take_snapshot(leaves), spec)
+        except Exception:
+            self._slots.put(slot)
+            raise
+        self._pending.put((slot, snapshot, f, save_kwargs))
+
+    def flush(self):
+        """Blocks until every scheduled checkpoint has been written."""
+        self._pending.join()
+        self._maybe_raise()
+
+    def close(self):
+        """Flushes pending checkpoints and stops the background thread."""
+        if self._worker is None:
+            return
+        self._pending.join()
+        self._pending.put(self._SHUTDOWN)
+        self._worker.join()
+        self._worker = None
+        self._maybe_raise()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+    def _maybe_raise(self):
+        if self._error is not None:
+            error, self._error = self._error, None
+            raise error
+
+    def _serialize_loop(self):
+        while True:
+            item = self._pending.get()
+            if item is self._SHUTDOWN:
+                self._pending.task_done()
+                return
+            slot, snapshot, f, save_kwargs = item
+            try:
+                slot.wait_for_snapshot()
+                torch.save(snapshot, f, **save_kwargs)
+            except Exception as e:  # noqa: B902
+                self._error = e
+            finally:
+                del snapshot
+                self._slots.put(slot)
+                self._pending.task_done()
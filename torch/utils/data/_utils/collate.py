@@ -159,6 +159,12 @@ def collate_tensor_fn(batch, *, collate_fn_map: Optional[Dict[Union[Type, Tuple[
         numel = sum(x.numel() for x in batch)
         storage = elem._typed_storage()._new_shared(numel, device=elem.device)
         out = elem.new(storage).resize_(len(batch), *list(elem.size()))
+    if elem.device.type == 'cpu' and not elem.requires_grad:
+        # Scatters the example copies across the intra-op pool instead of
+        # the serial copy torch.stack does.
+        if out is None:
+            return torch._stack_parallel(batch, 0)
+        return torch._stack_parallel(batch, 0, out=out)
     return torch.stack(batch, 0, out=out)
 
 
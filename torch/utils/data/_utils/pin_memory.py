@@ -51,6 +51,16 @@ def _pin_memory_loop(in_queue, out_queue, device_id, done_event, device):
         do_one_step()
 
 def pin_memory(data, device=None):
+    if device is None or device == "cuda":
+        # Fast path: pin the whole (possibly nested) batch in one native call,
+        # which avoids per-tensor Python dispatch and copies large storages
+        # with an internal thread team. Containers the native routine cannot
+        # faithfully reconstruct raise TypeError, in which case we fall back
+        # to the recursive Python implementation below.
+        try:
+            return torch._C._pin_memory_batch(data)
+        except TypeError:
+            pass
     if isinstance(data, torch.Tensor):
         return data.pin_memory(device)
     elif isinstance(data, str):
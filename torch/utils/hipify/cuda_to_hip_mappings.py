@@ -301,6 +301,7 @@ CUDA_TYPE_NAME_MAP = collections.OrderedDict(
             ("hipLibraryPropertyType_t", CONV_TYPE, API_RUNTIME, HIP_UNSUPPORTED),
         ),
         ("cudaStreamCallback_t", ("hipStreamCallback_t", CONV_TYPE, API_RUNTIME)),
+        ("cudaHostFn_t", ("hipHostFn_t", CONV_TYPE, API_RUNTIME)),
         ("cudaArray", ("hipArray", CONV_MEM, API_RUNTIME)),
         ("cudaArray_t", ("hipArray_t", CONV_MEM, API_RUNTIME)),
         ("cudaArray_const_t", ("hipArray_const_t", CONV_MEM, API_RUNTIME)),
@@ -4122,6 +4123,7 @@ CUDA_IDENTIFIER_MAP = collections.OrderedDict(
         ("cudaStreamGetFlags", ("hipStreamGetFlags", CONV_STREAM, API_RUNTIME)),
         ("cudaStreamQuery", ("hipStreamQuery", CONV_STREAM, API_RUNTIME)),
         ("cudaStreamAddCallback", ("hipStreamAddCallback", CONV_STREAM, API_RUNTIME)),
+        ("cudaLaunchHostFunc", ("hipLaunchHostFunc", CONV_STREAM, API_RUNTIME)),
         (
             "cudaStreamAttachMemAsync",
             ("hipStreamAttachMemAsync", CONV_STREAM, API_RUNTIME, HIP_UNSUPPORTED),
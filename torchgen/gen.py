@@ -2129,6 +2129,63 @@ def gen_headers(
 
     core_fm.write("enum_tag.h", gen_tags_enum)
 
+    def gen_static_operator_name_table() -> Dict[str, str]:
+        # Mirrors the crc64 in c10/util/ConstexprCrc.h (Jones polynomial,
+        # reflected, zero init, no final xor) so the Dispatcher can hash a
+        # runtime OperatorName and probe this table directly.
+        poly = 0x95AC9329AC4BC9B5
+        crc_table = []
+        for i in range(256):
+            crc = i
+            for _ in range(8):
+                crc = (crc >> 1) ^ poly if crc & 1 else crc >> 1
+            crc_table.append(crc)
+
+        def crc64(s: str) -> int:
+            acc = 0
+            for b in s.encode("ascii"):
+                acc = crc_table[(acc ^ b) & 0xFF] ^ (acc >> 8)
+            return acc
+
+        keys = sorted(
+            f"aten::{f.func.name.name}.{f.func.name.overload_name}"
+            for f in native_functions
+        )
+        table_size = 1
+        while table_size < 2 * len(keys):
+            table_size *= 2
+
+        empty = 0xFFFFFFFF
+        slots: List[Optional[Tuple[int, int]]] = [None] * table_size
+        max_probe = 0
+        for index, key in enumerate(keys):
+            h = crc64(key)
+            probe = 0
+            while slots[(h + probe) % table_size] is not None:
+                probe += 1
+            max_probe = max(max_probe, probe)
+            slots[(h + probe) % table_size] = (h, index)
+
+        slot_lines = ",\n".join(
+            f"    {{0x{slot[0]:016x}ull, {slot[1]}u}}"
+            if slot is not None
+            else "    {0ull, kStaticOperatorEmptySlot}"
+            for slot in slots
+        )
+        return {
+            "static_operator_count": str(len(keys)),
+            "static_operator_table_size": str(table_size),
+            "static_operator_max_probe": str(max_probe),
+            "static_operator_names": ",\n".join(
+                f'    "{key}"' for key in keys
+            ),
+            "static_operator_hash_table": slot_lines,
+        }
+
+    core_fm.write(
+        "static_operator_name_table.h", gen_static_operator_name_table
+    )
+
 
 def gen_source_files(
     *,
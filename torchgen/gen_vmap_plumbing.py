@@ -81,12 +81,20 @@ def gen_unwraps(
 def gen_case_where_all_bdims_are_none(
     outer_sig: DispatcherSignature, schema: FunctionSchema, cur_level_var: str
 ) -> str:
+    # This case is emitted after the unwrapping code, so for plain and
+    # optional tensors the bdims computed there can be reused directly;
+    # unwrapping them a second time via isBatchedAtLevel would double the
+    # per-call BatchedTensorImpl probing. Tensor lists are not unwrapped
+    # ahead of time, so they still go through isBatchedAtLevel.
     conditions = []
     flat_args = schema.arguments.flat_all
     for arg in flat_args:
         if not arg.type.is_tensor_like():
             continue
-        conditions.append(f"!isBatchedAtLevel({arg.name}, {cur_level_var})")
+        if is_tensor(arg.type) or is_optional_tensor(arg.type):
+            conditions.append(f"!{arg.name}_bdim.has_value()")
+        else:
+            conditions.append(f"!isBatchedAtLevel({arg.name}, {cur_level_var})")
 
     sig = DispatcherSignature.from_schema(schema)
     translated_args = ", ".join(
@@ -169,8 +177,8 @@ template <typename batch_rule_t, batch_rule_t batch_rule>
   auto maybe_layer = maybeCurrentDynamicLayer();
   vmap_check_escaped(maybe_layer, "gen_vmap_inplace_plumbing");
   int64_t {cur_level_var} = maybe_layer->layerId();
-{textwrap.indent(bdims_all_none_case, "  ")}
 {textwrap.indent(unwraps, "  ")}
+{textwrap.indent(bdims_all_none_case, "  ")}
   batch_rule({', '.join(unwrapped_arg_list)});
   return {schema.arguments.flat_all[0].name};
 }}"""
@@ -191,8 +199,8 @@ template <typename batch_rule_t, batch_rule_t batch_rule>
   auto maybe_layer = maybeCurrentDynamicLayer();
   vmap_check_escaped(maybe_layer, "gen_vmap_plumbing_no_returns");
   int64_t {cur_level_var} = maybe_layer->layerId();
-{textwrap.indent(bdims_all_none_case, "  ")}
 {textwrap.indent(unwraps, "  ")}
+{textwrap.indent(bdims_all_none_case, "  ")}
   batch_rule({', '.join(unwrapped_arg_list)});
 }}"""
 
@@ -234,8 +242,8 @@ template <typename batch_rule_t, batch_rule_t batch_rule>
   auto maybe_layer = maybeCurrentDynamicLayer();
   vmap_check_escaped(maybe_layer, "gen_vmap_plumbing");
   int64_t {cur_level_var} = maybe_layer->layerId();
-{textwrap.indent(bdims_all_none_case, "  ")}
 {textwrap.indent(unwraps, "  ")}
+{textwrap.indent(bdims_all_none_case, "  ")}
   auto {results_var} = batch_rule({', '.join(unwrapped_arg_list)});
   {wrapped_returns}
 }}"""
@@ -83,7 +83,10 @@ INPLACE_OPS_THAT_DONT_GET_GROUPED_PROPERLY = [
     # We should either fix this schema so it can be grouped properly,
     # or allow the codegen to generate new functional/out= NativeFunctions for this op
     # (which would require changing its overload name to prevent overload ambiguity).
-    "polygamma_"
+    "polygamma_",
+    # mutates a second (non-self) argument, `lengths`, so the functional and
+    # out= variants the codegen would produce can't express its schema.
+    "_kv_cache_append_",
 ]
 
 # Groups "similar" NativeFunctions together